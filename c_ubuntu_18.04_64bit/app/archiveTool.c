@@ -0,0 +1,308 @@
+#define _GNU_SOURCE
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+#include <rtxsrc/rtxPrintStream.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "captureLog.h"
+#include "msgArchive.h"
+
+#define ARCHIVE_HDR_LEN			16			/* skipped by decodeSample */
+
+typedef struct{
+	const char *pArchive;
+	const char *pCaptureDir;			/* ingest, NULL: query */
+	unsigned int offset;
+	unsigned int blockSec;
+	int print;
+	ARCHIVE_QUERY query;
+} ARCHIVE_CONFIG;
+
+/* state of a query while the matches come in */
+typedef struct{
+	OSCTXT ctxt;
+	int print;
+	unsigned long long decodeCnt;
+	unsigned long long errorCnt;
+	unsigned long long decodeNs;
+} ARCHIVE_OUTPUT;
+
+static ARCHIVE_CONFIG archive_config;
+
+static int sParseArgs(int argc, char **argv, ARCHIVE_CONFIG *pConfig);
+static int sParseTime(const char *pText, unsigned long long *pNs);
+static int sIngest(const ARCHIVE_CONFIG *pConfig);
+static int sQuery(const ARCHIVE_CONFIG *pConfig);
+static int sMatch(void *pArg, const ARCHIVE_RECORD *pRecord);
+static void sPrint(void *pPrntStrmInfo, const char *fmtspec, va_list arglist);
+static unsigned long long sNow(void);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: Ingest a capture (captureLog) into an archive
+ *				  (msgArchive), or look up messages in one by type,
+ *				  time, TemporaryID or IntersectionReferenceID. Only
+ *				  the matches are decoded.
+ *
+ * Parameter	: archive      archive file
+ *				  -c dir       ingest the capture in dir
+ *				  -k octets    header before the MessageFrame (16)
+ *				  -b seconds   time span of a block (60)
+ *				  -m id        DSRCmsgID
+ *				  -f / -t time from / to, epoch seconds or
+ *				               YYYY-MM-DDTHH:MM:SS[.frac] local time
+ *				  -i id        TemporaryID, 8 hex digits
+ *				  -x [region:]id  IntersectionReferenceID
+ *				  -p           print the matches
+ *
+ * Returns		: 0, 1 on error
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	if (HAE_OK != sParseArgs(argc, argv, &archive_config))
+	{
+		return 1;
+	}
+	if (HAE_NULL != archive_config.pCaptureDir)
+	{
+		return (HAE_OK == sIngest(&archive_config)) ? 0 : 1;
+	}
+
+	return (HAE_OK == sQuery(&archive_config)) ? 0 : 1;
+}
+
+static int sParseArgs(int argc, char **argv, ARCHIVE_CONFIG *pConfig)
+{
+	ARCHIVE_QUERY *pQuery = &pConfig->query;
+	unsigned int tempId, region = 0, id = 0;
+	int opt, ok = HAE_TRUE;
+
+	memset(pConfig, 0x00, sizeof(ARCHIVE_CONFIG));
+	pConfig->offset = ARCHIVE_HDR_LEN;
+	pQuery->messageId = ARCHIVE_ANY;
+	pQuery->endNs = ~0ULL;
+
+	while (-1 != (opt = getopt(argc, argv, "c:k:b:m:f:t:i:x:p")))
+	{
+		switch (opt)
+		{
+			case 'c': pConfig->pCaptureDir = optarg; break;
+			case 'k': pConfig->offset = atoi(optarg); break;
+			case 'b': pConfig->blockSec = atoi(optarg); break;
+			case 'm': pQuery->messageId = atoi(optarg); break;
+			case 'f': ok &= (HAE_OK == sParseTime(optarg, &pQuery->startNs)); break;
+			case 't': ok &= (HAE_OK == sParseTime(optarg, &pQuery->endNs)); break;
+			case 'i':
+				ok &= (1 == sscanf(optarg, "%x", &tempId));
+				pQuery->flags |= ARCHIVE_QUERY_TEMP_ID;
+				pQuery->tempId[0] = tempId >> 24;
+				pQuery->tempId[1] = tempId >> 16;
+				pQuery->tempId[2] = tempId >> 8;
+				pQuery->tempId[3] = tempId;
+				break;
+			case 'x':
+				pQuery->flags |= ARCHIVE_QUERY_INTERSECTION;
+				if (2 == sscanf(optarg, "%u:%u", &region, &id))
+				{
+					pQuery->flags |= ARCHIVE_QUERY_REGION;
+					pQuery->region = region;
+				}
+				else
+				{
+					ok &= (1 == sscanf(optarg, "%u", &id));
+				}
+				pQuery->intersectionId = id;
+				ok &= (region <= 65535) && (id <= 65535);
+				break;
+			case 'p': pConfig->print = HAE_TRUE; break;
+			default:
+				ok = HAE_FALSE;
+				break;
+		}
+	}
+	/* one secondary index per query */
+	if ((!ok) || (optind != argc - 1) || ((pQuery->flags & ARCHIVE_QUERY_TEMP_ID) &&
+		(pQuery->flags & ARCHIVE_QUERY_INTERSECTION)))
+	{
+		printf("usage: %s -c capture-dir [-k offset] [-b block-sec] archive\n"
+			"       %s [-m id] [-f time] [-t time] [-i temp-id | -x [region:]id] [-p] archive\n", argv[0], argv[0]);
+		return HAE_ERROR;
+	}
+	pConfig->pArchive = argv[optind];
+
+	return HAE_OK;
+}
+
+static int sParseTime(const char *pText, unsigned long long *pNs)
+{
+	struct tm tm;
+	const char *pRest;
+	double frac = 0;
+	time_t sec;
+
+	memset(&tm, 0x00, sizeof(tm));
+	if (HAE_NULL != (pRest = strptime(pText, "%Y-%m-%dT%H:%M:%S", &tm)))
+	{
+		tm.tm_isdst = -1;
+		if ((('\0' != *pRest) && (1 != sscanf(pRest, "%lf", &frac))) || ((sec = mktime(&tm)) < 0))
+		{
+			return HAE_ERROR;
+		}
+		*pNs = (unsigned long long)sec * 1000000000ULL + (unsigned long long)(frac * 1e9);
+		return HAE_OK;
+	}
+	if ((1 != sscanf(pText, "%lf", &frac)) || (frac < 0))
+	{
+		printf("[ARCHIVE] ERROR : bad time %s\n", pText);
+		return HAE_ERROR;
+	}
+	*pNs = (unsigned long long)(frac * 1e9);
+
+	return HAE_OK;
+}
+
+static int sIngest(const ARCHIVE_CONFIG *pConfig)
+{
+	ARCHIVE_WRITER writer;
+	CAPTURE_READER reader;
+	CAPTURE_RECORD record;
+	unsigned long long start, skipCnt = 0;
+	double elapsed;
+
+	if (HAE_OK != CaptureLog_OpenReader(&reader, pConfig->pCaptureDir))
+	{
+		return HAE_ERROR;
+	}
+	if (HAE_OK != MsgArchive_OpenWriter(&writer, pConfig->pArchive, pConfig->blockSec))
+	{
+		CaptureLog_CloseReader(&reader);
+		return HAE_ERROR;
+	}
+
+	start = sNow();
+	while (HAE_OK == CaptureLog_Next(&reader, &record))
+	{
+		/* wall clock of the receive from the pair in the segment header */
+		if ((record.len <= pConfig->offset) || (HAE_OK != MsgArchive_Append(&writer,
+			reader.hdr.realNs + (record.monoNs - reader.hdr.monoNs), record.pData + pConfig->offset,
+			record.len - pConfig->offset)))
+		{
+			skipCnt++;
+		}
+	}
+	MsgArchive_CloseWriter(&writer);
+	CaptureLog_CloseReader(&reader);
+	elapsed = (sNow() - start) * 1e-9;
+
+	printf("ingested %llu messages, %llu bytes in %llu blocks, %.3f s = %.0f msg/s, %llu skipped\n", writer.recordCnt,
+		writer.byteCnt, writer.blockCnt, elapsed, (elapsed > 0) ? writer.recordCnt / elapsed : 0.0, skipCnt);
+	printf("IDs: %llu by peek, %llu by decode, %llu messages without\n", writer.peekCnt, writer.decodeCnt,
+		writer.noIdCnt);
+
+	return HAE_OK;
+}
+
+static int sQuery(const ARCHIVE_CONFIG *pConfig)
+{
+	ARCHIVE_READER reader;
+	ARCHIVE_OUTPUT output;
+	unsigned long long start;
+	int cnt;
+
+	memset(&output, 0x00, sizeof(output));
+	output.print = pConfig->print;
+	if (0 != rtInitContext(&output.ctxt))
+	{
+		printf("[ARCHIVE] ERROR : rtInitContext()\n");
+		return HAE_ERROR;
+	}
+	rtxSetPrintStream(&output.ctxt, sPrint, stdout);
+	if (HAE_OK != MsgArchive_OpenReader(&reader, pConfig->pArchive))
+	{
+		rtFreeContext(&output.ctxt);
+		return HAE_ERROR;
+	}
+
+	start = sNow();
+	cnt = MsgArchive_Query(&reader, &pConfig->query, sMatch, &output);
+	printf("%d matches in %.3f ms: %llu of %llu blocks skipped by time, %llu records looked at, %llu decoded "
+		"(%.1f us each), %llu decode errors\n", (cnt < 0) ? 0 : cnt, (sNow() - start) * 1e-6, reader.skipCnt,
+		reader.blockCnt, reader.scanCnt, output.decodeCnt, (0 != output.decodeCnt) ?
+		output.decodeNs * 1e-3 / output.decodeCnt : 0.0, output.errorCnt);
+
+	MsgArchive_CloseReader(&reader);
+	rtFreeContext(&output.ctxt);
+
+	return (cnt < 0) ? HAE_ERROR : HAE_OK;
+}
+
+/* decode one match, the frame and then its value */
+static int sMatch(void *pArg, const ARCHIVE_RECORD *pRecord)
+{
+	ARCHIVE_OUTPUT *pOutput = (ARCHIVE_OUTPUT *)pArg;
+	const ASN_TYPE *pType = AsnType_FindMessage(pRecord->messageId);
+	unsigned long long start;
+	MessageFrame frame;
+	void *pValue = HAE_NULL;
+	char stamp[32];
+	struct tm tm;
+	time_t sec;
+	int status = RTERR_NOTSUPP;
+
+	start = sNow();
+	rtxMemReset(&pOutput->ctxt);
+	pu_setBuffer(&pOutput->ctxt, (OSOCTET *)pRecord->pFrame, pRecord->len, FALSE);
+	if ((HAE_NULL != pType) && (0 == (status = asn1PD_MessageFrame(&pOutput->ctxt, &frame))))
+	{
+		pValue = rtxMemAllocZ(&pOutput->ctxt, pType->size);
+		pu_setBuffer(&pOutput->ctxt, (OSOCTET *)frame.value.data, frame.value.numocts, FALSE);
+		status = (HAE_NULL != pValue) ? pType->pfPerDec(&pOutput->ctxt, pValue) : RTERR_NOMEM;
+	}
+	pOutput->decodeNs += sNow() - start;
+	pOutput->decodeCnt++;
+	if (0 != status)
+	{
+		pOutput->errorCnt++;
+	}
+
+	if (pOutput->print)
+	{
+		sec = pRecord->timeNs / 1000000000ULL;
+		localtime_r(&sec, &tm);
+		strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%S", &tm);
+		printf("%s.%06llu %s (%u) %u octets%s\n", stamp, pRecord->timeNs % 1000000000ULL / 1000ULL,
+			(HAE_NULL != pType) ? pType->pName : "unknown", pRecord->messageId, pRecord->len,
+			(0 != status) ? " decode error" : "");
+		if ((0 == status) && (0 != pType->pfPrint))
+		{
+			pType->pfPrint(&pOutput->ctxt, pType->pName, pValue);
+		}
+	}
+
+	return HAE_OK;
+}
+
+static void sPrint(void *pPrntStrmInfo, const char *fmtspec, va_list arglist)
+{
+	vfprintf((FILE *)pPrntStrmInfo, fmtspec, arglist);
+}
+
+static unsigned long long sNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
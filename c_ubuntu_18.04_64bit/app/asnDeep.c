@@ -0,0 +1,827 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "haeCommon.h"
+#include "asnDeep.h"
+
+static int sCompare(const void *pKey, const void *pEntry)
+{
+	return strcmp((const char *)pKey, ((const ASN_DEEP_TYPE *)pEntry)->pName);
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnDeep_Find
+ *
+ * Description	: Look up a type of asn_deep_table by its C name
+ *				  ("SPAT", "MapData"), e.g. AsnType_FindMessage()->pName.
+ *
+ * Returns		: table entry, HAE_NULL if there is no such type
+ *
+ *************************************************************/
+const ASN_DEEP_TYPE *AsnDeep_Find(const char *pName)
+{
+	return (const ASN_DEEP_TYPE *)bsearch(pName, asn_deep_table, asn_deep_cnt, sizeof(ASN_DEEP_TYPE), sCompare);
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnDeep_Size
+ *
+ * Description	: Length of the block AsnDeep_Copy makes of a value.
+ *
+ * Parameter	: pType - type of the value
+ *				  pValue - value
+ *
+ * Returns		: octets
+ *
+ *************************************************************/
+size_t AsnDeep_Size(const ASN_DEEP_TYPE *pType, const void *pValue)
+{
+	return ASN_DEEP_ALIGN(pType->size) + ((HAE_NULL != pType->pfSize) ? pType->pfSize(pValue) : 0);
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnDeep_Copy
+ *
+ * Description	: Copy a value with everything it points to into one
+ *				  block, the value first. The source is only read.
+ *
+ * Parameter	: pType - type of the value
+ *				  pValue - value
+ *				  pBuf - block, 8 octet aligned
+ *				  bufSize - its length, AsnDeep_Size at least
+ *
+ * Returns		: the copy (pBuf), HAE_NULL if the block is too short
+ *
+ *************************************************************/
+void *AsnDeep_Copy(const ASN_DEEP_TYPE *pType, const void *pValue, void *pBuf, size_t bufSize)
+{
+	ASN_DEEP_ARENA arena;
+	void *pCopy;
+
+	if (bufSize < AsnDeep_Size(pType, pValue))
+	{
+		return HAE_NULL;
+	}
+	arena.pNext = (unsigned char *)pBuf;
+	arena.pEnd = (unsigned char *)pBuf + bufSize;
+
+	pCopy = AsnDeep_Alloc(&arena, pType->size);
+	memcpy(pCopy, pValue, pType->size);
+	if (HAE_NULL != pType->pfCopy)
+	{
+		pType->pfCopy(&arena, pCopy, pValue);
+	}
+	return pCopy;
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnDeep_CopyCtxt
+ *
+ * Description	: AsnDeep_Copy into one block of the memory heap of
+ *				  a context, e.g. a cache context that outlives the
+ *				  decode context; rtxMemFreePtr frees the copy.
+ *
+ * Parameter	: pType - type of the value
+ *				  pctxt - context taking the copy
+ *				  pValue - value
+ *
+ * Returns		: the copy, HAE_NULL if out of memory
+ *
+ *************************************************************/
+void *AsnDeep_CopyCtxt(const ASN_DEEP_TYPE *pType, OSCTXT *pctxt, const void *pValue)
+{
+	size_t size = AsnDeep_Size(pType, pValue);
+	void *pBuf;
+
+	if (HAE_NULL == (pBuf = rtxMemAlloc(pctxt, size)))
+	{
+		return HAE_NULL;
+	}
+	return AsnDeep_Copy(pType, pValue, pBuf, size);
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnDeep_Compare
+ *
+ * Description	: Field-wise compare of two values, stops at the
+ *				  first difference.
+ *
+ * Returns		: 0 if they are the same, 1 otherwise
+ *
+ *************************************************************/
+int AsnDeep_Compare(const ASN_DEEP_TYPE *pType, const void *pA, const void *pB)
+{
+	return pType->pfCmp(HAE_NULL, pA, pB);
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnDeep_Diff
+ *
+ * Description	: Field-wise compare of two values, every field that
+ *				  differs is reported by its path. A list or string
+ *				  of different length is reported as a whole, a
+ *				  CHOICE of different alternatives by its "t".
+ *
+ * Parameter	: pType - type of the values
+ *				  pA, pB - values
+ *				  pfDiff - called per difference, may be HAE_NULL
+ *				  pArg - passed to pfDiff
+ *
+ * Returns		: number of differences
+ *
+ *************************************************************/
+unsigned int AsnDeep_Diff(const ASN_DEEP_TYPE *pType, const void *pA, const void *pB, ASN_DEEP_DIFF_FUNC pfDiff,
+	void *pArg)
+{
+	ASN_DEEP_DIFF diff;
+
+	diff.pfDiff = pfDiff;
+	diff.pArg = pArg;
+	diff.diffCnt = 0;
+	diff.len = 0;
+	diff.path[0] = '\0';
+	pType->pfCmp(&diff, pA, pB);
+
+	return diff.diffCnt;
+}
+
+/* the helpers below are called by asnDeepTable.c, sizes are the ASN_DEEP_ALIGNed
+   lengths AsnDeep_Alloc takes off the arena, so AsnDeep_Size is exact */
+
+void *AsnDeep_Alloc(ASN_DEEP_ARENA *pArena, size_t size)
+{
+	unsigned char *p = pArena->pNext;
+
+	pArena->pNext += ASN_DEEP_ALIGN(size);
+	return p;
+}
+
+size_t AsnDeep_SizeStr(const char *pStr)
+{
+	return (HAE_NULL != pStr) ? ASN_DEEP_ALIGN(strlen(pStr) + 1) : 0;
+}
+
+const char *AsnDeep_CopyStr(ASN_DEEP_ARENA *pArena, const char *pStr)
+{
+	size_t len;
+	char *p;
+
+	if (HAE_NULL == pStr)
+	{
+		return HAE_NULL;
+	}
+	len = strlen(pStr) + 1;
+	p = (char *)AsnDeep_Alloc(pArena, len);
+	memcpy(p, pStr, len);
+
+	return p;
+}
+
+int AsnDeep_CmpStr(const char *pA, const char *pB)
+{
+	if ((HAE_NULL == pA) || (HAE_NULL == pB))
+	{
+		return (pA != pB) ? 1 : 0;
+	}
+	return (0 != strcmp(pA, pB)) ? 1 : 0;
+}
+
+size_t AsnDeep_SizeOpen(const void *pValue)
+{
+	const ASN1OpenType *pOpen = (const ASN1OpenType *)pValue;
+
+	return ((HAE_NULL != pOpen->data) && (pOpen->numocts > 0)) ? ASN_DEEP_ALIGN(pOpen->numocts) : 0;
+}
+
+void AsnDeep_CopyOpen(ASN_DEEP_ARENA *pArena, void *pDst, const void *pSrc)
+{
+	const ASN1OpenType *pSrcOpen = (const ASN1OpenType *)pSrc;
+	ASN1OpenType *pDstOpen = (ASN1OpenType *)pDst;
+	OSOCTET *p;
+
+	if ((HAE_NULL == pSrcOpen->data) || (0 == pSrcOpen->numocts))
+	{
+		pDstOpen->data = HAE_NULL;
+		return;
+	}
+	p = (OSOCTET *)AsnDeep_Alloc(pArena, pSrcOpen->numocts);
+	memcpy(p, pSrcOpen->data, pSrcOpen->numocts);
+	pDstOpen->data = p;
+}
+
+int AsnDeep_CmpOpen(ASN_DEEP_DIFF *pDiff, const void *pA, const void *pB)
+{
+	const ASN1OpenType *pOpenA = (const ASN1OpenType *)pA;
+	const ASN1OpenType *pOpenB = (const ASN1OpenType *)pB;
+
+	if ((pOpenA->numocts != pOpenB->numocts) ||
+		((pOpenA->numocts > 0) && (0 != memcmp(pOpenA->data, pOpenB->data, pOpenA->numocts))))
+	{
+		AsnDeep_Report(pDiff, HAE_NULL);
+		return 1;
+	}
+	return 0;
+}
+
+/* BIT STRING with extdata: the bits past the fixed data are in extdata */
+size_t AsnDeep_SizeBits(OSUINT32 numbits, size_t dataSize, const OSOCTET *pExt)
+{
+	return ((HAE_NULL != pExt) && (numbits > 8 * dataSize)) ? ASN_DEEP_ALIGN((numbits + 7) / 8 - dataSize) : 0;
+}
+
+OSOCTET *AsnDeep_CopyBits(ASN_DEEP_ARENA *pArena, OSUINT32 numbits, size_t dataSize, const OSOCTET *pExt)
+{
+	size_t len;
+	OSOCTET *p;
+
+	if ((HAE_NULL == pExt) || (numbits <= 8 * dataSize))
+	{
+		return HAE_NULL;
+	}
+	len = (numbits + 7) / 8 - dataSize;
+	p = (OSOCTET *)AsnDeep_Alloc(pArena, len);
+	memcpy(p, pExt, len);
+
+	return p;
+}
+
+/* bit i of a BIT STRING, 0 past what is there */
+static unsigned int sBit(const OSOCTET *pData, const OSOCTET *pExt, size_t dataSize, OSUINT32 i)
+{
+	if (i < 8 * dataSize)
+	{
+		return (pData[i / 8] >> (7 - (i % 8))) & 1;
+	}
+	i -= (OSUINT32)(8 * dataSize);
+	return (HAE_NULL != pExt) ? ((pExt[i / 8] >> (7 - (i % 8))) & 1) : 0;
+}
+
+int AsnDeep_CmpBits(ASN_DEEP_DIFF *pDiff, OSUINT32 numbitsA, const OSOCTET *pDataA, const OSOCTET *pExtA,
+	OSUINT32 numbitsB, const OSOCTET *pDataB, const OSOCTET *pExtB, size_t dataSize)
+{
+	OSUINT32 i, full;
+
+	if (numbitsA != numbitsB)
+	{
+		AsnDeep_Report(pDiff, HAE_NULL);
+		return 1;
+	}
+	/* whole octets of the fixed part at once, the bits after one by one */
+	full = (numbitsA < 8 * dataSize) ? numbitsA / 8 : (OSUINT32)dataSize;
+	if (0 != memcmp(pDataA, pDataB, full))
+	{
+		AsnDeep_Report(pDiff, HAE_NULL);
+		return 1;
+	}
+	for (i = 8 * full; i < numbitsA; i++)
+	{
+		if (sBit(pDataA, pExtA, dataSize, i) != sBit(pDataB, pExtB, dataSize, i))
+		{
+			AsnDeep_Report(pDiff, HAE_NULL);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int AsnDeep_CmpOctets(ASN_DEEP_DIFF *pDiff, OSUINT32 numoctsA, const OSOCTET *pDataA, OSUINT32 numoctsB,
+	const OSOCTET *pDataB, size_t dataSize)
+{
+	if ((numoctsA != numoctsB) || (0 != memcmp(pDataA, pDataB, (numoctsA < dataSize) ? numoctsA : dataSize)))
+	{
+		AsnDeep_Report(pDiff, HAE_NULL);
+		return 1;
+	}
+	return 0;
+}
+
+/* CHOICE alternatives held by pointer */
+size_t AsnDeep_SizePtr(const void *pValue, size_t size, ASN_DEEP_SIZE_FUNC pfSize)
+{
+	if (HAE_NULL == pValue)
+	{
+		return 0;
+	}
+	return ASN_DEEP_ALIGN(size) + ((HAE_NULL != pfSize) ? pfSize(pValue) : 0);
+}
+
+void *AsnDeep_CopyPtr(ASN_DEEP_ARENA *pArena, const void *pValue, size_t size, ASN_DEEP_COPY_FUNC pfCopy)
+{
+	void *p;
+
+	if (HAE_NULL == pValue)
+	{
+		return HAE_NULL;
+	}
+	p = AsnDeep_Alloc(pArena, size);
+	memcpy(p, pValue, size);
+	if (HAE_NULL != pfCopy)
+	{
+		pfCopy(pArena, p, pValue);
+	}
+	return p;
+}
+
+int AsnDeep_CmpPtr(ASN_DEEP_DIFF *pDiff, const void *pA, const void *pB, size_t size, ASN_DEEP_CMP_FUNC pfCmp)
+{
+	if ((HAE_NULL == pA) || (HAE_NULL == pB))
+	{
+		if (pA == pB)
+		{
+			return 0;
+		}
+		AsnDeep_Report(pDiff, HAE_NULL);
+		return 1;
+	}
+	if (HAE_NULL != pfCmp)
+	{
+		return pfCmp(pDiff, pA, pB);
+	}
+	if (0 != memcmp(pA, pB, size))
+	{
+		AsnDeep_Report(pDiff, HAE_NULL);
+		return 1;
+	}
+	return 0;
+}
+
+/* elements of a list, walked like the generated code walks them */
+static OSSIZE sListCnt(const OSRTDList *pList)
+{
+	const OSRTDListNode *pNode;
+	OSSIZE n = 0;
+
+	for (pNode = pList->head; (HAE_NULL != pNode) && (n < pList->count); pNode = pNode->next)
+	{
+		n++;
+	}
+	return n;
+}
+
+size_t AsnDeep_SizeList(const OSRTDList *pList, size_t elemSize, ASN_DEEP_SIZE_FUNC pfSize)
+{
+	const OSRTDListNode *pNode;
+	OSSIZE i, n = sListCnt(pList);
+	size_t size;
+
+	if (0 == n)
+	{
+		return 0;
+	}
+	size = ASN_DEEP_ALIGN(n * sizeof(OSRTDListNode)) + ASN_DEEP_ALIGN(n * elemSize);
+	if (HAE_NULL != pfSize)
+	{
+		for (pNode = pList->head, i = 0; i < n; pNode = pNode->next, i++)
+		{
+			size += (HAE_NULL != pNode->data) ? pfSize(pNode->data) : 0;
+		}
+	}
+	return size;
+}
+
+/* the nodes in one array, the elements in the next */
+void AsnDeep_CopyList(ASN_DEEP_ARENA *pArena, OSRTDList *pDst, const OSRTDList *pSrc, size_t elemSize,
+	ASN_DEEP_COPY_FUNC pfCopy)
+{
+	const OSRTDListNode *pNode;
+	OSRTDListNode *pNodes;
+	unsigned char *pElems;
+	OSSIZE i, n = sListCnt(pSrc);
+
+	rtxDListInit(pDst);
+	if (0 == n)
+	{
+		return;
+	}
+	pNodes = (OSRTDListNode *)AsnDeep_Alloc(pArena, n * sizeof(OSRTDListNode));
+	pElems = (unsigned char *)AsnDeep_Alloc(pArena, n * elemSize);
+	for (pNode = pSrc->head, i = 0; i < n; pNode = pNode->next, i++)
+	{
+		/* extensions the decoder skipped are nodes without data (extElem1) */
+		if (HAE_NULL == pNode->data)
+		{
+			memset(&pElems[i * elemSize], 0, elemSize);
+		}
+		else
+		{
+			memcpy(&pElems[i * elemSize], pNode->data, elemSize);
+		}
+		pNodes[i].data = &pElems[i * elemSize];
+		pNodes[i].prev = (i > 0) ? &pNodes[i - 1] : HAE_NULL;
+		pNodes[i].next = (i + 1 < n) ? &pNodes[i + 1] : HAE_NULL;
+	}
+	pDst->count = n;
+	pDst->head = &pNodes[0];
+	pDst->tail = &pNodes[n - 1];
+
+	if (HAE_NULL != pfCopy)
+	{
+		for (pNode = pSrc->head, i = 0; i < n; pNode = pNode->next, i++)
+		{
+			if (HAE_NULL != pNode->data)
+			{
+				pfCopy(pArena, &pElems[i * elemSize], pNode->data);
+			}
+		}
+	}
+}
+
+int AsnDeep_CmpList(ASN_DEEP_DIFF *pDiff, const OSRTDList *pA, const OSRTDList *pB, size_t elemSize,
+	ASN_DEEP_CMP_FUNC pfCmp)
+{
+	const OSRTDListNode *pNodeA, *pNodeB;
+	OSSIZE i, n = sListCnt(pA);
+	char index[24];
+	size_t mark;
+	int ret = 0;
+
+	if (n != sListCnt(pB))
+	{
+		AsnDeep_Report(pDiff, HAE_NULL);
+		return 1;
+	}
+	for (pNodeA = pA->head, pNodeB = pB->head, i = 0; i < n; pNodeA = pNodeA->next, pNodeB = pNodeB->next, i++)
+	{
+		if ((HAE_NULL == pNodeA->data) || (HAE_NULL == pNodeB->data))
+		{
+			if (pNodeA->data != pNodeB->data)
+			{
+				if (HAE_NULL != pDiff)
+				{
+					snprintf(index, sizeof(index), "[%lu]", (unsigned long)i);
+				}
+				AsnDeep_Report(pDiff, index);
+				ret = 1;
+			}
+		}
+		else if (HAE_NULL != pfCmp)
+		{
+			if (HAE_NULL != pDiff)
+			{
+				snprintf(index, sizeof(index), "[%lu]", (unsigned long)i);
+			}
+			mark = AsnDeep_Push(pDiff, index);
+			if (0 != pfCmp(pDiff, pNodeA->data, pNodeB->data))
+			{
+				ret = 1;
+			}
+			AsnDeep_Pop(pDiff, mark);
+		}
+		else if (0 != memcmp(pNodeA->data, pNodeB->data, elemSize))
+		{
+			if (HAE_NULL != pDiff)
+			{
+				snprintf(index, sizeof(index), "[%lu]", (unsigned long)i);
+			}
+			AsnDeep_Report(pDiff, index);
+			ret = 1;
+		}
+		if ((0 != ret) && (HAE_NULL == pDiff))
+		{
+			return 1;
+		}
+	}
+	return ret;
+}
+
+/* SEQUENCE OF in a fixed array: n, elem[max] */
+size_t AsnDeep_SizeArray(const void *pElem, OSSIZE n, size_t max, size_t elemSize, ASN_DEEP_SIZE_FUNC pfSize)
+{
+	size_t size = 0;
+	OSSIZE i;
+
+	for (i = 0; (i < n) && (i < max) && (HAE_NULL != pfSize); i++)
+	{
+		size += pfSize((const unsigned char *)pElem + i * elemSize);
+	}
+	return size;
+}
+
+void AsnDeep_CopyArray(ASN_DEEP_ARENA *pArena, void *pDst, const void *pSrc, OSSIZE n, size_t max, size_t elemSize,
+	ASN_DEEP_COPY_FUNC pfCopy)
+{
+	OSSIZE i;
+
+	for (i = 0; (i < n) && (i < max) && (HAE_NULL != pfCopy); i++)
+	{
+		pfCopy(pArena, (unsigned char *)pDst + i * elemSize, (const unsigned char *)pSrc + i * elemSize);
+	}
+}
+
+int AsnDeep_CmpArray(ASN_DEEP_DIFF *pDiff, const void *pA, OSSIZE nA, const void *pB, OSSIZE nB, size_t max,
+	size_t elemSize, ASN_DEEP_CMP_FUNC pfCmp)
+{
+	OSSIZE i, n = (nA < max) ? nA : max;
+	char index[24];
+	size_t mark;
+	int ret = 0;
+
+	if (nA != nB)
+	{
+		AsnDeep_Report(pDiff, HAE_NULL);
+		return 1;
+	}
+	if (HAE_NULL == pfCmp)
+	{
+		if (0 != memcmp(pA, pB, n * elemSize))
+		{
+			AsnDeep_Report(pDiff, HAE_NULL);
+			return 1;
+		}
+		return 0;
+	}
+	for (i = 0; i < n; i++)
+	{
+		if (HAE_NULL != pDiff)
+		{
+			snprintf(index, sizeof(index), "[%lu]", (unsigned long)i);
+		}
+		mark = AsnDeep_Push(pDiff, index);
+		if (0 != pfCmp(pDiff, (const unsigned char *)pA + i * elemSize, (const unsigned char *)pB + i * elemSize))
+		{
+			ret = 1;
+			if (HAE_NULL == pDiff)
+			{
+				return 1;
+			}
+		}
+		AsnDeep_Pop(pDiff, mark);
+	}
+	return ret;
+}
+
+/* path of the field being compared, only kept for a diff */
+size_t AsnDeep_Push(ASN_DEEP_DIFF *pDiff, const char *pName)
+{
+	size_t mark, len;
+
+	if (HAE_NULL == pDiff)
+	{
+		return 0;
+	}
+	mark = pDiff->len;
+	len = strlen(pName);
+	if ((0 != mark) && ('[' != pName[0]) && (pDiff->len + 1 < sizeof(pDiff->path)))
+	{
+		pDiff->path[pDiff->len++] = '.';
+	}
+	if (pDiff->len + len >= sizeof(pDiff->path))
+	{
+		len = sizeof(pDiff->path) - 1 - pDiff->len;
+	}
+	memcpy(&pDiff->path[pDiff->len], pName, len);
+	pDiff->len += len;
+	pDiff->path[pDiff->len] = '\0';
+
+	return mark;
+}
+
+void AsnDeep_Pop(ASN_DEEP_DIFF *pDiff, size_t mark)
+{
+	if (HAE_NULL != pDiff)
+	{
+		pDiff->len = mark;
+		pDiff->path[mark] = '\0';
+	}
+}
+
+/* pName HAE_NULL: the field the path leads to */
+void AsnDeep_Report(ASN_DEEP_DIFF *pDiff, const char *pName)
+{
+	size_t mark;
+
+	if (HAE_NULL == pDiff)
+	{
+		return;
+	}
+	pDiff->diffCnt++;
+	if (HAE_NULL == pDiff->pfDiff)
+	{
+		return;
+	}
+	mark = (HAE_NULL != pName) ? AsnDeep_Push(pDiff, pName) : pDiff->len;
+	pDiff->pfDiff(pDiff->pArg, pDiff->path);
+	AsnDeep_Pop(pDiff, mark);
+}
+
+/* pointers of a flat block (asnFlat.c): the walk goes through a value in
+   the order AsnDeep_Copy allocated it, so the object a pointer leads to
+   must be at the next offset of the arena (sClaim) and pointers back or
+   into an object claimed (prev, tail, list elements) have one value only
+   (sRef). A block that checks is laid out as AsnFlat_Write lays it out:
+   no object overlaps another, none is reached twice, the walk is no
+   longer than the block. */
+
+/* object of size octets at pReloc->pos, the arena moves past it */
+static unsigned char *sClaim(ASN_DEEP_RELOC *pReloc, void *pSlot, size_t size)
+{
+	unsigned char *p;
+	size_t off;
+
+	memcpy(&p, pSlot, sizeof(p));
+	if ((HAE_NULL == p) || (0 != pReloc->error))
+	{
+		return HAE_NULL;
+	}
+	if (ASN_DEEP_RELOC_TO_OFFSET == pReloc->mode)
+	{
+		off = (size_t)(p - pReloc->pBase);
+		memcpy(pSlot, &off, sizeof(off));
+		return p;
+	}
+
+	off = (size_t)p;
+	if ((off != pReloc->pos) || (0 == size) || (ASN_DEEP_ALIGN(size) > pReloc->len - off))
+	{
+		pReloc->error = 1;
+		return HAE_NULL;
+	}
+	pReloc->pos += ASN_DEEP_ALIGN(size);
+	p = pReloc->pBase + off;
+	if (ASN_DEEP_RELOC_TO_PTR == pReloc->mode)
+	{
+		memcpy(pSlot, &p, sizeof(p));
+	}
+	return p;
+}
+
+/* a pointer that can only be pExpect, HAE_NULL included */
+static void sRef(ASN_DEEP_RELOC *pReloc, void *pSlot, const void *pExpect)
+{
+	unsigned char *p;
+	size_t off;
+
+	memcpy(&p, pSlot, sizeof(p));
+	if (ASN_DEEP_RELOC_TO_OFFSET == pReloc->mode)
+	{
+		off = (HAE_NULL != p) ? (size_t)(p - pReloc->pBase) : 0;
+		memcpy(pSlot, &off, sizeof(off));
+		return;
+	}
+	off = (HAE_NULL != pExpect) ? (size_t)((const unsigned char *)pExpect - pReloc->pBase) : 0;
+	if ((size_t)p != off)
+	{
+		pReloc->error = 1;
+	}
+	else if (ASN_DEEP_RELOC_TO_PTR == pReloc->mode)
+	{
+		memcpy(pSlot, &pExpect, sizeof(pExpect));
+	}
+}
+
+/* the checks also refuse HAE_NULL where the encoders would follow it: the
+   chosen CHOICE alternative, a string, open type octets */
+static void sNotNull(ASN_DEEP_RELOC *pReloc, const void *p)
+{
+	if ((HAE_NULL == p) && (ASN_DEEP_RELOC_TO_OFFSET != pReloc->mode))
+	{
+		pReloc->error = 1;
+	}
+}
+
+void AsnDeep_RelocObj(ASN_DEEP_RELOC *pReloc, void *pSlot, size_t size, ASN_DEEP_RELOC_FUNC pfReloc)
+{
+	void *p = sClaim(pReloc, pSlot, size);
+
+	sNotNull(pReloc, p);
+	if ((HAE_NULL != p) && (HAE_NULL != pfReloc))
+	{
+		pfReloc(pReloc, p);
+	}
+}
+
+/* the terminating 0 must be in the block, the length is found first */
+void AsnDeep_RelocStr(ASN_DEEP_RELOC *pReloc, void *pSlot)
+{
+	const unsigned char *pEnd = HAE_NULL;
+	size_t off;
+
+	if (ASN_DEEP_RELOC_TO_OFFSET == pReloc->mode)
+	{
+		sClaim(pReloc, pSlot, 1);
+		return;
+	}
+	memcpy(&off, pSlot, sizeof(off));
+	if ((off == pReloc->pos) && (off < pReloc->len))
+	{
+		pEnd = (const unsigned char *)memchr(pReloc->pBase + off, '\0', pReloc->len - off);
+	}
+	if (HAE_NULL == pEnd)
+	{
+		pReloc->error = 1;
+		return;
+	}
+	sClaim(pReloc, pSlot, (size_t)(pEnd - (pReloc->pBase + off)) + 1);
+}
+
+void AsnDeep_RelocOpen(ASN_DEEP_RELOC *pReloc, void *pValue)
+{
+	ASN1OpenType *pOpen = (ASN1OpenType *)pValue;
+
+	if (0 == pOpen->numocts)
+	{
+		sRef(pReloc, &pOpen->data, HAE_NULL);
+		return;
+	}
+	sNotNull(pReloc, sClaim(pReloc, &pOpen->data, pOpen->numocts));
+}
+
+/* pSlot HAE_NULL: no extdata, the bits must fit into data */
+void AsnDeep_RelocBits(ASN_DEEP_RELOC *pReloc, void *pSlot, OSUINT32 numbits, size_t dataSize)
+{
+	size_t len = ((size_t)numbits > 8 * dataSize) ? ((size_t)numbits + 7) / 8 - dataSize : 0;
+
+	if (0 == len)
+	{
+		if (HAE_NULL != pSlot)
+		{
+			sRef(pReloc, pSlot, HAE_NULL);
+		}
+		return;
+	}
+	sNotNull(pReloc, (HAE_NULL != pSlot) ? sClaim(pReloc, pSlot, len) : HAE_NULL);
+}
+
+/* a value no decoder gives, e.g. an unknown CHOICE t */
+void AsnDeep_RelocInvalid(ASN_DEEP_RELOC *pReloc)
+{
+	if (ASN_DEEP_RELOC_TO_OFFSET != pReloc->mode)
+	{
+		pReloc->error = 1;
+	}
+}
+
+void AsnDeep_RelocOctets(ASN_DEEP_RELOC *pReloc, OSUINT32 numocts, size_t dataSize)
+{
+	if ((numocts > dataSize) && (ASN_DEEP_RELOC_TO_OFFSET != pReloc->mode))
+	{
+		pReloc->error = 1;
+	}
+}
+
+/* as AsnDeep_CopyList lays a list out: count nodes in one array, linked
+   in order, the elements in the next */
+void AsnDeep_RelocList(ASN_DEEP_RELOC *pReloc, OSRTDList *pList, size_t elemSize, ASN_DEEP_RELOC_FUNC pfReloc)
+{
+	OSRTDListNode *pNodes;
+	unsigned char *pElems;
+	OSSIZE i, n = pList->count;
+
+	if ((0 == n) || ((ASN_DEEP_RELOC_TO_OFFSET != pReloc->mode) &&
+		(n > (pReloc->len - pReloc->pos) / (sizeof(OSRTDListNode) + elemSize))))
+	{
+		/* no list is longer than the block, nor is it there without nodes */
+		sRef(pReloc, &pList->head, HAE_NULL);
+		sRef(pReloc, &pList->tail, HAE_NULL);
+		pReloc->error = ((0 != n) && (ASN_DEEP_RELOC_TO_OFFSET != pReloc->mode)) ? 1 : pReloc->error;
+		return;
+	}
+	pNodes = (OSRTDListNode *)sClaim(pReloc, &pList->head, n * sizeof(OSRTDListNode));
+	if (HAE_NULL == pNodes)
+	{
+		sNotNull(pReloc, HAE_NULL);
+		return;
+	}
+	sRef(pReloc, &pList->tail, &pNodes[n - 1]);
+	pElems = sClaim(pReloc, &pNodes[0].data, n * elemSize);
+	sNotNull(pReloc, pElems);
+	for (i = 0; (i < n) && (0 == pReloc->error); i++)
+	{
+		sRef(pReloc, &pNodes[i].next, (i + 1 < n) ? &pNodes[i + 1] : HAE_NULL);
+		sRef(pReloc, &pNodes[i].prev, (i > 0) ? &pNodes[i - 1] : HAE_NULL);
+		if (i > 0)
+		{
+			sRef(pReloc, &pNodes[i].data, &pElems[i * elemSize]);
+		}
+	}
+	for (i = 0; (i < n) && (HAE_NULL != pfReloc) && (0 == pReloc->error); i++)
+	{
+		pfReloc(pReloc, &pElems[i * elemSize]);
+	}
+}
+
+void AsnDeep_RelocArray(ASN_DEEP_RELOC *pReloc, void *pElem, OSSIZE n, size_t max, size_t elemSize,
+	ASN_DEEP_RELOC_FUNC pfReloc)
+{
+	OSSIZE i;
+
+	if (n > max)
+	{
+		pReloc->error = (ASN_DEEP_RELOC_TO_OFFSET != pReloc->mode) ? 1 : pReloc->error;
+		n = max;
+	}
+	for (i = 0; (i < n) && (HAE_NULL != pfReloc) && (0 == pReloc->error); i++)
+	{
+		pfReloc(pReloc, (unsigned char *)pElem + i * elemSize);
+	}
+}
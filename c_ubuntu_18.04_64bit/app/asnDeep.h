@@ -0,0 +1,129 @@
+#ifndef ASN_DEEP_H
+#define ASN_DEEP_H
+
+#include <stddef.h>
+#include <rtxsrc/rtxContext.h>
+#include <rtxsrc/rtxDList.h>
+
+/* Deep copy and field-wise compare of decoded DSRC values, so a value
+   can outlive the context it was decoded in and two values can be told
+   apart without encoding them.
+
+   AsnDeep_Copy moves a value with everything it points to (strings,
+   open types, list nodes and elements) into one block: first the value,
+   then the rest in the order it is reached. The elements of each list
+   end up next to each other. The block holds no pointers out of itself,
+   freeing it frees the copy. AsnDeep_Size gives its length up front.
+
+   AsnDeep_Compare stops at the first difference, AsnDeep_Diff reports
+   every differing field by its path ("intersections[0].states[2].
+   signalGroup"). Absent OPTIONAL fields are not compared, unused octets
+   of fixed size strings neither.
+
+   asn_deep_table is generated by genAsnDeepTable.sh from the structures
+   of DSRC.h / ITIS.h and sorted by name. */
+
+#define ASN_DEEP_ALIGN(n)		(((n) + 7) & ~(size_t)7)
+#define ASN_DEEP_PATH_MAX		256
+
+/* copy target of one AsnDeep_Copy */
+typedef struct{
+	unsigned char *pNext;
+	unsigned char *pEnd;
+} ASN_DEEP_ARENA;
+
+/* one difference, pPath is valid during the call */
+typedef void (*ASN_DEEP_DIFF_FUNC)(void *pArg, const char *pPath);
+
+typedef struct{
+	ASN_DEEP_DIFF_FUNC pfDiff;
+	void *pArg;
+	unsigned int diffCnt;
+	size_t len;
+	char path[ASN_DEEP_PATH_MAX];
+} ASN_DEEP_DIFF;
+
+/* the pointers of a value in a flat block (asnFlat.c), ASN_DEEP_RELOC_* */
+#define ASN_DEEP_RELOC_TO_OFFSET	0		/* pointers into the block become offsets */
+#define ASN_DEEP_RELOC_CHECK		1		/* offsets are checked, nothing is written */
+#define ASN_DEEP_RELOC_TO_PTR		2		/* checked offsets become pointers */
+
+typedef struct{
+	int mode;
+	unsigned char *pBase;				/* offset 0, HAE_NULL stays HAE_NULL */
+	size_t pos;							/* offset the next object must be at */
+	size_t len;
+	int error;
+} ASN_DEEP_RELOC;
+
+/* octets pointed to, ASN_DEEP_ALIGNed */
+typedef size_t (*ASN_DEEP_SIZE_FUNC)(const void *pValue);
+/* *pDst holds a shallow copy of *pSrc */
+typedef void (*ASN_DEEP_COPY_FUNC)(ASN_DEEP_ARENA *pArena, void *pDst, const void *pSrc);
+/* 0: same; pDiff HAE_NULL: stop at the first difference */
+typedef int (*ASN_DEEP_CMP_FUNC)(ASN_DEEP_DIFF *pDiff, const void *pA, const void *pB);
+/* every pointer of *pValue and of what it points to, and the lengths of
+   fixed size strings and arrays; errors in pReloc->error */
+typedef void (*ASN_DEEP_RELOC_FUNC)(ASN_DEEP_RELOC *pReloc, void *pValue);
+
+typedef struct{
+	const char *pName;					/* C type name */
+	size_t size;						/* sizeof the C type */
+	ASN_DEEP_SIZE_FUNC pfSize;			/* HAE_NULL: holds no pointers */
+	ASN_DEEP_COPY_FUNC pfCopy;
+	ASN_DEEP_CMP_FUNC pfCmp;
+	ASN_DEEP_RELOC_FUNC pfReloc;		/* HAE_NULL: nothing to relocate or check */
+} ASN_DEEP_TYPE;
+
+extern const ASN_DEEP_TYPE asn_deep_table[];	/* asnDeepTable.c */
+extern const unsigned int asn_deep_cnt;
+
+const ASN_DEEP_TYPE *AsnDeep_Find(const char *pName);
+size_t AsnDeep_Size(const ASN_DEEP_TYPE *pType, const void *pValue);
+void *AsnDeep_Copy(const ASN_DEEP_TYPE *pType, const void *pValue, void *pBuf, size_t bufSize);
+void *AsnDeep_CopyCtxt(const ASN_DEEP_TYPE *pType, OSCTXT *pctxt, const void *pValue);
+int AsnDeep_Compare(const ASN_DEEP_TYPE *pType, const void *pA, const void *pB);
+unsigned int AsnDeep_Diff(const ASN_DEEP_TYPE *pType, const void *pA, const void *pB, ASN_DEEP_DIFF_FUNC pfDiff,
+	void *pArg);
+
+/* used by asnDeepTable.c */
+void *AsnDeep_Alloc(ASN_DEEP_ARENA *pArena, size_t size);
+size_t AsnDeep_SizeStr(const char *pStr);
+const char *AsnDeep_CopyStr(ASN_DEEP_ARENA *pArena, const char *pStr);
+int AsnDeep_CmpStr(const char *pA, const char *pB);
+size_t AsnDeep_SizeOpen(const void *pValue);
+void AsnDeep_CopyOpen(ASN_DEEP_ARENA *pArena, void *pDst, const void *pSrc);
+int AsnDeep_CmpOpen(ASN_DEEP_DIFF *pDiff, const void *pA, const void *pB);
+size_t AsnDeep_SizeBits(OSUINT32 numbits, size_t dataSize, const OSOCTET *pExt);
+OSOCTET *AsnDeep_CopyBits(ASN_DEEP_ARENA *pArena, OSUINT32 numbits, size_t dataSize, const OSOCTET *pExt);
+int AsnDeep_CmpBits(ASN_DEEP_DIFF *pDiff, OSUINT32 numbitsA, const OSOCTET *pDataA, const OSOCTET *pExtA,
+	OSUINT32 numbitsB, const OSOCTET *pDataB, const OSOCTET *pExtB, size_t dataSize);
+int AsnDeep_CmpOctets(ASN_DEEP_DIFF *pDiff, OSUINT32 numoctsA, const OSOCTET *pDataA, OSUINT32 numoctsB,
+	const OSOCTET *pDataB, size_t dataSize);
+size_t AsnDeep_SizePtr(const void *pValue, size_t size, ASN_DEEP_SIZE_FUNC pfSize);
+void *AsnDeep_CopyPtr(ASN_DEEP_ARENA *pArena, const void *pValue, size_t size, ASN_DEEP_COPY_FUNC pfCopy);
+int AsnDeep_CmpPtr(ASN_DEEP_DIFF *pDiff, const void *pA, const void *pB, size_t size, ASN_DEEP_CMP_FUNC pfCmp);
+size_t AsnDeep_SizeList(const OSRTDList *pList, size_t elemSize, ASN_DEEP_SIZE_FUNC pfSize);
+void AsnDeep_CopyList(ASN_DEEP_ARENA *pArena, OSRTDList *pDst, const OSRTDList *pSrc, size_t elemSize,
+	ASN_DEEP_COPY_FUNC pfCopy);
+int AsnDeep_CmpList(ASN_DEEP_DIFF *pDiff, const OSRTDList *pA, const OSRTDList *pB, size_t elemSize,
+	ASN_DEEP_CMP_FUNC pfCmp);
+size_t AsnDeep_SizeArray(const void *pElem, OSSIZE n, size_t max, size_t elemSize, ASN_DEEP_SIZE_FUNC pfSize);
+void AsnDeep_CopyArray(ASN_DEEP_ARENA *pArena, void *pDst, const void *pSrc, OSSIZE n, size_t max, size_t elemSize,
+	ASN_DEEP_COPY_FUNC pfCopy);
+int AsnDeep_CmpArray(ASN_DEEP_DIFF *pDiff, const void *pA, OSSIZE nA, const void *pB, OSSIZE nB, size_t max,
+	size_t elemSize, ASN_DEEP_CMP_FUNC pfCmp);
+size_t AsnDeep_Push(ASN_DEEP_DIFF *pDiff, const char *pName);
+void AsnDeep_Pop(ASN_DEEP_DIFF *pDiff, size_t mark);
+void AsnDeep_Report(ASN_DEEP_DIFF *pDiff, const char *pName);
+void AsnDeep_RelocObj(ASN_DEEP_RELOC *pReloc, void *pSlot, size_t size, ASN_DEEP_RELOC_FUNC pfReloc);
+void AsnDeep_RelocStr(ASN_DEEP_RELOC *pReloc, void *pSlot);
+void AsnDeep_RelocOpen(ASN_DEEP_RELOC *pReloc, void *pValue);
+void AsnDeep_RelocBits(ASN_DEEP_RELOC *pReloc, void *pSlot, OSUINT32 numbits, size_t dataSize);
+void AsnDeep_RelocInvalid(ASN_DEEP_RELOC *pReloc);
+void AsnDeep_RelocOctets(ASN_DEEP_RELOC *pReloc, OSUINT32 numocts, size_t dataSize);
+void AsnDeep_RelocList(ASN_DEEP_RELOC *pReloc, OSRTDList *pList, size_t elemSize, ASN_DEEP_RELOC_FUNC pfReloc);
+void AsnDeep_RelocArray(ASN_DEEP_RELOC *pReloc, void *pElem, OSSIZE n, size_t max, size_t elemSize,
+	ASN_DEEP_RELOC_FUNC pfReloc);
+
+#endif
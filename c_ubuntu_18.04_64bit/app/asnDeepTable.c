@@ -0,0 +1,13301 @@
+/* Generated by genAsnDeepTable.sh, do not edit */
+
+#include <DSRC.h>
+#include <ITIS.h>
+#include <string.h>
+
+#include "haeCommon.h"
+#include "asnDeep.h"
+
+/* a field that differs: the compare stops there, the diff reports it and goes on */
+#define ASN_DEEP_DIFFER(name) \
+	{ ret = 1; if (HAE_NULL == pDiff) { return 1; } AsnDeep_Report(pDiff, name); }
+/* a field compared by a function of its own, under its name in the path */
+#define ASN_DEEP_INTO(name, cmp) \
+	{ size_t mark = AsnDeep_Push(pDiff, name); \
+	  if (0 != (cmp)) { ret = 1; if (HAE_NULL == pDiff) { return 1; } } \
+	  AsnDeep_Pop(pDiff, mark); }
+
+static void sReloc_AllowedManeuvers(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_AllowedManeuvers(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_BrakeAppliedStatus(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_BrakeAppliedStatus(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_CodeWord(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_CodeWord(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_ExteriorLights(const void *pv);
+static void sCopy_ExteriorLights(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_ExteriorLights(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_ExteriorLights(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_FurtherInfoID(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_FurtherInfoID(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_GNSSstatus(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_GNSSstatus(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_HeadingSlice(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_HeadingSlice(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_IntersectionStatusObject(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_IntersectionStatusObject(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_LaneAttributes_Barrier(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_LaneAttributes_Barrier(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_LaneAttributes_Bike(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_LaneAttributes_Bike(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_LaneAttributes_Crosswalk(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_LaneAttributes_Crosswalk(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_LaneAttributes_Parking(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_LaneAttributes_Parking(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_LaneAttributes_Sidewalk(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_LaneAttributes_Sidewalk(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_LaneAttributes_Striping(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_LaneAttributes_Striping(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_LaneAttributes_TrackedVehicle(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_LaneAttributes_TrackedVehicle(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_LaneAttributes_Vehicle(const void *pv);
+static void sCopy_LaneAttributes_Vehicle(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_LaneAttributes_Vehicle(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_LaneAttributes_Vehicle(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_LaneDirection(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_LaneDirection(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_LaneSharing(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_LaneSharing(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_MessageBLOB(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_MessageBLOB(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_MsgCRC(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_MsgCRC(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_NMEA_Payload(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_NMEA_Payload(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_PayloadData(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_PayloadData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_PersonalAssistive(const void *pv);
+static void sCopy_PersonalAssistive(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_PersonalAssistive(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_PersonalAssistive(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_PersonalDeviceUsageState(const void *pv);
+static void sCopy_PersonalDeviceUsageState(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_PersonalDeviceUsageState(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_PersonalDeviceUsageState(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_Priority(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_Priority(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_PrivilegedEventFlags(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_PrivilegedEventFlags(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_PublicSafetyAndRoadWorkerActivity(const void *pv);
+static void sCopy_PublicSafetyAndRoadWorkerActivity(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_PublicSafetyAndRoadWorkerActivity(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_PublicSafetyAndRoadWorkerActivity(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_PublicSafetyDirectingTrafficSubType(const void *pv);
+static void sCopy_PublicSafetyDirectingTrafficSubType(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_PublicSafetyDirectingTrafficSubType(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_PublicSafetyDirectingTrafficSubType(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_RTCMmessage(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RTCMmessage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_SignalReqScheme(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SignalReqScheme(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_TemporaryID(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TemporaryID(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_TransitStatus(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TransitStatus(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_TransitVehicleStatus(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TransitVehicleStatus(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_UniqueMSGID(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_UniqueMSGID(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_UserSizeAndBehaviour(const void *pv);
+static void sCopy_UserSizeAndBehaviour(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_UserSizeAndBehaviour(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_UserSizeAndBehaviour(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_VehicleEventFlags(const void *pv);
+static void sCopy_VehicleEventFlags(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_VehicleEventFlags(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_VehicleEventFlags(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_VerticalAccelerationThreshold(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_VerticalAccelerationThreshold(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_VINstring(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_VINstring(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_MessageFrame(const void *pv);
+static void sCopy_MessageFrame(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_MessageFrame(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_MessageFrame(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_PositionalAccuracy(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_AccelerationSet4Way(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_BrakeSystemStatus(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_BrakeSystemStatus(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_VehicleSize(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_BSMcoreData(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_BSMcoreData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_PartIIcontent(const void *pv);
+static void sCopy_PartIIcontent(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_PartIIcontent(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_PartIIcontent(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_RegionalExtension(const void *pv);
+static void sCopy_RegionalExtension(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_RegionalExtension(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RegionalExtension(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_BasicSafetyMessage(const void *pv);
+static void sCopy_BasicSafetyMessage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_BasicSafetyMessage(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_BasicSafetyMessage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_RequestedItemList(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RequestedItemList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_CommonSafetyRequest(const void *pv);
+static void sCopy_CommonSafetyRequest(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_CommonSafetyRequest(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_CommonSafetyRequest(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_RoadSideAlert_description(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RoadSideAlert_description(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_DDateTime(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_TransmissionAndSpeed(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_PositionConfidenceSet(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_SpeedandHeadingandThrottleConfidence(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_FullPositionVector(const void *pv);
+static void sCopy_FullPositionVector(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_FullPositionVector(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_FullPositionVector(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_RoadSideAlert(const void *pv);
+static void sCopy_RoadSideAlert(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_RoadSideAlert(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RoadSideAlert(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_PrivilegedEvents(const void *pv);
+static void sCopy_PrivilegedEvents(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_PrivilegedEvents(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_PrivilegedEvents(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_EmergencyDetails(const void *pv);
+static void sCopy_EmergencyDetails(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_EmergencyDetails(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_EmergencyDetails(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_EmergencyVehicleAlert(const void *pv);
+static void sCopy_EmergencyVehicleAlert(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_EmergencyVehicleAlert(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_EmergencyVehicleAlert(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_PathHistoryPoint(const void *pv);
+static void sCopy_PathHistoryPoint(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_PathHistoryPoint(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_PathHistoryPoint(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_PathHistory(const void *pv);
+static void sCopy_PathHistory(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_PathHistory(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_PathHistory(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_PathPrediction(const void *pv);
+static void sCopy_PathPrediction(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_PathPrediction(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_PathPrediction(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_IntersectionReferenceID(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_ApproachOrLane(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_IntersectionCollision(const void *pv);
+static void sCopy_IntersectionCollision(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_IntersectionCollision(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_IntersectionCollision(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_Position3D(const void *pv);
+static void sCopy_Position3D(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_Position3D(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_Position3D(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_RegulatorySpeedLimit(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_LaneTypeAttributes(const void *pv);
+static void sCopy_LaneTypeAttributes(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_LaneTypeAttributes(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_LaneTypeAttributes(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_LaneAttributes(const void *pv);
+static void sCopy_LaneAttributes(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_LaneAttributes(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_LaneAttributes(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_Node_XY_20b(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_Node_XY_22b(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_Node_XY_24b(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_Node_XY_26b(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_Node_XY_28b(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_Node_XY_32b(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_Node_LLmD_64b(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_NodeOffsetPointXY(const void *pv);
+static void sCopy_NodeOffsetPointXY(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_NodeOffsetPointXY(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_NodeOffsetPointXY(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_NodeAttributeXYList(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_NodeAttributeXYList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_SegmentAttributeXYList(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SegmentAttributeXYList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_LaneDataAttribute(const void *pv);
+static void sCopy_LaneDataAttribute(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_LaneDataAttribute(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_LaneDataAttribute(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_NodeAttributeSetXY(const void *pv);
+static void sCopy_NodeAttributeSetXY(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_NodeAttributeSetXY(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_NodeAttributeSetXY(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_NodeXY(const void *pv);
+static void sCopy_NodeXY(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_NodeXY(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_NodeXY(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_ComputedLane_offsetXaxis(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_ComputedLane_offsetYaxis(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_ComputedLane(const void *pv);
+static void sCopy_ComputedLane(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_ComputedLane(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_ComputedLane(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_NodeListXY(const void *pv);
+static void sCopy_NodeListXY(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_NodeListXY(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_NodeListXY(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_ConnectingLane(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_ConnectingLane(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_Connection(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_Connection(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_OverlayLaneList(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_OverlayLaneList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_GenericLane(const void *pv);
+static void sCopy_GenericLane(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_GenericLane(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_GenericLane(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_SignalControlZone(const void *pv);
+static void sCopy_SignalControlZone(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_SignalControlZone(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SignalControlZone(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_IntersectionGeometry(const void *pv);
+static void sCopy_IntersectionGeometry(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_IntersectionGeometry(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_IntersectionGeometry(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_RoadSegmentReferenceID(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_RoadSegment(const void *pv);
+static void sCopy_RoadSegment(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_RoadSegment(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RoadSegment(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_DataParameters(const void *pv);
+static void sCopy_DataParameters(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_DataParameters(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_DataParameters(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_RestrictionUserType(const void *pv);
+static void sCopy_RestrictionUserType(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_RestrictionUserType(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RestrictionUserType(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_RestrictionClassAssignment(const void *pv);
+static void sCopy_RestrictionClassAssignment(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_RestrictionClassAssignment(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RestrictionClassAssignment(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_MapData(const void *pv);
+static void sCopy_MapData(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_MapData(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_MapData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_NMEAcorrections(const void *pv);
+static void sCopy_NMEAcorrections(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_NMEAcorrections(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_NMEAcorrections(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_PropelledInformation(const void *pv);
+static void sCopy_PropelledInformation(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_PropelledInformation(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_PropelledInformation(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_PersonalSafetyMessage(const void *pv);
+static void sCopy_PersonalSafetyMessage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_PersonalSafetyMessage(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_PersonalSafetyMessage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_Sample(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_ProbeDataManagement_term(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_SnapshotTime(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_SnapshotDistance(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_ProbeDataManagement_snapshot(const void *pv);
+static void sCopy_ProbeDataManagement_snapshot(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_ProbeDataManagement_snapshot(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_ProbeDataManagement_snapshot(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_VehicleStatusRequest(const void *pv);
+static void sCopy_VehicleStatusRequest(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_VehicleStatusRequest(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_VehicleStatusRequest(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_ProbeDataManagement(const void *pv);
+static void sCopy_ProbeDataManagement(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_ProbeDataManagement(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_ProbeDataManagement(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_VehicleID(const void *pv);
+static void sCopy_VehicleID(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_VehicleID(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_VehicleID(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_VehicleIdent_vehicleClass(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_VehicleIdent(const void *pv);
+static void sCopy_VehicleIdent(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_VehicleIdent(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_VehicleIdent(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_VehicleClassification(const void *pv);
+static void sCopy_VehicleClassification(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_VehicleClassification(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_VehicleClassification(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_VehicleSafetyExtensions(const void *pv);
+static void sCopy_VehicleSafetyExtensions(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_VehicleSafetyExtensions(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_VehicleSafetyExtensions(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_WiperSet(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_VehicleStatus_steering(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_AccelSteerYawRateConfidence(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_ConfidenceSet(const void *pv);
+static void sCopy_ConfidenceSet(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_ConfidenceSet(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_ConfidenceSet(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_VehicleStatus_accelSets(const void *pv);
+static void sCopy_VehicleStatus_accelSets(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_VehicleStatus_accelSets(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_VehicleStatus_accelSets(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_VehicleStatus_object(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_BumperHeights(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_VehicleStatus_vehicleData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TireData(const void *pv);
+static void sCopy_TireData(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TireData(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TireData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_AxleWeightSet(const void *pv);
+static void sCopy_AxleWeightSet(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_AxleWeightSet(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_AxleWeightSet(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_J1939data(const void *pv);
+static void sCopy_J1939data(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_J1939data(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_J1939data(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_VehicleStatus_weatherReport(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_VehicleStatus(const void *pv);
+static void sCopy_VehicleStatus(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_VehicleStatus(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_VehicleStatus(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_Snapshot(const void *pv);
+static void sCopy_Snapshot(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_Snapshot(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_Snapshot(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_ProbeVehicleData(const void *pv);
+static void sCopy_ProbeVehicleData(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_ProbeVehicleData(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_ProbeVehicleData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_AntennaOffsetSet(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_RTCMheader(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RTCMheader(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_RTCMmessageList(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RTCMmessageList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_RTCMcorrections(const void *pv);
+static void sCopy_RTCMcorrections(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_RTCMcorrections(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RTCMcorrections(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_EnabledLaneList(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_EnabledLaneList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_TimeChangeDetails(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_AdvisorySpeed(const void *pv);
+static void sCopy_AdvisorySpeed(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_AdvisorySpeed(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_AdvisorySpeed(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_MovementEvent(const void *pv);
+static void sCopy_MovementEvent(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_MovementEvent(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_MovementEvent(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_ConnectionManeuverAssist(const void *pv);
+static void sCopy_ConnectionManeuverAssist(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_ConnectionManeuverAssist(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_ConnectionManeuverAssist(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_MovementState(const void *pv);
+static void sCopy_MovementState(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_MovementState(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_MovementState(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_IntersectionState(const void *pv);
+static void sCopy_IntersectionState(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_IntersectionState(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_IntersectionState(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_SPAT(const void *pv);
+static void sCopy_SPAT(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_SPAT(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SPAT(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_IntersectionAccessPoint(const void *pv);
+static void sCopy_IntersectionAccessPoint(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_IntersectionAccessPoint(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_IntersectionAccessPoint(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_SignalRequest(const void *pv);
+static void sCopy_SignalRequest(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_SignalRequest(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SignalRequest(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_SignalRequestPackage(const void *pv);
+static void sCopy_SignalRequestPackage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_SignalRequestPackage(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SignalRequestPackage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_RequestorType(const void *pv);
+static void sCopy_RequestorType(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_RequestorType(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RequestorType(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_RequestorPositionVector(const void *pv);
+static void sCopy_RequestorPositionVector(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_RequestorPositionVector(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RequestorPositionVector(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_RequestorDescription(const void *pv);
+static void sCopy_RequestorDescription(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_RequestorDescription(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RequestorDescription(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_SignalRequestMessage(const void *pv);
+static void sCopy_SignalRequestMessage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_SignalRequestMessage(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SignalRequestMessage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_SignalRequesterInfo(const void *pv);
+static void sCopy_SignalRequesterInfo(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_SignalRequesterInfo(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SignalRequesterInfo(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_SignalStatusPackage(const void *pv);
+static void sCopy_SignalStatusPackage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_SignalStatusPackage(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SignalStatusPackage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_SignalStatus(const void *pv);
+static void sCopy_SignalStatus(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_SignalStatus(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SignalStatus(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_SignalStatusMessage(const void *pv);
+static void sCopy_SignalStatusMessage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_SignalStatusMessage(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SignalStatusMessage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_RoadSignID(const void *pv);
+static void sCopy_RoadSignID(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_RoadSignID(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RoadSignID(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TravelerDataFrame_msgId(const void *pv);
+static void sCopy_TravelerDataFrame_msgId(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TravelerDataFrame_msgId(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TravelerDataFrame_msgId(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_Node_LL_24B(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_Node_LL_28B(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_Node_LL_32B(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_Node_LL_36B(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_Node_LL_44B(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_Node_LL_48B(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_NodeOffsetPointLL(const void *pv);
+static void sCopy_NodeOffsetPointLL(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_NodeOffsetPointLL(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_NodeOffsetPointLL(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_NodeAttributeLLList(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_NodeAttributeLLList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_SegmentAttributeLLList(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SegmentAttributeLLList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_NodeAttributeSetLL(const void *pv);
+static void sCopy_NodeAttributeSetLL(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_NodeAttributeSetLL(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_NodeAttributeSetLL(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_NodeLL(const void *pv);
+static void sCopy_NodeLL(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_NodeLL(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_NodeLL(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_NodeListLL(const void *pv);
+static void sCopy_NodeListLL(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_NodeListLL(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_NodeListLL(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_OffsetSystem_offset(const void *pv);
+static void sCopy_OffsetSystem_offset(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_OffsetSystem_offset(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_OffsetSystem_offset(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_OffsetSystem(const void *pv);
+static void sCopy_OffsetSystem(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_OffsetSystem(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_OffsetSystem(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_Circle(const void *pv);
+static void sCopy_Circle(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_Circle(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_Circle(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_GeometricProjection(const void *pv);
+static void sCopy_GeometricProjection(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_GeometricProjection(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_GeometricProjection(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_ShapePointSet(const void *pv);
+static void sCopy_ShapePointSet(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_ShapePointSet(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_ShapePointSet(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_RegionOffsets(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_RegionPointSet(const void *pv);
+static void sCopy_RegionPointSet(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_RegionPointSet(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RegionPointSet(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_ValidRegion_area(const void *pv);
+static void sCopy_ValidRegion_area(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_ValidRegion_area(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_ValidRegion_area(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_ValidRegion(const void *pv);
+static void sCopy_ValidRegion(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_ValidRegion(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_ValidRegion(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_GeographicalPath_description(const void *pv);
+static void sCopy_GeographicalPath_description(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_GeographicalPath_description(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_GeographicalPath_description(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_GeographicalPath(const void *pv);
+static void sCopy_GeographicalPath(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_GeographicalPath(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_GeographicalPath(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_WorkZone_element_item(const void *pv);
+static void sCopy_WorkZone_element_item(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_WorkZone_element_item(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_WorkZone_element_item(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_WorkZone_element(const void *pv);
+static void sCopy_WorkZone_element(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_WorkZone_element(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_WorkZone_element(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_GenericSignage_element_item(const void *pv);
+static void sCopy_GenericSignage_element_item(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_GenericSignage_element_item(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_GenericSignage_element_item(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_GenericSignage_element(const void *pv);
+static void sCopy_GenericSignage_element(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_GenericSignage_element(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_GenericSignage_element(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_SpeedLimit_element_item(const void *pv);
+static void sCopy_SpeedLimit_element_item(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_SpeedLimit_element_item(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SpeedLimit_element_item(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_SpeedLimit_element(const void *pv);
+static void sCopy_SpeedLimit_element(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_SpeedLimit_element(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SpeedLimit_element(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_ExitService_element_item(const void *pv);
+static void sCopy_ExitService_element_item(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_ExitService_element_item(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_ExitService_element_item(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_ExitService_element(const void *pv);
+static void sCopy_ExitService_element(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_ExitService_element(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_ExitService_element(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TravelerDataFrame_content(const void *pv);
+static void sCopy_TravelerDataFrame_content(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TravelerDataFrame_content(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TravelerDataFrame_content(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TravelerDataFrame(const void *pv);
+static void sCopy_TravelerDataFrame(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TravelerDataFrame(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TravelerDataFrame(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TravelerInformation(const void *pv);
+static void sCopy_TravelerInformation(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TravelerInformation(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TravelerInformation(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_Header(const void *pv);
+static void sCopy_Header(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_Header(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_Header(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage00(const void *pv);
+static void sCopy_TestMessage00(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage00(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage00(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage01(const void *pv);
+static void sCopy_TestMessage01(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage01(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage01(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage02(const void *pv);
+static void sCopy_TestMessage02(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage02(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage02(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage03(const void *pv);
+static void sCopy_TestMessage03(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage03(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage03(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage04(const void *pv);
+static void sCopy_TestMessage04(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage04(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage04(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage05(const void *pv);
+static void sCopy_TestMessage05(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage05(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage05(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage06(const void *pv);
+static void sCopy_TestMessage06(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage06(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage06(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage07(const void *pv);
+static void sCopy_TestMessage07(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage07(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage07(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage08(const void *pv);
+static void sCopy_TestMessage08(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage08(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage08(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage09(const void *pv);
+static void sCopy_TestMessage09(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage09(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage09(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage10(const void *pv);
+static void sCopy_TestMessage10(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage10(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage10(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage11(const void *pv);
+static void sCopy_TestMessage11(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage11(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage11(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage12(const void *pv);
+static void sCopy_TestMessage12(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage12(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage12(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage13(const void *pv);
+static void sCopy_TestMessage13(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage13(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage13(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage14(const void *pv);
+static void sCopy_TestMessage14(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage14(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage14(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TestMessage15(const void *pv);
+static void sCopy_TestMessage15(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TestMessage15(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TestMessage15(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_DDate(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_DFullTime(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_DMonthDay(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_DTime(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_DYearMonth(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_DisabledVehicle(const void *pv);
+static void sCopy_DisabledVehicle(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_DisabledVehicle(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_DisabledVehicle(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_EventDescription_description(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_EventDescription_description(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_EventDescription(const void *pv);
+static void sCopy_EventDescription(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_EventDescription(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_EventDescription(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_ObstacleDetection(const void *pv);
+static void sCopy_ObstacleDetection(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_ObstacleDetection(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_ObstacleDetection(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_PivotPointDescription(const void *pv);
+static void sCopy_PivotPointDescription(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_PivotPointDescription(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_PivotPointDescription(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_RTCMPackage(const void *pv);
+static void sCopy_RTCMPackage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_RTCMPackage(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_RTCMPackage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TrailerHistoryPoint(const void *pv);
+static void sCopy_TrailerHistoryPoint(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TrailerHistoryPoint(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TrailerHistoryPoint(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TrailerUnitDescription(const void *pv);
+static void sCopy_TrailerUnitDescription(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TrailerUnitDescription(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TrailerUnitDescription(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_TrailerData(const void *pv);
+static void sCopy_TrailerData(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_TrailerData(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_TrailerData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_SpecialVehicleExtensions(const void *pv);
+static void sCopy_SpecialVehicleExtensions(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_SpecialVehicleExtensions(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SpecialVehicleExtensions(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_SpeedProfileMeasurementList(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SpeedProfileMeasurementList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_SpeedProfile(const void *pv);
+static void sCopy_SpeedProfile(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_SpeedProfile(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SpeedProfile(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_VehicleData(const void *pv);
+static void sCopy_VehicleData(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_VehicleData(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_VehicleData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_WeatherReport(const void *pv);
+static void sCopy_WeatherReport(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_WeatherReport(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_WeatherReport(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_WeatherProbe(const void *pv);
+static void sCopy_WeatherProbe(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_WeatherProbe(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_WeatherProbe(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_SupplementalVehicleExtensions(const void *pv);
+static void sCopy_SupplementalVehicleExtensions(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_SupplementalVehicleExtensions(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_SupplementalVehicleExtensions(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_VerticalOffset(const void *pv);
+static void sCopy_VerticalOffset(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static void sReloc_VerticalOffset(ASN_DEEP_RELOC *pReloc, void *pv);
+static int sCmp_VerticalOffset(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_ITIScodesAndText_element_item(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static int sCmp_ITIScodesAndText_element(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static size_t sSize_SpeedLimitList(const void *pv);
+static void sCopy_SpeedLimitList(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static int sCmp_SpeedLimitList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_SpeedLimitList(ASN_DEEP_RELOC *pReloc, void *pv);
+static size_t sSize_LaneDataAttribute_regional(const void *pv);
+static void sCopy_LaneDataAttribute_regional(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static int sCmp_LaneDataAttribute_regional(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_LaneDataAttribute_regional(ASN_DEEP_RELOC *pReloc, void *pv);
+static size_t sSize_NodeSetXY(const void *pv);
+static void sCopy_NodeSetXY(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static int sCmp_NodeSetXY(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_NodeSetXY(ASN_DEEP_RELOC *pReloc, void *pv);
+static size_t sSize_RestrictionUserType_regional(const void *pv);
+static void sCopy_RestrictionUserType_regional(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static int sCmp_RestrictionUserType_regional(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_RestrictionUserType_regional(ASN_DEEP_RELOC *pReloc, void *pv);
+static size_t sSize_NodeSetLL(const void *pv);
+static void sCopy_NodeSetLL(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static int sCmp_NodeSetLL(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_NodeSetLL(ASN_DEEP_RELOC *pReloc, void *pv);
+static size_t sSize_ITIScodesAndText(const void *pv);
+static void sCopy_ITIScodesAndText(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static int sCmp_ITIScodesAndText(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_ITIScodesAndText(ASN_DEEP_RELOC *pReloc, void *pv);
+static size_t sSize_WorkZone(const void *pv);
+static void sCopy_WorkZone(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static int sCmp_WorkZone(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_WorkZone(ASN_DEEP_RELOC *pReloc, void *pv);
+static size_t sSize_GenericSignage(const void *pv);
+static void sCopy_GenericSignage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static int sCmp_GenericSignage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_GenericSignage(ASN_DEEP_RELOC *pReloc, void *pv);
+static size_t sSize_SpeedLimit(const void *pv);
+static void sCopy_SpeedLimit(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static int sCmp_SpeedLimit(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_SpeedLimit(ASN_DEEP_RELOC *pReloc, void *pv);
+static size_t sSize_ExitService(const void *pv);
+static void sCopy_ExitService(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);
+static int sCmp_ExitService(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);
+static void sReloc_ExitService(ASN_DEEP_RELOC *pReloc, void *pv);
+
+static size_t sSize_SpeedLimitList(const void *pv)
+{
+	return AsnDeep_SizeList((const OSRTDList *)pv, sizeof(RegulatorySpeedLimit), HAE_NULL);
+}
+
+static void sCopy_SpeedLimitList(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	AsnDeep_CopyList(pArena, (OSRTDList *)pvDst, (const OSRTDList *)pvSrc, sizeof(RegulatorySpeedLimit), HAE_NULL);
+}
+
+static int sCmp_SpeedLimitList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	return AsnDeep_CmpList(pDiff, (const OSRTDList *)pvA, (const OSRTDList *)pvB, sizeof(RegulatorySpeedLimit), sCmp_RegulatorySpeedLimit);
+}
+
+static void sReloc_SpeedLimitList(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	AsnDeep_RelocList(pReloc, (OSRTDList *)pv, sizeof(RegulatorySpeedLimit), HAE_NULL);
+}
+
+static size_t sSize_LaneDataAttribute_regional(const void *pv)
+{
+	return AsnDeep_SizeList((const OSRTDList *)pv, sizeof(RegionalExtension), sSize_RegionalExtension);
+}
+
+static void sCopy_LaneDataAttribute_regional(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	AsnDeep_CopyList(pArena, (OSRTDList *)pvDst, (const OSRTDList *)pvSrc, sizeof(RegionalExtension), sCopy_RegionalExtension);
+}
+
+static int sCmp_LaneDataAttribute_regional(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	return AsnDeep_CmpList(pDiff, (const OSRTDList *)pvA, (const OSRTDList *)pvB, sizeof(RegionalExtension), sCmp_RegionalExtension);
+}
+
+static void sReloc_LaneDataAttribute_regional(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	AsnDeep_RelocList(pReloc, (OSRTDList *)pv, sizeof(RegionalExtension), sReloc_RegionalExtension);
+}
+
+static size_t sSize_NodeSetXY(const void *pv)
+{
+	return AsnDeep_SizeList((const OSRTDList *)pv, sizeof(NodeXY), sSize_NodeXY);
+}
+
+static void sCopy_NodeSetXY(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	AsnDeep_CopyList(pArena, (OSRTDList *)pvDst, (const OSRTDList *)pvSrc, sizeof(NodeXY), sCopy_NodeXY);
+}
+
+static int sCmp_NodeSetXY(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	return AsnDeep_CmpList(pDiff, (const OSRTDList *)pvA, (const OSRTDList *)pvB, sizeof(NodeXY), sCmp_NodeXY);
+}
+
+static void sReloc_NodeSetXY(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	AsnDeep_RelocList(pReloc, (OSRTDList *)pv, sizeof(NodeXY), sReloc_NodeXY);
+}
+
+static size_t sSize_RestrictionUserType_regional(const void *pv)
+{
+	return AsnDeep_SizeList((const OSRTDList *)pv, sizeof(RegionalExtension), sSize_RegionalExtension);
+}
+
+static void sCopy_RestrictionUserType_regional(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	AsnDeep_CopyList(pArena, (OSRTDList *)pvDst, (const OSRTDList *)pvSrc, sizeof(RegionalExtension), sCopy_RegionalExtension);
+}
+
+static int sCmp_RestrictionUserType_regional(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	return AsnDeep_CmpList(pDiff, (const OSRTDList *)pvA, (const OSRTDList *)pvB, sizeof(RegionalExtension), sCmp_RegionalExtension);
+}
+
+static void sReloc_RestrictionUserType_regional(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	AsnDeep_RelocList(pReloc, (OSRTDList *)pv, sizeof(RegionalExtension), sReloc_RegionalExtension);
+}
+
+static size_t sSize_NodeSetLL(const void *pv)
+{
+	return AsnDeep_SizeList((const OSRTDList *)pv, sizeof(NodeLL), sSize_NodeLL);
+}
+
+static void sCopy_NodeSetLL(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	AsnDeep_CopyList(pArena, (OSRTDList *)pvDst, (const OSRTDList *)pvSrc, sizeof(NodeLL), sCopy_NodeLL);
+}
+
+static int sCmp_NodeSetLL(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	return AsnDeep_CmpList(pDiff, (const OSRTDList *)pvA, (const OSRTDList *)pvB, sizeof(NodeLL), sCmp_NodeLL);
+}
+
+static void sReloc_NodeSetLL(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	AsnDeep_RelocList(pReloc, (OSRTDList *)pv, sizeof(NodeLL), sReloc_NodeLL);
+}
+
+static size_t sSize_ITIScodesAndText(const void *pv)
+{
+	return AsnDeep_SizeList((const OSRTDList *)pv, sizeof(ITIScodesAndText_element), HAE_NULL);
+}
+
+static void sCopy_ITIScodesAndText(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	AsnDeep_CopyList(pArena, (OSRTDList *)pvDst, (const OSRTDList *)pvSrc, sizeof(ITIScodesAndText_element), HAE_NULL);
+}
+
+static int sCmp_ITIScodesAndText(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	return AsnDeep_CmpList(pDiff, (const OSRTDList *)pvA, (const OSRTDList *)pvB, sizeof(ITIScodesAndText_element), sCmp_ITIScodesAndText_element);
+}
+
+static void sReloc_ITIScodesAndText(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	AsnDeep_RelocList(pReloc, (OSRTDList *)pv, sizeof(ITIScodesAndText_element), HAE_NULL);
+}
+
+static size_t sSize_WorkZone(const void *pv)
+{
+	return AsnDeep_SizeList((const OSRTDList *)pv, sizeof(WorkZone_element), sSize_WorkZone_element);
+}
+
+static void sCopy_WorkZone(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	AsnDeep_CopyList(pArena, (OSRTDList *)pvDst, (const OSRTDList *)pvSrc, sizeof(WorkZone_element), sCopy_WorkZone_element);
+}
+
+static int sCmp_WorkZone(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	return AsnDeep_CmpList(pDiff, (const OSRTDList *)pvA, (const OSRTDList *)pvB, sizeof(WorkZone_element), sCmp_WorkZone_element);
+}
+
+static void sReloc_WorkZone(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	AsnDeep_RelocList(pReloc, (OSRTDList *)pv, sizeof(WorkZone_element), sReloc_WorkZone_element);
+}
+
+static size_t sSize_GenericSignage(const void *pv)
+{
+	return AsnDeep_SizeList((const OSRTDList *)pv, sizeof(GenericSignage_element), sSize_GenericSignage_element);
+}
+
+static void sCopy_GenericSignage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	AsnDeep_CopyList(pArena, (OSRTDList *)pvDst, (const OSRTDList *)pvSrc, sizeof(GenericSignage_element), sCopy_GenericSignage_element);
+}
+
+static int sCmp_GenericSignage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	return AsnDeep_CmpList(pDiff, (const OSRTDList *)pvA, (const OSRTDList *)pvB, sizeof(GenericSignage_element), sCmp_GenericSignage_element);
+}
+
+static void sReloc_GenericSignage(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	AsnDeep_RelocList(pReloc, (OSRTDList *)pv, sizeof(GenericSignage_element), sReloc_GenericSignage_element);
+}
+
+static size_t sSize_SpeedLimit(const void *pv)
+{
+	return AsnDeep_SizeList((const OSRTDList *)pv, sizeof(SpeedLimit_element), sSize_SpeedLimit_element);
+}
+
+static void sCopy_SpeedLimit(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	AsnDeep_CopyList(pArena, (OSRTDList *)pvDst, (const OSRTDList *)pvSrc, sizeof(SpeedLimit_element), sCopy_SpeedLimit_element);
+}
+
+static int sCmp_SpeedLimit(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	return AsnDeep_CmpList(pDiff, (const OSRTDList *)pvA, (const OSRTDList *)pvB, sizeof(SpeedLimit_element), sCmp_SpeedLimit_element);
+}
+
+static void sReloc_SpeedLimit(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	AsnDeep_RelocList(pReloc, (OSRTDList *)pv, sizeof(SpeedLimit_element), sReloc_SpeedLimit_element);
+}
+
+static size_t sSize_ExitService(const void *pv)
+{
+	return AsnDeep_SizeList((const OSRTDList *)pv, sizeof(ExitService_element), sSize_ExitService_element);
+}
+
+static void sCopy_ExitService(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	AsnDeep_CopyList(pArena, (OSRTDList *)pvDst, (const OSRTDList *)pvSrc, sizeof(ExitService_element), sCopy_ExitService_element);
+}
+
+static int sCmp_ExitService(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	return AsnDeep_CmpList(pDiff, (const OSRTDList *)pvA, (const OSRTDList *)pvB, sizeof(ExitService_element), sCmp_ExitService_element);
+}
+
+static void sReloc_ExitService(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	AsnDeep_RelocList(pReloc, (OSRTDList *)pv, sizeof(ExitService_element), sReloc_ExitService_element);
+}
+
+static void sReloc_AllowedManeuvers(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	AllowedManeuvers *pValue = (AllowedManeuvers *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_AllowedManeuvers(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const AllowedManeuvers *pA = (const AllowedManeuvers *)pvA;
+	const AllowedManeuvers *pB = (const AllowedManeuvers *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_BrakeAppliedStatus(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	BrakeAppliedStatus *pValue = (BrakeAppliedStatus *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_BrakeAppliedStatus(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const BrakeAppliedStatus *pA = (const BrakeAppliedStatus *)pvA;
+	const BrakeAppliedStatus *pB = (const BrakeAppliedStatus *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_CodeWord(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	CodeWord *pValue = (CodeWord *)pv;
+
+	AsnDeep_RelocOctets(pReloc, pValue->numocts, sizeof(pValue->data));
+}
+
+static int sCmp_CodeWord(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const CodeWord *pA = (const CodeWord *)pvA;
+	const CodeWord *pB = (const CodeWord *)pvB;
+
+	return AsnDeep_CmpOctets(pDiff, pA->numocts, pA->data, pB->numocts, pB->data, sizeof(pA->data));
+}
+
+static size_t sSize_ExteriorLights(const void *pv)
+{
+	const ExteriorLights *pValue = (const ExteriorLights *)pv;
+
+	return AsnDeep_SizeBits(pValue->numbits, sizeof(pValue->data), pValue->extdata);
+}
+
+static void sCopy_ExteriorLights(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	ExteriorLights *pDst = (ExteriorLights *)pvDst;
+	const ExteriorLights *pSrc = (const ExteriorLights *)pvSrc;
+
+	pDst->extdata = AsnDeep_CopyBits(pArena, pSrc->numbits, sizeof(pSrc->data), pSrc->extdata);
+}
+
+static void sReloc_ExteriorLights(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	ExteriorLights *pValue = (ExteriorLights *)pv;
+
+	AsnDeep_RelocBits(pReloc, &pValue->extdata, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_ExteriorLights(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ExteriorLights *pA = (const ExteriorLights *)pvA;
+	const ExteriorLights *pB = (const ExteriorLights *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, pA->extdata, pB->numbits, pB->data, pB->extdata, sizeof(pA->data));
+}
+
+static void sReloc_FurtherInfoID(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	FurtherInfoID *pValue = (FurtherInfoID *)pv;
+
+	AsnDeep_RelocOctets(pReloc, pValue->numocts, sizeof(pValue->data));
+}
+
+static int sCmp_FurtherInfoID(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const FurtherInfoID *pA = (const FurtherInfoID *)pvA;
+	const FurtherInfoID *pB = (const FurtherInfoID *)pvB;
+
+	return AsnDeep_CmpOctets(pDiff, pA->numocts, pA->data, pB->numocts, pB->data, sizeof(pA->data));
+}
+
+static void sReloc_GNSSstatus(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	GNSSstatus *pValue = (GNSSstatus *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_GNSSstatus(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const GNSSstatus *pA = (const GNSSstatus *)pvA;
+	const GNSSstatus *pB = (const GNSSstatus *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_HeadingSlice(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	HeadingSlice *pValue = (HeadingSlice *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_HeadingSlice(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const HeadingSlice *pA = (const HeadingSlice *)pvA;
+	const HeadingSlice *pB = (const HeadingSlice *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_IntersectionStatusObject(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	IntersectionStatusObject *pValue = (IntersectionStatusObject *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_IntersectionStatusObject(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const IntersectionStatusObject *pA = (const IntersectionStatusObject *)pvA;
+	const IntersectionStatusObject *pB = (const IntersectionStatusObject *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_LaneAttributes_Barrier(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	LaneAttributes_Barrier *pValue = (LaneAttributes_Barrier *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_LaneAttributes_Barrier(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const LaneAttributes_Barrier *pA = (const LaneAttributes_Barrier *)pvA;
+	const LaneAttributes_Barrier *pB = (const LaneAttributes_Barrier *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_LaneAttributes_Bike(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	LaneAttributes_Bike *pValue = (LaneAttributes_Bike *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_LaneAttributes_Bike(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const LaneAttributes_Bike *pA = (const LaneAttributes_Bike *)pvA;
+	const LaneAttributes_Bike *pB = (const LaneAttributes_Bike *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_LaneAttributes_Crosswalk(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	LaneAttributes_Crosswalk *pValue = (LaneAttributes_Crosswalk *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_LaneAttributes_Crosswalk(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const LaneAttributes_Crosswalk *pA = (const LaneAttributes_Crosswalk *)pvA;
+	const LaneAttributes_Crosswalk *pB = (const LaneAttributes_Crosswalk *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_LaneAttributes_Parking(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	LaneAttributes_Parking *pValue = (LaneAttributes_Parking *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_LaneAttributes_Parking(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const LaneAttributes_Parking *pA = (const LaneAttributes_Parking *)pvA;
+	const LaneAttributes_Parking *pB = (const LaneAttributes_Parking *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_LaneAttributes_Sidewalk(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	LaneAttributes_Sidewalk *pValue = (LaneAttributes_Sidewalk *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_LaneAttributes_Sidewalk(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const LaneAttributes_Sidewalk *pA = (const LaneAttributes_Sidewalk *)pvA;
+	const LaneAttributes_Sidewalk *pB = (const LaneAttributes_Sidewalk *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_LaneAttributes_Striping(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	LaneAttributes_Striping *pValue = (LaneAttributes_Striping *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_LaneAttributes_Striping(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const LaneAttributes_Striping *pA = (const LaneAttributes_Striping *)pvA;
+	const LaneAttributes_Striping *pB = (const LaneAttributes_Striping *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_LaneAttributes_TrackedVehicle(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	LaneAttributes_TrackedVehicle *pValue = (LaneAttributes_TrackedVehicle *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_LaneAttributes_TrackedVehicle(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const LaneAttributes_TrackedVehicle *pA = (const LaneAttributes_TrackedVehicle *)pvA;
+	const LaneAttributes_TrackedVehicle *pB = (const LaneAttributes_TrackedVehicle *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static size_t sSize_LaneAttributes_Vehicle(const void *pv)
+{
+	const LaneAttributes_Vehicle *pValue = (const LaneAttributes_Vehicle *)pv;
+
+	return AsnDeep_SizeBits(pValue->numbits, sizeof(pValue->data), pValue->extdata);
+}
+
+static void sCopy_LaneAttributes_Vehicle(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	LaneAttributes_Vehicle *pDst = (LaneAttributes_Vehicle *)pvDst;
+	const LaneAttributes_Vehicle *pSrc = (const LaneAttributes_Vehicle *)pvSrc;
+
+	pDst->extdata = AsnDeep_CopyBits(pArena, pSrc->numbits, sizeof(pSrc->data), pSrc->extdata);
+}
+
+static void sReloc_LaneAttributes_Vehicle(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	LaneAttributes_Vehicle *pValue = (LaneAttributes_Vehicle *)pv;
+
+	AsnDeep_RelocBits(pReloc, &pValue->extdata, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_LaneAttributes_Vehicle(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const LaneAttributes_Vehicle *pA = (const LaneAttributes_Vehicle *)pvA;
+	const LaneAttributes_Vehicle *pB = (const LaneAttributes_Vehicle *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, pA->extdata, pB->numbits, pB->data, pB->extdata, sizeof(pA->data));
+}
+
+static void sReloc_LaneDirection(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	LaneDirection *pValue = (LaneDirection *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_LaneDirection(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const LaneDirection *pA = (const LaneDirection *)pvA;
+	const LaneDirection *pB = (const LaneDirection *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_LaneSharing(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	LaneSharing *pValue = (LaneSharing *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_LaneSharing(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const LaneSharing *pA = (const LaneSharing *)pvA;
+	const LaneSharing *pB = (const LaneSharing *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_MessageBLOB(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	MessageBLOB *pValue = (MessageBLOB *)pv;
+
+	AsnDeep_RelocOctets(pReloc, pValue->numocts, sizeof(pValue->data));
+}
+
+static int sCmp_MessageBLOB(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const MessageBLOB *pA = (const MessageBLOB *)pvA;
+	const MessageBLOB *pB = (const MessageBLOB *)pvB;
+
+	return AsnDeep_CmpOctets(pDiff, pA->numocts, pA->data, pB->numocts, pB->data, sizeof(pA->data));
+}
+
+static void sReloc_MsgCRC(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	MsgCRC *pValue = (MsgCRC *)pv;
+
+	AsnDeep_RelocOctets(pReloc, pValue->numocts, sizeof(pValue->data));
+}
+
+static int sCmp_MsgCRC(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const MsgCRC *pA = (const MsgCRC *)pvA;
+	const MsgCRC *pB = (const MsgCRC *)pvB;
+
+	return AsnDeep_CmpOctets(pDiff, pA->numocts, pA->data, pB->numocts, pB->data, sizeof(pA->data));
+}
+
+static void sReloc_NMEA_Payload(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	NMEA_Payload *pValue = (NMEA_Payload *)pv;
+
+	AsnDeep_RelocOctets(pReloc, pValue->numocts, sizeof(pValue->data));
+}
+
+static int sCmp_NMEA_Payload(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const NMEA_Payload *pA = (const NMEA_Payload *)pvA;
+	const NMEA_Payload *pB = (const NMEA_Payload *)pvB;
+
+	return AsnDeep_CmpOctets(pDiff, pA->numocts, pA->data, pB->numocts, pB->data, sizeof(pA->data));
+}
+
+static void sReloc_PayloadData(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	PayloadData *pValue = (PayloadData *)pv;
+
+	AsnDeep_RelocOctets(pReloc, pValue->numocts, sizeof(pValue->data));
+}
+
+static int sCmp_PayloadData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PayloadData *pA = (const PayloadData *)pvA;
+	const PayloadData *pB = (const PayloadData *)pvB;
+
+	return AsnDeep_CmpOctets(pDiff, pA->numocts, pA->data, pB->numocts, pB->data, sizeof(pA->data));
+}
+
+static size_t sSize_PersonalAssistive(const void *pv)
+{
+	const PersonalAssistive *pValue = (const PersonalAssistive *)pv;
+
+	return AsnDeep_SizeBits(pValue->numbits, sizeof(pValue->data), pValue->extdata);
+}
+
+static void sCopy_PersonalAssistive(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	PersonalAssistive *pDst = (PersonalAssistive *)pvDst;
+	const PersonalAssistive *pSrc = (const PersonalAssistive *)pvSrc;
+
+	pDst->extdata = AsnDeep_CopyBits(pArena, pSrc->numbits, sizeof(pSrc->data), pSrc->extdata);
+}
+
+static void sReloc_PersonalAssistive(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	PersonalAssistive *pValue = (PersonalAssistive *)pv;
+
+	AsnDeep_RelocBits(pReloc, &pValue->extdata, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_PersonalAssistive(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PersonalAssistive *pA = (const PersonalAssistive *)pvA;
+	const PersonalAssistive *pB = (const PersonalAssistive *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, pA->extdata, pB->numbits, pB->data, pB->extdata, sizeof(pA->data));
+}
+
+static size_t sSize_PersonalDeviceUsageState(const void *pv)
+{
+	const PersonalDeviceUsageState *pValue = (const PersonalDeviceUsageState *)pv;
+
+	return AsnDeep_SizeBits(pValue->numbits, sizeof(pValue->data), pValue->extdata);
+}
+
+static void sCopy_PersonalDeviceUsageState(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	PersonalDeviceUsageState *pDst = (PersonalDeviceUsageState *)pvDst;
+	const PersonalDeviceUsageState *pSrc = (const PersonalDeviceUsageState *)pvSrc;
+
+	pDst->extdata = AsnDeep_CopyBits(pArena, pSrc->numbits, sizeof(pSrc->data), pSrc->extdata);
+}
+
+static void sReloc_PersonalDeviceUsageState(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	PersonalDeviceUsageState *pValue = (PersonalDeviceUsageState *)pv;
+
+	AsnDeep_RelocBits(pReloc, &pValue->extdata, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_PersonalDeviceUsageState(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PersonalDeviceUsageState *pA = (const PersonalDeviceUsageState *)pvA;
+	const PersonalDeviceUsageState *pB = (const PersonalDeviceUsageState *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, pA->extdata, pB->numbits, pB->data, pB->extdata, sizeof(pA->data));
+}
+
+static void sReloc_Priority(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	Priority *pValue = (Priority *)pv;
+
+	AsnDeep_RelocOctets(pReloc, pValue->numocts, sizeof(pValue->data));
+}
+
+static int sCmp_Priority(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Priority *pA = (const Priority *)pvA;
+	const Priority *pB = (const Priority *)pvB;
+
+	return AsnDeep_CmpOctets(pDiff, pA->numocts, pA->data, pB->numocts, pB->data, sizeof(pA->data));
+}
+
+static void sReloc_PrivilegedEventFlags(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	PrivilegedEventFlags *pValue = (PrivilegedEventFlags *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_PrivilegedEventFlags(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PrivilegedEventFlags *pA = (const PrivilegedEventFlags *)pvA;
+	const PrivilegedEventFlags *pB = (const PrivilegedEventFlags *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static size_t sSize_PublicSafetyAndRoadWorkerActivity(const void *pv)
+{
+	const PublicSafetyAndRoadWorkerActivity *pValue = (const PublicSafetyAndRoadWorkerActivity *)pv;
+
+	return AsnDeep_SizeBits(pValue->numbits, sizeof(pValue->data), pValue->extdata);
+}
+
+static void sCopy_PublicSafetyAndRoadWorkerActivity(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	PublicSafetyAndRoadWorkerActivity *pDst = (PublicSafetyAndRoadWorkerActivity *)pvDst;
+	const PublicSafetyAndRoadWorkerActivity *pSrc = (const PublicSafetyAndRoadWorkerActivity *)pvSrc;
+
+	pDst->extdata = AsnDeep_CopyBits(pArena, pSrc->numbits, sizeof(pSrc->data), pSrc->extdata);
+}
+
+static void sReloc_PublicSafetyAndRoadWorkerActivity(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	PublicSafetyAndRoadWorkerActivity *pValue = (PublicSafetyAndRoadWorkerActivity *)pv;
+
+	AsnDeep_RelocBits(pReloc, &pValue->extdata, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_PublicSafetyAndRoadWorkerActivity(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PublicSafetyAndRoadWorkerActivity *pA = (const PublicSafetyAndRoadWorkerActivity *)pvA;
+	const PublicSafetyAndRoadWorkerActivity *pB = (const PublicSafetyAndRoadWorkerActivity *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, pA->extdata, pB->numbits, pB->data, pB->extdata, sizeof(pA->data));
+}
+
+static size_t sSize_PublicSafetyDirectingTrafficSubType(const void *pv)
+{
+	const PublicSafetyDirectingTrafficSubType *pValue = (const PublicSafetyDirectingTrafficSubType *)pv;
+
+	return AsnDeep_SizeBits(pValue->numbits, sizeof(pValue->data), pValue->extdata);
+}
+
+static void sCopy_PublicSafetyDirectingTrafficSubType(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	PublicSafetyDirectingTrafficSubType *pDst = (PublicSafetyDirectingTrafficSubType *)pvDst;
+	const PublicSafetyDirectingTrafficSubType *pSrc = (const PublicSafetyDirectingTrafficSubType *)pvSrc;
+
+	pDst->extdata = AsnDeep_CopyBits(pArena, pSrc->numbits, sizeof(pSrc->data), pSrc->extdata);
+}
+
+static void sReloc_PublicSafetyDirectingTrafficSubType(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	PublicSafetyDirectingTrafficSubType *pValue = (PublicSafetyDirectingTrafficSubType *)pv;
+
+	AsnDeep_RelocBits(pReloc, &pValue->extdata, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_PublicSafetyDirectingTrafficSubType(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PublicSafetyDirectingTrafficSubType *pA = (const PublicSafetyDirectingTrafficSubType *)pvA;
+	const PublicSafetyDirectingTrafficSubType *pB = (const PublicSafetyDirectingTrafficSubType *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, pA->extdata, pB->numbits, pB->data, pB->extdata, sizeof(pA->data));
+}
+
+static void sReloc_RTCMmessage(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RTCMmessage *pValue = (RTCMmessage *)pv;
+
+	AsnDeep_RelocOctets(pReloc, pValue->numocts, sizeof(pValue->data));
+}
+
+static int sCmp_RTCMmessage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RTCMmessage *pA = (const RTCMmessage *)pvA;
+	const RTCMmessage *pB = (const RTCMmessage *)pvB;
+
+	return AsnDeep_CmpOctets(pDiff, pA->numocts, pA->data, pB->numocts, pB->data, sizeof(pA->data));
+}
+
+static void sReloc_SignalReqScheme(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SignalReqScheme *pValue = (SignalReqScheme *)pv;
+
+	AsnDeep_RelocOctets(pReloc, pValue->numocts, sizeof(pValue->data));
+}
+
+static int sCmp_SignalReqScheme(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SignalReqScheme *pA = (const SignalReqScheme *)pvA;
+	const SignalReqScheme *pB = (const SignalReqScheme *)pvB;
+
+	return AsnDeep_CmpOctets(pDiff, pA->numocts, pA->data, pB->numocts, pB->data, sizeof(pA->data));
+}
+
+static void sReloc_TemporaryID(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TemporaryID *pValue = (TemporaryID *)pv;
+
+	AsnDeep_RelocOctets(pReloc, pValue->numocts, sizeof(pValue->data));
+}
+
+static int sCmp_TemporaryID(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TemporaryID *pA = (const TemporaryID *)pvA;
+	const TemporaryID *pB = (const TemporaryID *)pvB;
+
+	return AsnDeep_CmpOctets(pDiff, pA->numocts, pA->data, pB->numocts, pB->data, sizeof(pA->data));
+}
+
+static void sReloc_TransitStatus(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TransitStatus *pValue = (TransitStatus *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_TransitStatus(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TransitStatus *pA = (const TransitStatus *)pvA;
+	const TransitStatus *pB = (const TransitStatus *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_TransitVehicleStatus(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TransitVehicleStatus *pValue = (TransitVehicleStatus *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_TransitVehicleStatus(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TransitVehicleStatus *pA = (const TransitVehicleStatus *)pvA;
+	const TransitVehicleStatus *pB = (const TransitVehicleStatus *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_UniqueMSGID(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	UniqueMSGID *pValue = (UniqueMSGID *)pv;
+
+	AsnDeep_RelocOctets(pReloc, pValue->numocts, sizeof(pValue->data));
+}
+
+static int sCmp_UniqueMSGID(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const UniqueMSGID *pA = (const UniqueMSGID *)pvA;
+	const UniqueMSGID *pB = (const UniqueMSGID *)pvB;
+
+	return AsnDeep_CmpOctets(pDiff, pA->numocts, pA->data, pB->numocts, pB->data, sizeof(pA->data));
+}
+
+static size_t sSize_UserSizeAndBehaviour(const void *pv)
+{
+	const UserSizeAndBehaviour *pValue = (const UserSizeAndBehaviour *)pv;
+
+	return AsnDeep_SizeBits(pValue->numbits, sizeof(pValue->data), pValue->extdata);
+}
+
+static void sCopy_UserSizeAndBehaviour(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	UserSizeAndBehaviour *pDst = (UserSizeAndBehaviour *)pvDst;
+	const UserSizeAndBehaviour *pSrc = (const UserSizeAndBehaviour *)pvSrc;
+
+	pDst->extdata = AsnDeep_CopyBits(pArena, pSrc->numbits, sizeof(pSrc->data), pSrc->extdata);
+}
+
+static void sReloc_UserSizeAndBehaviour(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	UserSizeAndBehaviour *pValue = (UserSizeAndBehaviour *)pv;
+
+	AsnDeep_RelocBits(pReloc, &pValue->extdata, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_UserSizeAndBehaviour(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const UserSizeAndBehaviour *pA = (const UserSizeAndBehaviour *)pvA;
+	const UserSizeAndBehaviour *pB = (const UserSizeAndBehaviour *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, pA->extdata, pB->numbits, pB->data, pB->extdata, sizeof(pA->data));
+}
+
+static size_t sSize_VehicleEventFlags(const void *pv)
+{
+	const VehicleEventFlags *pValue = (const VehicleEventFlags *)pv;
+
+	return AsnDeep_SizeBits(pValue->numbits, sizeof(pValue->data), pValue->extdata);
+}
+
+static void sCopy_VehicleEventFlags(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	VehicleEventFlags *pDst = (VehicleEventFlags *)pvDst;
+	const VehicleEventFlags *pSrc = (const VehicleEventFlags *)pvSrc;
+
+	pDst->extdata = AsnDeep_CopyBits(pArena, pSrc->numbits, sizeof(pSrc->data), pSrc->extdata);
+}
+
+static void sReloc_VehicleEventFlags(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	VehicleEventFlags *pValue = (VehicleEventFlags *)pv;
+
+	AsnDeep_RelocBits(pReloc, &pValue->extdata, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_VehicleEventFlags(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VehicleEventFlags *pA = (const VehicleEventFlags *)pvA;
+	const VehicleEventFlags *pB = (const VehicleEventFlags *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, pA->extdata, pB->numbits, pB->data, pB->extdata, sizeof(pA->data));
+}
+
+static void sReloc_VerticalAccelerationThreshold(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	VerticalAccelerationThreshold *pValue = (VerticalAccelerationThreshold *)pv;
+
+	AsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));
+}
+
+static int sCmp_VerticalAccelerationThreshold(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VerticalAccelerationThreshold *pA = (const VerticalAccelerationThreshold *)pvA;
+	const VerticalAccelerationThreshold *pB = (const VerticalAccelerationThreshold *)pvB;
+
+	return AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));
+}
+
+static void sReloc_VINstring(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	VINstring *pValue = (VINstring *)pv;
+
+	AsnDeep_RelocOctets(pReloc, pValue->numocts, sizeof(pValue->data));
+}
+
+static int sCmp_VINstring(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VINstring *pA = (const VINstring *)pvA;
+	const VINstring *pB = (const VINstring *)pvB;
+
+	return AsnDeep_CmpOctets(pDiff, pA->numocts, pA->data, pB->numocts, pB->data, sizeof(pA->data));
+}
+
+static size_t sSize_MessageFrame(const void *pv)
+{
+	const MessageFrame *pValue = (const MessageFrame *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeOpen(&pValue->value);
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_MessageFrame(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	MessageFrame *pDst = (MessageFrame *)pvDst;
+	const MessageFrame *pSrc = (const MessageFrame *)pvSrc;
+
+	AsnDeep_CopyOpen(pArena, &pDst->value, &pSrc->value);
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_MessageFrame(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	MessageFrame *pValue = (MessageFrame *)pv;
+
+	AsnDeep_RelocOpen(pReloc, &pValue->value);
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_MessageFrame(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const MessageFrame *pA = (const MessageFrame *)pvA;
+	const MessageFrame *pB = (const MessageFrame *)pvB;
+	int ret = 0;
+
+	if (pA->messageId != pB->messageId) ASN_DEEP_DIFFER("messageId")
+	ASN_DEEP_INTO("value", AsnDeep_CmpOpen(pDiff, &pA->value, &pB->value))
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static int sCmp_PositionalAccuracy(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PositionalAccuracy *pA = (const PositionalAccuracy *)pvA;
+	const PositionalAccuracy *pB = (const PositionalAccuracy *)pvB;
+	int ret = 0;
+
+	if (pA->semiMajor != pB->semiMajor) ASN_DEEP_DIFFER("semiMajor")
+	if (pA->semiMinor != pB->semiMinor) ASN_DEEP_DIFFER("semiMinor")
+	if (pA->orientation != pB->orientation) ASN_DEEP_DIFFER("orientation")
+	return ret;
+}
+
+static int sCmp_AccelerationSet4Way(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const AccelerationSet4Way *pA = (const AccelerationSet4Way *)pvA;
+	const AccelerationSet4Way *pB = (const AccelerationSet4Way *)pvB;
+	int ret = 0;
+
+	if (pA->long_ != pB->long_) ASN_DEEP_DIFFER("long_")
+	if (pA->lat != pB->lat) ASN_DEEP_DIFFER("lat")
+	if (pA->vert != pB->vert) ASN_DEEP_DIFFER("vert")
+	if (pA->yaw != pB->yaw) ASN_DEEP_DIFFER("yaw")
+	return ret;
+}
+
+static void sReloc_BrakeSystemStatus(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	BrakeSystemStatus *pValue = (BrakeSystemStatus *)pv;
+
+	sReloc_BrakeAppliedStatus(pReloc, &pValue->wheelBrakes);
+}
+
+static int sCmp_BrakeSystemStatus(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const BrakeSystemStatus *pA = (const BrakeSystemStatus *)pvA;
+	const BrakeSystemStatus *pB = (const BrakeSystemStatus *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("wheelBrakes", sCmp_BrakeAppliedStatus(pDiff, &pA->wheelBrakes, &pB->wheelBrakes))
+	if (pA->traction != pB->traction) ASN_DEEP_DIFFER("traction")
+	if (pA->albs != pB->albs) ASN_DEEP_DIFFER("albs")
+	if (pA->scs != pB->scs) ASN_DEEP_DIFFER("scs")
+	if (pA->brakeBoost != pB->brakeBoost) ASN_DEEP_DIFFER("brakeBoost")
+	if (pA->auxBrakes != pB->auxBrakes) ASN_DEEP_DIFFER("auxBrakes")
+	return ret;
+}
+
+static int sCmp_VehicleSize(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VehicleSize *pA = (const VehicleSize *)pvA;
+	const VehicleSize *pB = (const VehicleSize *)pvB;
+	int ret = 0;
+
+	if (pA->width != pB->width) ASN_DEEP_DIFFER("width")
+	if (pA->length != pB->length) ASN_DEEP_DIFFER("length")
+	return ret;
+}
+
+static void sReloc_BSMcoreData(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	BSMcoreData *pValue = (BSMcoreData *)pv;
+
+	sReloc_TemporaryID(pReloc, &pValue->id);
+	sReloc_BrakeSystemStatus(pReloc, &pValue->brakes);
+}
+
+static int sCmp_BSMcoreData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const BSMcoreData *pA = (const BSMcoreData *)pvA;
+	const BSMcoreData *pB = (const BSMcoreData *)pvB;
+	int ret = 0;
+
+	if (pA->msgCnt != pB->msgCnt) ASN_DEEP_DIFFER("msgCnt")
+	ASN_DEEP_INTO("id", sCmp_TemporaryID(pDiff, &pA->id, &pB->id))
+	if (pA->secMark != pB->secMark) ASN_DEEP_DIFFER("secMark")
+	if (pA->lat != pB->lat) ASN_DEEP_DIFFER("lat")
+	if (pA->long_ != pB->long_) ASN_DEEP_DIFFER("long_")
+	if (pA->elev != pB->elev) ASN_DEEP_DIFFER("elev")
+	ASN_DEEP_INTO("accuracy", sCmp_PositionalAccuracy(pDiff, &pA->accuracy, &pB->accuracy))
+	if (pA->transmission != pB->transmission) ASN_DEEP_DIFFER("transmission")
+	if (pA->speed != pB->speed) ASN_DEEP_DIFFER("speed")
+	if (pA->heading != pB->heading) ASN_DEEP_DIFFER("heading")
+	if (pA->angle != pB->angle) ASN_DEEP_DIFFER("angle")
+	ASN_DEEP_INTO("accelSet", sCmp_AccelerationSet4Way(pDiff, &pA->accelSet, &pB->accelSet))
+	ASN_DEEP_INTO("brakes", sCmp_BrakeSystemStatus(pDiff, &pA->brakes, &pB->brakes))
+	ASN_DEEP_INTO("size", sCmp_VehicleSize(pDiff, &pA->size, &pB->size))
+	return ret;
+}
+
+static size_t sSize_PartIIcontent(const void *pv)
+{
+	const PartIIcontent *pValue = (const PartIIcontent *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeOpen(&pValue->partII_Value);
+	return size;
+}
+
+static void sCopy_PartIIcontent(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	PartIIcontent *pDst = (PartIIcontent *)pvDst;
+	const PartIIcontent *pSrc = (const PartIIcontent *)pvSrc;
+
+	AsnDeep_CopyOpen(pArena, &pDst->partII_Value, &pSrc->partII_Value);
+}
+
+static void sReloc_PartIIcontent(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	PartIIcontent *pValue = (PartIIcontent *)pv;
+
+	AsnDeep_RelocOpen(pReloc, &pValue->partII_Value);
+}
+
+static int sCmp_PartIIcontent(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PartIIcontent *pA = (const PartIIcontent *)pvA;
+	const PartIIcontent *pB = (const PartIIcontent *)pvB;
+	int ret = 0;
+
+	if (pA->partII_Id != pB->partII_Id) ASN_DEEP_DIFFER("partII_Id")
+	ASN_DEEP_INTO("partII_Value", AsnDeep_CmpOpen(pDiff, &pA->partII_Value, &pB->partII_Value))
+	return ret;
+}
+
+static size_t sSize_RegionalExtension(const void *pv)
+{
+	const RegionalExtension *pValue = (const RegionalExtension *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeOpen(&pValue->regExtValue);
+	return size;
+}
+
+static void sCopy_RegionalExtension(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	RegionalExtension *pDst = (RegionalExtension *)pvDst;
+	const RegionalExtension *pSrc = (const RegionalExtension *)pvSrc;
+
+	AsnDeep_CopyOpen(pArena, &pDst->regExtValue, &pSrc->regExtValue);
+}
+
+static void sReloc_RegionalExtension(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RegionalExtension *pValue = (RegionalExtension *)pv;
+
+	AsnDeep_RelocOpen(pReloc, &pValue->regExtValue);
+}
+
+static int sCmp_RegionalExtension(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RegionalExtension *pA = (const RegionalExtension *)pvA;
+	const RegionalExtension *pB = (const RegionalExtension *)pvB;
+	int ret = 0;
+
+	if (pA->regionId != pB->regionId) ASN_DEEP_DIFFER("regionId")
+	ASN_DEEP_INTO("regExtValue", AsnDeep_CmpOpen(pDiff, &pA->regExtValue, &pB->regExtValue))
+	return ret;
+}
+
+static size_t sSize_BasicSafetyMessage(const void *pv)
+{
+	const BasicSafetyMessage *pValue = (const BasicSafetyMessage *)pv;
+	size_t size = 0;
+
+	if (pValue->m.partIIPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->partII, sizeof(PartIIcontent), sSize_PartIIcontent);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_BasicSafetyMessage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	BasicSafetyMessage *pDst = (BasicSafetyMessage *)pvDst;
+	const BasicSafetyMessage *pSrc = (const BasicSafetyMessage *)pvSrc;
+
+	if (pSrc->m.partIIPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->partII, &pSrc->partII, sizeof(PartIIcontent), sCopy_PartIIcontent);
+	}
+	else
+	{
+		memset(&pDst->partII, 0x00, sizeof(pDst->partII));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_BasicSafetyMessage(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	BasicSafetyMessage *pValue = (BasicSafetyMessage *)pv;
+
+	sReloc_BSMcoreData(pReloc, &pValue->coreData);
+	if (pValue->m.partIIPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->partII, sizeof(PartIIcontent), sReloc_PartIIcontent);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_BasicSafetyMessage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const BasicSafetyMessage *pA = (const BasicSafetyMessage *)pvA;
+	const BasicSafetyMessage *pB = (const BasicSafetyMessage *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("coreData", sCmp_BSMcoreData(pDiff, &pA->coreData, &pB->coreData))
+	if (pA->m.partIIPresent != pB->m.partIIPresent) ASN_DEEP_DIFFER("partII")
+	else if (pA->m.partIIPresent)
+	{
+		ASN_DEEP_INTO("partII", AsnDeep_CmpList(pDiff, &pA->partII, &pB->partII, sizeof(PartIIcontent), sCmp_PartIIcontent))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static void sReloc_RequestedItemList(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RequestedItemList *pValue = (RequestedItemList *)pv;
+
+	AsnDeep_RelocArray(pReloc, pValue->elem, pValue->n, sizeof(pValue->elem) / sizeof(pValue->elem[0]), sizeof(pValue->elem[0]), HAE_NULL);
+}
+
+static int sCmp_RequestedItemList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RequestedItemList *pA = (const RequestedItemList *)pvA;
+	const RequestedItemList *pB = (const RequestedItemList *)pvB;
+
+	return AsnDeep_CmpArray(pDiff, pA->elem, pA->n, pB->elem, pB->n, sizeof(pA->elem) / sizeof(pA->elem[0]), sizeof(pA->elem[0]), HAE_NULL);
+}
+
+static size_t sSize_CommonSafetyRequest(const void *pv)
+{
+	const CommonSafetyRequest *pValue = (const CommonSafetyRequest *)pv;
+	size_t size = 0;
+
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_CommonSafetyRequest(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	CommonSafetyRequest *pDst = (CommonSafetyRequest *)pvDst;
+	const CommonSafetyRequest *pSrc = (const CommonSafetyRequest *)pvSrc;
+
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_CommonSafetyRequest(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	CommonSafetyRequest *pValue = (CommonSafetyRequest *)pv;
+
+	if (pValue->m.idPresent)
+	{
+		sReloc_TemporaryID(pReloc, &pValue->id);
+	}
+	sReloc_RequestedItemList(pReloc, &pValue->requests);
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_CommonSafetyRequest(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const CommonSafetyRequest *pA = (const CommonSafetyRequest *)pvA;
+	const CommonSafetyRequest *pB = (const CommonSafetyRequest *)pvB;
+	int ret = 0;
+
+	if (pA->m.timeStampPresent != pB->m.timeStampPresent) ASN_DEEP_DIFFER("timeStamp")
+	else if (pA->m.timeStampPresent)
+	{
+		if (pA->timeStamp != pB->timeStamp) ASN_DEEP_DIFFER("timeStamp")
+	}
+	if (pA->m.msgCntPresent != pB->m.msgCntPresent) ASN_DEEP_DIFFER("msgCnt")
+	else if (pA->m.msgCntPresent)
+	{
+		if (pA->msgCnt != pB->msgCnt) ASN_DEEP_DIFFER("msgCnt")
+	}
+	if (pA->m.idPresent != pB->m.idPresent) ASN_DEEP_DIFFER("id")
+	else if (pA->m.idPresent)
+	{
+		ASN_DEEP_INTO("id", sCmp_TemporaryID(pDiff, &pA->id, &pB->id))
+	}
+	ASN_DEEP_INTO("requests", sCmp_RequestedItemList(pDiff, &pA->requests, &pB->requests))
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static void sReloc_RoadSideAlert_description(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RoadSideAlert_description *pValue = (RoadSideAlert_description *)pv;
+
+	AsnDeep_RelocArray(pReloc, pValue->elem, pValue->n, sizeof(pValue->elem) / sizeof(pValue->elem[0]), sizeof(pValue->elem[0]), HAE_NULL);
+}
+
+static int sCmp_RoadSideAlert_description(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RoadSideAlert_description *pA = (const RoadSideAlert_description *)pvA;
+	const RoadSideAlert_description *pB = (const RoadSideAlert_description *)pvB;
+
+	return AsnDeep_CmpArray(pDiff, pA->elem, pA->n, pB->elem, pB->n, sizeof(pA->elem) / sizeof(pA->elem[0]), sizeof(pA->elem[0]), HAE_NULL);
+}
+
+static int sCmp_DDateTime(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const DDateTime *pA = (const DDateTime *)pvA;
+	const DDateTime *pB = (const DDateTime *)pvB;
+	int ret = 0;
+
+	if (pA->m.yearPresent != pB->m.yearPresent) ASN_DEEP_DIFFER("year")
+	else if (pA->m.yearPresent)
+	{
+		if (pA->year != pB->year) ASN_DEEP_DIFFER("year")
+	}
+	if (pA->m.monthPresent != pB->m.monthPresent) ASN_DEEP_DIFFER("month")
+	else if (pA->m.monthPresent)
+	{
+		if (pA->month != pB->month) ASN_DEEP_DIFFER("month")
+	}
+	if (pA->m.dayPresent != pB->m.dayPresent) ASN_DEEP_DIFFER("day")
+	else if (pA->m.dayPresent)
+	{
+		if (pA->day != pB->day) ASN_DEEP_DIFFER("day")
+	}
+	if (pA->m.hourPresent != pB->m.hourPresent) ASN_DEEP_DIFFER("hour")
+	else if (pA->m.hourPresent)
+	{
+		if (pA->hour != pB->hour) ASN_DEEP_DIFFER("hour")
+	}
+	if (pA->m.minutePresent != pB->m.minutePresent) ASN_DEEP_DIFFER("minute")
+	else if (pA->m.minutePresent)
+	{
+		if (pA->minute != pB->minute) ASN_DEEP_DIFFER("minute")
+	}
+	if (pA->m.secondPresent != pB->m.secondPresent) ASN_DEEP_DIFFER("second")
+	else if (pA->m.secondPresent)
+	{
+		if (pA->second != pB->second) ASN_DEEP_DIFFER("second")
+	}
+	if (pA->m.offsetPresent != pB->m.offsetPresent) ASN_DEEP_DIFFER("offset")
+	else if (pA->m.offsetPresent)
+	{
+		if (pA->offset != pB->offset) ASN_DEEP_DIFFER("offset")
+	}
+	return ret;
+}
+
+static int sCmp_TransmissionAndSpeed(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TransmissionAndSpeed *pA = (const TransmissionAndSpeed *)pvA;
+	const TransmissionAndSpeed *pB = (const TransmissionAndSpeed *)pvB;
+	int ret = 0;
+
+	if (pA->transmisson != pB->transmisson) ASN_DEEP_DIFFER("transmisson")
+	if (pA->speed != pB->speed) ASN_DEEP_DIFFER("speed")
+	return ret;
+}
+
+static int sCmp_PositionConfidenceSet(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PositionConfidenceSet *pA = (const PositionConfidenceSet *)pvA;
+	const PositionConfidenceSet *pB = (const PositionConfidenceSet *)pvB;
+	int ret = 0;
+
+	if (pA->pos != pB->pos) ASN_DEEP_DIFFER("pos")
+	if (pA->elevation != pB->elevation) ASN_DEEP_DIFFER("elevation")
+	return ret;
+}
+
+static int sCmp_SpeedandHeadingandThrottleConfidence(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SpeedandHeadingandThrottleConfidence *pA = (const SpeedandHeadingandThrottleConfidence *)pvA;
+	const SpeedandHeadingandThrottleConfidence *pB = (const SpeedandHeadingandThrottleConfidence *)pvB;
+	int ret = 0;
+
+	if (pA->heading != pB->heading) ASN_DEEP_DIFFER("heading")
+	if (pA->speed != pB->speed) ASN_DEEP_DIFFER("speed")
+	if (pA->throttle != pB->throttle) ASN_DEEP_DIFFER("throttle")
+	return ret;
+}
+
+static size_t sSize_FullPositionVector(const void *pv)
+{
+	const FullPositionVector *pValue = (const FullPositionVector *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_FullPositionVector(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	FullPositionVector *pDst = (FullPositionVector *)pvDst;
+	const FullPositionVector *pSrc = (const FullPositionVector *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_FullPositionVector(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	FullPositionVector *pValue = (FullPositionVector *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_FullPositionVector(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const FullPositionVector *pA = (const FullPositionVector *)pvA;
+	const FullPositionVector *pB = (const FullPositionVector *)pvB;
+	int ret = 0;
+
+	if (pA->m.utcTimePresent != pB->m.utcTimePresent) ASN_DEEP_DIFFER("utcTime")
+	else if (pA->m.utcTimePresent)
+	{
+		ASN_DEEP_INTO("utcTime", sCmp_DDateTime(pDiff, &pA->utcTime, &pB->utcTime))
+	}
+	if (pA->long_ != pB->long_) ASN_DEEP_DIFFER("long_")
+	if (pA->lat != pB->lat) ASN_DEEP_DIFFER("lat")
+	if (pA->m.elevationPresent != pB->m.elevationPresent) ASN_DEEP_DIFFER("elevation")
+	else if (pA->m.elevationPresent)
+	{
+		if (pA->elevation != pB->elevation) ASN_DEEP_DIFFER("elevation")
+	}
+	if (pA->m.headingPresent != pB->m.headingPresent) ASN_DEEP_DIFFER("heading")
+	else if (pA->m.headingPresent)
+	{
+		if (pA->heading != pB->heading) ASN_DEEP_DIFFER("heading")
+	}
+	if (pA->m.speedPresent != pB->m.speedPresent) ASN_DEEP_DIFFER("speed")
+	else if (pA->m.speedPresent)
+	{
+		ASN_DEEP_INTO("speed", sCmp_TransmissionAndSpeed(pDiff, &pA->speed, &pB->speed))
+	}
+	if (pA->m.posAccuracyPresent != pB->m.posAccuracyPresent) ASN_DEEP_DIFFER("posAccuracy")
+	else if (pA->m.posAccuracyPresent)
+	{
+		ASN_DEEP_INTO("posAccuracy", sCmp_PositionalAccuracy(pDiff, &pA->posAccuracy, &pB->posAccuracy))
+	}
+	if (pA->m.timeConfidencePresent != pB->m.timeConfidencePresent) ASN_DEEP_DIFFER("timeConfidence")
+	else if (pA->m.timeConfidencePresent)
+	{
+		if (pA->timeConfidence != pB->timeConfidence) ASN_DEEP_DIFFER("timeConfidence")
+	}
+	if (pA->m.posConfidencePresent != pB->m.posConfidencePresent) ASN_DEEP_DIFFER("posConfidence")
+	else if (pA->m.posConfidencePresent)
+	{
+		ASN_DEEP_INTO("posConfidence", sCmp_PositionConfidenceSet(pDiff, &pA->posConfidence, &pB->posConfidence))
+	}
+	if (pA->m.speedConfidencePresent != pB->m.speedConfidencePresent) ASN_DEEP_DIFFER("speedConfidence")
+	else if (pA->m.speedConfidencePresent)
+	{
+		ASN_DEEP_INTO("speedConfidence", sCmp_SpeedandHeadingandThrottleConfidence(pDiff, &pA->speedConfidence, &pB->speedConfidence))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_RoadSideAlert(const void *pv)
+{
+	const RoadSideAlert *pValue = (const RoadSideAlert *)pv;
+	size_t size = 0;
+
+	if (pValue->m.positionPresent)
+	{
+		size += sSize_FullPositionVector(&pValue->position);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_RoadSideAlert(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	RoadSideAlert *pDst = (RoadSideAlert *)pvDst;
+	const RoadSideAlert *pSrc = (const RoadSideAlert *)pvSrc;
+
+	if (pSrc->m.positionPresent)
+	{
+		sCopy_FullPositionVector(pArena, &pDst->position, &pSrc->position);
+	}
+	else
+	{
+		memset(&pDst->position, 0x00, sizeof(pDst->position));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_RoadSideAlert(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RoadSideAlert *pValue = (RoadSideAlert *)pv;
+
+	if (pValue->m.descriptionPresent)
+	{
+		sReloc_RoadSideAlert_description(pReloc, &pValue->description);
+	}
+	if (pValue->m.priorityPresent)
+	{
+		sReloc_Priority(pReloc, &pValue->priority);
+	}
+	if (pValue->m.headingPresent)
+	{
+		sReloc_HeadingSlice(pReloc, &pValue->heading);
+	}
+	if (pValue->m.positionPresent)
+	{
+		sReloc_FullPositionVector(pReloc, &pValue->position);
+	}
+	if (pValue->m.furtherInfoIDPresent)
+	{
+		sReloc_FurtherInfoID(pReloc, &pValue->furtherInfoID);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_RoadSideAlert(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RoadSideAlert *pA = (const RoadSideAlert *)pvA;
+	const RoadSideAlert *pB = (const RoadSideAlert *)pvB;
+	int ret = 0;
+
+	if (pA->msgCnt != pB->msgCnt) ASN_DEEP_DIFFER("msgCnt")
+	if (pA->m.timeStampPresent != pB->m.timeStampPresent) ASN_DEEP_DIFFER("timeStamp")
+	else if (pA->m.timeStampPresent)
+	{
+		if (pA->timeStamp != pB->timeStamp) ASN_DEEP_DIFFER("timeStamp")
+	}
+	if (pA->typeEvent != pB->typeEvent) ASN_DEEP_DIFFER("typeEvent")
+	if (pA->m.descriptionPresent != pB->m.descriptionPresent) ASN_DEEP_DIFFER("description")
+	else if (pA->m.descriptionPresent)
+	{
+		ASN_DEEP_INTO("description", sCmp_RoadSideAlert_description(pDiff, &pA->description, &pB->description))
+	}
+	if (pA->m.priorityPresent != pB->m.priorityPresent) ASN_DEEP_DIFFER("priority")
+	else if (pA->m.priorityPresent)
+	{
+		ASN_DEEP_INTO("priority", sCmp_Priority(pDiff, &pA->priority, &pB->priority))
+	}
+	if (pA->m.headingPresent != pB->m.headingPresent) ASN_DEEP_DIFFER("heading")
+	else if (pA->m.headingPresent)
+	{
+		ASN_DEEP_INTO("heading", sCmp_HeadingSlice(pDiff, &pA->heading, &pB->heading))
+	}
+	if (pA->m.extentPresent != pB->m.extentPresent) ASN_DEEP_DIFFER("extent")
+	else if (pA->m.extentPresent)
+	{
+		if (pA->extent != pB->extent) ASN_DEEP_DIFFER("extent")
+	}
+	if (pA->m.positionPresent != pB->m.positionPresent) ASN_DEEP_DIFFER("position")
+	else if (pA->m.positionPresent)
+	{
+		ASN_DEEP_INTO("position", sCmp_FullPositionVector(pDiff, &pA->position, &pB->position))
+	}
+	if (pA->m.furtherInfoIDPresent != pB->m.furtherInfoIDPresent) ASN_DEEP_DIFFER("furtherInfoID")
+	else if (pA->m.furtherInfoIDPresent)
+	{
+		ASN_DEEP_INTO("furtherInfoID", sCmp_FurtherInfoID(pDiff, &pA->furtherInfoID, &pB->furtherInfoID))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_PrivilegedEvents(const void *pv)
+{
+	const PrivilegedEvents *pValue = (const PrivilegedEvents *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_PrivilegedEvents(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	PrivilegedEvents *pDst = (PrivilegedEvents *)pvDst;
+	const PrivilegedEvents *pSrc = (const PrivilegedEvents *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_PrivilegedEvents(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	PrivilegedEvents *pValue = (PrivilegedEvents *)pv;
+
+	sReloc_PrivilegedEventFlags(pReloc, &pValue->event);
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_PrivilegedEvents(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PrivilegedEvents *pA = (const PrivilegedEvents *)pvA;
+	const PrivilegedEvents *pB = (const PrivilegedEvents *)pvB;
+	int ret = 0;
+
+	if (pA->sspRights != pB->sspRights) ASN_DEEP_DIFFER("sspRights")
+	ASN_DEEP_INTO("event", sCmp_PrivilegedEventFlags(pDiff, &pA->event, &pB->event))
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_EmergencyDetails(const void *pv)
+{
+	const EmergencyDetails *pValue = (const EmergencyDetails *)pv;
+	size_t size = 0;
+
+	if (pValue->m.eventsPresent)
+	{
+		size += sSize_PrivilegedEvents(&pValue->events);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_EmergencyDetails(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	EmergencyDetails *pDst = (EmergencyDetails *)pvDst;
+	const EmergencyDetails *pSrc = (const EmergencyDetails *)pvSrc;
+
+	if (pSrc->m.eventsPresent)
+	{
+		sCopy_PrivilegedEvents(pArena, &pDst->events, &pSrc->events);
+	}
+	else
+	{
+		memset(&pDst->events, 0x00, sizeof(pDst->events));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_EmergencyDetails(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	EmergencyDetails *pValue = (EmergencyDetails *)pv;
+
+	if (pValue->m.eventsPresent)
+	{
+		sReloc_PrivilegedEvents(pReloc, &pValue->events);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_EmergencyDetails(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const EmergencyDetails *pA = (const EmergencyDetails *)pvA;
+	const EmergencyDetails *pB = (const EmergencyDetails *)pvB;
+	int ret = 0;
+
+	if (pA->sspRights != pB->sspRights) ASN_DEEP_DIFFER("sspRights")
+	if (pA->sirenUse != pB->sirenUse) ASN_DEEP_DIFFER("sirenUse")
+	if (pA->lightsUse != pB->lightsUse) ASN_DEEP_DIFFER("lightsUse")
+	if (pA->multi != pB->multi) ASN_DEEP_DIFFER("multi")
+	if (pA->m.eventsPresent != pB->m.eventsPresent) ASN_DEEP_DIFFER("events")
+	else if (pA->m.eventsPresent)
+	{
+		ASN_DEEP_INTO("events", sCmp_PrivilegedEvents(pDiff, &pA->events, &pB->events))
+	}
+	if (pA->m.responseTypePresent != pB->m.responseTypePresent) ASN_DEEP_DIFFER("responseType")
+	else if (pA->m.responseTypePresent)
+	{
+		if (pA->responseType != pB->responseType) ASN_DEEP_DIFFER("responseType")
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_EmergencyVehicleAlert(const void *pv)
+{
+	const EmergencyVehicleAlert *pValue = (const EmergencyVehicleAlert *)pv;
+	size_t size = 0;
+
+	size += sSize_RoadSideAlert(&pValue->rsaMsg);
+	if (pValue->m.detailsPresent)
+	{
+		size += sSize_EmergencyDetails(&pValue->details);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_EmergencyVehicleAlert(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	EmergencyVehicleAlert *pDst = (EmergencyVehicleAlert *)pvDst;
+	const EmergencyVehicleAlert *pSrc = (const EmergencyVehicleAlert *)pvSrc;
+
+	sCopy_RoadSideAlert(pArena, &pDst->rsaMsg, &pSrc->rsaMsg);
+	if (pSrc->m.detailsPresent)
+	{
+		sCopy_EmergencyDetails(pArena, &pDst->details, &pSrc->details);
+	}
+	else
+	{
+		memset(&pDst->details, 0x00, sizeof(pDst->details));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_EmergencyVehicleAlert(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	EmergencyVehicleAlert *pValue = (EmergencyVehicleAlert *)pv;
+
+	if (pValue->m.idPresent)
+	{
+		sReloc_TemporaryID(pReloc, &pValue->id);
+	}
+	sReloc_RoadSideAlert(pReloc, &pValue->rsaMsg);
+	if (pValue->m.detailsPresent)
+	{
+		sReloc_EmergencyDetails(pReloc, &pValue->details);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_EmergencyVehicleAlert(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const EmergencyVehicleAlert *pA = (const EmergencyVehicleAlert *)pvA;
+	const EmergencyVehicleAlert *pB = (const EmergencyVehicleAlert *)pvB;
+	int ret = 0;
+
+	if (pA->m.timeStampPresent != pB->m.timeStampPresent) ASN_DEEP_DIFFER("timeStamp")
+	else if (pA->m.timeStampPresent)
+	{
+		if (pA->timeStamp != pB->timeStamp) ASN_DEEP_DIFFER("timeStamp")
+	}
+	if (pA->m.idPresent != pB->m.idPresent) ASN_DEEP_DIFFER("id")
+	else if (pA->m.idPresent)
+	{
+		ASN_DEEP_INTO("id", sCmp_TemporaryID(pDiff, &pA->id, &pB->id))
+	}
+	ASN_DEEP_INTO("rsaMsg", sCmp_RoadSideAlert(pDiff, &pA->rsaMsg, &pB->rsaMsg))
+	if (pA->m.responseTypePresent != pB->m.responseTypePresent) ASN_DEEP_DIFFER("responseType")
+	else if (pA->m.responseTypePresent)
+	{
+		if (pA->responseType != pB->responseType) ASN_DEEP_DIFFER("responseType")
+	}
+	if (pA->m.detailsPresent != pB->m.detailsPresent) ASN_DEEP_DIFFER("details")
+	else if (pA->m.detailsPresent)
+	{
+		ASN_DEEP_INTO("details", sCmp_EmergencyDetails(pDiff, &pA->details, &pB->details))
+	}
+	if (pA->m.massPresent != pB->m.massPresent) ASN_DEEP_DIFFER("mass")
+	else if (pA->m.massPresent)
+	{
+		if (pA->mass != pB->mass) ASN_DEEP_DIFFER("mass")
+	}
+	if (pA->m.basicTypePresent != pB->m.basicTypePresent) ASN_DEEP_DIFFER("basicType")
+	else if (pA->m.basicTypePresent)
+	{
+		if (pA->basicType != pB->basicType) ASN_DEEP_DIFFER("basicType")
+	}
+	if (pA->m.vehicleTypePresent != pB->m.vehicleTypePresent) ASN_DEEP_DIFFER("vehicleType")
+	else if (pA->m.vehicleTypePresent)
+	{
+		if (pA->vehicleType != pB->vehicleType) ASN_DEEP_DIFFER("vehicleType")
+	}
+	if (pA->m.responseEquipPresent != pB->m.responseEquipPresent) ASN_DEEP_DIFFER("responseEquip")
+	else if (pA->m.responseEquipPresent)
+	{
+		if (pA->responseEquip != pB->responseEquip) ASN_DEEP_DIFFER("responseEquip")
+	}
+	if (pA->m.responderTypePresent != pB->m.responderTypePresent) ASN_DEEP_DIFFER("responderType")
+	else if (pA->m.responderTypePresent)
+	{
+		if (pA->responderType != pB->responderType) ASN_DEEP_DIFFER("responderType")
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_PathHistoryPoint(const void *pv)
+{
+	const PathHistoryPoint *pValue = (const PathHistoryPoint *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_PathHistoryPoint(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	PathHistoryPoint *pDst = (PathHistoryPoint *)pvDst;
+	const PathHistoryPoint *pSrc = (const PathHistoryPoint *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_PathHistoryPoint(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	PathHistoryPoint *pValue = (PathHistoryPoint *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_PathHistoryPoint(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PathHistoryPoint *pA = (const PathHistoryPoint *)pvA;
+	const PathHistoryPoint *pB = (const PathHistoryPoint *)pvB;
+	int ret = 0;
+
+	if (pA->latOffset != pB->latOffset) ASN_DEEP_DIFFER("latOffset")
+	if (pA->lonOffset != pB->lonOffset) ASN_DEEP_DIFFER("lonOffset")
+	if (pA->elevationOffset != pB->elevationOffset) ASN_DEEP_DIFFER("elevationOffset")
+	if (pA->timeOffset != pB->timeOffset) ASN_DEEP_DIFFER("timeOffset")
+	if (pA->m.speedPresent != pB->m.speedPresent) ASN_DEEP_DIFFER("speed")
+	else if (pA->m.speedPresent)
+	{
+		if (pA->speed != pB->speed) ASN_DEEP_DIFFER("speed")
+	}
+	if (pA->m.posAccuracyPresent != pB->m.posAccuracyPresent) ASN_DEEP_DIFFER("posAccuracy")
+	else if (pA->m.posAccuracyPresent)
+	{
+		ASN_DEEP_INTO("posAccuracy", sCmp_PositionalAccuracy(pDiff, &pA->posAccuracy, &pB->posAccuracy))
+	}
+	if (pA->m.headingPresent != pB->m.headingPresent) ASN_DEEP_DIFFER("heading")
+	else if (pA->m.headingPresent)
+	{
+		if (pA->heading != pB->heading) ASN_DEEP_DIFFER("heading")
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_PathHistory(const void *pv)
+{
+	const PathHistory *pValue = (const PathHistory *)pv;
+	size_t size = 0;
+
+	if (pValue->m.initialPositionPresent)
+	{
+		size += sSize_FullPositionVector(&pValue->initialPosition);
+	}
+	size += AsnDeep_SizeList(&pValue->crumbData, sizeof(PathHistoryPoint), sSize_PathHistoryPoint);
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_PathHistory(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	PathHistory *pDst = (PathHistory *)pvDst;
+	const PathHistory *pSrc = (const PathHistory *)pvSrc;
+
+	if (pSrc->m.initialPositionPresent)
+	{
+		sCopy_FullPositionVector(pArena, &pDst->initialPosition, &pSrc->initialPosition);
+	}
+	else
+	{
+		memset(&pDst->initialPosition, 0x00, sizeof(pDst->initialPosition));
+	}
+	AsnDeep_CopyList(pArena, &pDst->crumbData, &pSrc->crumbData, sizeof(PathHistoryPoint), sCopy_PathHistoryPoint);
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_PathHistory(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	PathHistory *pValue = (PathHistory *)pv;
+
+	if (pValue->m.initialPositionPresent)
+	{
+		sReloc_FullPositionVector(pReloc, &pValue->initialPosition);
+	}
+	if (pValue->m.currGNSSstatusPresent)
+	{
+		sReloc_GNSSstatus(pReloc, &pValue->currGNSSstatus);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->crumbData, sizeof(PathHistoryPoint), sReloc_PathHistoryPoint);
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_PathHistory(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PathHistory *pA = (const PathHistory *)pvA;
+	const PathHistory *pB = (const PathHistory *)pvB;
+	int ret = 0;
+
+	if (pA->m.initialPositionPresent != pB->m.initialPositionPresent) ASN_DEEP_DIFFER("initialPosition")
+	else if (pA->m.initialPositionPresent)
+	{
+		ASN_DEEP_INTO("initialPosition", sCmp_FullPositionVector(pDiff, &pA->initialPosition, &pB->initialPosition))
+	}
+	if (pA->m.currGNSSstatusPresent != pB->m.currGNSSstatusPresent) ASN_DEEP_DIFFER("currGNSSstatus")
+	else if (pA->m.currGNSSstatusPresent)
+	{
+		ASN_DEEP_INTO("currGNSSstatus", sCmp_GNSSstatus(pDiff, &pA->currGNSSstatus, &pB->currGNSSstatus))
+	}
+	ASN_DEEP_INTO("crumbData", AsnDeep_CmpList(pDiff, &pA->crumbData, &pB->crumbData, sizeof(PathHistoryPoint), sCmp_PathHistoryPoint))
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_PathPrediction(const void *pv)
+{
+	const PathPrediction *pValue = (const PathPrediction *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_PathPrediction(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	PathPrediction *pDst = (PathPrediction *)pvDst;
+	const PathPrediction *pSrc = (const PathPrediction *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_PathPrediction(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	PathPrediction *pValue = (PathPrediction *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_PathPrediction(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PathPrediction *pA = (const PathPrediction *)pvA;
+	const PathPrediction *pB = (const PathPrediction *)pvB;
+	int ret = 0;
+
+	if (pA->radiusOfCurve != pB->radiusOfCurve) ASN_DEEP_DIFFER("radiusOfCurve")
+	if (pA->confidence != pB->confidence) ASN_DEEP_DIFFER("confidence")
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static int sCmp_IntersectionReferenceID(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const IntersectionReferenceID *pA = (const IntersectionReferenceID *)pvA;
+	const IntersectionReferenceID *pB = (const IntersectionReferenceID *)pvB;
+	int ret = 0;
+
+	if (pA->m.regionPresent != pB->m.regionPresent) ASN_DEEP_DIFFER("region")
+	else if (pA->m.regionPresent)
+	{
+		if (pA->region != pB->region) ASN_DEEP_DIFFER("region")
+	}
+	if (pA->id != pB->id) ASN_DEEP_DIFFER("id")
+	return ret;
+}
+
+static int sCmp_ApproachOrLane(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ApproachOrLane *pA = (const ApproachOrLane *)pvA;
+	const ApproachOrLane *pB = (const ApproachOrLane *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			if (pA->u.approach != pB->u.approach) ASN_DEEP_DIFFER("approach")
+			break;
+		case 2:
+			if (pA->u.lane != pB->u.lane) ASN_DEEP_DIFFER("lane")
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_IntersectionCollision(const void *pv)
+{
+	const IntersectionCollision *pValue = (const IntersectionCollision *)pv;
+	size_t size = 0;
+
+	if (pValue->m.pathPresent)
+	{
+		size += sSize_PathHistory(&pValue->path);
+	}
+	if (pValue->m.pathPredictionPresent)
+	{
+		size += sSize_PathPrediction(&pValue->pathPrediction);
+	}
+	size += sSize_VehicleEventFlags(&pValue->eventFlag);
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_IntersectionCollision(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	IntersectionCollision *pDst = (IntersectionCollision *)pvDst;
+	const IntersectionCollision *pSrc = (const IntersectionCollision *)pvSrc;
+
+	if (pSrc->m.pathPresent)
+	{
+		sCopy_PathHistory(pArena, &pDst->path, &pSrc->path);
+	}
+	else
+	{
+		memset(&pDst->path, 0x00, sizeof(pDst->path));
+	}
+	if (pSrc->m.pathPredictionPresent)
+	{
+		sCopy_PathPrediction(pArena, &pDst->pathPrediction, &pSrc->pathPrediction);
+	}
+	else
+	{
+		memset(&pDst->pathPrediction, 0x00, sizeof(pDst->pathPrediction));
+	}
+	sCopy_VehicleEventFlags(pArena, &pDst->eventFlag, &pSrc->eventFlag);
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_IntersectionCollision(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	IntersectionCollision *pValue = (IntersectionCollision *)pv;
+
+	sReloc_TemporaryID(pReloc, &pValue->id);
+	if (pValue->m.partOnePresent)
+	{
+		sReloc_BSMcoreData(pReloc, &pValue->partOne);
+	}
+	if (pValue->m.pathPresent)
+	{
+		sReloc_PathHistory(pReloc, &pValue->path);
+	}
+	if (pValue->m.pathPredictionPresent)
+	{
+		sReloc_PathPrediction(pReloc, &pValue->pathPrediction);
+	}
+	sReloc_VehicleEventFlags(pReloc, &pValue->eventFlag);
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_IntersectionCollision(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const IntersectionCollision *pA = (const IntersectionCollision *)pvA;
+	const IntersectionCollision *pB = (const IntersectionCollision *)pvB;
+	int ret = 0;
+
+	if (pA->msgCnt != pB->msgCnt) ASN_DEEP_DIFFER("msgCnt")
+	ASN_DEEP_INTO("id", sCmp_TemporaryID(pDiff, &pA->id, &pB->id))
+	if (pA->m.timeStampPresent != pB->m.timeStampPresent) ASN_DEEP_DIFFER("timeStamp")
+	else if (pA->m.timeStampPresent)
+	{
+		if (pA->timeStamp != pB->timeStamp) ASN_DEEP_DIFFER("timeStamp")
+	}
+	if (pA->m.partOnePresent != pB->m.partOnePresent) ASN_DEEP_DIFFER("partOne")
+	else if (pA->m.partOnePresent)
+	{
+		ASN_DEEP_INTO("partOne", sCmp_BSMcoreData(pDiff, &pA->partOne, &pB->partOne))
+	}
+	if (pA->m.pathPresent != pB->m.pathPresent) ASN_DEEP_DIFFER("path")
+	else if (pA->m.pathPresent)
+	{
+		ASN_DEEP_INTO("path", sCmp_PathHistory(pDiff, &pA->path, &pB->path))
+	}
+	if (pA->m.pathPredictionPresent != pB->m.pathPredictionPresent) ASN_DEEP_DIFFER("pathPrediction")
+	else if (pA->m.pathPredictionPresent)
+	{
+		ASN_DEEP_INTO("pathPrediction", sCmp_PathPrediction(pDiff, &pA->pathPrediction, &pB->pathPrediction))
+	}
+	ASN_DEEP_INTO("intersectionID", sCmp_IntersectionReferenceID(pDiff, &pA->intersectionID, &pB->intersectionID))
+	ASN_DEEP_INTO("laneNumber", sCmp_ApproachOrLane(pDiff, &pA->laneNumber, &pB->laneNumber))
+	ASN_DEEP_INTO("eventFlag", sCmp_VehicleEventFlags(pDiff, &pA->eventFlag, &pB->eventFlag))
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_Position3D(const void *pv)
+{
+	const Position3D *pValue = (const Position3D *)pv;
+	size_t size = 0;
+
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_Position3D(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	Position3D *pDst = (Position3D *)pvDst;
+	const Position3D *pSrc = (const Position3D *)pvSrc;
+
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_Position3D(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	Position3D *pValue = (Position3D *)pv;
+
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_Position3D(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Position3D *pA = (const Position3D *)pvA;
+	const Position3D *pB = (const Position3D *)pvB;
+	int ret = 0;
+
+	if (pA->lat != pB->lat) ASN_DEEP_DIFFER("lat")
+	if (pA->long_ != pB->long_) ASN_DEEP_DIFFER("long_")
+	if (pA->m.elevationPresent != pB->m.elevationPresent) ASN_DEEP_DIFFER("elevation")
+	else if (pA->m.elevationPresent)
+	{
+		if (pA->elevation != pB->elevation) ASN_DEEP_DIFFER("elevation")
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static int sCmp_RegulatorySpeedLimit(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RegulatorySpeedLimit *pA = (const RegulatorySpeedLimit *)pvA;
+	const RegulatorySpeedLimit *pB = (const RegulatorySpeedLimit *)pvB;
+	int ret = 0;
+
+	if (pA->type != pB->type) ASN_DEEP_DIFFER("type")
+	if (pA->speed != pB->speed) ASN_DEEP_DIFFER("speed")
+	return ret;
+}
+
+static size_t sSize_LaneTypeAttributes(const void *pv)
+{
+	const LaneTypeAttributes *pValue = (const LaneTypeAttributes *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 1:
+			size += AsnDeep_SizePtr(pValue->u.vehicle, sizeof(*pValue->u.vehicle), sSize_LaneAttributes_Vehicle);
+			break;
+		case 2:
+			size += AsnDeep_SizePtr(pValue->u.crosswalk, sizeof(*pValue->u.crosswalk), HAE_NULL);
+			break;
+		case 3:
+			size += AsnDeep_SizePtr(pValue->u.bikeLane, sizeof(*pValue->u.bikeLane), HAE_NULL);
+			break;
+		case 4:
+			size += AsnDeep_SizePtr(pValue->u.sidewalk, sizeof(*pValue->u.sidewalk), HAE_NULL);
+			break;
+		case 5:
+			size += AsnDeep_SizePtr(pValue->u.median, sizeof(*pValue->u.median), HAE_NULL);
+			break;
+		case 6:
+			size += AsnDeep_SizePtr(pValue->u.striping, sizeof(*pValue->u.striping), HAE_NULL);
+			break;
+		case 7:
+			size += AsnDeep_SizePtr(pValue->u.trackedVehicle, sizeof(*pValue->u.trackedVehicle), HAE_NULL);
+			break;
+		case 8:
+			size += AsnDeep_SizePtr(pValue->u.parking, sizeof(*pValue->u.parking), HAE_NULL);
+			break;
+		case 9:
+			size += AsnDeep_SizePtr(pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_SizeOpen);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_LaneTypeAttributes(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	LaneTypeAttributes *pDst = (LaneTypeAttributes *)pvDst;
+	const LaneTypeAttributes *pSrc = (const LaneTypeAttributes *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 1:
+			pDst->u.vehicle = AsnDeep_CopyPtr(pArena, pSrc->u.vehicle, sizeof(*pSrc->u.vehicle), sCopy_LaneAttributes_Vehicle);
+			break;
+		case 2:
+			pDst->u.crosswalk = AsnDeep_CopyPtr(pArena, pSrc->u.crosswalk, sizeof(*pSrc->u.crosswalk), HAE_NULL);
+			break;
+		case 3:
+			pDst->u.bikeLane = AsnDeep_CopyPtr(pArena, pSrc->u.bikeLane, sizeof(*pSrc->u.bikeLane), HAE_NULL);
+			break;
+		case 4:
+			pDst->u.sidewalk = AsnDeep_CopyPtr(pArena, pSrc->u.sidewalk, sizeof(*pSrc->u.sidewalk), HAE_NULL);
+			break;
+		case 5:
+			pDst->u.median = AsnDeep_CopyPtr(pArena, pSrc->u.median, sizeof(*pSrc->u.median), HAE_NULL);
+			break;
+		case 6:
+			pDst->u.striping = AsnDeep_CopyPtr(pArena, pSrc->u.striping, sizeof(*pSrc->u.striping), HAE_NULL);
+			break;
+		case 7:
+			pDst->u.trackedVehicle = AsnDeep_CopyPtr(pArena, pSrc->u.trackedVehicle, sizeof(*pSrc->u.trackedVehicle), HAE_NULL);
+			break;
+		case 8:
+			pDst->u.parking = AsnDeep_CopyPtr(pArena, pSrc->u.parking, sizeof(*pSrc->u.parking), HAE_NULL);
+			break;
+		case 9:
+			pDst->u.extElem1 = AsnDeep_CopyPtr(pArena, pSrc->u.extElem1, sizeof(*pSrc->u.extElem1), AsnDeep_CopyOpen);
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_LaneTypeAttributes(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	LaneTypeAttributes *pValue = (LaneTypeAttributes *)pv;
+
+	switch (pValue->t)
+	{
+		case 1:
+			AsnDeep_RelocObj(pReloc, &pValue->u.vehicle, sizeof(*pValue->u.vehicle), sReloc_LaneAttributes_Vehicle);
+			break;
+		case 2:
+			AsnDeep_RelocObj(pReloc, &pValue->u.crosswalk, sizeof(*pValue->u.crosswalk), sReloc_LaneAttributes_Crosswalk);
+			break;
+		case 3:
+			AsnDeep_RelocObj(pReloc, &pValue->u.bikeLane, sizeof(*pValue->u.bikeLane), sReloc_LaneAttributes_Bike);
+			break;
+		case 4:
+			AsnDeep_RelocObj(pReloc, &pValue->u.sidewalk, sizeof(*pValue->u.sidewalk), sReloc_LaneAttributes_Sidewalk);
+			break;
+		case 5:
+			AsnDeep_RelocObj(pReloc, &pValue->u.median, sizeof(*pValue->u.median), sReloc_LaneAttributes_Barrier);
+			break;
+		case 6:
+			AsnDeep_RelocObj(pReloc, &pValue->u.striping, sizeof(*pValue->u.striping), sReloc_LaneAttributes_Striping);
+			break;
+		case 7:
+			AsnDeep_RelocObj(pReloc, &pValue->u.trackedVehicle, sizeof(*pValue->u.trackedVehicle), sReloc_LaneAttributes_TrackedVehicle);
+			break;
+		case 8:
+			AsnDeep_RelocObj(pReloc, &pValue->u.parking, sizeof(*pValue->u.parking), sReloc_LaneAttributes_Parking);
+			break;
+		case 9:
+			AsnDeep_RelocObj(pReloc, &pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_RelocOpen);
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_LaneTypeAttributes(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const LaneTypeAttributes *pA = (const LaneTypeAttributes *)pvA;
+	const LaneTypeAttributes *pB = (const LaneTypeAttributes *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			ASN_DEEP_INTO("vehicle", AsnDeep_CmpPtr(pDiff, pA->u.vehicle, pB->u.vehicle, sizeof(*pA->u.vehicle), sCmp_LaneAttributes_Vehicle))
+			break;
+		case 2:
+			ASN_DEEP_INTO("crosswalk", AsnDeep_CmpPtr(pDiff, pA->u.crosswalk, pB->u.crosswalk, sizeof(*pA->u.crosswalk), sCmp_LaneAttributes_Crosswalk))
+			break;
+		case 3:
+			ASN_DEEP_INTO("bikeLane", AsnDeep_CmpPtr(pDiff, pA->u.bikeLane, pB->u.bikeLane, sizeof(*pA->u.bikeLane), sCmp_LaneAttributes_Bike))
+			break;
+		case 4:
+			ASN_DEEP_INTO("sidewalk", AsnDeep_CmpPtr(pDiff, pA->u.sidewalk, pB->u.sidewalk, sizeof(*pA->u.sidewalk), sCmp_LaneAttributes_Sidewalk))
+			break;
+		case 5:
+			ASN_DEEP_INTO("median", AsnDeep_CmpPtr(pDiff, pA->u.median, pB->u.median, sizeof(*pA->u.median), sCmp_LaneAttributes_Barrier))
+			break;
+		case 6:
+			ASN_DEEP_INTO("striping", AsnDeep_CmpPtr(pDiff, pA->u.striping, pB->u.striping, sizeof(*pA->u.striping), sCmp_LaneAttributes_Striping))
+			break;
+		case 7:
+			ASN_DEEP_INTO("trackedVehicle", AsnDeep_CmpPtr(pDiff, pA->u.trackedVehicle, pB->u.trackedVehicle, sizeof(*pA->u.trackedVehicle), sCmp_LaneAttributes_TrackedVehicle))
+			break;
+		case 8:
+			ASN_DEEP_INTO("parking", AsnDeep_CmpPtr(pDiff, pA->u.parking, pB->u.parking, sizeof(*pA->u.parking), sCmp_LaneAttributes_Parking))
+			break;
+		case 9:
+			ASN_DEEP_INTO("extElem1", AsnDeep_CmpPtr(pDiff, pA->u.extElem1, pB->u.extElem1, sizeof(*pA->u.extElem1), AsnDeep_CmpOpen))
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_LaneAttributes(const void *pv)
+{
+	const LaneAttributes *pValue = (const LaneAttributes *)pv;
+	size_t size = 0;
+
+	size += sSize_LaneTypeAttributes(&pValue->laneType);
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	return size;
+}
+
+static void sCopy_LaneAttributes(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	LaneAttributes *pDst = (LaneAttributes *)pvDst;
+	const LaneAttributes *pSrc = (const LaneAttributes *)pvSrc;
+
+	sCopy_LaneTypeAttributes(pArena, &pDst->laneType, &pSrc->laneType);
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+}
+
+static void sReloc_LaneAttributes(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	LaneAttributes *pValue = (LaneAttributes *)pv;
+
+	sReloc_LaneDirection(pReloc, &pValue->directionalUse);
+	sReloc_LaneSharing(pReloc, &pValue->sharedWith);
+	sReloc_LaneTypeAttributes(pReloc, &pValue->laneType);
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+}
+
+static int sCmp_LaneAttributes(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const LaneAttributes *pA = (const LaneAttributes *)pvA;
+	const LaneAttributes *pB = (const LaneAttributes *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("directionalUse", sCmp_LaneDirection(pDiff, &pA->directionalUse, &pB->directionalUse))
+	ASN_DEEP_INTO("sharedWith", sCmp_LaneSharing(pDiff, &pA->sharedWith, &pB->sharedWith))
+	ASN_DEEP_INTO("laneType", sCmp_LaneTypeAttributes(pDiff, &pA->laneType, &pB->laneType))
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	return ret;
+}
+
+static int sCmp_Node_XY_20b(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Node_XY_20b *pA = (const Node_XY_20b *)pvA;
+	const Node_XY_20b *pB = (const Node_XY_20b *)pvB;
+	int ret = 0;
+
+	if (pA->x != pB->x) ASN_DEEP_DIFFER("x")
+	if (pA->y != pB->y) ASN_DEEP_DIFFER("y")
+	return ret;
+}
+
+static int sCmp_Node_XY_22b(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Node_XY_22b *pA = (const Node_XY_22b *)pvA;
+	const Node_XY_22b *pB = (const Node_XY_22b *)pvB;
+	int ret = 0;
+
+	if (pA->x != pB->x) ASN_DEEP_DIFFER("x")
+	if (pA->y != pB->y) ASN_DEEP_DIFFER("y")
+	return ret;
+}
+
+static int sCmp_Node_XY_24b(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Node_XY_24b *pA = (const Node_XY_24b *)pvA;
+	const Node_XY_24b *pB = (const Node_XY_24b *)pvB;
+	int ret = 0;
+
+	if (pA->x != pB->x) ASN_DEEP_DIFFER("x")
+	if (pA->y != pB->y) ASN_DEEP_DIFFER("y")
+	return ret;
+}
+
+static int sCmp_Node_XY_26b(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Node_XY_26b *pA = (const Node_XY_26b *)pvA;
+	const Node_XY_26b *pB = (const Node_XY_26b *)pvB;
+	int ret = 0;
+
+	if (pA->x != pB->x) ASN_DEEP_DIFFER("x")
+	if (pA->y != pB->y) ASN_DEEP_DIFFER("y")
+	return ret;
+}
+
+static int sCmp_Node_XY_28b(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Node_XY_28b *pA = (const Node_XY_28b *)pvA;
+	const Node_XY_28b *pB = (const Node_XY_28b *)pvB;
+	int ret = 0;
+
+	if (pA->x != pB->x) ASN_DEEP_DIFFER("x")
+	if (pA->y != pB->y) ASN_DEEP_DIFFER("y")
+	return ret;
+}
+
+static int sCmp_Node_XY_32b(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Node_XY_32b *pA = (const Node_XY_32b *)pvA;
+	const Node_XY_32b *pB = (const Node_XY_32b *)pvB;
+	int ret = 0;
+
+	if (pA->x != pB->x) ASN_DEEP_DIFFER("x")
+	if (pA->y != pB->y) ASN_DEEP_DIFFER("y")
+	return ret;
+}
+
+static int sCmp_Node_LLmD_64b(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Node_LLmD_64b *pA = (const Node_LLmD_64b *)pvA;
+	const Node_LLmD_64b *pB = (const Node_LLmD_64b *)pvB;
+	int ret = 0;
+
+	if (pA->lon != pB->lon) ASN_DEEP_DIFFER("lon")
+	if (pA->lat != pB->lat) ASN_DEEP_DIFFER("lat")
+	return ret;
+}
+
+static size_t sSize_NodeOffsetPointXY(const void *pv)
+{
+	const NodeOffsetPointXY *pValue = (const NodeOffsetPointXY *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 1:
+			size += AsnDeep_SizePtr(pValue->u.node_XY1, sizeof(*pValue->u.node_XY1), HAE_NULL);
+			break;
+		case 2:
+			size += AsnDeep_SizePtr(pValue->u.node_XY2, sizeof(*pValue->u.node_XY2), HAE_NULL);
+			break;
+		case 3:
+			size += AsnDeep_SizePtr(pValue->u.node_XY3, sizeof(*pValue->u.node_XY3), HAE_NULL);
+			break;
+		case 4:
+			size += AsnDeep_SizePtr(pValue->u.node_XY4, sizeof(*pValue->u.node_XY4), HAE_NULL);
+			break;
+		case 5:
+			size += AsnDeep_SizePtr(pValue->u.node_XY5, sizeof(*pValue->u.node_XY5), HAE_NULL);
+			break;
+		case 6:
+			size += AsnDeep_SizePtr(pValue->u.node_XY6, sizeof(*pValue->u.node_XY6), HAE_NULL);
+			break;
+		case 7:
+			size += AsnDeep_SizePtr(pValue->u.node_LatLon, sizeof(*pValue->u.node_LatLon), HAE_NULL);
+			break;
+		case 8:
+			size += AsnDeep_SizePtr(pValue->u.regional, sizeof(*pValue->u.regional), sSize_RegionalExtension);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_NodeOffsetPointXY(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	NodeOffsetPointXY *pDst = (NodeOffsetPointXY *)pvDst;
+	const NodeOffsetPointXY *pSrc = (const NodeOffsetPointXY *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 1:
+			pDst->u.node_XY1 = AsnDeep_CopyPtr(pArena, pSrc->u.node_XY1, sizeof(*pSrc->u.node_XY1), HAE_NULL);
+			break;
+		case 2:
+			pDst->u.node_XY2 = AsnDeep_CopyPtr(pArena, pSrc->u.node_XY2, sizeof(*pSrc->u.node_XY2), HAE_NULL);
+			break;
+		case 3:
+			pDst->u.node_XY3 = AsnDeep_CopyPtr(pArena, pSrc->u.node_XY3, sizeof(*pSrc->u.node_XY3), HAE_NULL);
+			break;
+		case 4:
+			pDst->u.node_XY4 = AsnDeep_CopyPtr(pArena, pSrc->u.node_XY4, sizeof(*pSrc->u.node_XY4), HAE_NULL);
+			break;
+		case 5:
+			pDst->u.node_XY5 = AsnDeep_CopyPtr(pArena, pSrc->u.node_XY5, sizeof(*pSrc->u.node_XY5), HAE_NULL);
+			break;
+		case 6:
+			pDst->u.node_XY6 = AsnDeep_CopyPtr(pArena, pSrc->u.node_XY6, sizeof(*pSrc->u.node_XY6), HAE_NULL);
+			break;
+		case 7:
+			pDst->u.node_LatLon = AsnDeep_CopyPtr(pArena, pSrc->u.node_LatLon, sizeof(*pSrc->u.node_LatLon), HAE_NULL);
+			break;
+		case 8:
+			pDst->u.regional = AsnDeep_CopyPtr(pArena, pSrc->u.regional, sizeof(*pSrc->u.regional), sCopy_RegionalExtension);
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_NodeOffsetPointXY(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	NodeOffsetPointXY *pValue = (NodeOffsetPointXY *)pv;
+
+	switch (pValue->t)
+	{
+		case 1:
+			AsnDeep_RelocObj(pReloc, &pValue->u.node_XY1, sizeof(*pValue->u.node_XY1), HAE_NULL);
+			break;
+		case 2:
+			AsnDeep_RelocObj(pReloc, &pValue->u.node_XY2, sizeof(*pValue->u.node_XY2), HAE_NULL);
+			break;
+		case 3:
+			AsnDeep_RelocObj(pReloc, &pValue->u.node_XY3, sizeof(*pValue->u.node_XY3), HAE_NULL);
+			break;
+		case 4:
+			AsnDeep_RelocObj(pReloc, &pValue->u.node_XY4, sizeof(*pValue->u.node_XY4), HAE_NULL);
+			break;
+		case 5:
+			AsnDeep_RelocObj(pReloc, &pValue->u.node_XY5, sizeof(*pValue->u.node_XY5), HAE_NULL);
+			break;
+		case 6:
+			AsnDeep_RelocObj(pReloc, &pValue->u.node_XY6, sizeof(*pValue->u.node_XY6), HAE_NULL);
+			break;
+		case 7:
+			AsnDeep_RelocObj(pReloc, &pValue->u.node_LatLon, sizeof(*pValue->u.node_LatLon), HAE_NULL);
+			break;
+		case 8:
+			AsnDeep_RelocObj(pReloc, &pValue->u.regional, sizeof(*pValue->u.regional), sReloc_RegionalExtension);
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_NodeOffsetPointXY(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const NodeOffsetPointXY *pA = (const NodeOffsetPointXY *)pvA;
+	const NodeOffsetPointXY *pB = (const NodeOffsetPointXY *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			ASN_DEEP_INTO("node_XY1", AsnDeep_CmpPtr(pDiff, pA->u.node_XY1, pB->u.node_XY1, sizeof(*pA->u.node_XY1), sCmp_Node_XY_20b))
+			break;
+		case 2:
+			ASN_DEEP_INTO("node_XY2", AsnDeep_CmpPtr(pDiff, pA->u.node_XY2, pB->u.node_XY2, sizeof(*pA->u.node_XY2), sCmp_Node_XY_22b))
+			break;
+		case 3:
+			ASN_DEEP_INTO("node_XY3", AsnDeep_CmpPtr(pDiff, pA->u.node_XY3, pB->u.node_XY3, sizeof(*pA->u.node_XY3), sCmp_Node_XY_24b))
+			break;
+		case 4:
+			ASN_DEEP_INTO("node_XY4", AsnDeep_CmpPtr(pDiff, pA->u.node_XY4, pB->u.node_XY4, sizeof(*pA->u.node_XY4), sCmp_Node_XY_26b))
+			break;
+		case 5:
+			ASN_DEEP_INTO("node_XY5", AsnDeep_CmpPtr(pDiff, pA->u.node_XY5, pB->u.node_XY5, sizeof(*pA->u.node_XY5), sCmp_Node_XY_28b))
+			break;
+		case 6:
+			ASN_DEEP_INTO("node_XY6", AsnDeep_CmpPtr(pDiff, pA->u.node_XY6, pB->u.node_XY6, sizeof(*pA->u.node_XY6), sCmp_Node_XY_32b))
+			break;
+		case 7:
+			ASN_DEEP_INTO("node_LatLon", AsnDeep_CmpPtr(pDiff, pA->u.node_LatLon, pB->u.node_LatLon, sizeof(*pA->u.node_LatLon), sCmp_Node_LLmD_64b))
+			break;
+		case 8:
+			ASN_DEEP_INTO("regional", AsnDeep_CmpPtr(pDiff, pA->u.regional, pB->u.regional, sizeof(*pA->u.regional), sCmp_RegionalExtension))
+			break;
+	}
+	return ret;
+}
+
+static void sReloc_NodeAttributeXYList(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	NodeAttributeXYList *pValue = (NodeAttributeXYList *)pv;
+
+	AsnDeep_RelocArray(pReloc, pValue->elem, pValue->n, sizeof(pValue->elem) / sizeof(pValue->elem[0]), sizeof(pValue->elem[0]), HAE_NULL);
+}
+
+static int sCmp_NodeAttributeXYList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const NodeAttributeXYList *pA = (const NodeAttributeXYList *)pvA;
+	const NodeAttributeXYList *pB = (const NodeAttributeXYList *)pvB;
+
+	return AsnDeep_CmpArray(pDiff, pA->elem, pA->n, pB->elem, pB->n, sizeof(pA->elem) / sizeof(pA->elem[0]), sizeof(pA->elem[0]), HAE_NULL);
+}
+
+static void sReloc_SegmentAttributeXYList(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SegmentAttributeXYList *pValue = (SegmentAttributeXYList *)pv;
+
+	AsnDeep_RelocArray(pReloc, pValue->elem, pValue->n, sizeof(pValue->elem) / sizeof(pValue->elem[0]), sizeof(pValue->elem[0]), HAE_NULL);
+}
+
+static int sCmp_SegmentAttributeXYList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SegmentAttributeXYList *pA = (const SegmentAttributeXYList *)pvA;
+	const SegmentAttributeXYList *pB = (const SegmentAttributeXYList *)pvB;
+
+	return AsnDeep_CmpArray(pDiff, pA->elem, pA->n, pB->elem, pB->n, sizeof(pA->elem) / sizeof(pA->elem[0]), sizeof(pA->elem[0]), HAE_NULL);
+}
+
+static size_t sSize_LaneDataAttribute(const void *pv)
+{
+	const LaneDataAttribute *pValue = (const LaneDataAttribute *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 6:
+			size += AsnDeep_SizePtr(pValue->u.speedLimits, sizeof(*pValue->u.speedLimits), sSize_SpeedLimitList);
+			break;
+		case 7:
+			size += AsnDeep_SizePtr(pValue->u.regional, sizeof(*pValue->u.regional), sSize_LaneDataAttribute_regional);
+			break;
+		case 8:
+			size += AsnDeep_SizePtr(pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_SizeOpen);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_LaneDataAttribute(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	LaneDataAttribute *pDst = (LaneDataAttribute *)pvDst;
+	const LaneDataAttribute *pSrc = (const LaneDataAttribute *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 6:
+			pDst->u.speedLimits = AsnDeep_CopyPtr(pArena, pSrc->u.speedLimits, sizeof(*pSrc->u.speedLimits), sCopy_SpeedLimitList);
+			break;
+		case 7:
+			pDst->u.regional = AsnDeep_CopyPtr(pArena, pSrc->u.regional, sizeof(*pSrc->u.regional), sCopy_LaneDataAttribute_regional);
+			break;
+		case 8:
+			pDst->u.extElem1 = AsnDeep_CopyPtr(pArena, pSrc->u.extElem1, sizeof(*pSrc->u.extElem1), AsnDeep_CopyOpen);
+			break;
+		case 1:
+		case 2:
+		case 3:
+		case 4:
+		case 5:
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_LaneDataAttribute(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	LaneDataAttribute *pValue = (LaneDataAttribute *)pv;
+
+	switch (pValue->t)
+	{
+		case 6:
+			AsnDeep_RelocObj(pReloc, &pValue->u.speedLimits, sizeof(*pValue->u.speedLimits), sReloc_SpeedLimitList);
+			break;
+		case 7:
+			AsnDeep_RelocObj(pReloc, &pValue->u.regional, sizeof(*pValue->u.regional), sReloc_LaneDataAttribute_regional);
+			break;
+		case 8:
+			AsnDeep_RelocObj(pReloc, &pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_RelocOpen);
+			break;
+		case 1:
+		case 2:
+		case 3:
+		case 4:
+		case 5:
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_LaneDataAttribute(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const LaneDataAttribute *pA = (const LaneDataAttribute *)pvA;
+	const LaneDataAttribute *pB = (const LaneDataAttribute *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			if (pA->u.pathEndPointAngle != pB->u.pathEndPointAngle) ASN_DEEP_DIFFER("pathEndPointAngle")
+			break;
+		case 2:
+			if (pA->u.laneCrownPointCenter != pB->u.laneCrownPointCenter) ASN_DEEP_DIFFER("laneCrownPointCenter")
+			break;
+		case 3:
+			if (pA->u.laneCrownPointLeft != pB->u.laneCrownPointLeft) ASN_DEEP_DIFFER("laneCrownPointLeft")
+			break;
+		case 4:
+			if (pA->u.laneCrownPointRight != pB->u.laneCrownPointRight) ASN_DEEP_DIFFER("laneCrownPointRight")
+			break;
+		case 5:
+			if (pA->u.laneAngle != pB->u.laneAngle) ASN_DEEP_DIFFER("laneAngle")
+			break;
+		case 6:
+			ASN_DEEP_INTO("speedLimits", AsnDeep_CmpPtr(pDiff, pA->u.speedLimits, pB->u.speedLimits, sizeof(*pA->u.speedLimits), sCmp_SpeedLimitList))
+			break;
+		case 7:
+			ASN_DEEP_INTO("regional", AsnDeep_CmpPtr(pDiff, pA->u.regional, pB->u.regional, sizeof(*pA->u.regional), sCmp_LaneDataAttribute_regional))
+			break;
+		case 8:
+			ASN_DEEP_INTO("extElem1", AsnDeep_CmpPtr(pDiff, pA->u.extElem1, pB->u.extElem1, sizeof(*pA->u.extElem1), AsnDeep_CmpOpen))
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_NodeAttributeSetXY(const void *pv)
+{
+	const NodeAttributeSetXY *pValue = (const NodeAttributeSetXY *)pv;
+	size_t size = 0;
+
+	if (pValue->m.dataPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->data, sizeof(LaneDataAttribute), sSize_LaneDataAttribute);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_NodeAttributeSetXY(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	NodeAttributeSetXY *pDst = (NodeAttributeSetXY *)pvDst;
+	const NodeAttributeSetXY *pSrc = (const NodeAttributeSetXY *)pvSrc;
+
+	if (pSrc->m.dataPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->data, &pSrc->data, sizeof(LaneDataAttribute), sCopy_LaneDataAttribute);
+	}
+	else
+	{
+		memset(&pDst->data, 0x00, sizeof(pDst->data));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_NodeAttributeSetXY(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	NodeAttributeSetXY *pValue = (NodeAttributeSetXY *)pv;
+
+	if (pValue->m.localNodePresent)
+	{
+		sReloc_NodeAttributeXYList(pReloc, &pValue->localNode);
+	}
+	if (pValue->m.disabledPresent)
+	{
+		sReloc_SegmentAttributeXYList(pReloc, &pValue->disabled);
+	}
+	if (pValue->m.enabledPresent)
+	{
+		sReloc_SegmentAttributeXYList(pReloc, &pValue->enabled);
+	}
+	if (pValue->m.dataPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->data, sizeof(LaneDataAttribute), sReloc_LaneDataAttribute);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_NodeAttributeSetXY(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const NodeAttributeSetXY *pA = (const NodeAttributeSetXY *)pvA;
+	const NodeAttributeSetXY *pB = (const NodeAttributeSetXY *)pvB;
+	int ret = 0;
+
+	if (pA->m.localNodePresent != pB->m.localNodePresent) ASN_DEEP_DIFFER("localNode")
+	else if (pA->m.localNodePresent)
+	{
+		ASN_DEEP_INTO("localNode", sCmp_NodeAttributeXYList(pDiff, &pA->localNode, &pB->localNode))
+	}
+	if (pA->m.disabledPresent != pB->m.disabledPresent) ASN_DEEP_DIFFER("disabled")
+	else if (pA->m.disabledPresent)
+	{
+		ASN_DEEP_INTO("disabled", sCmp_SegmentAttributeXYList(pDiff, &pA->disabled, &pB->disabled))
+	}
+	if (pA->m.enabledPresent != pB->m.enabledPresent) ASN_DEEP_DIFFER("enabled")
+	else if (pA->m.enabledPresent)
+	{
+		ASN_DEEP_INTO("enabled", sCmp_SegmentAttributeXYList(pDiff, &pA->enabled, &pB->enabled))
+	}
+	if (pA->m.dataPresent != pB->m.dataPresent) ASN_DEEP_DIFFER("data")
+	else if (pA->m.dataPresent)
+	{
+		ASN_DEEP_INTO("data", AsnDeep_CmpList(pDiff, &pA->data, &pB->data, sizeof(LaneDataAttribute), sCmp_LaneDataAttribute))
+	}
+	if (pA->m.dWidthPresent != pB->m.dWidthPresent) ASN_DEEP_DIFFER("dWidth")
+	else if (pA->m.dWidthPresent)
+	{
+		if (pA->dWidth != pB->dWidth) ASN_DEEP_DIFFER("dWidth")
+	}
+	if (pA->m.dElevationPresent != pB->m.dElevationPresent) ASN_DEEP_DIFFER("dElevation")
+	else if (pA->m.dElevationPresent)
+	{
+		if (pA->dElevation != pB->dElevation) ASN_DEEP_DIFFER("dElevation")
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_NodeXY(const void *pv)
+{
+	const NodeXY *pValue = (const NodeXY *)pv;
+	size_t size = 0;
+
+	size += sSize_NodeOffsetPointXY(&pValue->delta);
+	if (pValue->m.attributesPresent)
+	{
+		size += sSize_NodeAttributeSetXY(&pValue->attributes);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_NodeXY(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	NodeXY *pDst = (NodeXY *)pvDst;
+	const NodeXY *pSrc = (const NodeXY *)pvSrc;
+
+	sCopy_NodeOffsetPointXY(pArena, &pDst->delta, &pSrc->delta);
+	if (pSrc->m.attributesPresent)
+	{
+		sCopy_NodeAttributeSetXY(pArena, &pDst->attributes, &pSrc->attributes);
+	}
+	else
+	{
+		memset(&pDst->attributes, 0x00, sizeof(pDst->attributes));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_NodeXY(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	NodeXY *pValue = (NodeXY *)pv;
+
+	sReloc_NodeOffsetPointXY(pReloc, &pValue->delta);
+	if (pValue->m.attributesPresent)
+	{
+		sReloc_NodeAttributeSetXY(pReloc, &pValue->attributes);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_NodeXY(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const NodeXY *pA = (const NodeXY *)pvA;
+	const NodeXY *pB = (const NodeXY *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("delta", sCmp_NodeOffsetPointXY(pDiff, &pA->delta, &pB->delta))
+	if (pA->m.attributesPresent != pB->m.attributesPresent) ASN_DEEP_DIFFER("attributes")
+	else if (pA->m.attributesPresent)
+	{
+		ASN_DEEP_INTO("attributes", sCmp_NodeAttributeSetXY(pDiff, &pA->attributes, &pB->attributes))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static int sCmp_ComputedLane_offsetXaxis(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ComputedLane_offsetXaxis *pA = (const ComputedLane_offsetXaxis *)pvA;
+	const ComputedLane_offsetXaxis *pB = (const ComputedLane_offsetXaxis *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			if (pA->u.small_ != pB->u.small_) ASN_DEEP_DIFFER("small_")
+			break;
+		case 2:
+			if (pA->u.large_ != pB->u.large_) ASN_DEEP_DIFFER("large_")
+			break;
+	}
+	return ret;
+}
+
+static int sCmp_ComputedLane_offsetYaxis(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ComputedLane_offsetYaxis *pA = (const ComputedLane_offsetYaxis *)pvA;
+	const ComputedLane_offsetYaxis *pB = (const ComputedLane_offsetYaxis *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			if (pA->u.small_ != pB->u.small_) ASN_DEEP_DIFFER("small_")
+			break;
+		case 2:
+			if (pA->u.large_ != pB->u.large_) ASN_DEEP_DIFFER("large_")
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_ComputedLane(const void *pv)
+{
+	const ComputedLane *pValue = (const ComputedLane *)pv;
+	size_t size = 0;
+
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_ComputedLane(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	ComputedLane *pDst = (ComputedLane *)pvDst;
+	const ComputedLane *pSrc = (const ComputedLane *)pvSrc;
+
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_ComputedLane(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	ComputedLane *pValue = (ComputedLane *)pv;
+
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_ComputedLane(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ComputedLane *pA = (const ComputedLane *)pvA;
+	const ComputedLane *pB = (const ComputedLane *)pvB;
+	int ret = 0;
+
+	if (pA->referenceLaneId != pB->referenceLaneId) ASN_DEEP_DIFFER("referenceLaneId")
+	ASN_DEEP_INTO("offsetXaxis", sCmp_ComputedLane_offsetXaxis(pDiff, &pA->offsetXaxis, &pB->offsetXaxis))
+	ASN_DEEP_INTO("offsetYaxis", sCmp_ComputedLane_offsetYaxis(pDiff, &pA->offsetYaxis, &pB->offsetYaxis))
+	if (pA->m.rotateXYPresent != pB->m.rotateXYPresent) ASN_DEEP_DIFFER("rotateXY")
+	else if (pA->m.rotateXYPresent)
+	{
+		if (pA->rotateXY != pB->rotateXY) ASN_DEEP_DIFFER("rotateXY")
+	}
+	if (pA->m.scaleXaxisPresent != pB->m.scaleXaxisPresent) ASN_DEEP_DIFFER("scaleXaxis")
+	else if (pA->m.scaleXaxisPresent)
+	{
+		if (pA->scaleXaxis != pB->scaleXaxis) ASN_DEEP_DIFFER("scaleXaxis")
+	}
+	if (pA->m.scaleYaxisPresent != pB->m.scaleYaxisPresent) ASN_DEEP_DIFFER("scaleYaxis")
+	else if (pA->m.scaleYaxisPresent)
+	{
+		if (pA->scaleYaxis != pB->scaleYaxis) ASN_DEEP_DIFFER("scaleYaxis")
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_NodeListXY(const void *pv)
+{
+	const NodeListXY *pValue = (const NodeListXY *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 1:
+			size += AsnDeep_SizePtr(pValue->u.nodes, sizeof(*pValue->u.nodes), sSize_NodeSetXY);
+			break;
+		case 2:
+			size += AsnDeep_SizePtr(pValue->u.computed, sizeof(*pValue->u.computed), sSize_ComputedLane);
+			break;
+		case 3:
+			size += AsnDeep_SizePtr(pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_SizeOpen);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_NodeListXY(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	NodeListXY *pDst = (NodeListXY *)pvDst;
+	const NodeListXY *pSrc = (const NodeListXY *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 1:
+			pDst->u.nodes = AsnDeep_CopyPtr(pArena, pSrc->u.nodes, sizeof(*pSrc->u.nodes), sCopy_NodeSetXY);
+			break;
+		case 2:
+			pDst->u.computed = AsnDeep_CopyPtr(pArena, pSrc->u.computed, sizeof(*pSrc->u.computed), sCopy_ComputedLane);
+			break;
+		case 3:
+			pDst->u.extElem1 = AsnDeep_CopyPtr(pArena, pSrc->u.extElem1, sizeof(*pSrc->u.extElem1), AsnDeep_CopyOpen);
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_NodeListXY(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	NodeListXY *pValue = (NodeListXY *)pv;
+
+	switch (pValue->t)
+	{
+		case 1:
+			AsnDeep_RelocObj(pReloc, &pValue->u.nodes, sizeof(*pValue->u.nodes), sReloc_NodeSetXY);
+			break;
+		case 2:
+			AsnDeep_RelocObj(pReloc, &pValue->u.computed, sizeof(*pValue->u.computed), sReloc_ComputedLane);
+			break;
+		case 3:
+			AsnDeep_RelocObj(pReloc, &pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_RelocOpen);
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_NodeListXY(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const NodeListXY *pA = (const NodeListXY *)pvA;
+	const NodeListXY *pB = (const NodeListXY *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			ASN_DEEP_INTO("nodes", AsnDeep_CmpPtr(pDiff, pA->u.nodes, pB->u.nodes, sizeof(*pA->u.nodes), sCmp_NodeSetXY))
+			break;
+		case 2:
+			ASN_DEEP_INTO("computed", AsnDeep_CmpPtr(pDiff, pA->u.computed, pB->u.computed, sizeof(*pA->u.computed), sCmp_ComputedLane))
+			break;
+		case 3:
+			ASN_DEEP_INTO("extElem1", AsnDeep_CmpPtr(pDiff, pA->u.extElem1, pB->u.extElem1, sizeof(*pA->u.extElem1), AsnDeep_CmpOpen))
+			break;
+	}
+	return ret;
+}
+
+static void sReloc_ConnectingLane(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	ConnectingLane *pValue = (ConnectingLane *)pv;
+
+	if (pValue->m.maneuverPresent)
+	{
+		sReloc_AllowedManeuvers(pReloc, &pValue->maneuver);
+	}
+}
+
+static int sCmp_ConnectingLane(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ConnectingLane *pA = (const ConnectingLane *)pvA;
+	const ConnectingLane *pB = (const ConnectingLane *)pvB;
+	int ret = 0;
+
+	if (pA->lane != pB->lane) ASN_DEEP_DIFFER("lane")
+	if (pA->m.maneuverPresent != pB->m.maneuverPresent) ASN_DEEP_DIFFER("maneuver")
+	else if (pA->m.maneuverPresent)
+	{
+		ASN_DEEP_INTO("maneuver", sCmp_AllowedManeuvers(pDiff, &pA->maneuver, &pB->maneuver))
+	}
+	return ret;
+}
+
+static void sReloc_Connection(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	Connection *pValue = (Connection *)pv;
+
+	sReloc_ConnectingLane(pReloc, &pValue->connectingLane);
+}
+
+static int sCmp_Connection(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Connection *pA = (const Connection *)pvA;
+	const Connection *pB = (const Connection *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("connectingLane", sCmp_ConnectingLane(pDiff, &pA->connectingLane, &pB->connectingLane))
+	if (pA->m.remoteIntersectionPresent != pB->m.remoteIntersectionPresent) ASN_DEEP_DIFFER("remoteIntersection")
+	else if (pA->m.remoteIntersectionPresent)
+	{
+		ASN_DEEP_INTO("remoteIntersection", sCmp_IntersectionReferenceID(pDiff, &pA->remoteIntersection, &pB->remoteIntersection))
+	}
+	if (pA->m.signalGroupPresent != pB->m.signalGroupPresent) ASN_DEEP_DIFFER("signalGroup")
+	else if (pA->m.signalGroupPresent)
+	{
+		if (pA->signalGroup != pB->signalGroup) ASN_DEEP_DIFFER("signalGroup")
+	}
+	if (pA->m.userClassPresent != pB->m.userClassPresent) ASN_DEEP_DIFFER("userClass")
+	else if (pA->m.userClassPresent)
+	{
+		if (pA->userClass != pB->userClass) ASN_DEEP_DIFFER("userClass")
+	}
+	if (pA->m.connectionIDPresent != pB->m.connectionIDPresent) ASN_DEEP_DIFFER("connectionID")
+	else if (pA->m.connectionIDPresent)
+	{
+		if (pA->connectionID != pB->connectionID) ASN_DEEP_DIFFER("connectionID")
+	}
+	return ret;
+}
+
+static void sReloc_OverlayLaneList(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	OverlayLaneList *pValue = (OverlayLaneList *)pv;
+
+	AsnDeep_RelocArray(pReloc, pValue->elem, pValue->n, sizeof(pValue->elem) / sizeof(pValue->elem[0]), sizeof(pValue->elem[0]), HAE_NULL);
+}
+
+static int sCmp_OverlayLaneList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const OverlayLaneList *pA = (const OverlayLaneList *)pvA;
+	const OverlayLaneList *pB = (const OverlayLaneList *)pvB;
+
+	return AsnDeep_CmpArray(pDiff, pA->elem, pA->n, pB->elem, pB->n, sizeof(pA->elem) / sizeof(pA->elem[0]), sizeof(pA->elem[0]), HAE_NULL);
+}
+
+static size_t sSize_GenericLane(const void *pv)
+{
+	const GenericLane *pValue = (const GenericLane *)pv;
+	size_t size = 0;
+
+	if (pValue->m.namePresent)
+	{
+		size += AsnDeep_SizeStr(pValue->name);
+	}
+	size += sSize_LaneAttributes(&pValue->laneAttributes);
+	size += sSize_NodeListXY(&pValue->nodeList);
+	if (pValue->m.connectsToPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->connectsTo, sizeof(Connection), HAE_NULL);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_GenericLane(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	GenericLane *pDst = (GenericLane *)pvDst;
+	const GenericLane *pSrc = (const GenericLane *)pvSrc;
+
+	if (pSrc->m.namePresent)
+	{
+		pDst->name = AsnDeep_CopyStr(pArena, pSrc->name);
+	}
+	else
+	{
+		memset(&pDst->name, 0x00, sizeof(pDst->name));
+	}
+	sCopy_LaneAttributes(pArena, &pDst->laneAttributes, &pSrc->laneAttributes);
+	sCopy_NodeListXY(pArena, &pDst->nodeList, &pSrc->nodeList);
+	if (pSrc->m.connectsToPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->connectsTo, &pSrc->connectsTo, sizeof(Connection), HAE_NULL);
+	}
+	else
+	{
+		memset(&pDst->connectsTo, 0x00, sizeof(pDst->connectsTo));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_GenericLane(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	GenericLane *pValue = (GenericLane *)pv;
+
+	if (pValue->m.namePresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->name);
+	}
+	sReloc_LaneAttributes(pReloc, &pValue->laneAttributes);
+	if (pValue->m.maneuversPresent)
+	{
+		sReloc_AllowedManeuvers(pReloc, &pValue->maneuvers);
+	}
+	sReloc_NodeListXY(pReloc, &pValue->nodeList);
+	if (pValue->m.connectsToPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->connectsTo, sizeof(Connection), sReloc_Connection);
+	}
+	if (pValue->m.overlaysPresent)
+	{
+		sReloc_OverlayLaneList(pReloc, &pValue->overlays);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_GenericLane(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const GenericLane *pA = (const GenericLane *)pvA;
+	const GenericLane *pB = (const GenericLane *)pvB;
+	int ret = 0;
+
+	if (pA->laneID != pB->laneID) ASN_DEEP_DIFFER("laneID")
+	if (pA->m.namePresent != pB->m.namePresent) ASN_DEEP_DIFFER("name")
+	else if (pA->m.namePresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->name, pB->name)) ASN_DEEP_DIFFER("name")
+	}
+	if (pA->m.ingressApproachPresent != pB->m.ingressApproachPresent) ASN_DEEP_DIFFER("ingressApproach")
+	else if (pA->m.ingressApproachPresent)
+	{
+		if (pA->ingressApproach != pB->ingressApproach) ASN_DEEP_DIFFER("ingressApproach")
+	}
+	if (pA->m.egressApproachPresent != pB->m.egressApproachPresent) ASN_DEEP_DIFFER("egressApproach")
+	else if (pA->m.egressApproachPresent)
+	{
+		if (pA->egressApproach != pB->egressApproach) ASN_DEEP_DIFFER("egressApproach")
+	}
+	ASN_DEEP_INTO("laneAttributes", sCmp_LaneAttributes(pDiff, &pA->laneAttributes, &pB->laneAttributes))
+	if (pA->m.maneuversPresent != pB->m.maneuversPresent) ASN_DEEP_DIFFER("maneuvers")
+	else if (pA->m.maneuversPresent)
+	{
+		ASN_DEEP_INTO("maneuvers", sCmp_AllowedManeuvers(pDiff, &pA->maneuvers, &pB->maneuvers))
+	}
+	ASN_DEEP_INTO("nodeList", sCmp_NodeListXY(pDiff, &pA->nodeList, &pB->nodeList))
+	if (pA->m.connectsToPresent != pB->m.connectsToPresent) ASN_DEEP_DIFFER("connectsTo")
+	else if (pA->m.connectsToPresent)
+	{
+		ASN_DEEP_INTO("connectsTo", AsnDeep_CmpList(pDiff, &pA->connectsTo, &pB->connectsTo, sizeof(Connection), sCmp_Connection))
+	}
+	if (pA->m.overlaysPresent != pB->m.overlaysPresent) ASN_DEEP_DIFFER("overlays")
+	else if (pA->m.overlaysPresent)
+	{
+		ASN_DEEP_INTO("overlays", sCmp_OverlayLaneList(pDiff, &pA->overlays, &pB->overlays))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_SignalControlZone(const void *pv)
+{
+	const SignalControlZone *pValue = (const SignalControlZone *)pv;
+	size_t size = 0;
+
+	size += sSize_RegionalExtension(&pValue->zone);
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_SignalControlZone(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	SignalControlZone *pDst = (SignalControlZone *)pvDst;
+	const SignalControlZone *pSrc = (const SignalControlZone *)pvSrc;
+
+	sCopy_RegionalExtension(pArena, &pDst->zone, &pSrc->zone);
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_SignalControlZone(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SignalControlZone *pValue = (SignalControlZone *)pv;
+
+	sReloc_RegionalExtension(pReloc, &pValue->zone);
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_SignalControlZone(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SignalControlZone *pA = (const SignalControlZone *)pvA;
+	const SignalControlZone *pB = (const SignalControlZone *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("zone", sCmp_RegionalExtension(pDiff, &pA->zone, &pB->zone))
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_IntersectionGeometry(const void *pv)
+{
+	const IntersectionGeometry *pValue = (const IntersectionGeometry *)pv;
+	size_t size = 0;
+
+	if (pValue->m.namePresent)
+	{
+		size += AsnDeep_SizeStr(pValue->name);
+	}
+	size += sSize_Position3D(&pValue->refPoint);
+	if (pValue->m.speedLimitsPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->speedLimits, sizeof(RegulatorySpeedLimit), HAE_NULL);
+	}
+	size += AsnDeep_SizeList(&pValue->laneSet, sizeof(GenericLane), sSize_GenericLane);
+	if (pValue->m.preemptPriorityDataPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->preemptPriorityData, sizeof(SignalControlZone), sSize_SignalControlZone);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_IntersectionGeometry(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	IntersectionGeometry *pDst = (IntersectionGeometry *)pvDst;
+	const IntersectionGeometry *pSrc = (const IntersectionGeometry *)pvSrc;
+
+	if (pSrc->m.namePresent)
+	{
+		pDst->name = AsnDeep_CopyStr(pArena, pSrc->name);
+	}
+	else
+	{
+		memset(&pDst->name, 0x00, sizeof(pDst->name));
+	}
+	sCopy_Position3D(pArena, &pDst->refPoint, &pSrc->refPoint);
+	if (pSrc->m.speedLimitsPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->speedLimits, &pSrc->speedLimits, sizeof(RegulatorySpeedLimit), HAE_NULL);
+	}
+	else
+	{
+		memset(&pDst->speedLimits, 0x00, sizeof(pDst->speedLimits));
+	}
+	AsnDeep_CopyList(pArena, &pDst->laneSet, &pSrc->laneSet, sizeof(GenericLane), sCopy_GenericLane);
+	if (pSrc->m.preemptPriorityDataPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->preemptPriorityData, &pSrc->preemptPriorityData, sizeof(SignalControlZone), sCopy_SignalControlZone);
+	}
+	else
+	{
+		memset(&pDst->preemptPriorityData, 0x00, sizeof(pDst->preemptPriorityData));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_IntersectionGeometry(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	IntersectionGeometry *pValue = (IntersectionGeometry *)pv;
+
+	if (pValue->m.namePresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->name);
+	}
+	sReloc_Position3D(pReloc, &pValue->refPoint);
+	if (pValue->m.speedLimitsPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->speedLimits, sizeof(RegulatorySpeedLimit), HAE_NULL);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->laneSet, sizeof(GenericLane), sReloc_GenericLane);
+	if (pValue->m.preemptPriorityDataPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->preemptPriorityData, sizeof(SignalControlZone), sReloc_SignalControlZone);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_IntersectionGeometry(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const IntersectionGeometry *pA = (const IntersectionGeometry *)pvA;
+	const IntersectionGeometry *pB = (const IntersectionGeometry *)pvB;
+	int ret = 0;
+
+	if (pA->m.namePresent != pB->m.namePresent) ASN_DEEP_DIFFER("name")
+	else if (pA->m.namePresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->name, pB->name)) ASN_DEEP_DIFFER("name")
+	}
+	ASN_DEEP_INTO("id", sCmp_IntersectionReferenceID(pDiff, &pA->id, &pB->id))
+	if (pA->revision != pB->revision) ASN_DEEP_DIFFER("revision")
+	ASN_DEEP_INTO("refPoint", sCmp_Position3D(pDiff, &pA->refPoint, &pB->refPoint))
+	if (pA->m.laneWidthPresent != pB->m.laneWidthPresent) ASN_DEEP_DIFFER("laneWidth")
+	else if (pA->m.laneWidthPresent)
+	{
+		if (pA->laneWidth != pB->laneWidth) ASN_DEEP_DIFFER("laneWidth")
+	}
+	if (pA->m.speedLimitsPresent != pB->m.speedLimitsPresent) ASN_DEEP_DIFFER("speedLimits")
+	else if (pA->m.speedLimitsPresent)
+	{
+		ASN_DEEP_INTO("speedLimits", AsnDeep_CmpList(pDiff, &pA->speedLimits, &pB->speedLimits, sizeof(RegulatorySpeedLimit), sCmp_RegulatorySpeedLimit))
+	}
+	ASN_DEEP_INTO("laneSet", AsnDeep_CmpList(pDiff, &pA->laneSet, &pB->laneSet, sizeof(GenericLane), sCmp_GenericLane))
+	if (pA->m.preemptPriorityDataPresent != pB->m.preemptPriorityDataPresent) ASN_DEEP_DIFFER("preemptPriorityData")
+	else if (pA->m.preemptPriorityDataPresent)
+	{
+		ASN_DEEP_INTO("preemptPriorityData", AsnDeep_CmpList(pDiff, &pA->preemptPriorityData, &pB->preemptPriorityData, sizeof(SignalControlZone), sCmp_SignalControlZone))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static int sCmp_RoadSegmentReferenceID(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RoadSegmentReferenceID *pA = (const RoadSegmentReferenceID *)pvA;
+	const RoadSegmentReferenceID *pB = (const RoadSegmentReferenceID *)pvB;
+	int ret = 0;
+
+	if (pA->m.regionPresent != pB->m.regionPresent) ASN_DEEP_DIFFER("region")
+	else if (pA->m.regionPresent)
+	{
+		if (pA->region != pB->region) ASN_DEEP_DIFFER("region")
+	}
+	if (pA->id != pB->id) ASN_DEEP_DIFFER("id")
+	return ret;
+}
+
+static size_t sSize_RoadSegment(const void *pv)
+{
+	const RoadSegment *pValue = (const RoadSegment *)pv;
+	size_t size = 0;
+
+	if (pValue->m.namePresent)
+	{
+		size += AsnDeep_SizeStr(pValue->name);
+	}
+	size += sSize_Position3D(&pValue->refPoint);
+	if (pValue->m.speedLimitsPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->speedLimits, sizeof(RegulatorySpeedLimit), HAE_NULL);
+	}
+	size += AsnDeep_SizeList(&pValue->roadLaneSet, sizeof(GenericLane), sSize_GenericLane);
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_RoadSegment(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	RoadSegment *pDst = (RoadSegment *)pvDst;
+	const RoadSegment *pSrc = (const RoadSegment *)pvSrc;
+
+	if (pSrc->m.namePresent)
+	{
+		pDst->name = AsnDeep_CopyStr(pArena, pSrc->name);
+	}
+	else
+	{
+		memset(&pDst->name, 0x00, sizeof(pDst->name));
+	}
+	sCopy_Position3D(pArena, &pDst->refPoint, &pSrc->refPoint);
+	if (pSrc->m.speedLimitsPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->speedLimits, &pSrc->speedLimits, sizeof(RegulatorySpeedLimit), HAE_NULL);
+	}
+	else
+	{
+		memset(&pDst->speedLimits, 0x00, sizeof(pDst->speedLimits));
+	}
+	AsnDeep_CopyList(pArena, &pDst->roadLaneSet, &pSrc->roadLaneSet, sizeof(GenericLane), sCopy_GenericLane);
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_RoadSegment(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RoadSegment *pValue = (RoadSegment *)pv;
+
+	if (pValue->m.namePresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->name);
+	}
+	sReloc_Position3D(pReloc, &pValue->refPoint);
+	if (pValue->m.speedLimitsPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->speedLimits, sizeof(RegulatorySpeedLimit), HAE_NULL);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->roadLaneSet, sizeof(GenericLane), sReloc_GenericLane);
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_RoadSegment(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RoadSegment *pA = (const RoadSegment *)pvA;
+	const RoadSegment *pB = (const RoadSegment *)pvB;
+	int ret = 0;
+
+	if (pA->m.namePresent != pB->m.namePresent) ASN_DEEP_DIFFER("name")
+	else if (pA->m.namePresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->name, pB->name)) ASN_DEEP_DIFFER("name")
+	}
+	ASN_DEEP_INTO("id", sCmp_RoadSegmentReferenceID(pDiff, &pA->id, &pB->id))
+	if (pA->revision != pB->revision) ASN_DEEP_DIFFER("revision")
+	ASN_DEEP_INTO("refPoint", sCmp_Position3D(pDiff, &pA->refPoint, &pB->refPoint))
+	if (pA->m.laneWidthPresent != pB->m.laneWidthPresent) ASN_DEEP_DIFFER("laneWidth")
+	else if (pA->m.laneWidthPresent)
+	{
+		if (pA->laneWidth != pB->laneWidth) ASN_DEEP_DIFFER("laneWidth")
+	}
+	if (pA->m.speedLimitsPresent != pB->m.speedLimitsPresent) ASN_DEEP_DIFFER("speedLimits")
+	else if (pA->m.speedLimitsPresent)
+	{
+		ASN_DEEP_INTO("speedLimits", AsnDeep_CmpList(pDiff, &pA->speedLimits, &pB->speedLimits, sizeof(RegulatorySpeedLimit), sCmp_RegulatorySpeedLimit))
+	}
+	ASN_DEEP_INTO("roadLaneSet", AsnDeep_CmpList(pDiff, &pA->roadLaneSet, &pB->roadLaneSet, sizeof(GenericLane), sCmp_GenericLane))
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_DataParameters(const void *pv)
+{
+	const DataParameters *pValue = (const DataParameters *)pv;
+	size_t size = 0;
+
+	if (pValue->m.processMethodPresent)
+	{
+		size += AsnDeep_SizeStr(pValue->processMethod);
+	}
+	if (pValue->m.processAgencyPresent)
+	{
+		size += AsnDeep_SizeStr(pValue->processAgency);
+	}
+	if (pValue->m.lastCheckedDatePresent)
+	{
+		size += AsnDeep_SizeStr(pValue->lastCheckedDate);
+	}
+	if (pValue->m.geoidUsedPresent)
+	{
+		size += AsnDeep_SizeStr(pValue->geoidUsed);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_DataParameters(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	DataParameters *pDst = (DataParameters *)pvDst;
+	const DataParameters *pSrc = (const DataParameters *)pvSrc;
+
+	if (pSrc->m.processMethodPresent)
+	{
+		pDst->processMethod = AsnDeep_CopyStr(pArena, pSrc->processMethod);
+	}
+	else
+	{
+		memset(&pDst->processMethod, 0x00, sizeof(pDst->processMethod));
+	}
+	if (pSrc->m.processAgencyPresent)
+	{
+		pDst->processAgency = AsnDeep_CopyStr(pArena, pSrc->processAgency);
+	}
+	else
+	{
+		memset(&pDst->processAgency, 0x00, sizeof(pDst->processAgency));
+	}
+	if (pSrc->m.lastCheckedDatePresent)
+	{
+		pDst->lastCheckedDate = AsnDeep_CopyStr(pArena, pSrc->lastCheckedDate);
+	}
+	else
+	{
+		memset(&pDst->lastCheckedDate, 0x00, sizeof(pDst->lastCheckedDate));
+	}
+	if (pSrc->m.geoidUsedPresent)
+	{
+		pDst->geoidUsed = AsnDeep_CopyStr(pArena, pSrc->geoidUsed);
+	}
+	else
+	{
+		memset(&pDst->geoidUsed, 0x00, sizeof(pDst->geoidUsed));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_DataParameters(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	DataParameters *pValue = (DataParameters *)pv;
+
+	if (pValue->m.processMethodPresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->processMethod);
+	}
+	if (pValue->m.processAgencyPresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->processAgency);
+	}
+	if (pValue->m.lastCheckedDatePresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->lastCheckedDate);
+	}
+	if (pValue->m.geoidUsedPresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->geoidUsed);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_DataParameters(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const DataParameters *pA = (const DataParameters *)pvA;
+	const DataParameters *pB = (const DataParameters *)pvB;
+	int ret = 0;
+
+	if (pA->m.processMethodPresent != pB->m.processMethodPresent) ASN_DEEP_DIFFER("processMethod")
+	else if (pA->m.processMethodPresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->processMethod, pB->processMethod)) ASN_DEEP_DIFFER("processMethod")
+	}
+	if (pA->m.processAgencyPresent != pB->m.processAgencyPresent) ASN_DEEP_DIFFER("processAgency")
+	else if (pA->m.processAgencyPresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->processAgency, pB->processAgency)) ASN_DEEP_DIFFER("processAgency")
+	}
+	if (pA->m.lastCheckedDatePresent != pB->m.lastCheckedDatePresent) ASN_DEEP_DIFFER("lastCheckedDate")
+	else if (pA->m.lastCheckedDatePresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->lastCheckedDate, pB->lastCheckedDate)) ASN_DEEP_DIFFER("lastCheckedDate")
+	}
+	if (pA->m.geoidUsedPresent != pB->m.geoidUsedPresent) ASN_DEEP_DIFFER("geoidUsed")
+	else if (pA->m.geoidUsedPresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->geoidUsed, pB->geoidUsed)) ASN_DEEP_DIFFER("geoidUsed")
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_RestrictionUserType(const void *pv)
+{
+	const RestrictionUserType *pValue = (const RestrictionUserType *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 2:
+			size += AsnDeep_SizePtr(pValue->u.regional, sizeof(*pValue->u.regional), sSize_RestrictionUserType_regional);
+			break;
+		case 3:
+			size += AsnDeep_SizePtr(pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_SizeOpen);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_RestrictionUserType(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	RestrictionUserType *pDst = (RestrictionUserType *)pvDst;
+	const RestrictionUserType *pSrc = (const RestrictionUserType *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 2:
+			pDst->u.regional = AsnDeep_CopyPtr(pArena, pSrc->u.regional, sizeof(*pSrc->u.regional), sCopy_RestrictionUserType_regional);
+			break;
+		case 3:
+			pDst->u.extElem1 = AsnDeep_CopyPtr(pArena, pSrc->u.extElem1, sizeof(*pSrc->u.extElem1), AsnDeep_CopyOpen);
+			break;
+		case 1:
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_RestrictionUserType(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RestrictionUserType *pValue = (RestrictionUserType *)pv;
+
+	switch (pValue->t)
+	{
+		case 2:
+			AsnDeep_RelocObj(pReloc, &pValue->u.regional, sizeof(*pValue->u.regional), sReloc_RestrictionUserType_regional);
+			break;
+		case 3:
+			AsnDeep_RelocObj(pReloc, &pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_RelocOpen);
+			break;
+		case 1:
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_RestrictionUserType(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RestrictionUserType *pA = (const RestrictionUserType *)pvA;
+	const RestrictionUserType *pB = (const RestrictionUserType *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			if (pA->u.basicType != pB->u.basicType) ASN_DEEP_DIFFER("basicType")
+			break;
+		case 2:
+			ASN_DEEP_INTO("regional", AsnDeep_CmpPtr(pDiff, pA->u.regional, pB->u.regional, sizeof(*pA->u.regional), sCmp_RestrictionUserType_regional))
+			break;
+		case 3:
+			ASN_DEEP_INTO("extElem1", AsnDeep_CmpPtr(pDiff, pA->u.extElem1, pB->u.extElem1, sizeof(*pA->u.extElem1), AsnDeep_CmpOpen))
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_RestrictionClassAssignment(const void *pv)
+{
+	const RestrictionClassAssignment *pValue = (const RestrictionClassAssignment *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->users, sizeof(RestrictionUserType), sSize_RestrictionUserType);
+	return size;
+}
+
+static void sCopy_RestrictionClassAssignment(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	RestrictionClassAssignment *pDst = (RestrictionClassAssignment *)pvDst;
+	const RestrictionClassAssignment *pSrc = (const RestrictionClassAssignment *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->users, &pSrc->users, sizeof(RestrictionUserType), sCopy_RestrictionUserType);
+}
+
+static void sReloc_RestrictionClassAssignment(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RestrictionClassAssignment *pValue = (RestrictionClassAssignment *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->users, sizeof(RestrictionUserType), sReloc_RestrictionUserType);
+}
+
+static int sCmp_RestrictionClassAssignment(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RestrictionClassAssignment *pA = (const RestrictionClassAssignment *)pvA;
+	const RestrictionClassAssignment *pB = (const RestrictionClassAssignment *)pvB;
+	int ret = 0;
+
+	if (pA->id != pB->id) ASN_DEEP_DIFFER("id")
+	ASN_DEEP_INTO("users", AsnDeep_CmpList(pDiff, &pA->users, &pB->users, sizeof(RestrictionUserType), sCmp_RestrictionUserType))
+	return ret;
+}
+
+static size_t sSize_MapData(const void *pv)
+{
+	const MapData *pValue = (const MapData *)pv;
+	size_t size = 0;
+
+	if (pValue->m.intersectionsPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->intersections, sizeof(IntersectionGeometry), sSize_IntersectionGeometry);
+	}
+	if (pValue->m.roadSegmentsPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->roadSegments, sizeof(RoadSegment), sSize_RoadSegment);
+	}
+	if (pValue->m.dataParametersPresent)
+	{
+		size += sSize_DataParameters(&pValue->dataParameters);
+	}
+	if (pValue->m.restrictionListPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->restrictionList, sizeof(RestrictionClassAssignment), sSize_RestrictionClassAssignment);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_MapData(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	MapData *pDst = (MapData *)pvDst;
+	const MapData *pSrc = (const MapData *)pvSrc;
+
+	if (pSrc->m.intersectionsPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->intersections, &pSrc->intersections, sizeof(IntersectionGeometry), sCopy_IntersectionGeometry);
+	}
+	else
+	{
+		memset(&pDst->intersections, 0x00, sizeof(pDst->intersections));
+	}
+	if (pSrc->m.roadSegmentsPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->roadSegments, &pSrc->roadSegments, sizeof(RoadSegment), sCopy_RoadSegment);
+	}
+	else
+	{
+		memset(&pDst->roadSegments, 0x00, sizeof(pDst->roadSegments));
+	}
+	if (pSrc->m.dataParametersPresent)
+	{
+		sCopy_DataParameters(pArena, &pDst->dataParameters, &pSrc->dataParameters);
+	}
+	else
+	{
+		memset(&pDst->dataParameters, 0x00, sizeof(pDst->dataParameters));
+	}
+	if (pSrc->m.restrictionListPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->restrictionList, &pSrc->restrictionList, sizeof(RestrictionClassAssignment), sCopy_RestrictionClassAssignment);
+	}
+	else
+	{
+		memset(&pDst->restrictionList, 0x00, sizeof(pDst->restrictionList));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_MapData(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	MapData *pValue = (MapData *)pv;
+
+	if (pValue->m.intersectionsPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->intersections, sizeof(IntersectionGeometry), sReloc_IntersectionGeometry);
+	}
+	if (pValue->m.roadSegmentsPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->roadSegments, sizeof(RoadSegment), sReloc_RoadSegment);
+	}
+	if (pValue->m.dataParametersPresent)
+	{
+		sReloc_DataParameters(pReloc, &pValue->dataParameters);
+	}
+	if (pValue->m.restrictionListPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->restrictionList, sizeof(RestrictionClassAssignment), sReloc_RestrictionClassAssignment);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_MapData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const MapData *pA = (const MapData *)pvA;
+	const MapData *pB = (const MapData *)pvB;
+	int ret = 0;
+
+	if (pA->m.timeStampPresent != pB->m.timeStampPresent) ASN_DEEP_DIFFER("timeStamp")
+	else if (pA->m.timeStampPresent)
+	{
+		if (pA->timeStamp != pB->timeStamp) ASN_DEEP_DIFFER("timeStamp")
+	}
+	if (pA->msgIssueRevision != pB->msgIssueRevision) ASN_DEEP_DIFFER("msgIssueRevision")
+	if (pA->m.layerTypePresent != pB->m.layerTypePresent) ASN_DEEP_DIFFER("layerType")
+	else if (pA->m.layerTypePresent)
+	{
+		if (pA->layerType != pB->layerType) ASN_DEEP_DIFFER("layerType")
+	}
+	if (pA->m.layerIDPresent != pB->m.layerIDPresent) ASN_DEEP_DIFFER("layerID")
+	else if (pA->m.layerIDPresent)
+	{
+		if (pA->layerID != pB->layerID) ASN_DEEP_DIFFER("layerID")
+	}
+	if (pA->m.intersectionsPresent != pB->m.intersectionsPresent) ASN_DEEP_DIFFER("intersections")
+	else if (pA->m.intersectionsPresent)
+	{
+		ASN_DEEP_INTO("intersections", AsnDeep_CmpList(pDiff, &pA->intersections, &pB->intersections, sizeof(IntersectionGeometry), sCmp_IntersectionGeometry))
+	}
+	if (pA->m.roadSegmentsPresent != pB->m.roadSegmentsPresent) ASN_DEEP_DIFFER("roadSegments")
+	else if (pA->m.roadSegmentsPresent)
+	{
+		ASN_DEEP_INTO("roadSegments", AsnDeep_CmpList(pDiff, &pA->roadSegments, &pB->roadSegments, sizeof(RoadSegment), sCmp_RoadSegment))
+	}
+	if (pA->m.dataParametersPresent != pB->m.dataParametersPresent) ASN_DEEP_DIFFER("dataParameters")
+	else if (pA->m.dataParametersPresent)
+	{
+		ASN_DEEP_INTO("dataParameters", sCmp_DataParameters(pDiff, &pA->dataParameters, &pB->dataParameters))
+	}
+	if (pA->m.restrictionListPresent != pB->m.restrictionListPresent) ASN_DEEP_DIFFER("restrictionList")
+	else if (pA->m.restrictionListPresent)
+	{
+		ASN_DEEP_INTO("restrictionList", AsnDeep_CmpList(pDiff, &pA->restrictionList, &pB->restrictionList, sizeof(RestrictionClassAssignment), sCmp_RestrictionClassAssignment))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_NMEAcorrections(const void *pv)
+{
+	const NMEAcorrections *pValue = (const NMEAcorrections *)pv;
+	size_t size = 0;
+
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_NMEAcorrections(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	NMEAcorrections *pDst = (NMEAcorrections *)pvDst;
+	const NMEAcorrections *pSrc = (const NMEAcorrections *)pvSrc;
+
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_NMEAcorrections(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	NMEAcorrections *pValue = (NMEAcorrections *)pv;
+
+	sReloc_NMEA_Payload(pReloc, &pValue->payload);
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_NMEAcorrections(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const NMEAcorrections *pA = (const NMEAcorrections *)pvA;
+	const NMEAcorrections *pB = (const NMEAcorrections *)pvB;
+	int ret = 0;
+
+	if (pA->m.timeStampPresent != pB->m.timeStampPresent) ASN_DEEP_DIFFER("timeStamp")
+	else if (pA->m.timeStampPresent)
+	{
+		if (pA->timeStamp != pB->timeStamp) ASN_DEEP_DIFFER("timeStamp")
+	}
+	if (pA->m.revPresent != pB->m.revPresent) ASN_DEEP_DIFFER("rev")
+	else if (pA->m.revPresent)
+	{
+		if (pA->rev != pB->rev) ASN_DEEP_DIFFER("rev")
+	}
+	if (pA->m.msgPresent != pB->m.msgPresent) ASN_DEEP_DIFFER("msg")
+	else if (pA->m.msgPresent)
+	{
+		if (pA->msg != pB->msg) ASN_DEEP_DIFFER("msg")
+	}
+	if (pA->m.wdCountPresent != pB->m.wdCountPresent) ASN_DEEP_DIFFER("wdCount")
+	else if (pA->m.wdCountPresent)
+	{
+		if (pA->wdCount != pB->wdCount) ASN_DEEP_DIFFER("wdCount")
+	}
+	ASN_DEEP_INTO("payload", sCmp_NMEA_Payload(pDiff, &pA->payload, &pB->payload))
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_PropelledInformation(const void *pv)
+{
+	const PropelledInformation *pValue = (const PropelledInformation *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 4:
+			size += AsnDeep_SizePtr(pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_SizeOpen);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_PropelledInformation(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	PropelledInformation *pDst = (PropelledInformation *)pvDst;
+	const PropelledInformation *pSrc = (const PropelledInformation *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 4:
+			pDst->u.extElem1 = AsnDeep_CopyPtr(pArena, pSrc->u.extElem1, sizeof(*pSrc->u.extElem1), AsnDeep_CopyOpen);
+			break;
+		case 1:
+		case 2:
+		case 3:
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_PropelledInformation(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	PropelledInformation *pValue = (PropelledInformation *)pv;
+
+	switch (pValue->t)
+	{
+		case 4:
+			AsnDeep_RelocObj(pReloc, &pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_RelocOpen);
+			break;
+		case 1:
+		case 2:
+		case 3:
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_PropelledInformation(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PropelledInformation *pA = (const PropelledInformation *)pvA;
+	const PropelledInformation *pB = (const PropelledInformation *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			if (pA->u.human != pB->u.human) ASN_DEEP_DIFFER("human")
+			break;
+		case 2:
+			if (pA->u.animal != pB->u.animal) ASN_DEEP_DIFFER("animal")
+			break;
+		case 3:
+			if (pA->u.motor != pB->u.motor) ASN_DEEP_DIFFER("motor")
+			break;
+		case 4:
+			ASN_DEEP_INTO("extElem1", AsnDeep_CmpPtr(pDiff, pA->u.extElem1, pB->u.extElem1, sizeof(*pA->u.extElem1), AsnDeep_CmpOpen))
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_PersonalSafetyMessage(const void *pv)
+{
+	const PersonalSafetyMessage *pValue = (const PersonalSafetyMessage *)pv;
+	size_t size = 0;
+
+	size += sSize_Position3D(&pValue->position);
+	if (pValue->m.pathHistoryPresent)
+	{
+		size += sSize_PathHistory(&pValue->pathHistory);
+	}
+	if (pValue->m.pathPredictionPresent)
+	{
+		size += sSize_PathPrediction(&pValue->pathPrediction);
+	}
+	if (pValue->m.propulsionPresent)
+	{
+		size += sSize_PropelledInformation(&pValue->propulsion);
+	}
+	if (pValue->m.useStatePresent)
+	{
+		size += sSize_PersonalDeviceUsageState(&pValue->useState);
+	}
+	if (pValue->m.activityTypePresent)
+	{
+		size += sSize_PublicSafetyAndRoadWorkerActivity(&pValue->activityType);
+	}
+	if (pValue->m.activitySubTypePresent)
+	{
+		size += sSize_PublicSafetyDirectingTrafficSubType(&pValue->activitySubType);
+	}
+	if (pValue->m.assistTypePresent)
+	{
+		size += sSize_PersonalAssistive(&pValue->assistType);
+	}
+	if (pValue->m.sizingPresent)
+	{
+		size += sSize_UserSizeAndBehaviour(&pValue->sizing);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_PersonalSafetyMessage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	PersonalSafetyMessage *pDst = (PersonalSafetyMessage *)pvDst;
+	const PersonalSafetyMessage *pSrc = (const PersonalSafetyMessage *)pvSrc;
+
+	sCopy_Position3D(pArena, &pDst->position, &pSrc->position);
+	if (pSrc->m.pathHistoryPresent)
+	{
+		sCopy_PathHistory(pArena, &pDst->pathHistory, &pSrc->pathHistory);
+	}
+	else
+	{
+		memset(&pDst->pathHistory, 0x00, sizeof(pDst->pathHistory));
+	}
+	if (pSrc->m.pathPredictionPresent)
+	{
+		sCopy_PathPrediction(pArena, &pDst->pathPrediction, &pSrc->pathPrediction);
+	}
+	else
+	{
+		memset(&pDst->pathPrediction, 0x00, sizeof(pDst->pathPrediction));
+	}
+	if (pSrc->m.propulsionPresent)
+	{
+		sCopy_PropelledInformation(pArena, &pDst->propulsion, &pSrc->propulsion);
+	}
+	else
+	{
+		memset(&pDst->propulsion, 0x00, sizeof(pDst->propulsion));
+	}
+	if (pSrc->m.useStatePresent)
+	{
+		sCopy_PersonalDeviceUsageState(pArena, &pDst->useState, &pSrc->useState);
+	}
+	else
+	{
+		memset(&pDst->useState, 0x00, sizeof(pDst->useState));
+	}
+	if (pSrc->m.activityTypePresent)
+	{
+		sCopy_PublicSafetyAndRoadWorkerActivity(pArena, &pDst->activityType, &pSrc->activityType);
+	}
+	else
+	{
+		memset(&pDst->activityType, 0x00, sizeof(pDst->activityType));
+	}
+	if (pSrc->m.activitySubTypePresent)
+	{
+		sCopy_PublicSafetyDirectingTrafficSubType(pArena, &pDst->activitySubType, &pSrc->activitySubType);
+	}
+	else
+	{
+		memset(&pDst->activitySubType, 0x00, sizeof(pDst->activitySubType));
+	}
+	if (pSrc->m.assistTypePresent)
+	{
+		sCopy_PersonalAssistive(pArena, &pDst->assistType, &pSrc->assistType);
+	}
+	else
+	{
+		memset(&pDst->assistType, 0x00, sizeof(pDst->assistType));
+	}
+	if (pSrc->m.sizingPresent)
+	{
+		sCopy_UserSizeAndBehaviour(pArena, &pDst->sizing, &pSrc->sizing);
+	}
+	else
+	{
+		memset(&pDst->sizing, 0x00, sizeof(pDst->sizing));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_PersonalSafetyMessage(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	PersonalSafetyMessage *pValue = (PersonalSafetyMessage *)pv;
+
+	sReloc_TemporaryID(pReloc, &pValue->id);
+	sReloc_Position3D(pReloc, &pValue->position);
+	if (pValue->m.pathHistoryPresent)
+	{
+		sReloc_PathHistory(pReloc, &pValue->pathHistory);
+	}
+	if (pValue->m.pathPredictionPresent)
+	{
+		sReloc_PathPrediction(pReloc, &pValue->pathPrediction);
+	}
+	if (pValue->m.propulsionPresent)
+	{
+		sReloc_PropelledInformation(pReloc, &pValue->propulsion);
+	}
+	if (pValue->m.useStatePresent)
+	{
+		sReloc_PersonalDeviceUsageState(pReloc, &pValue->useState);
+	}
+	if (pValue->m.activityTypePresent)
+	{
+		sReloc_PublicSafetyAndRoadWorkerActivity(pReloc, &pValue->activityType);
+	}
+	if (pValue->m.activitySubTypePresent)
+	{
+		sReloc_PublicSafetyDirectingTrafficSubType(pReloc, &pValue->activitySubType);
+	}
+	if (pValue->m.assistTypePresent)
+	{
+		sReloc_PersonalAssistive(pReloc, &pValue->assistType);
+	}
+	if (pValue->m.sizingPresent)
+	{
+		sReloc_UserSizeAndBehaviour(pReloc, &pValue->sizing);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_PersonalSafetyMessage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PersonalSafetyMessage *pA = (const PersonalSafetyMessage *)pvA;
+	const PersonalSafetyMessage *pB = (const PersonalSafetyMessage *)pvB;
+	int ret = 0;
+
+	if (pA->basicType != pB->basicType) ASN_DEEP_DIFFER("basicType")
+	if (pA->secMark != pB->secMark) ASN_DEEP_DIFFER("secMark")
+	if (pA->msgCnt != pB->msgCnt) ASN_DEEP_DIFFER("msgCnt")
+	ASN_DEEP_INTO("id", sCmp_TemporaryID(pDiff, &pA->id, &pB->id))
+	ASN_DEEP_INTO("position", sCmp_Position3D(pDiff, &pA->position, &pB->position))
+	ASN_DEEP_INTO("accuracy", sCmp_PositionalAccuracy(pDiff, &pA->accuracy, &pB->accuracy))
+	if (pA->speed != pB->speed) ASN_DEEP_DIFFER("speed")
+	if (pA->heading != pB->heading) ASN_DEEP_DIFFER("heading")
+	if (pA->m.accelSetPresent != pB->m.accelSetPresent) ASN_DEEP_DIFFER("accelSet")
+	else if (pA->m.accelSetPresent)
+	{
+		ASN_DEEP_INTO("accelSet", sCmp_AccelerationSet4Way(pDiff, &pA->accelSet, &pB->accelSet))
+	}
+	if (pA->m.pathHistoryPresent != pB->m.pathHistoryPresent) ASN_DEEP_DIFFER("pathHistory")
+	else if (pA->m.pathHistoryPresent)
+	{
+		ASN_DEEP_INTO("pathHistory", sCmp_PathHistory(pDiff, &pA->pathHistory, &pB->pathHistory))
+	}
+	if (pA->m.pathPredictionPresent != pB->m.pathPredictionPresent) ASN_DEEP_DIFFER("pathPrediction")
+	else if (pA->m.pathPredictionPresent)
+	{
+		ASN_DEEP_INTO("pathPrediction", sCmp_PathPrediction(pDiff, &pA->pathPrediction, &pB->pathPrediction))
+	}
+	if (pA->m.propulsionPresent != pB->m.propulsionPresent) ASN_DEEP_DIFFER("propulsion")
+	else if (pA->m.propulsionPresent)
+	{
+		ASN_DEEP_INTO("propulsion", sCmp_PropelledInformation(pDiff, &pA->propulsion, &pB->propulsion))
+	}
+	if (pA->m.useStatePresent != pB->m.useStatePresent) ASN_DEEP_DIFFER("useState")
+	else if (pA->m.useStatePresent)
+	{
+		ASN_DEEP_INTO("useState", sCmp_PersonalDeviceUsageState(pDiff, &pA->useState, &pB->useState))
+	}
+	if (pA->m.crossRequestPresent != pB->m.crossRequestPresent) ASN_DEEP_DIFFER("crossRequest")
+	else if (pA->m.crossRequestPresent)
+	{
+		if (pA->crossRequest != pB->crossRequest) ASN_DEEP_DIFFER("crossRequest")
+	}
+	if (pA->m.crossStatePresent != pB->m.crossStatePresent) ASN_DEEP_DIFFER("crossState")
+	else if (pA->m.crossStatePresent)
+	{
+		if (pA->crossState != pB->crossState) ASN_DEEP_DIFFER("crossState")
+	}
+	if (pA->m.clusterSizePresent != pB->m.clusterSizePresent) ASN_DEEP_DIFFER("clusterSize")
+	else if (pA->m.clusterSizePresent)
+	{
+		if (pA->clusterSize != pB->clusterSize) ASN_DEEP_DIFFER("clusterSize")
+	}
+	if (pA->m.clusterRadiusPresent != pB->m.clusterRadiusPresent) ASN_DEEP_DIFFER("clusterRadius")
+	else if (pA->m.clusterRadiusPresent)
+	{
+		if (pA->clusterRadius != pB->clusterRadius) ASN_DEEP_DIFFER("clusterRadius")
+	}
+	if (pA->m.eventResponderTypePresent != pB->m.eventResponderTypePresent) ASN_DEEP_DIFFER("eventResponderType")
+	else if (pA->m.eventResponderTypePresent)
+	{
+		if (pA->eventResponderType != pB->eventResponderType) ASN_DEEP_DIFFER("eventResponderType")
+	}
+	if (pA->m.activityTypePresent != pB->m.activityTypePresent) ASN_DEEP_DIFFER("activityType")
+	else if (pA->m.activityTypePresent)
+	{
+		ASN_DEEP_INTO("activityType", sCmp_PublicSafetyAndRoadWorkerActivity(pDiff, &pA->activityType, &pB->activityType))
+	}
+	if (pA->m.activitySubTypePresent != pB->m.activitySubTypePresent) ASN_DEEP_DIFFER("activitySubType")
+	else if (pA->m.activitySubTypePresent)
+	{
+		ASN_DEEP_INTO("activitySubType", sCmp_PublicSafetyDirectingTrafficSubType(pDiff, &pA->activitySubType, &pB->activitySubType))
+	}
+	if (pA->m.assistTypePresent != pB->m.assistTypePresent) ASN_DEEP_DIFFER("assistType")
+	else if (pA->m.assistTypePresent)
+	{
+		ASN_DEEP_INTO("assistType", sCmp_PersonalAssistive(pDiff, &pA->assistType, &pB->assistType))
+	}
+	if (pA->m.sizingPresent != pB->m.sizingPresent) ASN_DEEP_DIFFER("sizing")
+	else if (pA->m.sizingPresent)
+	{
+		ASN_DEEP_INTO("sizing", sCmp_UserSizeAndBehaviour(pDiff, &pA->sizing, &pB->sizing))
+	}
+	if (pA->m.attachmentPresent != pB->m.attachmentPresent) ASN_DEEP_DIFFER("attachment")
+	else if (pA->m.attachmentPresent)
+	{
+		if (pA->attachment != pB->attachment) ASN_DEEP_DIFFER("attachment")
+	}
+	if (pA->m.attachmentRadiusPresent != pB->m.attachmentRadiusPresent) ASN_DEEP_DIFFER("attachmentRadius")
+	else if (pA->m.attachmentRadiusPresent)
+	{
+		if (pA->attachmentRadius != pB->attachmentRadius) ASN_DEEP_DIFFER("attachmentRadius")
+	}
+	if (pA->m.animalTypePresent != pB->m.animalTypePresent) ASN_DEEP_DIFFER("animalType")
+	else if (pA->m.animalTypePresent)
+	{
+		if (pA->animalType != pB->animalType) ASN_DEEP_DIFFER("animalType")
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static int sCmp_Sample(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Sample *pA = (const Sample *)pvA;
+	const Sample *pB = (const Sample *)pvB;
+	int ret = 0;
+
+	if (pA->sampleStart != pB->sampleStart) ASN_DEEP_DIFFER("sampleStart")
+	if (pA->sampleEnd != pB->sampleEnd) ASN_DEEP_DIFFER("sampleEnd")
+	return ret;
+}
+
+static int sCmp_ProbeDataManagement_term(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ProbeDataManagement_term *pA = (const ProbeDataManagement_term *)pvA;
+	const ProbeDataManagement_term *pB = (const ProbeDataManagement_term *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			if (pA->u.termtime != pB->u.termtime) ASN_DEEP_DIFFER("termtime")
+			break;
+		case 2:
+			if (pA->u.termDistance != pB->u.termDistance) ASN_DEEP_DIFFER("termDistance")
+			break;
+	}
+	return ret;
+}
+
+static int sCmp_SnapshotTime(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SnapshotTime *pA = (const SnapshotTime *)pvA;
+	const SnapshotTime *pB = (const SnapshotTime *)pvB;
+	int ret = 0;
+
+	if (pA->speed1 != pB->speed1) ASN_DEEP_DIFFER("speed1")
+	if (pA->time1 != pB->time1) ASN_DEEP_DIFFER("time1")
+	if (pA->speed2 != pB->speed2) ASN_DEEP_DIFFER("speed2")
+	if (pA->time2 != pB->time2) ASN_DEEP_DIFFER("time2")
+	return ret;
+}
+
+static int sCmp_SnapshotDistance(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SnapshotDistance *pA = (const SnapshotDistance *)pvA;
+	const SnapshotDistance *pB = (const SnapshotDistance *)pvB;
+	int ret = 0;
+
+	if (pA->distance1 != pB->distance1) ASN_DEEP_DIFFER("distance1")
+	if (pA->speed1 != pB->speed1) ASN_DEEP_DIFFER("speed1")
+	if (pA->distance2 != pB->distance2) ASN_DEEP_DIFFER("distance2")
+	if (pA->speed2 != pB->speed2) ASN_DEEP_DIFFER("speed2")
+	return ret;
+}
+
+static size_t sSize_ProbeDataManagement_snapshot(const void *pv)
+{
+	const ProbeDataManagement_snapshot *pValue = (const ProbeDataManagement_snapshot *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 1:
+			size += AsnDeep_SizePtr(pValue->u.snapshotTime, sizeof(*pValue->u.snapshotTime), HAE_NULL);
+			break;
+		case 2:
+			size += AsnDeep_SizePtr(pValue->u.snapshotDistance, sizeof(*pValue->u.snapshotDistance), HAE_NULL);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_ProbeDataManagement_snapshot(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	ProbeDataManagement_snapshot *pDst = (ProbeDataManagement_snapshot *)pvDst;
+	const ProbeDataManagement_snapshot *pSrc = (const ProbeDataManagement_snapshot *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 1:
+			pDst->u.snapshotTime = AsnDeep_CopyPtr(pArena, pSrc->u.snapshotTime, sizeof(*pSrc->u.snapshotTime), HAE_NULL);
+			break;
+		case 2:
+			pDst->u.snapshotDistance = AsnDeep_CopyPtr(pArena, pSrc->u.snapshotDistance, sizeof(*pSrc->u.snapshotDistance), HAE_NULL);
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_ProbeDataManagement_snapshot(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	ProbeDataManagement_snapshot *pValue = (ProbeDataManagement_snapshot *)pv;
+
+	switch (pValue->t)
+	{
+		case 1:
+			AsnDeep_RelocObj(pReloc, &pValue->u.snapshotTime, sizeof(*pValue->u.snapshotTime), HAE_NULL);
+			break;
+		case 2:
+			AsnDeep_RelocObj(pReloc, &pValue->u.snapshotDistance, sizeof(*pValue->u.snapshotDistance), HAE_NULL);
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_ProbeDataManagement_snapshot(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ProbeDataManagement_snapshot *pA = (const ProbeDataManagement_snapshot *)pvA;
+	const ProbeDataManagement_snapshot *pB = (const ProbeDataManagement_snapshot *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			ASN_DEEP_INTO("snapshotTime", AsnDeep_CmpPtr(pDiff, pA->u.snapshotTime, pB->u.snapshotTime, sizeof(*pA->u.snapshotTime), sCmp_SnapshotTime))
+			break;
+		case 2:
+			ASN_DEEP_INTO("snapshotDistance", AsnDeep_CmpPtr(pDiff, pA->u.snapshotDistance, pB->u.snapshotDistance, sizeof(*pA->u.snapshotDistance), sCmp_SnapshotDistance))
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_VehicleStatusRequest(const void *pv)
+{
+	const VehicleStatusRequest *pValue = (const VehicleStatusRequest *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_VehicleStatusRequest(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	VehicleStatusRequest *pDst = (VehicleStatusRequest *)pvDst;
+	const VehicleStatusRequest *pSrc = (const VehicleStatusRequest *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_VehicleStatusRequest(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	VehicleStatusRequest *pValue = (VehicleStatusRequest *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_VehicleStatusRequest(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VehicleStatusRequest *pA = (const VehicleStatusRequest *)pvA;
+	const VehicleStatusRequest *pB = (const VehicleStatusRequest *)pvB;
+	int ret = 0;
+
+	if (pA->dataType != pB->dataType) ASN_DEEP_DIFFER("dataType")
+	if (pA->m.subTypePresent != pB->m.subTypePresent) ASN_DEEP_DIFFER("subType")
+	else if (pA->m.subTypePresent)
+	{
+		if (pA->subType != pB->subType) ASN_DEEP_DIFFER("subType")
+	}
+	if (pA->m.sendOnLessThenValuePresent != pB->m.sendOnLessThenValuePresent) ASN_DEEP_DIFFER("sendOnLessThenValue")
+	else if (pA->m.sendOnLessThenValuePresent)
+	{
+		if (pA->sendOnLessThenValue != pB->sendOnLessThenValue) ASN_DEEP_DIFFER("sendOnLessThenValue")
+	}
+	if (pA->m.sendOnMoreThenValuePresent != pB->m.sendOnMoreThenValuePresent) ASN_DEEP_DIFFER("sendOnMoreThenValue")
+	else if (pA->m.sendOnMoreThenValuePresent)
+	{
+		if (pA->sendOnMoreThenValue != pB->sendOnMoreThenValue) ASN_DEEP_DIFFER("sendOnMoreThenValue")
+	}
+	if (pA->m.sendAllPresent != pB->m.sendAllPresent) ASN_DEEP_DIFFER("sendAll")
+	else if (pA->m.sendAllPresent)
+	{
+		if (pA->sendAll != pB->sendAll) ASN_DEEP_DIFFER("sendAll")
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_ProbeDataManagement(const void *pv)
+{
+	const ProbeDataManagement *pValue = (const ProbeDataManagement *)pv;
+	size_t size = 0;
+
+	size += sSize_ProbeDataManagement_snapshot(&pValue->snapshot);
+	if (pValue->m.dataElementsPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->dataElements, sizeof(VehicleStatusRequest), sSize_VehicleStatusRequest);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_ProbeDataManagement(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	ProbeDataManagement *pDst = (ProbeDataManagement *)pvDst;
+	const ProbeDataManagement *pSrc = (const ProbeDataManagement *)pvSrc;
+
+	sCopy_ProbeDataManagement_snapshot(pArena, &pDst->snapshot, &pSrc->snapshot);
+	if (pSrc->m.dataElementsPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->dataElements, &pSrc->dataElements, sizeof(VehicleStatusRequest), sCopy_VehicleStatusRequest);
+	}
+	else
+	{
+		memset(&pDst->dataElements, 0x00, sizeof(pDst->dataElements));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_ProbeDataManagement(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	ProbeDataManagement *pValue = (ProbeDataManagement *)pv;
+
+	sReloc_HeadingSlice(pReloc, &pValue->directions);
+	sReloc_ProbeDataManagement_snapshot(pReloc, &pValue->snapshot);
+	if (pValue->m.dataElementsPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->dataElements, sizeof(VehicleStatusRequest), sReloc_VehicleStatusRequest);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_ProbeDataManagement(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ProbeDataManagement *pA = (const ProbeDataManagement *)pvA;
+	const ProbeDataManagement *pB = (const ProbeDataManagement *)pvB;
+	int ret = 0;
+
+	if (pA->m.timeStampPresent != pB->m.timeStampPresent) ASN_DEEP_DIFFER("timeStamp")
+	else if (pA->m.timeStampPresent)
+	{
+		if (pA->timeStamp != pB->timeStamp) ASN_DEEP_DIFFER("timeStamp")
+	}
+	ASN_DEEP_INTO("sample", sCmp_Sample(pDiff, &pA->sample, &pB->sample))
+	ASN_DEEP_INTO("directions", sCmp_HeadingSlice(pDiff, &pA->directions, &pB->directions))
+	ASN_DEEP_INTO("term", sCmp_ProbeDataManagement_term(pDiff, &pA->term, &pB->term))
+	ASN_DEEP_INTO("snapshot", sCmp_ProbeDataManagement_snapshot(pDiff, &pA->snapshot, &pB->snapshot))
+	if (pA->txInterval != pB->txInterval) ASN_DEEP_DIFFER("txInterval")
+	if (pA->m.dataElementsPresent != pB->m.dataElementsPresent) ASN_DEEP_DIFFER("dataElements")
+	else if (pA->m.dataElementsPresent)
+	{
+		ASN_DEEP_INTO("dataElements", AsnDeep_CmpList(pDiff, &pA->dataElements, &pB->dataElements, sizeof(VehicleStatusRequest), sCmp_VehicleStatusRequest))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_VehicleID(const void *pv)
+{
+	const VehicleID *pValue = (const VehicleID *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 1:
+			size += AsnDeep_SizePtr(pValue->u.entityID, sizeof(*pValue->u.entityID), HAE_NULL);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_VehicleID(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	VehicleID *pDst = (VehicleID *)pvDst;
+	const VehicleID *pSrc = (const VehicleID *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 1:
+			pDst->u.entityID = AsnDeep_CopyPtr(pArena, pSrc->u.entityID, sizeof(*pSrc->u.entityID), HAE_NULL);
+			break;
+		case 2:
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_VehicleID(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	VehicleID *pValue = (VehicleID *)pv;
+
+	switch (pValue->t)
+	{
+		case 1:
+			AsnDeep_RelocObj(pReloc, &pValue->u.entityID, sizeof(*pValue->u.entityID), sReloc_TemporaryID);
+			break;
+		case 2:
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_VehicleID(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VehicleID *pA = (const VehicleID *)pvA;
+	const VehicleID *pB = (const VehicleID *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			ASN_DEEP_INTO("entityID", AsnDeep_CmpPtr(pDiff, pA->u.entityID, pB->u.entityID, sizeof(*pA->u.entityID), sCmp_TemporaryID))
+			break;
+		case 2:
+			if (pA->u.stationID != pB->u.stationID) ASN_DEEP_DIFFER("stationID")
+			break;
+	}
+	return ret;
+}
+
+static int sCmp_VehicleIdent_vehicleClass(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VehicleIdent_vehicleClass *pA = (const VehicleIdent_vehicleClass *)pvA;
+	const VehicleIdent_vehicleClass *pB = (const VehicleIdent_vehicleClass *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			if (pA->u.vGroup != pB->u.vGroup) ASN_DEEP_DIFFER("vGroup")
+			break;
+		case 2:
+			if (pA->u.rGroup != pB->u.rGroup) ASN_DEEP_DIFFER("rGroup")
+			break;
+		case 3:
+			if (pA->u.rEquip != pB->u.rEquip) ASN_DEEP_DIFFER("rEquip")
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_VehicleIdent(const void *pv)
+{
+	const VehicleIdent *pValue = (const VehicleIdent *)pv;
+	size_t size = 0;
+
+	if (pValue->m.namePresent)
+	{
+		size += AsnDeep_SizeStr(pValue->name);
+	}
+	if (pValue->m.ownerCodePresent)
+	{
+		size += AsnDeep_SizeStr(pValue->ownerCode);
+	}
+	if (pValue->m.idPresent)
+	{
+		size += sSize_VehicleID(&pValue->id);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_VehicleIdent(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	VehicleIdent *pDst = (VehicleIdent *)pvDst;
+	const VehicleIdent *pSrc = (const VehicleIdent *)pvSrc;
+
+	if (pSrc->m.namePresent)
+	{
+		pDst->name = AsnDeep_CopyStr(pArena, pSrc->name);
+	}
+	else
+	{
+		memset(&pDst->name, 0x00, sizeof(pDst->name));
+	}
+	if (pSrc->m.ownerCodePresent)
+	{
+		pDst->ownerCode = AsnDeep_CopyStr(pArena, pSrc->ownerCode);
+	}
+	else
+	{
+		memset(&pDst->ownerCode, 0x00, sizeof(pDst->ownerCode));
+	}
+	if (pSrc->m.idPresent)
+	{
+		sCopy_VehicleID(pArena, &pDst->id, &pSrc->id);
+	}
+	else
+	{
+		memset(&pDst->id, 0x00, sizeof(pDst->id));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_VehicleIdent(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	VehicleIdent *pValue = (VehicleIdent *)pv;
+
+	if (pValue->m.namePresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->name);
+	}
+	if (pValue->m.vinPresent)
+	{
+		sReloc_VINstring(pReloc, &pValue->vin);
+	}
+	if (pValue->m.ownerCodePresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->ownerCode);
+	}
+	if (pValue->m.idPresent)
+	{
+		sReloc_VehicleID(pReloc, &pValue->id);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_VehicleIdent(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VehicleIdent *pA = (const VehicleIdent *)pvA;
+	const VehicleIdent *pB = (const VehicleIdent *)pvB;
+	int ret = 0;
+
+	if (pA->m.namePresent != pB->m.namePresent) ASN_DEEP_DIFFER("name")
+	else if (pA->m.namePresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->name, pB->name)) ASN_DEEP_DIFFER("name")
+	}
+	if (pA->m.vinPresent != pB->m.vinPresent) ASN_DEEP_DIFFER("vin")
+	else if (pA->m.vinPresent)
+	{
+		ASN_DEEP_INTO("vin", sCmp_VINstring(pDiff, &pA->vin, &pB->vin))
+	}
+	if (pA->m.ownerCodePresent != pB->m.ownerCodePresent) ASN_DEEP_DIFFER("ownerCode")
+	else if (pA->m.ownerCodePresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->ownerCode, pB->ownerCode)) ASN_DEEP_DIFFER("ownerCode")
+	}
+	if (pA->m.idPresent != pB->m.idPresent) ASN_DEEP_DIFFER("id")
+	else if (pA->m.idPresent)
+	{
+		ASN_DEEP_INTO("id", sCmp_VehicleID(pDiff, &pA->id, &pB->id))
+	}
+	if (pA->m.vehicleTypePresent != pB->m.vehicleTypePresent) ASN_DEEP_DIFFER("vehicleType")
+	else if (pA->m.vehicleTypePresent)
+	{
+		if (pA->vehicleType != pB->vehicleType) ASN_DEEP_DIFFER("vehicleType")
+	}
+	if (pA->m.vehicleClassPresent != pB->m.vehicleClassPresent) ASN_DEEP_DIFFER("vehicleClass")
+	else if (pA->m.vehicleClassPresent)
+	{
+		ASN_DEEP_INTO("vehicleClass", sCmp_VehicleIdent_vehicleClass(pDiff, &pA->vehicleClass, &pB->vehicleClass))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_VehicleClassification(const void *pv)
+{
+	const VehicleClassification *pValue = (const VehicleClassification *)pv;
+	size_t size = 0;
+
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_VehicleClassification(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	VehicleClassification *pDst = (VehicleClassification *)pvDst;
+	const VehicleClassification *pSrc = (const VehicleClassification *)pvSrc;
+
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_VehicleClassification(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	VehicleClassification *pValue = (VehicleClassification *)pv;
+
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_VehicleClassification(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VehicleClassification *pA = (const VehicleClassification *)pvA;
+	const VehicleClassification *pB = (const VehicleClassification *)pvB;
+	int ret = 0;
+
+	if (pA->m.keyTypePresent != pB->m.keyTypePresent) ASN_DEEP_DIFFER("keyType")
+	else if (pA->m.keyTypePresent)
+	{
+		if (pA->keyType != pB->keyType) ASN_DEEP_DIFFER("keyType")
+	}
+	if (pA->m.rolePresent != pB->m.rolePresent) ASN_DEEP_DIFFER("role")
+	else if (pA->m.rolePresent)
+	{
+		if (pA->role != pB->role) ASN_DEEP_DIFFER("role")
+	}
+	if (pA->m.iso3883Present != pB->m.iso3883Present) ASN_DEEP_DIFFER("iso3883")
+	else if (pA->m.iso3883Present)
+	{
+		if (pA->iso3883 != pB->iso3883) ASN_DEEP_DIFFER("iso3883")
+	}
+	if (pA->m.hpmsTypePresent != pB->m.hpmsTypePresent) ASN_DEEP_DIFFER("hpmsType")
+	else if (pA->m.hpmsTypePresent)
+	{
+		if (pA->hpmsType != pB->hpmsType) ASN_DEEP_DIFFER("hpmsType")
+	}
+	if (pA->m.vehicleTypePresent != pB->m.vehicleTypePresent) ASN_DEEP_DIFFER("vehicleType")
+	else if (pA->m.vehicleTypePresent)
+	{
+		if (pA->vehicleType != pB->vehicleType) ASN_DEEP_DIFFER("vehicleType")
+	}
+	if (pA->m.responseEquipPresent != pB->m.responseEquipPresent) ASN_DEEP_DIFFER("responseEquip")
+	else if (pA->m.responseEquipPresent)
+	{
+		if (pA->responseEquip != pB->responseEquip) ASN_DEEP_DIFFER("responseEquip")
+	}
+	if (pA->m.responderTypePresent != pB->m.responderTypePresent) ASN_DEEP_DIFFER("responderType")
+	else if (pA->m.responderTypePresent)
+	{
+		if (pA->responderType != pB->responderType) ASN_DEEP_DIFFER("responderType")
+	}
+	if (pA->m.fuelTypePresent != pB->m.fuelTypePresent) ASN_DEEP_DIFFER("fuelType")
+	else if (pA->m.fuelTypePresent)
+	{
+		if (pA->fuelType != pB->fuelType) ASN_DEEP_DIFFER("fuelType")
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_VehicleSafetyExtensions(const void *pv)
+{
+	const VehicleSafetyExtensions *pValue = (const VehicleSafetyExtensions *)pv;
+	size_t size = 0;
+
+	if (pValue->m.eventsPresent)
+	{
+		size += sSize_VehicleEventFlags(&pValue->events);
+	}
+	if (pValue->m.pathHistoryPresent)
+	{
+		size += sSize_PathHistory(&pValue->pathHistory);
+	}
+	if (pValue->m.pathPredictionPresent)
+	{
+		size += sSize_PathPrediction(&pValue->pathPrediction);
+	}
+	if (pValue->m.lightsPresent)
+	{
+		size += sSize_ExteriorLights(&pValue->lights);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_VehicleSafetyExtensions(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	VehicleSafetyExtensions *pDst = (VehicleSafetyExtensions *)pvDst;
+	const VehicleSafetyExtensions *pSrc = (const VehicleSafetyExtensions *)pvSrc;
+
+	if (pSrc->m.eventsPresent)
+	{
+		sCopy_VehicleEventFlags(pArena, &pDst->events, &pSrc->events);
+	}
+	else
+	{
+		memset(&pDst->events, 0x00, sizeof(pDst->events));
+	}
+	if (pSrc->m.pathHistoryPresent)
+	{
+		sCopy_PathHistory(pArena, &pDst->pathHistory, &pSrc->pathHistory);
+	}
+	else
+	{
+		memset(&pDst->pathHistory, 0x00, sizeof(pDst->pathHistory));
+	}
+	if (pSrc->m.pathPredictionPresent)
+	{
+		sCopy_PathPrediction(pArena, &pDst->pathPrediction, &pSrc->pathPrediction);
+	}
+	else
+	{
+		memset(&pDst->pathPrediction, 0x00, sizeof(pDst->pathPrediction));
+	}
+	if (pSrc->m.lightsPresent)
+	{
+		sCopy_ExteriorLights(pArena, &pDst->lights, &pSrc->lights);
+	}
+	else
+	{
+		memset(&pDst->lights, 0x00, sizeof(pDst->lights));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_VehicleSafetyExtensions(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	VehicleSafetyExtensions *pValue = (VehicleSafetyExtensions *)pv;
+
+	if (pValue->m.eventsPresent)
+	{
+		sReloc_VehicleEventFlags(pReloc, &pValue->events);
+	}
+	if (pValue->m.pathHistoryPresent)
+	{
+		sReloc_PathHistory(pReloc, &pValue->pathHistory);
+	}
+	if (pValue->m.pathPredictionPresent)
+	{
+		sReloc_PathPrediction(pReloc, &pValue->pathPrediction);
+	}
+	if (pValue->m.lightsPresent)
+	{
+		sReloc_ExteriorLights(pReloc, &pValue->lights);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_VehicleSafetyExtensions(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VehicleSafetyExtensions *pA = (const VehicleSafetyExtensions *)pvA;
+	const VehicleSafetyExtensions *pB = (const VehicleSafetyExtensions *)pvB;
+	int ret = 0;
+
+	if (pA->m.eventsPresent != pB->m.eventsPresent) ASN_DEEP_DIFFER("events")
+	else if (pA->m.eventsPresent)
+	{
+		ASN_DEEP_INTO("events", sCmp_VehicleEventFlags(pDiff, &pA->events, &pB->events))
+	}
+	if (pA->m.pathHistoryPresent != pB->m.pathHistoryPresent) ASN_DEEP_DIFFER("pathHistory")
+	else if (pA->m.pathHistoryPresent)
+	{
+		ASN_DEEP_INTO("pathHistory", sCmp_PathHistory(pDiff, &pA->pathHistory, &pB->pathHistory))
+	}
+	if (pA->m.pathPredictionPresent != pB->m.pathPredictionPresent) ASN_DEEP_DIFFER("pathPrediction")
+	else if (pA->m.pathPredictionPresent)
+	{
+		ASN_DEEP_INTO("pathPrediction", sCmp_PathPrediction(pDiff, &pA->pathPrediction, &pB->pathPrediction))
+	}
+	if (pA->m.lightsPresent != pB->m.lightsPresent) ASN_DEEP_DIFFER("lights")
+	else if (pA->m.lightsPresent)
+	{
+		ASN_DEEP_INTO("lights", sCmp_ExteriorLights(pDiff, &pA->lights, &pB->lights))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static int sCmp_WiperSet(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const WiperSet *pA = (const WiperSet *)pvA;
+	const WiperSet *pB = (const WiperSet *)pvB;
+	int ret = 0;
+
+	if (pA->statusFront != pB->statusFront) ASN_DEEP_DIFFER("statusFront")
+	if (pA->rateFront != pB->rateFront) ASN_DEEP_DIFFER("rateFront")
+	if (pA->m.statusRearPresent != pB->m.statusRearPresent) ASN_DEEP_DIFFER("statusRear")
+	else if (pA->m.statusRearPresent)
+	{
+		if (pA->statusRear != pB->statusRear) ASN_DEEP_DIFFER("statusRear")
+	}
+	if (pA->m.rateRearPresent != pB->m.rateRearPresent) ASN_DEEP_DIFFER("rateRear")
+	else if (pA->m.rateRearPresent)
+	{
+		if (pA->rateRear != pB->rateRear) ASN_DEEP_DIFFER("rateRear")
+	}
+	return ret;
+}
+
+static int sCmp_VehicleStatus_steering(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VehicleStatus_steering *pA = (const VehicleStatus_steering *)pvA;
+	const VehicleStatus_steering *pB = (const VehicleStatus_steering *)pvB;
+	int ret = 0;
+
+	if (pA->angle != pB->angle) ASN_DEEP_DIFFER("angle")
+	if (pA->m.confidencePresent != pB->m.confidencePresent) ASN_DEEP_DIFFER("confidence")
+	else if (pA->m.confidencePresent)
+	{
+		if (pA->confidence != pB->confidence) ASN_DEEP_DIFFER("confidence")
+	}
+	if (pA->m.ratePresent != pB->m.ratePresent) ASN_DEEP_DIFFER("rate")
+	else if (pA->m.ratePresent)
+	{
+		if (pA->rate != pB->rate) ASN_DEEP_DIFFER("rate")
+	}
+	if (pA->m.wheelsPresent != pB->m.wheelsPresent) ASN_DEEP_DIFFER("wheels")
+	else if (pA->m.wheelsPresent)
+	{
+		if (pA->wheels != pB->wheels) ASN_DEEP_DIFFER("wheels")
+	}
+	return ret;
+}
+
+static int sCmp_AccelSteerYawRateConfidence(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const AccelSteerYawRateConfidence *pA = (const AccelSteerYawRateConfidence *)pvA;
+	const AccelSteerYawRateConfidence *pB = (const AccelSteerYawRateConfidence *)pvB;
+	int ret = 0;
+
+	if (pA->yawRate != pB->yawRate) ASN_DEEP_DIFFER("yawRate")
+	if (pA->acceleration != pB->acceleration) ASN_DEEP_DIFFER("acceleration")
+	if (pA->steeringWheelAngle != pB->steeringWheelAngle) ASN_DEEP_DIFFER("steeringWheelAngle")
+	return ret;
+}
+
+static size_t sSize_ConfidenceSet(const void *pv)
+{
+	const ConfidenceSet *pValue = (const ConfidenceSet *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_ConfidenceSet(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	ConfidenceSet *pDst = (ConfidenceSet *)pvDst;
+	const ConfidenceSet *pSrc = (const ConfidenceSet *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_ConfidenceSet(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	ConfidenceSet *pValue = (ConfidenceSet *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_ConfidenceSet(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ConfidenceSet *pA = (const ConfidenceSet *)pvA;
+	const ConfidenceSet *pB = (const ConfidenceSet *)pvB;
+	int ret = 0;
+
+	if (pA->m.accelConfidencePresent != pB->m.accelConfidencePresent) ASN_DEEP_DIFFER("accelConfidence")
+	else if (pA->m.accelConfidencePresent)
+	{
+		ASN_DEEP_INTO("accelConfidence", sCmp_AccelSteerYawRateConfidence(pDiff, &pA->accelConfidence, &pB->accelConfidence))
+	}
+	if (pA->m.speedConfidencePresent != pB->m.speedConfidencePresent) ASN_DEEP_DIFFER("speedConfidence")
+	else if (pA->m.speedConfidencePresent)
+	{
+		ASN_DEEP_INTO("speedConfidence", sCmp_SpeedandHeadingandThrottleConfidence(pDiff, &pA->speedConfidence, &pB->speedConfidence))
+	}
+	if (pA->m.timeConfidencePresent != pB->m.timeConfidencePresent) ASN_DEEP_DIFFER("timeConfidence")
+	else if (pA->m.timeConfidencePresent)
+	{
+		if (pA->timeConfidence != pB->timeConfidence) ASN_DEEP_DIFFER("timeConfidence")
+	}
+	if (pA->m.posConfidencePresent != pB->m.posConfidencePresent) ASN_DEEP_DIFFER("posConfidence")
+	else if (pA->m.posConfidencePresent)
+	{
+		ASN_DEEP_INTO("posConfidence", sCmp_PositionConfidenceSet(pDiff, &pA->posConfidence, &pB->posConfidence))
+	}
+	if (pA->m.steerConfidencePresent != pB->m.steerConfidencePresent) ASN_DEEP_DIFFER("steerConfidence")
+	else if (pA->m.steerConfidencePresent)
+	{
+		if (pA->steerConfidence != pB->steerConfidence) ASN_DEEP_DIFFER("steerConfidence")
+	}
+	if (pA->m.headingConfidencePresent != pB->m.headingConfidencePresent) ASN_DEEP_DIFFER("headingConfidence")
+	else if (pA->m.headingConfidencePresent)
+	{
+		if (pA->headingConfidence != pB->headingConfidence) ASN_DEEP_DIFFER("headingConfidence")
+	}
+	if (pA->m.throttleConfidencePresent != pB->m.throttleConfidencePresent) ASN_DEEP_DIFFER("throttleConfidence")
+	else if (pA->m.throttleConfidencePresent)
+	{
+		if (pA->throttleConfidence != pB->throttleConfidence) ASN_DEEP_DIFFER("throttleConfidence")
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_VehicleStatus_accelSets(const void *pv)
+{
+	const VehicleStatus_accelSets *pValue = (const VehicleStatus_accelSets *)pv;
+	size_t size = 0;
+
+	if (pValue->m.confidenceSetPresent)
+	{
+		size += sSize_ConfidenceSet(&pValue->confidenceSet);
+	}
+	return size;
+}
+
+static void sCopy_VehicleStatus_accelSets(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	VehicleStatus_accelSets *pDst = (VehicleStatus_accelSets *)pvDst;
+	const VehicleStatus_accelSets *pSrc = (const VehicleStatus_accelSets *)pvSrc;
+
+	if (pSrc->m.confidenceSetPresent)
+	{
+		sCopy_ConfidenceSet(pArena, &pDst->confidenceSet, &pSrc->confidenceSet);
+	}
+	else
+	{
+		memset(&pDst->confidenceSet, 0x00, sizeof(pDst->confidenceSet));
+	}
+}
+
+static void sReloc_VehicleStatus_accelSets(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	VehicleStatus_accelSets *pValue = (VehicleStatus_accelSets *)pv;
+
+	if (pValue->m.vertAccelThresPresent)
+	{
+		sReloc_VerticalAccelerationThreshold(pReloc, &pValue->vertAccelThres);
+	}
+	if (pValue->m.confidenceSetPresent)
+	{
+		sReloc_ConfidenceSet(pReloc, &pValue->confidenceSet);
+	}
+}
+
+static int sCmp_VehicleStatus_accelSets(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VehicleStatus_accelSets *pA = (const VehicleStatus_accelSets *)pvA;
+	const VehicleStatus_accelSets *pB = (const VehicleStatus_accelSets *)pvB;
+	int ret = 0;
+
+	if (pA->m.accel4wayPresent != pB->m.accel4wayPresent) ASN_DEEP_DIFFER("accel4way")
+	else if (pA->m.accel4wayPresent)
+	{
+		ASN_DEEP_INTO("accel4way", sCmp_AccelerationSet4Way(pDiff, &pA->accel4way, &pB->accel4way))
+	}
+	if (pA->m.vertAccelThresPresent != pB->m.vertAccelThresPresent) ASN_DEEP_DIFFER("vertAccelThres")
+	else if (pA->m.vertAccelThresPresent)
+	{
+		ASN_DEEP_INTO("vertAccelThres", sCmp_VerticalAccelerationThreshold(pDiff, &pA->vertAccelThres, &pB->vertAccelThres))
+	}
+	if (pA->m.yawRateConPresent != pB->m.yawRateConPresent) ASN_DEEP_DIFFER("yawRateCon")
+	else if (pA->m.yawRateConPresent)
+	{
+		if (pA->yawRateCon != pB->yawRateCon) ASN_DEEP_DIFFER("yawRateCon")
+	}
+	if (pA->m.hozAccelConPresent != pB->m.hozAccelConPresent) ASN_DEEP_DIFFER("hozAccelCon")
+	else if (pA->m.hozAccelConPresent)
+	{
+		if (pA->hozAccelCon != pB->hozAccelCon) ASN_DEEP_DIFFER("hozAccelCon")
+	}
+	if (pA->m.confidenceSetPresent != pB->m.confidenceSetPresent) ASN_DEEP_DIFFER("confidenceSet")
+	else if (pA->m.confidenceSetPresent)
+	{
+		ASN_DEEP_INTO("confidenceSet", sCmp_ConfidenceSet(pDiff, &pA->confidenceSet, &pB->confidenceSet))
+	}
+	return ret;
+}
+
+static int sCmp_VehicleStatus_object(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VehicleStatus_object *pA = (const VehicleStatus_object *)pvA;
+	const VehicleStatus_object *pB = (const VehicleStatus_object *)pvB;
+	int ret = 0;
+
+	if (pA->obDist != pB->obDist) ASN_DEEP_DIFFER("obDist")
+	if (pA->obDirect != pB->obDirect) ASN_DEEP_DIFFER("obDirect")
+	ASN_DEEP_INTO("dateTime", sCmp_DDateTime(pDiff, &pA->dateTime, &pB->dateTime))
+	return ret;
+}
+
+static int sCmp_BumperHeights(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const BumperHeights *pA = (const BumperHeights *)pvA;
+	const BumperHeights *pB = (const BumperHeights *)pvB;
+	int ret = 0;
+
+	if (pA->front != pB->front) ASN_DEEP_DIFFER("front")
+	if (pA->rear != pB->rear) ASN_DEEP_DIFFER("rear")
+	return ret;
+}
+
+static int sCmp_VehicleStatus_vehicleData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VehicleStatus_vehicleData *pA = (const VehicleStatus_vehicleData *)pvA;
+	const VehicleStatus_vehicleData *pB = (const VehicleStatus_vehicleData *)pvB;
+	int ret = 0;
+
+	if (pA->height != pB->height) ASN_DEEP_DIFFER("height")
+	ASN_DEEP_INTO("bumpers", sCmp_BumperHeights(pDiff, &pA->bumpers, &pB->bumpers))
+	if (pA->mass != pB->mass) ASN_DEEP_DIFFER("mass")
+	if (pA->trailerWeight != pB->trailerWeight) ASN_DEEP_DIFFER("trailerWeight")
+	if (pA->type != pB->type) ASN_DEEP_DIFFER("type")
+	return ret;
+}
+
+static size_t sSize_TireData(const void *pv)
+{
+	const TireData *pValue = (const TireData *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TireData(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TireData *pDst = (TireData *)pvDst;
+	const TireData *pSrc = (const TireData *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TireData(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TireData *pValue = (TireData *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TireData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TireData *pA = (const TireData *)pvA;
+	const TireData *pB = (const TireData *)pvB;
+	int ret = 0;
+
+	if (pA->m.locationPresent != pB->m.locationPresent) ASN_DEEP_DIFFER("location")
+	else if (pA->m.locationPresent)
+	{
+		if (pA->location != pB->location) ASN_DEEP_DIFFER("location")
+	}
+	if (pA->m.pressurePresent != pB->m.pressurePresent) ASN_DEEP_DIFFER("pressure")
+	else if (pA->m.pressurePresent)
+	{
+		if (pA->pressure != pB->pressure) ASN_DEEP_DIFFER("pressure")
+	}
+	if (pA->m.tempPresent != pB->m.tempPresent) ASN_DEEP_DIFFER("temp")
+	else if (pA->m.tempPresent)
+	{
+		if (pA->temp != pB->temp) ASN_DEEP_DIFFER("temp")
+	}
+	if (pA->m.wheelSensorStatusPresent != pB->m.wheelSensorStatusPresent) ASN_DEEP_DIFFER("wheelSensorStatus")
+	else if (pA->m.wheelSensorStatusPresent)
+	{
+		if (pA->wheelSensorStatus != pB->wheelSensorStatus) ASN_DEEP_DIFFER("wheelSensorStatus")
+	}
+	if (pA->m.wheelEndElectFaultPresent != pB->m.wheelEndElectFaultPresent) ASN_DEEP_DIFFER("wheelEndElectFault")
+	else if (pA->m.wheelEndElectFaultPresent)
+	{
+		if (pA->wheelEndElectFault != pB->wheelEndElectFault) ASN_DEEP_DIFFER("wheelEndElectFault")
+	}
+	if (pA->m.leakageRatePresent != pB->m.leakageRatePresent) ASN_DEEP_DIFFER("leakageRate")
+	else if (pA->m.leakageRatePresent)
+	{
+		if (pA->leakageRate != pB->leakageRate) ASN_DEEP_DIFFER("leakageRate")
+	}
+	if (pA->m.detectionPresent != pB->m.detectionPresent) ASN_DEEP_DIFFER("detection")
+	else if (pA->m.detectionPresent)
+	{
+		if (pA->detection != pB->detection) ASN_DEEP_DIFFER("detection")
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_AxleWeightSet(const void *pv)
+{
+	const AxleWeightSet *pValue = (const AxleWeightSet *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_AxleWeightSet(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	AxleWeightSet *pDst = (AxleWeightSet *)pvDst;
+	const AxleWeightSet *pSrc = (const AxleWeightSet *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_AxleWeightSet(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	AxleWeightSet *pValue = (AxleWeightSet *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_AxleWeightSet(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const AxleWeightSet *pA = (const AxleWeightSet *)pvA;
+	const AxleWeightSet *pB = (const AxleWeightSet *)pvB;
+	int ret = 0;
+
+	if (pA->m.locationPresent != pB->m.locationPresent) ASN_DEEP_DIFFER("location")
+	else if (pA->m.locationPresent)
+	{
+		if (pA->location != pB->location) ASN_DEEP_DIFFER("location")
+	}
+	if (pA->m.weightPresent != pB->m.weightPresent) ASN_DEEP_DIFFER("weight")
+	else if (pA->m.weightPresent)
+	{
+		if (pA->weight != pB->weight) ASN_DEEP_DIFFER("weight")
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_J1939data(const void *pv)
+{
+	const J1939data *pValue = (const J1939data *)pv;
+	size_t size = 0;
+
+	if (pValue->m.tiresPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->tires, sizeof(TireData), sSize_TireData);
+	}
+	if (pValue->m.axlesPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->axles, sizeof(AxleWeightSet), sSize_AxleWeightSet);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_J1939data(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	J1939data *pDst = (J1939data *)pvDst;
+	const J1939data *pSrc = (const J1939data *)pvSrc;
+
+	if (pSrc->m.tiresPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->tires, &pSrc->tires, sizeof(TireData), sCopy_TireData);
+	}
+	else
+	{
+		memset(&pDst->tires, 0x00, sizeof(pDst->tires));
+	}
+	if (pSrc->m.axlesPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->axles, &pSrc->axles, sizeof(AxleWeightSet), sCopy_AxleWeightSet);
+	}
+	else
+	{
+		memset(&pDst->axles, 0x00, sizeof(pDst->axles));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_J1939data(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	J1939data *pValue = (J1939data *)pv;
+
+	if (pValue->m.tiresPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->tires, sizeof(TireData), sReloc_TireData);
+	}
+	if (pValue->m.axlesPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->axles, sizeof(AxleWeightSet), sReloc_AxleWeightSet);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_J1939data(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const J1939data *pA = (const J1939data *)pvA;
+	const J1939data *pB = (const J1939data *)pvB;
+	int ret = 0;
+
+	if (pA->m.tiresPresent != pB->m.tiresPresent) ASN_DEEP_DIFFER("tires")
+	else if (pA->m.tiresPresent)
+	{
+		ASN_DEEP_INTO("tires", AsnDeep_CmpList(pDiff, &pA->tires, &pB->tires, sizeof(TireData), sCmp_TireData))
+	}
+	if (pA->m.axlesPresent != pB->m.axlesPresent) ASN_DEEP_DIFFER("axles")
+	else if (pA->m.axlesPresent)
+	{
+		ASN_DEEP_INTO("axles", AsnDeep_CmpList(pDiff, &pA->axles, &pB->axles, sizeof(AxleWeightSet), sCmp_AxleWeightSet))
+	}
+	if (pA->m.trailerWeightPresent != pB->m.trailerWeightPresent) ASN_DEEP_DIFFER("trailerWeight")
+	else if (pA->m.trailerWeightPresent)
+	{
+		if (pA->trailerWeight != pB->trailerWeight) ASN_DEEP_DIFFER("trailerWeight")
+	}
+	if (pA->m.cargoWeightPresent != pB->m.cargoWeightPresent) ASN_DEEP_DIFFER("cargoWeight")
+	else if (pA->m.cargoWeightPresent)
+	{
+		if (pA->cargoWeight != pB->cargoWeight) ASN_DEEP_DIFFER("cargoWeight")
+	}
+	if (pA->m.steeringAxleTemperaturePresent != pB->m.steeringAxleTemperaturePresent) ASN_DEEP_DIFFER("steeringAxleTemperature")
+	else if (pA->m.steeringAxleTemperaturePresent)
+	{
+		if (pA->steeringAxleTemperature != pB->steeringAxleTemperature) ASN_DEEP_DIFFER("steeringAxleTemperature")
+	}
+	if (pA->m.driveAxleLocationPresent != pB->m.driveAxleLocationPresent) ASN_DEEP_DIFFER("driveAxleLocation")
+	else if (pA->m.driveAxleLocationPresent)
+	{
+		if (pA->driveAxleLocation != pB->driveAxleLocation) ASN_DEEP_DIFFER("driveAxleLocation")
+	}
+	if (pA->m.driveAxleLiftAirPressurePresent != pB->m.driveAxleLiftAirPressurePresent) ASN_DEEP_DIFFER("driveAxleLiftAirPressure")
+	else if (pA->m.driveAxleLiftAirPressurePresent)
+	{
+		if (pA->driveAxleLiftAirPressure != pB->driveAxleLiftAirPressure) ASN_DEEP_DIFFER("driveAxleLiftAirPressure")
+	}
+	if (pA->m.driveAxleTemperaturePresent != pB->m.driveAxleTemperaturePresent) ASN_DEEP_DIFFER("driveAxleTemperature")
+	else if (pA->m.driveAxleTemperaturePresent)
+	{
+		if (pA->driveAxleTemperature != pB->driveAxleTemperature) ASN_DEEP_DIFFER("driveAxleTemperature")
+	}
+	if (pA->m.driveAxleLubePressurePresent != pB->m.driveAxleLubePressurePresent) ASN_DEEP_DIFFER("driveAxleLubePressure")
+	else if (pA->m.driveAxleLubePressurePresent)
+	{
+		if (pA->driveAxleLubePressure != pB->driveAxleLubePressure) ASN_DEEP_DIFFER("driveAxleLubePressure")
+	}
+	if (pA->m.steeringAxleLubePressurePresent != pB->m.steeringAxleLubePressurePresent) ASN_DEEP_DIFFER("steeringAxleLubePressure")
+	else if (pA->m.steeringAxleLubePressurePresent)
+	{
+		if (pA->steeringAxleLubePressure != pB->steeringAxleLubePressure) ASN_DEEP_DIFFER("steeringAxleLubePressure")
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static int sCmp_VehicleStatus_weatherReport(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VehicleStatus_weatherReport *pA = (const VehicleStatus_weatherReport *)pvA;
+	const VehicleStatus_weatherReport *pB = (const VehicleStatus_weatherReport *)pvB;
+	int ret = 0;
+
+	if (pA->isRaining != pB->isRaining) ASN_DEEP_DIFFER("isRaining")
+	if (pA->m.rainRatePresent != pB->m.rainRatePresent) ASN_DEEP_DIFFER("rainRate")
+	else if (pA->m.rainRatePresent)
+	{
+		if (pA->rainRate != pB->rainRate) ASN_DEEP_DIFFER("rainRate")
+	}
+	if (pA->m.precipSituationPresent != pB->m.precipSituationPresent) ASN_DEEP_DIFFER("precipSituation")
+	else if (pA->m.precipSituationPresent)
+	{
+		if (pA->precipSituation != pB->precipSituation) ASN_DEEP_DIFFER("precipSituation")
+	}
+	if (pA->m.solarRadiationPresent != pB->m.solarRadiationPresent) ASN_DEEP_DIFFER("solarRadiation")
+	else if (pA->m.solarRadiationPresent)
+	{
+		if (pA->solarRadiation != pB->solarRadiation) ASN_DEEP_DIFFER("solarRadiation")
+	}
+	if (pA->m.frictionPresent != pB->m.frictionPresent) ASN_DEEP_DIFFER("friction")
+	else if (pA->m.frictionPresent)
+	{
+		if (pA->friction != pB->friction) ASN_DEEP_DIFFER("friction")
+	}
+	return ret;
+}
+
+static size_t sSize_VehicleStatus(const void *pv)
+{
+	const VehicleStatus *pValue = (const VehicleStatus *)pv;
+	size_t size = 0;
+
+	if (pValue->m.lightsPresent)
+	{
+		size += sSize_ExteriorLights(&pValue->lights);
+	}
+	if (pValue->m.accelSetsPresent)
+	{
+		size += sSize_VehicleStatus_accelSets(&pValue->accelSets);
+	}
+	if (pValue->m.fullPosPresent)
+	{
+		size += sSize_FullPositionVector(&pValue->fullPos);
+	}
+	if (pValue->m.vehicleIdentPresent)
+	{
+		size += sSize_VehicleIdent(&pValue->vehicleIdent);
+	}
+	if (pValue->m.j1939dataPresent)
+	{
+		size += sSize_J1939data(&pValue->j1939data);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_VehicleStatus(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	VehicleStatus *pDst = (VehicleStatus *)pvDst;
+	const VehicleStatus *pSrc = (const VehicleStatus *)pvSrc;
+
+	if (pSrc->m.lightsPresent)
+	{
+		sCopy_ExteriorLights(pArena, &pDst->lights, &pSrc->lights);
+	}
+	else
+	{
+		memset(&pDst->lights, 0x00, sizeof(pDst->lights));
+	}
+	if (pSrc->m.accelSetsPresent)
+	{
+		sCopy_VehicleStatus_accelSets(pArena, &pDst->accelSets, &pSrc->accelSets);
+	}
+	else
+	{
+		memset(&pDst->accelSets, 0x00, sizeof(pDst->accelSets));
+	}
+	if (pSrc->m.fullPosPresent)
+	{
+		sCopy_FullPositionVector(pArena, &pDst->fullPos, &pSrc->fullPos);
+	}
+	else
+	{
+		memset(&pDst->fullPos, 0x00, sizeof(pDst->fullPos));
+	}
+	if (pSrc->m.vehicleIdentPresent)
+	{
+		sCopy_VehicleIdent(pArena, &pDst->vehicleIdent, &pSrc->vehicleIdent);
+	}
+	else
+	{
+		memset(&pDst->vehicleIdent, 0x00, sizeof(pDst->vehicleIdent));
+	}
+	if (pSrc->m.j1939dataPresent)
+	{
+		sCopy_J1939data(pArena, &pDst->j1939data, &pSrc->j1939data);
+	}
+	else
+	{
+		memset(&pDst->j1939data, 0x00, sizeof(pDst->j1939data));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_VehicleStatus(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	VehicleStatus *pValue = (VehicleStatus *)pv;
+
+	if (pValue->m.lightsPresent)
+	{
+		sReloc_ExteriorLights(pReloc, &pValue->lights);
+	}
+	if (pValue->m.brakeStatusPresent)
+	{
+		sReloc_BrakeSystemStatus(pReloc, &pValue->brakeStatus);
+	}
+	if (pValue->m.accelSetsPresent)
+	{
+		sReloc_VehicleStatus_accelSets(pReloc, &pValue->accelSets);
+	}
+	if (pValue->m.fullPosPresent)
+	{
+		sReloc_FullPositionVector(pReloc, &pValue->fullPos);
+	}
+	if (pValue->m.vehicleIdentPresent)
+	{
+		sReloc_VehicleIdent(pReloc, &pValue->vehicleIdent);
+	}
+	if (pValue->m.j1939dataPresent)
+	{
+		sReloc_J1939data(pReloc, &pValue->j1939data);
+	}
+	if (pValue->m.gnssStatusPresent)
+	{
+		sReloc_GNSSstatus(pReloc, &pValue->gnssStatus);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_VehicleStatus(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VehicleStatus *pA = (const VehicleStatus *)pvA;
+	const VehicleStatus *pB = (const VehicleStatus *)pvB;
+	int ret = 0;
+
+	if (pA->m.lightsPresent != pB->m.lightsPresent) ASN_DEEP_DIFFER("lights")
+	else if (pA->m.lightsPresent)
+	{
+		ASN_DEEP_INTO("lights", sCmp_ExteriorLights(pDiff, &pA->lights, &pB->lights))
+	}
+	if (pA->m.lightBarPresent != pB->m.lightBarPresent) ASN_DEEP_DIFFER("lightBar")
+	else if (pA->m.lightBarPresent)
+	{
+		if (pA->lightBar != pB->lightBar) ASN_DEEP_DIFFER("lightBar")
+	}
+	if (pA->m.wipersPresent != pB->m.wipersPresent) ASN_DEEP_DIFFER("wipers")
+	else if (pA->m.wipersPresent)
+	{
+		ASN_DEEP_INTO("wipers", sCmp_WiperSet(pDiff, &pA->wipers, &pB->wipers))
+	}
+	if (pA->m.brakeStatusPresent != pB->m.brakeStatusPresent) ASN_DEEP_DIFFER("brakeStatus")
+	else if (pA->m.brakeStatusPresent)
+	{
+		ASN_DEEP_INTO("brakeStatus", sCmp_BrakeSystemStatus(pDiff, &pA->brakeStatus, &pB->brakeStatus))
+	}
+	if (pA->m.brakePressurePresent != pB->m.brakePressurePresent) ASN_DEEP_DIFFER("brakePressure")
+	else if (pA->m.brakePressurePresent)
+	{
+		if (pA->brakePressure != pB->brakePressure) ASN_DEEP_DIFFER("brakePressure")
+	}
+	if (pA->m.roadFrictionPresent != pB->m.roadFrictionPresent) ASN_DEEP_DIFFER("roadFriction")
+	else if (pA->m.roadFrictionPresent)
+	{
+		if (pA->roadFriction != pB->roadFriction) ASN_DEEP_DIFFER("roadFriction")
+	}
+	if (pA->m.sunDataPresent != pB->m.sunDataPresent) ASN_DEEP_DIFFER("sunData")
+	else if (pA->m.sunDataPresent)
+	{
+		if (pA->sunData != pB->sunData) ASN_DEEP_DIFFER("sunData")
+	}
+	if (pA->m.rainDataPresent != pB->m.rainDataPresent) ASN_DEEP_DIFFER("rainData")
+	else if (pA->m.rainDataPresent)
+	{
+		if (pA->rainData != pB->rainData) ASN_DEEP_DIFFER("rainData")
+	}
+	if (pA->m.airTempPresent != pB->m.airTempPresent) ASN_DEEP_DIFFER("airTemp")
+	else if (pA->m.airTempPresent)
+	{
+		if (pA->airTemp != pB->airTemp) ASN_DEEP_DIFFER("airTemp")
+	}
+	if (pA->m.airPresPresent != pB->m.airPresPresent) ASN_DEEP_DIFFER("airPres")
+	else if (pA->m.airPresPresent)
+	{
+		if (pA->airPres != pB->airPres) ASN_DEEP_DIFFER("airPres")
+	}
+	if (pA->m.steeringPresent != pB->m.steeringPresent) ASN_DEEP_DIFFER("steering")
+	else if (pA->m.steeringPresent)
+	{
+		ASN_DEEP_INTO("steering", sCmp_VehicleStatus_steering(pDiff, &pA->steering, &pB->steering))
+	}
+	if (pA->m.accelSetsPresent != pB->m.accelSetsPresent) ASN_DEEP_DIFFER("accelSets")
+	else if (pA->m.accelSetsPresent)
+	{
+		ASN_DEEP_INTO("accelSets", sCmp_VehicleStatus_accelSets(pDiff, &pA->accelSets, &pB->accelSets))
+	}
+	if (pA->m.objectPresent != pB->m.objectPresent) ASN_DEEP_DIFFER("object")
+	else if (pA->m.objectPresent)
+	{
+		ASN_DEEP_INTO("object", sCmp_VehicleStatus_object(pDiff, &pA->object, &pB->object))
+	}
+	if (pA->m.fullPosPresent != pB->m.fullPosPresent) ASN_DEEP_DIFFER("fullPos")
+	else if (pA->m.fullPosPresent)
+	{
+		ASN_DEEP_INTO("fullPos", sCmp_FullPositionVector(pDiff, &pA->fullPos, &pB->fullPos))
+	}
+	if (pA->m.throttlePosPresent != pB->m.throttlePosPresent) ASN_DEEP_DIFFER("throttlePos")
+	else if (pA->m.throttlePosPresent)
+	{
+		if (pA->throttlePos != pB->throttlePos) ASN_DEEP_DIFFER("throttlePos")
+	}
+	if (pA->m.speedHeadCPresent != pB->m.speedHeadCPresent) ASN_DEEP_DIFFER("speedHeadC")
+	else if (pA->m.speedHeadCPresent)
+	{
+		ASN_DEEP_INTO("speedHeadC", sCmp_SpeedandHeadingandThrottleConfidence(pDiff, &pA->speedHeadC, &pB->speedHeadC))
+	}
+	if (pA->m.speedCPresent != pB->m.speedCPresent) ASN_DEEP_DIFFER("speedC")
+	else if (pA->m.speedCPresent)
+	{
+		if (pA->speedC != pB->speedC) ASN_DEEP_DIFFER("speedC")
+	}
+	if (pA->m.vehicleDataPresent != pB->m.vehicleDataPresent) ASN_DEEP_DIFFER("vehicleData")
+	else if (pA->m.vehicleDataPresent)
+	{
+		ASN_DEEP_INTO("vehicleData", sCmp_VehicleStatus_vehicleData(pDiff, &pA->vehicleData, &pB->vehicleData))
+	}
+	if (pA->m.vehicleIdentPresent != pB->m.vehicleIdentPresent) ASN_DEEP_DIFFER("vehicleIdent")
+	else if (pA->m.vehicleIdentPresent)
+	{
+		ASN_DEEP_INTO("vehicleIdent", sCmp_VehicleIdent(pDiff, &pA->vehicleIdent, &pB->vehicleIdent))
+	}
+	if (pA->m.j1939dataPresent != pB->m.j1939dataPresent) ASN_DEEP_DIFFER("j1939data")
+	else if (pA->m.j1939dataPresent)
+	{
+		ASN_DEEP_INTO("j1939data", sCmp_J1939data(pDiff, &pA->j1939data, &pB->j1939data))
+	}
+	if (pA->m.weatherReportPresent != pB->m.weatherReportPresent) ASN_DEEP_DIFFER("weatherReport")
+	else if (pA->m.weatherReportPresent)
+	{
+		ASN_DEEP_INTO("weatherReport", sCmp_VehicleStatus_weatherReport(pDiff, &pA->weatherReport, &pB->weatherReport))
+	}
+	if (pA->m.gnssStatusPresent != pB->m.gnssStatusPresent) ASN_DEEP_DIFFER("gnssStatus")
+	else if (pA->m.gnssStatusPresent)
+	{
+		ASN_DEEP_INTO("gnssStatus", sCmp_GNSSstatus(pDiff, &pA->gnssStatus, &pB->gnssStatus))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_Snapshot(const void *pv)
+{
+	const Snapshot *pValue = (const Snapshot *)pv;
+	size_t size = 0;
+
+	size += sSize_FullPositionVector(&pValue->thePosition);
+	if (pValue->m.safetyExtPresent)
+	{
+		size += sSize_VehicleSafetyExtensions(&pValue->safetyExt);
+	}
+	if (pValue->m.dataSetPresent)
+	{
+		size += sSize_VehicleStatus(&pValue->dataSet);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_Snapshot(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	Snapshot *pDst = (Snapshot *)pvDst;
+	const Snapshot *pSrc = (const Snapshot *)pvSrc;
+
+	sCopy_FullPositionVector(pArena, &pDst->thePosition, &pSrc->thePosition);
+	if (pSrc->m.safetyExtPresent)
+	{
+		sCopy_VehicleSafetyExtensions(pArena, &pDst->safetyExt, &pSrc->safetyExt);
+	}
+	else
+	{
+		memset(&pDst->safetyExt, 0x00, sizeof(pDst->safetyExt));
+	}
+	if (pSrc->m.dataSetPresent)
+	{
+		sCopy_VehicleStatus(pArena, &pDst->dataSet, &pSrc->dataSet);
+	}
+	else
+	{
+		memset(&pDst->dataSet, 0x00, sizeof(pDst->dataSet));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_Snapshot(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	Snapshot *pValue = (Snapshot *)pv;
+
+	sReloc_FullPositionVector(pReloc, &pValue->thePosition);
+	if (pValue->m.safetyExtPresent)
+	{
+		sReloc_VehicleSafetyExtensions(pReloc, &pValue->safetyExt);
+	}
+	if (pValue->m.dataSetPresent)
+	{
+		sReloc_VehicleStatus(pReloc, &pValue->dataSet);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_Snapshot(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Snapshot *pA = (const Snapshot *)pvA;
+	const Snapshot *pB = (const Snapshot *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("thePosition", sCmp_FullPositionVector(pDiff, &pA->thePosition, &pB->thePosition))
+	if (pA->m.safetyExtPresent != pB->m.safetyExtPresent) ASN_DEEP_DIFFER("safetyExt")
+	else if (pA->m.safetyExtPresent)
+	{
+		ASN_DEEP_INTO("safetyExt", sCmp_VehicleSafetyExtensions(pDiff, &pA->safetyExt, &pB->safetyExt))
+	}
+	if (pA->m.dataSetPresent != pB->m.dataSetPresent) ASN_DEEP_DIFFER("dataSet")
+	else if (pA->m.dataSetPresent)
+	{
+		ASN_DEEP_INTO("dataSet", sCmp_VehicleStatus(pDiff, &pA->dataSet, &pB->dataSet))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_ProbeVehicleData(const void *pv)
+{
+	const ProbeVehicleData *pValue = (const ProbeVehicleData *)pv;
+	size_t size = 0;
+
+	if (pValue->m.probeIDPresent)
+	{
+		size += sSize_VehicleIdent(&pValue->probeID);
+	}
+	size += sSize_FullPositionVector(&pValue->startVector);
+	size += sSize_VehicleClassification(&pValue->vehicleType);
+	size += AsnDeep_SizeList(&pValue->snapshots, sizeof(Snapshot), sSize_Snapshot);
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_ProbeVehicleData(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	ProbeVehicleData *pDst = (ProbeVehicleData *)pvDst;
+	const ProbeVehicleData *pSrc = (const ProbeVehicleData *)pvSrc;
+
+	if (pSrc->m.probeIDPresent)
+	{
+		sCopy_VehicleIdent(pArena, &pDst->probeID, &pSrc->probeID);
+	}
+	else
+	{
+		memset(&pDst->probeID, 0x00, sizeof(pDst->probeID));
+	}
+	sCopy_FullPositionVector(pArena, &pDst->startVector, &pSrc->startVector);
+	sCopy_VehicleClassification(pArena, &pDst->vehicleType, &pSrc->vehicleType);
+	AsnDeep_CopyList(pArena, &pDst->snapshots, &pSrc->snapshots, sizeof(Snapshot), sCopy_Snapshot);
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_ProbeVehicleData(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	ProbeVehicleData *pValue = (ProbeVehicleData *)pv;
+
+	if (pValue->m.probeIDPresent)
+	{
+		sReloc_VehicleIdent(pReloc, &pValue->probeID);
+	}
+	sReloc_FullPositionVector(pReloc, &pValue->startVector);
+	sReloc_VehicleClassification(pReloc, &pValue->vehicleType);
+	AsnDeep_RelocList(pReloc, &pValue->snapshots, sizeof(Snapshot), sReloc_Snapshot);
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_ProbeVehicleData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ProbeVehicleData *pA = (const ProbeVehicleData *)pvA;
+	const ProbeVehicleData *pB = (const ProbeVehicleData *)pvB;
+	int ret = 0;
+
+	if (pA->m.timeStampPresent != pB->m.timeStampPresent) ASN_DEEP_DIFFER("timeStamp")
+	else if (pA->m.timeStampPresent)
+	{
+		if (pA->timeStamp != pB->timeStamp) ASN_DEEP_DIFFER("timeStamp")
+	}
+	if (pA->m.segNumPresent != pB->m.segNumPresent) ASN_DEEP_DIFFER("segNum")
+	else if (pA->m.segNumPresent)
+	{
+		if (pA->segNum != pB->segNum) ASN_DEEP_DIFFER("segNum")
+	}
+	if (pA->m.probeIDPresent != pB->m.probeIDPresent) ASN_DEEP_DIFFER("probeID")
+	else if (pA->m.probeIDPresent)
+	{
+		ASN_DEEP_INTO("probeID", sCmp_VehicleIdent(pDiff, &pA->probeID, &pB->probeID))
+	}
+	ASN_DEEP_INTO("startVector", sCmp_FullPositionVector(pDiff, &pA->startVector, &pB->startVector))
+	ASN_DEEP_INTO("vehicleType", sCmp_VehicleClassification(pDiff, &pA->vehicleType, &pB->vehicleType))
+	ASN_DEEP_INTO("snapshots", AsnDeep_CmpList(pDiff, &pA->snapshots, &pB->snapshots, sizeof(Snapshot), sCmp_Snapshot))
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static int sCmp_AntennaOffsetSet(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const AntennaOffsetSet *pA = (const AntennaOffsetSet *)pvA;
+	const AntennaOffsetSet *pB = (const AntennaOffsetSet *)pvB;
+	int ret = 0;
+
+	if (pA->antOffsetX != pB->antOffsetX) ASN_DEEP_DIFFER("antOffsetX")
+	if (pA->antOffsetY != pB->antOffsetY) ASN_DEEP_DIFFER("antOffsetY")
+	if (pA->antOffsetZ != pB->antOffsetZ) ASN_DEEP_DIFFER("antOffsetZ")
+	return ret;
+}
+
+static void sReloc_RTCMheader(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RTCMheader *pValue = (RTCMheader *)pv;
+
+	sReloc_GNSSstatus(pReloc, &pValue->status);
+}
+
+static int sCmp_RTCMheader(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RTCMheader *pA = (const RTCMheader *)pvA;
+	const RTCMheader *pB = (const RTCMheader *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("status", sCmp_GNSSstatus(pDiff, &pA->status, &pB->status))
+	ASN_DEEP_INTO("offsetSet", sCmp_AntennaOffsetSet(pDiff, &pA->offsetSet, &pB->offsetSet))
+	return ret;
+}
+
+static void sReloc_RTCMmessageList(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RTCMmessageList *pValue = (RTCMmessageList *)pv;
+
+	AsnDeep_RelocArray(pReloc, pValue->elem, pValue->n, sizeof(pValue->elem) / sizeof(pValue->elem[0]), sizeof(pValue->elem[0]), sReloc_RTCMmessage);
+}
+
+static int sCmp_RTCMmessageList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RTCMmessageList *pA = (const RTCMmessageList *)pvA;
+	const RTCMmessageList *pB = (const RTCMmessageList *)pvB;
+
+	return AsnDeep_CmpArray(pDiff, pA->elem, pA->n, pB->elem, pB->n, sizeof(pA->elem) / sizeof(pA->elem[0]), sizeof(pA->elem[0]), sCmp_RTCMmessage);
+}
+
+static size_t sSize_RTCMcorrections(const void *pv)
+{
+	const RTCMcorrections *pValue = (const RTCMcorrections *)pv;
+	size_t size = 0;
+
+	if (pValue->m.anchorPointPresent)
+	{
+		size += sSize_FullPositionVector(&pValue->anchorPoint);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_RTCMcorrections(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	RTCMcorrections *pDst = (RTCMcorrections *)pvDst;
+	const RTCMcorrections *pSrc = (const RTCMcorrections *)pvSrc;
+
+	if (pSrc->m.anchorPointPresent)
+	{
+		sCopy_FullPositionVector(pArena, &pDst->anchorPoint, &pSrc->anchorPoint);
+	}
+	else
+	{
+		memset(&pDst->anchorPoint, 0x00, sizeof(pDst->anchorPoint));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_RTCMcorrections(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RTCMcorrections *pValue = (RTCMcorrections *)pv;
+
+	if (pValue->m.anchorPointPresent)
+	{
+		sReloc_FullPositionVector(pReloc, &pValue->anchorPoint);
+	}
+	if (pValue->m.rtcmHeaderPresent)
+	{
+		sReloc_RTCMheader(pReloc, &pValue->rtcmHeader);
+	}
+	sReloc_RTCMmessageList(pReloc, &pValue->msgs);
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_RTCMcorrections(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RTCMcorrections *pA = (const RTCMcorrections *)pvA;
+	const RTCMcorrections *pB = (const RTCMcorrections *)pvB;
+	int ret = 0;
+
+	if (pA->msgCnt != pB->msgCnt) ASN_DEEP_DIFFER("msgCnt")
+	if (pA->rev != pB->rev) ASN_DEEP_DIFFER("rev")
+	if (pA->m.timeStampPresent != pB->m.timeStampPresent) ASN_DEEP_DIFFER("timeStamp")
+	else if (pA->m.timeStampPresent)
+	{
+		if (pA->timeStamp != pB->timeStamp) ASN_DEEP_DIFFER("timeStamp")
+	}
+	if (pA->m.anchorPointPresent != pB->m.anchorPointPresent) ASN_DEEP_DIFFER("anchorPoint")
+	else if (pA->m.anchorPointPresent)
+	{
+		ASN_DEEP_INTO("anchorPoint", sCmp_FullPositionVector(pDiff, &pA->anchorPoint, &pB->anchorPoint))
+	}
+	if (pA->m.rtcmHeaderPresent != pB->m.rtcmHeaderPresent) ASN_DEEP_DIFFER("rtcmHeader")
+	else if (pA->m.rtcmHeaderPresent)
+	{
+		ASN_DEEP_INTO("rtcmHeader", sCmp_RTCMheader(pDiff, &pA->rtcmHeader, &pB->rtcmHeader))
+	}
+	ASN_DEEP_INTO("msgs", sCmp_RTCMmessageList(pDiff, &pA->msgs, &pB->msgs))
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static void sReloc_EnabledLaneList(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	EnabledLaneList *pValue = (EnabledLaneList *)pv;
+
+	AsnDeep_RelocArray(pReloc, pValue->elem, pValue->n, sizeof(pValue->elem) / sizeof(pValue->elem[0]), sizeof(pValue->elem[0]), HAE_NULL);
+}
+
+static int sCmp_EnabledLaneList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const EnabledLaneList *pA = (const EnabledLaneList *)pvA;
+	const EnabledLaneList *pB = (const EnabledLaneList *)pvB;
+
+	return AsnDeep_CmpArray(pDiff, pA->elem, pA->n, pB->elem, pB->n, sizeof(pA->elem) / sizeof(pA->elem[0]), sizeof(pA->elem[0]), HAE_NULL);
+}
+
+static int sCmp_TimeChangeDetails(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TimeChangeDetails *pA = (const TimeChangeDetails *)pvA;
+	const TimeChangeDetails *pB = (const TimeChangeDetails *)pvB;
+	int ret = 0;
+
+	if (pA->m.startTimePresent != pB->m.startTimePresent) ASN_DEEP_DIFFER("startTime")
+	else if (pA->m.startTimePresent)
+	{
+		if (pA->startTime != pB->startTime) ASN_DEEP_DIFFER("startTime")
+	}
+	if (pA->minEndTime != pB->minEndTime) ASN_DEEP_DIFFER("minEndTime")
+	if (pA->m.maxEndTimePresent != pB->m.maxEndTimePresent) ASN_DEEP_DIFFER("maxEndTime")
+	else if (pA->m.maxEndTimePresent)
+	{
+		if (pA->maxEndTime != pB->maxEndTime) ASN_DEEP_DIFFER("maxEndTime")
+	}
+	if (pA->m.likelyTimePresent != pB->m.likelyTimePresent) ASN_DEEP_DIFFER("likelyTime")
+	else if (pA->m.likelyTimePresent)
+	{
+		if (pA->likelyTime != pB->likelyTime) ASN_DEEP_DIFFER("likelyTime")
+	}
+	if (pA->m.confidencePresent != pB->m.confidencePresent) ASN_DEEP_DIFFER("confidence")
+	else if (pA->m.confidencePresent)
+	{
+		if (pA->confidence != pB->confidence) ASN_DEEP_DIFFER("confidence")
+	}
+	if (pA->m.nextTimePresent != pB->m.nextTimePresent) ASN_DEEP_DIFFER("nextTime")
+	else if (pA->m.nextTimePresent)
+	{
+		if (pA->nextTime != pB->nextTime) ASN_DEEP_DIFFER("nextTime")
+	}
+	return ret;
+}
+
+static size_t sSize_AdvisorySpeed(const void *pv)
+{
+	const AdvisorySpeed *pValue = (const AdvisorySpeed *)pv;
+	size_t size = 0;
+
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_AdvisorySpeed(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	AdvisorySpeed *pDst = (AdvisorySpeed *)pvDst;
+	const AdvisorySpeed *pSrc = (const AdvisorySpeed *)pvSrc;
+
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_AdvisorySpeed(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	AdvisorySpeed *pValue = (AdvisorySpeed *)pv;
+
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_AdvisorySpeed(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const AdvisorySpeed *pA = (const AdvisorySpeed *)pvA;
+	const AdvisorySpeed *pB = (const AdvisorySpeed *)pvB;
+	int ret = 0;
+
+	if (pA->type != pB->type) ASN_DEEP_DIFFER("type")
+	if (pA->m.speedPresent != pB->m.speedPresent) ASN_DEEP_DIFFER("speed")
+	else if (pA->m.speedPresent)
+	{
+		if (pA->speed != pB->speed) ASN_DEEP_DIFFER("speed")
+	}
+	if (pA->m.confidencePresent != pB->m.confidencePresent) ASN_DEEP_DIFFER("confidence")
+	else if (pA->m.confidencePresent)
+	{
+		if (pA->confidence != pB->confidence) ASN_DEEP_DIFFER("confidence")
+	}
+	if (pA->m.distancePresent != pB->m.distancePresent) ASN_DEEP_DIFFER("distance")
+	else if (pA->m.distancePresent)
+	{
+		if (pA->distance != pB->distance) ASN_DEEP_DIFFER("distance")
+	}
+	if (pA->m.class_Present != pB->m.class_Present) ASN_DEEP_DIFFER("class_")
+	else if (pA->m.class_Present)
+	{
+		if (pA->class_ != pB->class_) ASN_DEEP_DIFFER("class_")
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_MovementEvent(const void *pv)
+{
+	const MovementEvent *pValue = (const MovementEvent *)pv;
+	size_t size = 0;
+
+	if (pValue->m.speedsPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->speeds, sizeof(AdvisorySpeed), sSize_AdvisorySpeed);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_MovementEvent(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	MovementEvent *pDst = (MovementEvent *)pvDst;
+	const MovementEvent *pSrc = (const MovementEvent *)pvSrc;
+
+	if (pSrc->m.speedsPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->speeds, &pSrc->speeds, sizeof(AdvisorySpeed), sCopy_AdvisorySpeed);
+	}
+	else
+	{
+		memset(&pDst->speeds, 0x00, sizeof(pDst->speeds));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_MovementEvent(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	MovementEvent *pValue = (MovementEvent *)pv;
+
+	if (pValue->m.speedsPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->speeds, sizeof(AdvisorySpeed), sReloc_AdvisorySpeed);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_MovementEvent(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const MovementEvent *pA = (const MovementEvent *)pvA;
+	const MovementEvent *pB = (const MovementEvent *)pvB;
+	int ret = 0;
+
+	if (pA->eventState != pB->eventState) ASN_DEEP_DIFFER("eventState")
+	if (pA->m.timingPresent != pB->m.timingPresent) ASN_DEEP_DIFFER("timing")
+	else if (pA->m.timingPresent)
+	{
+		ASN_DEEP_INTO("timing", sCmp_TimeChangeDetails(pDiff, &pA->timing, &pB->timing))
+	}
+	if (pA->m.speedsPresent != pB->m.speedsPresent) ASN_DEEP_DIFFER("speeds")
+	else if (pA->m.speedsPresent)
+	{
+		ASN_DEEP_INTO("speeds", AsnDeep_CmpList(pDiff, &pA->speeds, &pB->speeds, sizeof(AdvisorySpeed), sCmp_AdvisorySpeed))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_ConnectionManeuverAssist(const void *pv)
+{
+	const ConnectionManeuverAssist *pValue = (const ConnectionManeuverAssist *)pv;
+	size_t size = 0;
+
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_ConnectionManeuverAssist(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	ConnectionManeuverAssist *pDst = (ConnectionManeuverAssist *)pvDst;
+	const ConnectionManeuverAssist *pSrc = (const ConnectionManeuverAssist *)pvSrc;
+
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_ConnectionManeuverAssist(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	ConnectionManeuverAssist *pValue = (ConnectionManeuverAssist *)pv;
+
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_ConnectionManeuverAssist(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ConnectionManeuverAssist *pA = (const ConnectionManeuverAssist *)pvA;
+	const ConnectionManeuverAssist *pB = (const ConnectionManeuverAssist *)pvB;
+	int ret = 0;
+
+	if (pA->connectionID != pB->connectionID) ASN_DEEP_DIFFER("connectionID")
+	if (pA->m.queueLengthPresent != pB->m.queueLengthPresent) ASN_DEEP_DIFFER("queueLength")
+	else if (pA->m.queueLengthPresent)
+	{
+		if (pA->queueLength != pB->queueLength) ASN_DEEP_DIFFER("queueLength")
+	}
+	if (pA->m.availableStorageLengthPresent != pB->m.availableStorageLengthPresent) ASN_DEEP_DIFFER("availableStorageLength")
+	else if (pA->m.availableStorageLengthPresent)
+	{
+		if (pA->availableStorageLength != pB->availableStorageLength) ASN_DEEP_DIFFER("availableStorageLength")
+	}
+	if (pA->m.waitOnStopPresent != pB->m.waitOnStopPresent) ASN_DEEP_DIFFER("waitOnStop")
+	else if (pA->m.waitOnStopPresent)
+	{
+		if (pA->waitOnStop != pB->waitOnStop) ASN_DEEP_DIFFER("waitOnStop")
+	}
+	if (pA->m.pedBicycleDetectPresent != pB->m.pedBicycleDetectPresent) ASN_DEEP_DIFFER("pedBicycleDetect")
+	else if (pA->m.pedBicycleDetectPresent)
+	{
+		if (pA->pedBicycleDetect != pB->pedBicycleDetect) ASN_DEEP_DIFFER("pedBicycleDetect")
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_MovementState(const void *pv)
+{
+	const MovementState *pValue = (const MovementState *)pv;
+	size_t size = 0;
+
+	if (pValue->m.movementNamePresent)
+	{
+		size += AsnDeep_SizeStr(pValue->movementName);
+	}
+	size += AsnDeep_SizeList(&pValue->state_time_speed, sizeof(MovementEvent), sSize_MovementEvent);
+	if (pValue->m.maneuverAssistListPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->maneuverAssistList, sizeof(ConnectionManeuverAssist), sSize_ConnectionManeuverAssist);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_MovementState(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	MovementState *pDst = (MovementState *)pvDst;
+	const MovementState *pSrc = (const MovementState *)pvSrc;
+
+	if (pSrc->m.movementNamePresent)
+	{
+		pDst->movementName = AsnDeep_CopyStr(pArena, pSrc->movementName);
+	}
+	else
+	{
+		memset(&pDst->movementName, 0x00, sizeof(pDst->movementName));
+	}
+	AsnDeep_CopyList(pArena, &pDst->state_time_speed, &pSrc->state_time_speed, sizeof(MovementEvent), sCopy_MovementEvent);
+	if (pSrc->m.maneuverAssistListPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->maneuverAssistList, &pSrc->maneuverAssistList, sizeof(ConnectionManeuverAssist), sCopy_ConnectionManeuverAssist);
+	}
+	else
+	{
+		memset(&pDst->maneuverAssistList, 0x00, sizeof(pDst->maneuverAssistList));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_MovementState(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	MovementState *pValue = (MovementState *)pv;
+
+	if (pValue->m.movementNamePresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->movementName);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->state_time_speed, sizeof(MovementEvent), sReloc_MovementEvent);
+	if (pValue->m.maneuverAssistListPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->maneuverAssistList, sizeof(ConnectionManeuverAssist), sReloc_ConnectionManeuverAssist);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_MovementState(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const MovementState *pA = (const MovementState *)pvA;
+	const MovementState *pB = (const MovementState *)pvB;
+	int ret = 0;
+
+	if (pA->m.movementNamePresent != pB->m.movementNamePresent) ASN_DEEP_DIFFER("movementName")
+	else if (pA->m.movementNamePresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->movementName, pB->movementName)) ASN_DEEP_DIFFER("movementName")
+	}
+	if (pA->signalGroup != pB->signalGroup) ASN_DEEP_DIFFER("signalGroup")
+	ASN_DEEP_INTO("state_time_speed", AsnDeep_CmpList(pDiff, &pA->state_time_speed, &pB->state_time_speed, sizeof(MovementEvent), sCmp_MovementEvent))
+	if (pA->m.maneuverAssistListPresent != pB->m.maneuverAssistListPresent) ASN_DEEP_DIFFER("maneuverAssistList")
+	else if (pA->m.maneuverAssistListPresent)
+	{
+		ASN_DEEP_INTO("maneuverAssistList", AsnDeep_CmpList(pDiff, &pA->maneuverAssistList, &pB->maneuverAssistList, sizeof(ConnectionManeuverAssist), sCmp_ConnectionManeuverAssist))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_IntersectionState(const void *pv)
+{
+	const IntersectionState *pValue = (const IntersectionState *)pv;
+	size_t size = 0;
+
+	if (pValue->m.namePresent)
+	{
+		size += AsnDeep_SizeStr(pValue->name);
+	}
+	size += AsnDeep_SizeList(&pValue->states, sizeof(MovementState), sSize_MovementState);
+	if (pValue->m.maneuverAssistListPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->maneuverAssistList, sizeof(ConnectionManeuverAssist), sSize_ConnectionManeuverAssist);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_IntersectionState(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	IntersectionState *pDst = (IntersectionState *)pvDst;
+	const IntersectionState *pSrc = (const IntersectionState *)pvSrc;
+
+	if (pSrc->m.namePresent)
+	{
+		pDst->name = AsnDeep_CopyStr(pArena, pSrc->name);
+	}
+	else
+	{
+		memset(&pDst->name, 0x00, sizeof(pDst->name));
+	}
+	AsnDeep_CopyList(pArena, &pDst->states, &pSrc->states, sizeof(MovementState), sCopy_MovementState);
+	if (pSrc->m.maneuverAssistListPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->maneuverAssistList, &pSrc->maneuverAssistList, sizeof(ConnectionManeuverAssist), sCopy_ConnectionManeuverAssist);
+	}
+	else
+	{
+		memset(&pDst->maneuverAssistList, 0x00, sizeof(pDst->maneuverAssistList));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_IntersectionState(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	IntersectionState *pValue = (IntersectionState *)pv;
+
+	if (pValue->m.namePresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->name);
+	}
+	sReloc_IntersectionStatusObject(pReloc, &pValue->status);
+	if (pValue->m.enabledLanesPresent)
+	{
+		sReloc_EnabledLaneList(pReloc, &pValue->enabledLanes);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->states, sizeof(MovementState), sReloc_MovementState);
+	if (pValue->m.maneuverAssistListPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->maneuverAssistList, sizeof(ConnectionManeuverAssist), sReloc_ConnectionManeuverAssist);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_IntersectionState(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const IntersectionState *pA = (const IntersectionState *)pvA;
+	const IntersectionState *pB = (const IntersectionState *)pvB;
+	int ret = 0;
+
+	if (pA->m.namePresent != pB->m.namePresent) ASN_DEEP_DIFFER("name")
+	else if (pA->m.namePresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->name, pB->name)) ASN_DEEP_DIFFER("name")
+	}
+	ASN_DEEP_INTO("id", sCmp_IntersectionReferenceID(pDiff, &pA->id, &pB->id))
+	if (pA->revision != pB->revision) ASN_DEEP_DIFFER("revision")
+	ASN_DEEP_INTO("status", sCmp_IntersectionStatusObject(pDiff, &pA->status, &pB->status))
+	if (pA->m.moyPresent != pB->m.moyPresent) ASN_DEEP_DIFFER("moy")
+	else if (pA->m.moyPresent)
+	{
+		if (pA->moy != pB->moy) ASN_DEEP_DIFFER("moy")
+	}
+	if (pA->m.timeStampPresent != pB->m.timeStampPresent) ASN_DEEP_DIFFER("timeStamp")
+	else if (pA->m.timeStampPresent)
+	{
+		if (pA->timeStamp != pB->timeStamp) ASN_DEEP_DIFFER("timeStamp")
+	}
+	if (pA->m.enabledLanesPresent != pB->m.enabledLanesPresent) ASN_DEEP_DIFFER("enabledLanes")
+	else if (pA->m.enabledLanesPresent)
+	{
+		ASN_DEEP_INTO("enabledLanes", sCmp_EnabledLaneList(pDiff, &pA->enabledLanes, &pB->enabledLanes))
+	}
+	ASN_DEEP_INTO("states", AsnDeep_CmpList(pDiff, &pA->states, &pB->states, sizeof(MovementState), sCmp_MovementState))
+	if (pA->m.maneuverAssistListPresent != pB->m.maneuverAssistListPresent) ASN_DEEP_DIFFER("maneuverAssistList")
+	else if (pA->m.maneuverAssistListPresent)
+	{
+		ASN_DEEP_INTO("maneuverAssistList", AsnDeep_CmpList(pDiff, &pA->maneuverAssistList, &pB->maneuverAssistList, sizeof(ConnectionManeuverAssist), sCmp_ConnectionManeuverAssist))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_SPAT(const void *pv)
+{
+	const SPAT *pValue = (const SPAT *)pv;
+	size_t size = 0;
+
+	if (pValue->m.namePresent)
+	{
+		size += AsnDeep_SizeStr(pValue->name);
+	}
+	size += AsnDeep_SizeList(&pValue->intersections, sizeof(IntersectionState), sSize_IntersectionState);
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_SPAT(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	SPAT *pDst = (SPAT *)pvDst;
+	const SPAT *pSrc = (const SPAT *)pvSrc;
+
+	if (pSrc->m.namePresent)
+	{
+		pDst->name = AsnDeep_CopyStr(pArena, pSrc->name);
+	}
+	else
+	{
+		memset(&pDst->name, 0x00, sizeof(pDst->name));
+	}
+	AsnDeep_CopyList(pArena, &pDst->intersections, &pSrc->intersections, sizeof(IntersectionState), sCopy_IntersectionState);
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_SPAT(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SPAT *pValue = (SPAT *)pv;
+
+	if (pValue->m.namePresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->name);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->intersections, sizeof(IntersectionState), sReloc_IntersectionState);
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_SPAT(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SPAT *pA = (const SPAT *)pvA;
+	const SPAT *pB = (const SPAT *)pvB;
+	int ret = 0;
+
+	if (pA->m.timeStampPresent != pB->m.timeStampPresent) ASN_DEEP_DIFFER("timeStamp")
+	else if (pA->m.timeStampPresent)
+	{
+		if (pA->timeStamp != pB->timeStamp) ASN_DEEP_DIFFER("timeStamp")
+	}
+	if (pA->m.namePresent != pB->m.namePresent) ASN_DEEP_DIFFER("name")
+	else if (pA->m.namePresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->name, pB->name)) ASN_DEEP_DIFFER("name")
+	}
+	ASN_DEEP_INTO("intersections", AsnDeep_CmpList(pDiff, &pA->intersections, &pB->intersections, sizeof(IntersectionState), sCmp_IntersectionState))
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_IntersectionAccessPoint(const void *pv)
+{
+	const IntersectionAccessPoint *pValue = (const IntersectionAccessPoint *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 4:
+			size += AsnDeep_SizePtr(pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_SizeOpen);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_IntersectionAccessPoint(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	IntersectionAccessPoint *pDst = (IntersectionAccessPoint *)pvDst;
+	const IntersectionAccessPoint *pSrc = (const IntersectionAccessPoint *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 4:
+			pDst->u.extElem1 = AsnDeep_CopyPtr(pArena, pSrc->u.extElem1, sizeof(*pSrc->u.extElem1), AsnDeep_CopyOpen);
+			break;
+		case 1:
+		case 2:
+		case 3:
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_IntersectionAccessPoint(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	IntersectionAccessPoint *pValue = (IntersectionAccessPoint *)pv;
+
+	switch (pValue->t)
+	{
+		case 4:
+			AsnDeep_RelocObj(pReloc, &pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_RelocOpen);
+			break;
+		case 1:
+		case 2:
+		case 3:
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_IntersectionAccessPoint(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const IntersectionAccessPoint *pA = (const IntersectionAccessPoint *)pvA;
+	const IntersectionAccessPoint *pB = (const IntersectionAccessPoint *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			if (pA->u.lane != pB->u.lane) ASN_DEEP_DIFFER("lane")
+			break;
+		case 2:
+			if (pA->u.approach != pB->u.approach) ASN_DEEP_DIFFER("approach")
+			break;
+		case 3:
+			if (pA->u.connection != pB->u.connection) ASN_DEEP_DIFFER("connection")
+			break;
+		case 4:
+			ASN_DEEP_INTO("extElem1", AsnDeep_CmpPtr(pDiff, pA->u.extElem1, pB->u.extElem1, sizeof(*pA->u.extElem1), AsnDeep_CmpOpen))
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_SignalRequest(const void *pv)
+{
+	const SignalRequest *pValue = (const SignalRequest *)pv;
+	size_t size = 0;
+
+	size += sSize_IntersectionAccessPoint(&pValue->inBoundLane);
+	if (pValue->m.outBoundLanePresent)
+	{
+		size += sSize_IntersectionAccessPoint(&pValue->outBoundLane);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_SignalRequest(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	SignalRequest *pDst = (SignalRequest *)pvDst;
+	const SignalRequest *pSrc = (const SignalRequest *)pvSrc;
+
+	sCopy_IntersectionAccessPoint(pArena, &pDst->inBoundLane, &pSrc->inBoundLane);
+	if (pSrc->m.outBoundLanePresent)
+	{
+		sCopy_IntersectionAccessPoint(pArena, &pDst->outBoundLane, &pSrc->outBoundLane);
+	}
+	else
+	{
+		memset(&pDst->outBoundLane, 0x00, sizeof(pDst->outBoundLane));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_SignalRequest(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SignalRequest *pValue = (SignalRequest *)pv;
+
+	sReloc_IntersectionAccessPoint(pReloc, &pValue->inBoundLane);
+	if (pValue->m.outBoundLanePresent)
+	{
+		sReloc_IntersectionAccessPoint(pReloc, &pValue->outBoundLane);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_SignalRequest(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SignalRequest *pA = (const SignalRequest *)pvA;
+	const SignalRequest *pB = (const SignalRequest *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("id", sCmp_IntersectionReferenceID(pDiff, &pA->id, &pB->id))
+	if (pA->requestID != pB->requestID) ASN_DEEP_DIFFER("requestID")
+	if (pA->requestType != pB->requestType) ASN_DEEP_DIFFER("requestType")
+	ASN_DEEP_INTO("inBoundLane", sCmp_IntersectionAccessPoint(pDiff, &pA->inBoundLane, &pB->inBoundLane))
+	if (pA->m.outBoundLanePresent != pB->m.outBoundLanePresent) ASN_DEEP_DIFFER("outBoundLane")
+	else if (pA->m.outBoundLanePresent)
+	{
+		ASN_DEEP_INTO("outBoundLane", sCmp_IntersectionAccessPoint(pDiff, &pA->outBoundLane, &pB->outBoundLane))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_SignalRequestPackage(const void *pv)
+{
+	const SignalRequestPackage *pValue = (const SignalRequestPackage *)pv;
+	size_t size = 0;
+
+	size += sSize_SignalRequest(&pValue->request);
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_SignalRequestPackage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	SignalRequestPackage *pDst = (SignalRequestPackage *)pvDst;
+	const SignalRequestPackage *pSrc = (const SignalRequestPackage *)pvSrc;
+
+	sCopy_SignalRequest(pArena, &pDst->request, &pSrc->request);
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_SignalRequestPackage(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SignalRequestPackage *pValue = (SignalRequestPackage *)pv;
+
+	sReloc_SignalRequest(pReloc, &pValue->request);
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_SignalRequestPackage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SignalRequestPackage *pA = (const SignalRequestPackage *)pvA;
+	const SignalRequestPackage *pB = (const SignalRequestPackage *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("request", sCmp_SignalRequest(pDiff, &pA->request, &pB->request))
+	if (pA->m.minutePresent != pB->m.minutePresent) ASN_DEEP_DIFFER("minute")
+	else if (pA->m.minutePresent)
+	{
+		if (pA->minute != pB->minute) ASN_DEEP_DIFFER("minute")
+	}
+	if (pA->m.secondPresent != pB->m.secondPresent) ASN_DEEP_DIFFER("second")
+	else if (pA->m.secondPresent)
+	{
+		if (pA->second != pB->second) ASN_DEEP_DIFFER("second")
+	}
+	if (pA->m.durationPresent != pB->m.durationPresent) ASN_DEEP_DIFFER("duration")
+	else if (pA->m.durationPresent)
+	{
+		if (pA->duration != pB->duration) ASN_DEEP_DIFFER("duration")
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_RequestorType(const void *pv)
+{
+	const RequestorType *pValue = (const RequestorType *)pv;
+	size_t size = 0;
+
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_RequestorType(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	RequestorType *pDst = (RequestorType *)pvDst;
+	const RequestorType *pSrc = (const RequestorType *)pvSrc;
+
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_RequestorType(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RequestorType *pValue = (RequestorType *)pv;
+
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_RequestorType(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RequestorType *pA = (const RequestorType *)pvA;
+	const RequestorType *pB = (const RequestorType *)pvB;
+	int ret = 0;
+
+	if (pA->role != pB->role) ASN_DEEP_DIFFER("role")
+	if (pA->m.subrolePresent != pB->m.subrolePresent) ASN_DEEP_DIFFER("subrole")
+	else if (pA->m.subrolePresent)
+	{
+		if (pA->subrole != pB->subrole) ASN_DEEP_DIFFER("subrole")
+	}
+	if (pA->m.requestPresent != pB->m.requestPresent) ASN_DEEP_DIFFER("request")
+	else if (pA->m.requestPresent)
+	{
+		if (pA->request != pB->request) ASN_DEEP_DIFFER("request")
+	}
+	if (pA->m.iso3883Present != pB->m.iso3883Present) ASN_DEEP_DIFFER("iso3883")
+	else if (pA->m.iso3883Present)
+	{
+		if (pA->iso3883 != pB->iso3883) ASN_DEEP_DIFFER("iso3883")
+	}
+	if (pA->m.hpmsTypePresent != pB->m.hpmsTypePresent) ASN_DEEP_DIFFER("hpmsType")
+	else if (pA->m.hpmsTypePresent)
+	{
+		if (pA->hpmsType != pB->hpmsType) ASN_DEEP_DIFFER("hpmsType")
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_RequestorPositionVector(const void *pv)
+{
+	const RequestorPositionVector *pValue = (const RequestorPositionVector *)pv;
+	size_t size = 0;
+
+	size += sSize_Position3D(&pValue->position);
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_RequestorPositionVector(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	RequestorPositionVector *pDst = (RequestorPositionVector *)pvDst;
+	const RequestorPositionVector *pSrc = (const RequestorPositionVector *)pvSrc;
+
+	sCopy_Position3D(pArena, &pDst->position, &pSrc->position);
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_RequestorPositionVector(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RequestorPositionVector *pValue = (RequestorPositionVector *)pv;
+
+	sReloc_Position3D(pReloc, &pValue->position);
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_RequestorPositionVector(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RequestorPositionVector *pA = (const RequestorPositionVector *)pvA;
+	const RequestorPositionVector *pB = (const RequestorPositionVector *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("position", sCmp_Position3D(pDiff, &pA->position, &pB->position))
+	if (pA->m.headingPresent != pB->m.headingPresent) ASN_DEEP_DIFFER("heading")
+	else if (pA->m.headingPresent)
+	{
+		if (pA->heading != pB->heading) ASN_DEEP_DIFFER("heading")
+	}
+	if (pA->m.speedPresent != pB->m.speedPresent) ASN_DEEP_DIFFER("speed")
+	else if (pA->m.speedPresent)
+	{
+		ASN_DEEP_INTO("speed", sCmp_TransmissionAndSpeed(pDiff, &pA->speed, &pB->speed))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_RequestorDescription(const void *pv)
+{
+	const RequestorDescription *pValue = (const RequestorDescription *)pv;
+	size_t size = 0;
+
+	size += sSize_VehicleID(&pValue->id);
+	if (pValue->m.typePresent)
+	{
+		size += sSize_RequestorType(&pValue->type);
+	}
+	if (pValue->m.positionPresent)
+	{
+		size += sSize_RequestorPositionVector(&pValue->position);
+	}
+	if (pValue->m.namePresent)
+	{
+		size += AsnDeep_SizeStr(pValue->name);
+	}
+	if (pValue->m.routeNamePresent)
+	{
+		size += AsnDeep_SizeStr(pValue->routeName);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_RequestorDescription(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	RequestorDescription *pDst = (RequestorDescription *)pvDst;
+	const RequestorDescription *pSrc = (const RequestorDescription *)pvSrc;
+
+	sCopy_VehicleID(pArena, &pDst->id, &pSrc->id);
+	if (pSrc->m.typePresent)
+	{
+		sCopy_RequestorType(pArena, &pDst->type, &pSrc->type);
+	}
+	else
+	{
+		memset(&pDst->type, 0x00, sizeof(pDst->type));
+	}
+	if (pSrc->m.positionPresent)
+	{
+		sCopy_RequestorPositionVector(pArena, &pDst->position, &pSrc->position);
+	}
+	else
+	{
+		memset(&pDst->position, 0x00, sizeof(pDst->position));
+	}
+	if (pSrc->m.namePresent)
+	{
+		pDst->name = AsnDeep_CopyStr(pArena, pSrc->name);
+	}
+	else
+	{
+		memset(&pDst->name, 0x00, sizeof(pDst->name));
+	}
+	if (pSrc->m.routeNamePresent)
+	{
+		pDst->routeName = AsnDeep_CopyStr(pArena, pSrc->routeName);
+	}
+	else
+	{
+		memset(&pDst->routeName, 0x00, sizeof(pDst->routeName));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_RequestorDescription(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RequestorDescription *pValue = (RequestorDescription *)pv;
+
+	sReloc_VehicleID(pReloc, &pValue->id);
+	if (pValue->m.typePresent)
+	{
+		sReloc_RequestorType(pReloc, &pValue->type);
+	}
+	if (pValue->m.positionPresent)
+	{
+		sReloc_RequestorPositionVector(pReloc, &pValue->position);
+	}
+	if (pValue->m.namePresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->name);
+	}
+	if (pValue->m.routeNamePresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->routeName);
+	}
+	if (pValue->m.transitStatusPresent)
+	{
+		sReloc_TransitVehicleStatus(pReloc, &pValue->transitStatus);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_RequestorDescription(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RequestorDescription *pA = (const RequestorDescription *)pvA;
+	const RequestorDescription *pB = (const RequestorDescription *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("id", sCmp_VehicleID(pDiff, &pA->id, &pB->id))
+	if (pA->m.typePresent != pB->m.typePresent) ASN_DEEP_DIFFER("type")
+	else if (pA->m.typePresent)
+	{
+		ASN_DEEP_INTO("type", sCmp_RequestorType(pDiff, &pA->type, &pB->type))
+	}
+	if (pA->m.positionPresent != pB->m.positionPresent) ASN_DEEP_DIFFER("position")
+	else if (pA->m.positionPresent)
+	{
+		ASN_DEEP_INTO("position", sCmp_RequestorPositionVector(pDiff, &pA->position, &pB->position))
+	}
+	if (pA->m.namePresent != pB->m.namePresent) ASN_DEEP_DIFFER("name")
+	else if (pA->m.namePresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->name, pB->name)) ASN_DEEP_DIFFER("name")
+	}
+	if (pA->m.routeNamePresent != pB->m.routeNamePresent) ASN_DEEP_DIFFER("routeName")
+	else if (pA->m.routeNamePresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->routeName, pB->routeName)) ASN_DEEP_DIFFER("routeName")
+	}
+	if (pA->m.transitStatusPresent != pB->m.transitStatusPresent) ASN_DEEP_DIFFER("transitStatus")
+	else if (pA->m.transitStatusPresent)
+	{
+		ASN_DEEP_INTO("transitStatus", sCmp_TransitVehicleStatus(pDiff, &pA->transitStatus, &pB->transitStatus))
+	}
+	if (pA->m.transitOccupancyPresent != pB->m.transitOccupancyPresent) ASN_DEEP_DIFFER("transitOccupancy")
+	else if (pA->m.transitOccupancyPresent)
+	{
+		if (pA->transitOccupancy != pB->transitOccupancy) ASN_DEEP_DIFFER("transitOccupancy")
+	}
+	if (pA->m.transitSchedulePresent != pB->m.transitSchedulePresent) ASN_DEEP_DIFFER("transitSchedule")
+	else if (pA->m.transitSchedulePresent)
+	{
+		if (pA->transitSchedule != pB->transitSchedule) ASN_DEEP_DIFFER("transitSchedule")
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_SignalRequestMessage(const void *pv)
+{
+	const SignalRequestMessage *pValue = (const SignalRequestMessage *)pv;
+	size_t size = 0;
+
+	if (pValue->m.requestsPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->requests, sizeof(SignalRequestPackage), sSize_SignalRequestPackage);
+	}
+	size += sSize_RequestorDescription(&pValue->requestor);
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_SignalRequestMessage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	SignalRequestMessage *pDst = (SignalRequestMessage *)pvDst;
+	const SignalRequestMessage *pSrc = (const SignalRequestMessage *)pvSrc;
+
+	if (pSrc->m.requestsPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->requests, &pSrc->requests, sizeof(SignalRequestPackage), sCopy_SignalRequestPackage);
+	}
+	else
+	{
+		memset(&pDst->requests, 0x00, sizeof(pDst->requests));
+	}
+	sCopy_RequestorDescription(pArena, &pDst->requestor, &pSrc->requestor);
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_SignalRequestMessage(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SignalRequestMessage *pValue = (SignalRequestMessage *)pv;
+
+	if (pValue->m.requestsPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->requests, sizeof(SignalRequestPackage), sReloc_SignalRequestPackage);
+	}
+	sReloc_RequestorDescription(pReloc, &pValue->requestor);
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_SignalRequestMessage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SignalRequestMessage *pA = (const SignalRequestMessage *)pvA;
+	const SignalRequestMessage *pB = (const SignalRequestMessage *)pvB;
+	int ret = 0;
+
+	if (pA->m.timeStampPresent != pB->m.timeStampPresent) ASN_DEEP_DIFFER("timeStamp")
+	else if (pA->m.timeStampPresent)
+	{
+		if (pA->timeStamp != pB->timeStamp) ASN_DEEP_DIFFER("timeStamp")
+	}
+	if (pA->second != pB->second) ASN_DEEP_DIFFER("second")
+	if (pA->m.sequenceNumberPresent != pB->m.sequenceNumberPresent) ASN_DEEP_DIFFER("sequenceNumber")
+	else if (pA->m.sequenceNumberPresent)
+	{
+		if (pA->sequenceNumber != pB->sequenceNumber) ASN_DEEP_DIFFER("sequenceNumber")
+	}
+	if (pA->m.requestsPresent != pB->m.requestsPresent) ASN_DEEP_DIFFER("requests")
+	else if (pA->m.requestsPresent)
+	{
+		ASN_DEEP_INTO("requests", AsnDeep_CmpList(pDiff, &pA->requests, &pB->requests, sizeof(SignalRequestPackage), sCmp_SignalRequestPackage))
+	}
+	ASN_DEEP_INTO("requestor", sCmp_RequestorDescription(pDiff, &pA->requestor, &pB->requestor))
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_SignalRequesterInfo(const void *pv)
+{
+	const SignalRequesterInfo *pValue = (const SignalRequesterInfo *)pv;
+	size_t size = 0;
+
+	size += sSize_VehicleID(&pValue->id);
+	if (pValue->m.typeDataPresent)
+	{
+		size += sSize_RequestorType(&pValue->typeData);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_SignalRequesterInfo(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	SignalRequesterInfo *pDst = (SignalRequesterInfo *)pvDst;
+	const SignalRequesterInfo *pSrc = (const SignalRequesterInfo *)pvSrc;
+
+	sCopy_VehicleID(pArena, &pDst->id, &pSrc->id);
+	if (pSrc->m.typeDataPresent)
+	{
+		sCopy_RequestorType(pArena, &pDst->typeData, &pSrc->typeData);
+	}
+	else
+	{
+		memset(&pDst->typeData, 0x00, sizeof(pDst->typeData));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_SignalRequesterInfo(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SignalRequesterInfo *pValue = (SignalRequesterInfo *)pv;
+
+	sReloc_VehicleID(pReloc, &pValue->id);
+	if (pValue->m.typeDataPresent)
+	{
+		sReloc_RequestorType(pReloc, &pValue->typeData);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_SignalRequesterInfo(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SignalRequesterInfo *pA = (const SignalRequesterInfo *)pvA;
+	const SignalRequesterInfo *pB = (const SignalRequesterInfo *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("id", sCmp_VehicleID(pDiff, &pA->id, &pB->id))
+	if (pA->request != pB->request) ASN_DEEP_DIFFER("request")
+	if (pA->sequenceNumber != pB->sequenceNumber) ASN_DEEP_DIFFER("sequenceNumber")
+	if (pA->m.rolePresent != pB->m.rolePresent) ASN_DEEP_DIFFER("role")
+	else if (pA->m.rolePresent)
+	{
+		if (pA->role != pB->role) ASN_DEEP_DIFFER("role")
+	}
+	if (pA->m.typeDataPresent != pB->m.typeDataPresent) ASN_DEEP_DIFFER("typeData")
+	else if (pA->m.typeDataPresent)
+	{
+		ASN_DEEP_INTO("typeData", sCmp_RequestorType(pDiff, &pA->typeData, &pB->typeData))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_SignalStatusPackage(const void *pv)
+{
+	const SignalStatusPackage *pValue = (const SignalStatusPackage *)pv;
+	size_t size = 0;
+
+	if (pValue->m.requesterPresent)
+	{
+		size += sSize_SignalRequesterInfo(&pValue->requester);
+	}
+	size += sSize_IntersectionAccessPoint(&pValue->inboundOn);
+	if (pValue->m.outboundOnPresent)
+	{
+		size += sSize_IntersectionAccessPoint(&pValue->outboundOn);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_SignalStatusPackage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	SignalStatusPackage *pDst = (SignalStatusPackage *)pvDst;
+	const SignalStatusPackage *pSrc = (const SignalStatusPackage *)pvSrc;
+
+	if (pSrc->m.requesterPresent)
+	{
+		sCopy_SignalRequesterInfo(pArena, &pDst->requester, &pSrc->requester);
+	}
+	else
+	{
+		memset(&pDst->requester, 0x00, sizeof(pDst->requester));
+	}
+	sCopy_IntersectionAccessPoint(pArena, &pDst->inboundOn, &pSrc->inboundOn);
+	if (pSrc->m.outboundOnPresent)
+	{
+		sCopy_IntersectionAccessPoint(pArena, &pDst->outboundOn, &pSrc->outboundOn);
+	}
+	else
+	{
+		memset(&pDst->outboundOn, 0x00, sizeof(pDst->outboundOn));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_SignalStatusPackage(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SignalStatusPackage *pValue = (SignalStatusPackage *)pv;
+
+	if (pValue->m.requesterPresent)
+	{
+		sReloc_SignalRequesterInfo(pReloc, &pValue->requester);
+	}
+	sReloc_IntersectionAccessPoint(pReloc, &pValue->inboundOn);
+	if (pValue->m.outboundOnPresent)
+	{
+		sReloc_IntersectionAccessPoint(pReloc, &pValue->outboundOn);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_SignalStatusPackage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SignalStatusPackage *pA = (const SignalStatusPackage *)pvA;
+	const SignalStatusPackage *pB = (const SignalStatusPackage *)pvB;
+	int ret = 0;
+
+	if (pA->m.requesterPresent != pB->m.requesterPresent) ASN_DEEP_DIFFER("requester")
+	else if (pA->m.requesterPresent)
+	{
+		ASN_DEEP_INTO("requester", sCmp_SignalRequesterInfo(pDiff, &pA->requester, &pB->requester))
+	}
+	ASN_DEEP_INTO("inboundOn", sCmp_IntersectionAccessPoint(pDiff, &pA->inboundOn, &pB->inboundOn))
+	if (pA->m.outboundOnPresent != pB->m.outboundOnPresent) ASN_DEEP_DIFFER("outboundOn")
+	else if (pA->m.outboundOnPresent)
+	{
+		ASN_DEEP_INTO("outboundOn", sCmp_IntersectionAccessPoint(pDiff, &pA->outboundOn, &pB->outboundOn))
+	}
+	if (pA->m.minutePresent != pB->m.minutePresent) ASN_DEEP_DIFFER("minute")
+	else if (pA->m.minutePresent)
+	{
+		if (pA->minute != pB->minute) ASN_DEEP_DIFFER("minute")
+	}
+	if (pA->m.secondPresent != pB->m.secondPresent) ASN_DEEP_DIFFER("second")
+	else if (pA->m.secondPresent)
+	{
+		if (pA->second != pB->second) ASN_DEEP_DIFFER("second")
+	}
+	if (pA->m.durationPresent != pB->m.durationPresent) ASN_DEEP_DIFFER("duration")
+	else if (pA->m.durationPresent)
+	{
+		if (pA->duration != pB->duration) ASN_DEEP_DIFFER("duration")
+	}
+	if (pA->status != pB->status) ASN_DEEP_DIFFER("status")
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_SignalStatus(const void *pv)
+{
+	const SignalStatus *pValue = (const SignalStatus *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->sigStatus, sizeof(SignalStatusPackage), sSize_SignalStatusPackage);
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_SignalStatus(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	SignalStatus *pDst = (SignalStatus *)pvDst;
+	const SignalStatus *pSrc = (const SignalStatus *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->sigStatus, &pSrc->sigStatus, sizeof(SignalStatusPackage), sCopy_SignalStatusPackage);
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_SignalStatus(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SignalStatus *pValue = (SignalStatus *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->sigStatus, sizeof(SignalStatusPackage), sReloc_SignalStatusPackage);
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_SignalStatus(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SignalStatus *pA = (const SignalStatus *)pvA;
+	const SignalStatus *pB = (const SignalStatus *)pvB;
+	int ret = 0;
+
+	if (pA->sequenceNumber != pB->sequenceNumber) ASN_DEEP_DIFFER("sequenceNumber")
+	ASN_DEEP_INTO("id", sCmp_IntersectionReferenceID(pDiff, &pA->id, &pB->id))
+	ASN_DEEP_INTO("sigStatus", AsnDeep_CmpList(pDiff, &pA->sigStatus, &pB->sigStatus, sizeof(SignalStatusPackage), sCmp_SignalStatusPackage))
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_SignalStatusMessage(const void *pv)
+{
+	const SignalStatusMessage *pValue = (const SignalStatusMessage *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->status, sizeof(SignalStatus), sSize_SignalStatus);
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_SignalStatusMessage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	SignalStatusMessage *pDst = (SignalStatusMessage *)pvDst;
+	const SignalStatusMessage *pSrc = (const SignalStatusMessage *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->status, &pSrc->status, sizeof(SignalStatus), sCopy_SignalStatus);
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_SignalStatusMessage(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SignalStatusMessage *pValue = (SignalStatusMessage *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->status, sizeof(SignalStatus), sReloc_SignalStatus);
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_SignalStatusMessage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SignalStatusMessage *pA = (const SignalStatusMessage *)pvA;
+	const SignalStatusMessage *pB = (const SignalStatusMessage *)pvB;
+	int ret = 0;
+
+	if (pA->m.timeStampPresent != pB->m.timeStampPresent) ASN_DEEP_DIFFER("timeStamp")
+	else if (pA->m.timeStampPresent)
+	{
+		if (pA->timeStamp != pB->timeStamp) ASN_DEEP_DIFFER("timeStamp")
+	}
+	if (pA->second != pB->second) ASN_DEEP_DIFFER("second")
+	if (pA->m.sequenceNumberPresent != pB->m.sequenceNumberPresent) ASN_DEEP_DIFFER("sequenceNumber")
+	else if (pA->m.sequenceNumberPresent)
+	{
+		if (pA->sequenceNumber != pB->sequenceNumber) ASN_DEEP_DIFFER("sequenceNumber")
+	}
+	ASN_DEEP_INTO("status", AsnDeep_CmpList(pDiff, &pA->status, &pB->status, sizeof(SignalStatus), sCmp_SignalStatus))
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_RoadSignID(const void *pv)
+{
+	const RoadSignID *pValue = (const RoadSignID *)pv;
+	size_t size = 0;
+
+	size += sSize_Position3D(&pValue->position);
+	return size;
+}
+
+static void sCopy_RoadSignID(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	RoadSignID *pDst = (RoadSignID *)pvDst;
+	const RoadSignID *pSrc = (const RoadSignID *)pvSrc;
+
+	sCopy_Position3D(pArena, &pDst->position, &pSrc->position);
+}
+
+static void sReloc_RoadSignID(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RoadSignID *pValue = (RoadSignID *)pv;
+
+	sReloc_Position3D(pReloc, &pValue->position);
+	sReloc_HeadingSlice(pReloc, &pValue->viewAngle);
+	if (pValue->m.crcPresent)
+	{
+		sReloc_MsgCRC(pReloc, &pValue->crc);
+	}
+}
+
+static int sCmp_RoadSignID(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RoadSignID *pA = (const RoadSignID *)pvA;
+	const RoadSignID *pB = (const RoadSignID *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("position", sCmp_Position3D(pDiff, &pA->position, &pB->position))
+	ASN_DEEP_INTO("viewAngle", sCmp_HeadingSlice(pDiff, &pA->viewAngle, &pB->viewAngle))
+	if (pA->m.mutcdCodePresent != pB->m.mutcdCodePresent) ASN_DEEP_DIFFER("mutcdCode")
+	else if (pA->m.mutcdCodePresent)
+	{
+		if (pA->mutcdCode != pB->mutcdCode) ASN_DEEP_DIFFER("mutcdCode")
+	}
+	if (pA->m.crcPresent != pB->m.crcPresent) ASN_DEEP_DIFFER("crc")
+	else if (pA->m.crcPresent)
+	{
+		ASN_DEEP_INTO("crc", sCmp_MsgCRC(pDiff, &pA->crc, &pB->crc))
+	}
+	return ret;
+}
+
+static size_t sSize_TravelerDataFrame_msgId(const void *pv)
+{
+	const TravelerDataFrame_msgId *pValue = (const TravelerDataFrame_msgId *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 1:
+			size += AsnDeep_SizePtr(pValue->u.furtherInfoID, sizeof(*pValue->u.furtherInfoID), HAE_NULL);
+			break;
+		case 2:
+			size += AsnDeep_SizePtr(pValue->u.roadSignID, sizeof(*pValue->u.roadSignID), sSize_RoadSignID);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_TravelerDataFrame_msgId(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TravelerDataFrame_msgId *pDst = (TravelerDataFrame_msgId *)pvDst;
+	const TravelerDataFrame_msgId *pSrc = (const TravelerDataFrame_msgId *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 1:
+			pDst->u.furtherInfoID = AsnDeep_CopyPtr(pArena, pSrc->u.furtherInfoID, sizeof(*pSrc->u.furtherInfoID), HAE_NULL);
+			break;
+		case 2:
+			pDst->u.roadSignID = AsnDeep_CopyPtr(pArena, pSrc->u.roadSignID, sizeof(*pSrc->u.roadSignID), sCopy_RoadSignID);
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_TravelerDataFrame_msgId(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TravelerDataFrame_msgId *pValue = (TravelerDataFrame_msgId *)pv;
+
+	switch (pValue->t)
+	{
+		case 1:
+			AsnDeep_RelocObj(pReloc, &pValue->u.furtherInfoID, sizeof(*pValue->u.furtherInfoID), sReloc_FurtherInfoID);
+			break;
+		case 2:
+			AsnDeep_RelocObj(pReloc, &pValue->u.roadSignID, sizeof(*pValue->u.roadSignID), sReloc_RoadSignID);
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_TravelerDataFrame_msgId(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TravelerDataFrame_msgId *pA = (const TravelerDataFrame_msgId *)pvA;
+	const TravelerDataFrame_msgId *pB = (const TravelerDataFrame_msgId *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			ASN_DEEP_INTO("furtherInfoID", AsnDeep_CmpPtr(pDiff, pA->u.furtherInfoID, pB->u.furtherInfoID, sizeof(*pA->u.furtherInfoID), sCmp_FurtherInfoID))
+			break;
+		case 2:
+			ASN_DEEP_INTO("roadSignID", AsnDeep_CmpPtr(pDiff, pA->u.roadSignID, pB->u.roadSignID, sizeof(*pA->u.roadSignID), sCmp_RoadSignID))
+			break;
+	}
+	return ret;
+}
+
+static int sCmp_Node_LL_24B(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Node_LL_24B *pA = (const Node_LL_24B *)pvA;
+	const Node_LL_24B *pB = (const Node_LL_24B *)pvB;
+	int ret = 0;
+
+	if (pA->lon != pB->lon) ASN_DEEP_DIFFER("lon")
+	if (pA->lat != pB->lat) ASN_DEEP_DIFFER("lat")
+	return ret;
+}
+
+static int sCmp_Node_LL_28B(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Node_LL_28B *pA = (const Node_LL_28B *)pvA;
+	const Node_LL_28B *pB = (const Node_LL_28B *)pvB;
+	int ret = 0;
+
+	if (pA->lon != pB->lon) ASN_DEEP_DIFFER("lon")
+	if (pA->lat != pB->lat) ASN_DEEP_DIFFER("lat")
+	return ret;
+}
+
+static int sCmp_Node_LL_32B(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Node_LL_32B *pA = (const Node_LL_32B *)pvA;
+	const Node_LL_32B *pB = (const Node_LL_32B *)pvB;
+	int ret = 0;
+
+	if (pA->lon != pB->lon) ASN_DEEP_DIFFER("lon")
+	if (pA->lat != pB->lat) ASN_DEEP_DIFFER("lat")
+	return ret;
+}
+
+static int sCmp_Node_LL_36B(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Node_LL_36B *pA = (const Node_LL_36B *)pvA;
+	const Node_LL_36B *pB = (const Node_LL_36B *)pvB;
+	int ret = 0;
+
+	if (pA->lon != pB->lon) ASN_DEEP_DIFFER("lon")
+	if (pA->lat != pB->lat) ASN_DEEP_DIFFER("lat")
+	return ret;
+}
+
+static int sCmp_Node_LL_44B(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Node_LL_44B *pA = (const Node_LL_44B *)pvA;
+	const Node_LL_44B *pB = (const Node_LL_44B *)pvB;
+	int ret = 0;
+
+	if (pA->lon != pB->lon) ASN_DEEP_DIFFER("lon")
+	if (pA->lat != pB->lat) ASN_DEEP_DIFFER("lat")
+	return ret;
+}
+
+static int sCmp_Node_LL_48B(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Node_LL_48B *pA = (const Node_LL_48B *)pvA;
+	const Node_LL_48B *pB = (const Node_LL_48B *)pvB;
+	int ret = 0;
+
+	if (pA->lon != pB->lon) ASN_DEEP_DIFFER("lon")
+	if (pA->lat != pB->lat) ASN_DEEP_DIFFER("lat")
+	return ret;
+}
+
+static size_t sSize_NodeOffsetPointLL(const void *pv)
+{
+	const NodeOffsetPointLL *pValue = (const NodeOffsetPointLL *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 1:
+			size += AsnDeep_SizePtr(pValue->u.node_LL1, sizeof(*pValue->u.node_LL1), HAE_NULL);
+			break;
+		case 2:
+			size += AsnDeep_SizePtr(pValue->u.node_LL2, sizeof(*pValue->u.node_LL2), HAE_NULL);
+			break;
+		case 3:
+			size += AsnDeep_SizePtr(pValue->u.node_LL3, sizeof(*pValue->u.node_LL3), HAE_NULL);
+			break;
+		case 4:
+			size += AsnDeep_SizePtr(pValue->u.node_LL4, sizeof(*pValue->u.node_LL4), HAE_NULL);
+			break;
+		case 5:
+			size += AsnDeep_SizePtr(pValue->u.node_LL5, sizeof(*pValue->u.node_LL5), HAE_NULL);
+			break;
+		case 6:
+			size += AsnDeep_SizePtr(pValue->u.node_LL6, sizeof(*pValue->u.node_LL6), HAE_NULL);
+			break;
+		case 7:
+			size += AsnDeep_SizePtr(pValue->u.node_LatLon, sizeof(*pValue->u.node_LatLon), HAE_NULL);
+			break;
+		case 8:
+			size += AsnDeep_SizePtr(pValue->u.regional, sizeof(*pValue->u.regional), sSize_RegionalExtension);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_NodeOffsetPointLL(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	NodeOffsetPointLL *pDst = (NodeOffsetPointLL *)pvDst;
+	const NodeOffsetPointLL *pSrc = (const NodeOffsetPointLL *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 1:
+			pDst->u.node_LL1 = AsnDeep_CopyPtr(pArena, pSrc->u.node_LL1, sizeof(*pSrc->u.node_LL1), HAE_NULL);
+			break;
+		case 2:
+			pDst->u.node_LL2 = AsnDeep_CopyPtr(pArena, pSrc->u.node_LL2, sizeof(*pSrc->u.node_LL2), HAE_NULL);
+			break;
+		case 3:
+			pDst->u.node_LL3 = AsnDeep_CopyPtr(pArena, pSrc->u.node_LL3, sizeof(*pSrc->u.node_LL3), HAE_NULL);
+			break;
+		case 4:
+			pDst->u.node_LL4 = AsnDeep_CopyPtr(pArena, pSrc->u.node_LL4, sizeof(*pSrc->u.node_LL4), HAE_NULL);
+			break;
+		case 5:
+			pDst->u.node_LL5 = AsnDeep_CopyPtr(pArena, pSrc->u.node_LL5, sizeof(*pSrc->u.node_LL5), HAE_NULL);
+			break;
+		case 6:
+			pDst->u.node_LL6 = AsnDeep_CopyPtr(pArena, pSrc->u.node_LL6, sizeof(*pSrc->u.node_LL6), HAE_NULL);
+			break;
+		case 7:
+			pDst->u.node_LatLon = AsnDeep_CopyPtr(pArena, pSrc->u.node_LatLon, sizeof(*pSrc->u.node_LatLon), HAE_NULL);
+			break;
+		case 8:
+			pDst->u.regional = AsnDeep_CopyPtr(pArena, pSrc->u.regional, sizeof(*pSrc->u.regional), sCopy_RegionalExtension);
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_NodeOffsetPointLL(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	NodeOffsetPointLL *pValue = (NodeOffsetPointLL *)pv;
+
+	switch (pValue->t)
+	{
+		case 1:
+			AsnDeep_RelocObj(pReloc, &pValue->u.node_LL1, sizeof(*pValue->u.node_LL1), HAE_NULL);
+			break;
+		case 2:
+			AsnDeep_RelocObj(pReloc, &pValue->u.node_LL2, sizeof(*pValue->u.node_LL2), HAE_NULL);
+			break;
+		case 3:
+			AsnDeep_RelocObj(pReloc, &pValue->u.node_LL3, sizeof(*pValue->u.node_LL3), HAE_NULL);
+			break;
+		case 4:
+			AsnDeep_RelocObj(pReloc, &pValue->u.node_LL4, sizeof(*pValue->u.node_LL4), HAE_NULL);
+			break;
+		case 5:
+			AsnDeep_RelocObj(pReloc, &pValue->u.node_LL5, sizeof(*pValue->u.node_LL5), HAE_NULL);
+			break;
+		case 6:
+			AsnDeep_RelocObj(pReloc, &pValue->u.node_LL6, sizeof(*pValue->u.node_LL6), HAE_NULL);
+			break;
+		case 7:
+			AsnDeep_RelocObj(pReloc, &pValue->u.node_LatLon, sizeof(*pValue->u.node_LatLon), HAE_NULL);
+			break;
+		case 8:
+			AsnDeep_RelocObj(pReloc, &pValue->u.regional, sizeof(*pValue->u.regional), sReloc_RegionalExtension);
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_NodeOffsetPointLL(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const NodeOffsetPointLL *pA = (const NodeOffsetPointLL *)pvA;
+	const NodeOffsetPointLL *pB = (const NodeOffsetPointLL *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			ASN_DEEP_INTO("node_LL1", AsnDeep_CmpPtr(pDiff, pA->u.node_LL1, pB->u.node_LL1, sizeof(*pA->u.node_LL1), sCmp_Node_LL_24B))
+			break;
+		case 2:
+			ASN_DEEP_INTO("node_LL2", AsnDeep_CmpPtr(pDiff, pA->u.node_LL2, pB->u.node_LL2, sizeof(*pA->u.node_LL2), sCmp_Node_LL_28B))
+			break;
+		case 3:
+			ASN_DEEP_INTO("node_LL3", AsnDeep_CmpPtr(pDiff, pA->u.node_LL3, pB->u.node_LL3, sizeof(*pA->u.node_LL3), sCmp_Node_LL_32B))
+			break;
+		case 4:
+			ASN_DEEP_INTO("node_LL4", AsnDeep_CmpPtr(pDiff, pA->u.node_LL4, pB->u.node_LL4, sizeof(*pA->u.node_LL4), sCmp_Node_LL_36B))
+			break;
+		case 5:
+			ASN_DEEP_INTO("node_LL5", AsnDeep_CmpPtr(pDiff, pA->u.node_LL5, pB->u.node_LL5, sizeof(*pA->u.node_LL5), sCmp_Node_LL_44B))
+			break;
+		case 6:
+			ASN_DEEP_INTO("node_LL6", AsnDeep_CmpPtr(pDiff, pA->u.node_LL6, pB->u.node_LL6, sizeof(*pA->u.node_LL6), sCmp_Node_LL_48B))
+			break;
+		case 7:
+			ASN_DEEP_INTO("node_LatLon", AsnDeep_CmpPtr(pDiff, pA->u.node_LatLon, pB->u.node_LatLon, sizeof(*pA->u.node_LatLon), sCmp_Node_LLmD_64b))
+			break;
+		case 8:
+			ASN_DEEP_INTO("regional", AsnDeep_CmpPtr(pDiff, pA->u.regional, pB->u.regional, sizeof(*pA->u.regional), sCmp_RegionalExtension))
+			break;
+	}
+	return ret;
+}
+
+static void sReloc_NodeAttributeLLList(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	NodeAttributeLLList *pValue = (NodeAttributeLLList *)pv;
+
+	AsnDeep_RelocArray(pReloc, pValue->elem, pValue->n, sizeof(pValue->elem) / sizeof(pValue->elem[0]), sizeof(pValue->elem[0]), HAE_NULL);
+}
+
+static int sCmp_NodeAttributeLLList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const NodeAttributeLLList *pA = (const NodeAttributeLLList *)pvA;
+	const NodeAttributeLLList *pB = (const NodeAttributeLLList *)pvB;
+
+	return AsnDeep_CmpArray(pDiff, pA->elem, pA->n, pB->elem, pB->n, sizeof(pA->elem) / sizeof(pA->elem[0]), sizeof(pA->elem[0]), HAE_NULL);
+}
+
+static void sReloc_SegmentAttributeLLList(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SegmentAttributeLLList *pValue = (SegmentAttributeLLList *)pv;
+
+	AsnDeep_RelocArray(pReloc, pValue->elem, pValue->n, sizeof(pValue->elem) / sizeof(pValue->elem[0]), sizeof(pValue->elem[0]), HAE_NULL);
+}
+
+static int sCmp_SegmentAttributeLLList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SegmentAttributeLLList *pA = (const SegmentAttributeLLList *)pvA;
+	const SegmentAttributeLLList *pB = (const SegmentAttributeLLList *)pvB;
+
+	return AsnDeep_CmpArray(pDiff, pA->elem, pA->n, pB->elem, pB->n, sizeof(pA->elem) / sizeof(pA->elem[0]), sizeof(pA->elem[0]), HAE_NULL);
+}
+
+static size_t sSize_NodeAttributeSetLL(const void *pv)
+{
+	const NodeAttributeSetLL *pValue = (const NodeAttributeSetLL *)pv;
+	size_t size = 0;
+
+	if (pValue->m.dataPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->data, sizeof(LaneDataAttribute), sSize_LaneDataAttribute);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_NodeAttributeSetLL(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	NodeAttributeSetLL *pDst = (NodeAttributeSetLL *)pvDst;
+	const NodeAttributeSetLL *pSrc = (const NodeAttributeSetLL *)pvSrc;
+
+	if (pSrc->m.dataPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->data, &pSrc->data, sizeof(LaneDataAttribute), sCopy_LaneDataAttribute);
+	}
+	else
+	{
+		memset(&pDst->data, 0x00, sizeof(pDst->data));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_NodeAttributeSetLL(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	NodeAttributeSetLL *pValue = (NodeAttributeSetLL *)pv;
+
+	if (pValue->m.localNodePresent)
+	{
+		sReloc_NodeAttributeLLList(pReloc, &pValue->localNode);
+	}
+	if (pValue->m.disabledPresent)
+	{
+		sReloc_SegmentAttributeLLList(pReloc, &pValue->disabled);
+	}
+	if (pValue->m.enabledPresent)
+	{
+		sReloc_SegmentAttributeLLList(pReloc, &pValue->enabled);
+	}
+	if (pValue->m.dataPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->data, sizeof(LaneDataAttribute), sReloc_LaneDataAttribute);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_NodeAttributeSetLL(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const NodeAttributeSetLL *pA = (const NodeAttributeSetLL *)pvA;
+	const NodeAttributeSetLL *pB = (const NodeAttributeSetLL *)pvB;
+	int ret = 0;
+
+	if (pA->m.localNodePresent != pB->m.localNodePresent) ASN_DEEP_DIFFER("localNode")
+	else if (pA->m.localNodePresent)
+	{
+		ASN_DEEP_INTO("localNode", sCmp_NodeAttributeLLList(pDiff, &pA->localNode, &pB->localNode))
+	}
+	if (pA->m.disabledPresent != pB->m.disabledPresent) ASN_DEEP_DIFFER("disabled")
+	else if (pA->m.disabledPresent)
+	{
+		ASN_DEEP_INTO("disabled", sCmp_SegmentAttributeLLList(pDiff, &pA->disabled, &pB->disabled))
+	}
+	if (pA->m.enabledPresent != pB->m.enabledPresent) ASN_DEEP_DIFFER("enabled")
+	else if (pA->m.enabledPresent)
+	{
+		ASN_DEEP_INTO("enabled", sCmp_SegmentAttributeLLList(pDiff, &pA->enabled, &pB->enabled))
+	}
+	if (pA->m.dataPresent != pB->m.dataPresent) ASN_DEEP_DIFFER("data")
+	else if (pA->m.dataPresent)
+	{
+		ASN_DEEP_INTO("data", AsnDeep_CmpList(pDiff, &pA->data, &pB->data, sizeof(LaneDataAttribute), sCmp_LaneDataAttribute))
+	}
+	if (pA->m.dWidthPresent != pB->m.dWidthPresent) ASN_DEEP_DIFFER("dWidth")
+	else if (pA->m.dWidthPresent)
+	{
+		if (pA->dWidth != pB->dWidth) ASN_DEEP_DIFFER("dWidth")
+	}
+	if (pA->m.dElevationPresent != pB->m.dElevationPresent) ASN_DEEP_DIFFER("dElevation")
+	else if (pA->m.dElevationPresent)
+	{
+		if (pA->dElevation != pB->dElevation) ASN_DEEP_DIFFER("dElevation")
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_NodeLL(const void *pv)
+{
+	const NodeLL *pValue = (const NodeLL *)pv;
+	size_t size = 0;
+
+	size += sSize_NodeOffsetPointLL(&pValue->delta);
+	if (pValue->m.attributesPresent)
+	{
+		size += sSize_NodeAttributeSetLL(&pValue->attributes);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_NodeLL(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	NodeLL *pDst = (NodeLL *)pvDst;
+	const NodeLL *pSrc = (const NodeLL *)pvSrc;
+
+	sCopy_NodeOffsetPointLL(pArena, &pDst->delta, &pSrc->delta);
+	if (pSrc->m.attributesPresent)
+	{
+		sCopy_NodeAttributeSetLL(pArena, &pDst->attributes, &pSrc->attributes);
+	}
+	else
+	{
+		memset(&pDst->attributes, 0x00, sizeof(pDst->attributes));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_NodeLL(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	NodeLL *pValue = (NodeLL *)pv;
+
+	sReloc_NodeOffsetPointLL(pReloc, &pValue->delta);
+	if (pValue->m.attributesPresent)
+	{
+		sReloc_NodeAttributeSetLL(pReloc, &pValue->attributes);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_NodeLL(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const NodeLL *pA = (const NodeLL *)pvA;
+	const NodeLL *pB = (const NodeLL *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("delta", sCmp_NodeOffsetPointLL(pDiff, &pA->delta, &pB->delta))
+	if (pA->m.attributesPresent != pB->m.attributesPresent) ASN_DEEP_DIFFER("attributes")
+	else if (pA->m.attributesPresent)
+	{
+		ASN_DEEP_INTO("attributes", sCmp_NodeAttributeSetLL(pDiff, &pA->attributes, &pB->attributes))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_NodeListLL(const void *pv)
+{
+	const NodeListLL *pValue = (const NodeListLL *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 1:
+			size += AsnDeep_SizePtr(pValue->u.nodes, sizeof(*pValue->u.nodes), sSize_NodeSetLL);
+			break;
+		case 2:
+			size += AsnDeep_SizePtr(pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_SizeOpen);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_NodeListLL(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	NodeListLL *pDst = (NodeListLL *)pvDst;
+	const NodeListLL *pSrc = (const NodeListLL *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 1:
+			pDst->u.nodes = AsnDeep_CopyPtr(pArena, pSrc->u.nodes, sizeof(*pSrc->u.nodes), sCopy_NodeSetLL);
+			break;
+		case 2:
+			pDst->u.extElem1 = AsnDeep_CopyPtr(pArena, pSrc->u.extElem1, sizeof(*pSrc->u.extElem1), AsnDeep_CopyOpen);
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_NodeListLL(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	NodeListLL *pValue = (NodeListLL *)pv;
+
+	switch (pValue->t)
+	{
+		case 1:
+			AsnDeep_RelocObj(pReloc, &pValue->u.nodes, sizeof(*pValue->u.nodes), sReloc_NodeSetLL);
+			break;
+		case 2:
+			AsnDeep_RelocObj(pReloc, &pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_RelocOpen);
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_NodeListLL(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const NodeListLL *pA = (const NodeListLL *)pvA;
+	const NodeListLL *pB = (const NodeListLL *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			ASN_DEEP_INTO("nodes", AsnDeep_CmpPtr(pDiff, pA->u.nodes, pB->u.nodes, sizeof(*pA->u.nodes), sCmp_NodeSetLL))
+			break;
+		case 2:
+			ASN_DEEP_INTO("extElem1", AsnDeep_CmpPtr(pDiff, pA->u.extElem1, pB->u.extElem1, sizeof(*pA->u.extElem1), AsnDeep_CmpOpen))
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_OffsetSystem_offset(const void *pv)
+{
+	const OffsetSystem_offset *pValue = (const OffsetSystem_offset *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 1:
+			size += AsnDeep_SizePtr(pValue->u.xy, sizeof(*pValue->u.xy), sSize_NodeListXY);
+			break;
+		case 2:
+			size += AsnDeep_SizePtr(pValue->u.ll, sizeof(*pValue->u.ll), sSize_NodeListLL);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_OffsetSystem_offset(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	OffsetSystem_offset *pDst = (OffsetSystem_offset *)pvDst;
+	const OffsetSystem_offset *pSrc = (const OffsetSystem_offset *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 1:
+			pDst->u.xy = AsnDeep_CopyPtr(pArena, pSrc->u.xy, sizeof(*pSrc->u.xy), sCopy_NodeListXY);
+			break;
+		case 2:
+			pDst->u.ll = AsnDeep_CopyPtr(pArena, pSrc->u.ll, sizeof(*pSrc->u.ll), sCopy_NodeListLL);
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_OffsetSystem_offset(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	OffsetSystem_offset *pValue = (OffsetSystem_offset *)pv;
+
+	switch (pValue->t)
+	{
+		case 1:
+			AsnDeep_RelocObj(pReloc, &pValue->u.xy, sizeof(*pValue->u.xy), sReloc_NodeListXY);
+			break;
+		case 2:
+			AsnDeep_RelocObj(pReloc, &pValue->u.ll, sizeof(*pValue->u.ll), sReloc_NodeListLL);
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_OffsetSystem_offset(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const OffsetSystem_offset *pA = (const OffsetSystem_offset *)pvA;
+	const OffsetSystem_offset *pB = (const OffsetSystem_offset *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			ASN_DEEP_INTO("xy", AsnDeep_CmpPtr(pDiff, pA->u.xy, pB->u.xy, sizeof(*pA->u.xy), sCmp_NodeListXY))
+			break;
+		case 2:
+			ASN_DEEP_INTO("ll", AsnDeep_CmpPtr(pDiff, pA->u.ll, pB->u.ll, sizeof(*pA->u.ll), sCmp_NodeListLL))
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_OffsetSystem(const void *pv)
+{
+	const OffsetSystem *pValue = (const OffsetSystem *)pv;
+	size_t size = 0;
+
+	size += sSize_OffsetSystem_offset(&pValue->offset);
+	return size;
+}
+
+static void sCopy_OffsetSystem(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	OffsetSystem *pDst = (OffsetSystem *)pvDst;
+	const OffsetSystem *pSrc = (const OffsetSystem *)pvSrc;
+
+	sCopy_OffsetSystem_offset(pArena, &pDst->offset, &pSrc->offset);
+}
+
+static void sReloc_OffsetSystem(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	OffsetSystem *pValue = (OffsetSystem *)pv;
+
+	sReloc_OffsetSystem_offset(pReloc, &pValue->offset);
+}
+
+static int sCmp_OffsetSystem(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const OffsetSystem *pA = (const OffsetSystem *)pvA;
+	const OffsetSystem *pB = (const OffsetSystem *)pvB;
+	int ret = 0;
+
+	if (pA->m.scalePresent != pB->m.scalePresent) ASN_DEEP_DIFFER("scale")
+	else if (pA->m.scalePresent)
+	{
+		if (pA->scale != pB->scale) ASN_DEEP_DIFFER("scale")
+	}
+	ASN_DEEP_INTO("offset", sCmp_OffsetSystem_offset(pDiff, &pA->offset, &pB->offset))
+	return ret;
+}
+
+static size_t sSize_Circle(const void *pv)
+{
+	const Circle *pValue = (const Circle *)pv;
+	size_t size = 0;
+
+	size += sSize_Position3D(&pValue->center);
+	return size;
+}
+
+static void sCopy_Circle(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	Circle *pDst = (Circle *)pvDst;
+	const Circle *pSrc = (const Circle *)pvSrc;
+
+	sCopy_Position3D(pArena, &pDst->center, &pSrc->center);
+}
+
+static void sReloc_Circle(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	Circle *pValue = (Circle *)pv;
+
+	sReloc_Position3D(pReloc, &pValue->center);
+}
+
+static int sCmp_Circle(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Circle *pA = (const Circle *)pvA;
+	const Circle *pB = (const Circle *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("center", sCmp_Position3D(pDiff, &pA->center, &pB->center))
+	if (pA->radius != pB->radius) ASN_DEEP_DIFFER("radius")
+	if (pA->units != pB->units) ASN_DEEP_DIFFER("units")
+	return ret;
+}
+
+static size_t sSize_GeometricProjection(const void *pv)
+{
+	const GeometricProjection *pValue = (const GeometricProjection *)pv;
+	size_t size = 0;
+
+	size += sSize_Circle(&pValue->circle);
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_GeometricProjection(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	GeometricProjection *pDst = (GeometricProjection *)pvDst;
+	const GeometricProjection *pSrc = (const GeometricProjection *)pvSrc;
+
+	sCopy_Circle(pArena, &pDst->circle, &pSrc->circle);
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_GeometricProjection(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	GeometricProjection *pValue = (GeometricProjection *)pv;
+
+	sReloc_HeadingSlice(pReloc, &pValue->direction);
+	sReloc_Circle(pReloc, &pValue->circle);
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_GeometricProjection(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const GeometricProjection *pA = (const GeometricProjection *)pvA;
+	const GeometricProjection *pB = (const GeometricProjection *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("direction", sCmp_HeadingSlice(pDiff, &pA->direction, &pB->direction))
+	if (pA->m.extentPresent != pB->m.extentPresent) ASN_DEEP_DIFFER("extent")
+	else if (pA->m.extentPresent)
+	{
+		if (pA->extent != pB->extent) ASN_DEEP_DIFFER("extent")
+	}
+	if (pA->m.laneWidthPresent != pB->m.laneWidthPresent) ASN_DEEP_DIFFER("laneWidth")
+	else if (pA->m.laneWidthPresent)
+	{
+		if (pA->laneWidth != pB->laneWidth) ASN_DEEP_DIFFER("laneWidth")
+	}
+	ASN_DEEP_INTO("circle", sCmp_Circle(pDiff, &pA->circle, &pB->circle))
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_ShapePointSet(const void *pv)
+{
+	const ShapePointSet *pValue = (const ShapePointSet *)pv;
+	size_t size = 0;
+
+	if (pValue->m.anchorPresent)
+	{
+		size += sSize_Position3D(&pValue->anchor);
+	}
+	size += sSize_NodeListXY(&pValue->nodeList);
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_ShapePointSet(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	ShapePointSet *pDst = (ShapePointSet *)pvDst;
+	const ShapePointSet *pSrc = (const ShapePointSet *)pvSrc;
+
+	if (pSrc->m.anchorPresent)
+	{
+		sCopy_Position3D(pArena, &pDst->anchor, &pSrc->anchor);
+	}
+	else
+	{
+		memset(&pDst->anchor, 0x00, sizeof(pDst->anchor));
+	}
+	sCopy_NodeListXY(pArena, &pDst->nodeList, &pSrc->nodeList);
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_ShapePointSet(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	ShapePointSet *pValue = (ShapePointSet *)pv;
+
+	if (pValue->m.anchorPresent)
+	{
+		sReloc_Position3D(pReloc, &pValue->anchor);
+	}
+	sReloc_NodeListXY(pReloc, &pValue->nodeList);
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_ShapePointSet(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ShapePointSet *pA = (const ShapePointSet *)pvA;
+	const ShapePointSet *pB = (const ShapePointSet *)pvB;
+	int ret = 0;
+
+	if (pA->m.anchorPresent != pB->m.anchorPresent) ASN_DEEP_DIFFER("anchor")
+	else if (pA->m.anchorPresent)
+	{
+		ASN_DEEP_INTO("anchor", sCmp_Position3D(pDiff, &pA->anchor, &pB->anchor))
+	}
+	if (pA->m.laneWidthPresent != pB->m.laneWidthPresent) ASN_DEEP_DIFFER("laneWidth")
+	else if (pA->m.laneWidthPresent)
+	{
+		if (pA->laneWidth != pB->laneWidth) ASN_DEEP_DIFFER("laneWidth")
+	}
+	if (pA->m.directionalityPresent != pB->m.directionalityPresent) ASN_DEEP_DIFFER("directionality")
+	else if (pA->m.directionalityPresent)
+	{
+		if (pA->directionality != pB->directionality) ASN_DEEP_DIFFER("directionality")
+	}
+	ASN_DEEP_INTO("nodeList", sCmp_NodeListXY(pDiff, &pA->nodeList, &pB->nodeList))
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static int sCmp_RegionOffsets(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RegionOffsets *pA = (const RegionOffsets *)pvA;
+	const RegionOffsets *pB = (const RegionOffsets *)pvB;
+	int ret = 0;
+
+	if (pA->xOffset != pB->xOffset) ASN_DEEP_DIFFER("xOffset")
+	if (pA->yOffset != pB->yOffset) ASN_DEEP_DIFFER("yOffset")
+	if (pA->m.zOffsetPresent != pB->m.zOffsetPresent) ASN_DEEP_DIFFER("zOffset")
+	else if (pA->m.zOffsetPresent)
+	{
+		if (pA->zOffset != pB->zOffset) ASN_DEEP_DIFFER("zOffset")
+	}
+	return ret;
+}
+
+static size_t sSize_RegionPointSet(const void *pv)
+{
+	const RegionPointSet *pValue = (const RegionPointSet *)pv;
+	size_t size = 0;
+
+	if (pValue->m.anchorPresent)
+	{
+		size += sSize_Position3D(&pValue->anchor);
+	}
+	size += AsnDeep_SizeList(&pValue->nodeList, sizeof(RegionOffsets), HAE_NULL);
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_RegionPointSet(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	RegionPointSet *pDst = (RegionPointSet *)pvDst;
+	const RegionPointSet *pSrc = (const RegionPointSet *)pvSrc;
+
+	if (pSrc->m.anchorPresent)
+	{
+		sCopy_Position3D(pArena, &pDst->anchor, &pSrc->anchor);
+	}
+	else
+	{
+		memset(&pDst->anchor, 0x00, sizeof(pDst->anchor));
+	}
+	AsnDeep_CopyList(pArena, &pDst->nodeList, &pSrc->nodeList, sizeof(RegionOffsets), HAE_NULL);
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_RegionPointSet(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RegionPointSet *pValue = (RegionPointSet *)pv;
+
+	if (pValue->m.anchorPresent)
+	{
+		sReloc_Position3D(pReloc, &pValue->anchor);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->nodeList, sizeof(RegionOffsets), HAE_NULL);
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_RegionPointSet(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RegionPointSet *pA = (const RegionPointSet *)pvA;
+	const RegionPointSet *pB = (const RegionPointSet *)pvB;
+	int ret = 0;
+
+	if (pA->m.anchorPresent != pB->m.anchorPresent) ASN_DEEP_DIFFER("anchor")
+	else if (pA->m.anchorPresent)
+	{
+		ASN_DEEP_INTO("anchor", sCmp_Position3D(pDiff, &pA->anchor, &pB->anchor))
+	}
+	if (pA->m.scalePresent != pB->m.scalePresent) ASN_DEEP_DIFFER("scale")
+	else if (pA->m.scalePresent)
+	{
+		if (pA->scale != pB->scale) ASN_DEEP_DIFFER("scale")
+	}
+	ASN_DEEP_INTO("nodeList", AsnDeep_CmpList(pDiff, &pA->nodeList, &pB->nodeList, sizeof(RegionOffsets), sCmp_RegionOffsets))
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_ValidRegion_area(const void *pv)
+{
+	const ValidRegion_area *pValue = (const ValidRegion_area *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 1:
+			size += AsnDeep_SizePtr(pValue->u.shapePointSet, sizeof(*pValue->u.shapePointSet), sSize_ShapePointSet);
+			break;
+		case 2:
+			size += AsnDeep_SizePtr(pValue->u.circle, sizeof(*pValue->u.circle), sSize_Circle);
+			break;
+		case 3:
+			size += AsnDeep_SizePtr(pValue->u.regionPointSet, sizeof(*pValue->u.regionPointSet), sSize_RegionPointSet);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_ValidRegion_area(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	ValidRegion_area *pDst = (ValidRegion_area *)pvDst;
+	const ValidRegion_area *pSrc = (const ValidRegion_area *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 1:
+			pDst->u.shapePointSet = AsnDeep_CopyPtr(pArena, pSrc->u.shapePointSet, sizeof(*pSrc->u.shapePointSet), sCopy_ShapePointSet);
+			break;
+		case 2:
+			pDst->u.circle = AsnDeep_CopyPtr(pArena, pSrc->u.circle, sizeof(*pSrc->u.circle), sCopy_Circle);
+			break;
+		case 3:
+			pDst->u.regionPointSet = AsnDeep_CopyPtr(pArena, pSrc->u.regionPointSet, sizeof(*pSrc->u.regionPointSet), sCopy_RegionPointSet);
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_ValidRegion_area(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	ValidRegion_area *pValue = (ValidRegion_area *)pv;
+
+	switch (pValue->t)
+	{
+		case 1:
+			AsnDeep_RelocObj(pReloc, &pValue->u.shapePointSet, sizeof(*pValue->u.shapePointSet), sReloc_ShapePointSet);
+			break;
+		case 2:
+			AsnDeep_RelocObj(pReloc, &pValue->u.circle, sizeof(*pValue->u.circle), sReloc_Circle);
+			break;
+		case 3:
+			AsnDeep_RelocObj(pReloc, &pValue->u.regionPointSet, sizeof(*pValue->u.regionPointSet), sReloc_RegionPointSet);
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_ValidRegion_area(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ValidRegion_area *pA = (const ValidRegion_area *)pvA;
+	const ValidRegion_area *pB = (const ValidRegion_area *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			ASN_DEEP_INTO("shapePointSet", AsnDeep_CmpPtr(pDiff, pA->u.shapePointSet, pB->u.shapePointSet, sizeof(*pA->u.shapePointSet), sCmp_ShapePointSet))
+			break;
+		case 2:
+			ASN_DEEP_INTO("circle", AsnDeep_CmpPtr(pDiff, pA->u.circle, pB->u.circle, sizeof(*pA->u.circle), sCmp_Circle))
+			break;
+		case 3:
+			ASN_DEEP_INTO("regionPointSet", AsnDeep_CmpPtr(pDiff, pA->u.regionPointSet, pB->u.regionPointSet, sizeof(*pA->u.regionPointSet), sCmp_RegionPointSet))
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_ValidRegion(const void *pv)
+{
+	const ValidRegion *pValue = (const ValidRegion *)pv;
+	size_t size = 0;
+
+	size += sSize_ValidRegion_area(&pValue->area);
+	return size;
+}
+
+static void sCopy_ValidRegion(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	ValidRegion *pDst = (ValidRegion *)pvDst;
+	const ValidRegion *pSrc = (const ValidRegion *)pvSrc;
+
+	sCopy_ValidRegion_area(pArena, &pDst->area, &pSrc->area);
+}
+
+static void sReloc_ValidRegion(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	ValidRegion *pValue = (ValidRegion *)pv;
+
+	sReloc_HeadingSlice(pReloc, &pValue->direction);
+	sReloc_ValidRegion_area(pReloc, &pValue->area);
+}
+
+static int sCmp_ValidRegion(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ValidRegion *pA = (const ValidRegion *)pvA;
+	const ValidRegion *pB = (const ValidRegion *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("direction", sCmp_HeadingSlice(pDiff, &pA->direction, &pB->direction))
+	if (pA->m.extentPresent != pB->m.extentPresent) ASN_DEEP_DIFFER("extent")
+	else if (pA->m.extentPresent)
+	{
+		if (pA->extent != pB->extent) ASN_DEEP_DIFFER("extent")
+	}
+	ASN_DEEP_INTO("area", sCmp_ValidRegion_area(pDiff, &pA->area, &pB->area))
+	return ret;
+}
+
+static size_t sSize_GeographicalPath_description(const void *pv)
+{
+	const GeographicalPath_description *pValue = (const GeographicalPath_description *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 1:
+			size += AsnDeep_SizePtr(pValue->u.path, sizeof(*pValue->u.path), sSize_OffsetSystem);
+			break;
+		case 2:
+			size += AsnDeep_SizePtr(pValue->u.geometry, sizeof(*pValue->u.geometry), sSize_GeometricProjection);
+			break;
+		case 3:
+			size += AsnDeep_SizePtr(pValue->u.oldRegion, sizeof(*pValue->u.oldRegion), sSize_ValidRegion);
+			break;
+		case 4:
+			size += AsnDeep_SizePtr(pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_SizeOpen);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_GeographicalPath_description(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	GeographicalPath_description *pDst = (GeographicalPath_description *)pvDst;
+	const GeographicalPath_description *pSrc = (const GeographicalPath_description *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 1:
+			pDst->u.path = AsnDeep_CopyPtr(pArena, pSrc->u.path, sizeof(*pSrc->u.path), sCopy_OffsetSystem);
+			break;
+		case 2:
+			pDst->u.geometry = AsnDeep_CopyPtr(pArena, pSrc->u.geometry, sizeof(*pSrc->u.geometry), sCopy_GeometricProjection);
+			break;
+		case 3:
+			pDst->u.oldRegion = AsnDeep_CopyPtr(pArena, pSrc->u.oldRegion, sizeof(*pSrc->u.oldRegion), sCopy_ValidRegion);
+			break;
+		case 4:
+			pDst->u.extElem1 = AsnDeep_CopyPtr(pArena, pSrc->u.extElem1, sizeof(*pSrc->u.extElem1), AsnDeep_CopyOpen);
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_GeographicalPath_description(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	GeographicalPath_description *pValue = (GeographicalPath_description *)pv;
+
+	switch (pValue->t)
+	{
+		case 1:
+			AsnDeep_RelocObj(pReloc, &pValue->u.path, sizeof(*pValue->u.path), sReloc_OffsetSystem);
+			break;
+		case 2:
+			AsnDeep_RelocObj(pReloc, &pValue->u.geometry, sizeof(*pValue->u.geometry), sReloc_GeometricProjection);
+			break;
+		case 3:
+			AsnDeep_RelocObj(pReloc, &pValue->u.oldRegion, sizeof(*pValue->u.oldRegion), sReloc_ValidRegion);
+			break;
+		case 4:
+			AsnDeep_RelocObj(pReloc, &pValue->u.extElem1, sizeof(*pValue->u.extElem1), AsnDeep_RelocOpen);
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_GeographicalPath_description(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const GeographicalPath_description *pA = (const GeographicalPath_description *)pvA;
+	const GeographicalPath_description *pB = (const GeographicalPath_description *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			ASN_DEEP_INTO("path", AsnDeep_CmpPtr(pDiff, pA->u.path, pB->u.path, sizeof(*pA->u.path), sCmp_OffsetSystem))
+			break;
+		case 2:
+			ASN_DEEP_INTO("geometry", AsnDeep_CmpPtr(pDiff, pA->u.geometry, pB->u.geometry, sizeof(*pA->u.geometry), sCmp_GeometricProjection))
+			break;
+		case 3:
+			ASN_DEEP_INTO("oldRegion", AsnDeep_CmpPtr(pDiff, pA->u.oldRegion, pB->u.oldRegion, sizeof(*pA->u.oldRegion), sCmp_ValidRegion))
+			break;
+		case 4:
+			ASN_DEEP_INTO("extElem1", AsnDeep_CmpPtr(pDiff, pA->u.extElem1, pB->u.extElem1, sizeof(*pA->u.extElem1), AsnDeep_CmpOpen))
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_GeographicalPath(const void *pv)
+{
+	const GeographicalPath *pValue = (const GeographicalPath *)pv;
+	size_t size = 0;
+
+	if (pValue->m.namePresent)
+	{
+		size += AsnDeep_SizeStr(pValue->name);
+	}
+	if (pValue->m.anchorPresent)
+	{
+		size += sSize_Position3D(&pValue->anchor);
+	}
+	if (pValue->m.descriptionPresent)
+	{
+		size += sSize_GeographicalPath_description(&pValue->description);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_GeographicalPath(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	GeographicalPath *pDst = (GeographicalPath *)pvDst;
+	const GeographicalPath *pSrc = (const GeographicalPath *)pvSrc;
+
+	if (pSrc->m.namePresent)
+	{
+		pDst->name = AsnDeep_CopyStr(pArena, pSrc->name);
+	}
+	else
+	{
+		memset(&pDst->name, 0x00, sizeof(pDst->name));
+	}
+	if (pSrc->m.anchorPresent)
+	{
+		sCopy_Position3D(pArena, &pDst->anchor, &pSrc->anchor);
+	}
+	else
+	{
+		memset(&pDst->anchor, 0x00, sizeof(pDst->anchor));
+	}
+	if (pSrc->m.descriptionPresent)
+	{
+		sCopy_GeographicalPath_description(pArena, &pDst->description, &pSrc->description);
+	}
+	else
+	{
+		memset(&pDst->description, 0x00, sizeof(pDst->description));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_GeographicalPath(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	GeographicalPath *pValue = (GeographicalPath *)pv;
+
+	if (pValue->m.namePresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->name);
+	}
+	if (pValue->m.anchorPresent)
+	{
+		sReloc_Position3D(pReloc, &pValue->anchor);
+	}
+	if (pValue->m.directionPresent)
+	{
+		sReloc_HeadingSlice(pReloc, &pValue->direction);
+	}
+	if (pValue->m.descriptionPresent)
+	{
+		sReloc_GeographicalPath_description(pReloc, &pValue->description);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_GeographicalPath(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const GeographicalPath *pA = (const GeographicalPath *)pvA;
+	const GeographicalPath *pB = (const GeographicalPath *)pvB;
+	int ret = 0;
+
+	if (pA->m.namePresent != pB->m.namePresent) ASN_DEEP_DIFFER("name")
+	else if (pA->m.namePresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->name, pB->name)) ASN_DEEP_DIFFER("name")
+	}
+	if (pA->m.idPresent != pB->m.idPresent) ASN_DEEP_DIFFER("id")
+	else if (pA->m.idPresent)
+	{
+		ASN_DEEP_INTO("id", sCmp_RoadSegmentReferenceID(pDiff, &pA->id, &pB->id))
+	}
+	if (pA->m.anchorPresent != pB->m.anchorPresent) ASN_DEEP_DIFFER("anchor")
+	else if (pA->m.anchorPresent)
+	{
+		ASN_DEEP_INTO("anchor", sCmp_Position3D(pDiff, &pA->anchor, &pB->anchor))
+	}
+	if (pA->m.laneWidthPresent != pB->m.laneWidthPresent) ASN_DEEP_DIFFER("laneWidth")
+	else if (pA->m.laneWidthPresent)
+	{
+		if (pA->laneWidth != pB->laneWidth) ASN_DEEP_DIFFER("laneWidth")
+	}
+	if (pA->m.directionalityPresent != pB->m.directionalityPresent) ASN_DEEP_DIFFER("directionality")
+	else if (pA->m.directionalityPresent)
+	{
+		if (pA->directionality != pB->directionality) ASN_DEEP_DIFFER("directionality")
+	}
+	if (pA->m.closedPathPresent != pB->m.closedPathPresent) ASN_DEEP_DIFFER("closedPath")
+	else if (pA->m.closedPathPresent)
+	{
+		if (pA->closedPath != pB->closedPath) ASN_DEEP_DIFFER("closedPath")
+	}
+	if (pA->m.directionPresent != pB->m.directionPresent) ASN_DEEP_DIFFER("direction")
+	else if (pA->m.directionPresent)
+	{
+		ASN_DEEP_INTO("direction", sCmp_HeadingSlice(pDiff, &pA->direction, &pB->direction))
+	}
+	if (pA->m.descriptionPresent != pB->m.descriptionPresent) ASN_DEEP_DIFFER("description")
+	else if (pA->m.descriptionPresent)
+	{
+		ASN_DEEP_INTO("description", sCmp_GeographicalPath_description(pDiff, &pA->description, &pB->description))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_WorkZone_element_item(const void *pv)
+{
+	const WorkZone_element_item *pValue = (const WorkZone_element_item *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 2:
+			size += AsnDeep_SizeStr(pValue->u.text);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_WorkZone_element_item(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	WorkZone_element_item *pDst = (WorkZone_element_item *)pvDst;
+	const WorkZone_element_item *pSrc = (const WorkZone_element_item *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 2:
+			pDst->u.text = AsnDeep_CopyStr(pArena, pSrc->u.text);
+			break;
+		case 1:
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_WorkZone_element_item(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	WorkZone_element_item *pValue = (WorkZone_element_item *)pv;
+
+	switch (pValue->t)
+	{
+		case 2:
+			AsnDeep_RelocStr(pReloc, &pValue->u.text);
+			break;
+		case 1:
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_WorkZone_element_item(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const WorkZone_element_item *pA = (const WorkZone_element_item *)pvA;
+	const WorkZone_element_item *pB = (const WorkZone_element_item *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			if (pA->u.itis != pB->u.itis) ASN_DEEP_DIFFER("itis")
+			break;
+		case 2:
+			if (0 != AsnDeep_CmpStr(pA->u.text, pB->u.text)) ASN_DEEP_DIFFER("text")
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_WorkZone_element(const void *pv)
+{
+	const WorkZone_element *pValue = (const WorkZone_element *)pv;
+	size_t size = 0;
+
+	size += sSize_WorkZone_element_item(&pValue->item);
+	return size;
+}
+
+static void sCopy_WorkZone_element(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	WorkZone_element *pDst = (WorkZone_element *)pvDst;
+	const WorkZone_element *pSrc = (const WorkZone_element *)pvSrc;
+
+	sCopy_WorkZone_element_item(pArena, &pDst->item, &pSrc->item);
+}
+
+static void sReloc_WorkZone_element(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	WorkZone_element *pValue = (WorkZone_element *)pv;
+
+	sReloc_WorkZone_element_item(pReloc, &pValue->item);
+}
+
+static int sCmp_WorkZone_element(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const WorkZone_element *pA = (const WorkZone_element *)pvA;
+	const WorkZone_element *pB = (const WorkZone_element *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("item", sCmp_WorkZone_element_item(pDiff, &pA->item, &pB->item))
+	return ret;
+}
+
+static size_t sSize_GenericSignage_element_item(const void *pv)
+{
+	const GenericSignage_element_item *pValue = (const GenericSignage_element_item *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 2:
+			size += AsnDeep_SizeStr(pValue->u.text);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_GenericSignage_element_item(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	GenericSignage_element_item *pDst = (GenericSignage_element_item *)pvDst;
+	const GenericSignage_element_item *pSrc = (const GenericSignage_element_item *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 2:
+			pDst->u.text = AsnDeep_CopyStr(pArena, pSrc->u.text);
+			break;
+		case 1:
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_GenericSignage_element_item(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	GenericSignage_element_item *pValue = (GenericSignage_element_item *)pv;
+
+	switch (pValue->t)
+	{
+		case 2:
+			AsnDeep_RelocStr(pReloc, &pValue->u.text);
+			break;
+		case 1:
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_GenericSignage_element_item(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const GenericSignage_element_item *pA = (const GenericSignage_element_item *)pvA;
+	const GenericSignage_element_item *pB = (const GenericSignage_element_item *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			if (pA->u.itis != pB->u.itis) ASN_DEEP_DIFFER("itis")
+			break;
+		case 2:
+			if (0 != AsnDeep_CmpStr(pA->u.text, pB->u.text)) ASN_DEEP_DIFFER("text")
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_GenericSignage_element(const void *pv)
+{
+	const GenericSignage_element *pValue = (const GenericSignage_element *)pv;
+	size_t size = 0;
+
+	size += sSize_GenericSignage_element_item(&pValue->item);
+	return size;
+}
+
+static void sCopy_GenericSignage_element(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	GenericSignage_element *pDst = (GenericSignage_element *)pvDst;
+	const GenericSignage_element *pSrc = (const GenericSignage_element *)pvSrc;
+
+	sCopy_GenericSignage_element_item(pArena, &pDst->item, &pSrc->item);
+}
+
+static void sReloc_GenericSignage_element(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	GenericSignage_element *pValue = (GenericSignage_element *)pv;
+
+	sReloc_GenericSignage_element_item(pReloc, &pValue->item);
+}
+
+static int sCmp_GenericSignage_element(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const GenericSignage_element *pA = (const GenericSignage_element *)pvA;
+	const GenericSignage_element *pB = (const GenericSignage_element *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("item", sCmp_GenericSignage_element_item(pDiff, &pA->item, &pB->item))
+	return ret;
+}
+
+static size_t sSize_SpeedLimit_element_item(const void *pv)
+{
+	const SpeedLimit_element_item *pValue = (const SpeedLimit_element_item *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 2:
+			size += AsnDeep_SizeStr(pValue->u.text);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_SpeedLimit_element_item(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	SpeedLimit_element_item *pDst = (SpeedLimit_element_item *)pvDst;
+	const SpeedLimit_element_item *pSrc = (const SpeedLimit_element_item *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 2:
+			pDst->u.text = AsnDeep_CopyStr(pArena, pSrc->u.text);
+			break;
+		case 1:
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_SpeedLimit_element_item(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SpeedLimit_element_item *pValue = (SpeedLimit_element_item *)pv;
+
+	switch (pValue->t)
+	{
+		case 2:
+			AsnDeep_RelocStr(pReloc, &pValue->u.text);
+			break;
+		case 1:
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_SpeedLimit_element_item(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SpeedLimit_element_item *pA = (const SpeedLimit_element_item *)pvA;
+	const SpeedLimit_element_item *pB = (const SpeedLimit_element_item *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			if (pA->u.itis != pB->u.itis) ASN_DEEP_DIFFER("itis")
+			break;
+		case 2:
+			if (0 != AsnDeep_CmpStr(pA->u.text, pB->u.text)) ASN_DEEP_DIFFER("text")
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_SpeedLimit_element(const void *pv)
+{
+	const SpeedLimit_element *pValue = (const SpeedLimit_element *)pv;
+	size_t size = 0;
+
+	size += sSize_SpeedLimit_element_item(&pValue->item);
+	return size;
+}
+
+static void sCopy_SpeedLimit_element(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	SpeedLimit_element *pDst = (SpeedLimit_element *)pvDst;
+	const SpeedLimit_element *pSrc = (const SpeedLimit_element *)pvSrc;
+
+	sCopy_SpeedLimit_element_item(pArena, &pDst->item, &pSrc->item);
+}
+
+static void sReloc_SpeedLimit_element(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SpeedLimit_element *pValue = (SpeedLimit_element *)pv;
+
+	sReloc_SpeedLimit_element_item(pReloc, &pValue->item);
+}
+
+static int sCmp_SpeedLimit_element(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SpeedLimit_element *pA = (const SpeedLimit_element *)pvA;
+	const SpeedLimit_element *pB = (const SpeedLimit_element *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("item", sCmp_SpeedLimit_element_item(pDiff, &pA->item, &pB->item))
+	return ret;
+}
+
+static size_t sSize_ExitService_element_item(const void *pv)
+{
+	const ExitService_element_item *pValue = (const ExitService_element_item *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 2:
+			size += AsnDeep_SizeStr(pValue->u.text);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_ExitService_element_item(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	ExitService_element_item *pDst = (ExitService_element_item *)pvDst;
+	const ExitService_element_item *pSrc = (const ExitService_element_item *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 2:
+			pDst->u.text = AsnDeep_CopyStr(pArena, pSrc->u.text);
+			break;
+		case 1:
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_ExitService_element_item(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	ExitService_element_item *pValue = (ExitService_element_item *)pv;
+
+	switch (pValue->t)
+	{
+		case 2:
+			AsnDeep_RelocStr(pReloc, &pValue->u.text);
+			break;
+		case 1:
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_ExitService_element_item(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ExitService_element_item *pA = (const ExitService_element_item *)pvA;
+	const ExitService_element_item *pB = (const ExitService_element_item *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			if (pA->u.itis != pB->u.itis) ASN_DEEP_DIFFER("itis")
+			break;
+		case 2:
+			if (0 != AsnDeep_CmpStr(pA->u.text, pB->u.text)) ASN_DEEP_DIFFER("text")
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_ExitService_element(const void *pv)
+{
+	const ExitService_element *pValue = (const ExitService_element *)pv;
+	size_t size = 0;
+
+	size += sSize_ExitService_element_item(&pValue->item);
+	return size;
+}
+
+static void sCopy_ExitService_element(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	ExitService_element *pDst = (ExitService_element *)pvDst;
+	const ExitService_element *pSrc = (const ExitService_element *)pvSrc;
+
+	sCopy_ExitService_element_item(pArena, &pDst->item, &pSrc->item);
+}
+
+static void sReloc_ExitService_element(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	ExitService_element *pValue = (ExitService_element *)pv;
+
+	sReloc_ExitService_element_item(pReloc, &pValue->item);
+}
+
+static int sCmp_ExitService_element(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ExitService_element *pA = (const ExitService_element *)pvA;
+	const ExitService_element *pB = (const ExitService_element *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("item", sCmp_ExitService_element_item(pDiff, &pA->item, &pB->item))
+	return ret;
+}
+
+static size_t sSize_TravelerDataFrame_content(const void *pv)
+{
+	const TravelerDataFrame_content *pValue = (const TravelerDataFrame_content *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 1:
+			size += AsnDeep_SizePtr(pValue->u.advisory, sizeof(*pValue->u.advisory), sSize_ITIScodesAndText);
+			break;
+		case 2:
+			size += AsnDeep_SizePtr(pValue->u.workZone, sizeof(*pValue->u.workZone), sSize_WorkZone);
+			break;
+		case 3:
+			size += AsnDeep_SizePtr(pValue->u.genericSign, sizeof(*pValue->u.genericSign), sSize_GenericSignage);
+			break;
+		case 4:
+			size += AsnDeep_SizePtr(pValue->u.speedLimit, sizeof(*pValue->u.speedLimit), sSize_SpeedLimit);
+			break;
+		case 5:
+			size += AsnDeep_SizePtr(pValue->u.exitService, sizeof(*pValue->u.exitService), sSize_ExitService);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_TravelerDataFrame_content(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TravelerDataFrame_content *pDst = (TravelerDataFrame_content *)pvDst;
+	const TravelerDataFrame_content *pSrc = (const TravelerDataFrame_content *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 1:
+			pDst->u.advisory = AsnDeep_CopyPtr(pArena, pSrc->u.advisory, sizeof(*pSrc->u.advisory), sCopy_ITIScodesAndText);
+			break;
+		case 2:
+			pDst->u.workZone = AsnDeep_CopyPtr(pArena, pSrc->u.workZone, sizeof(*pSrc->u.workZone), sCopy_WorkZone);
+			break;
+		case 3:
+			pDst->u.genericSign = AsnDeep_CopyPtr(pArena, pSrc->u.genericSign, sizeof(*pSrc->u.genericSign), sCopy_GenericSignage);
+			break;
+		case 4:
+			pDst->u.speedLimit = AsnDeep_CopyPtr(pArena, pSrc->u.speedLimit, sizeof(*pSrc->u.speedLimit), sCopy_SpeedLimit);
+			break;
+		case 5:
+			pDst->u.exitService = AsnDeep_CopyPtr(pArena, pSrc->u.exitService, sizeof(*pSrc->u.exitService), sCopy_ExitService);
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_TravelerDataFrame_content(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TravelerDataFrame_content *pValue = (TravelerDataFrame_content *)pv;
+
+	switch (pValue->t)
+	{
+		case 1:
+			AsnDeep_RelocObj(pReloc, &pValue->u.advisory, sizeof(*pValue->u.advisory), sReloc_ITIScodesAndText);
+			break;
+		case 2:
+			AsnDeep_RelocObj(pReloc, &pValue->u.workZone, sizeof(*pValue->u.workZone), sReloc_WorkZone);
+			break;
+		case 3:
+			AsnDeep_RelocObj(pReloc, &pValue->u.genericSign, sizeof(*pValue->u.genericSign), sReloc_GenericSignage);
+			break;
+		case 4:
+			AsnDeep_RelocObj(pReloc, &pValue->u.speedLimit, sizeof(*pValue->u.speedLimit), sReloc_SpeedLimit);
+			break;
+		case 5:
+			AsnDeep_RelocObj(pReloc, &pValue->u.exitService, sizeof(*pValue->u.exitService), sReloc_ExitService);
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_TravelerDataFrame_content(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TravelerDataFrame_content *pA = (const TravelerDataFrame_content *)pvA;
+	const TravelerDataFrame_content *pB = (const TravelerDataFrame_content *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			ASN_DEEP_INTO("advisory", AsnDeep_CmpPtr(pDiff, pA->u.advisory, pB->u.advisory, sizeof(*pA->u.advisory), sCmp_ITIScodesAndText))
+			break;
+		case 2:
+			ASN_DEEP_INTO("workZone", AsnDeep_CmpPtr(pDiff, pA->u.workZone, pB->u.workZone, sizeof(*pA->u.workZone), sCmp_WorkZone))
+			break;
+		case 3:
+			ASN_DEEP_INTO("genericSign", AsnDeep_CmpPtr(pDiff, pA->u.genericSign, pB->u.genericSign, sizeof(*pA->u.genericSign), sCmp_GenericSignage))
+			break;
+		case 4:
+			ASN_DEEP_INTO("speedLimit", AsnDeep_CmpPtr(pDiff, pA->u.speedLimit, pB->u.speedLimit, sizeof(*pA->u.speedLimit), sCmp_SpeedLimit))
+			break;
+		case 5:
+			ASN_DEEP_INTO("exitService", AsnDeep_CmpPtr(pDiff, pA->u.exitService, pB->u.exitService, sizeof(*pA->u.exitService), sCmp_ExitService))
+			break;
+	}
+	return ret;
+}
+
+static size_t sSize_TravelerDataFrame(const void *pv)
+{
+	const TravelerDataFrame *pValue = (const TravelerDataFrame *)pv;
+	size_t size = 0;
+
+	size += sSize_TravelerDataFrame_msgId(&pValue->msgId);
+	size += AsnDeep_SizeList(&pValue->regions, sizeof(GeographicalPath), sSize_GeographicalPath);
+	size += sSize_TravelerDataFrame_content(&pValue->content);
+	if (pValue->m.urlPresent)
+	{
+		size += AsnDeep_SizeStr(pValue->url);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TravelerDataFrame(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TravelerDataFrame *pDst = (TravelerDataFrame *)pvDst;
+	const TravelerDataFrame *pSrc = (const TravelerDataFrame *)pvSrc;
+
+	sCopy_TravelerDataFrame_msgId(pArena, &pDst->msgId, &pSrc->msgId);
+	AsnDeep_CopyList(pArena, &pDst->regions, &pSrc->regions, sizeof(GeographicalPath), sCopy_GeographicalPath);
+	sCopy_TravelerDataFrame_content(pArena, &pDst->content, &pSrc->content);
+	if (pSrc->m.urlPresent)
+	{
+		pDst->url = AsnDeep_CopyStr(pArena, pSrc->url);
+	}
+	else
+	{
+		memset(&pDst->url, 0x00, sizeof(pDst->url));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TravelerDataFrame(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TravelerDataFrame *pValue = (TravelerDataFrame *)pv;
+
+	sReloc_TravelerDataFrame_msgId(pReloc, &pValue->msgId);
+	AsnDeep_RelocList(pReloc, &pValue->regions, sizeof(GeographicalPath), sReloc_GeographicalPath);
+	sReloc_TravelerDataFrame_content(pReloc, &pValue->content);
+	if (pValue->m.urlPresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->url);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TravelerDataFrame(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TravelerDataFrame *pA = (const TravelerDataFrame *)pvA;
+	const TravelerDataFrame *pB = (const TravelerDataFrame *)pvB;
+	int ret = 0;
+
+	if (pA->sspTimRights != pB->sspTimRights) ASN_DEEP_DIFFER("sspTimRights")
+	if (pA->frameType != pB->frameType) ASN_DEEP_DIFFER("frameType")
+	ASN_DEEP_INTO("msgId", sCmp_TravelerDataFrame_msgId(pDiff, &pA->msgId, &pB->msgId))
+	if (pA->m.startYearPresent != pB->m.startYearPresent) ASN_DEEP_DIFFER("startYear")
+	else if (pA->m.startYearPresent)
+	{
+		if (pA->startYear != pB->startYear) ASN_DEEP_DIFFER("startYear")
+	}
+	if (pA->startTime != pB->startTime) ASN_DEEP_DIFFER("startTime")
+	if (pA->duratonTime != pB->duratonTime) ASN_DEEP_DIFFER("duratonTime")
+	if (pA->priority != pB->priority) ASN_DEEP_DIFFER("priority")
+	if (pA->sspLocationRights != pB->sspLocationRights) ASN_DEEP_DIFFER("sspLocationRights")
+	ASN_DEEP_INTO("regions", AsnDeep_CmpList(pDiff, &pA->regions, &pB->regions, sizeof(GeographicalPath), sCmp_GeographicalPath))
+	if (pA->sspMsgRights1 != pB->sspMsgRights1) ASN_DEEP_DIFFER("sspMsgRights1")
+	if (pA->sspMsgRights2 != pB->sspMsgRights2) ASN_DEEP_DIFFER("sspMsgRights2")
+	ASN_DEEP_INTO("content", sCmp_TravelerDataFrame_content(pDiff, &pA->content, &pB->content))
+	if (pA->m.urlPresent != pB->m.urlPresent) ASN_DEEP_DIFFER("url")
+	else if (pA->m.urlPresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->url, pB->url)) ASN_DEEP_DIFFER("url")
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TravelerInformation(const void *pv)
+{
+	const TravelerInformation *pValue = (const TravelerInformation *)pv;
+	size_t size = 0;
+
+	if (pValue->m.urlBPresent)
+	{
+		size += AsnDeep_SizeStr(pValue->urlB);
+	}
+	size += AsnDeep_SizeList(&pValue->dataFrames, sizeof(TravelerDataFrame), sSize_TravelerDataFrame);
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TravelerInformation(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TravelerInformation *pDst = (TravelerInformation *)pvDst;
+	const TravelerInformation *pSrc = (const TravelerInformation *)pvSrc;
+
+	if (pSrc->m.urlBPresent)
+	{
+		pDst->urlB = AsnDeep_CopyStr(pArena, pSrc->urlB);
+	}
+	else
+	{
+		memset(&pDst->urlB, 0x00, sizeof(pDst->urlB));
+	}
+	AsnDeep_CopyList(pArena, &pDst->dataFrames, &pSrc->dataFrames, sizeof(TravelerDataFrame), sCopy_TravelerDataFrame);
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TravelerInformation(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TravelerInformation *pValue = (TravelerInformation *)pv;
+
+	if (pValue->m.packetIDPresent)
+	{
+		sReloc_UniqueMSGID(pReloc, &pValue->packetID);
+	}
+	if (pValue->m.urlBPresent)
+	{
+		AsnDeep_RelocStr(pReloc, &pValue->urlB);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->dataFrames, sizeof(TravelerDataFrame), sReloc_TravelerDataFrame);
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TravelerInformation(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TravelerInformation *pA = (const TravelerInformation *)pvA;
+	const TravelerInformation *pB = (const TravelerInformation *)pvB;
+	int ret = 0;
+
+	if (pA->msgCnt != pB->msgCnt) ASN_DEEP_DIFFER("msgCnt")
+	if (pA->m.timeStampPresent != pB->m.timeStampPresent) ASN_DEEP_DIFFER("timeStamp")
+	else if (pA->m.timeStampPresent)
+	{
+		if (pA->timeStamp != pB->timeStamp) ASN_DEEP_DIFFER("timeStamp")
+	}
+	if (pA->m.packetIDPresent != pB->m.packetIDPresent) ASN_DEEP_DIFFER("packetID")
+	else if (pA->m.packetIDPresent)
+	{
+		ASN_DEEP_INTO("packetID", sCmp_UniqueMSGID(pDiff, &pA->packetID, &pB->packetID))
+	}
+	if (pA->m.urlBPresent != pB->m.urlBPresent) ASN_DEEP_DIFFER("urlB")
+	else if (pA->m.urlBPresent)
+	{
+		if (0 != AsnDeep_CmpStr(pA->urlB, pB->urlB)) ASN_DEEP_DIFFER("urlB")
+	}
+	ASN_DEEP_INTO("dataFrames", AsnDeep_CmpList(pDiff, &pA->dataFrames, &pB->dataFrames, sizeof(TravelerDataFrame), sCmp_TravelerDataFrame))
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_Header(const void *pv)
+{
+	const Header *pValue = (const Header *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_Header(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	Header *pDst = (Header *)pvDst;
+	const Header *pSrc = (const Header *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_Header(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	Header *pValue = (Header *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_Header(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const Header *pA = (const Header *)pvA;
+	const Header *pB = (const Header *)pvB;
+	int ret = 0;
+
+	if (pA->m.yearPresent != pB->m.yearPresent) ASN_DEEP_DIFFER("year")
+	else if (pA->m.yearPresent)
+	{
+		if (pA->year != pB->year) ASN_DEEP_DIFFER("year")
+	}
+	if (pA->m.timeStampPresent != pB->m.timeStampPresent) ASN_DEEP_DIFFER("timeStamp")
+	else if (pA->m.timeStampPresent)
+	{
+		if (pA->timeStamp != pB->timeStamp) ASN_DEEP_DIFFER("timeStamp")
+	}
+	if (pA->m.secMarkPresent != pB->m.secMarkPresent) ASN_DEEP_DIFFER("secMark")
+	else if (pA->m.secMarkPresent)
+	{
+		if (pA->secMark != pB->secMark) ASN_DEEP_DIFFER("secMark")
+	}
+	if (pA->m.msgIssueRevisionPresent != pB->m.msgIssueRevisionPresent) ASN_DEEP_DIFFER("msgIssueRevision")
+	else if (pA->m.msgIssueRevisionPresent)
+	{
+		if (pA->msgIssueRevision != pB->msgIssueRevision) ASN_DEEP_DIFFER("msgIssueRevision")
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage00(const void *pv)
+{
+	const TestMessage00 *pValue = (const TestMessage00 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage00(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage00 *pDst = (TestMessage00 *)pvDst;
+	const TestMessage00 *pSrc = (const TestMessage00 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage00(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage00 *pValue = (TestMessage00 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage00(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage00 *pA = (const TestMessage00 *)pvA;
+	const TestMessage00 *pB = (const TestMessage00 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage01(const void *pv)
+{
+	const TestMessage01 *pValue = (const TestMessage01 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage01(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage01 *pDst = (TestMessage01 *)pvDst;
+	const TestMessage01 *pSrc = (const TestMessage01 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage01(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage01 *pValue = (TestMessage01 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage01(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage01 *pA = (const TestMessage01 *)pvA;
+	const TestMessage01 *pB = (const TestMessage01 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage02(const void *pv)
+{
+	const TestMessage02 *pValue = (const TestMessage02 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage02(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage02 *pDst = (TestMessage02 *)pvDst;
+	const TestMessage02 *pSrc = (const TestMessage02 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage02(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage02 *pValue = (TestMessage02 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage02(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage02 *pA = (const TestMessage02 *)pvA;
+	const TestMessage02 *pB = (const TestMessage02 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage03(const void *pv)
+{
+	const TestMessage03 *pValue = (const TestMessage03 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage03(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage03 *pDst = (TestMessage03 *)pvDst;
+	const TestMessage03 *pSrc = (const TestMessage03 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage03(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage03 *pValue = (TestMessage03 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage03(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage03 *pA = (const TestMessage03 *)pvA;
+	const TestMessage03 *pB = (const TestMessage03 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage04(const void *pv)
+{
+	const TestMessage04 *pValue = (const TestMessage04 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage04(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage04 *pDst = (TestMessage04 *)pvDst;
+	const TestMessage04 *pSrc = (const TestMessage04 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage04(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage04 *pValue = (TestMessage04 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage04(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage04 *pA = (const TestMessage04 *)pvA;
+	const TestMessage04 *pB = (const TestMessage04 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage05(const void *pv)
+{
+	const TestMessage05 *pValue = (const TestMessage05 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage05(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage05 *pDst = (TestMessage05 *)pvDst;
+	const TestMessage05 *pSrc = (const TestMessage05 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage05(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage05 *pValue = (TestMessage05 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage05(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage05 *pA = (const TestMessage05 *)pvA;
+	const TestMessage05 *pB = (const TestMessage05 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage06(const void *pv)
+{
+	const TestMessage06 *pValue = (const TestMessage06 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage06(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage06 *pDst = (TestMessage06 *)pvDst;
+	const TestMessage06 *pSrc = (const TestMessage06 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage06(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage06 *pValue = (TestMessage06 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage06(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage06 *pA = (const TestMessage06 *)pvA;
+	const TestMessage06 *pB = (const TestMessage06 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage07(const void *pv)
+{
+	const TestMessage07 *pValue = (const TestMessage07 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage07(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage07 *pDst = (TestMessage07 *)pvDst;
+	const TestMessage07 *pSrc = (const TestMessage07 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage07(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage07 *pValue = (TestMessage07 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage07(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage07 *pA = (const TestMessage07 *)pvA;
+	const TestMessage07 *pB = (const TestMessage07 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage08(const void *pv)
+{
+	const TestMessage08 *pValue = (const TestMessage08 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage08(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage08 *pDst = (TestMessage08 *)pvDst;
+	const TestMessage08 *pSrc = (const TestMessage08 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage08(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage08 *pValue = (TestMessage08 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage08(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage08 *pA = (const TestMessage08 *)pvA;
+	const TestMessage08 *pB = (const TestMessage08 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage09(const void *pv)
+{
+	const TestMessage09 *pValue = (const TestMessage09 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage09(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage09 *pDst = (TestMessage09 *)pvDst;
+	const TestMessage09 *pSrc = (const TestMessage09 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage09(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage09 *pValue = (TestMessage09 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage09(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage09 *pA = (const TestMessage09 *)pvA;
+	const TestMessage09 *pB = (const TestMessage09 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage10(const void *pv)
+{
+	const TestMessage10 *pValue = (const TestMessage10 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage10(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage10 *pDst = (TestMessage10 *)pvDst;
+	const TestMessage10 *pSrc = (const TestMessage10 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage10(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage10 *pValue = (TestMessage10 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage10(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage10 *pA = (const TestMessage10 *)pvA;
+	const TestMessage10 *pB = (const TestMessage10 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage11(const void *pv)
+{
+	const TestMessage11 *pValue = (const TestMessage11 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage11(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage11 *pDst = (TestMessage11 *)pvDst;
+	const TestMessage11 *pSrc = (const TestMessage11 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage11(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage11 *pValue = (TestMessage11 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage11(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage11 *pA = (const TestMessage11 *)pvA;
+	const TestMessage11 *pB = (const TestMessage11 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage12(const void *pv)
+{
+	const TestMessage12 *pValue = (const TestMessage12 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage12(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage12 *pDst = (TestMessage12 *)pvDst;
+	const TestMessage12 *pSrc = (const TestMessage12 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage12(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage12 *pValue = (TestMessage12 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage12(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage12 *pA = (const TestMessage12 *)pvA;
+	const TestMessage12 *pB = (const TestMessage12 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage13(const void *pv)
+{
+	const TestMessage13 *pValue = (const TestMessage13 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage13(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage13 *pDst = (TestMessage13 *)pvDst;
+	const TestMessage13 *pSrc = (const TestMessage13 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage13(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage13 *pValue = (TestMessage13 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage13(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage13 *pA = (const TestMessage13 *)pvA;
+	const TestMessage13 *pB = (const TestMessage13 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage14(const void *pv)
+{
+	const TestMessage14 *pValue = (const TestMessage14 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage14(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage14 *pDst = (TestMessage14 *)pvDst;
+	const TestMessage14 *pSrc = (const TestMessage14 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage14(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage14 *pValue = (TestMessage14 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage14(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage14 *pA = (const TestMessage14 *)pvA;
+	const TestMessage14 *pB = (const TestMessage14 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TestMessage15(const void *pv)
+{
+	const TestMessage15 *pValue = (const TestMessage15 *)pv;
+	size_t size = 0;
+
+	if (pValue->m.headerPresent)
+	{
+		size += sSize_Header(&pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += sSize_RegionalExtension(&pValue->regional);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TestMessage15(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TestMessage15 *pDst = (TestMessage15 *)pvDst;
+	const TestMessage15 *pSrc = (const TestMessage15 *)pvSrc;
+
+	if (pSrc->m.headerPresent)
+	{
+		sCopy_Header(pArena, &pDst->header, &pSrc->header);
+	}
+	else
+	{
+		memset(&pDst->header, 0x00, sizeof(pDst->header));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		sCopy_RegionalExtension(pArena, &pDst->regional, &pSrc->regional);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TestMessage15(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TestMessage15 *pValue = (TestMessage15 *)pv;
+
+	if (pValue->m.headerPresent)
+	{
+		sReloc_Header(pReloc, &pValue->header);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		sReloc_RegionalExtension(pReloc, &pValue->regional);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TestMessage15(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TestMessage15 *pA = (const TestMessage15 *)pvA;
+	const TestMessage15 *pB = (const TestMessage15 *)pvB;
+	int ret = 0;
+
+	if (pA->m.headerPresent != pB->m.headerPresent) ASN_DEEP_DIFFER("header")
+	else if (pA->m.headerPresent)
+	{
+		ASN_DEEP_INTO("header", sCmp_Header(pDiff, &pA->header, &pB->header))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", sCmp_RegionalExtension(pDiff, &pA->regional, &pB->regional))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static int sCmp_DDate(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const DDate *pA = (const DDate *)pvA;
+	const DDate *pB = (const DDate *)pvB;
+	int ret = 0;
+
+	if (pA->year != pB->year) ASN_DEEP_DIFFER("year")
+	if (pA->month != pB->month) ASN_DEEP_DIFFER("month")
+	if (pA->day != pB->day) ASN_DEEP_DIFFER("day")
+	return ret;
+}
+
+static int sCmp_DFullTime(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const DFullTime *pA = (const DFullTime *)pvA;
+	const DFullTime *pB = (const DFullTime *)pvB;
+	int ret = 0;
+
+	if (pA->year != pB->year) ASN_DEEP_DIFFER("year")
+	if (pA->month != pB->month) ASN_DEEP_DIFFER("month")
+	if (pA->day != pB->day) ASN_DEEP_DIFFER("day")
+	if (pA->hour != pB->hour) ASN_DEEP_DIFFER("hour")
+	if (pA->minute != pB->minute) ASN_DEEP_DIFFER("minute")
+	return ret;
+}
+
+static int sCmp_DMonthDay(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const DMonthDay *pA = (const DMonthDay *)pvA;
+	const DMonthDay *pB = (const DMonthDay *)pvB;
+	int ret = 0;
+
+	if (pA->month != pB->month) ASN_DEEP_DIFFER("month")
+	if (pA->day != pB->day) ASN_DEEP_DIFFER("day")
+	return ret;
+}
+
+static int sCmp_DTime(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const DTime *pA = (const DTime *)pvA;
+	const DTime *pB = (const DTime *)pvB;
+	int ret = 0;
+
+	if (pA->hour != pB->hour) ASN_DEEP_DIFFER("hour")
+	if (pA->minute != pB->minute) ASN_DEEP_DIFFER("minute")
+	if (pA->second != pB->second) ASN_DEEP_DIFFER("second")
+	if (pA->m.offsetPresent != pB->m.offsetPresent) ASN_DEEP_DIFFER("offset")
+	else if (pA->m.offsetPresent)
+	{
+		if (pA->offset != pB->offset) ASN_DEEP_DIFFER("offset")
+	}
+	return ret;
+}
+
+static int sCmp_DYearMonth(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const DYearMonth *pA = (const DYearMonth *)pvA;
+	const DYearMonth *pB = (const DYearMonth *)pvB;
+	int ret = 0;
+
+	if (pA->year != pB->year) ASN_DEEP_DIFFER("year")
+	if (pA->month != pB->month) ASN_DEEP_DIFFER("month")
+	return ret;
+}
+
+static size_t sSize_DisabledVehicle(const void *pv)
+{
+	const DisabledVehicle *pValue = (const DisabledVehicle *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_DisabledVehicle(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	DisabledVehicle *pDst = (DisabledVehicle *)pvDst;
+	const DisabledVehicle *pSrc = (const DisabledVehicle *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_DisabledVehicle(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	DisabledVehicle *pValue = (DisabledVehicle *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_DisabledVehicle(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const DisabledVehicle *pA = (const DisabledVehicle *)pvA;
+	const DisabledVehicle *pB = (const DisabledVehicle *)pvB;
+	int ret = 0;
+
+	if (pA->statusDetails != pB->statusDetails) ASN_DEEP_DIFFER("statusDetails")
+	if (pA->m.locationDetailsPresent != pB->m.locationDetailsPresent) ASN_DEEP_DIFFER("locationDetails")
+	else if (pA->m.locationDetailsPresent)
+	{
+		if (pA->locationDetails != pB->locationDetails) ASN_DEEP_DIFFER("locationDetails")
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static void sReloc_EventDescription_description(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	EventDescription_description *pValue = (EventDescription_description *)pv;
+
+	AsnDeep_RelocArray(pReloc, pValue->elem, pValue->n, sizeof(pValue->elem) / sizeof(pValue->elem[0]), sizeof(pValue->elem[0]), HAE_NULL);
+}
+
+static int sCmp_EventDescription_description(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const EventDescription_description *pA = (const EventDescription_description *)pvA;
+	const EventDescription_description *pB = (const EventDescription_description *)pvB;
+
+	return AsnDeep_CmpArray(pDiff, pA->elem, pA->n, pB->elem, pB->n, sizeof(pA->elem) / sizeof(pA->elem[0]), sizeof(pA->elem[0]), HAE_NULL);
+}
+
+static size_t sSize_EventDescription(const void *pv)
+{
+	const EventDescription *pValue = (const EventDescription *)pv;
+	size_t size = 0;
+
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_EventDescription(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	EventDescription *pDst = (EventDescription *)pvDst;
+	const EventDescription *pSrc = (const EventDescription *)pvSrc;
+
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_EventDescription(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	EventDescription *pValue = (EventDescription *)pv;
+
+	if (pValue->m.descriptionPresent)
+	{
+		sReloc_EventDescription_description(pReloc, &pValue->description);
+	}
+	if (pValue->m.priorityPresent)
+	{
+		sReloc_Priority(pReloc, &pValue->priority);
+	}
+	if (pValue->m.headingPresent)
+	{
+		sReloc_HeadingSlice(pReloc, &pValue->heading);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_EventDescription(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const EventDescription *pA = (const EventDescription *)pvA;
+	const EventDescription *pB = (const EventDescription *)pvB;
+	int ret = 0;
+
+	if (pA->typeEvent != pB->typeEvent) ASN_DEEP_DIFFER("typeEvent")
+	if (pA->m.descriptionPresent != pB->m.descriptionPresent) ASN_DEEP_DIFFER("description")
+	else if (pA->m.descriptionPresent)
+	{
+		ASN_DEEP_INTO("description", sCmp_EventDescription_description(pDiff, &pA->description, &pB->description))
+	}
+	if (pA->m.priorityPresent != pB->m.priorityPresent) ASN_DEEP_DIFFER("priority")
+	else if (pA->m.priorityPresent)
+	{
+		ASN_DEEP_INTO("priority", sCmp_Priority(pDiff, &pA->priority, &pB->priority))
+	}
+	if (pA->m.headingPresent != pB->m.headingPresent) ASN_DEEP_DIFFER("heading")
+	else if (pA->m.headingPresent)
+	{
+		ASN_DEEP_INTO("heading", sCmp_HeadingSlice(pDiff, &pA->heading, &pB->heading))
+	}
+	if (pA->m.extentPresent != pB->m.extentPresent) ASN_DEEP_DIFFER("extent")
+	else if (pA->m.extentPresent)
+	{
+		if (pA->extent != pB->extent) ASN_DEEP_DIFFER("extent")
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_ObstacleDetection(const void *pv)
+{
+	const ObstacleDetection *pValue = (const ObstacleDetection *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_ObstacleDetection(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	ObstacleDetection *pDst = (ObstacleDetection *)pvDst;
+	const ObstacleDetection *pSrc = (const ObstacleDetection *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_ObstacleDetection(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	ObstacleDetection *pValue = (ObstacleDetection *)pv;
+
+	if (pValue->m.vertEventPresent)
+	{
+		sReloc_VerticalAccelerationThreshold(pReloc, &pValue->vertEvent);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_ObstacleDetection(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ObstacleDetection *pA = (const ObstacleDetection *)pvA;
+	const ObstacleDetection *pB = (const ObstacleDetection *)pvB;
+	int ret = 0;
+
+	if (pA->obDist != pB->obDist) ASN_DEEP_DIFFER("obDist")
+	if (pA->obDirect != pB->obDirect) ASN_DEEP_DIFFER("obDirect")
+	if (pA->m.descriptionPresent != pB->m.descriptionPresent) ASN_DEEP_DIFFER("description")
+	else if (pA->m.descriptionPresent)
+	{
+		if (pA->description != pB->description) ASN_DEEP_DIFFER("description")
+	}
+	if (pA->m.locationDetailsPresent != pB->m.locationDetailsPresent) ASN_DEEP_DIFFER("locationDetails")
+	else if (pA->m.locationDetailsPresent)
+	{
+		if (pA->locationDetails != pB->locationDetails) ASN_DEEP_DIFFER("locationDetails")
+	}
+	ASN_DEEP_INTO("dateTime", sCmp_DDateTime(pDiff, &pA->dateTime, &pB->dateTime))
+	if (pA->m.vertEventPresent != pB->m.vertEventPresent) ASN_DEEP_DIFFER("vertEvent")
+	else if (pA->m.vertEventPresent)
+	{
+		ASN_DEEP_INTO("vertEvent", sCmp_VerticalAccelerationThreshold(pDiff, &pA->vertEvent, &pB->vertEvent))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_PivotPointDescription(const void *pv)
+{
+	const PivotPointDescription *pValue = (const PivotPointDescription *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_PivotPointDescription(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	PivotPointDescription *pDst = (PivotPointDescription *)pvDst;
+	const PivotPointDescription *pSrc = (const PivotPointDescription *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_PivotPointDescription(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	PivotPointDescription *pValue = (PivotPointDescription *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_PivotPointDescription(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const PivotPointDescription *pA = (const PivotPointDescription *)pvA;
+	const PivotPointDescription *pB = (const PivotPointDescription *)pvB;
+	int ret = 0;
+
+	if (pA->pivotOffset != pB->pivotOffset) ASN_DEEP_DIFFER("pivotOffset")
+	if (pA->pivotAngle != pB->pivotAngle) ASN_DEEP_DIFFER("pivotAngle")
+	if (pA->pivots != pB->pivots) ASN_DEEP_DIFFER("pivots")
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_RTCMPackage(const void *pv)
+{
+	const RTCMPackage *pValue = (const RTCMPackage *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_RTCMPackage(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	RTCMPackage *pDst = (RTCMPackage *)pvDst;
+	const RTCMPackage *pSrc = (const RTCMPackage *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_RTCMPackage(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	RTCMPackage *pValue = (RTCMPackage *)pv;
+
+	if (pValue->m.rtcmHeaderPresent)
+	{
+		sReloc_RTCMheader(pReloc, &pValue->rtcmHeader);
+	}
+	sReloc_RTCMmessageList(pReloc, &pValue->msgs);
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_RTCMPackage(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const RTCMPackage *pA = (const RTCMPackage *)pvA;
+	const RTCMPackage *pB = (const RTCMPackage *)pvB;
+	int ret = 0;
+
+	if (pA->m.rtcmHeaderPresent != pB->m.rtcmHeaderPresent) ASN_DEEP_DIFFER("rtcmHeader")
+	else if (pA->m.rtcmHeaderPresent)
+	{
+		ASN_DEEP_INTO("rtcmHeader", sCmp_RTCMheader(pDiff, &pA->rtcmHeader, &pB->rtcmHeader))
+	}
+	ASN_DEEP_INTO("msgs", sCmp_RTCMmessageList(pDiff, &pA->msgs, &pB->msgs))
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TrailerHistoryPoint(const void *pv)
+{
+	const TrailerHistoryPoint *pValue = (const TrailerHistoryPoint *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TrailerHistoryPoint(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TrailerHistoryPoint *pDst = (TrailerHistoryPoint *)pvDst;
+	const TrailerHistoryPoint *pSrc = (const TrailerHistoryPoint *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TrailerHistoryPoint(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TrailerHistoryPoint *pValue = (TrailerHistoryPoint *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TrailerHistoryPoint(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TrailerHistoryPoint *pA = (const TrailerHistoryPoint *)pvA;
+	const TrailerHistoryPoint *pB = (const TrailerHistoryPoint *)pvB;
+	int ret = 0;
+
+	if (pA->pivotAngle != pB->pivotAngle) ASN_DEEP_DIFFER("pivotAngle")
+	if (pA->timeOffset != pB->timeOffset) ASN_DEEP_DIFFER("timeOffset")
+	ASN_DEEP_INTO("positionOffset", sCmp_Node_XY_24b(pDiff, &pA->positionOffset, &pB->positionOffset))
+	if (pA->m.elevationOffsetPresent != pB->m.elevationOffsetPresent) ASN_DEEP_DIFFER("elevationOffset")
+	else if (pA->m.elevationOffsetPresent)
+	{
+		if (pA->elevationOffset != pB->elevationOffset) ASN_DEEP_DIFFER("elevationOffset")
+	}
+	if (pA->m.headingPresent != pB->m.headingPresent) ASN_DEEP_DIFFER("heading")
+	else if (pA->m.headingPresent)
+	{
+		if (pA->heading != pB->heading) ASN_DEEP_DIFFER("heading")
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TrailerUnitDescription(const void *pv)
+{
+	const TrailerUnitDescription *pValue = (const TrailerUnitDescription *)pv;
+	size_t size = 0;
+
+	size += sSize_PivotPointDescription(&pValue->frontPivot);
+	if (pValue->m.rearPivotPresent)
+	{
+		size += sSize_PivotPointDescription(&pValue->rearPivot);
+	}
+	if (pValue->m.crumbDataPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->crumbData, sizeof(TrailerHistoryPoint), sSize_TrailerHistoryPoint);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TrailerUnitDescription(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TrailerUnitDescription *pDst = (TrailerUnitDescription *)pvDst;
+	const TrailerUnitDescription *pSrc = (const TrailerUnitDescription *)pvSrc;
+
+	sCopy_PivotPointDescription(pArena, &pDst->frontPivot, &pSrc->frontPivot);
+	if (pSrc->m.rearPivotPresent)
+	{
+		sCopy_PivotPointDescription(pArena, &pDst->rearPivot, &pSrc->rearPivot);
+	}
+	else
+	{
+		memset(&pDst->rearPivot, 0x00, sizeof(pDst->rearPivot));
+	}
+	if (pSrc->m.crumbDataPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->crumbData, &pSrc->crumbData, sizeof(TrailerHistoryPoint), sCopy_TrailerHistoryPoint);
+	}
+	else
+	{
+		memset(&pDst->crumbData, 0x00, sizeof(pDst->crumbData));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TrailerUnitDescription(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TrailerUnitDescription *pValue = (TrailerUnitDescription *)pv;
+
+	sReloc_PivotPointDescription(pReloc, &pValue->frontPivot);
+	if (pValue->m.rearPivotPresent)
+	{
+		sReloc_PivotPointDescription(pReloc, &pValue->rearPivot);
+	}
+	if (pValue->m.crumbDataPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->crumbData, sizeof(TrailerHistoryPoint), sReloc_TrailerHistoryPoint);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TrailerUnitDescription(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TrailerUnitDescription *pA = (const TrailerUnitDescription *)pvA;
+	const TrailerUnitDescription *pB = (const TrailerUnitDescription *)pvB;
+	int ret = 0;
+
+	if (pA->isDolly != pB->isDolly) ASN_DEEP_DIFFER("isDolly")
+	if (pA->width != pB->width) ASN_DEEP_DIFFER("width")
+	if (pA->length != pB->length) ASN_DEEP_DIFFER("length")
+	if (pA->m.heightPresent != pB->m.heightPresent) ASN_DEEP_DIFFER("height")
+	else if (pA->m.heightPresent)
+	{
+		if (pA->height != pB->height) ASN_DEEP_DIFFER("height")
+	}
+	if (pA->m.massPresent != pB->m.massPresent) ASN_DEEP_DIFFER("mass")
+	else if (pA->m.massPresent)
+	{
+		if (pA->mass != pB->mass) ASN_DEEP_DIFFER("mass")
+	}
+	if (pA->m.bumperHeightsPresent != pB->m.bumperHeightsPresent) ASN_DEEP_DIFFER("bumperHeights")
+	else if (pA->m.bumperHeightsPresent)
+	{
+		ASN_DEEP_INTO("bumperHeights", sCmp_BumperHeights(pDiff, &pA->bumperHeights, &pB->bumperHeights))
+	}
+	if (pA->m.centerOfGravityPresent != pB->m.centerOfGravityPresent) ASN_DEEP_DIFFER("centerOfGravity")
+	else if (pA->m.centerOfGravityPresent)
+	{
+		if (pA->centerOfGravity != pB->centerOfGravity) ASN_DEEP_DIFFER("centerOfGravity")
+	}
+	ASN_DEEP_INTO("frontPivot", sCmp_PivotPointDescription(pDiff, &pA->frontPivot, &pB->frontPivot))
+	if (pA->m.rearPivotPresent != pB->m.rearPivotPresent) ASN_DEEP_DIFFER("rearPivot")
+	else if (pA->m.rearPivotPresent)
+	{
+		ASN_DEEP_INTO("rearPivot", sCmp_PivotPointDescription(pDiff, &pA->rearPivot, &pB->rearPivot))
+	}
+	if (pA->m.rearWheelOffsetPresent != pB->m.rearWheelOffsetPresent) ASN_DEEP_DIFFER("rearWheelOffset")
+	else if (pA->m.rearWheelOffsetPresent)
+	{
+		if (pA->rearWheelOffset != pB->rearWheelOffset) ASN_DEEP_DIFFER("rearWheelOffset")
+	}
+	ASN_DEEP_INTO("positionOffset", sCmp_Node_XY_24b(pDiff, &pA->positionOffset, &pB->positionOffset))
+	if (pA->m.elevationOffsetPresent != pB->m.elevationOffsetPresent) ASN_DEEP_DIFFER("elevationOffset")
+	else if (pA->m.elevationOffsetPresent)
+	{
+		if (pA->elevationOffset != pB->elevationOffset) ASN_DEEP_DIFFER("elevationOffset")
+	}
+	if (pA->m.crumbDataPresent != pB->m.crumbDataPresent) ASN_DEEP_DIFFER("crumbData")
+	else if (pA->m.crumbDataPresent)
+	{
+		ASN_DEEP_INTO("crumbData", AsnDeep_CmpList(pDiff, &pA->crumbData, &pB->crumbData, sizeof(TrailerHistoryPoint), sCmp_TrailerHistoryPoint))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_TrailerData(const void *pv)
+{
+	const TrailerData *pValue = (const TrailerData *)pv;
+	size_t size = 0;
+
+	size += sSize_PivotPointDescription(&pValue->connection);
+	size += AsnDeep_SizeList(&pValue->units, sizeof(TrailerUnitDescription), sSize_TrailerUnitDescription);
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_TrailerData(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	TrailerData *pDst = (TrailerData *)pvDst;
+	const TrailerData *pSrc = (const TrailerData *)pvSrc;
+
+	sCopy_PivotPointDescription(pArena, &pDst->connection, &pSrc->connection);
+	AsnDeep_CopyList(pArena, &pDst->units, &pSrc->units, sizeof(TrailerUnitDescription), sCopy_TrailerUnitDescription);
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_TrailerData(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	TrailerData *pValue = (TrailerData *)pv;
+
+	sReloc_PivotPointDescription(pReloc, &pValue->connection);
+	AsnDeep_RelocList(pReloc, &pValue->units, sizeof(TrailerUnitDescription), sReloc_TrailerUnitDescription);
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_TrailerData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const TrailerData *pA = (const TrailerData *)pvA;
+	const TrailerData *pB = (const TrailerData *)pvB;
+	int ret = 0;
+
+	if (pA->sspRights != pB->sspRights) ASN_DEEP_DIFFER("sspRights")
+	ASN_DEEP_INTO("connection", sCmp_PivotPointDescription(pDiff, &pA->connection, &pB->connection))
+	ASN_DEEP_INTO("units", AsnDeep_CmpList(pDiff, &pA->units, &pB->units, sizeof(TrailerUnitDescription), sCmp_TrailerUnitDescription))
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_SpecialVehicleExtensions(const void *pv)
+{
+	const SpecialVehicleExtensions *pValue = (const SpecialVehicleExtensions *)pv;
+	size_t size = 0;
+
+	if (pValue->m.vehicleAlertsPresent)
+	{
+		size += sSize_EmergencyDetails(&pValue->vehicleAlerts);
+	}
+	if (pValue->m.descriptionPresent)
+	{
+		size += sSize_EventDescription(&pValue->description);
+	}
+	if (pValue->m.trailersPresent)
+	{
+		size += sSize_TrailerData(&pValue->trailers);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_SpecialVehicleExtensions(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	SpecialVehicleExtensions *pDst = (SpecialVehicleExtensions *)pvDst;
+	const SpecialVehicleExtensions *pSrc = (const SpecialVehicleExtensions *)pvSrc;
+
+	if (pSrc->m.vehicleAlertsPresent)
+	{
+		sCopy_EmergencyDetails(pArena, &pDst->vehicleAlerts, &pSrc->vehicleAlerts);
+	}
+	else
+	{
+		memset(&pDst->vehicleAlerts, 0x00, sizeof(pDst->vehicleAlerts));
+	}
+	if (pSrc->m.descriptionPresent)
+	{
+		sCopy_EventDescription(pArena, &pDst->description, &pSrc->description);
+	}
+	else
+	{
+		memset(&pDst->description, 0x00, sizeof(pDst->description));
+	}
+	if (pSrc->m.trailersPresent)
+	{
+		sCopy_TrailerData(pArena, &pDst->trailers, &pSrc->trailers);
+	}
+	else
+	{
+		memset(&pDst->trailers, 0x00, sizeof(pDst->trailers));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_SpecialVehicleExtensions(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SpecialVehicleExtensions *pValue = (SpecialVehicleExtensions *)pv;
+
+	if (pValue->m.vehicleAlertsPresent)
+	{
+		sReloc_EmergencyDetails(pReloc, &pValue->vehicleAlerts);
+	}
+	if (pValue->m.descriptionPresent)
+	{
+		sReloc_EventDescription(pReloc, &pValue->description);
+	}
+	if (pValue->m.trailersPresent)
+	{
+		sReloc_TrailerData(pReloc, &pValue->trailers);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_SpecialVehicleExtensions(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SpecialVehicleExtensions *pA = (const SpecialVehicleExtensions *)pvA;
+	const SpecialVehicleExtensions *pB = (const SpecialVehicleExtensions *)pvB;
+	int ret = 0;
+
+	if (pA->m.vehicleAlertsPresent != pB->m.vehicleAlertsPresent) ASN_DEEP_DIFFER("vehicleAlerts")
+	else if (pA->m.vehicleAlertsPresent)
+	{
+		ASN_DEEP_INTO("vehicleAlerts", sCmp_EmergencyDetails(pDiff, &pA->vehicleAlerts, &pB->vehicleAlerts))
+	}
+	if (pA->m.descriptionPresent != pB->m.descriptionPresent) ASN_DEEP_DIFFER("description")
+	else if (pA->m.descriptionPresent)
+	{
+		ASN_DEEP_INTO("description", sCmp_EventDescription(pDiff, &pA->description, &pB->description))
+	}
+	if (pA->m.trailersPresent != pB->m.trailersPresent) ASN_DEEP_DIFFER("trailers")
+	else if (pA->m.trailersPresent)
+	{
+		ASN_DEEP_INTO("trailers", sCmp_TrailerData(pDiff, &pA->trailers, &pB->trailers))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static void sReloc_SpeedProfileMeasurementList(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SpeedProfileMeasurementList *pValue = (SpeedProfileMeasurementList *)pv;
+
+	AsnDeep_RelocArray(pReloc, pValue->elem, pValue->n, sizeof(pValue->elem) / sizeof(pValue->elem[0]), sizeof(pValue->elem[0]), HAE_NULL);
+}
+
+static int sCmp_SpeedProfileMeasurementList(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SpeedProfileMeasurementList *pA = (const SpeedProfileMeasurementList *)pvA;
+	const SpeedProfileMeasurementList *pB = (const SpeedProfileMeasurementList *)pvB;
+
+	return AsnDeep_CmpArray(pDiff, pA->elem, pA->n, pB->elem, pB->n, sizeof(pA->elem) / sizeof(pA->elem[0]), sizeof(pA->elem[0]), HAE_NULL);
+}
+
+static size_t sSize_SpeedProfile(const void *pv)
+{
+	const SpeedProfile *pValue = (const SpeedProfile *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_SpeedProfile(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	SpeedProfile *pDst = (SpeedProfile *)pvDst;
+	const SpeedProfile *pSrc = (const SpeedProfile *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_SpeedProfile(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SpeedProfile *pValue = (SpeedProfile *)pv;
+
+	sReloc_SpeedProfileMeasurementList(pReloc, &pValue->speedReports);
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_SpeedProfile(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SpeedProfile *pA = (const SpeedProfile *)pvA;
+	const SpeedProfile *pB = (const SpeedProfile *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("speedReports", sCmp_SpeedProfileMeasurementList(pDiff, &pA->speedReports, &pB->speedReports))
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_VehicleData(const void *pv)
+{
+	const VehicleData *pValue = (const VehicleData *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_VehicleData(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	VehicleData *pDst = (VehicleData *)pvDst;
+	const VehicleData *pSrc = (const VehicleData *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_VehicleData(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	VehicleData *pValue = (VehicleData *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_VehicleData(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VehicleData *pA = (const VehicleData *)pvA;
+	const VehicleData *pB = (const VehicleData *)pvB;
+	int ret = 0;
+
+	if (pA->m.heightPresent != pB->m.heightPresent) ASN_DEEP_DIFFER("height")
+	else if (pA->m.heightPresent)
+	{
+		if (pA->height != pB->height) ASN_DEEP_DIFFER("height")
+	}
+	if (pA->m.bumpersPresent != pB->m.bumpersPresent) ASN_DEEP_DIFFER("bumpers")
+	else if (pA->m.bumpersPresent)
+	{
+		ASN_DEEP_INTO("bumpers", sCmp_BumperHeights(pDiff, &pA->bumpers, &pB->bumpers))
+	}
+	if (pA->m.massPresent != pB->m.massPresent) ASN_DEEP_DIFFER("mass")
+	else if (pA->m.massPresent)
+	{
+		if (pA->mass != pB->mass) ASN_DEEP_DIFFER("mass")
+	}
+	if (pA->m.trailerWeightPresent != pB->m.trailerWeightPresent) ASN_DEEP_DIFFER("trailerWeight")
+	else if (pA->m.trailerWeightPresent)
+	{
+		if (pA->trailerWeight != pB->trailerWeight) ASN_DEEP_DIFFER("trailerWeight")
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_WeatherReport(const void *pv)
+{
+	const WeatherReport *pValue = (const WeatherReport *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_WeatherReport(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	WeatherReport *pDst = (WeatherReport *)pvDst;
+	const WeatherReport *pSrc = (const WeatherReport *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_WeatherReport(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	WeatherReport *pValue = (WeatherReport *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_WeatherReport(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const WeatherReport *pA = (const WeatherReport *)pvA;
+	const WeatherReport *pB = (const WeatherReport *)pvB;
+	int ret = 0;
+
+	if (pA->isRaining != pB->isRaining) ASN_DEEP_DIFFER("isRaining")
+	if (pA->m.rainRatePresent != pB->m.rainRatePresent) ASN_DEEP_DIFFER("rainRate")
+	else if (pA->m.rainRatePresent)
+	{
+		if (pA->rainRate != pB->rainRate) ASN_DEEP_DIFFER("rainRate")
+	}
+	if (pA->m.precipSituationPresent != pB->m.precipSituationPresent) ASN_DEEP_DIFFER("precipSituation")
+	else if (pA->m.precipSituationPresent)
+	{
+		if (pA->precipSituation != pB->precipSituation) ASN_DEEP_DIFFER("precipSituation")
+	}
+	if (pA->m.solarRadiationPresent != pB->m.solarRadiationPresent) ASN_DEEP_DIFFER("solarRadiation")
+	else if (pA->m.solarRadiationPresent)
+	{
+		if (pA->solarRadiation != pB->solarRadiation) ASN_DEEP_DIFFER("solarRadiation")
+	}
+	if (pA->m.frictionPresent != pB->m.frictionPresent) ASN_DEEP_DIFFER("friction")
+	else if (pA->m.frictionPresent)
+	{
+		if (pA->friction != pB->friction) ASN_DEEP_DIFFER("friction")
+	}
+	if (pA->m.roadFrictionPresent != pB->m.roadFrictionPresent) ASN_DEEP_DIFFER("roadFriction")
+	else if (pA->m.roadFrictionPresent)
+	{
+		if (pA->roadFriction != pB->roadFriction) ASN_DEEP_DIFFER("roadFriction")
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_WeatherProbe(const void *pv)
+{
+	const WeatherProbe *pValue = (const WeatherProbe *)pv;
+	size_t size = 0;
+
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_WeatherProbe(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	WeatherProbe *pDst = (WeatherProbe *)pvDst;
+	const WeatherProbe *pSrc = (const WeatherProbe *)pvSrc;
+
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_WeatherProbe(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	WeatherProbe *pValue = (WeatherProbe *)pv;
+
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_WeatherProbe(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const WeatherProbe *pA = (const WeatherProbe *)pvA;
+	const WeatherProbe *pB = (const WeatherProbe *)pvB;
+	int ret = 0;
+
+	if (pA->m.airTempPresent != pB->m.airTempPresent) ASN_DEEP_DIFFER("airTemp")
+	else if (pA->m.airTempPresent)
+	{
+		if (pA->airTemp != pB->airTemp) ASN_DEEP_DIFFER("airTemp")
+	}
+	if (pA->m.airPressurePresent != pB->m.airPressurePresent) ASN_DEEP_DIFFER("airPressure")
+	else if (pA->m.airPressurePresent)
+	{
+		if (pA->airPressure != pB->airPressure) ASN_DEEP_DIFFER("airPressure")
+	}
+	if (pA->m.rainRatesPresent != pB->m.rainRatesPresent) ASN_DEEP_DIFFER("rainRates")
+	else if (pA->m.rainRatesPresent)
+	{
+		ASN_DEEP_INTO("rainRates", sCmp_WiperSet(pDiff, &pA->rainRates, &pB->rainRates))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_SupplementalVehicleExtensions(const void *pv)
+{
+	const SupplementalVehicleExtensions *pValue = (const SupplementalVehicleExtensions *)pv;
+	size_t size = 0;
+
+	if (pValue->m.classDetailsPresent)
+	{
+		size += sSize_VehicleClassification(&pValue->classDetails);
+	}
+	if (pValue->m.vehicleDataPresent)
+	{
+		size += sSize_VehicleData(&pValue->vehicleData);
+	}
+	if (pValue->m.weatherReportPresent)
+	{
+		size += sSize_WeatherReport(&pValue->weatherReport);
+	}
+	if (pValue->m.weatherProbePresent)
+	{
+		size += sSize_WeatherProbe(&pValue->weatherProbe);
+	}
+	if (pValue->m.obstaclePresent)
+	{
+		size += sSize_ObstacleDetection(&pValue->obstacle);
+	}
+	if (pValue->m.statusPresent)
+	{
+		size += sSize_DisabledVehicle(&pValue->status);
+	}
+	if (pValue->m.speedProfilePresent)
+	{
+		size += sSize_SpeedProfile(&pValue->speedProfile);
+	}
+	if (pValue->m.theRTCMPresent)
+	{
+		size += sSize_RTCMPackage(&pValue->theRTCM);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		size += AsnDeep_SizeList(&pValue->regional, sizeof(RegionalExtension), sSize_RegionalExtension);
+	}
+	size += AsnDeep_SizeList(&pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_SizeOpen);
+	return size;
+}
+
+static void sCopy_SupplementalVehicleExtensions(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	SupplementalVehicleExtensions *pDst = (SupplementalVehicleExtensions *)pvDst;
+	const SupplementalVehicleExtensions *pSrc = (const SupplementalVehicleExtensions *)pvSrc;
+
+	if (pSrc->m.classDetailsPresent)
+	{
+		sCopy_VehicleClassification(pArena, &pDst->classDetails, &pSrc->classDetails);
+	}
+	else
+	{
+		memset(&pDst->classDetails, 0x00, sizeof(pDst->classDetails));
+	}
+	if (pSrc->m.vehicleDataPresent)
+	{
+		sCopy_VehicleData(pArena, &pDst->vehicleData, &pSrc->vehicleData);
+	}
+	else
+	{
+		memset(&pDst->vehicleData, 0x00, sizeof(pDst->vehicleData));
+	}
+	if (pSrc->m.weatherReportPresent)
+	{
+		sCopy_WeatherReport(pArena, &pDst->weatherReport, &pSrc->weatherReport);
+	}
+	else
+	{
+		memset(&pDst->weatherReport, 0x00, sizeof(pDst->weatherReport));
+	}
+	if (pSrc->m.weatherProbePresent)
+	{
+		sCopy_WeatherProbe(pArena, &pDst->weatherProbe, &pSrc->weatherProbe);
+	}
+	else
+	{
+		memset(&pDst->weatherProbe, 0x00, sizeof(pDst->weatherProbe));
+	}
+	if (pSrc->m.obstaclePresent)
+	{
+		sCopy_ObstacleDetection(pArena, &pDst->obstacle, &pSrc->obstacle);
+	}
+	else
+	{
+		memset(&pDst->obstacle, 0x00, sizeof(pDst->obstacle));
+	}
+	if (pSrc->m.statusPresent)
+	{
+		sCopy_DisabledVehicle(pArena, &pDst->status, &pSrc->status);
+	}
+	else
+	{
+		memset(&pDst->status, 0x00, sizeof(pDst->status));
+	}
+	if (pSrc->m.speedProfilePresent)
+	{
+		sCopy_SpeedProfile(pArena, &pDst->speedProfile, &pSrc->speedProfile);
+	}
+	else
+	{
+		memset(&pDst->speedProfile, 0x00, sizeof(pDst->speedProfile));
+	}
+	if (pSrc->m.theRTCMPresent)
+	{
+		sCopy_RTCMPackage(pArena, &pDst->theRTCM, &pSrc->theRTCM);
+	}
+	else
+	{
+		memset(&pDst->theRTCM, 0x00, sizeof(pDst->theRTCM));
+	}
+	if (pSrc->m.regionalPresent)
+	{
+		AsnDeep_CopyList(pArena, &pDst->regional, &pSrc->regional, sizeof(RegionalExtension), sCopy_RegionalExtension);
+	}
+	else
+	{
+		memset(&pDst->regional, 0x00, sizeof(pDst->regional));
+	}
+	AsnDeep_CopyList(pArena, &pDst->extElem1, &pSrc->extElem1, sizeof(ASN1OpenType), AsnDeep_CopyOpen);
+}
+
+static void sReloc_SupplementalVehicleExtensions(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	SupplementalVehicleExtensions *pValue = (SupplementalVehicleExtensions *)pv;
+
+	if (pValue->m.classDetailsPresent)
+	{
+		sReloc_VehicleClassification(pReloc, &pValue->classDetails);
+	}
+	if (pValue->m.vehicleDataPresent)
+	{
+		sReloc_VehicleData(pReloc, &pValue->vehicleData);
+	}
+	if (pValue->m.weatherReportPresent)
+	{
+		sReloc_WeatherReport(pReloc, &pValue->weatherReport);
+	}
+	if (pValue->m.weatherProbePresent)
+	{
+		sReloc_WeatherProbe(pReloc, &pValue->weatherProbe);
+	}
+	if (pValue->m.obstaclePresent)
+	{
+		sReloc_ObstacleDetection(pReloc, &pValue->obstacle);
+	}
+	if (pValue->m.statusPresent)
+	{
+		sReloc_DisabledVehicle(pReloc, &pValue->status);
+	}
+	if (pValue->m.speedProfilePresent)
+	{
+		sReloc_SpeedProfile(pReloc, &pValue->speedProfile);
+	}
+	if (pValue->m.theRTCMPresent)
+	{
+		sReloc_RTCMPackage(pReloc, &pValue->theRTCM);
+	}
+	if (pValue->m.regionalPresent)
+	{
+		AsnDeep_RelocList(pReloc, &pValue->regional, sizeof(RegionalExtension), sReloc_RegionalExtension);
+	}
+	AsnDeep_RelocList(pReloc, &pValue->extElem1, sizeof(ASN1OpenType), AsnDeep_RelocOpen);
+}
+
+static int sCmp_SupplementalVehicleExtensions(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const SupplementalVehicleExtensions *pA = (const SupplementalVehicleExtensions *)pvA;
+	const SupplementalVehicleExtensions *pB = (const SupplementalVehicleExtensions *)pvB;
+	int ret = 0;
+
+	if (pA->m.classificationPresent != pB->m.classificationPresent) ASN_DEEP_DIFFER("classification")
+	else if (pA->m.classificationPresent)
+	{
+		if (pA->classification != pB->classification) ASN_DEEP_DIFFER("classification")
+	}
+	if (pA->m.classDetailsPresent != pB->m.classDetailsPresent) ASN_DEEP_DIFFER("classDetails")
+	else if (pA->m.classDetailsPresent)
+	{
+		ASN_DEEP_INTO("classDetails", sCmp_VehicleClassification(pDiff, &pA->classDetails, &pB->classDetails))
+	}
+	if (pA->m.vehicleDataPresent != pB->m.vehicleDataPresent) ASN_DEEP_DIFFER("vehicleData")
+	else if (pA->m.vehicleDataPresent)
+	{
+		ASN_DEEP_INTO("vehicleData", sCmp_VehicleData(pDiff, &pA->vehicleData, &pB->vehicleData))
+	}
+	if (pA->m.weatherReportPresent != pB->m.weatherReportPresent) ASN_DEEP_DIFFER("weatherReport")
+	else if (pA->m.weatherReportPresent)
+	{
+		ASN_DEEP_INTO("weatherReport", sCmp_WeatherReport(pDiff, &pA->weatherReport, &pB->weatherReport))
+	}
+	if (pA->m.weatherProbePresent != pB->m.weatherProbePresent) ASN_DEEP_DIFFER("weatherProbe")
+	else if (pA->m.weatherProbePresent)
+	{
+		ASN_DEEP_INTO("weatherProbe", sCmp_WeatherProbe(pDiff, &pA->weatherProbe, &pB->weatherProbe))
+	}
+	if (pA->m.obstaclePresent != pB->m.obstaclePresent) ASN_DEEP_DIFFER("obstacle")
+	else if (pA->m.obstaclePresent)
+	{
+		ASN_DEEP_INTO("obstacle", sCmp_ObstacleDetection(pDiff, &pA->obstacle, &pB->obstacle))
+	}
+	if (pA->m.statusPresent != pB->m.statusPresent) ASN_DEEP_DIFFER("status")
+	else if (pA->m.statusPresent)
+	{
+		ASN_DEEP_INTO("status", sCmp_DisabledVehicle(pDiff, &pA->status, &pB->status))
+	}
+	if (pA->m.speedProfilePresent != pB->m.speedProfilePresent) ASN_DEEP_DIFFER("speedProfile")
+	else if (pA->m.speedProfilePresent)
+	{
+		ASN_DEEP_INTO("speedProfile", sCmp_SpeedProfile(pDiff, &pA->speedProfile, &pB->speedProfile))
+	}
+	if (pA->m.theRTCMPresent != pB->m.theRTCMPresent) ASN_DEEP_DIFFER("theRTCM")
+	else if (pA->m.theRTCMPresent)
+	{
+		ASN_DEEP_INTO("theRTCM", sCmp_RTCMPackage(pDiff, &pA->theRTCM, &pB->theRTCM))
+	}
+	if (pA->m.regionalPresent != pB->m.regionalPresent) ASN_DEEP_DIFFER("regional")
+	else if (pA->m.regionalPresent)
+	{
+		ASN_DEEP_INTO("regional", AsnDeep_CmpList(pDiff, &pA->regional, &pB->regional, sizeof(RegionalExtension), sCmp_RegionalExtension))
+	}
+	ASN_DEEP_INTO("extElem1", AsnDeep_CmpList(pDiff, &pA->extElem1, &pB->extElem1, sizeof(ASN1OpenType), AsnDeep_CmpOpen))
+	return ret;
+}
+
+static size_t sSize_VerticalOffset(const void *pv)
+{
+	const VerticalOffset *pValue = (const VerticalOffset *)pv;
+	size_t size = 0;
+
+	switch (pValue->t)
+	{
+		case 8:
+			size += AsnDeep_SizePtr(pValue->u.regional, sizeof(*pValue->u.regional), sSize_RegionalExtension);
+			break;
+	}
+	return size;
+}
+
+static void sCopy_VerticalOffset(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)
+{
+	VerticalOffset *pDst = (VerticalOffset *)pvDst;
+	const VerticalOffset *pSrc = (const VerticalOffset *)pvSrc;
+
+	switch (pSrc->t)
+	{
+		case 8:
+			pDst->u.regional = AsnDeep_CopyPtr(pArena, pSrc->u.regional, sizeof(*pSrc->u.regional), sCopy_RegionalExtension);
+			break;
+		case 1:
+		case 2:
+		case 3:
+		case 4:
+		case 5:
+		case 6:
+		case 7:
+			break;
+		default:
+			memset(&pDst->u, 0x00, sizeof(pDst->u));
+			break;
+	}
+}
+
+static void sReloc_VerticalOffset(ASN_DEEP_RELOC *pReloc, void *pv)
+{
+	VerticalOffset *pValue = (VerticalOffset *)pv;
+
+	switch (pValue->t)
+	{
+		case 8:
+			AsnDeep_RelocObj(pReloc, &pValue->u.regional, sizeof(*pValue->u.regional), sReloc_RegionalExtension);
+			break;
+		case 1:
+		case 2:
+		case 3:
+		case 4:
+		case 5:
+		case 6:
+		case 7:
+			break;
+		default:
+			AsnDeep_RelocInvalid(pReloc);
+			break;
+	}
+}
+
+static int sCmp_VerticalOffset(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const VerticalOffset *pA = (const VerticalOffset *)pvA;
+	const VerticalOffset *pB = (const VerticalOffset *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			if (pA->u.offset1 != pB->u.offset1) ASN_DEEP_DIFFER("offset1")
+			break;
+		case 2:
+			if (pA->u.offset2 != pB->u.offset2) ASN_DEEP_DIFFER("offset2")
+			break;
+		case 3:
+			if (pA->u.offset3 != pB->u.offset3) ASN_DEEP_DIFFER("offset3")
+			break;
+		case 4:
+			if (pA->u.offset4 != pB->u.offset4) ASN_DEEP_DIFFER("offset4")
+			break;
+		case 5:
+			if (pA->u.offset5 != pB->u.offset5) ASN_DEEP_DIFFER("offset5")
+			break;
+		case 6:
+			if (pA->u.offset6 != pB->u.offset6) ASN_DEEP_DIFFER("offset6")
+			break;
+		case 7:
+			if (pA->u.elevation != pB->u.elevation) ASN_DEEP_DIFFER("elevation")
+			break;
+		case 8:
+			ASN_DEEP_INTO("regional", AsnDeep_CmpPtr(pDiff, pA->u.regional, pB->u.regional, sizeof(*pA->u.regional), sCmp_RegionalExtension))
+			break;
+	}
+	return ret;
+}
+
+static int sCmp_ITIScodesAndText_element_item(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ITIScodesAndText_element_item *pA = (const ITIScodesAndText_element_item *)pvA;
+	const ITIScodesAndText_element_item *pB = (const ITIScodesAndText_element_item *)pvB;
+	int ret = 0;
+
+	if (pA->t != pB->t)
+	{
+		ASN_DEEP_DIFFER("t")
+		return ret;
+	}
+	switch (pA->t)
+	{
+		case 1:
+			if (pA->u.itis != pB->u.itis) ASN_DEEP_DIFFER("itis")
+			break;
+		case 2:
+			if (pA->u.text != pB->u.text) ASN_DEEP_DIFFER("text")
+			break;
+	}
+	return ret;
+}
+
+static int sCmp_ITIScodesAndText_element(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)
+{
+	const ITIScodesAndText_element *pA = (const ITIScodesAndText_element *)pvA;
+	const ITIScodesAndText_element *pB = (const ITIScodesAndText_element *)pvB;
+	int ret = 0;
+
+	ASN_DEEP_INTO("item", sCmp_ITIScodesAndText_element_item(pDiff, &pA->item, &pB->item))
+	return ret;
+}
+
+const ASN_DEEP_TYPE asn_deep_table[] =
+{
+	{ "AccelSteerYawRateConfidence", sizeof(AccelSteerYawRateConfidence), HAE_NULL, HAE_NULL, sCmp_AccelSteerYawRateConfidence, HAE_NULL },
+	{ "AccelerationSet4Way", sizeof(AccelerationSet4Way), HAE_NULL, HAE_NULL, sCmp_AccelerationSet4Way, HAE_NULL },
+	{ "AdvisorySpeed", sizeof(AdvisorySpeed), sSize_AdvisorySpeed, sCopy_AdvisorySpeed, sCmp_AdvisorySpeed, sReloc_AdvisorySpeed },
+	{ "AllowedManeuvers", sizeof(AllowedManeuvers), HAE_NULL, HAE_NULL, sCmp_AllowedManeuvers, sReloc_AllowedManeuvers },
+	{ "AntennaOffsetSet", sizeof(AntennaOffsetSet), HAE_NULL, HAE_NULL, sCmp_AntennaOffsetSet, HAE_NULL },
+	{ "ApproachOrLane", sizeof(ApproachOrLane), HAE_NULL, HAE_NULL, sCmp_ApproachOrLane, HAE_NULL },
+	{ "AxleWeightSet", sizeof(AxleWeightSet), sSize_AxleWeightSet, sCopy_AxleWeightSet, sCmp_AxleWeightSet, sReloc_AxleWeightSet },
+	{ "BSMcoreData", sizeof(BSMcoreData), HAE_NULL, HAE_NULL, sCmp_BSMcoreData, sReloc_BSMcoreData },
+	{ "BasicSafetyMessage", sizeof(BasicSafetyMessage), sSize_BasicSafetyMessage, sCopy_BasicSafetyMessage, sCmp_BasicSafetyMessage, sReloc_BasicSafetyMessage },
+	{ "BrakeAppliedStatus", sizeof(BrakeAppliedStatus), HAE_NULL, HAE_NULL, sCmp_BrakeAppliedStatus, sReloc_BrakeAppliedStatus },
+	{ "BrakeSystemStatus", sizeof(BrakeSystemStatus), HAE_NULL, HAE_NULL, sCmp_BrakeSystemStatus, sReloc_BrakeSystemStatus },
+	{ "BumperHeights", sizeof(BumperHeights), HAE_NULL, HAE_NULL, sCmp_BumperHeights, HAE_NULL },
+	{ "Circle", sizeof(Circle), sSize_Circle, sCopy_Circle, sCmp_Circle, sReloc_Circle },
+	{ "CodeWord", sizeof(CodeWord), HAE_NULL, HAE_NULL, sCmp_CodeWord, sReloc_CodeWord },
+	{ "CommonSafetyRequest", sizeof(CommonSafetyRequest), sSize_CommonSafetyRequest, sCopy_CommonSafetyRequest, sCmp_CommonSafetyRequest, sReloc_CommonSafetyRequest },
+	{ "ComputedLane", sizeof(ComputedLane), sSize_ComputedLane, sCopy_ComputedLane, sCmp_ComputedLane, sReloc_ComputedLane },
+	{ "ComputedLane_offsetXaxis", sizeof(ComputedLane_offsetXaxis), HAE_NULL, HAE_NULL, sCmp_ComputedLane_offsetXaxis, HAE_NULL },
+	{ "ComputedLane_offsetYaxis", sizeof(ComputedLane_offsetYaxis), HAE_NULL, HAE_NULL, sCmp_ComputedLane_offsetYaxis, HAE_NULL },
+	{ "ConfidenceSet", sizeof(ConfidenceSet), sSize_ConfidenceSet, sCopy_ConfidenceSet, sCmp_ConfidenceSet, sReloc_ConfidenceSet },
+	{ "ConnectingLane", sizeof(ConnectingLane), HAE_NULL, HAE_NULL, sCmp_ConnectingLane, sReloc_ConnectingLane },
+	{ "Connection", sizeof(Connection), HAE_NULL, HAE_NULL, sCmp_Connection, sReloc_Connection },
+	{ "ConnectionManeuverAssist", sizeof(ConnectionManeuverAssist), sSize_ConnectionManeuverAssist, sCopy_ConnectionManeuverAssist, sCmp_ConnectionManeuverAssist, sReloc_ConnectionManeuverAssist },
+	{ "DDate", sizeof(DDate), HAE_NULL, HAE_NULL, sCmp_DDate, HAE_NULL },
+	{ "DDateTime", sizeof(DDateTime), HAE_NULL, HAE_NULL, sCmp_DDateTime, HAE_NULL },
+	{ "DFullTime", sizeof(DFullTime), HAE_NULL, HAE_NULL, sCmp_DFullTime, HAE_NULL },
+	{ "DMonthDay", sizeof(DMonthDay), HAE_NULL, HAE_NULL, sCmp_DMonthDay, HAE_NULL },
+	{ "DTime", sizeof(DTime), HAE_NULL, HAE_NULL, sCmp_DTime, HAE_NULL },
+	{ "DYearMonth", sizeof(DYearMonth), HAE_NULL, HAE_NULL, sCmp_DYearMonth, HAE_NULL },
+	{ "DataParameters", sizeof(DataParameters), sSize_DataParameters, sCopy_DataParameters, sCmp_DataParameters, sReloc_DataParameters },
+	{ "DisabledVehicle", sizeof(DisabledVehicle), sSize_DisabledVehicle, sCopy_DisabledVehicle, sCmp_DisabledVehicle, sReloc_DisabledVehicle },
+	{ "EmergencyDetails", sizeof(EmergencyDetails), sSize_EmergencyDetails, sCopy_EmergencyDetails, sCmp_EmergencyDetails, sReloc_EmergencyDetails },
+	{ "EmergencyVehicleAlert", sizeof(EmergencyVehicleAlert), sSize_EmergencyVehicleAlert, sCopy_EmergencyVehicleAlert, sCmp_EmergencyVehicleAlert, sReloc_EmergencyVehicleAlert },
+	{ "EnabledLaneList", sizeof(EnabledLaneList), HAE_NULL, HAE_NULL, sCmp_EnabledLaneList, sReloc_EnabledLaneList },
+	{ "EventDescription", sizeof(EventDescription), sSize_EventDescription, sCopy_EventDescription, sCmp_EventDescription, sReloc_EventDescription },
+	{ "EventDescription_description", sizeof(EventDescription_description), HAE_NULL, HAE_NULL, sCmp_EventDescription_description, sReloc_EventDescription_description },
+	{ "ExitService_element", sizeof(ExitService_element), sSize_ExitService_element, sCopy_ExitService_element, sCmp_ExitService_element, sReloc_ExitService_element },
+	{ "ExitService_element_item", sizeof(ExitService_element_item), sSize_ExitService_element_item, sCopy_ExitService_element_item, sCmp_ExitService_element_item, sReloc_ExitService_element_item },
+	{ "ExteriorLights", sizeof(ExteriorLights), sSize_ExteriorLights, sCopy_ExteriorLights, sCmp_ExteriorLights, sReloc_ExteriorLights },
+	{ "FullPositionVector", sizeof(FullPositionVector), sSize_FullPositionVector, sCopy_FullPositionVector, sCmp_FullPositionVector, sReloc_FullPositionVector },
+	{ "FurtherInfoID", sizeof(FurtherInfoID), HAE_NULL, HAE_NULL, sCmp_FurtherInfoID, sReloc_FurtherInfoID },
+	{ "GNSSstatus", sizeof(GNSSstatus), HAE_NULL, HAE_NULL, sCmp_GNSSstatus, sReloc_GNSSstatus },
+	{ "GenericLane", sizeof(GenericLane), sSize_GenericLane, sCopy_GenericLane, sCmp_GenericLane, sReloc_GenericLane },
+	{ "GenericSignage_element", sizeof(GenericSignage_element), sSize_GenericSignage_element, sCopy_GenericSignage_element, sCmp_GenericSignage_element, sReloc_GenericSignage_element },
+	{ "GenericSignage_element_item", sizeof(GenericSignage_element_item), sSize_GenericSignage_element_item, sCopy_GenericSignage_element_item, sCmp_GenericSignage_element_item, sReloc_GenericSignage_element_item },
+	{ "GeographicalPath", sizeof(GeographicalPath), sSize_GeographicalPath, sCopy_GeographicalPath, sCmp_GeographicalPath, sReloc_GeographicalPath },
+	{ "GeographicalPath_description", sizeof(GeographicalPath_description), sSize_GeographicalPath_description, sCopy_GeographicalPath_description, sCmp_GeographicalPath_description, sReloc_GeographicalPath_description },
+	{ "GeometricProjection", sizeof(GeometricProjection), sSize_GeometricProjection, sCopy_GeometricProjection, sCmp_GeometricProjection, sReloc_GeometricProjection },
+	{ "Header", sizeof(Header), sSize_Header, sCopy_Header, sCmp_Header, sReloc_Header },
+	{ "HeadingSlice", sizeof(HeadingSlice), HAE_NULL, HAE_NULL, sCmp_HeadingSlice, sReloc_HeadingSlice },
+	{ "ITIScodesAndText_element", sizeof(ITIScodesAndText_element), HAE_NULL, HAE_NULL, sCmp_ITIScodesAndText_element, HAE_NULL },
+	{ "ITIScodesAndText_element_item", sizeof(ITIScodesAndText_element_item), HAE_NULL, HAE_NULL, sCmp_ITIScodesAndText_element_item, HAE_NULL },
+	{ "IntersectionAccessPoint", sizeof(IntersectionAccessPoint), sSize_IntersectionAccessPoint, sCopy_IntersectionAccessPoint, sCmp_IntersectionAccessPoint, sReloc_IntersectionAccessPoint },
+	{ "IntersectionCollision", sizeof(IntersectionCollision), sSize_IntersectionCollision, sCopy_IntersectionCollision, sCmp_IntersectionCollision, sReloc_IntersectionCollision },
+	{ "IntersectionGeometry", sizeof(IntersectionGeometry), sSize_IntersectionGeometry, sCopy_IntersectionGeometry, sCmp_IntersectionGeometry, sReloc_IntersectionGeometry },
+	{ "IntersectionReferenceID", sizeof(IntersectionReferenceID), HAE_NULL, HAE_NULL, sCmp_IntersectionReferenceID, HAE_NULL },
+	{ "IntersectionState", sizeof(IntersectionState), sSize_IntersectionState, sCopy_IntersectionState, sCmp_IntersectionState, sReloc_IntersectionState },
+	{ "IntersectionStatusObject", sizeof(IntersectionStatusObject), HAE_NULL, HAE_NULL, sCmp_IntersectionStatusObject, sReloc_IntersectionStatusObject },
+	{ "J1939data", sizeof(J1939data), sSize_J1939data, sCopy_J1939data, sCmp_J1939data, sReloc_J1939data },
+	{ "LaneAttributes", sizeof(LaneAttributes), sSize_LaneAttributes, sCopy_LaneAttributes, sCmp_LaneAttributes, sReloc_LaneAttributes },
+	{ "LaneAttributes_Barrier", sizeof(LaneAttributes_Barrier), HAE_NULL, HAE_NULL, sCmp_LaneAttributes_Barrier, sReloc_LaneAttributes_Barrier },
+	{ "LaneAttributes_Bike", sizeof(LaneAttributes_Bike), HAE_NULL, HAE_NULL, sCmp_LaneAttributes_Bike, sReloc_LaneAttributes_Bike },
+	{ "LaneAttributes_Crosswalk", sizeof(LaneAttributes_Crosswalk), HAE_NULL, HAE_NULL, sCmp_LaneAttributes_Crosswalk, sReloc_LaneAttributes_Crosswalk },
+	{ "LaneAttributes_Parking", sizeof(LaneAttributes_Parking), HAE_NULL, HAE_NULL, sCmp_LaneAttributes_Parking, sReloc_LaneAttributes_Parking },
+	{ "LaneAttributes_Sidewalk", sizeof(LaneAttributes_Sidewalk), HAE_NULL, HAE_NULL, sCmp_LaneAttributes_Sidewalk, sReloc_LaneAttributes_Sidewalk },
+	{ "LaneAttributes_Striping", sizeof(LaneAttributes_Striping), HAE_NULL, HAE_NULL, sCmp_LaneAttributes_Striping, sReloc_LaneAttributes_Striping },
+	{ "LaneAttributes_TrackedVehicle", sizeof(LaneAttributes_TrackedVehicle), HAE_NULL, HAE_NULL, sCmp_LaneAttributes_TrackedVehicle, sReloc_LaneAttributes_TrackedVehicle },
+	{ "LaneAttributes_Vehicle", sizeof(LaneAttributes_Vehicle), sSize_LaneAttributes_Vehicle, sCopy_LaneAttributes_Vehicle, sCmp_LaneAttributes_Vehicle, sReloc_LaneAttributes_Vehicle },
+	{ "LaneDataAttribute", sizeof(LaneDataAttribute), sSize_LaneDataAttribute, sCopy_LaneDataAttribute, sCmp_LaneDataAttribute, sReloc_LaneDataAttribute },
+	{ "LaneDirection", sizeof(LaneDirection), HAE_NULL, HAE_NULL, sCmp_LaneDirection, sReloc_LaneDirection },
+	{ "LaneSharing", sizeof(LaneSharing), HAE_NULL, HAE_NULL, sCmp_LaneSharing, sReloc_LaneSharing },
+	{ "LaneTypeAttributes", sizeof(LaneTypeAttributes), sSize_LaneTypeAttributes, sCopy_LaneTypeAttributes, sCmp_LaneTypeAttributes, sReloc_LaneTypeAttributes },
+	{ "MapData", sizeof(MapData), sSize_MapData, sCopy_MapData, sCmp_MapData, sReloc_MapData },
+	{ "MessageBLOB", sizeof(MessageBLOB), HAE_NULL, HAE_NULL, sCmp_MessageBLOB, sReloc_MessageBLOB },
+	{ "MessageFrame", sizeof(MessageFrame), sSize_MessageFrame, sCopy_MessageFrame, sCmp_MessageFrame, sReloc_MessageFrame },
+	{ "MovementEvent", sizeof(MovementEvent), sSize_MovementEvent, sCopy_MovementEvent, sCmp_MovementEvent, sReloc_MovementEvent },
+	{ "MovementState", sizeof(MovementState), sSize_MovementState, sCopy_MovementState, sCmp_MovementState, sReloc_MovementState },
+	{ "MsgCRC", sizeof(MsgCRC), HAE_NULL, HAE_NULL, sCmp_MsgCRC, sReloc_MsgCRC },
+	{ "NMEA_Payload", sizeof(NMEA_Payload), HAE_NULL, HAE_NULL, sCmp_NMEA_Payload, sReloc_NMEA_Payload },
+	{ "NMEAcorrections", sizeof(NMEAcorrections), sSize_NMEAcorrections, sCopy_NMEAcorrections, sCmp_NMEAcorrections, sReloc_NMEAcorrections },
+	{ "NodeAttributeLLList", sizeof(NodeAttributeLLList), HAE_NULL, HAE_NULL, sCmp_NodeAttributeLLList, sReloc_NodeAttributeLLList },
+	{ "NodeAttributeSetLL", sizeof(NodeAttributeSetLL), sSize_NodeAttributeSetLL, sCopy_NodeAttributeSetLL, sCmp_NodeAttributeSetLL, sReloc_NodeAttributeSetLL },
+	{ "NodeAttributeSetXY", sizeof(NodeAttributeSetXY), sSize_NodeAttributeSetXY, sCopy_NodeAttributeSetXY, sCmp_NodeAttributeSetXY, sReloc_NodeAttributeSetXY },
+	{ "NodeAttributeXYList", sizeof(NodeAttributeXYList), HAE_NULL, HAE_NULL, sCmp_NodeAttributeXYList, sReloc_NodeAttributeXYList },
+	{ "NodeLL", sizeof(NodeLL), sSize_NodeLL, sCopy_NodeLL, sCmp_NodeLL, sReloc_NodeLL },
+	{ "NodeListLL", sizeof(NodeListLL), sSize_NodeListLL, sCopy_NodeListLL, sCmp_NodeListLL, sReloc_NodeListLL },
+	{ "NodeListXY", sizeof(NodeListXY), sSize_NodeListXY, sCopy_NodeListXY, sCmp_NodeListXY, sReloc_NodeListXY },
+	{ "NodeOffsetPointLL", sizeof(NodeOffsetPointLL), sSize_NodeOffsetPointLL, sCopy_NodeOffsetPointLL, sCmp_NodeOffsetPointLL, sReloc_NodeOffsetPointLL },
+	{ "NodeOffsetPointXY", sizeof(NodeOffsetPointXY), sSize_NodeOffsetPointXY, sCopy_NodeOffsetPointXY, sCmp_NodeOffsetPointXY, sReloc_NodeOffsetPointXY },
+	{ "NodeXY", sizeof(NodeXY), sSize_NodeXY, sCopy_NodeXY, sCmp_NodeXY, sReloc_NodeXY },
+	{ "Node_LL_24B", sizeof(Node_LL_24B), HAE_NULL, HAE_NULL, sCmp_Node_LL_24B, HAE_NULL },
+	{ "Node_LL_28B", sizeof(Node_LL_28B), HAE_NULL, HAE_NULL, sCmp_Node_LL_28B, HAE_NULL },
+	{ "Node_LL_32B", sizeof(Node_LL_32B), HAE_NULL, HAE_NULL, sCmp_Node_LL_32B, HAE_NULL },
+	{ "Node_LL_36B", sizeof(Node_LL_36B), HAE_NULL, HAE_NULL, sCmp_Node_LL_36B, HAE_NULL },
+	{ "Node_LL_44B", sizeof(Node_LL_44B), HAE_NULL, HAE_NULL, sCmp_Node_LL_44B, HAE_NULL },
+	{ "Node_LL_48B", sizeof(Node_LL_48B), HAE_NULL, HAE_NULL, sCmp_Node_LL_48B, HAE_NULL },
+	{ "Node_LLmD_64b", sizeof(Node_LLmD_64b), HAE_NULL, HAE_NULL, sCmp_Node_LLmD_64b, HAE_NULL },
+	{ "Node_XY_20b", sizeof(Node_XY_20b), HAE_NULL, HAE_NULL, sCmp_Node_XY_20b, HAE_NULL },
+	{ "Node_XY_22b", sizeof(Node_XY_22b), HAE_NULL, HAE_NULL, sCmp_Node_XY_22b, HAE_NULL },
+	{ "Node_XY_24b", sizeof(Node_XY_24b), HAE_NULL, HAE_NULL, sCmp_Node_XY_24b, HAE_NULL },
+	{ "Node_XY_26b", sizeof(Node_XY_26b), HAE_NULL, HAE_NULL, sCmp_Node_XY_26b, HAE_NULL },
+	{ "Node_XY_28b", sizeof(Node_XY_28b), HAE_NULL, HAE_NULL, sCmp_Node_XY_28b, HAE_NULL },
+	{ "Node_XY_32b", sizeof(Node_XY_32b), HAE_NULL, HAE_NULL, sCmp_Node_XY_32b, HAE_NULL },
+	{ "ObstacleDetection", sizeof(ObstacleDetection), sSize_ObstacleDetection, sCopy_ObstacleDetection, sCmp_ObstacleDetection, sReloc_ObstacleDetection },
+	{ "OffsetSystem", sizeof(OffsetSystem), sSize_OffsetSystem, sCopy_OffsetSystem, sCmp_OffsetSystem, sReloc_OffsetSystem },
+	{ "OffsetSystem_offset", sizeof(OffsetSystem_offset), sSize_OffsetSystem_offset, sCopy_OffsetSystem_offset, sCmp_OffsetSystem_offset, sReloc_OffsetSystem_offset },
+	{ "OverlayLaneList", sizeof(OverlayLaneList), HAE_NULL, HAE_NULL, sCmp_OverlayLaneList, sReloc_OverlayLaneList },
+	{ "PartIIcontent", sizeof(PartIIcontent), sSize_PartIIcontent, sCopy_PartIIcontent, sCmp_PartIIcontent, sReloc_PartIIcontent },
+	{ "PathHistory", sizeof(PathHistory), sSize_PathHistory, sCopy_PathHistory, sCmp_PathHistory, sReloc_PathHistory },
+	{ "PathHistoryPoint", sizeof(PathHistoryPoint), sSize_PathHistoryPoint, sCopy_PathHistoryPoint, sCmp_PathHistoryPoint, sReloc_PathHistoryPoint },
+	{ "PathPrediction", sizeof(PathPrediction), sSize_PathPrediction, sCopy_PathPrediction, sCmp_PathPrediction, sReloc_PathPrediction },
+	{ "PayloadData", sizeof(PayloadData), HAE_NULL, HAE_NULL, sCmp_PayloadData, sReloc_PayloadData },
+	{ "PersonalAssistive", sizeof(PersonalAssistive), sSize_PersonalAssistive, sCopy_PersonalAssistive, sCmp_PersonalAssistive, sReloc_PersonalAssistive },
+	{ "PersonalDeviceUsageState", sizeof(PersonalDeviceUsageState), sSize_PersonalDeviceUsageState, sCopy_PersonalDeviceUsageState, sCmp_PersonalDeviceUsageState, sReloc_PersonalDeviceUsageState },
+	{ "PersonalSafetyMessage", sizeof(PersonalSafetyMessage), sSize_PersonalSafetyMessage, sCopy_PersonalSafetyMessage, sCmp_PersonalSafetyMessage, sReloc_PersonalSafetyMessage },
+	{ "PivotPointDescription", sizeof(PivotPointDescription), sSize_PivotPointDescription, sCopy_PivotPointDescription, sCmp_PivotPointDescription, sReloc_PivotPointDescription },
+	{ "Position3D", sizeof(Position3D), sSize_Position3D, sCopy_Position3D, sCmp_Position3D, sReloc_Position3D },
+	{ "PositionConfidenceSet", sizeof(PositionConfidenceSet), HAE_NULL, HAE_NULL, sCmp_PositionConfidenceSet, HAE_NULL },
+	{ "PositionalAccuracy", sizeof(PositionalAccuracy), HAE_NULL, HAE_NULL, sCmp_PositionalAccuracy, HAE_NULL },
+	{ "Priority", sizeof(Priority), HAE_NULL, HAE_NULL, sCmp_Priority, sReloc_Priority },
+	{ "PrivilegedEventFlags", sizeof(PrivilegedEventFlags), HAE_NULL, HAE_NULL, sCmp_PrivilegedEventFlags, sReloc_PrivilegedEventFlags },
+	{ "PrivilegedEvents", sizeof(PrivilegedEvents), sSize_PrivilegedEvents, sCopy_PrivilegedEvents, sCmp_PrivilegedEvents, sReloc_PrivilegedEvents },
+	{ "ProbeDataManagement", sizeof(ProbeDataManagement), sSize_ProbeDataManagement, sCopy_ProbeDataManagement, sCmp_ProbeDataManagement, sReloc_ProbeDataManagement },
+	{ "ProbeDataManagement_snapshot", sizeof(ProbeDataManagement_snapshot), sSize_ProbeDataManagement_snapshot, sCopy_ProbeDataManagement_snapshot, sCmp_ProbeDataManagement_snapshot, sReloc_ProbeDataManagement_snapshot },
+	{ "ProbeDataManagement_term", sizeof(ProbeDataManagement_term), HAE_NULL, HAE_NULL, sCmp_ProbeDataManagement_term, HAE_NULL },
+	{ "ProbeVehicleData", sizeof(ProbeVehicleData), sSize_ProbeVehicleData, sCopy_ProbeVehicleData, sCmp_ProbeVehicleData, sReloc_ProbeVehicleData },
+	{ "PropelledInformation", sizeof(PropelledInformation), sSize_PropelledInformation, sCopy_PropelledInformation, sCmp_PropelledInformation, sReloc_PropelledInformation },
+	{ "PublicSafetyAndRoadWorkerActivity", sizeof(PublicSafetyAndRoadWorkerActivity), sSize_PublicSafetyAndRoadWorkerActivity, sCopy_PublicSafetyAndRoadWorkerActivity, sCmp_PublicSafetyAndRoadWorkerActivity, sReloc_PublicSafetyAndRoadWorkerActivity },
+	{ "PublicSafetyDirectingTrafficSubType", sizeof(PublicSafetyDirectingTrafficSubType), sSize_PublicSafetyDirectingTrafficSubType, sCopy_PublicSafetyDirectingTrafficSubType, sCmp_PublicSafetyDirectingTrafficSubType, sReloc_PublicSafetyDirectingTrafficSubType },
+	{ "RTCMPackage", sizeof(RTCMPackage), sSize_RTCMPackage, sCopy_RTCMPackage, sCmp_RTCMPackage, sReloc_RTCMPackage },
+	{ "RTCMcorrections", sizeof(RTCMcorrections), sSize_RTCMcorrections, sCopy_RTCMcorrections, sCmp_RTCMcorrections, sReloc_RTCMcorrections },
+	{ "RTCMheader", sizeof(RTCMheader), HAE_NULL, HAE_NULL, sCmp_RTCMheader, sReloc_RTCMheader },
+	{ "RTCMmessage", sizeof(RTCMmessage), HAE_NULL, HAE_NULL, sCmp_RTCMmessage, sReloc_RTCMmessage },
+	{ "RTCMmessageList", sizeof(RTCMmessageList), HAE_NULL, HAE_NULL, sCmp_RTCMmessageList, sReloc_RTCMmessageList },
+	{ "RegionOffsets", sizeof(RegionOffsets), HAE_NULL, HAE_NULL, sCmp_RegionOffsets, HAE_NULL },
+	{ "RegionPointSet", sizeof(RegionPointSet), sSize_RegionPointSet, sCopy_RegionPointSet, sCmp_RegionPointSet, sReloc_RegionPointSet },
+	{ "RegionalExtension", sizeof(RegionalExtension), sSize_RegionalExtension, sCopy_RegionalExtension, sCmp_RegionalExtension, sReloc_RegionalExtension },
+	{ "RegulatorySpeedLimit", sizeof(RegulatorySpeedLimit), HAE_NULL, HAE_NULL, sCmp_RegulatorySpeedLimit, HAE_NULL },
+	{ "RequestedItemList", sizeof(RequestedItemList), HAE_NULL, HAE_NULL, sCmp_RequestedItemList, sReloc_RequestedItemList },
+	{ "RequestorDescription", sizeof(RequestorDescription), sSize_RequestorDescription, sCopy_RequestorDescription, sCmp_RequestorDescription, sReloc_RequestorDescription },
+	{ "RequestorPositionVector", sizeof(RequestorPositionVector), sSize_RequestorPositionVector, sCopy_RequestorPositionVector, sCmp_RequestorPositionVector, sReloc_RequestorPositionVector },
+	{ "RequestorType", sizeof(RequestorType), sSize_RequestorType, sCopy_RequestorType, sCmp_RequestorType, sReloc_RequestorType },
+	{ "RestrictionClassAssignment", sizeof(RestrictionClassAssignment), sSize_RestrictionClassAssignment, sCopy_RestrictionClassAssignment, sCmp_RestrictionClassAssignment, sReloc_RestrictionClassAssignment },
+	{ "RestrictionUserType", sizeof(RestrictionUserType), sSize_RestrictionUserType, sCopy_RestrictionUserType, sCmp_RestrictionUserType, sReloc_RestrictionUserType },
+	{ "RoadSegment", sizeof(RoadSegment), sSize_RoadSegment, sCopy_RoadSegment, sCmp_RoadSegment, sReloc_RoadSegment },
+	{ "RoadSegmentReferenceID", sizeof(RoadSegmentReferenceID), HAE_NULL, HAE_NULL, sCmp_RoadSegmentReferenceID, HAE_NULL },
+	{ "RoadSideAlert", sizeof(RoadSideAlert), sSize_RoadSideAlert, sCopy_RoadSideAlert, sCmp_RoadSideAlert, sReloc_RoadSideAlert },
+	{ "RoadSideAlert_description", sizeof(RoadSideAlert_description), HAE_NULL, HAE_NULL, sCmp_RoadSideAlert_description, sReloc_RoadSideAlert_description },
+	{ "RoadSignID", sizeof(RoadSignID), sSize_RoadSignID, sCopy_RoadSignID, sCmp_RoadSignID, sReloc_RoadSignID },
+	{ "SPAT", sizeof(SPAT), sSize_SPAT, sCopy_SPAT, sCmp_SPAT, sReloc_SPAT },
+	{ "Sample", sizeof(Sample), HAE_NULL, HAE_NULL, sCmp_Sample, HAE_NULL },
+	{ "SegmentAttributeLLList", sizeof(SegmentAttributeLLList), HAE_NULL, HAE_NULL, sCmp_SegmentAttributeLLList, sReloc_SegmentAttributeLLList },
+	{ "SegmentAttributeXYList", sizeof(SegmentAttributeXYList), HAE_NULL, HAE_NULL, sCmp_SegmentAttributeXYList, sReloc_SegmentAttributeXYList },
+	{ "ShapePointSet", sizeof(ShapePointSet), sSize_ShapePointSet, sCopy_ShapePointSet, sCmp_ShapePointSet, sReloc_ShapePointSet },
+	{ "SignalControlZone", sizeof(SignalControlZone), sSize_SignalControlZone, sCopy_SignalControlZone, sCmp_SignalControlZone, sReloc_SignalControlZone },
+	{ "SignalReqScheme", sizeof(SignalReqScheme), HAE_NULL, HAE_NULL, sCmp_SignalReqScheme, sReloc_SignalReqScheme },
+	{ "SignalRequest", sizeof(SignalRequest), sSize_SignalRequest, sCopy_SignalRequest, sCmp_SignalRequest, sReloc_SignalRequest },
+	{ "SignalRequestMessage", sizeof(SignalRequestMessage), sSize_SignalRequestMessage, sCopy_SignalRequestMessage, sCmp_SignalRequestMessage, sReloc_SignalRequestMessage },
+	{ "SignalRequestPackage", sizeof(SignalRequestPackage), sSize_SignalRequestPackage, sCopy_SignalRequestPackage, sCmp_SignalRequestPackage, sReloc_SignalRequestPackage },
+	{ "SignalRequesterInfo", sizeof(SignalRequesterInfo), sSize_SignalRequesterInfo, sCopy_SignalRequesterInfo, sCmp_SignalRequesterInfo, sReloc_SignalRequesterInfo },
+	{ "SignalStatus", sizeof(SignalStatus), sSize_SignalStatus, sCopy_SignalStatus, sCmp_SignalStatus, sReloc_SignalStatus },
+	{ "SignalStatusMessage", sizeof(SignalStatusMessage), sSize_SignalStatusMessage, sCopy_SignalStatusMessage, sCmp_SignalStatusMessage, sReloc_SignalStatusMessage },
+	{ "SignalStatusPackage", sizeof(SignalStatusPackage), sSize_SignalStatusPackage, sCopy_SignalStatusPackage, sCmp_SignalStatusPackage, sReloc_SignalStatusPackage },
+	{ "Snapshot", sizeof(Snapshot), sSize_Snapshot, sCopy_Snapshot, sCmp_Snapshot, sReloc_Snapshot },
+	{ "SnapshotDistance", sizeof(SnapshotDistance), HAE_NULL, HAE_NULL, sCmp_SnapshotDistance, HAE_NULL },
+	{ "SnapshotTime", sizeof(SnapshotTime), HAE_NULL, HAE_NULL, sCmp_SnapshotTime, HAE_NULL },
+	{ "SpecialVehicleExtensions", sizeof(SpecialVehicleExtensions), sSize_SpecialVehicleExtensions, sCopy_SpecialVehicleExtensions, sCmp_SpecialVehicleExtensions, sReloc_SpecialVehicleExtensions },
+	{ "SpeedLimit_element", sizeof(SpeedLimit_element), sSize_SpeedLimit_element, sCopy_SpeedLimit_element, sCmp_SpeedLimit_element, sReloc_SpeedLimit_element },
+	{ "SpeedLimit_element_item", sizeof(SpeedLimit_element_item), sSize_SpeedLimit_element_item, sCopy_SpeedLimit_element_item, sCmp_SpeedLimit_element_item, sReloc_SpeedLimit_element_item },
+	{ "SpeedProfile", sizeof(SpeedProfile), sSize_SpeedProfile, sCopy_SpeedProfile, sCmp_SpeedProfile, sReloc_SpeedProfile },
+	{ "SpeedProfileMeasurementList", sizeof(SpeedProfileMeasurementList), HAE_NULL, HAE_NULL, sCmp_SpeedProfileMeasurementList, sReloc_SpeedProfileMeasurementList },
+	{ "SpeedandHeadingandThrottleConfidence", sizeof(SpeedandHeadingandThrottleConfidence), HAE_NULL, HAE_NULL, sCmp_SpeedandHeadingandThrottleConfidence, HAE_NULL },
+	{ "SupplementalVehicleExtensions", sizeof(SupplementalVehicleExtensions), sSize_SupplementalVehicleExtensions, sCopy_SupplementalVehicleExtensions, sCmp_SupplementalVehicleExtensions, sReloc_SupplementalVehicleExtensions },
+	{ "TemporaryID", sizeof(TemporaryID), HAE_NULL, HAE_NULL, sCmp_TemporaryID, sReloc_TemporaryID },
+	{ "TestMessage00", sizeof(TestMessage00), sSize_TestMessage00, sCopy_TestMessage00, sCmp_TestMessage00, sReloc_TestMessage00 },
+	{ "TestMessage01", sizeof(TestMessage01), sSize_TestMessage01, sCopy_TestMessage01, sCmp_TestMessage01, sReloc_TestMessage01 },
+	{ "TestMessage02", sizeof(TestMessage02), sSize_TestMessage02, sCopy_TestMessage02, sCmp_TestMessage02, sReloc_TestMessage02 },
+	{ "TestMessage03", sizeof(TestMessage03), sSize_TestMessage03, sCopy_TestMessage03, sCmp_TestMessage03, sReloc_TestMessage03 },
+	{ "TestMessage04", sizeof(TestMessage04), sSize_TestMessage04, sCopy_TestMessage04, sCmp_TestMessage04, sReloc_TestMessage04 },
+	{ "TestMessage05", sizeof(TestMessage05), sSize_TestMessage05, sCopy_TestMessage05, sCmp_TestMessage05, sReloc_TestMessage05 },
+	{ "TestMessage06", sizeof(TestMessage06), sSize_TestMessage06, sCopy_TestMessage06, sCmp_TestMessage06, sReloc_TestMessage06 },
+	{ "TestMessage07", sizeof(TestMessage07), sSize_TestMessage07, sCopy_TestMessage07, sCmp_TestMessage07, sReloc_TestMessage07 },
+	{ "TestMessage08", sizeof(TestMessage08), sSize_TestMessage08, sCopy_TestMessage08, sCmp_TestMessage08, sReloc_TestMessage08 },
+	{ "TestMessage09", sizeof(TestMessage09), sSize_TestMessage09, sCopy_TestMessage09, sCmp_TestMessage09, sReloc_TestMessage09 },
+	{ "TestMessage10", sizeof(TestMessage10), sSize_TestMessage10, sCopy_TestMessage10, sCmp_TestMessage10, sReloc_TestMessage10 },
+	{ "TestMessage11", sizeof(TestMessage11), sSize_TestMessage11, sCopy_TestMessage11, sCmp_TestMessage11, sReloc_TestMessage11 },
+	{ "TestMessage12", sizeof(TestMessage12), sSize_TestMessage12, sCopy_TestMessage12, sCmp_TestMessage12, sReloc_TestMessage12 },
+	{ "TestMessage13", sizeof(TestMessage13), sSize_TestMessage13, sCopy_TestMessage13, sCmp_TestMessage13, sReloc_TestMessage13 },
+	{ "TestMessage14", sizeof(TestMessage14), sSize_TestMessage14, sCopy_TestMessage14, sCmp_TestMessage14, sReloc_TestMessage14 },
+	{ "TestMessage15", sizeof(TestMessage15), sSize_TestMessage15, sCopy_TestMessage15, sCmp_TestMessage15, sReloc_TestMessage15 },
+	{ "TimeChangeDetails", sizeof(TimeChangeDetails), HAE_NULL, HAE_NULL, sCmp_TimeChangeDetails, HAE_NULL },
+	{ "TireData", sizeof(TireData), sSize_TireData, sCopy_TireData, sCmp_TireData, sReloc_TireData },
+	{ "TrailerData", sizeof(TrailerData), sSize_TrailerData, sCopy_TrailerData, sCmp_TrailerData, sReloc_TrailerData },
+	{ "TrailerHistoryPoint", sizeof(TrailerHistoryPoint), sSize_TrailerHistoryPoint, sCopy_TrailerHistoryPoint, sCmp_TrailerHistoryPoint, sReloc_TrailerHistoryPoint },
+	{ "TrailerUnitDescription", sizeof(TrailerUnitDescription), sSize_TrailerUnitDescription, sCopy_TrailerUnitDescription, sCmp_TrailerUnitDescription, sReloc_TrailerUnitDescription },
+	{ "TransitStatus", sizeof(TransitStatus), HAE_NULL, HAE_NULL, sCmp_TransitStatus, sReloc_TransitStatus },
+	{ "TransitVehicleStatus", sizeof(TransitVehicleStatus), HAE_NULL, HAE_NULL, sCmp_TransitVehicleStatus, sReloc_TransitVehicleStatus },
+	{ "TransmissionAndSpeed", sizeof(TransmissionAndSpeed), HAE_NULL, HAE_NULL, sCmp_TransmissionAndSpeed, HAE_NULL },
+	{ "TravelerDataFrame", sizeof(TravelerDataFrame), sSize_TravelerDataFrame, sCopy_TravelerDataFrame, sCmp_TravelerDataFrame, sReloc_TravelerDataFrame },
+	{ "TravelerDataFrame_content", sizeof(TravelerDataFrame_content), sSize_TravelerDataFrame_content, sCopy_TravelerDataFrame_content, sCmp_TravelerDataFrame_content, sReloc_TravelerDataFrame_content },
+	{ "TravelerDataFrame_msgId", sizeof(TravelerDataFrame_msgId), sSize_TravelerDataFrame_msgId, sCopy_TravelerDataFrame_msgId, sCmp_TravelerDataFrame_msgId, sReloc_TravelerDataFrame_msgId },
+	{ "TravelerInformation", sizeof(TravelerInformation), sSize_TravelerInformation, sCopy_TravelerInformation, sCmp_TravelerInformation, sReloc_TravelerInformation },
+	{ "UniqueMSGID", sizeof(UniqueMSGID), HAE_NULL, HAE_NULL, sCmp_UniqueMSGID, sReloc_UniqueMSGID },
+	{ "UserSizeAndBehaviour", sizeof(UserSizeAndBehaviour), sSize_UserSizeAndBehaviour, sCopy_UserSizeAndBehaviour, sCmp_UserSizeAndBehaviour, sReloc_UserSizeAndBehaviour },
+	{ "VINstring", sizeof(VINstring), HAE_NULL, HAE_NULL, sCmp_VINstring, sReloc_VINstring },
+	{ "ValidRegion", sizeof(ValidRegion), sSize_ValidRegion, sCopy_ValidRegion, sCmp_ValidRegion, sReloc_ValidRegion },
+	{ "ValidRegion_area", sizeof(ValidRegion_area), sSize_ValidRegion_area, sCopy_ValidRegion_area, sCmp_ValidRegion_area, sReloc_ValidRegion_area },
+	{ "VehicleClassification", sizeof(VehicleClassification), sSize_VehicleClassification, sCopy_VehicleClassification, sCmp_VehicleClassification, sReloc_VehicleClassification },
+	{ "VehicleData", sizeof(VehicleData), sSize_VehicleData, sCopy_VehicleData, sCmp_VehicleData, sReloc_VehicleData },
+	{ "VehicleEventFlags", sizeof(VehicleEventFlags), sSize_VehicleEventFlags, sCopy_VehicleEventFlags, sCmp_VehicleEventFlags, sReloc_VehicleEventFlags },
+	{ "VehicleID", sizeof(VehicleID), sSize_VehicleID, sCopy_VehicleID, sCmp_VehicleID, sReloc_VehicleID },
+	{ "VehicleIdent", sizeof(VehicleIdent), sSize_VehicleIdent, sCopy_VehicleIdent, sCmp_VehicleIdent, sReloc_VehicleIdent },
+	{ "VehicleIdent_vehicleClass", sizeof(VehicleIdent_vehicleClass), HAE_NULL, HAE_NULL, sCmp_VehicleIdent_vehicleClass, HAE_NULL },
+	{ "VehicleSafetyExtensions", sizeof(VehicleSafetyExtensions), sSize_VehicleSafetyExtensions, sCopy_VehicleSafetyExtensions, sCmp_VehicleSafetyExtensions, sReloc_VehicleSafetyExtensions },
+	{ "VehicleSize", sizeof(VehicleSize), HAE_NULL, HAE_NULL, sCmp_VehicleSize, HAE_NULL },
+	{ "VehicleStatus", sizeof(VehicleStatus), sSize_VehicleStatus, sCopy_VehicleStatus, sCmp_VehicleStatus, sReloc_VehicleStatus },
+	{ "VehicleStatusRequest", sizeof(VehicleStatusRequest), sSize_VehicleStatusRequest, sCopy_VehicleStatusRequest, sCmp_VehicleStatusRequest, sReloc_VehicleStatusRequest },
+	{ "VehicleStatus_accelSets", sizeof(VehicleStatus_accelSets), sSize_VehicleStatus_accelSets, sCopy_VehicleStatus_accelSets, sCmp_VehicleStatus_accelSets, sReloc_VehicleStatus_accelSets },
+	{ "VehicleStatus_object", sizeof(VehicleStatus_object), HAE_NULL, HAE_NULL, sCmp_VehicleStatus_object, HAE_NULL },
+	{ "VehicleStatus_steering", sizeof(VehicleStatus_steering), HAE_NULL, HAE_NULL, sCmp_VehicleStatus_steering, HAE_NULL },
+	{ "VehicleStatus_vehicleData", sizeof(VehicleStatus_vehicleData), HAE_NULL, HAE_NULL, sCmp_VehicleStatus_vehicleData, HAE_NULL },
+	{ "VehicleStatus_weatherReport", sizeof(VehicleStatus_weatherReport), HAE_NULL, HAE_NULL, sCmp_VehicleStatus_weatherReport, HAE_NULL },
+	{ "VerticalAccelerationThreshold", sizeof(VerticalAccelerationThreshold), HAE_NULL, HAE_NULL, sCmp_VerticalAccelerationThreshold, sReloc_VerticalAccelerationThreshold },
+	{ "VerticalOffset", sizeof(VerticalOffset), sSize_VerticalOffset, sCopy_VerticalOffset, sCmp_VerticalOffset, sReloc_VerticalOffset },
+	{ "WeatherProbe", sizeof(WeatherProbe), sSize_WeatherProbe, sCopy_WeatherProbe, sCmp_WeatherProbe, sReloc_WeatherProbe },
+	{ "WeatherReport", sizeof(WeatherReport), sSize_WeatherReport, sCopy_WeatherReport, sCmp_WeatherReport, sReloc_WeatherReport },
+	{ "WiperSet", sizeof(WiperSet), HAE_NULL, HAE_NULL, sCmp_WiperSet, HAE_NULL },
+	{ "WorkZone_element", sizeof(WorkZone_element), sSize_WorkZone_element, sCopy_WorkZone_element, sCmp_WorkZone_element, sReloc_WorkZone_element },
+	{ "WorkZone_element_item", sizeof(WorkZone_element_item), sSize_WorkZone_element_item, sCopy_WorkZone_element_item, sCmp_WorkZone_element_item, sReloc_WorkZone_element_item },
+};
+
+const unsigned int asn_deep_cnt = sizeof(asn_deep_table) / sizeof(asn_deep_table[0]);
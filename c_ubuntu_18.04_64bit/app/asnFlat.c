@@ -0,0 +1,220 @@
+#include <DSRC.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "haeCommon.h"
+#include "asnDeep.h"
+#include "asnFlat.h"
+
+static const ASN_FLAT_HDR *sCheckHdr(const ASN_DEEP_TYPE *pType, const void *pFlat, size_t len);
+static void sInitReloc(ASN_DEEP_RELOC *pReloc, int mode, const ASN_DEEP_TYPE *pType, const void *pFlat, size_t len);
+
+/*************************************************************
+ *
+ * Function 		: AsnFlat_Size
+ *
+ * Description	: Length of the flat block of a value.
+ *
+ * Parameter	: pType - type of the value
+ *				  pValue - value
+ *
+ * Returns		: octets
+ *
+ *************************************************************/
+size_t AsnFlat_Size(const ASN_DEEP_TYPE *pType, const void *pValue)
+{
+	return sizeof(ASN_FLAT_HDR) + AsnDeep_Size(pType, pValue);
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnFlat_Write
+ *
+ * Description	: Write a value as a flat block, header, the value and
+ *				  what it points to, pointers as offsets of the block.
+ *				  The source is only read.
+ *
+ * Parameter	: pType - type of the value
+ *				  pValue - value
+ *				  pBuf - block, 8 octet aligned
+ *				  bufSize - its length
+ *				  pLen - [out] octets written
+ *
+ * Returns		: HAE_OK, HAE_ERROR if the block is too short
+ *
+ *************************************************************/
+int AsnFlat_Write(const ASN_DEEP_TYPE *pType, const void *pValue, void *pBuf, size_t bufSize, size_t *pLen)
+{
+	ASN_FLAT_HDR *pHdr = (ASN_FLAT_HDR *)pBuf;
+	size_t size = AsnFlat_Size(pType, pValue);
+	ASN_DEEP_RELOC reloc;
+	void *pRoot;
+
+	if ((size > bufSize) || (size > 0xffffffffUL) || (0 != (size_t)pBuf % 8) ||
+		(strlen(pType->pName) >= ASN_FLAT_NAME_MAX))
+	{
+		printf("[FLAT] ERROR : %s needs %lu octets\n", pType->pName, (unsigned long)size);
+		return HAE_ERROR;
+	}
+	/* alignment gaps too, the block leaves the process */
+	memset(pBuf, 0x00, size);
+	pHdr->magic = ASN_FLAT_MAGIC;
+	pHdr->version = ASN_FLAT_VERSION;
+	pHdr->ptrSize = sizeof(void *);
+	pHdr->hdrLen = sizeof(ASN_FLAT_HDR);
+	pHdr->totalLen = (unsigned int)size;
+	pHdr->rootSize = (unsigned int)pType->size;
+	strcpy(pHdr->name, pType->pName);
+
+	pRoot = AsnDeep_Copy(pType, pValue, (unsigned char *)pBuf + sizeof(ASN_FLAT_HDR), size - sizeof(ASN_FLAT_HDR));
+	if (HAE_NULL == pRoot)
+	{
+		return HAE_ERROR;
+	}
+	if (HAE_NULL != pType->pfReloc)
+	{
+		sInitReloc(&reloc, ASN_DEEP_RELOC_TO_OFFSET, pType, pBuf, size);
+		pType->pfReloc(&reloc, pRoot);
+	}
+	*pLen = size;
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnFlat_Type
+ *
+ * Description	: Type of a flat block, by the name in its header.
+ *
+ * Parameter	: pFlat - block
+ *				  len - octets received
+ *
+ * Returns		: type, HAE_NULL if the header is not one of ours
+ *
+ *************************************************************/
+const ASN_DEEP_TYPE *AsnFlat_Type(const void *pFlat, size_t len)
+{
+	const ASN_FLAT_HDR *pHdr = sCheckHdr(HAE_NULL, pFlat, len);
+
+	return (HAE_NULL != pHdr) ? AsnDeep_Find(pHdr->name) : HAE_NULL;
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnFlat_Check
+ *
+ * Description	: Check a flat block for reading it in place, every
+ *				  pointer of the value is followed. Nothing is
+ *				  written, the block may be mapped read-only.
+ *
+ * Parameter	: pType - type expected
+ *				  pFlat - block, 8 octet aligned
+ *				  len - octets received
+ *
+ * Returns		: the value in the block, pointers as offsets
+ *				  (ASN_FLAT_AT); HAE_NULL if the block is not valid
+ *
+ *************************************************************/
+const void *AsnFlat_Check(const ASN_DEEP_TYPE *pType, const void *pFlat, size_t len)
+{
+	const ASN_FLAT_HDR *pHdr;
+	ASN_DEEP_RELOC reloc;
+	void *pRoot;
+
+	if (HAE_NULL == (pHdr = sCheckHdr(pType, pFlat, len)))
+	{
+		return HAE_NULL;
+	}
+	pRoot = (unsigned char *)pFlat + pHdr->hdrLen;
+	/* the check mode reads only */
+	sInitReloc(&reloc, ASN_DEEP_RELOC_CHECK, pType, pFlat, pHdr->totalLen);
+	if (HAE_NULL != pType->pfReloc)
+	{
+		pType->pfReloc(&reloc, pRoot);
+	}
+	/* and all of the block is the value */
+	if ((0 != reloc.error) || (reloc.pos != pHdr->totalLen))
+	{
+		return HAE_NULL;
+	}
+	return pRoot;
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnFlat_Relocate
+ *
+ * Description	: Check a flat block, then turn its offsets into
+ *				  pointers of where the block is now. The value lives
+ *				  as long as the block; it cannot be relocated again,
+ *				  AsnFlat_Write it to pass it on.
+ *
+ * Parameter	: pType - type expected
+ *				  pFlat - block, 8 octet aligned, written
+ *				  len - octets received
+ *
+ * Returns		: the value, HAE_NULL if the block is not valid,
+ *				  the block is then to be dropped
+ *
+ *************************************************************/
+void *AsnFlat_Relocate(const ASN_DEEP_TYPE *pType, void *pFlat, size_t len)
+{
+	const ASN_FLAT_HDR *pHdr = (const ASN_FLAT_HDR *)pFlat;
+	ASN_DEEP_RELOC reloc;
+	void *pRoot;
+
+	/* all checked before the first write, the second walk finds what
+	   the check found */
+	if (HAE_NULL == (pRoot = (void *)AsnFlat_Check(pType, pFlat, len)))
+	{
+		return HAE_NULL;
+	}
+	if (HAE_NULL != pType->pfReloc)
+	{
+		sInitReloc(&reloc, ASN_DEEP_RELOC_TO_PTR, pType, pFlat, pHdr->totalLen);
+		pType->pfReloc(&reloc, pRoot);
+		if (0 != reloc.error)
+		{
+			return HAE_NULL;
+		}
+	}
+	return pRoot;
+}
+
+/* header of pFlat, pType HAE_NULL: any type of asn_deep_table; a bad
+   block is what a reader has to expect, it is not printed */
+static const ASN_FLAT_HDR *sCheckHdr(const ASN_DEEP_TYPE *pType, const void *pFlat, size_t len)
+{
+	const ASN_FLAT_HDR *pHdr = (const ASN_FLAT_HDR *)pFlat;
+
+	if ((len < sizeof(ASN_FLAT_HDR)) || (0 != (size_t)pFlat % 8))
+	{
+		return HAE_NULL;
+	}
+	if ((ASN_FLAT_MAGIC != pHdr->magic) || (ASN_FLAT_VERSION != pHdr->version) || (sizeof(void *) != pHdr->ptrSize) ||
+		(sizeof(ASN_FLAT_HDR) != pHdr->hdrLen) || (HAE_NULL == memchr(pHdr->name, '\0', sizeof(pHdr->name))))
+	{
+		return HAE_NULL;
+	}
+	if ((HAE_NULL != pType) && ((0 != strcmp(pHdr->name, pType->pName)) || (pHdr->rootSize != pType->size)))
+	{
+		return HAE_NULL;
+	}
+	if ((pHdr->totalLen > len) || (pHdr->totalLen < pHdr->hdrLen + ASN_DEEP_ALIGN((size_t)pHdr->rootSize)))
+	{
+		return HAE_NULL;
+	}
+	return pHdr;
+}
+
+/* the arena of AsnDeep_Copy starts after the header and the value */
+static void sInitReloc(ASN_DEEP_RELOC *pReloc, int mode, const ASN_DEEP_TYPE *pType, const void *pFlat, size_t len)
+{
+	pReloc->mode = mode;
+	pReloc->pBase = (unsigned char *)pFlat;
+	pReloc->pos = sizeof(ASN_FLAT_HDR) + ASN_DEEP_ALIGN(pType->size);
+	pReloc->len = len;
+	pReloc->error = 0;
+}
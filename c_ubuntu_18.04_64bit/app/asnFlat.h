@@ -0,0 +1,62 @@
+#ifndef ASN_FLAT_H
+#define ASN_FLAT_H
+
+#include <stddef.h>
+
+#include "asnDeep.h"
+
+/* A decoded value as one flat block with offsets in place of pointers,
+   to hand it to another process (a pipe, a socket, shared memory)
+   without an encode and a decode.
+
+   AsnFlat_Write puts a header and the AsnDeep_Copy of the value into the
+   block and turns every pointer of the copy into its offset from the
+   start of the block; a pointer HAE_NULL stays 0. The block is 8 octet
+   aligned and position independent, it can be memcpy'd or mapped
+   anywhere of a process of the same build (pointer size, byte order
+   and struct layout are those of the writer, the header checks the
+   first two).
+
+   The reader checks a block once and then either
+     - reads it where it is: AsnFlat_Check gives the value, scalar
+       fields read as they are, a pointer field holds an offset that
+       ASN_FLAT_AT turns into the address in the block, or
+     - makes it a value of its own: AsnFlat_Relocate turns the offsets
+       back into pointers, the block is then an ordinary value for the
+       encoders, AsnDeep_* and the parse functions of decodeSample.
+
+   The check follows every pointer of the value in the order AsnDeep_Copy
+   laid the block out and takes only that layout: each object must be
+   where the copy would have put it, a string must end in the block,
+   list nodes must be linked in order, and the objects must fill the
+   block. Nothing overlaps, nothing is reached twice and the walk is
+   bounded by the block length. Absent OPTIONAL fields and CHOICE
+   alternatives not chosen are not looked at, as by the generated
+   decoders; the lengths the encoders trust (numbits, numocts, n) are
+   checked. */
+
+#define ASN_FLAT_MAGIC			0x46454148	/* "HAEF" in the writer byte order */
+#define ASN_FLAT_VERSION		1
+#define ASN_FLAT_NAME_MAX		48
+
+typedef struct{
+	unsigned int magic;
+	unsigned char version;
+	unsigned char ptrSize;				/* sizeof(void *) of the writer */
+	unsigned short hdrLen;				/* sizeof(ASN_FLAT_HDR), the value follows */
+	unsigned int totalLen;				/* header, value and what it points to */
+	unsigned int rootSize;				/* sizeof the C type */
+	char name[ASN_FLAT_NAME_MAX];		/* C type name, 0 terminated */
+} ASN_FLAT_HDR;
+
+/* a pointer field of a checked block, as an address in the block */
+#define ASN_FLAT_AT(pFlat, ptr) \
+	((0 != (ptr)) ? (const void *)((const unsigned char *)(pFlat) + (size_t)(ptr)) : (const void *)0)
+
+size_t AsnFlat_Size(const ASN_DEEP_TYPE *pType, const void *pValue);
+int AsnFlat_Write(const ASN_DEEP_TYPE *pType, const void *pValue, void *pBuf, size_t bufSize, size_t *pLen);
+const ASN_DEEP_TYPE *AsnFlat_Type(const void *pFlat, size_t len);
+const void *AsnFlat_Check(const ASN_DEEP_TYPE *pType, const void *pFlat, size_t len);
+void *AsnFlat_Relocate(const ASN_DEEP_TYPE *pType, void *pFlat, size_t len);
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef ASN_LIST_H
+#define ASN_LIST_H
+
+#if !defined(__cplusplus) || (__cplusplus < 201703L)
+#error "asnList.h is C++17"
+#endif
+
+#include <DSRC.h>
+#include <AddGrpB.h>
+#include <AddGrpC.h>
+#include <AddGrpD.h>
+#include <ISO14827-2.h>
+#include <ITIS.h>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+#include "asnSpan.h"
+
+/* Typed iteration over the SEQUENCE OF values the generated code keeps
+   in an OSRTDList, in place of
+
+     for (pnode = plist->head; pnode != 0 && xx < plist->count; pnode = pnode->next)
+         pstate = (MovementState *)pnode->data;
+
+   the same loop, inlined, with the element type taken from the ASN.1
+   typedef instead of a cast:
+
+     for (const MovementState &state : hae::MovementList_view(pdata->states))
+
+   Every OSRTDList typedef of the headers gets a <list>_view() returning
+   a dlist_view of its element type (asnListTable.h, genAsnListTable.sh),
+   const lists give views of const elements. dlist_view<T> also takes a
+   plain OSRTDList, e.g. the unnamed lists of extension members.
+
+   flatten() / flattenCopy() put the elements into a scratch array of
+   the calling thread, for loops wanting an index or contiguous values.
+   The array is one per element type and thread, reused by the next call
+   for that type on the thread, it only grows. */
+
+namespace hae
+{
+
+/* end of a dlist_view */
+struct dlist_end
+{
+};
+
+template<typename T>
+class dlist_iterator
+{
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = std::remove_const_t<T>;
+	using difference_type = std::ptrdiff_t;
+	using pointer = T *;
+	using reference = T &;
+
+	dlist_iterator() noexcept = default;
+	dlist_iterator(OSRTDListNode *p, OSSIZE n) noexcept : pNode(p), left(n) {}
+
+	T &operator*() const noexcept { return *static_cast<T *>(pNode->data); }
+	T *operator->() const noexcept { return static_cast<T *>(pNode->data); }
+	OSRTDListNode *node() const noexcept { return pNode; }
+
+	dlist_iterator &operator++() noexcept
+	{
+		pNode = pNode->next;
+		left--;
+		return *this;
+	}
+	dlist_iterator operator++(int) noexcept
+	{
+		dlist_iterator prev = *this;
+		++*this;
+		return prev;
+	}
+
+	/* like the hand-written loops: stops at a null next or after count */
+	bool done() const noexcept { return (nullptr == pNode) || (0 == left); }
+
+	friend bool operator==(const dlist_iterator &it, dlist_end) noexcept { return it.done(); }
+	friend bool operator!=(const dlist_iterator &it, dlist_end) noexcept { return !it.done(); }
+	friend bool operator==(const dlist_iterator &a, const dlist_iterator &b) noexcept
+	{
+		return (a.done() && b.done()) || (a.pNode == b.pNode);
+	}
+	friend bool operator!=(const dlist_iterator &a, const dlist_iterator &b) noexcept { return !(a == b); }
+
+private:
+	OSRTDListNode *pNode = nullptr;
+	OSSIZE left = 0;
+};
+
+/* the elements of an OSRTDList as T, the list stays where it is */
+template<typename T>
+class dlist_view
+{
+public:
+	using iterator = dlist_iterator<T>;
+
+	dlist_view() noexcept = default;
+	template<typename U = T, typename = std::enable_if_t<std::is_const<U>::value>>
+	explicit dlist_view(const OSRTDList &list) noexcept : pList(&list) {}
+	explicit dlist_view(OSRTDList &list) noexcept : pList(&list) {}
+
+	iterator begin() const noexcept { return (nullptr != pList) ? iterator(pList->head, pList->count) : iterator(); }
+	dlist_end end() const noexcept { return dlist_end(); }
+	/* a dlist_iterator end, for algorithms wanting begin and end of one type */
+	iterator end_iterator() const noexcept { return iterator(); }
+
+	std::size_t size() const noexcept { return (nullptr != pList) ? pList->count : 0; }
+	bool empty() const noexcept { return (nullptr == pList) || (0 == pList->count) || (nullptr == pList->head); }
+	T &front() const noexcept { return *static_cast<T *>(pList->head->data); }
+	T &back() const noexcept { return *static_cast<T *>(pList->tail->data); }
+
+private:
+	const OSRTDList *pList = nullptr;
+};
+
+/* element pointers in list order, valid until the next flatten() for T on this thread */
+template<typename T>
+inline span<T *const> flatten(dlist_view<T> view)
+{
+	thread_local std::vector<T *> scratch;
+
+	scratch.clear();
+	scratch.reserve(view.size());
+	for (T &elem : view)
+	{
+		scratch.push_back(&elem);
+	}
+	return span<T *const>(scratch.data(), scratch.size());
+}
+
+/* the elements copied next to each other, valid until the next flattenCopy() for T
+   on this thread; the copies are shallow, pointers in them go into the decoded value */
+template<typename T>
+inline span<const std::remove_const_t<T>> flattenCopy(dlist_view<T> view)
+{
+	using E = std::remove_const_t<T>;
+	thread_local std::vector<E> scratch;
+
+	static_assert(std::is_trivially_copyable<E>::value, "flattenCopy needs a C struct");
+	scratch.clear();
+	scratch.reserve(view.size());
+	for (const E &elem : view)
+	{
+		scratch.push_back(elem);
+	}
+	return span<const E>(scratch.data(), scratch.size());
+}
+
+#define ASN_LIST(L, T) \
+	inline dlist_view<T> L##_view(L &list) noexcept { return dlist_view<T>(list); } \
+	inline dlist_view<const T> L##_view(const L &list) noexcept { return dlist_view<const T>(list); }
+
+#include "asnListTable.h"
+
+#undef ASN_LIST
+
+}
+
+#endif
@@ -0,0 +1,85 @@
+/* Generated by genAsnListTable.sh, do not edit */
+
+/* OSRTDList typedefs of DSRC.h, AddGrpB.h, AddGrpC.h, AddGrpD.h, ISO14827-2.h, ITIS.h */
+
+ASN_LIST(AdvisorySpeedList, AdvisorySpeed)
+ASN_LIST(AdvisorySpeed_regional, RegionalExtension)
+ASN_LIST(AxleWeightList, AxleWeightSet)
+ASN_LIST(BasicSafetyMessage_partII, PartIIcontent)
+ASN_LIST(BasicSafetyMessage_regional, RegionalExtension)
+ASN_LIST(CommonSafetyRequest_regional, RegionalExtension)
+ASN_LIST(ComputedLane_regional, RegionalExtension)
+ASN_LIST(ConnectionManeuverAssist_regional, RegionalExtension)
+ASN_LIST(ConnectsToList, Connection)
+ASN_LIST(EmergencyVehicleAlert_regional, RegionalExtension)
+ASN_LIST(EventDescription_regional, RegionalExtension)
+ASN_LIST(ExitService, ExitService_element)
+ASN_LIST(GenericLane_regional, RegionalExtension)
+ASN_LIST(GenericSignage, GenericSignage_element)
+ASN_LIST(GeographicalPath_regional, RegionalExtension)
+ASN_LIST(GeometricProjection_regional, RegionalExtension)
+ASN_LIST(ITIScodesAndText, ITIScodesAndText_element)
+ASN_LIST(IntersectionCollision_regional, RegionalExtension)
+ASN_LIST(IntersectionGeometryList, IntersectionGeometry)
+ASN_LIST(IntersectionGeometry_regional, RegionalExtension)
+ASN_LIST(IntersectionStateList, IntersectionState)
+ASN_LIST(IntersectionState_regional, RegionalExtension)
+ASN_LIST(LaneDataAttributeList, LaneDataAttribute)
+ASN_LIST(LaneDataAttribute_regional, RegionalExtension)
+ASN_LIST(LaneList, GenericLane)
+ASN_LIST(Login_datexLogin_EncodingRules_id, ASN1OBJID)
+ASN_LIST(ManeuverAssistList, ConnectionManeuverAssist)
+ASN_LIST(MapData_regional, RegionalExtension)
+ASN_LIST(MovementEventList, MovementEvent)
+ASN_LIST(MovementEvent_regional, RegionalExtension)
+ASN_LIST(MovementList, MovementState)
+ASN_LIST(MovementState_regional, RegionalExtension)
+ASN_LIST(NMEAcorrections_regional, RegionalExtension)
+ASN_LIST(NodeAttributeSetLL_regional, RegionalExtension)
+ASN_LIST(NodeAttributeSetXY_regional, RegionalExtension)
+ASN_LIST(NodeSetLL, NodeLL)
+ASN_LIST(NodeSetXY, NodeXY)
+ASN_LIST(PVD_addGrpD_cits, CITSPVD)
+ASN_LIST(PathHistoryPointList, PathHistoryPoint)
+ASN_LIST(PersonalSafetyMessage_regional, RegionalExtension)
+ASN_LIST(Position3D_regional, RegionalExtension)
+ASN_LIST(PreemptPriorityList, SignalControlZone)
+ASN_LIST(PrioritizationResponseList, PrioritizationResponse)
+ASN_LIST(ProbeDataManagement_regional, RegionalExtension)
+ASN_LIST(ProbeVehicleData_regional, RegionalExtension)
+ASN_LIST(ProbeVehicleData_snapshots, Snapshot)
+ASN_LIST(RTCMcorrections_regional, RegionalExtension)
+ASN_LIST(RegionList, RegionOffsets)
+ASN_LIST(RequestorDescription_regional, RegionalExtension)
+ASN_LIST(RestrictionClassList, RestrictionClassAssignment)
+ASN_LIST(RestrictionUserTypeList, RestrictionUserType)
+ASN_LIST(RestrictionUserType_regional, RegionalExtension)
+ASN_LIST(RoadLaneSetList, GenericLane)
+ASN_LIST(RoadSegmentList, RoadSegment)
+ASN_LIST(RoadSegment_regional, RegionalExtension)
+ASN_LIST(RoadSideAlert_regional, RegionalExtension)
+ASN_LIST(SPAT_regional, RegionalExtension)
+ASN_LIST(SignalHeadLocationList, SignalHeadLocation)
+ASN_LIST(SignalRequestList, SignalRequestPackage)
+ASN_LIST(SignalRequestMessage_regional, RegionalExtension)
+ASN_LIST(SignalRequestPackage_regional, RegionalExtension)
+ASN_LIST(SignalRequest_regional, RegionalExtension)
+ASN_LIST(SignalStatusList, SignalStatus)
+ASN_LIST(SignalStatusMessage_regional, RegionalExtension)
+ASN_LIST(SignalStatusPackageList, SignalStatusPackage)
+ASN_LIST(SignalStatusPackage_regional, RegionalExtension)
+ASN_LIST(SignalStatus_regional, RegionalExtension)
+ASN_LIST(SpeedLimit, SpeedLimit_element)
+ASN_LIST(SpeedLimitList, RegulatorySpeedLimit)
+ASN_LIST(SupplementalVehicleExtensions_regional, RegionalExtension)
+ASN_LIST(TireDataList, TireData)
+ASN_LIST(TrailerHistoryPointList, TrailerHistoryPoint)
+ASN_LIST(TrailerUnitDescriptionList, TrailerUnitDescription)
+ASN_LIST(TravelerDataFrameList, TravelerDataFrame)
+ASN_LIST(TravelerDataFrame_regions, GeographicalPath)
+ASN_LIST(TravelerInformation_regional, RegionalExtension)
+ASN_LIST(VehicleClassification_regional, RegionalExtension)
+ASN_LIST(VehicleStatusRequestList, VehicleStatusRequest)
+ASN_LIST(VehicleToLanePositionList, VehicleToLanePosition)
+ASN_LIST(WorkZone, WorkZone_element)
+ASN_LIST(_SeqOfPublicationData, PublicationData)
@@ -0,0 +1,389 @@
+#ifndef ASN_SESSION_H
+#define ASN_SESSION_H
+
+#if !defined(__cplusplus) || (__cplusplus < 201703L)
+#error "asnSession.h is C++17"
+#endif
+
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "asnSpan.h"
+
+/* UPER decode / encode from C++ on pooled contexts. The C++ classes of
+   the runtime (ASN1PERDecodeBuffer, OSRTContext) are not in the shipped
+   libraries, so this sits on the generated asn1PD_* / asn1PE_* directly.
+
+   Every thread keeps its own pool of OSCTXTs (thread_local, nothing is
+   shared and nothing is locked). decode<T>() takes a context from the
+   pool, decodes into its memory heap and returns a move-only AsnMessage
+   owning that context; when the message goes away the heap is reset,
+   which keeps its blocks, and the context goes back to the pool. Once
+   the pool holds as many contexts as there are messages alive at a time
+   and their heaps have grown to the largest message, decoding allocates
+   nothing. encode<T>() works the same way with AsnEncoded, whose
+   context also keeps its output buffer.
+
+   A message may be moved to another thread and dropped there, its
+   context then joins that thread's pool. Messages must be dropped
+   before the thread whose pool takes them back exits.
+
+     auto spat = hae::decodeFrame<SPAT>(hae::span<const uint8_t>(p, len));
+     if (spat) use(spat->intersections);
+
+   The types are bound with ASN_SESSION_CODEC(T, messageId), the DSRC
+   messages are below; messageId 0 for types that are no message. */
+
+namespace hae
+{
+
+template<typename T>
+struct AsnCodec;
+
+#define ASN_SESSION_CODEC(T, id) \
+	template<> \
+	struct AsnCodec<T> \
+	{ \
+		static constexpr unsigned int messageId = (id); \
+		static constexpr const char *pName = #T; \
+		static int decode(OSCTXT *pctxt, T *pValue) { return asn1PD_##T(pctxt, pValue); } \
+		static int encode(OSCTXT *pctxt, T *pValue) { return asn1PE_##T(pctxt, pValue); } \
+	};
+
+ASN_SESSION_CODEC(MessageFrame, 0)
+ASN_SESSION_CODEC(MapData, ASN1V_mapData)
+ASN_SESSION_CODEC(SPAT, ASN1V_signalPhaseAndTimingMessage)
+ASN_SESSION_CODEC(BasicSafetyMessage, ASN1V_basicSafetyMessage)
+ASN_SESSION_CODEC(CommonSafetyRequest, ASN1V_commonSafetyRequest)
+ASN_SESSION_CODEC(EmergencyVehicleAlert, ASN1V_emergencyVehicleAlert)
+ASN_SESSION_CODEC(IntersectionCollision, ASN1V_intersectionCollision)
+ASN_SESSION_CODEC(NMEAcorrections, ASN1V_nmeaCorrections)
+ASN_SESSION_CODEC(ProbeDataManagement, ASN1V_probeDataManagement)
+ASN_SESSION_CODEC(ProbeVehicleData, ASN1V_probeVehicleData)
+ASN_SESSION_CODEC(RoadSideAlert, ASN1V_roadSideAlert)
+ASN_SESSION_CODEC(RTCMcorrections, ASN1V_rtcmCorrections)
+ASN_SESSION_CODEC(SignalRequestMessage, ASN1V_signalRequestMessage)
+ASN_SESSION_CODEC(SignalStatusMessage, ASN1V_signalStatusMessage)
+ASN_SESSION_CODEC(TravelerInformation, ASN1V_travelerInformation)
+ASN_SESSION_CODEC(PersonalSafetyMessage, ASN1V_personalSafetyMessage)
+
+/* contexts of the calling thread */
+class AsnSessionPool
+{
+public:
+	static constexpr std::size_t ENCODE_BUF_SIZE = 4096;	/* first output buffer, doubled on overflow */
+
+	/* context plus, for encoding, its output buffer */
+	struct Session
+	{
+		OSCTXT ctxt;
+		std::vector<OSOCTET> buf;
+		std::vector<OSOCTET> valueBuf;			/* encodeFrame: the value before the frame */
+	};
+
+	static AsnSessionPool &local()
+	{
+		thread_local AsnSessionPool pool;
+		return pool;
+	}
+
+	Session *acquire()
+	{
+		Session *pSession;
+
+		if (!freeList.empty())
+		{
+			pSession = freeList.back();
+			freeList.pop_back();
+			return pSession;
+		}
+		pSession = new Session();
+		if (0 != rtInitContext(&pSession->ctxt))
+		{
+			delete pSession;
+			return nullptr;
+		}
+		createCnt++;
+		if (freeList.capacity() < createCnt)
+		{
+			/* room to take every session back without growing then */
+			freeList.reserve(2 * createCnt);
+		}
+		return pSession;
+	}
+
+	void release(Session *pSession) noexcept
+	{
+		rtxMemReset(&pSession->ctxt);
+		if (freeList.size() < freeList.capacity())
+		{
+			freeList.push_back(pSession);
+			return;
+		}
+		/* from a thread that did not create it and has no room */
+		try
+		{
+			freeList.push_back(pSession);
+		}
+		catch (...)
+		{
+			destroy(pSession);
+		}
+	}
+
+	/* contexts created by this thread, and now idle here */
+	std::size_t created() const noexcept { return createCnt; }
+	std::size_t idle() const noexcept { return freeList.size(); }
+
+	AsnSessionPool(const AsnSessionPool &) = delete;
+	AsnSessionPool &operator=(const AsnSessionPool &) = delete;
+
+private:
+	AsnSessionPool() { freeList.reserve(8); }
+
+	~AsnSessionPool()
+	{
+		for (Session *pSession : freeList)
+		{
+			destroy(pSession);
+		}
+	}
+
+	static void destroy(Session *pSession) noexcept
+	{
+		rtFreeContext(&pSession->ctxt);
+		delete pSession;
+	}
+
+	std::vector<Session *> freeList;
+	std::size_t createCnt = 0;
+};
+
+/* holds a pooled session, gives it back when it goes */
+class AsnSessionHandle
+{
+public:
+	AsnSessionHandle() noexcept = default;
+	explicit AsnSessionHandle(AsnSessionPool::Session *p) noexcept : pSession(p) {}
+	AsnSessionHandle(AsnSessionHandle &&other) noexcept : pSession(std::exchange(other.pSession, nullptr)) {}
+	AsnSessionHandle &operator=(AsnSessionHandle &&other) noexcept
+	{
+		if (this != &other)
+		{
+			reset();
+			pSession = std::exchange(other.pSession, nullptr);
+		}
+		return *this;
+	}
+	AsnSessionHandle(const AsnSessionHandle &) = delete;
+	AsnSessionHandle &operator=(const AsnSessionHandle &) = delete;
+	~AsnSessionHandle() { reset(); }
+
+	void reset() noexcept
+	{
+		if (nullptr != pSession)
+		{
+			AsnSessionPool::local().release(std::exchange(pSession, nullptr));
+		}
+	}
+	AsnSessionPool::Session *get() const noexcept { return pSession; }
+
+private:
+	AsnSessionPool::Session *pSession = nullptr;
+};
+
+/* a decoded value in the memory of its own context */
+template<typename T>
+class AsnMessage
+{
+public:
+	AsnMessage() noexcept = default;
+	AsnMessage(AsnSessionHandle &&h, T *p, int stat, unsigned int id) noexcept
+		: handle(std::move(h)), pValue(p), status(stat), messageId(id) {}
+
+	/* decoded without error */
+	explicit operator bool() const noexcept { return (0 == status) && (nullptr != pValue); }
+	int error() const noexcept { return status; }
+	unsigned int id() const noexcept { return messageId; }
+
+	T *get() const noexcept { return pValue; }
+	T *operator->() const noexcept { return pValue; }
+	T &operator*() const noexcept { return *pValue; }
+
+	/* the context holding the value, e.g. for asn1PrtToStrm_* */
+	OSCTXT *context() const noexcept { return (nullptr != handle.get()) ? &handle.get()->ctxt : nullptr; }
+
+	void reset() noexcept
+	{
+		handle.reset();
+		pValue = nullptr;
+	}
+
+private:
+	AsnSessionHandle handle;
+	T *pValue = nullptr;
+	int status = RTERR_NOTINIT;
+	unsigned int messageId = 0;
+};
+
+/* an encoding in the output buffer of its own context */
+class AsnEncoded
+{
+public:
+	AsnEncoded() noexcept = default;
+	AsnEncoded(AsnSessionHandle &&h, const OSOCTET *p, std::size_t n, int stat) noexcept
+		: handle(std::move(h)), pData(p), len(n), status(stat) {}
+
+	explicit operator bool() const noexcept { return 0 == status; }
+	int error() const noexcept { return status; }
+	span<const std::uint8_t> bytes() const noexcept { return span<const std::uint8_t>(pData, len); }
+	const std::uint8_t *data() const noexcept { return pData; }
+	std::size_t size() const noexcept { return len; }
+
+private:
+	AsnSessionHandle handle;
+	const OSOCTET *pData = nullptr;
+	std::size_t len = 0;
+	int status = RTERR_NOTINIT;
+};
+
+namespace detail
+{
+
+template<typename T>
+inline int decodeInto(OSCTXT *pctxt, const OSOCTET *pData, std::size_t len, T **ppValue)
+{
+	*ppValue = static_cast<T *>(rtxMemAllocZ(pctxt, sizeof(T)));
+	if (nullptr == *ppValue)
+	{
+		return RTERR_NOMEM;
+	}
+	pu_setBuffer(pctxt, const_cast<OSOCTET *>(pData), len, FALSE);
+	return AsnCodec<T>::decode(pctxt, *ppValue);
+}
+
+/* encode into buf, doubled until it fits */
+template<typename T>
+inline int encodeInto(OSCTXT *pctxt, std::vector<OSOCTET> &buf, T *pValue, std::size_t *pLen)
+{
+	int stat;
+
+	if (buf.empty())
+	{
+		buf.resize(AsnSessionPool::ENCODE_BUF_SIZE);
+	}
+	for (;;)
+	{
+		pu_setBuffer(pctxt, buf.data(), buf.size(), FALSE);
+		stat = AsnCodec<T>::encode(pctxt, pValue);
+		if ((RTERR_BUFOVFLW != stat) || (buf.size() >= (1U << 24)))
+		{
+			break;
+		}
+		buf.resize(2 * buf.size());
+	}
+	*pLen = (0 == stat) ? pu_getMsgLen(pctxt) : 0;
+
+	return stat;
+}
+
+}
+
+/* the UPER value of T */
+template<typename T>
+inline AsnMessage<T> decode(span<const std::uint8_t> data)
+{
+	AsnSessionHandle handle(AsnSessionPool::local().acquire());
+	T *pValue = nullptr;
+	int stat;
+
+	if (nullptr == handle.get())
+	{
+		return AsnMessage<T>(std::move(handle), nullptr, RTERR_NOMEM, 0);
+	}
+	stat = detail::decodeInto(&handle.get()->ctxt, data.data(), data.size(), &pValue);
+
+	return AsnMessage<T>(std::move(handle), pValue, stat, AsnCodec<T>::messageId);
+}
+
+/* a MessageFrame that must carry a T */
+template<typename T>
+inline AsnMessage<T> decodeFrame(span<const std::uint8_t> data)
+{
+	AsnSessionHandle handle(AsnSessionPool::local().acquire());
+	MessageFrame *pFrame = nullptr;
+	T *pValue = nullptr;
+	unsigned int id = 0;
+	int stat;
+
+	if (nullptr == handle.get())
+	{
+		return AsnMessage<T>(std::move(handle), nullptr, RTERR_NOMEM, 0);
+	}
+	stat = detail::decodeInto(&handle.get()->ctxt, data.data(), data.size(), &pFrame);
+	if (0 == stat)
+	{
+		id = pFrame->messageId;
+		stat = (AsnCodec<T>::messageId == id) ?
+			detail::decodeInto(&handle.get()->ctxt, pFrame->value.data, pFrame->value.numocts, &pValue) :
+			RTERR_IDNOTFOU;
+	}
+
+	return AsnMessage<T>(std::move(handle), (0 == stat) ? pValue : nullptr, stat, id);
+}
+
+/* UPER of value */
+template<typename T>
+inline AsnEncoded encode(const T &value)
+{
+	AsnSessionHandle handle(AsnSessionPool::local().acquire());
+	AsnSessionPool::Session *pSession = handle.get();
+	std::size_t len = 0;
+	int stat;
+
+	if (nullptr == pSession)
+	{
+		return AsnEncoded(std::move(handle), nullptr, 0, RTERR_NOMEM);
+	}
+	stat = detail::encodeInto(&pSession->ctxt, pSession->buf, const_cast<T *>(&value), &len);
+
+	return AsnEncoded(std::move(handle), pSession->buf.data(), len, stat);
+}
+
+/* value in a MessageFrame with its messageId */
+template<typename T>
+inline AsnEncoded encodeFrame(const T &value)
+{
+	AsnSessionHandle handle(AsnSessionPool::local().acquire());
+	AsnSessionPool::Session *pSession = handle.get();
+	MessageFrame frame;
+	std::size_t valueLen = 0, len = 0;
+	int stat;
+
+	static_assert(0 != AsnCodec<T>::messageId, "not a message type");
+	if (nullptr == pSession)
+	{
+		return AsnEncoded(std::move(handle), nullptr, 0, RTERR_NOMEM);
+	}
+	stat = detail::encodeInto(&pSession->ctxt, pSession->valueBuf, const_cast<T *>(&value), &valueLen);
+	if (0 == stat)
+	{
+		asn1Init_MessageFrame(&frame);
+		frame.messageId = AsnCodec<T>::messageId;
+		frame.value.numocts = valueLen;
+		frame.value.data = pSession->valueBuf.data();
+		stat = detail::encodeInto(&pSession->ctxt, pSession->buf, &frame, &len);
+	}
+
+	return AsnEncoded(std::move(handle), pSession->buf.data(), len, stat);
+}
+
+}
+
+#endif
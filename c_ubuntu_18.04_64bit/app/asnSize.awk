@@ -0,0 +1,501 @@
+#
+# Static UPER / OER size bounds of every type in the ASN.1 definitions
+# that ASN1C copies into the comment blocks of the generated headers.
+# Used by genAsnTypeTable.sh.
+#
+# usage: awk -f asnSize.awk header.h... > sizes
+#
+# One line per C type: name flags perMinBits perMaxBits oerMinBytes oerMaxBytes
+# A max of -1 means no static bound (open types, unconstrained sizes).
+# flags: 1 extensible (the max holds for values without unknown
+#        extensions), 2 unbounded, 4 a referenced type is not defined
+#
+# Types defined inline in a SEQUENCE / CHOICE / SEQUENCE OF get the C name
+# ASN1C gives them: Parent_component, Parent_element.
+#
+
+function flush(    text, at, asn)
+{
+	text = block
+	block = ""
+	if (!match(text, /[A-Za-z][A-Za-z0-9-]* ::= /))
+		return
+	text = substr(text, RSTART)
+	at = index(text, " ::= ")
+	asn = substr(text, 1, at - 1)
+	text = substr(text, at + 5)
+
+	key = module SUBSEP asn
+	if (key in defStart)
+		return
+	# ASN1C prefixes the module to a C name another module already took
+	if ((banner in cmod) && cmod[banner] != module)
+		banner = module "_" banner
+	cmod[banner] = module
+	defCName[key] = banner
+	defStart[key] = ntok + 1
+	tokenize(text)
+	defEnd[key] = ntok
+	if (!(asn in gmod))
+		gmod[asn] = module
+	order[++ndef] = key
+}
+
+function tokenize(s,    t)
+{
+	while (length(s) > 0) {
+		if (match(s, /^[ \t]+/)) {
+			s = substr(s, RLENGTH + 1)
+			continue
+		}
+		if (match(s, /^\.\.\./) || match(s, /^\.\./) || match(s, /^-?[0-9]+/) ||
+			match(s, /^[A-Za-z&@][A-Za-z0-9&@._-]*/))
+			t = substr(s, 1, RLENGTH)
+		else
+			t = substr(s, 1, 1)
+		tok[++ntok] = t
+		s = substr(s, length(t) + 1)
+	}
+}
+
+function bitsFor(n,    b)
+{
+	b = 0
+	while (2 ^ b < n)
+		b++
+	return b
+}
+
+function bytesFor(n,    b)
+{
+	b = 1
+	while (n >= 256 ^ b)
+		b++
+	return b
+}
+
+# OER length determinant in front of n octets
+function oerLen(n)
+{
+	return (n < 128) ? 1 : 1 + bytesFor(n)
+}
+
+function add(a, b)
+{
+	return (a < 0 || b < 0) ? -1 : a + b
+}
+
+function mul(a, n)
+{
+	return (a < 0) ? -1 : a * n
+}
+
+function setResult(umin, umax, omin, omax, flags)
+{
+	R_umin = umin; R_umax = umax
+	R_omin = omin; R_omax = omax
+	R_flags = flags
+	if (umax < 0 || omax < 0)
+		R_flags = or2(R_flags, 2)
+}
+
+# bitwise or of the small flag values, POSIX awk has none
+function or2(a, b,    r, bit)
+{
+	r = 0
+	for (bit = 1; bit <= 4; bit *= 2)
+		if (int(a / bit) % 2 || int(b / bit) % 2)
+			r += bit
+	return r
+}
+
+function skipBalanced(    depth, o, c)
+{
+	o = tok[p]
+	c = (o == "(") ? ")" : (o == "{") ? "}" : "]"
+	depth = 0
+	do {
+		if (tok[p] == o) depth++
+		else if (tok[p] == c) depth--
+		p++
+	} while (depth > 0 && p <= ntok)
+}
+
+# (lo..hi) / (n) / (lo..hi, ...), sets C_lo C_hi C_ext; 0 if not a range
+function constraint(    ok)
+{
+	C_ext = 0
+	C_lo = ""; C_hi = ""
+	if (tok[p] != "(")
+		return 0
+	if (tok[p + 1] == "SIZE") {
+		p += 2
+		ok = constraint()
+		p++
+		return ok
+	}
+	p++
+	if (tok[p] !~ /^-?[0-9]+$/) {
+		p--
+		skipBalanced()
+		return 0
+	}
+	C_lo = tok[p] + 0
+	C_hi = C_lo
+	p++
+	if (tok[p] == "..") {
+		C_hi = (tok[p + 1] ~ /^-?[0-9]+$/) ? tok[p + 1] + 0 : ""
+		p += 2
+	}
+	if (tok[p] == "," && tok[p + 1] == "...") {
+		C_ext = 1
+		p += 2
+	}
+	while (tok[p] != ")" && p <= ntok)
+		p++
+	p++
+	return (C_hi != "")
+}
+
+function intSize(lo, hi, ext,    ob)
+{
+	if (ext || lo == "" || hi == "") {
+		# length + up to 8 content octets, the C types are 64 bit at most
+		setResult(ext ? 1 + 8 + 8 : 8 + 8, ext ? 1 + 8 + 64 : 8 + 64, 2, 9, ext)
+		return
+	}
+	if (lo >= 0)
+		ob = (hi <= 255) ? 1 : (hi <= 65535) ? 2 : (hi <= 4294967295) ? 4 : 8
+	else
+		ob = (lo >= -128 && hi <= 127) ? 1 : (lo >= -32768 && hi <= 32767) ? 2 : (lo >= -2147483648 && hi <= 2147483647) ? 4 : 8
+	setResult(bitsFor(hi - lo + 1), bitsFor(hi - lo + 1), ob, ob, 0)
+}
+
+# strings: bits per character in UPER, 0 for UTF8String; OER content
+# octets per character, BIT STRING is 1 bit per character plus the octet
+# of unused bits when the size is not fixed
+function stringSize(ubits, obits,    lo, hi, ext, lbits, unused, umin, umax, omin, omax)
+{
+	if (!constraint()) {
+		setResult(8, -1, 1, -1, 0)
+		return
+	}
+	lo = C_lo; hi = C_hi; ext = C_ext
+	if (ubits == 0) {
+		# UTF8String: the size constraint is not PER-visible, length in octets
+		umin = 8 + 8 * lo
+		umax = ((4 * hi < 128) ? 8 : 16) + 32 * hi
+		setResult(umin, umax, oerLen(lo) + lo, oerLen(4 * hi) + 4 * hi, 0)
+		return
+	}
+	lbits = (lo == hi) ? 0 : bitsFor(hi - lo + 1)
+	umin = ext + lbits + ubits * lo
+	umax = ext + lbits + ubits * hi
+	if (lo == hi && !ext) {
+		omin = omax = int((obits * lo + 7) / 8)
+	} else {
+		unused = (obits == 1) ? 1 : 0
+		omin = unused + int((obits * lo + 7) / 8)
+		omax = unused + int((obits * hi + 7) / 8)
+		omin += oerLen(omin)
+		omax += oerLen(omax)
+	}
+	setResult(umin, umax, omin, omax, ext)
+}
+
+function enumSize(    n, ext, v, vmax, small, big, item, omin, omax)
+{
+	p++
+	n = 0; ext = 0; v = -1; vmax = 0; small = 0; big = 0
+	while (tok[p] != "}" && p <= ntok) {
+		if (tok[p] == "...") {
+			ext = 1
+		} else if (tok[p] != ",") {
+			item = tok[p]
+			if (tok[p + 1] == "(") {
+				v = tok[p + 2] + 0
+				p += 3
+			} else {
+				v++
+			}
+			if (!ext) {
+				n++
+				if (v > vmax) vmax = v
+				if (v >= 0 && v <= 127) small = 1
+				else big = 1
+			}
+		}
+		p++
+	}
+	p++
+	omin = small ? 1 : 1 + bytesFor(vmax * 2)
+	omax = big ? 1 + bytesFor(vmax * 2) : 1
+	setResult(ext + bitsFor(n), ext + bitsFor(n), omin, omax, ext)
+}
+
+function openType()
+{
+	# X.691 11.2: length + a complete encoding of at least one octet
+	setResult(16, -1, 1, -1, 2)
+}
+
+function sequenceSize(cname,    umin, umax, omin, omax, flags, nopt, ext, name, inner)
+{
+	p++
+	umin = umax = omin = omax = 0
+	flags = 0; nopt = 0; ext = 0
+	while (tok[p] != "}" && p <= ntok) {
+		if (tok[p] == ",") {
+			p++
+			continue
+		}
+		if (tok[p] == "...") {
+			ext = 1
+			p++
+			continue
+		}
+		name = tok[p++]
+		gsub(/-/, "_", name)
+		if (tok[p] == "[")
+			skipBalanced()
+		typeSize(cname "_" name)
+		inner = R_flags
+		if (ext) {
+			# extension addition, not part of the root bound
+			flags = or2(flags, 1)
+		} else {
+			umin += R_umin; umax = add(umax, R_umax)
+			omin += R_omin; omax = add(omax, R_omax)
+			flags = or2(flags, inner)
+		}
+		if (tok[p] == "OPTIONAL") {
+			p++
+			if (!ext) { nopt++; umin -= R_umin; omin -= R_omin }
+		} else if (tok[p] == "DEFAULT") {
+			if (!ext) { nopt++; umin -= R_umin; omin -= R_omin }
+			p++
+			while (tok[p] != "," && tok[p] != "}" && p <= ntok) {
+				if (tok[p] == "{") skipBalanced()
+				else p++
+			}
+		}
+	}
+	p++
+	flags = or2(flags, ext)
+	# preamble: extension bit and presence bitmap, whole octets in OER
+	setResult(umin + ext + nopt, add(umax, ext + nopt), omin + int((ext + nopt + 7) / 8), add(omax, int((ext + nopt + 7) / 8)), flags)
+}
+
+function choiceSize(cname,    n, ext, umin, umax, omin, omax, flags, name, first)
+{
+	p++
+	n = 0; ext = 0; flags = 0; first = 1
+	while (tok[p] != "}" && p <= ntok) {
+		if (tok[p] == ",") {
+			p++
+			continue
+		}
+		if (tok[p] == "...") {
+			ext = 1
+			p++
+			continue
+		}
+		name = tok[p++]
+		gsub(/-/, "_", name)
+		if (tok[p] == "[")
+			skipBalanced()
+		typeSize(cname "_" name)
+		if (ext) {
+			flags = or2(flags, 1)
+			continue
+		}
+		n++
+		flags = or2(flags, R_flags)
+		if (first || R_umin < umin) umin = R_umin
+		if (first || R_omin < omin) omin = R_omin
+		if (first) { umax = R_umax; omax = R_omax }
+		else {
+			umax = (umax < 0 || R_umax < 0) ? -1 : (R_umax > umax ? R_umax : umax)
+			omax = (omax < 0 || R_omax < 0) ? -1 : (R_omax > omax ? R_omax : omax)
+		}
+		first = 0
+	}
+	p++
+	flags = or2(flags, ext)
+	# UPER: choice index, OER: one tag octet (tags below 63)
+	setResult(umin + ext + bitsFor(n), add(umax, ext + bitsFor(n)), omin + 1, add(omax, 1), flags)
+}
+
+function sequenceOfSize(cname,    lo, hi, ext, sized, umin, umax, omin, omax, flags, lbits, elem)
+{
+	sized = 0
+	if (tok[p] == "(" || tok[p] == "SIZE") {
+		if (tok[p] == "SIZE") {
+			p++
+			sized = constraint()
+		} else {
+			sized = constraint()
+		}
+		lo = C_lo; hi = C_hi; ext = C_ext
+	}
+	if (tok[p] == "OF")
+		p++
+	elem = tok[p]
+	typeSize(cname "_element")
+	flags = R_flags
+	if (!sized) {
+		setResult(8, -1, 2, -1, flags)
+		# ASN1C shares one list type per element type: _SeqOfElement
+		if (elem ~ /[a-z]/ && !(("_SeqOf" elem) in size))
+			size["_SeqOf" elem] = R_flags " " R_umin " " R_umax " " R_omin " " R_omax
+		return
+	}
+	lbits = (lo == hi) ? 0 : bitsFor(hi - lo + 1)
+	umin = ext + lbits + lo * R_umin
+	umax = add(mul(R_umax, hi), ext + lbits)
+	# OER quantity: one length octet and the count in the fewest octets
+	omin = 1 + bytesFor(lo) + lo * R_omin
+	omax = add(mul(R_omax, hi), 1 + bytesFor(hi))
+	setResult(umin, umax, omin, omax, or2(flags, ext))
+}
+
+# parse the type at tok[p] into R_*, record it under cname
+function typeSize(cname,    t, k, f)
+{
+	t = tok[p]
+	if (t == "INTEGER") {
+		p++
+		if (tok[p] == "{") skipBalanced()
+		k = constraint()
+		intSize(k ? C_lo : "", k ? C_hi : "", C_ext)
+	} else if (t == "BOOLEAN") {
+		p++
+		setResult(1, 1, 1, 1, 0)
+	} else if (t == "NULL") {
+		p++
+		setResult(0, 0, 0, 0, 0)
+	} else if (t == "ENUMERATED") {
+		p++
+		enumSize()
+	} else if (t == "BIT" || t == "OCTET") {
+		p += 2
+		if (tok[p] == "{") skipBalanced()
+		if (t == "BIT") stringSize(1, 1)
+		else stringSize(8, 8)
+	} else if (t == "IA5String" || t == "VisibleString" || t == "PrintableString") {
+		p++
+		stringSize(7, 8)
+	} else if (t == "NumericString") {
+		p++
+		stringSize(4, 8)
+	} else if (t == "UTF8String") {
+		p++
+		stringSize(0, 8)
+	} else if (t == "OBJECT") {
+		p += 2
+		setResult(8, -1, 1, -1, 0)
+	} else if (t == "SEQUENCE" || t == "SET") {
+		p++
+		if (tok[p] == "{") sequenceSize(cname)
+		else sequenceOfSize(cname)
+	} else if (t == "CHOICE") {
+		p++
+		choiceSize(cname)
+	} else if (t ~ /\.&Type$/) {
+		p++
+		openType()
+	} else if (t ~ /\.&id$/) {
+		p++
+		f = (t ~ /^MESSAGE-ID/) ? "DSRCmsgID" : (t ~ /^REG-EXT/) ? "RegionId" : "PartII-Id"
+		refSize(f)
+	} else {
+		p++
+		refSize(t)
+		# a subtype of an INTEGER type is sized by its own range
+		if (tok[p] == "(" && tok[p + 1] ~ /^-?[0-9]+$/) {
+			k = constraint()
+			if (k) intSize(C_lo, C_hi, C_ext)
+		}
+	}
+	if (tok[p] == "(")
+		skipBalanced()
+	if (cname != "" && !(cname in size))
+		size[cname] = R_flags " " R_umin " " R_umax " " R_omin " " R_omax
+}
+
+function refSize(asn,    key, saveP, saveMod)
+{
+	key = module SUBSEP asn
+	if (!(key in defStart)) {
+		if (!(asn in gmod)) {
+			setResult(0, -1, 0, -1, 4)
+			return
+		}
+		key = gmod[asn] SUBSEP asn
+	}
+	if (key in memo) {
+		split(memo[key], m, " ")
+		R_flags = m[1]; R_umin = m[2]; R_umax = m[3]; R_omin = m[4]; R_omax = m[5]
+		return
+	}
+	if (key in busy) {
+		setResult(0, -1, 0, -1, 2)
+		return
+	}
+	busy[key] = 1
+	saveP = p
+	saveMod = module
+	split(key, km, SUBSEP)
+	module = km[1]
+	p = defStart[key]
+	typeSize(defCName[key])
+	memo[key] = R_flags " " R_umin " " R_umax " " R_omin " " R_omax
+	module = saveMod
+	p = saveP
+	delete busy[key]
+}
+
+FNR == 1 {
+	if (inBlock) flush()
+	module = FILENAME
+	sub(/.*\//, "", module)
+	sub(/\.h$/, "", module)
+	inBlock = 0
+}
+
+{
+	sub(/\r$/, "")
+}
+
+/^\/\*  [A-Za-z_][A-Za-z0-9_]* +\*\/$/ {
+	banner = $2
+	next
+}
+
+/^\/\*$/ {
+	inBlock = 1
+	block = ""
+	next
+}
+
+inBlock && /^\*\/$/ {
+	inBlock = 0
+	flush()
+	next
+}
+
+inBlock {
+	line = $0
+	sub(/--.*/, "", line)
+	block = block " " line
+}
+
+END {
+	for (i = 1; i <= ndef; i++) {
+		split(order[i], km, SUBSEP)
+		module = km[1]
+		refSize(km[2])
+	}
+	for (c in size)
+		print c, size[c]
+}
@@ -0,0 +1,40 @@
+#ifndef ASN_SPAN_H
+#define ASN_SPAN_H
+
+#if !defined(__cplusplus) || (__cplusplus < 201703L)
+#error "asnSpan.h is C++17"
+#endif
+
+#include <cstddef>
+#include <utility>
+
+namespace hae
+{
+
+/* the part of std::span (C++20) needed by asnSession.h / asnList.h */
+template<typename T>
+class span
+{
+public:
+	constexpr span() noexcept : pData(nullptr), len(0) {}
+	constexpr span(T *p, std::size_t n) noexcept : pData(p), len(n) {}
+	template<std::size_t N>
+	constexpr span(T (&a)[N]) noexcept : pData(a), len(N) {}
+	template<typename C, typename = decltype(std::declval<C &>().data())>
+	constexpr span(C &c) noexcept : pData(c.data()), len(c.size()) {}
+
+	constexpr T *data() const noexcept { return pData; }
+	constexpr std::size_t size() const noexcept { return len; }
+	constexpr bool empty() const noexcept { return 0 == len; }
+	constexpr T *begin() const noexcept { return pData; }
+	constexpr T *end() const noexcept { return pData + len; }
+	constexpr T &operator[](std::size_t i) const noexcept { return pData[i]; }
+
+private:
+	T *pData;
+	std::size_t len;
+};
+
+}
+
+#endif
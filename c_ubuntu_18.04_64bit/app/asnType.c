@@ -0,0 +1,280 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+#include <rtxsrc/rtxError.h>
+#include <rtpersrc/asn1per.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+
+/* MessageTypes of DSRC: DSRCmsgID -> type of the MessageFrame value */
+static const struct{
+	unsigned int messageId;
+	const char *pName;
+} asn_message[] =
+{
+	{ ASN1V_mapData, "MapData" },
+	{ ASN1V_signalPhaseAndTimingMessage, "SPAT" },
+	{ ASN1V_basicSafetyMessage, "BasicSafetyMessage" },
+	{ ASN1V_commonSafetyRequest, "CommonSafetyRequest" },
+	{ ASN1V_emergencyVehicleAlert, "EmergencyVehicleAlert" },
+	{ ASN1V_intersectionCollision, "IntersectionCollision" },
+	{ ASN1V_nmeaCorrections, "NMEAcorrections" },
+	{ ASN1V_probeDataManagement, "ProbeDataManagement" },
+	{ ASN1V_probeVehicleData, "ProbeVehicleData" },
+	{ ASN1V_roadSideAlert, "RoadSideAlert" },
+	{ ASN1V_rtcmCorrections, "RTCMcorrections" },
+	{ ASN1V_signalRequestMessage, "SignalRequestMessage" },
+	{ ASN1V_signalStatusMessage, "SignalStatusMessage" },
+	{ ASN1V_travelerInformation, "TravelerInformation" },
+	{ ASN1V_personalSafetyMessage, "PersonalSafetyMessage" },
+	{ ASN1V_testMessage00, "TestMessage00" },
+	{ ASN1V_testMessage01, "TestMessage01" },
+	{ ASN1V_testMessage02, "TestMessage02" },
+	{ ASN1V_testMessage03, "TestMessage03" },
+	{ ASN1V_testMessage04, "TestMessage04" },
+	{ ASN1V_testMessage05, "TestMessage05" },
+	{ ASN1V_testMessage06, "TestMessage06" },
+	{ ASN1V_testMessage07, "TestMessage07" },
+	{ ASN1V_testMessage08, "TestMessage08" },
+	{ ASN1V_testMessage09, "TestMessage09" },
+	{ ASN1V_testMessage10, "TestMessage10" },
+	{ ASN1V_testMessage11, "TestMessage11" },
+	{ ASN1V_testMessage12, "TestMessage12" },
+	{ ASN1V_testMessage13, "TestMessage13" },
+	{ ASN1V_testMessage14, "TestMessage14" },
+	{ ASN1V_testMessage15, "TestMessage15" },
+};
+
+static int sCompare(const void *pKey, const void *pEntry)
+{
+	return strcmp((const char *)pKey, ((const ASN_TYPE *)pEntry)->pName);
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnType_Find
+ *
+ * Description	: Look up a type of asn_type_table by its C name
+ *				  ("SPAT", "BasicSafetyMessage", "RSA_addGrpD").
+ *
+ * Returns		: table entry, HAE_NULL if there is no such type
+ *
+ *************************************************************/
+const ASN_TYPE *AsnType_Find(const char *pName)
+{
+	return (const ASN_TYPE *)bsearch(pName, asn_type_table, asn_type_cnt, sizeof(ASN_TYPE), sCompare);
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnType_FindMessage
+ *
+ * Description	: Type of the value of a MessageFrame with this
+ *				  messageId.
+ *
+ * Returns		: table entry, HAE_NULL for an unknown messageId
+ *
+ *************************************************************/
+const ASN_TYPE *AsnType_FindMessage(unsigned int messageId)
+{
+	unsigned int i;
+
+	for (i = 0; i < sizeof(asn_message) / sizeof(asn_message[0]); i++)
+	{
+		if (asn_message[i].messageId == messageId)
+		{
+			return AsnType_Find(asn_message[i].pName);
+		}
+	}
+
+	return HAE_NULL;
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnType_PerSize
+ *
+ * Description	: UPER size of one value. Fixed size types answer
+ *				  from the table, the others are encoded into a
+ *				  dynamic buffer of pctxt, which is freed again.
+ *
+ * Parameter	: pctxt - scratch context, its buffer is replaced
+ *				  pValue - value of pType
+ *				  pBits - encoded size in bits
+ *
+ * Returns		: HAE_OK, HAE_ERROR if the value cannot be encoded
+ *
+ *************************************************************/
+int AsnType_PerSize(const ASN_TYPE *pType, OSCTXT *pctxt, void *pValue, size_t *pBits)
+{
+	int stat;
+
+	if (!(pType->sizeFlags & (ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED)) && (pType->perMinBits == pType->perMaxBits))
+	{
+		*pBits = pType->perMinBits;
+		return HAE_OK;
+	}
+
+	pu_setBuffer(pctxt, 0, 0, FALSE);
+	stat = pType->pfPerEnc(pctxt, pValue);
+	*pBits = pe_GetMsgBitCnt(pctxt);
+	rtxMemFreePtr(pctxt, pctxt->buffer.data);
+	pctxt->buffer.data = 0;
+	pctxt->buffer.size = 0;
+
+	if (0 != stat)
+	{
+		rtxErrReset(pctxt);
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnType_OerSize
+ *
+ * Description	: OER size of one value, see AsnType_PerSize.
+ *
+ * Parameter	: pctxt - scratch context, its buffer is replaced
+ *				  pValue - value of pType
+ *				  pBytes - encoded size in bytes
+ *
+ * Returns		: HAE_OK, HAE_ERROR if the value cannot be encoded
+ *
+ *************************************************************/
+int AsnType_OerSize(const ASN_TYPE *pType, OSCTXT *pctxt, void *pValue, size_t *pBytes)
+{
+	int stat;
+
+	if (!(pType->sizeFlags & (ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED)) && (pType->oerMinBytes == pType->oerMaxBytes))
+	{
+		*pBytes = pType->oerMinBytes;
+		return HAE_OK;
+	}
+
+	rtxInitContextBuffer(pctxt, 0, 0);
+	stat = pType->pfOerEnc(pctxt, pValue);
+	*pBytes = rtxCtxtGetMsgLen(pctxt);
+	rtxMemFreePtr(pctxt, pctxt->buffer.data);
+	pctxt->buffer.data = 0;
+	pctxt->buffer.size = 0;
+
+	if (0 != stat)
+	{
+		rtxErrReset(pctxt);
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnType_PerFrameHeader
+ *
+ * Description	: messageId and value octets of a UPER MessageFrame,
+ *				  read from the bits without a decode: extension
+ *				  bit, 15 bit messageId, length determinant of the
+ *				  open type value.
+ *
+ * Parameter	: pFrame, len - the MessageFrame
+ *				  pMessageId - DSRCmsgID
+ *				  pOffset, pLength - the value in pFrame
+ *
+ * Returns		: HAE_OK, HAE_ERROR if it is short or the value is
+ *				  fragmented (16K octets and more)
+ *
+ * Notes		: the extension bit (pFrame[0] & 0x80) is not looked
+ *				  at; set, there are additions after the value
+ *
+ *************************************************************/
+int AsnType_PerFrameHeader(const unsigned char *pFrame, size_t len, unsigned int *pMessageId, size_t *pOffset,
+	size_t *pLength)
+{
+	if (len < 3)
+	{
+		return HAE_ERROR;
+	}
+	*pMessageId = ((pFrame[0] & 0x7f) << 8) | pFrame[1];
+
+	if (0 == (pFrame[2] & 0x80))
+	{
+		*pLength = pFrame[2];
+		*pOffset = 3;
+	}
+	else if ((0x80 == (pFrame[2] & 0xc0)) && (len >= 4))
+	{
+		*pLength = ((pFrame[2] & 0x3f) << 8) | pFrame[3];
+		*pOffset = 4;
+	}
+	else
+	{
+		return HAE_ERROR;
+	}
+
+	return (*pOffset + *pLength <= len) ? HAE_OK : HAE_ERROR;
+}
+
+/*************************************************************
+ *
+ * Function 		: AsnType_DecodeFrame
+ *
+ * Description	: The decode path of decodeSample, captureReplay,
+ *				  pcapDecode and the trafficGen receiver: a UPER
+ *				  MessageFrame, then its value as the type that
+ *				  AsnType_FindMessage gives for the messageId.
+ *
+ * Parameter	: pctxt - initialised context, frame and value stay
+ *				  in its memory until rtFreeContext / rtxMemReset
+ *				  pBuf, len - the MessageFrame
+ *				  pFrame - decoded frame, zeroed first
+ *				  ppType - type of the value, HAE_NULL for an
+ *				  unknown messageId
+ *				  ppValue - value, half filled after a failed
+ *				  decode, HAE_NULL if there is none
+ *
+ * Returns		: 0, the status of the failed asn1PD_* call, or
+ *				  RTERR_NOTSUPP for a messageId without a type
+ *
+ *************************************************************/
+int AsnType_DecodeFrame(OSCTXT *pctxt, const unsigned char *pBuf, size_t len, struct MessageFrame *pFrame,
+	const ASN_TYPE **ppType, void **ppValue)
+{
+	const ASN_TYPE *pType = HAE_NULL;
+	void *pValue = HAE_NULL;
+	int stat;
+
+	memset(pFrame, 0x00, sizeof(MessageFrame));
+	pu_setBuffer(pctxt, (OSOCTET *)pBuf, len, FALSE);
+	stat = asn1PD_MessageFrame(pctxt, pFrame);
+	if (0 == stat)
+	{
+		pType = AsnType_FindMessage(pFrame->messageId);
+		pValue = (HAE_NULL != pType) ? rtxMemAllocZ(pctxt, pType->size) : HAE_NULL;
+		if (HAE_NULL == pValue)
+		{
+			stat = RTERR_NOTSUPP;
+		}
+		else
+		{
+			pu_setBuffer(pctxt, (OSOCTET *)pFrame->value.data, pFrame->value.numocts, FALSE);
+			stat = pType->pfPerDec(pctxt, pValue);
+		}
+	}
+
+	if (HAE_NULL != ppType)
+	{
+		*ppType = pType;
+	}
+	if (HAE_NULL != ppValue)
+	{
+		*ppValue = pValue;
+	}
+
+	return stat;
+}
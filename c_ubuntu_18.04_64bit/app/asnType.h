@@ -0,0 +1,60 @@
+#ifndef ASN_TYPE_H
+#define ASN_TYPE_H
+
+#include <stddef.h>
+#include <rtxsrc/rtxContext.h>
+
+/* test value in memory of pctxt, NULL if it cannot be built */
+typedef void *(*ASN_TEST_FUNC)(OSCTXT *pctxt);
+/* asn1PE_* / asn1PD_* / OEREnc_* / OERDec_* / asn1E_* / asn1D_* behind one
+   prototype, pvalue points at the C type */
+typedef int (*ASN_CODEC_FUNC)(OSCTXT *pctxt, void *pvalue);
+/* asn1PrtToStrm_*, output goes to the print stream of pctxt */
+typedef int (*ASN_PRINT_FUNC)(OSCTXT *pctxt, const char *name, const void *pvalue);
+
+/* sizeFlags */
+#define ASN_SIZE_EXT			0x01	/* extensible, the max holds for values without unknown extensions */
+#define ASN_SIZE_UNBOUNDED		0x02	/* no static max (open type, unsized list or string), max is 0 */
+#define ASN_SIZE_UNKNOWN		0x04	/* a type it refers to has no ASN.1 definition in the headers */
+
+/* One ASN.1 type of DSRC, AddGrpB/C/D, ISO14827-2, ITIS and NTCIP.
+   asn_type_table is generated by genAsnTypeTable.sh and sorted by name.
+   The size bounds come from the ASN.1 text (asnSize.awk) and are
+   informational: no encoder sizes its buffer from them, all MessageFrame
+   value types are ASN_SIZE_UNBOUNDED; benchPerEncode checks the test
+   values against them. AsnType_PerSize / AsnType_OerSize give the exact
+   size of one value. */
+typedef struct{
+	const char *pName;					/* C type name */
+	size_t size;						/* sizeof the C type */
+	ASN_TEST_FUNC pfTest;				/* asn1Test_*, 0 if the library has none */
+	ASN_CODEC_FUNC pfPerEnc;			/* asn1PE_* */
+	ASN_CODEC_FUNC pfPerDec;			/* asn1PD_* */
+	ASN_CODEC_FUNC pfOerEnc;			/* OEREnc_* */
+	ASN_CODEC_FUNC pfOerDec;			/* OERDec_* */
+	ASN_CODEC_FUNC pfBerEnc;			/* asn1E_*, explicit tags, encoded length or < 0 */
+	ASN_CODEC_FUNC pfBerDec;			/* asn1D_*, explicit tags */
+	ASN_PRINT_FUNC pfPrint;				/* asn1PrtToStrm_* */
+	unsigned int sizeFlags;				/* ASN_SIZE_* */
+	unsigned long perMinBits;			/* UPER encoding, bits */
+	unsigned long perMaxBits;
+	unsigned long oerMinBytes;			/* OER encoding, bytes */
+	unsigned long oerMaxBytes;
+} ASN_TYPE;
+
+extern const ASN_TYPE asn_type_table[];	/* asnTypeTable.c */
+extern const unsigned int asn_type_cnt;
+
+const ASN_TYPE *AsnType_Find(const char *pName);
+const ASN_TYPE *AsnType_FindMessage(unsigned int messageId);
+int AsnType_PerSize(const ASN_TYPE *pType, OSCTXT *pctxt, void *pValue, size_t *pBits);
+int AsnType_OerSize(const ASN_TYPE *pType, OSCTXT *pctxt, void *pValue, size_t *pBytes);
+
+int AsnType_PerFrameHeader(const unsigned char *pFrame, size_t len, unsigned int *pMessageId, size_t *pOffset,
+	size_t *pLength);
+
+struct MessageFrame;
+int AsnType_DecodeFrame(OSCTXT *pctxt, const unsigned char *pBuf, size_t len, struct MessageFrame *pFrame,
+	const ASN_TYPE **ppType, void **ppValue);
+
+#endif
@@ -0,0 +1,3145 @@
+/* Generated by genAsnTypeTable.sh, do not edit */
+
+#include <DSRC.h>
+#include <AddGrpB.h>
+#include <AddGrpC.h>
+#include <AddGrpD.h>
+#include <ISO14827-2.h>
+#include <ITIS.h>
+#include <NTCIP.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include "asnType.h"
+
+/* codec wrappers: PE / OEREnc / E / PrtToStrm by pointer or by value, test value by pointer or by value */
+#define ASN_CODEC_P(T) \
+	static int sPerEnc_##T(OSCTXT *pctxt, void *pvalue) { return asn1PE_##T(pctxt, (T *)pvalue); } \
+	static int sPerDec_##T(OSCTXT *pctxt, void *pvalue) { return asn1PD_##T(pctxt, (T *)pvalue); }
+#define ASN_CODEC_V(T) \
+	static int sPerEnc_##T(OSCTXT *pctxt, void *pvalue) { return asn1PE_##T(pctxt, *(T *)pvalue); } \
+	static int sPerDec_##T(OSCTXT *pctxt, void *pvalue) { return asn1PD_##T(pctxt, (T *)pvalue); }
+#define ASN_OER_P(T) \
+	static int sOerEnc_##T(OSCTXT *pctxt, void *pvalue) { return OEREnc_##T(pctxt, (T *)pvalue); } \
+	static int sOerDec_##T(OSCTXT *pctxt, void *pvalue) { return OERDec_##T(pctxt, (T *)pvalue); }
+#define ASN_OER_V(T) \
+	static int sOerEnc_##T(OSCTXT *pctxt, void *pvalue) { return OEREnc_##T(pctxt, *(T *)pvalue); } \
+	static int sOerDec_##T(OSCTXT *pctxt, void *pvalue) { return OERDec_##T(pctxt, (T *)pvalue); }
+#define ASN_BER_P(T) \
+	static int sBerEnc_##T(OSCTXT *pctxt, void *pvalue) { return asn1E_##T(pctxt, (T *)pvalue, ASN1EXPL); } \
+	static int sBerDec_##T(OSCTXT *pctxt, void *pvalue) { return asn1D_##T(pctxt, (T *)pvalue, ASN1EXPL, 0); }
+#define ASN_BER_V(T) \
+	static int sBerEnc_##T(OSCTXT *pctxt, void *pvalue) { return asn1E_##T(pctxt, *(T *)pvalue, ASN1EXPL); } \
+	static int sBerDec_##T(OSCTXT *pctxt, void *pvalue) { return asn1D_##T(pctxt, (T *)pvalue, ASN1EXPL, 0); }
+#define ASN_PRINT_P(T) \
+	static int sPrint_##T(OSCTXT *pctxt, const char *name, const void *pvalue) { return asn1PrtToStrm_##T(pctxt, name, (const T *)pvalue); }
+#define ASN_PRINT_V(T) \
+	static int sPrint_##T(OSCTXT *pctxt, const char *name, const void *pvalue) { return asn1PrtToStrm_##T(pctxt, name, *(const T *)pvalue); }
+#define ASN_TEST_P(T) \
+	static void *sTest_##T(OSCTXT *pctxt) { return asn1Test_##T(pctxt); }
+#define ASN_TEST_V(T) \
+	static void *sTest_##T(OSCTXT *pctxt) { T *p = rtxMemAllocType(pctxt, T); if (0 != p) *p = asn1Test_##T(pctxt); return p; }
+
+ASN_CODEC_P(AccelSteerYawRateConfidence)
+ASN_OER_P(AccelSteerYawRateConfidence)
+ASN_BER_P(AccelSteerYawRateConfidence)
+ASN_PRINT_P(AccelSteerYawRateConfidence)
+ASN_CODEC_V(Acceleration)
+ASN_OER_V(Acceleration)
+ASN_BER_P(Acceleration)
+ASN_PRINT_P(Acceleration)
+ASN_CODEC_V(AccelerationConfidence)
+ASN_OER_V(AccelerationConfidence)
+ASN_BER_P(AccelerationConfidence)
+ASN_PRINT_P(AccelerationConfidence)
+ASN_CODEC_P(AccelerationSet4Way)
+ASN_OER_P(AccelerationSet4Way)
+ASN_BER_P(AccelerationSet4Way)
+ASN_PRINT_P(AccelerationSet4Way)
+ASN_CODEC_P(Accept)
+ASN_OER_P(Accept)
+ASN_BER_P(Accept)
+ASN_PRINT_P(Accept)
+ASN_CODEC_P(Accept_datexAccept_Type)
+ASN_OER_P(Accept_datexAccept_Type)
+ASN_BER_P(Accept_datexAccept_Type)
+ASN_PRINT_P(Accept_datexAccept_Type)
+ASN_CODEC_V(AddGrpB_Angle)
+ASN_OER_V(AddGrpB_Angle)
+ASN_BER_P(AddGrpB_Angle)
+ASN_PRINT_P(AddGrpB_Angle)
+ASN_TEST_P(AddGrpB_Angle)
+ASN_CODEC_V(AddGrpB_Elevation)
+ASN_OER_V(AddGrpB_Elevation)
+ASN_BER_P(AddGrpB_Elevation)
+ASN_PRINT_P(AddGrpB_Elevation)
+ASN_CODEC_V(AddGrpB_MsgCount)
+ASN_OER_V(AddGrpB_MsgCount)
+ASN_BER_P(AddGrpB_MsgCount)
+ASN_PRINT_P(AddGrpB_MsgCount)
+ASN_TEST_P(AddGrpB_MsgCount)
+ASN_CODEC_P(AddGrpB_TimeMark)
+ASN_OER_P(AddGrpB_TimeMark)
+ASN_BER_P(AddGrpB_TimeMark)
+ASN_PRINT_P(AddGrpB_TimeMark)
+ASN_TEST_P(AddGrpB_TimeMark)
+ASN_CODEC_P(AdvisorySpeed)
+ASN_OER_P(AdvisorySpeed)
+ASN_BER_P(AdvisorySpeed)
+ASN_PRINT_P(AdvisorySpeed)
+ASN_CODEC_P(AdvisorySpeedList)
+ASN_OER_P(AdvisorySpeedList)
+ASN_BER_P(AdvisorySpeedList)
+ASN_PRINT_P(AdvisorySpeedList)
+ASN_CODEC_V(AdvisorySpeedType)
+ASN_OER_V(AdvisorySpeedType)
+ASN_BER_P(AdvisorySpeedType)
+ASN_PRINT_P(AdvisorySpeedType)
+ASN_CODEC_P(AdvisorySpeed_regional)
+ASN_OER_P(AdvisorySpeed_regional)
+ASN_BER_P(AdvisorySpeed_regional)
+ASN_PRINT_P(AdvisorySpeed_regional)
+ASN_CODEC_P(AllowedManeuvers)
+ASN_OER_P(AllowedManeuvers)
+ASN_BER_P(AllowedManeuvers)
+ASN_PRINT_P(AllowedManeuvers)
+ASN_CODEC_P(AlternateRequest)
+ASN_OER_P(AlternateRequest)
+ASN_BER_P(AlternateRequest)
+ASN_PRINT_P(AlternateRequest)
+ASN_CODEC_P(Altitude)
+ASN_OER_P(Altitude)
+ASN_BER_P(Altitude)
+ASN_PRINT_P(Altitude)
+ASN_CODEC_V(AltitudeConfidence)
+ASN_OER_V(AltitudeConfidence)
+ASN_BER_P(AltitudeConfidence)
+ASN_PRINT_P(AltitudeConfidence)
+ASN_CODEC_V(AltitudeValue)
+ASN_OER_V(AltitudeValue)
+ASN_BER_P(AltitudeValue)
+ASN_PRINT_P(AltitudeValue)
+ASN_CODEC_V(AmbientAirPressure)
+ASN_OER_V(AmbientAirPressure)
+ASN_BER_P(AmbientAirPressure)
+ASN_PRINT_P(AmbientAirPressure)
+ASN_CODEC_V(AmbientAirTemperature)
+ASN_OER_V(AmbientAirTemperature)
+ASN_BER_P(AmbientAirTemperature)
+ASN_PRINT_P(AmbientAirTemperature)
+ASN_CODEC_V(Angle)
+ASN_OER_V(Angle)
+ASN_BER_P(Angle)
+ASN_PRINT_P(Angle)
+ASN_CODEC_V(AnimalPropelledType)
+ASN_OER_V(AnimalPropelledType)
+ASN_BER_P(AnimalPropelledType)
+ASN_PRINT_P(AnimalPropelledType)
+ASN_CODEC_V(AnimalType)
+ASN_OER_V(AnimalType)
+ASN_BER_P(AnimalType)
+ASN_PRINT_P(AnimalType)
+ASN_CODEC_P(AntennaOffsetSet)
+ASN_OER_P(AntennaOffsetSet)
+ASN_BER_P(AntennaOffsetSet)
+ASN_PRINT_P(AntennaOffsetSet)
+ASN_CODEC_V(AntiLockBrakeStatus)
+ASN_OER_V(AntiLockBrakeStatus)
+ASN_BER_P(AntiLockBrakeStatus)
+ASN_PRINT_P(AntiLockBrakeStatus)
+ASN_CODEC_V(ApproachID)
+ASN_OER_V(ApproachID)
+ASN_BER_P(ApproachID)
+ASN_PRINT_P(ApproachID)
+ASN_CODEC_P(ApproachOrLane)
+ASN_OER_P(ApproachOrLane)
+ASN_BER_P(ApproachOrLane)
+ASN_PRINT_P(ApproachOrLane)
+ASN_CODEC_V(Attachment)
+ASN_OER_V(Attachment)
+ASN_BER_P(Attachment)
+ASN_PRINT_P(Attachment)
+ASN_CODEC_V(AttachmentRadius)
+ASN_OER_V(AttachmentRadius)
+ASN_BER_P(AttachmentRadius)
+ASN_PRINT_P(AttachmentRadius)
+ASN_CODEC_V(AuxiliaryBrakeStatus)
+ASN_OER_V(AuxiliaryBrakeStatus)
+ASN_BER_P(AuxiliaryBrakeStatus)
+ASN_PRINT_P(AuxiliaryBrakeStatus)
+ASN_CODEC_V(AxleLocation)
+ASN_OER_V(AxleLocation)
+ASN_BER_P(AxleLocation)
+ASN_PRINT_P(AxleLocation)
+ASN_CODEC_V(AxleWeight)
+ASN_OER_V(AxleWeight)
+ASN_BER_P(AxleWeight)
+ASN_PRINT_P(AxleWeight)
+ASN_CODEC_P(AxleWeightList)
+ASN_OER_P(AxleWeightList)
+ASN_BER_P(AxleWeightList)
+ASN_PRINT_P(AxleWeightList)
+ASN_CODEC_P(AxleWeightSet)
+ASN_OER_P(AxleWeightSet)
+ASN_BER_P(AxleWeightSet)
+ASN_PRINT_P(AxleWeightSet)
+ASN_CODEC_P(BSMcoreData)
+ASN_OER_P(BSMcoreData)
+ASN_BER_P(BSMcoreData)
+ASN_PRINT_P(BSMcoreData)
+ASN_CODEC_P(BasicSafetyMessage)
+ASN_OER_P(BasicSafetyMessage)
+ASN_BER_P(BasicSafetyMessage)
+ASN_PRINT_P(BasicSafetyMessage)
+ASN_TEST_P(BasicSafetyMessage)
+ASN_CODEC_P(BasicSafetyMessage_partII)
+ASN_OER_P(BasicSafetyMessage_partII)
+ASN_BER_P(BasicSafetyMessage_partII)
+ASN_PRINT_P(BasicSafetyMessage_partII)
+ASN_CODEC_P(BasicSafetyMessage_regional)
+ASN_OER_P(BasicSafetyMessage_regional)
+ASN_BER_P(BasicSafetyMessage_regional)
+ASN_PRINT_P(BasicSafetyMessage_regional)
+ASN_CODEC_V(BasicVehicleClass)
+ASN_OER_V(BasicVehicleClass)
+ASN_BER_P(BasicVehicleClass)
+ASN_PRINT_P(BasicVehicleClass)
+ASN_CODEC_V(BasicVehicleRole)
+ASN_OER_V(BasicVehicleRole)
+ASN_BER_P(BasicVehicleRole)
+ASN_PRINT_P(BasicVehicleRole)
+ASN_CODEC_V(BrakeAppliedPressure)
+ASN_OER_V(BrakeAppliedPressure)
+ASN_BER_P(BrakeAppliedPressure)
+ASN_PRINT_P(BrakeAppliedPressure)
+ASN_CODEC_P(BrakeAppliedStatus)
+ASN_OER_P(BrakeAppliedStatus)
+ASN_BER_P(BrakeAppliedStatus)
+ASN_PRINT_P(BrakeAppliedStatus)
+ASN_CODEC_V(BrakeBoostApplied)
+ASN_OER_V(BrakeBoostApplied)
+ASN_BER_P(BrakeBoostApplied)
+ASN_PRINT_P(BrakeBoostApplied)
+ASN_CODEC_P(BrakeSystemStatus)
+ASN_OER_P(BrakeSystemStatus)
+ASN_BER_P(BrakeSystemStatus)
+ASN_PRINT_P(BrakeSystemStatus)
+ASN_CODEC_V(BumperHeight)
+ASN_OER_V(BumperHeight)
+ASN_BER_P(BumperHeight)
+ASN_PRINT_P(BumperHeight)
+ASN_CODEC_P(BumperHeights)
+ASN_OER_P(BumperHeights)
+ASN_BER_P(BumperHeights)
+ASN_PRINT_P(BumperHeights)
+ASN_CODEC_P(C2CAuthenticatedMessage)
+ASN_OER_P(C2CAuthenticatedMessage)
+ASN_BER_P(C2CAuthenticatedMessage)
+ASN_PRINT_P(C2CAuthenticatedMessage)
+ASN_TEST_P(C2CAuthenticatedMessage)
+ASN_CODEC_P(C2CAuthenticatedMessage_datex_AuthenticationInfo_text)
+ASN_OER_P(C2CAuthenticatedMessage_datex_AuthenticationInfo_text)
+ASN_BER_P(C2CAuthenticatedMessage_datex_AuthenticationInfo_text)
+ASN_PRINT_P(C2CAuthenticatedMessage_datex_AuthenticationInfo_text)
+ASN_CODEC_P(CITSLog)
+ASN_OER_P(CITSLog)
+ASN_BER_P(CITSLog)
+ASN_PRINT_P(CITSLog)
+ASN_CODEC_P(CITSPVD)
+ASN_OER_P(CITSPVD)
+ASN_BER_P(CITSPVD)
+ASN_PRINT_P(CITSPVD)
+ASN_CODEC_P(CITSPVD_worklanes)
+ASN_OER_P(CITSPVD_worklanes)
+ASN_BER_P(CITSPVD_worklanes)
+ASN_PRINT_P(CITSPVD_worklanes)
+ASN_CODEC_P(CITSRSA)
+ASN_OER_P(CITSRSA)
+ASN_BER_P(CITSRSA)
+ASN_PRINT_P(CITSRSA)
+ASN_CODEC_P(CITSRSA_laneset)
+ASN_OER_P(CITSRSA_laneset)
+ASN_BER_P(CITSRSA_laneset)
+ASN_PRINT_P(CITSRSA_laneset)
+ASN_CODEC_V(CargoWeight)
+ASN_OER_V(CargoWeight)
+ASN_BER_P(CargoWeight)
+ASN_PRINT_P(CargoWeight)
+ASN_CODEC_P(Circle)
+ASN_OER_P(Circle)
+ASN_BER_P(Circle)
+ASN_PRINT_P(Circle)
+ASN_CODEC_V(CoarseHeading)
+ASN_OER_V(CoarseHeading)
+ASN_BER_P(CoarseHeading)
+ASN_PRINT_P(CoarseHeading)
+ASN_CODEC_P(CodeWord)
+ASN_OER_P(CodeWord)
+ASN_BER_P(CodeWord)
+ASN_PRINT_P(CodeWord)
+ASN_TEST_P(CodeWord)
+ASN_CODEC_V(CoefficientOfFriction)
+ASN_OER_V(CoefficientOfFriction)
+ASN_BER_P(CoefficientOfFriction)
+ASN_PRINT_P(CoefficientOfFriction)
+ASN_CODEC_P(CommonSafetyRequest)
+ASN_OER_P(CommonSafetyRequest)
+ASN_BER_P(CommonSafetyRequest)
+ASN_PRINT_P(CommonSafetyRequest)
+ASN_TEST_P(CommonSafetyRequest)
+ASN_CODEC_P(CommonSafetyRequest_regional)
+ASN_OER_P(CommonSafetyRequest_regional)
+ASN_BER_P(CommonSafetyRequest_regional)
+ASN_PRINT_P(CommonSafetyRequest_regional)
+ASN_CODEC_P(ComputedLane)
+ASN_OER_P(ComputedLane)
+ASN_BER_P(ComputedLane)
+ASN_PRINT_P(ComputedLane)
+ASN_CODEC_P(ComputedLane_offsetXaxis)
+ASN_OER_P(ComputedLane_offsetXaxis)
+ASN_BER_P(ComputedLane_offsetXaxis)
+ASN_PRINT_P(ComputedLane_offsetXaxis)
+ASN_CODEC_P(ComputedLane_offsetYaxis)
+ASN_OER_P(ComputedLane_offsetYaxis)
+ASN_BER_P(ComputedLane_offsetYaxis)
+ASN_PRINT_P(ComputedLane_offsetYaxis)
+ASN_CODEC_P(ComputedLane_regional)
+ASN_OER_P(ComputedLane_regional)
+ASN_BER_P(ComputedLane_regional)
+ASN_PRINT_P(ComputedLane_regional)
+ASN_CODEC_V(Confidence)
+ASN_OER_V(Confidence)
+ASN_BER_P(Confidence)
+ASN_PRINT_P(Confidence)
+ASN_CODEC_P(ConfidenceSet)
+ASN_OER_P(ConfidenceSet)
+ASN_BER_P(ConfidenceSet)
+ASN_PRINT_P(ConfidenceSet)
+ASN_CODEC_P(ConnectingLane)
+ASN_OER_P(ConnectingLane)
+ASN_BER_P(ConnectingLane)
+ASN_PRINT_P(ConnectingLane)
+ASN_CODEC_P(Connection)
+ASN_OER_P(Connection)
+ASN_BER_P(Connection)
+ASN_PRINT_P(Connection)
+ASN_CODEC_P(ConnectionManeuverAssist)
+ASN_OER_P(ConnectionManeuverAssist)
+ASN_BER_P(ConnectionManeuverAssist)
+ASN_PRINT_P(ConnectionManeuverAssist)
+ASN_CODEC_P(ConnectionManeuverAssist_addGrpC)
+ASN_OER_P(ConnectionManeuverAssist_addGrpC)
+ASN_BER_P(ConnectionManeuverAssist_addGrpC)
+ASN_PRINT_P(ConnectionManeuverAssist_addGrpC)
+ASN_TEST_P(ConnectionManeuverAssist_addGrpC)
+ASN_CODEC_P(ConnectionManeuverAssist_regional)
+ASN_OER_P(ConnectionManeuverAssist_regional)
+ASN_BER_P(ConnectionManeuverAssist_regional)
+ASN_PRINT_P(ConnectionManeuverAssist_regional)
+ASN_CODEC_P(ConnectsToList)
+ASN_OER_P(ConnectsToList)
+ASN_BER_P(ConnectsToList)
+ASN_PRINT_P(ConnectsToList)
+ASN_CODEC_P(Cost)
+ASN_OER_P(Cost)
+ASN_BER_P(Cost)
+ASN_PRINT_P(Cost)
+ASN_CODEC_P(Cost_amount_Currency_code)
+ASN_OER_P(Cost_amount_Currency_code)
+ASN_BER_P(Cost_amount_Currency_code)
+ASN_PRINT_P(Cost_amount_Currency_code)
+ASN_CODEC_V(Count)
+ASN_OER_V(Count)
+ASN_BER_P(Count)
+ASN_PRINT_P(Count)
+ASN_TEST_P(Count)
+ASN_CODEC_P(DDate)
+ASN_OER_P(DDate)
+ASN_BER_P(DDate)
+ASN_PRINT_P(DDate)
+ASN_TEST_P(DDate)
+ASN_CODEC_P(DDateTime)
+ASN_OER_P(DDateTime)
+ASN_BER_P(DDateTime)
+ASN_PRINT_P(DDateTime)
+ASN_CODEC_V(DDay)
+ASN_OER_V(DDay)
+ASN_BER_P(DDay)
+ASN_PRINT_P(DDay)
+ASN_CODEC_P(DFullTime)
+ASN_OER_P(DFullTime)
+ASN_BER_P(DFullTime)
+ASN_PRINT_P(DFullTime)
+ASN_TEST_P(DFullTime)
+ASN_CODEC_V(DHour)
+ASN_OER_V(DHour)
+ASN_BER_P(DHour)
+ASN_PRINT_P(DHour)
+ASN_CODEC_V(DMinute)
+ASN_OER_V(DMinute)
+ASN_BER_P(DMinute)
+ASN_PRINT_P(DMinute)
+ASN_CODEC_V(DMonth)
+ASN_OER_V(DMonth)
+ASN_BER_P(DMonth)
+ASN_PRINT_P(DMonth)
+ASN_CODEC_P(DMonthDay)
+ASN_OER_P(DMonthDay)
+ASN_BER_P(DMonthDay)
+ASN_PRINT_P(DMonthDay)
+ASN_TEST_P(DMonthDay)
+ASN_CODEC_V(DOffset)
+ASN_OER_V(DOffset)
+ASN_BER_P(DOffset)
+ASN_PRINT_P(DOffset)
+ASN_CODEC_V(DSRCmsgID)
+ASN_OER_V(DSRCmsgID)
+ASN_BER_P(DSRCmsgID)
+ASN_PRINT_P(DSRCmsgID)
+ASN_CODEC_V(DSecond)
+ASN_OER_V(DSecond)
+ASN_BER_P(DSecond)
+ASN_PRINT_P(DSecond)
+ASN_CODEC_P(DTime)
+ASN_OER_P(DTime)
+ASN_BER_P(DTime)
+ASN_PRINT_P(DTime)
+ASN_TEST_P(DTime)
+ASN_CODEC_V(DYear)
+ASN_OER_V(DYear)
+ASN_BER_P(DYear)
+ASN_PRINT_P(DYear)
+ASN_CODEC_P(DYearMonth)
+ASN_OER_P(DYearMonth)
+ASN_BER_P(DYearMonth)
+ASN_PRINT_P(DYearMonth)
+ASN_TEST_P(DYearMonth)
+ASN_CODEC_P(DataParameters)
+ASN_OER_P(DataParameters)
+ASN_BER_P(DataParameters)
+ASN_PRINT_P(DataParameters)
+ASN_CODEC_P(DatexDataPacket)
+ASN_OER_P(DatexDataPacket)
+ASN_BER_P(DatexDataPacket)
+ASN_PRINT_P(DatexDataPacket)
+ASN_TEST_P(DatexDataPacket)
+ASN_CODEC_P(DatexDataPacket_datex_Crc_nbr)
+ASN_OER_P(DatexDataPacket_datex_Crc_nbr)
+ASN_BER_P(DatexDataPacket_datex_Crc_nbr)
+ASN_PRINT_P(DatexDataPacket_datex_Crc_nbr)
+ASN_CODEC_V(DatexDataPacket_datex_Version_number)
+ASN_OER_V(DatexDataPacket_datex_Version_number)
+ASN_BER_P(DatexDataPacket_datex_Version_number)
+ASN_PRINT_P(DatexDataPacket_datex_Version_number)
+ASN_CODEC_V(Day)
+ASN_OER_V(Day)
+ASN_BER_P(Day)
+ASN_PRINT_P(Day)
+ASN_CODEC_V(DayOfWeek)
+ASN_OER_V(DayOfWeek)
+ASN_BER_P(DayOfWeek)
+ASN_PRINT_P(DayOfWeek)
+ASN_CODEC_V(DegreesLat)
+ASN_OER_V(DegreesLat)
+ASN_BER_P(DegreesLat)
+ASN_PRINT_P(DegreesLat)
+ASN_CODEC_V(DegreesLong)
+ASN_OER_V(DegreesLong)
+ASN_BER_P(DegreesLong)
+ASN_PRINT_P(DegreesLong)
+ASN_CODEC_V(DeltaAngle)
+ASN_OER_V(DeltaAngle)
+ASN_BER_P(DeltaAngle)
+ASN_PRINT_P(DeltaAngle)
+ASN_CODEC_V(DeltaTime)
+ASN_OER_V(DeltaTime)
+ASN_BER_P(DeltaTime)
+ASN_PRINT_P(DeltaTime)
+ASN_CODEC_V(DescriptiveName)
+ASN_OER_V(DescriptiveName)
+ASN_BER_V(DescriptiveName)
+ASN_PRINT_V(DescriptiveName)
+ASN_CODEC_V(DirectionOfUse)
+ASN_OER_V(DirectionOfUse)
+ASN_BER_P(DirectionOfUse)
+ASN_PRINT_P(DirectionOfUse)
+ASN_CODEC_P(DisabledVehicle)
+ASN_OER_P(DisabledVehicle)
+ASN_BER_P(DisabledVehicle)
+ASN_PRINT_P(DisabledVehicle)
+ASN_CODEC_V(DistanceUnits)
+ASN_OER_V(DistanceUnits)
+ASN_BER_P(DistanceUnits)
+ASN_PRINT_P(DistanceUnits)
+ASN_CODEC_V(DriveAxleLiftAirPressure)
+ASN_OER_V(DriveAxleLiftAirPressure)
+ASN_BER_P(DriveAxleLiftAirPressure)
+ASN_PRINT_P(DriveAxleLiftAirPressure)
+ASN_CODEC_V(DriveAxleLocation)
+ASN_OER_V(DriveAxleLocation)
+ASN_BER_P(DriveAxleLocation)
+ASN_PRINT_P(DriveAxleLocation)
+ASN_CODEC_V(DriveAxleLubePressure)
+ASN_OER_V(DriveAxleLubePressure)
+ASN_BER_P(DriveAxleLubePressure)
+ASN_PRINT_P(DriveAxleLubePressure)
+ASN_CODEC_V(DriveAxleTemperature)
+ASN_OER_V(DriveAxleTemperature)
+ASN_BER_P(DriveAxleTemperature)
+ASN_PRINT_P(DriveAxleTemperature)
+ASN_CODEC_V(DrivenLineOffsetLg)
+ASN_OER_V(DrivenLineOffsetLg)
+ASN_BER_P(DrivenLineOffsetLg)
+ASN_PRINT_P(DrivenLineOffsetLg)
+ASN_CODEC_V(DrivenLineOffsetSm)
+ASN_OER_V(DrivenLineOffsetSm)
+ASN_BER_P(DrivenLineOffsetSm)
+ASN_PRINT_P(DrivenLineOffsetSm)
+ASN_CODEC_V(DrivingWheelAngle)
+ASN_OER_V(DrivingWheelAngle)
+ASN_BER_P(DrivingWheelAngle)
+ASN_PRINT_P(DrivingWheelAngle)
+ASN_CODEC_V(Duration)
+ASN_OER_V(Duration)
+ASN_BER_P(Duration)
+ASN_PRINT_P(Duration)
+ASN_TEST_P(Duration)
+ASN_CODEC_V(Elevation)
+ASN_OER_V(Elevation)
+ASN_BER_P(Elevation)
+ASN_PRINT_P(Elevation)
+ASN_CODEC_V(ElevationConfidence)
+ASN_OER_V(ElevationConfidence)
+ASN_BER_P(ElevationConfidence)
+ASN_PRINT_P(ElevationConfidence)
+ASN_CODEC_P(EmergencyDetails)
+ASN_OER_P(EmergencyDetails)
+ASN_BER_P(EmergencyDetails)
+ASN_PRINT_P(EmergencyDetails)
+ASN_CODEC_P(EmergencyVehicleAlert)
+ASN_OER_P(EmergencyVehicleAlert)
+ASN_BER_P(EmergencyVehicleAlert)
+ASN_PRINT_P(EmergencyVehicleAlert)
+ASN_TEST_P(EmergencyVehicleAlert)
+ASN_CODEC_P(EmergencyVehicleAlert_regional)
+ASN_OER_P(EmergencyVehicleAlert_regional)
+ASN_BER_P(EmergencyVehicleAlert_regional)
+ASN_PRINT_P(EmergencyVehicleAlert_regional)
+ASN_CODEC_V(EmissionType)
+ASN_OER_V(EmissionType)
+ASN_BER_P(EmissionType)
+ASN_PRINT_P(EmissionType)
+ASN_CODEC_P(EnabledLaneList)
+ASN_OER_P(EnabledLaneList)
+ASN_BER_P(EnabledLaneList)
+ASN_PRINT_P(EnabledLaneList)
+ASN_CODEC_V(EssMobileFriction)
+ASN_OER_V(EssMobileFriction)
+ASN_BER_P(EssMobileFriction)
+ASN_PRINT_P(EssMobileFriction)
+ASN_CODEC_V(EssPrecipRate)
+ASN_OER_V(EssPrecipRate)
+ASN_BER_P(EssPrecipRate)
+ASN_PRINT_P(EssPrecipRate)
+ASN_CODEC_V(EssPrecipSituation)
+ASN_OER_V(EssPrecipSituation)
+ASN_BER_P(EssPrecipSituation)
+ASN_PRINT_P(EssPrecipSituation)
+ASN_CODEC_V(EssPrecipYesNo)
+ASN_OER_V(EssPrecipYesNo)
+ASN_BER_P(EssPrecipYesNo)
+ASN_PRINT_P(EssPrecipYesNo)
+ASN_CODEC_V(EssSolarRadiation)
+ASN_OER_V(EssSolarRadiation)
+ASN_BER_P(EssSolarRadiation)
+ASN_PRINT_P(EssSolarRadiation)
+ASN_CODEC_P(EventDescription)
+ASN_OER_P(EventDescription)
+ASN_BER_P(EventDescription)
+ASN_PRINT_P(EventDescription)
+ASN_CODEC_P(EventDescription_description)
+ASN_OER_P(EventDescription_description)
+ASN_BER_P(EventDescription_description)
+ASN_PRINT_P(EventDescription_description)
+ASN_CODEC_P(EventDescription_regional)
+ASN_OER_P(EventDescription_regional)
+ASN_BER_P(EventDescription_regional)
+ASN_PRINT_P(EventDescription_regional)
+ASN_CODEC_P(ExitService)
+ASN_OER_P(ExitService)
+ASN_BER_P(ExitService)
+ASN_PRINT_P(ExitService)
+ASN_CODEC_P(ExitService_element)
+ASN_OER_P(ExitService_element)
+ASN_BER_P(ExitService_element)
+ASN_PRINT_P(ExitService_element)
+ASN_CODEC_P(ExitService_element_item)
+ASN_OER_P(ExitService_element_item)
+ASN_BER_P(ExitService_element_item)
+ASN_PRINT_P(ExitService_element_item)
+ASN_CODEC_V(Extent)
+ASN_OER_V(Extent)
+ASN_BER_P(Extent)
+ASN_PRINT_P(Extent)
+ASN_CODEC_P(ExteriorLights)
+ASN_OER_P(ExteriorLights)
+ASN_BER_P(ExteriorLights)
+ASN_PRINT_P(ExteriorLights)
+ASN_CODEC_V(FrED)
+ASN_OER_V(FrED)
+ASN_BER_P(FrED)
+ASN_PRINT_P(FrED)
+ASN_CODEC_V(FuelType)
+ASN_OER_V(FuelType)
+ASN_BER_P(FuelType)
+ASN_PRINT_P(FuelType)
+ASN_CODEC_P(FullPositionVector)
+ASN_OER_P(FullPositionVector)
+ASN_BER_P(FullPositionVector)
+ASN_PRINT_P(FullPositionVector)
+ASN_CODEC_P(FurtherInfoID)
+ASN_OER_P(FurtherInfoID)
+ASN_BER_P(FurtherInfoID)
+ASN_PRINT_P(FurtherInfoID)
+ASN_CODEC_P(GNSSstatus)
+ASN_OER_P(GNSSstatus)
+ASN_BER_P(GNSSstatus)
+ASN_PRINT_P(GNSSstatus)
+ASN_CODEC_P(GenericLane)
+ASN_OER_P(GenericLane)
+ASN_BER_P(GenericLane)
+ASN_PRINT_P(GenericLane)
+ASN_CODEC_P(GenericLane_regional)
+ASN_OER_P(GenericLane_regional)
+ASN_BER_P(GenericLane_regional)
+ASN_PRINT_P(GenericLane_regional)
+ASN_CODEC_V(GenericLocations)
+ASN_OER_V(GenericLocations)
+ASN_BER_P(GenericLocations)
+ASN_PRINT_P(GenericLocations)
+ASN_CODEC_P(GenericSignage)
+ASN_OER_P(GenericSignage)
+ASN_BER_P(GenericSignage)
+ASN_PRINT_P(GenericSignage)
+ASN_CODEC_P(GenericSignage_element)
+ASN_OER_P(GenericSignage_element)
+ASN_BER_P(GenericSignage_element)
+ASN_PRINT_P(GenericSignage_element)
+ASN_CODEC_P(GenericSignage_element_item)
+ASN_OER_P(GenericSignage_element_item)
+ASN_BER_P(GenericSignage_element_item)
+ASN_PRINT_P(GenericSignage_element_item)
+ASN_CODEC_P(GeographicalPath)
+ASN_OER_P(GeographicalPath)
+ASN_BER_P(GeographicalPath)
+ASN_PRINT_P(GeographicalPath)
+ASN_CODEC_P(GeographicalPath_description)
+ASN_OER_P(GeographicalPath_description)
+ASN_BER_P(GeographicalPath_description)
+ASN_PRINT_P(GeographicalPath_description)
+ASN_CODEC_P(GeographicalPath_regional)
+ASN_OER_P(GeographicalPath_regional)
+ASN_BER_P(GeographicalPath_regional)
+ASN_PRINT_P(GeographicalPath_regional)
+ASN_CODEC_P(GeometricProjection)
+ASN_OER_P(GeometricProjection)
+ASN_BER_P(GeometricProjection)
+ASN_PRINT_P(GeometricProjection)
+ASN_CODEC_P(GeometricProjection_regional)
+ASN_OER_P(GeometricProjection_regional)
+ASN_BER_P(GeometricProjection_regional)
+ASN_PRINT_P(GeometricProjection_regional)
+ASN_CODEC_V(GrossDistance)
+ASN_OER_V(GrossDistance)
+ASN_BER_P(GrossDistance)
+ASN_PRINT_P(GrossDistance)
+ASN_CODEC_V(GrossSpeed)
+ASN_OER_V(GrossSpeed)
+ASN_BER_P(GrossSpeed)
+ASN_PRINT_P(GrossSpeed)
+ASN_CODEC_P(Header)
+ASN_OER_P(Header)
+ASN_BER_P(Header)
+ASN_PRINT_P(Header)
+ASN_CODEC_P(HeaderOptions)
+ASN_OER_P(HeaderOptions)
+ASN_BER_P(HeaderOptions)
+ASN_PRINT_P(HeaderOptions)
+ASN_CODEC_V(Heading)
+ASN_OER_V(Heading)
+ASN_BER_P(Heading)
+ASN_PRINT_P(Heading)
+ASN_CODEC_V(HeadingConfidence)
+ASN_OER_V(HeadingConfidence)
+ASN_BER_P(HeadingConfidence)
+ASN_PRINT_P(HeadingConfidence)
+ASN_CODEC_P(HeadingSlice)
+ASN_OER_P(HeadingSlice)
+ASN_BER_P(HeadingSlice)
+ASN_PRINT_P(HeadingSlice)
+ASN_CODEC_V(Holiday)
+ASN_OER_V(Holiday)
+ASN_BER_P(Holiday)
+ASN_PRINT_P(Holiday)
+ASN_CODEC_V(Hour)
+ASN_OER_V(Hour)
+ASN_BER_P(Hour)
+ASN_PRINT_P(Hour)
+ASN_CODEC_V(HumanPropelledType)
+ASN_OER_V(HumanPropelledType)
+ASN_BER_P(HumanPropelledType)
+ASN_PRINT_P(HumanPropelledType)
+ASN_CODEC_V(ITIScodes)
+ASN_OER_V(ITIScodes)
+ASN_BER_P(ITIScodes)
+ASN_PRINT_P(ITIScodes)
+ASN_CODEC_P(ITIScodesAndText)
+ASN_OER_P(ITIScodesAndText)
+ASN_BER_P(ITIScodesAndText)
+ASN_PRINT_P(ITIScodesAndText)
+ASN_CODEC_P(ITIScodesAndText_element)
+ASN_OER_P(ITIScodesAndText_element)
+ASN_BER_P(ITIScodesAndText_element)
+ASN_PRINT_P(ITIScodesAndText_element)
+ASN_CODEC_P(ITIScodesAndText_element_item)
+ASN_OER_P(ITIScodesAndText_element_item)
+ASN_BER_P(ITIScodesAndText_element_item)
+ASN_PRINT_P(ITIScodesAndText_element_item)
+ASN_CODEC_V(ITIStext)
+ASN_OER_V(ITIStext)
+ASN_BER_V(ITIStext)
+ASN_PRINT_V(ITIStext)
+ASN_CODEC_V(ITIStextPhrase)
+ASN_OER_V(ITIStextPhrase)
+ASN_BER_V(ITIStextPhrase)
+ASN_PRINT_V(ITIStextPhrase)
+ASN_CODEC_V(IncidentResponseEquipment)
+ASN_OER_V(IncidentResponseEquipment)
+ASN_BER_P(IncidentResponseEquipment)
+ASN_PRINT_P(IncidentResponseEquipment)
+ASN_CODEC_P(Initiate)
+ASN_OER_P(Initiate)
+ASN_BER_P(Initiate)
+ASN_PRINT_P(Initiate)
+ASN_CODEC_P(IntersectionAccessPoint)
+ASN_OER_P(IntersectionAccessPoint)
+ASN_BER_P(IntersectionAccessPoint)
+ASN_PRINT_P(IntersectionAccessPoint)
+ASN_CODEC_P(IntersectionCollision)
+ASN_OER_P(IntersectionCollision)
+ASN_BER_P(IntersectionCollision)
+ASN_PRINT_P(IntersectionCollision)
+ASN_TEST_P(IntersectionCollision)
+ASN_CODEC_P(IntersectionCollision_regional)
+ASN_OER_P(IntersectionCollision_regional)
+ASN_BER_P(IntersectionCollision_regional)
+ASN_PRINT_P(IntersectionCollision_regional)
+ASN_CODEC_P(IntersectionGeometry)
+ASN_OER_P(IntersectionGeometry)
+ASN_BER_P(IntersectionGeometry)
+ASN_PRINT_P(IntersectionGeometry)
+ASN_CODEC_P(IntersectionGeometryList)
+ASN_OER_P(IntersectionGeometryList)
+ASN_BER_P(IntersectionGeometryList)
+ASN_PRINT_P(IntersectionGeometryList)
+ASN_CODEC_P(IntersectionGeometry_regional)
+ASN_OER_P(IntersectionGeometry_regional)
+ASN_BER_P(IntersectionGeometry_regional)
+ASN_PRINT_P(IntersectionGeometry_regional)
+ASN_CODEC_V(IntersectionID)
+ASN_OER_V(IntersectionID)
+ASN_BER_P(IntersectionID)
+ASN_PRINT_P(IntersectionID)
+ASN_CODEC_P(IntersectionReferenceID)
+ASN_OER_P(IntersectionReferenceID)
+ASN_BER_P(IntersectionReferenceID)
+ASN_PRINT_P(IntersectionReferenceID)
+ASN_CODEC_P(IntersectionState)
+ASN_OER_P(IntersectionState)
+ASN_BER_P(IntersectionState)
+ASN_PRINT_P(IntersectionState)
+ASN_CODEC_P(IntersectionStateList)
+ASN_OER_P(IntersectionStateList)
+ASN_BER_P(IntersectionStateList)
+ASN_PRINT_P(IntersectionStateList)
+ASN_CODEC_P(IntersectionState_addGrpC)
+ASN_OER_P(IntersectionState_addGrpC)
+ASN_BER_P(IntersectionState_addGrpC)
+ASN_PRINT_P(IntersectionState_addGrpC)
+ASN_TEST_P(IntersectionState_addGrpC)
+ASN_CODEC_P(IntersectionState_regional)
+ASN_OER_P(IntersectionState_regional)
+ASN_BER_P(IntersectionState_regional)
+ASN_PRINT_P(IntersectionState_regional)
+ASN_CODEC_P(IntersectionStatusObject)
+ASN_OER_P(IntersectionStatusObject)
+ASN_BER_P(IntersectionStatusObject)
+ASN_PRINT_P(IntersectionStatusObject)
+ASN_CODEC_V(IsDolly)
+ASN_OER_V(IsDolly)
+ASN_BER_P(IsDolly)
+ASN_PRINT_P(IsDolly)
+ASN_CODEC_V(Iso3833VehicleType)
+ASN_OER_V(Iso3833VehicleType)
+ASN_BER_P(Iso3833VehicleType)
+ASN_PRINT_P(Iso3833VehicleType)
+ASN_CODEC_P(J1939data)
+ASN_OER_P(J1939data)
+ASN_BER_P(J1939data)
+ASN_PRINT_P(J1939data)
+ASN_CODEC_P(LaneAttributes)
+ASN_OER_P(LaneAttributes)
+ASN_BER_P(LaneAttributes)
+ASN_PRINT_P(LaneAttributes)
+ASN_CODEC_P(LaneAttributes_Barrier)
+ASN_OER_P(LaneAttributes_Barrier)
+ASN_BER_P(LaneAttributes_Barrier)
+ASN_PRINT_P(LaneAttributes_Barrier)
+ASN_CODEC_P(LaneAttributes_Bike)
+ASN_OER_P(LaneAttributes_Bike)
+ASN_BER_P(LaneAttributes_Bike)
+ASN_PRINT_P(LaneAttributes_Bike)
+ASN_CODEC_P(LaneAttributes_Crosswalk)
+ASN_OER_P(LaneAttributes_Crosswalk)
+ASN_BER_P(LaneAttributes_Crosswalk)
+ASN_PRINT_P(LaneAttributes_Crosswalk)
+ASN_CODEC_P(LaneAttributes_Parking)
+ASN_OER_P(LaneAttributes_Parking)
+ASN_BER_P(LaneAttributes_Parking)
+ASN_PRINT_P(LaneAttributes_Parking)
+ASN_CODEC_P(LaneAttributes_Sidewalk)
+ASN_OER_P(LaneAttributes_Sidewalk)
+ASN_BER_P(LaneAttributes_Sidewalk)
+ASN_PRINT_P(LaneAttributes_Sidewalk)
+ASN_CODEC_P(LaneAttributes_Striping)
+ASN_OER_P(LaneAttributes_Striping)
+ASN_BER_P(LaneAttributes_Striping)
+ASN_PRINT_P(LaneAttributes_Striping)
+ASN_CODEC_P(LaneAttributes_TrackedVehicle)
+ASN_OER_P(LaneAttributes_TrackedVehicle)
+ASN_BER_P(LaneAttributes_TrackedVehicle)
+ASN_PRINT_P(LaneAttributes_TrackedVehicle)
+ASN_CODEC_P(LaneAttributes_Vehicle)
+ASN_OER_P(LaneAttributes_Vehicle)
+ASN_BER_P(LaneAttributes_Vehicle)
+ASN_PRINT_P(LaneAttributes_Vehicle)
+ASN_CODEC_V(LaneConnectionID)
+ASN_OER_V(LaneConnectionID)
+ASN_BER_P(LaneConnectionID)
+ASN_PRINT_P(LaneConnectionID)
+ASN_CODEC_P(LaneDataAttribute)
+ASN_OER_P(LaneDataAttribute)
+ASN_BER_P(LaneDataAttribute)
+ASN_PRINT_P(LaneDataAttribute)
+ASN_CODEC_P(LaneDataAttributeList)
+ASN_OER_P(LaneDataAttributeList)
+ASN_BER_P(LaneDataAttributeList)
+ASN_PRINT_P(LaneDataAttributeList)
+ASN_CODEC_P(LaneDataAttribute_addGrpB)
+ASN_OER_P(LaneDataAttribute_addGrpB)
+ASN_BER_P(LaneDataAttribute_addGrpB)
+ASN_PRINT_P(LaneDataAttribute_addGrpB)
+ASN_TEST_P(LaneDataAttribute_addGrpB)
+ASN_CODEC_P(LaneDataAttribute_regional)
+ASN_OER_P(LaneDataAttribute_regional)
+ASN_BER_P(LaneDataAttribute_regional)
+ASN_PRINT_P(LaneDataAttribute_regional)
+ASN_CODEC_P(LaneDirection)
+ASN_OER_P(LaneDirection)
+ASN_BER_P(LaneDirection)
+ASN_PRINT_P(LaneDirection)
+ASN_CODEC_V(LaneID)
+ASN_OER_V(LaneID)
+ASN_BER_P(LaneID)
+ASN_PRINT_P(LaneID)
+ASN_CODEC_P(LaneList)
+ASN_OER_P(LaneList)
+ASN_BER_P(LaneList)
+ASN_PRINT_P(LaneList)
+ASN_CODEC_P(LaneSharing)
+ASN_OER_P(LaneSharing)
+ASN_BER_P(LaneSharing)
+ASN_PRINT_P(LaneSharing)
+ASN_CODEC_P(LaneTypeAttributes)
+ASN_OER_P(LaneTypeAttributes)
+ASN_BER_P(LaneTypeAttributes)
+ASN_PRINT_P(LaneTypeAttributes)
+ASN_CODEC_V(LaneWidth)
+ASN_OER_V(LaneWidth)
+ASN_BER_P(LaneWidth)
+ASN_PRINT_P(LaneWidth)
+ASN_CODEC_V(Latitude)
+ASN_OER_V(Latitude)
+ASN_BER_P(Latitude)
+ASN_PRINT_P(Latitude)
+ASN_CODEC_V(LatitudeDMS)
+ASN_OER_V(LatitudeDMS)
+ASN_BER_P(LatitudeDMS)
+ASN_PRINT_P(LatitudeDMS)
+ASN_CODEC_P(LatitudeDMS2)
+ASN_OER_P(LatitudeDMS2)
+ASN_BER_P(LatitudeDMS2)
+ASN_PRINT_P(LatitudeDMS2)
+ASN_CODEC_V(LayerID)
+ASN_OER_V(LayerID)
+ASN_BER_P(LayerID)
+ASN_PRINT_P(LayerID)
+ASN_CODEC_V(LayerType)
+ASN_OER_V(LayerType)
+ASN_BER_P(LayerType)
+ASN_PRINT_P(LayerType)
+ASN_CODEC_V(LightbarInUse)
+ASN_OER_V(LightbarInUse)
+ASN_BER_P(LightbarInUse)
+ASN_PRINT_P(LightbarInUse)
+ASN_CODEC_V(Location_quality)
+ASN_OER_V(Location_quality)
+ASN_BER_P(Location_quality)
+ASN_PRINT_P(Location_quality)
+ASN_TEST_P(Location_quality)
+ASN_CODEC_V(Location_tech)
+ASN_OER_V(Location_tech)
+ASN_BER_P(Location_tech)
+ASN_PRINT_P(Location_tech)
+ASN_TEST_P(Location_tech)
+ASN_CODEC_P(Login)
+ASN_OER_P(Login)
+ASN_BER_P(Login)
+ASN_PRINT_P(Login)
+ASN_CODEC_P(Login_datexLogin_EncodingRules_id)
+ASN_OER_P(Login_datexLogin_EncodingRules_id)
+ASN_BER_P(Login_datexLogin_EncodingRules_id)
+ASN_PRINT_P(Login_datexLogin_EncodingRules_id)
+ASN_CODEC_V(Login_datexLogin_Initiator_cd)
+ASN_OER_V(Login_datexLogin_Initiator_cd)
+ASN_BER_P(Login_datexLogin_Initiator_cd)
+ASN_PRINT_P(Login_datexLogin_Initiator_cd)
+ASN_CODEC_V(Logout)
+ASN_OER_V(Logout)
+ASN_BER_P(Logout)
+ASN_PRINT_P(Logout)
+ASN_CODEC_V(Longitude)
+ASN_OER_V(Longitude)
+ASN_BER_P(Longitude)
+ASN_PRINT_P(Longitude)
+ASN_CODEC_V(LongitudeDMS)
+ASN_OER_V(LongitudeDMS)
+ASN_BER_P(LongitudeDMS)
+ASN_PRINT_P(LongitudeDMS)
+ASN_CODEC_P(LongitudeDMS2)
+ASN_OER_P(LongitudeDMS2)
+ASN_BER_P(LongitudeDMS2)
+ASN_PRINT_P(LongitudeDMS2)
+ASN_CODEC_V(MUTCDCode)
+ASN_OER_V(MUTCDCode)
+ASN_BER_P(MUTCDCode)
+ASN_PRINT_P(MUTCDCode)
+ASN_CODEC_P(ManeuverAssistList)
+ASN_OER_P(ManeuverAssistList)
+ASN_BER_P(ManeuverAssistList)
+ASN_PRINT_P(ManeuverAssistList)
+ASN_CODEC_P(MapData)
+ASN_OER_P(MapData)
+ASN_BER_P(MapData)
+ASN_PRINT_P(MapData)
+ASN_TEST_P(MapData)
+ASN_CODEC_P(MapData_addGrpC)
+ASN_OER_P(MapData_addGrpC)
+ASN_BER_P(MapData_addGrpC)
+ASN_PRINT_P(MapData_addGrpC)
+ASN_TEST_P(MapData_addGrpC)
+ASN_CODEC_P(MapData_regional)
+ASN_OER_P(MapData_regional)
+ASN_BER_P(MapData_regional)
+ASN_PRINT_P(MapData_regional)
+ASN_CODEC_V(MaxTimetoChange)
+ASN_OER_V(MaxTimetoChange)
+ASN_BER_P(MaxTimetoChange)
+ASN_PRINT_P(MaxTimetoChange)
+ASN_CODEC_V(MergeDivergeNodeAngle)
+ASN_OER_V(MergeDivergeNodeAngle)
+ASN_BER_P(MergeDivergeNodeAngle)
+ASN_PRINT_P(MergeDivergeNodeAngle)
+ASN_CODEC_P(MessageBLOB)
+ASN_OER_P(MessageBLOB)
+ASN_BER_P(MessageBLOB)
+ASN_PRINT_P(MessageBLOB)
+ASN_TEST_P(MessageBLOB)
+ASN_CODEC_P(MessageFrame)
+ASN_OER_P(MessageFrame)
+ASN_BER_P(MessageFrame)
+ASN_PRINT_P(MessageFrame)
+ASN_CODEC_V(MinTimetoChange)
+ASN_OER_V(MinTimetoChange)
+ASN_BER_P(MinTimetoChange)
+ASN_PRINT_P(MinTimetoChange)
+ASN_CODEC_V(Minute)
+ASN_OER_V(Minute)
+ASN_BER_P(Minute)
+ASN_PRINT_P(Minute)
+ASN_CODEC_V(MinuteOfTheYear)
+ASN_OER_V(MinuteOfTheYear)
+ASN_BER_P(MinuteOfTheYear)
+ASN_PRINT_P(MinuteOfTheYear)
+ASN_CODEC_V(MinutesAngle)
+ASN_OER_V(MinutesAngle)
+ASN_BER_P(MinutesAngle)
+ASN_PRINT_P(MinutesAngle)
+ASN_CODEC_V(MinutesDuration)
+ASN_OER_V(MinutesDuration)
+ASN_BER_P(MinutesDuration)
+ASN_PRINT_P(MinutesDuration)
+ASN_CODEC_V(Month)
+ASN_OER_V(Month)
+ASN_BER_P(Month)
+ASN_PRINT_P(Month)
+ASN_CODEC_V(MotorizedPropelledType)
+ASN_OER_V(MotorizedPropelledType)
+ASN_BER_P(MotorizedPropelledType)
+ASN_PRINT_P(MotorizedPropelledType)
+ASN_CODEC_P(MovementEvent)
+ASN_OER_P(MovementEvent)
+ASN_BER_P(MovementEvent)
+ASN_PRINT_P(MovementEvent)
+ASN_CODEC_P(MovementEventList)
+ASN_OER_P(MovementEventList)
+ASN_BER_P(MovementEventList)
+ASN_PRINT_P(MovementEventList)
+ASN_CODEC_P(MovementEvent_addGrpB)
+ASN_OER_P(MovementEvent_addGrpB)
+ASN_BER_P(MovementEvent_addGrpB)
+ASN_PRINT_P(MovementEvent_addGrpB)
+ASN_TEST_P(MovementEvent_addGrpB)
+ASN_CODEC_P(MovementEvent_regional)
+ASN_OER_P(MovementEvent_regional)
+ASN_BER_P(MovementEvent_regional)
+ASN_PRINT_P(MovementEvent_regional)
+ASN_CODEC_P(MovementList)
+ASN_OER_P(MovementList)
+ASN_BER_P(MovementList)
+ASN_PRINT_P(MovementList)
+ASN_CODEC_V(MovementPhaseState)
+ASN_OER_V(MovementPhaseState)
+ASN_BER_P(MovementPhaseState)
+ASN_PRINT_P(MovementPhaseState)
+ASN_CODEC_P(MovementState)
+ASN_OER_P(MovementState)
+ASN_BER_P(MovementState)
+ASN_PRINT_P(MovementState)
+ASN_CODEC_P(MovementState_regional)
+ASN_OER_P(MovementState_regional)
+ASN_BER_P(MovementState_regional)
+ASN_PRINT_P(MovementState_regional)
+ASN_CODEC_P(MsgCRC)
+ASN_OER_P(MsgCRC)
+ASN_BER_P(MsgCRC)
+ASN_PRINT_P(MsgCRC)
+ASN_CODEC_V(MsgCount)
+ASN_OER_V(MsgCount)
+ASN_BER_P(MsgCount)
+ASN_PRINT_P(MsgCount)
+ASN_CODEC_V(MultiVehicleResponse)
+ASN_OER_V(MultiVehicleResponse)
+ASN_BER_P(MultiVehicleResponse)
+ASN_PRINT_P(MultiVehicleResponse)
+ASN_CODEC_V(NMEA_MsgType)
+ASN_OER_V(NMEA_MsgType)
+ASN_BER_P(NMEA_MsgType)
+ASN_PRINT_P(NMEA_MsgType)
+ASN_CODEC_P(NMEA_Payload)
+ASN_OER_P(NMEA_Payload)
+ASN_BER_P(NMEA_Payload)
+ASN_PRINT_P(NMEA_Payload)
+ASN_CODEC_V(NMEA_Revision)
+ASN_OER_V(NMEA_Revision)
+ASN_BER_P(NMEA_Revision)
+ASN_PRINT_P(NMEA_Revision)
+ASN_CODEC_P(NMEAcorrections)
+ASN_OER_P(NMEAcorrections)
+ASN_BER_P(NMEAcorrections)
+ASN_PRINT_P(NMEAcorrections)
+ASN_TEST_P(NMEAcorrections)
+ASN_CODEC_P(NMEAcorrections_regional)
+ASN_OER_P(NMEAcorrections_regional)
+ASN_BER_P(NMEAcorrections_regional)
+ASN_PRINT_P(NMEAcorrections_regional)
+ASN_CODEC_V(NodeAttributeLL)
+ASN_OER_V(NodeAttributeLL)
+ASN_BER_P(NodeAttributeLL)
+ASN_PRINT_P(NodeAttributeLL)
+ASN_CODEC_P(NodeAttributeLLList)
+ASN_OER_P(NodeAttributeLLList)
+ASN_BER_P(NodeAttributeLLList)
+ASN_PRINT_P(NodeAttributeLLList)
+ASN_CODEC_P(NodeAttributeSetLL)
+ASN_OER_P(NodeAttributeSetLL)
+ASN_BER_P(NodeAttributeSetLL)
+ASN_PRINT_P(NodeAttributeSetLL)
+ASN_CODEC_P(NodeAttributeSetLL_regional)
+ASN_OER_P(NodeAttributeSetLL_regional)
+ASN_BER_P(NodeAttributeSetLL_regional)
+ASN_PRINT_P(NodeAttributeSetLL_regional)
+ASN_CODEC_P(NodeAttributeSetXY)
+ASN_OER_P(NodeAttributeSetXY)
+ASN_BER_P(NodeAttributeSetXY)
+ASN_PRINT_P(NodeAttributeSetXY)
+ASN_CODEC_P(NodeAttributeSetXY_regional)
+ASN_OER_P(NodeAttributeSetXY_regional)
+ASN_BER_P(NodeAttributeSetXY_regional)
+ASN_PRINT_P(NodeAttributeSetXY_regional)
+ASN_CODEC_V(NodeAttributeXY)
+ASN_OER_V(NodeAttributeXY)
+ASN_BER_P(NodeAttributeXY)
+ASN_PRINT_P(NodeAttributeXY)
+ASN_CODEC_P(NodeAttributeXYList)
+ASN_OER_P(NodeAttributeXYList)
+ASN_BER_P(NodeAttributeXYList)
+ASN_PRINT_P(NodeAttributeXYList)
+ASN_CODEC_P(NodeLL)
+ASN_OER_P(NodeLL)
+ASN_BER_P(NodeLL)
+ASN_PRINT_P(NodeLL)
+ASN_CODEC_P(NodeListLL)
+ASN_OER_P(NodeListLL)
+ASN_BER_P(NodeListLL)
+ASN_PRINT_P(NodeListLL)
+ASN_CODEC_P(NodeListXY)
+ASN_OER_P(NodeListXY)
+ASN_BER_P(NodeListXY)
+ASN_PRINT_P(NodeListXY)
+ASN_CODEC_P(NodeOffsetPointLL)
+ASN_OER_P(NodeOffsetPointLL)
+ASN_BER_P(NodeOffsetPointLL)
+ASN_PRINT_P(NodeOffsetPointLL)
+ASN_CODEC_P(NodeOffsetPointXY)
+ASN_OER_P(NodeOffsetPointXY)
+ASN_BER_P(NodeOffsetPointXY)
+ASN_PRINT_P(NodeOffsetPointXY)
+ASN_CODEC_P(NodeOffsetPointXY_addGrpB)
+ASN_OER_P(NodeOffsetPointXY_addGrpB)
+ASN_BER_P(NodeOffsetPointXY_addGrpB)
+ASN_PRINT_P(NodeOffsetPointXY_addGrpB)
+ASN_TEST_P(NodeOffsetPointXY_addGrpB)
+ASN_CODEC_P(NodeSetLL)
+ASN_OER_P(NodeSetLL)
+ASN_BER_P(NodeSetLL)
+ASN_PRINT_P(NodeSetLL)
+ASN_CODEC_P(NodeSetXY)
+ASN_OER_P(NodeSetXY)
+ASN_BER_P(NodeSetXY)
+ASN_PRINT_P(NodeSetXY)
+ASN_CODEC_P(NodeXY)
+ASN_OER_P(NodeXY)
+ASN_BER_P(NodeXY)
+ASN_PRINT_P(NodeXY)
+ASN_CODEC_P(Node_LL_24B)
+ASN_OER_P(Node_LL_24B)
+ASN_BER_P(Node_LL_24B)
+ASN_PRINT_P(Node_LL_24B)
+ASN_CODEC_P(Node_LL_28B)
+ASN_OER_P(Node_LL_28B)
+ASN_BER_P(Node_LL_28B)
+ASN_PRINT_P(Node_LL_28B)
+ASN_CODEC_P(Node_LL_32B)
+ASN_OER_P(Node_LL_32B)
+ASN_BER_P(Node_LL_32B)
+ASN_PRINT_P(Node_LL_32B)
+ASN_CODEC_P(Node_LL_36B)
+ASN_OER_P(Node_LL_36B)
+ASN_BER_P(Node_LL_36B)
+ASN_PRINT_P(Node_LL_36B)
+ASN_CODEC_P(Node_LL_44B)
+ASN_OER_P(Node_LL_44B)
+ASN_BER_P(Node_LL_44B)
+ASN_PRINT_P(Node_LL_44B)
+ASN_CODEC_P(Node_LL_48B)
+ASN_OER_P(Node_LL_48B)
+ASN_BER_P(Node_LL_48B)
+ASN_PRINT_P(Node_LL_48B)
+ASN_CODEC_P(Node_LLdms_48b)
+ASN_OER_P(Node_LLdms_48b)
+ASN_BER_P(Node_LLdms_48b)
+ASN_PRINT_P(Node_LLdms_48b)
+ASN_CODEC_P(Node_LLdms_80b)
+ASN_OER_P(Node_LLdms_80b)
+ASN_BER_P(Node_LLdms_80b)
+ASN_PRINT_P(Node_LLdms_80b)
+ASN_CODEC_P(Node_LLmD_64b)
+ASN_OER_P(Node_LLmD_64b)
+ASN_BER_P(Node_LLmD_64b)
+ASN_PRINT_P(Node_LLmD_64b)
+ASN_CODEC_P(Node_XY_20b)
+ASN_OER_P(Node_XY_20b)
+ASN_BER_P(Node_XY_20b)
+ASN_PRINT_P(Node_XY_20b)
+ASN_CODEC_P(Node_XY_22b)
+ASN_OER_P(Node_XY_22b)
+ASN_BER_P(Node_XY_22b)
+ASN_PRINT_P(Node_XY_22b)
+ASN_CODEC_P(Node_XY_24b)
+ASN_OER_P(Node_XY_24b)
+ASN_BER_P(Node_XY_24b)
+ASN_PRINT_P(Node_XY_24b)
+ASN_CODEC_P(Node_XY_26b)
+ASN_OER_P(Node_XY_26b)
+ASN_BER_P(Node_XY_26b)
+ASN_PRINT_P(Node_XY_26b)
+ASN_CODEC_P(Node_XY_28b)
+ASN_OER_P(Node_XY_28b)
+ASN_BER_P(Node_XY_28b)
+ASN_PRINT_P(Node_XY_28b)
+ASN_CODEC_P(Node_XY_32b)
+ASN_OER_P(Node_XY_32b)
+ASN_BER_P(Node_XY_32b)
+ASN_PRINT_P(Node_XY_32b)
+ASN_CODEC_V(NumberOfParticipantsInCluster)
+ASN_OER_V(NumberOfParticipantsInCluster)
+ASN_BER_P(NumberOfParticipantsInCluster)
+ASN_PRINT_P(NumberOfParticipantsInCluster)
+ASN_CODEC_V(ObjectCount)
+ASN_OER_V(ObjectCount)
+ASN_BER_P(ObjectCount)
+ASN_PRINT_P(ObjectCount)
+ASN_CODEC_P(ObstacleDetection)
+ASN_OER_P(ObstacleDetection)
+ASN_BER_P(ObstacleDetection)
+ASN_PRINT_P(ObstacleDetection)
+ASN_CODEC_V(ObstacleDirection)
+ASN_OER_V(ObstacleDirection)
+ASN_BER_P(ObstacleDirection)
+ASN_PRINT_P(ObstacleDirection)
+ASN_CODEC_V(ObstacleDistance)
+ASN_OER_V(ObstacleDistance)
+ASN_BER_P(ObstacleDistance)
+ASN_PRINT_P(ObstacleDistance)
+ASN_CODEC_V(OffsetLL_B12)
+ASN_OER_V(OffsetLL_B12)
+ASN_BER_P(OffsetLL_B12)
+ASN_PRINT_P(OffsetLL_B12)
+ASN_CODEC_V(OffsetLL_B14)
+ASN_OER_V(OffsetLL_B14)
+ASN_BER_P(OffsetLL_B14)
+ASN_PRINT_P(OffsetLL_B14)
+ASN_CODEC_V(OffsetLL_B16)
+ASN_OER_V(OffsetLL_B16)
+ASN_BER_P(OffsetLL_B16)
+ASN_PRINT_P(OffsetLL_B16)
+ASN_CODEC_V(OffsetLL_B18)
+ASN_OER_V(OffsetLL_B18)
+ASN_BER_P(OffsetLL_B18)
+ASN_PRINT_P(OffsetLL_B18)
+ASN_CODEC_V(OffsetLL_B22)
+ASN_OER_V(OffsetLL_B22)
+ASN_BER_P(OffsetLL_B22)
+ASN_PRINT_P(OffsetLL_B22)
+ASN_CODEC_V(OffsetLL_B24)
+ASN_OER_V(OffsetLL_B24)
+ASN_BER_P(OffsetLL_B24)
+ASN_PRINT_P(OffsetLL_B24)
+ASN_CODEC_P(OffsetSystem)
+ASN_OER_P(OffsetSystem)
+ASN_BER_P(OffsetSystem)
+ASN_PRINT_P(OffsetSystem)
+ASN_CODEC_P(OffsetSystem_offset)
+ASN_OER_P(OffsetSystem_offset)
+ASN_BER_P(OffsetSystem_offset)
+ASN_PRINT_P(OffsetSystem_offset)
+ASN_CODEC_V(Offset_B09)
+ASN_OER_V(Offset_B09)
+ASN_BER_P(Offset_B09)
+ASN_PRINT_P(Offset_B09)
+ASN_CODEC_V(Offset_B10)
+ASN_OER_V(Offset_B10)
+ASN_BER_P(Offset_B10)
+ASN_PRINT_P(Offset_B10)
+ASN_CODEC_V(Offset_B11)
+ASN_OER_V(Offset_B11)
+ASN_BER_P(Offset_B11)
+ASN_PRINT_P(Offset_B11)
+ASN_CODEC_V(Offset_B12)
+ASN_OER_V(Offset_B12)
+ASN_BER_P(Offset_B12)
+ASN_PRINT_P(Offset_B12)
+ASN_CODEC_V(Offset_B13)
+ASN_OER_V(Offset_B13)
+ASN_BER_P(Offset_B13)
+ASN_PRINT_P(Offset_B13)
+ASN_CODEC_V(Offset_B14)
+ASN_OER_V(Offset_B14)
+ASN_BER_P(Offset_B14)
+ASN_PRINT_P(Offset_B14)
+ASN_CODEC_V(Offset_B16)
+ASN_OER_V(Offset_B16)
+ASN_BER_P(Offset_B16)
+ASN_PRINT_P(Offset_B16)
+ASN_CODEC_P(OverlayLaneList)
+ASN_OER_P(OverlayLaneList)
+ASN_BER_P(OverlayLaneList)
+ASN_PRINT_P(OverlayLaneList)
+ASN_CODEC_P(PDUs)
+ASN_OER_P(PDUs)
+ASN_BER_P(PDUs)
+ASN_PRINT_P(PDUs)
+ASN_CODEC_P(PVD_addGrpD)
+ASN_OER_P(PVD_addGrpD)
+ASN_BER_P(PVD_addGrpD)
+ASN_PRINT_P(PVD_addGrpD)
+ASN_TEST_P(PVD_addGrpD)
+ASN_CODEC_P(PVD_addGrpD_cits)
+ASN_OER_P(PVD_addGrpD_cits)
+ASN_BER_P(PVD_addGrpD_cits)
+ASN_PRINT_P(PVD_addGrpD_cits)
+ASN_CODEC_V(PartII_Id)
+ASN_OER_V(PartII_Id)
+ASN_BER_P(PartII_Id)
+ASN_PRINT_P(PartII_Id)
+ASN_CODEC_P(PartIIcontent)
+ASN_OER_P(PartIIcontent)
+ASN_BER_P(PartIIcontent)
+ASN_PRINT_P(PartIIcontent)
+ASN_CODEC_P(PathHistory)
+ASN_OER_P(PathHistory)
+ASN_BER_P(PathHistory)
+ASN_PRINT_P(PathHistory)
+ASN_CODEC_P(PathHistoryPoint)
+ASN_OER_P(PathHistoryPoint)
+ASN_BER_P(PathHistoryPoint)
+ASN_PRINT_P(PathHistoryPoint)
+ASN_CODEC_P(PathHistoryPointList)
+ASN_OER_P(PathHistoryPointList)
+ASN_BER_P(PathHistoryPointList)
+ASN_PRINT_P(PathHistoryPointList)
+ASN_CODEC_P(PathPrediction)
+ASN_OER_P(PathPrediction)
+ASN_BER_P(PathPrediction)
+ASN_PRINT_P(PathPrediction)
+ASN_CODEC_P(PayloadData)
+ASN_OER_P(PayloadData)
+ASN_BER_P(PayloadData)
+ASN_PRINT_P(PayloadData)
+ASN_TEST_P(PayloadData)
+ASN_CODEC_V(PedestrianBicycleDetect)
+ASN_OER_V(PedestrianBicycleDetect)
+ASN_BER_P(PedestrianBicycleDetect)
+ASN_PRINT_P(PedestrianBicycleDetect)
+ASN_CODEC_P(PersonalAssistive)
+ASN_OER_P(PersonalAssistive)
+ASN_BER_P(PersonalAssistive)
+ASN_PRINT_P(PersonalAssistive)
+ASN_CODEC_V(PersonalClusterRadius)
+ASN_OER_V(PersonalClusterRadius)
+ASN_BER_P(PersonalClusterRadius)
+ASN_PRINT_P(PersonalClusterRadius)
+ASN_CODEC_V(PersonalCrossingInProgress)
+ASN_OER_V(PersonalCrossingInProgress)
+ASN_BER_P(PersonalCrossingInProgress)
+ASN_PRINT_P(PersonalCrossingInProgress)
+ASN_CODEC_V(PersonalCrossingRequest)
+ASN_OER_V(PersonalCrossingRequest)
+ASN_BER_P(PersonalCrossingRequest)
+ASN_PRINT_P(PersonalCrossingRequest)
+ASN_CODEC_P(PersonalDeviceUsageState)
+ASN_OER_P(PersonalDeviceUsageState)
+ASN_BER_P(PersonalDeviceUsageState)
+ASN_PRINT_P(PersonalDeviceUsageState)
+ASN_CODEC_V(PersonalDeviceUserType)
+ASN_OER_V(PersonalDeviceUserType)
+ASN_BER_P(PersonalDeviceUserType)
+ASN_PRINT_P(PersonalDeviceUserType)
+ASN_CODEC_P(PersonalSafetyMessage)
+ASN_OER_P(PersonalSafetyMessage)
+ASN_BER_P(PersonalSafetyMessage)
+ASN_PRINT_P(PersonalSafetyMessage)
+ASN_TEST_P(PersonalSafetyMessage)
+ASN_CODEC_P(PersonalSafetyMessage_regional)
+ASN_OER_P(PersonalSafetyMessage_regional)
+ASN_BER_P(PersonalSafetyMessage_regional)
+ASN_PRINT_P(PersonalSafetyMessage_regional)
+ASN_CODEC_P(PivotPointDescription)
+ASN_OER_P(PivotPointDescription)
+ASN_BER_P(PivotPointDescription)
+ASN_PRINT_P(PivotPointDescription)
+ASN_CODEC_V(PivotingAllowed)
+ASN_OER_V(PivotingAllowed)
+ASN_BER_P(PivotingAllowed)
+ASN_PRINT_P(PivotingAllowed)
+ASN_CODEC_P(Position3D)
+ASN_OER_P(Position3D)
+ASN_BER_P(Position3D)
+ASN_PRINT_P(Position3D)
+ASN_CODEC_P(Position3D_addGrpB)
+ASN_OER_P(Position3D_addGrpB)
+ASN_BER_P(Position3D_addGrpB)
+ASN_PRINT_P(Position3D_addGrpB)
+ASN_TEST_P(Position3D_addGrpB)
+ASN_CODEC_P(Position3D_addGrpC)
+ASN_OER_P(Position3D_addGrpC)
+ASN_BER_P(Position3D_addGrpC)
+ASN_PRINT_P(Position3D_addGrpC)
+ASN_TEST_P(Position3D_addGrpC)
+ASN_CODEC_P(Position3D_regional)
+ASN_OER_P(Position3D_regional)
+ASN_BER_P(Position3D_regional)
+ASN_PRINT_P(Position3D_regional)
+ASN_CODEC_V(PositionConfidence)
+ASN_OER_V(PositionConfidence)
+ASN_BER_P(PositionConfidence)
+ASN_PRINT_P(PositionConfidence)
+ASN_CODEC_P(PositionConfidenceSet)
+ASN_OER_P(PositionConfidenceSet)
+ASN_BER_P(PositionConfidenceSet)
+ASN_PRINT_P(PositionConfidenceSet)
+ASN_CODEC_P(PositionalAccuracy)
+ASN_OER_P(PositionalAccuracy)
+ASN_BER_P(PositionalAccuracy)
+ASN_PRINT_P(PositionalAccuracy)
+ASN_CODEC_P(PreemptPriorityList)
+ASN_OER_P(PreemptPriorityList)
+ASN_BER_P(PreemptPriorityList)
+ASN_PRINT_P(PreemptPriorityList)
+ASN_CODEC_P(PrioritizationResponse)
+ASN_OER_P(PrioritizationResponse)
+ASN_BER_P(PrioritizationResponse)
+ASN_PRINT_P(PrioritizationResponse)
+ASN_CODEC_P(PrioritizationResponseList)
+ASN_OER_P(PrioritizationResponseList)
+ASN_BER_P(PrioritizationResponseList)
+ASN_PRINT_P(PrioritizationResponseList)
+ASN_CODEC_V(PrioritizationResponseStatus)
+ASN_OER_V(PrioritizationResponseStatus)
+ASN_BER_P(PrioritizationResponseStatus)
+ASN_PRINT_P(PrioritizationResponseStatus)
+ASN_CODEC_P(Priority)
+ASN_OER_P(Priority)
+ASN_BER_P(Priority)
+ASN_PRINT_P(Priority)
+ASN_CODEC_V(PriorityRequestType)
+ASN_OER_V(PriorityRequestType)
+ASN_BER_P(PriorityRequestType)
+ASN_PRINT_P(PriorityRequestType)
+ASN_CODEC_P(PrivilegedEventFlags)
+ASN_OER_P(PrivilegedEventFlags)
+ASN_BER_P(PrivilegedEventFlags)
+ASN_PRINT_P(PrivilegedEventFlags)
+ASN_CODEC_P(PrivilegedEvents)
+ASN_OER_P(PrivilegedEvents)
+ASN_BER_P(PrivilegedEvents)
+ASN_PRINT_P(PrivilegedEvents)
+ASN_CODEC_P(ProbeDataManagement)
+ASN_OER_P(ProbeDataManagement)
+ASN_BER_P(ProbeDataManagement)
+ASN_PRINT_P(ProbeDataManagement)
+ASN_TEST_P(ProbeDataManagement)
+ASN_CODEC_P(ProbeDataManagement_regional)
+ASN_OER_P(ProbeDataManagement_regional)
+ASN_BER_P(ProbeDataManagement_regional)
+ASN_PRINT_P(ProbeDataManagement_regional)
+ASN_CODEC_P(ProbeDataManagement_snapshot)
+ASN_OER_P(ProbeDataManagement_snapshot)
+ASN_BER_P(ProbeDataManagement_snapshot)
+ASN_PRINT_P(ProbeDataManagement_snapshot)
+ASN_CODEC_P(ProbeDataManagement_term)
+ASN_OER_P(ProbeDataManagement_term)
+ASN_BER_P(ProbeDataManagement_term)
+ASN_PRINT_P(ProbeDataManagement_term)
+ASN_CODEC_V(ProbeSegmentNumber)
+ASN_OER_V(ProbeSegmentNumber)
+ASN_BER_P(ProbeSegmentNumber)
+ASN_PRINT_P(ProbeSegmentNumber)
+ASN_CODEC_P(ProbeVehicleData)
+ASN_OER_P(ProbeVehicleData)
+ASN_BER_P(ProbeVehicleData)
+ASN_PRINT_P(ProbeVehicleData)
+ASN_TEST_P(ProbeVehicleData)
+ASN_CODEC_P(ProbeVehicleData_regional)
+ASN_OER_P(ProbeVehicleData_regional)
+ASN_BER_P(ProbeVehicleData_regional)
+ASN_PRINT_P(ProbeVehicleData_regional)
+ASN_CODEC_P(ProbeVehicleData_snapshots)
+ASN_OER_P(ProbeVehicleData_snapshots)
+ASN_BER_P(ProbeVehicleData_snapshots)
+ASN_PRINT_P(ProbeVehicleData_snapshots)
+ASN_CODEC_P(PropelledInformation)
+ASN_OER_P(PropelledInformation)
+ASN_BER_P(PropelledInformation)
+ASN_PRINT_P(PropelledInformation)
+ASN_CODEC_P(PublicSafetyAndRoadWorkerActivity)
+ASN_OER_P(PublicSafetyAndRoadWorkerActivity)
+ASN_BER_P(PublicSafetyAndRoadWorkerActivity)
+ASN_PRINT_P(PublicSafetyAndRoadWorkerActivity)
+ASN_CODEC_P(PublicSafetyDirectingTrafficSubType)
+ASN_OER_P(PublicSafetyDirectingTrafficSubType)
+ASN_BER_P(PublicSafetyDirectingTrafficSubType)
+ASN_PRINT_P(PublicSafetyDirectingTrafficSubType)
+ASN_CODEC_V(PublicSafetyEventResponderWorkerType)
+ASN_OER_V(PublicSafetyEventResponderWorkerType)
+ASN_BER_P(PublicSafetyEventResponderWorkerType)
+ASN_PRINT_P(PublicSafetyEventResponderWorkerType)
+ASN_CODEC_P(Publication)
+ASN_OER_P(Publication)
+ASN_BER_P(Publication)
+ASN_PRINT_P(Publication)
+ASN_CODEC_P(PublicationData)
+ASN_OER_P(PublicationData)
+ASN_BER_P(PublicationData)
+ASN_PRINT_P(PublicationData)
+ASN_CODEC_P(PublicationType)
+ASN_OER_P(PublicationType)
+ASN_BER_P(PublicationType)
+ASN_PRINT_P(PublicationType)
+ASN_CODEC_V(PublicationType_datexPublication_Management_cd)
+ASN_OER_V(PublicationType_datexPublication_Management_cd)
+ASN_BER_P(PublicationType_datexPublication_Management_cd)
+ASN_PRINT_P(PublicationType_datexPublication_Management_cd)
+ASN_CODEC_P(Publish_Format)
+ASN_OER_P(Publish_Format)
+ASN_BER_P(Publish_Format)
+ASN_PRINT_P(Publish_Format)
+ASN_CODEC_P(RSA_addGrpD)
+ASN_OER_P(RSA_addGrpD)
+ASN_BER_P(RSA_addGrpD)
+ASN_PRINT_P(RSA_addGrpD)
+ASN_TEST_P(RSA_addGrpD)
+ASN_CODEC_P(RTCMPackage)
+ASN_OER_P(RTCMPackage)
+ASN_BER_P(RTCMPackage)
+ASN_PRINT_P(RTCMPackage)
+ASN_CODEC_V(RTCM_Revision)
+ASN_OER_V(RTCM_Revision)
+ASN_BER_P(RTCM_Revision)
+ASN_PRINT_P(RTCM_Revision)
+ASN_CODEC_P(RTCMcorrections)
+ASN_OER_P(RTCMcorrections)
+ASN_BER_P(RTCMcorrections)
+ASN_PRINT_P(RTCMcorrections)
+ASN_TEST_P(RTCMcorrections)
+ASN_CODEC_P(RTCMcorrections_regional)
+ASN_OER_P(RTCMcorrections_regional)
+ASN_BER_P(RTCMcorrections_regional)
+ASN_PRINT_P(RTCMcorrections_regional)
+ASN_CODEC_P(RTCMheader)
+ASN_OER_P(RTCMheader)
+ASN_BER_P(RTCMheader)
+ASN_PRINT_P(RTCMheader)
+ASN_CODEC_P(RTCMmessage)
+ASN_OER_P(RTCMmessage)
+ASN_BER_P(RTCMmessage)
+ASN_PRINT_P(RTCMmessage)
+ASN_CODEC_P(RTCMmessageList)
+ASN_OER_P(RTCMmessageList)
+ASN_BER_P(RTCMmessageList)
+ASN_PRINT_P(RTCMmessageList)
+ASN_CODEC_V(RadiusOfCurvature)
+ASN_OER_V(RadiusOfCurvature)
+ASN_BER_P(RadiusOfCurvature)
+ASN_PRINT_P(RadiusOfCurvature)
+ASN_CODEC_V(Radius_B12)
+ASN_OER_V(Radius_B12)
+ASN_BER_P(Radius_B12)
+ASN_PRINT_P(Radius_B12)
+ASN_CODEC_V(RainSensor)
+ASN_OER_V(RainSensor)
+ASN_BER_P(RainSensor)
+ASN_PRINT_P(RainSensor)
+ASN_CODEC_V(RegionId)
+ASN_OER_V(RegionId)
+ASN_BER_P(RegionId)
+ASN_PRINT_P(RegionId)
+ASN_CODEC_P(RegionList)
+ASN_OER_P(RegionList)
+ASN_BER_P(RegionList)
+ASN_PRINT_P(RegionList)
+ASN_CODEC_P(RegionOffsets)
+ASN_OER_P(RegionOffsets)
+ASN_BER_P(RegionOffsets)
+ASN_PRINT_P(RegionOffsets)
+ASN_CODEC_P(RegionPointSet)
+ASN_OER_P(RegionPointSet)
+ASN_BER_P(RegionPointSet)
+ASN_PRINT_P(RegionPointSet)
+ASN_CODEC_P(RegionalExtension)
+ASN_OER_P(RegionalExtension)
+ASN_BER_P(RegionalExtension)
+ASN_PRINT_P(RegionalExtension)
+ASN_CODEC_P(Registered)
+ASN_OER_P(Registered)
+ASN_BER_P(Registered)
+ASN_PRINT_P(Registered)
+ASN_CODEC_P(Registered_continuous)
+ASN_OER_P(Registered_continuous)
+ASN_BER_P(Registered_continuous)
+ASN_PRINT_P(Registered_continuous)
+ASN_CODEC_P(Registered_daily)
+ASN_OER_P(Registered_daily)
+ASN_BER_P(Registered_daily)
+ASN_PRINT_P(Registered_daily)
+ASN_CODEC_P(Registered_daily_datexRegistered_DaysOfWeek_cd)
+ASN_OER_P(Registered_daily_datexRegistered_DaysOfWeek_cd)
+ASN_BER_P(Registered_daily_datexRegistered_DaysOfWeek_cd)
+ASN_PRINT_P(Registered_daily_datexRegistered_DaysOfWeek_cd)
+ASN_CODEC_P(RegulatorySpeedLimit)
+ASN_OER_P(RegulatorySpeedLimit)
+ASN_BER_P(RegulatorySpeedLimit)
+ASN_PRINT_P(RegulatorySpeedLimit)
+ASN_CODEC_P(Reject)
+ASN_OER_P(Reject)
+ASN_BER_P(Reject)
+ASN_PRINT_P(Reject)
+ASN_CODEC_P(RejectType)
+ASN_OER_P(RejectType)
+ASN_BER_P(RejectType)
+ASN_PRINT_P(RejectType)
+ASN_CODEC_V(RejectType_datexReject_Login_cd)
+ASN_OER_V(RejectType_datexReject_Login_cd)
+ASN_BER_P(RejectType_datexReject_Login_cd)
+ASN_PRINT_P(RejectType_datexReject_Login_cd)
+ASN_CODEC_V(RejectType_datexReject_Publication_cd)
+ASN_OER_V(RejectType_datexReject_Publication_cd)
+ASN_BER_P(RejectType_datexReject_Publication_cd)
+ASN_PRINT_P(RejectType_datexReject_Publication_cd)
+ASN_CODEC_V(RejectType_datexReject_Subscription_cd)
+ASN_OER_V(RejectType_datexReject_Subscription_cd)
+ASN_BER_P(RejectType_datexReject_Subscription_cd)
+ASN_PRINT_P(RejectType_datexReject_Subscription_cd)
+ASN_CODEC_V(RequestID)
+ASN_OER_V(RequestID)
+ASN_BER_P(RequestID)
+ASN_PRINT_P(RequestID)
+ASN_CODEC_V(RequestImportanceLevel)
+ASN_OER_V(RequestImportanceLevel)
+ASN_BER_P(RequestImportanceLevel)
+ASN_PRINT_P(RequestImportanceLevel)
+ASN_CODEC_V(RequestSubRole)
+ASN_OER_V(RequestSubRole)
+ASN_BER_P(RequestSubRole)
+ASN_PRINT_P(RequestSubRole)
+ASN_CODEC_V(RequestedItem)
+ASN_OER_V(RequestedItem)
+ASN_BER_P(RequestedItem)
+ASN_PRINT_P(RequestedItem)
+ASN_CODEC_P(RequestedItemList)
+ASN_OER_P(RequestedItemList)
+ASN_BER_P(RequestedItemList)
+ASN_PRINT_P(RequestedItemList)
+ASN_CODEC_P(RequestorDescription)
+ASN_OER_P(RequestorDescription)
+ASN_BER_P(RequestorDescription)
+ASN_PRINT_P(RequestorDescription)
+ASN_CODEC_P(RequestorDescription_regional)
+ASN_OER_P(RequestorDescription_regional)
+ASN_BER_P(RequestorDescription_regional)
+ASN_PRINT_P(RequestorDescription_regional)
+ASN_CODEC_P(RequestorPositionVector)
+ASN_OER_P(RequestorPositionVector)
+ASN_BER_P(RequestorPositionVector)
+ASN_PRINT_P(RequestorPositionVector)
+ASN_CODEC_P(RequestorType)
+ASN_OER_P(RequestorType)
+ASN_BER_P(RequestorType)
+ASN_PRINT_P(RequestorType)
+ASN_CODEC_V(ResponderGroupAffected)
+ASN_OER_V(ResponderGroupAffected)
+ASN_BER_P(ResponderGroupAffected)
+ASN_PRINT_P(ResponderGroupAffected)
+ASN_CODEC_V(ResponseType)
+ASN_OER_V(ResponseType)
+ASN_BER_P(ResponseType)
+ASN_PRINT_P(ResponseType)
+ASN_CODEC_V(RestrictionAppliesTo)
+ASN_OER_V(RestrictionAppliesTo)
+ASN_BER_P(RestrictionAppliesTo)
+ASN_PRINT_P(RestrictionAppliesTo)
+ASN_CODEC_P(RestrictionClassAssignment)
+ASN_OER_P(RestrictionClassAssignment)
+ASN_BER_P(RestrictionClassAssignment)
+ASN_PRINT_P(RestrictionClassAssignment)
+ASN_CODEC_V(RestrictionClassID)
+ASN_OER_V(RestrictionClassID)
+ASN_BER_P(RestrictionClassID)
+ASN_PRINT_P(RestrictionClassID)
+ASN_CODEC_P(RestrictionClassList)
+ASN_OER_P(RestrictionClassList)
+ASN_BER_P(RestrictionClassList)
+ASN_PRINT_P(RestrictionClassList)
+ASN_CODEC_P(RestrictionUserType)
+ASN_OER_P(RestrictionUserType)
+ASN_BER_P(RestrictionUserType)
+ASN_PRINT_P(RestrictionUserType)
+ASN_CODEC_P(RestrictionUserTypeList)
+ASN_OER_P(RestrictionUserTypeList)
+ASN_BER_P(RestrictionUserTypeList)
+ASN_PRINT_P(RestrictionUserTypeList)
+ASN_CODEC_P(RestrictionUserType_addGrpC)
+ASN_OER_P(RestrictionUserType_addGrpC)
+ASN_BER_P(RestrictionUserType_addGrpC)
+ASN_PRINT_P(RestrictionUserType_addGrpC)
+ASN_TEST_P(RestrictionUserType_addGrpC)
+ASN_CODEC_P(RestrictionUserType_regional)
+ASN_OER_P(RestrictionUserType_regional)
+ASN_BER_P(RestrictionUserType_regional)
+ASN_PRINT_P(RestrictionUserType_regional)
+ASN_CODEC_P(RoadLaneSetList)
+ASN_OER_P(RoadLaneSetList)
+ASN_BER_P(RoadLaneSetList)
+ASN_PRINT_P(RoadLaneSetList)
+ASN_CODEC_V(RoadRegulatorID)
+ASN_OER_V(RoadRegulatorID)
+ASN_BER_P(RoadRegulatorID)
+ASN_PRINT_P(RoadRegulatorID)
+ASN_CODEC_P(RoadSegment)
+ASN_OER_P(RoadSegment)
+ASN_BER_P(RoadSegment)
+ASN_PRINT_P(RoadSegment)
+ASN_CODEC_V(RoadSegmentID)
+ASN_OER_V(RoadSegmentID)
+ASN_BER_P(RoadSegmentID)
+ASN_PRINT_P(RoadSegmentID)
+ASN_CODEC_P(RoadSegmentList)
+ASN_OER_P(RoadSegmentList)
+ASN_BER_P(RoadSegmentList)
+ASN_PRINT_P(RoadSegmentList)
+ASN_CODEC_P(RoadSegmentReferenceID)
+ASN_OER_P(RoadSegmentReferenceID)
+ASN_BER_P(RoadSegmentReferenceID)
+ASN_PRINT_P(RoadSegmentReferenceID)
+ASN_CODEC_P(RoadSegment_regional)
+ASN_OER_P(RoadSegment_regional)
+ASN_BER_P(RoadSegment_regional)
+ASN_PRINT_P(RoadSegment_regional)
+ASN_CODEC_P(RoadSideAlert)
+ASN_OER_P(RoadSideAlert)
+ASN_BER_P(RoadSideAlert)
+ASN_PRINT_P(RoadSideAlert)
+ASN_CODEC_P(RoadSideAlert_description)
+ASN_OER_P(RoadSideAlert_description)
+ASN_BER_P(RoadSideAlert_description)
+ASN_PRINT_P(RoadSideAlert_description)
+ASN_CODEC_P(RoadSideAlert_regional)
+ASN_OER_P(RoadSideAlert_regional)
+ASN_BER_P(RoadSideAlert_regional)
+ASN_PRINT_P(RoadSideAlert_regional)
+ASN_CODEC_P(RoadSignID)
+ASN_OER_P(RoadSignID)
+ASN_BER_P(RoadSignID)
+ASN_PRINT_P(RoadSignID)
+ASN_CODEC_V(RoadwayCrownAngle)
+ASN_OER_V(RoadwayCrownAngle)
+ASN_BER_P(RoadwayCrownAngle)
+ASN_PRINT_P(RoadwayCrownAngle)
+ASN_CODEC_P(SPAT)
+ASN_OER_P(SPAT)
+ASN_BER_P(SPAT)
+ASN_PRINT_P(SPAT)
+ASN_TEST_P(SPAT)
+ASN_CODEC_P(SPAT_regional)
+ASN_OER_P(SPAT_regional)
+ASN_BER_P(SPAT_regional)
+ASN_PRINT_P(SPAT_regional)
+ASN_CODEC_V(SSPindex)
+ASN_OER_V(SSPindex)
+ASN_BER_P(SSPindex)
+ASN_PRINT_P(SSPindex)
+ASN_CODEC_P(Sample)
+ASN_OER_P(Sample)
+ASN_BER_P(Sample)
+ASN_PRINT_P(Sample)
+ASN_CODEC_V(Scale_B12)
+ASN_OER_V(Scale_B12)
+ASN_BER_P(Scale_B12)
+ASN_PRINT_P(Scale_B12)
+ASN_CODEC_V(Second)
+ASN_OER_V(Second)
+ASN_BER_P(Second)
+ASN_PRINT_P(Second)
+ASN_CODEC_V(SecondOfTime)
+ASN_OER_V(SecondOfTime)
+ASN_BER_P(SecondOfTime)
+ASN_PRINT_P(SecondOfTime)
+ASN_CODEC_V(SecondsAngle)
+ASN_OER_V(SecondsAngle)
+ASN_BER_P(SecondsAngle)
+ASN_PRINT_P(SecondsAngle)
+ASN_CODEC_V(SegmentAttributeLL)
+ASN_OER_V(SegmentAttributeLL)
+ASN_BER_P(SegmentAttributeLL)
+ASN_PRINT_P(SegmentAttributeLL)
+ASN_CODEC_P(SegmentAttributeLLList)
+ASN_OER_P(SegmentAttributeLLList)
+ASN_BER_P(SegmentAttributeLLList)
+ASN_PRINT_P(SegmentAttributeLLList)
+ASN_CODEC_V(SegmentAttributeXY)
+ASN_OER_V(SegmentAttributeXY)
+ASN_BER_P(SegmentAttributeXY)
+ASN_PRINT_P(SegmentAttributeXY)
+ASN_CODEC_P(SegmentAttributeXYList)
+ASN_OER_P(SegmentAttributeXYList)
+ASN_BER_P(SegmentAttributeXYList)
+ASN_PRINT_P(SegmentAttributeXYList)
+ASN_CODEC_V(SemiMajorAxisAccuracy)
+ASN_OER_V(SemiMajorAxisAccuracy)
+ASN_BER_P(SemiMajorAxisAccuracy)
+ASN_PRINT_P(SemiMajorAxisAccuracy)
+ASN_CODEC_V(SemiMajorAxisOrientation)
+ASN_OER_V(SemiMajorAxisOrientation)
+ASN_BER_P(SemiMajorAxisOrientation)
+ASN_PRINT_P(SemiMajorAxisOrientation)
+ASN_CODEC_V(SemiMinorAxisAccuracy)
+ASN_OER_V(SemiMinorAxisAccuracy)
+ASN_BER_P(SemiMinorAxisAccuracy)
+ASN_PRINT_P(SemiMinorAxisAccuracy)
+ASN_CODEC_P(ShapePointSet)
+ASN_OER_P(ShapePointSet)
+ASN_BER_P(ShapePointSet)
+ASN_PRINT_P(ShapePointSet)
+ASN_CODEC_V(SignPrority)
+ASN_OER_V(SignPrority)
+ASN_BER_P(SignPrority)
+ASN_PRINT_P(SignPrority)
+ASN_CODEC_P(SignalControlZone)
+ASN_OER_P(SignalControlZone)
+ASN_BER_P(SignalControlZone)
+ASN_PRINT_P(SignalControlZone)
+ASN_CODEC_V(SignalGroupID)
+ASN_OER_V(SignalGroupID)
+ASN_BER_P(SignalGroupID)
+ASN_PRINT_P(SignalGroupID)
+ASN_CODEC_P(SignalHeadLocation)
+ASN_OER_P(SignalHeadLocation)
+ASN_BER_P(SignalHeadLocation)
+ASN_PRINT_P(SignalHeadLocation)
+ASN_CODEC_P(SignalHeadLocationList)
+ASN_OER_P(SignalHeadLocationList)
+ASN_BER_P(SignalHeadLocationList)
+ASN_PRINT_P(SignalHeadLocationList)
+ASN_CODEC_P(SignalReqScheme)
+ASN_OER_P(SignalReqScheme)
+ASN_BER_P(SignalReqScheme)
+ASN_PRINT_P(SignalReqScheme)
+ASN_TEST_P(SignalReqScheme)
+ASN_CODEC_P(SignalRequest)
+ASN_OER_P(SignalRequest)
+ASN_BER_P(SignalRequest)
+ASN_PRINT_P(SignalRequest)
+ASN_CODEC_P(SignalRequestList)
+ASN_OER_P(SignalRequestList)
+ASN_BER_P(SignalRequestList)
+ASN_PRINT_P(SignalRequestList)
+ASN_CODEC_P(SignalRequestMessage)
+ASN_OER_P(SignalRequestMessage)
+ASN_BER_P(SignalRequestMessage)
+ASN_PRINT_P(SignalRequestMessage)
+ASN_TEST_P(SignalRequestMessage)
+ASN_CODEC_P(SignalRequestMessage_regional)
+ASN_OER_P(SignalRequestMessage_regional)
+ASN_BER_P(SignalRequestMessage_regional)
+ASN_PRINT_P(SignalRequestMessage_regional)
+ASN_CODEC_P(SignalRequestPackage)
+ASN_OER_P(SignalRequestPackage)
+ASN_BER_P(SignalRequestPackage)
+ASN_PRINT_P(SignalRequestPackage)
+ASN_CODEC_P(SignalRequestPackage_regional)
+ASN_OER_P(SignalRequestPackage_regional)
+ASN_BER_P(SignalRequestPackage_regional)
+ASN_PRINT_P(SignalRequestPackage_regional)
+ASN_CODEC_P(SignalRequest_regional)
+ASN_OER_P(SignalRequest_regional)
+ASN_BER_P(SignalRequest_regional)
+ASN_PRINT_P(SignalRequest_regional)
+ASN_CODEC_P(SignalRequesterInfo)
+ASN_OER_P(SignalRequesterInfo)
+ASN_BER_P(SignalRequesterInfo)
+ASN_PRINT_P(SignalRequesterInfo)
+ASN_CODEC_P(SignalStatus)
+ASN_OER_P(SignalStatus)
+ASN_BER_P(SignalStatus)
+ASN_PRINT_P(SignalStatus)
+ASN_CODEC_P(SignalStatusList)
+ASN_OER_P(SignalStatusList)
+ASN_BER_P(SignalStatusList)
+ASN_PRINT_P(SignalStatusList)
+ASN_CODEC_P(SignalStatusMessage)
+ASN_OER_P(SignalStatusMessage)
+ASN_BER_P(SignalStatusMessage)
+ASN_PRINT_P(SignalStatusMessage)
+ASN_TEST_P(SignalStatusMessage)
+ASN_CODEC_P(SignalStatusMessage_regional)
+ASN_OER_P(SignalStatusMessage_regional)
+ASN_BER_P(SignalStatusMessage_regional)
+ASN_PRINT_P(SignalStatusMessage_regional)
+ASN_CODEC_P(SignalStatusPackage)
+ASN_OER_P(SignalStatusPackage)
+ASN_BER_P(SignalStatusPackage)
+ASN_PRINT_P(SignalStatusPackage)
+ASN_CODEC_P(SignalStatusPackageList)
+ASN_OER_P(SignalStatusPackageList)
+ASN_BER_P(SignalStatusPackageList)
+ASN_PRINT_P(SignalStatusPackageList)
+ASN_CODEC_P(SignalStatusPackage_regional)
+ASN_OER_P(SignalStatusPackage_regional)
+ASN_BER_P(SignalStatusPackage_regional)
+ASN_PRINT_P(SignalStatusPackage_regional)
+ASN_CODEC_P(SignalStatus_regional)
+ASN_OER_P(SignalStatus_regional)
+ASN_BER_P(SignalStatus_regional)
+ASN_PRINT_P(SignalStatus_regional)
+ASN_CODEC_V(SirenInUse)
+ASN_OER_V(SirenInUse)
+ASN_BER_P(SirenInUse)
+ASN_PRINT_P(SirenInUse)
+ASN_CODEC_P(Snapshot)
+ASN_OER_P(Snapshot)
+ASN_BER_P(Snapshot)
+ASN_PRINT_P(Snapshot)
+ASN_CODEC_P(SnapshotDistance)
+ASN_OER_P(SnapshotDistance)
+ASN_BER_P(SnapshotDistance)
+ASN_PRINT_P(SnapshotDistance)
+ASN_CODEC_P(SnapshotTime)
+ASN_OER_P(SnapshotTime)
+ASN_BER_P(SnapshotTime)
+ASN_PRINT_P(SnapshotTime)
+ASN_CODEC_P(SpecialVehicleExtensions)
+ASN_OER_P(SpecialVehicleExtensions)
+ASN_BER_P(SpecialVehicleExtensions)
+ASN_PRINT_P(SpecialVehicleExtensions)
+ASN_TEST_P(SpecialVehicleExtensions)
+ASN_CODEC_V(Speed)
+ASN_OER_V(Speed)
+ASN_BER_P(Speed)
+ASN_PRINT_P(Speed)
+ASN_CODEC_V(SpeedAdvice)
+ASN_OER_V(SpeedAdvice)
+ASN_BER_P(SpeedAdvice)
+ASN_PRINT_P(SpeedAdvice)
+ASN_CODEC_V(SpeedConfidence)
+ASN_OER_V(SpeedConfidence)
+ASN_BER_P(SpeedConfidence)
+ASN_PRINT_P(SpeedConfidence)
+ASN_CODEC_P(SpeedLimit)
+ASN_OER_P(SpeedLimit)
+ASN_BER_P(SpeedLimit)
+ASN_PRINT_P(SpeedLimit)
+ASN_CODEC_P(SpeedLimitList)
+ASN_OER_P(SpeedLimitList)
+ASN_BER_P(SpeedLimitList)
+ASN_PRINT_P(SpeedLimitList)
+ASN_CODEC_V(SpeedLimitType)
+ASN_OER_V(SpeedLimitType)
+ASN_BER_P(SpeedLimitType)
+ASN_PRINT_P(SpeedLimitType)
+ASN_CODEC_P(SpeedLimit_element)
+ASN_OER_P(SpeedLimit_element)
+ASN_BER_P(SpeedLimit_element)
+ASN_PRINT_P(SpeedLimit_element)
+ASN_CODEC_P(SpeedLimit_element_item)
+ASN_OER_P(SpeedLimit_element_item)
+ASN_BER_P(SpeedLimit_element_item)
+ASN_PRINT_P(SpeedLimit_element_item)
+ASN_CODEC_P(SpeedProfile)
+ASN_OER_P(SpeedProfile)
+ASN_BER_P(SpeedProfile)
+ASN_PRINT_P(SpeedProfile)
+ASN_CODEC_V(SpeedProfileMeasurement)
+ASN_OER_V(SpeedProfileMeasurement)
+ASN_BER_P(SpeedProfileMeasurement)
+ASN_PRINT_P(SpeedProfileMeasurement)
+ASN_CODEC_P(SpeedProfileMeasurementList)
+ASN_OER_P(SpeedProfileMeasurementList)
+ASN_BER_P(SpeedProfileMeasurementList)
+ASN_PRINT_P(SpeedProfileMeasurementList)
+ASN_CODEC_P(SpeedandHeadingandThrottleConfidence)
+ASN_OER_P(SpeedandHeadingandThrottleConfidence)
+ASN_BER_P(SpeedandHeadingandThrottleConfidence)
+ASN_PRINT_P(SpeedandHeadingandThrottleConfidence)
+ASN_CODEC_V(StabilityControlStatus)
+ASN_OER_V(StabilityControlStatus)
+ASN_BER_P(StabilityControlStatus)
+ASN_PRINT_P(StabilityControlStatus)
+ASN_CODEC_V(StationID)
+ASN_OER_V(StationID)
+ASN_BER_P(StationID)
+ASN_PRINT_P(StationID)
+ASN_CODEC_V(SteeringAxleLubePressure)
+ASN_OER_V(SteeringAxleLubePressure)
+ASN_BER_P(SteeringAxleLubePressure)
+ASN_PRINT_P(SteeringAxleLubePressure)
+ASN_CODEC_V(SteeringAxleTemperature)
+ASN_OER_V(SteeringAxleTemperature)
+ASN_BER_P(SteeringAxleTemperature)
+ASN_PRINT_P(SteeringAxleTemperature)
+ASN_CODEC_V(SteeringWheelAngle)
+ASN_OER_V(SteeringWheelAngle)
+ASN_BER_P(SteeringWheelAngle)
+ASN_PRINT_P(SteeringWheelAngle)
+ASN_CODEC_V(SteeringWheelAngleConfidence)
+ASN_OER_V(SteeringWheelAngleConfidence)
+ASN_BER_P(SteeringWheelAngleConfidence)
+ASN_PRINT_P(SteeringWheelAngleConfidence)
+ASN_CODEC_V(SteeringWheelAngleRateOfChange)
+ASN_OER_V(SteeringWheelAngleRateOfChange)
+ASN_BER_P(SteeringWheelAngleRateOfChange)
+ASN_PRINT_P(SteeringWheelAngleRateOfChange)
+ASN_CODEC_P(Subscription)
+ASN_OER_P(Subscription)
+ASN_BER_P(Subscription)
+ASN_PRINT_P(Subscription)
+ASN_CODEC_P(SubscriptionData)
+ASN_OER_P(SubscriptionData)
+ASN_BER_P(SubscriptionData)
+ASN_PRINT_P(SubscriptionData)
+ASN_CODEC_V(SubscriptionData_datexSubscribe_PublishFormat_cd)
+ASN_OER_V(SubscriptionData_datexSubscribe_PublishFormat_cd)
+ASN_BER_P(SubscriptionData_datexSubscribe_PublishFormat_cd)
+ASN_PRINT_P(SubscriptionData_datexSubscribe_PublishFormat_cd)
+ASN_CODEC_V(SubscriptionData_datexSubscribe_Status_cd)
+ASN_OER_V(SubscriptionData_datexSubscribe_Status_cd)
+ASN_BER_P(SubscriptionData_datexSubscribe_Status_cd)
+ASN_PRINT_P(SubscriptionData_datexSubscribe_Status_cd)
+ASN_CODEC_P(SubscriptionMode)
+ASN_OER_P(SubscriptionMode)
+ASN_BER_P(SubscriptionMode)
+ASN_PRINT_P(SubscriptionMode)
+ASN_CODEC_P(SubscriptionType)
+ASN_OER_P(SubscriptionType)
+ASN_BER_P(SubscriptionType)
+ASN_PRINT_P(SubscriptionType)
+ASN_CODEC_V(SubscriptionType_datexSubscribe_CancelReason_cd)
+ASN_OER_V(SubscriptionType_datexSubscribe_CancelReason_cd)
+ASN_BER_P(SubscriptionType_datexSubscribe_CancelReason_cd)
+ASN_PRINT_P(SubscriptionType_datexSubscribe_CancelReason_cd)
+ASN_CODEC_V(SummerTime)
+ASN_OER_V(SummerTime)
+ASN_BER_P(SummerTime)
+ASN_PRINT_P(SummerTime)
+ASN_CODEC_V(SunSensor)
+ASN_OER_V(SunSensor)
+ASN_BER_P(SunSensor)
+ASN_PRINT_P(SunSensor)
+ASN_CODEC_P(SupplementalVehicleExtensions)
+ASN_OER_P(SupplementalVehicleExtensions)
+ASN_BER_P(SupplementalVehicleExtensions)
+ASN_PRINT_P(SupplementalVehicleExtensions)
+ASN_TEST_P(SupplementalVehicleExtensions)
+ASN_CODEC_P(SupplementalVehicleExtensions_regional)
+ASN_OER_P(SupplementalVehicleExtensions_regional)
+ASN_BER_P(SupplementalVehicleExtensions_regional)
+ASN_PRINT_P(SupplementalVehicleExtensions_regional)
+ASN_CODEC_P(TemporaryID)
+ASN_OER_P(TemporaryID)
+ASN_BER_P(TemporaryID)
+ASN_PRINT_P(TemporaryID)
+ASN_CODEC_V(TenthSecond)
+ASN_OER_V(TenthSecond)
+ASN_BER_P(TenthSecond)
+ASN_PRINT_P(TenthSecond)
+ASN_CODEC_V(TermDistance)
+ASN_OER_V(TermDistance)
+ASN_BER_P(TermDistance)
+ASN_PRINT_P(TermDistance)
+ASN_CODEC_V(TermTime)
+ASN_OER_V(TermTime)
+ASN_BER_P(TermTime)
+ASN_PRINT_P(TermTime)
+ASN_CODEC_V(Terminate)
+ASN_OER_V(Terminate)
+ASN_BER_P(Terminate)
+ASN_PRINT_P(Terminate)
+ASN_CODEC_P(TestMessage00)
+ASN_OER_P(TestMessage00)
+ASN_BER_P(TestMessage00)
+ASN_PRINT_P(TestMessage00)
+ASN_TEST_P(TestMessage00)
+ASN_CODEC_P(TestMessage01)
+ASN_OER_P(TestMessage01)
+ASN_BER_P(TestMessage01)
+ASN_PRINT_P(TestMessage01)
+ASN_TEST_P(TestMessage01)
+ASN_CODEC_P(TestMessage02)
+ASN_OER_P(TestMessage02)
+ASN_BER_P(TestMessage02)
+ASN_PRINT_P(TestMessage02)
+ASN_TEST_P(TestMessage02)
+ASN_CODEC_P(TestMessage03)
+ASN_OER_P(TestMessage03)
+ASN_BER_P(TestMessage03)
+ASN_PRINT_P(TestMessage03)
+ASN_TEST_P(TestMessage03)
+ASN_CODEC_P(TestMessage04)
+ASN_OER_P(TestMessage04)
+ASN_BER_P(TestMessage04)
+ASN_PRINT_P(TestMessage04)
+ASN_TEST_P(TestMessage04)
+ASN_CODEC_P(TestMessage05)
+ASN_OER_P(TestMessage05)
+ASN_BER_P(TestMessage05)
+ASN_PRINT_P(TestMessage05)
+ASN_TEST_P(TestMessage05)
+ASN_CODEC_P(TestMessage06)
+ASN_OER_P(TestMessage06)
+ASN_BER_P(TestMessage06)
+ASN_PRINT_P(TestMessage06)
+ASN_TEST_P(TestMessage06)
+ASN_CODEC_P(TestMessage07)
+ASN_OER_P(TestMessage07)
+ASN_BER_P(TestMessage07)
+ASN_PRINT_P(TestMessage07)
+ASN_TEST_P(TestMessage07)
+ASN_CODEC_P(TestMessage08)
+ASN_OER_P(TestMessage08)
+ASN_BER_P(TestMessage08)
+ASN_PRINT_P(TestMessage08)
+ASN_TEST_P(TestMessage08)
+ASN_CODEC_P(TestMessage09)
+ASN_OER_P(TestMessage09)
+ASN_BER_P(TestMessage09)
+ASN_PRINT_P(TestMessage09)
+ASN_TEST_P(TestMessage09)
+ASN_CODEC_P(TestMessage10)
+ASN_OER_P(TestMessage10)
+ASN_BER_P(TestMessage10)
+ASN_PRINT_P(TestMessage10)
+ASN_TEST_P(TestMessage10)
+ASN_CODEC_P(TestMessage11)
+ASN_OER_P(TestMessage11)
+ASN_BER_P(TestMessage11)
+ASN_PRINT_P(TestMessage11)
+ASN_TEST_P(TestMessage11)
+ASN_CODEC_P(TestMessage12)
+ASN_OER_P(TestMessage12)
+ASN_BER_P(TestMessage12)
+ASN_PRINT_P(TestMessage12)
+ASN_TEST_P(TestMessage12)
+ASN_CODEC_P(TestMessage13)
+ASN_OER_P(TestMessage13)
+ASN_BER_P(TestMessage13)
+ASN_PRINT_P(TestMessage13)
+ASN_TEST_P(TestMessage13)
+ASN_CODEC_P(TestMessage14)
+ASN_OER_P(TestMessage14)
+ASN_BER_P(TestMessage14)
+ASN_PRINT_P(TestMessage14)
+ASN_TEST_P(TestMessage14)
+ASN_CODEC_P(TestMessage15)
+ASN_OER_P(TestMessage15)
+ASN_BER_P(TestMessage15)
+ASN_PRINT_P(TestMessage15)
+ASN_TEST_P(TestMessage15)
+ASN_CODEC_V(ThrottleConfidence)
+ASN_OER_V(ThrottleConfidence)
+ASN_BER_P(ThrottleConfidence)
+ASN_PRINT_P(ThrottleConfidence)
+ASN_CODEC_V(ThrottlePosition)
+ASN_OER_V(ThrottlePosition)
+ASN_BER_P(ThrottlePosition)
+ASN_PRINT_P(ThrottlePosition)
+ASN_CODEC_P(Time)
+ASN_OER_P(Time)
+ASN_BER_P(Time)
+ASN_PRINT_P(Time)
+ASN_CODEC_P(TimeChangeDetails)
+ASN_OER_P(TimeChangeDetails)
+ASN_BER_P(TimeChangeDetails)
+ASN_PRINT_P(TimeChangeDetails)
+ASN_CODEC_V(TimeConfidence)
+ASN_OER_V(TimeConfidence)
+ASN_BER_P(TimeConfidence)
+ASN_PRINT_P(TimeConfidence)
+ASN_CODEC_V(TimeIntervalConfidence)
+ASN_OER_V(TimeIntervalConfidence)
+ASN_BER_P(TimeIntervalConfidence)
+ASN_PRINT_P(TimeIntervalConfidence)
+ASN_CODEC_V(TimeMark)
+ASN_OER_V(TimeMark)
+ASN_BER_P(TimeMark)
+ASN_PRINT_P(TimeMark)
+ASN_CODEC_V(TimeOffset)
+ASN_OER_V(TimeOffset)
+ASN_BER_P(TimeOffset)
+ASN_PRINT_P(TimeOffset)
+ASN_CODEC_V(TimeRemaining)
+ASN_OER_V(TimeRemaining)
+ASN_BER_P(TimeRemaining)
+ASN_PRINT_P(TimeRemaining)
+ASN_CODEC_P(Time_time_SecondFractions)
+ASN_OER_P(Time_time_SecondFractions)
+ASN_BER_P(Time_time_SecondFractions)
+ASN_PRINT_P(Time_time_SecondFractions)
+ASN_CODEC_P(Time_time_Timezone)
+ASN_OER_P(Time_time_Timezone)
+ASN_BER_P(Time_time_Timezone)
+ASN_PRINT_P(Time_time_Timezone)
+ASN_CODEC_P(TireData)
+ASN_OER_P(TireData)
+ASN_BER_P(TireData)
+ASN_PRINT_P(TireData)
+ASN_CODEC_P(TireDataList)
+ASN_OER_P(TireDataList)
+ASN_BER_P(TireDataList)
+ASN_PRINT_P(TireDataList)
+ASN_CODEC_V(TireLeakageRate)
+ASN_OER_V(TireLeakageRate)
+ASN_BER_P(TireLeakageRate)
+ASN_PRINT_P(TireLeakageRate)
+ASN_CODEC_V(TireLocation)
+ASN_OER_V(TireLocation)
+ASN_BER_P(TireLocation)
+ASN_PRINT_P(TireLocation)
+ASN_CODEC_V(TirePressure)
+ASN_OER_V(TirePressure)
+ASN_BER_P(TirePressure)
+ASN_PRINT_P(TirePressure)
+ASN_CODEC_V(TirePressureThresholdDetection)
+ASN_OER_V(TirePressureThresholdDetection)
+ASN_BER_P(TirePressureThresholdDetection)
+ASN_PRINT_P(TirePressureThresholdDetection)
+ASN_CODEC_V(TireTemp)
+ASN_OER_V(TireTemp)
+ASN_BER_P(TireTemp)
+ASN_PRINT_P(TireTemp)
+ASN_CODEC_V(TractionControlStatus)
+ASN_OER_V(TractionControlStatus)
+ASN_BER_P(TractionControlStatus)
+ASN_PRINT_P(TractionControlStatus)
+ASN_CODEC_P(TrailerData)
+ASN_OER_P(TrailerData)
+ASN_BER_P(TrailerData)
+ASN_PRINT_P(TrailerData)
+ASN_CODEC_P(TrailerHistoryPoint)
+ASN_OER_P(TrailerHistoryPoint)
+ASN_BER_P(TrailerHistoryPoint)
+ASN_PRINT_P(TrailerHistoryPoint)
+ASN_CODEC_P(TrailerHistoryPointList)
+ASN_OER_P(TrailerHistoryPointList)
+ASN_BER_P(TrailerHistoryPointList)
+ASN_PRINT_P(TrailerHistoryPointList)
+ASN_CODEC_V(TrailerMass)
+ASN_OER_V(TrailerMass)
+ASN_BER_P(TrailerMass)
+ASN_PRINT_P(TrailerMass)
+ASN_CODEC_P(TrailerUnitDescription)
+ASN_OER_P(TrailerUnitDescription)
+ASN_BER_P(TrailerUnitDescription)
+ASN_PRINT_P(TrailerUnitDescription)
+ASN_CODEC_P(TrailerUnitDescriptionList)
+ASN_OER_P(TrailerUnitDescriptionList)
+ASN_BER_P(TrailerUnitDescriptionList)
+ASN_PRINT_P(TrailerUnitDescriptionList)
+ASN_CODEC_V(TrailerWeight)
+ASN_OER_V(TrailerWeight)
+ASN_BER_P(TrailerWeight)
+ASN_PRINT_P(TrailerWeight)
+ASN_CODEC_P(TransferDone)
+ASN_OER_P(TransferDone)
+ASN_BER_P(TransferDone)
+ASN_PRINT_P(TransferDone)
+ASN_CODEC_P(TransitStatus)
+ASN_OER_P(TransitStatus)
+ASN_BER_P(TransitStatus)
+ASN_PRINT_P(TransitStatus)
+ASN_CODEC_V(TransitVehicleOccupancy)
+ASN_OER_V(TransitVehicleOccupancy)
+ASN_BER_P(TransitVehicleOccupancy)
+ASN_PRINT_P(TransitVehicleOccupancy)
+ASN_CODEC_P(TransitVehicleStatus)
+ASN_OER_P(TransitVehicleStatus)
+ASN_BER_P(TransitVehicleStatus)
+ASN_PRINT_P(TransitVehicleStatus)
+ASN_CODEC_P(TransmissionAndSpeed)
+ASN_OER_P(TransmissionAndSpeed)
+ASN_BER_P(TransmissionAndSpeed)
+ASN_PRINT_P(TransmissionAndSpeed)
+ASN_CODEC_V(TransmissionState)
+ASN_OER_V(TransmissionState)
+ASN_BER_P(TransmissionState)
+ASN_PRINT_P(TransmissionState)
+ASN_CODEC_P(TravelerDataFrame)
+ASN_OER_P(TravelerDataFrame)
+ASN_BER_P(TravelerDataFrame)
+ASN_PRINT_P(TravelerDataFrame)
+ASN_CODEC_P(TravelerDataFrameList)
+ASN_OER_P(TravelerDataFrameList)
+ASN_BER_P(TravelerDataFrameList)
+ASN_PRINT_P(TravelerDataFrameList)
+ASN_CODEC_P(TravelerDataFrame_content)
+ASN_OER_P(TravelerDataFrame_content)
+ASN_BER_P(TravelerDataFrame_content)
+ASN_PRINT_P(TravelerDataFrame_content)
+ASN_CODEC_P(TravelerDataFrame_msgId)
+ASN_OER_P(TravelerDataFrame_msgId)
+ASN_BER_P(TravelerDataFrame_msgId)
+ASN_PRINT_P(TravelerDataFrame_msgId)
+ASN_CODEC_P(TravelerDataFrame_regions)
+ASN_OER_P(TravelerDataFrame_regions)
+ASN_BER_P(TravelerDataFrame_regions)
+ASN_PRINT_P(TravelerDataFrame_regions)
+ASN_CODEC_V(TravelerInfoType)
+ASN_OER_V(TravelerInfoType)
+ASN_BER_P(TravelerInfoType)
+ASN_PRINT_P(TravelerInfoType)
+ASN_CODEC_P(TravelerInformation)
+ASN_OER_P(TravelerInformation)
+ASN_BER_P(TravelerInformation)
+ASN_PRINT_P(TravelerInformation)
+ASN_TEST_P(TravelerInformation)
+ASN_CODEC_P(TravelerInformation_regional)
+ASN_OER_P(TravelerInformation_regional)
+ASN_BER_P(TravelerInformation_regional)
+ASN_PRINT_P(TravelerInformation_regional)
+ASN_CODEC_V(URL_Base)
+ASN_OER_V(URL_Base)
+ASN_BER_V(URL_Base)
+ASN_PRINT_V(URL_Base)
+ASN_CODEC_V(URL_Link)
+ASN_OER_V(URL_Link)
+ASN_BER_V(URL_Link)
+ASN_PRINT_V(URL_Link)
+ASN_TEST_V(URL_Link)
+ASN_CODEC_V(URL_Short)
+ASN_OER_V(URL_Short)
+ASN_BER_V(URL_Short)
+ASN_PRINT_V(URL_Short)
+ASN_CODEC_P(UniqueMSGID)
+ASN_OER_P(UniqueMSGID)
+ASN_BER_P(UniqueMSGID)
+ASN_PRINT_P(UniqueMSGID)
+ASN_CODEC_P(UserSizeAndBehaviour)
+ASN_OER_P(UserSizeAndBehaviour)
+ASN_BER_P(UserSizeAndBehaviour)
+ASN_PRINT_P(UserSizeAndBehaviour)
+ASN_CODEC_P(VINstring)
+ASN_OER_P(VINstring)
+ASN_BER_P(VINstring)
+ASN_PRINT_P(VINstring)
+ASN_CODEC_P(ValidRegion)
+ASN_OER_P(ValidRegion)
+ASN_BER_P(ValidRegion)
+ASN_PRINT_P(ValidRegion)
+ASN_CODEC_P(ValidRegion_area)
+ASN_OER_P(ValidRegion_area)
+ASN_BER_P(ValidRegion_area)
+ASN_PRINT_P(ValidRegion_area)
+ASN_CODEC_P(VehicleClassification)
+ASN_OER_P(VehicleClassification)
+ASN_BER_P(VehicleClassification)
+ASN_PRINT_P(VehicleClassification)
+ASN_CODEC_P(VehicleClassification_regional)
+ASN_OER_P(VehicleClassification_regional)
+ASN_BER_P(VehicleClassification_regional)
+ASN_PRINT_P(VehicleClassification_regional)
+ASN_CODEC_P(VehicleData)
+ASN_OER_P(VehicleData)
+ASN_BER_P(VehicleData)
+ASN_PRINT_P(VehicleData)
+ASN_CODEC_P(VehicleEventFlags)
+ASN_OER_P(VehicleEventFlags)
+ASN_BER_P(VehicleEventFlags)
+ASN_PRINT_P(VehicleEventFlags)
+ASN_CODEC_V(VehicleGroupAffected)
+ASN_OER_V(VehicleGroupAffected)
+ASN_BER_P(VehicleGroupAffected)
+ASN_PRINT_P(VehicleGroupAffected)
+ASN_CODEC_V(VehicleHeight)
+ASN_OER_V(VehicleHeight)
+ASN_BER_P(VehicleHeight)
+ASN_PRINT_P(VehicleHeight)
+ASN_CODEC_P(VehicleID)
+ASN_OER_P(VehicleID)
+ASN_BER_P(VehicleID)
+ASN_PRINT_P(VehicleID)
+ASN_CODEC_P(VehicleIdent)
+ASN_OER_P(VehicleIdent)
+ASN_BER_P(VehicleIdent)
+ASN_PRINT_P(VehicleIdent)
+ASN_CODEC_P(VehicleIdent_vehicleClass)
+ASN_OER_P(VehicleIdent_vehicleClass)
+ASN_BER_P(VehicleIdent_vehicleClass)
+ASN_PRINT_P(VehicleIdent_vehicleClass)
+ASN_CODEC_V(VehicleLength)
+ASN_OER_V(VehicleLength)
+ASN_BER_P(VehicleLength)
+ASN_PRINT_P(VehicleLength)
+ASN_CODEC_V(VehicleMass)
+ASN_OER_V(VehicleMass)
+ASN_BER_P(VehicleMass)
+ASN_PRINT_P(VehicleMass)
+ASN_CODEC_P(VehicleSafetyExtensions)
+ASN_OER_P(VehicleSafetyExtensions)
+ASN_BER_P(VehicleSafetyExtensions)
+ASN_PRINT_P(VehicleSafetyExtensions)
+ASN_CODEC_P(VehicleSize)
+ASN_OER_P(VehicleSize)
+ASN_BER_P(VehicleSize)
+ASN_PRINT_P(VehicleSize)
+ASN_CODEC_P(VehicleStatus)
+ASN_OER_P(VehicleStatus)
+ASN_BER_P(VehicleStatus)
+ASN_PRINT_P(VehicleStatus)
+ASN_CODEC_V(VehicleStatusDeviceTypeTag)
+ASN_OER_V(VehicleStatusDeviceTypeTag)
+ASN_BER_P(VehicleStatusDeviceTypeTag)
+ASN_PRINT_P(VehicleStatusDeviceTypeTag)
+ASN_CODEC_P(VehicleStatusRequest)
+ASN_OER_P(VehicleStatusRequest)
+ASN_BER_P(VehicleStatusRequest)
+ASN_PRINT_P(VehicleStatusRequest)
+ASN_CODEC_P(VehicleStatusRequestList)
+ASN_OER_P(VehicleStatusRequestList)
+ASN_BER_P(VehicleStatusRequestList)
+ASN_PRINT_P(VehicleStatusRequestList)
+ASN_CODEC_P(VehicleStatus_accelSets)
+ASN_OER_P(VehicleStatus_accelSets)
+ASN_BER_P(VehicleStatus_accelSets)
+ASN_PRINT_P(VehicleStatus_accelSets)
+ASN_CODEC_P(VehicleStatus_object)
+ASN_OER_P(VehicleStatus_object)
+ASN_BER_P(VehicleStatus_object)
+ASN_PRINT_P(VehicleStatus_object)
+ASN_CODEC_P(VehicleStatus_steering)
+ASN_OER_P(VehicleStatus_steering)
+ASN_BER_P(VehicleStatus_steering)
+ASN_PRINT_P(VehicleStatus_steering)
+ASN_CODEC_P(VehicleStatus_vehicleData)
+ASN_OER_P(VehicleStatus_vehicleData)
+ASN_BER_P(VehicleStatus_vehicleData)
+ASN_PRINT_P(VehicleStatus_vehicleData)
+ASN_CODEC_P(VehicleStatus_weatherReport)
+ASN_OER_P(VehicleStatus_weatherReport)
+ASN_BER_P(VehicleStatus_weatherReport)
+ASN_PRINT_P(VehicleStatus_weatherReport)
+ASN_CODEC_P(VehicleToLanePosition)
+ASN_OER_P(VehicleToLanePosition)
+ASN_BER_P(VehicleToLanePosition)
+ASN_PRINT_P(VehicleToLanePosition)
+ASN_CODEC_P(VehicleToLanePositionList)
+ASN_OER_P(VehicleToLanePositionList)
+ASN_BER_P(VehicleToLanePositionList)
+ASN_PRINT_P(VehicleToLanePositionList)
+ASN_CODEC_V(VehicleType)
+ASN_OER_V(VehicleType)
+ASN_BER_P(VehicleType)
+ASN_PRINT_P(VehicleType)
+ASN_CODEC_V(VehicleWidth)
+ASN_OER_V(VehicleWidth)
+ASN_BER_P(VehicleWidth)
+ASN_PRINT_P(VehicleWidth)
+ASN_CODEC_V(Velocity)
+ASN_OER_V(Velocity)
+ASN_BER_P(Velocity)
+ASN_PRINT_P(Velocity)
+ASN_CODEC_V(VertOffset_B07)
+ASN_OER_V(VertOffset_B07)
+ASN_BER_P(VertOffset_B07)
+ASN_PRINT_P(VertOffset_B07)
+ASN_CODEC_V(VertOffset_B08)
+ASN_OER_V(VertOffset_B08)
+ASN_BER_P(VertOffset_B08)
+ASN_PRINT_P(VertOffset_B08)
+ASN_CODEC_V(VertOffset_B09)
+ASN_OER_V(VertOffset_B09)
+ASN_BER_P(VertOffset_B09)
+ASN_PRINT_P(VertOffset_B09)
+ASN_CODEC_V(VertOffset_B10)
+ASN_OER_V(VertOffset_B10)
+ASN_BER_P(VertOffset_B10)
+ASN_PRINT_P(VertOffset_B10)
+ASN_CODEC_V(VertOffset_B11)
+ASN_OER_V(VertOffset_B11)
+ASN_BER_P(VertOffset_B11)
+ASN_PRINT_P(VertOffset_B11)
+ASN_CODEC_V(VertOffset_B12)
+ASN_OER_V(VertOffset_B12)
+ASN_BER_P(VertOffset_B12)
+ASN_PRINT_P(VertOffset_B12)
+ASN_CODEC_V(VerticalAcceleration)
+ASN_OER_V(VerticalAcceleration)
+ASN_BER_P(VerticalAcceleration)
+ASN_PRINT_P(VerticalAcceleration)
+ASN_CODEC_P(VerticalAccelerationThreshold)
+ASN_OER_P(VerticalAccelerationThreshold)
+ASN_BER_P(VerticalAccelerationThreshold)
+ASN_PRINT_P(VerticalAccelerationThreshold)
+ASN_CODEC_P(VerticalOffset)
+ASN_OER_P(VerticalOffset)
+ASN_BER_P(VerticalOffset)
+ASN_PRINT_P(VerticalOffset)
+ASN_TEST_P(VerticalOffset)
+ASN_CODEC_V(WaitOnStopline)
+ASN_OER_V(WaitOnStopline)
+ASN_BER_P(WaitOnStopline)
+ASN_PRINT_P(WaitOnStopline)
+ASN_CODEC_P(WeatherProbe)
+ASN_OER_P(WeatherProbe)
+ASN_BER_P(WeatherProbe)
+ASN_PRINT_P(WeatherProbe)
+ASN_CODEC_P(WeatherReport)
+ASN_OER_P(WeatherReport)
+ASN_BER_P(WeatherReport)
+ASN_PRINT_P(WeatherReport)
+ASN_CODEC_V(WheelEndElectFault)
+ASN_OER_V(WheelEndElectFault)
+ASN_BER_P(WheelEndElectFault)
+ASN_PRINT_P(WheelEndElectFault)
+ASN_CODEC_V(WheelSensorStatus)
+ASN_OER_V(WheelSensorStatus)
+ASN_BER_P(WheelSensorStatus)
+ASN_PRINT_P(WheelSensorStatus)
+ASN_CODEC_V(WiperRate)
+ASN_OER_V(WiperRate)
+ASN_BER_P(WiperRate)
+ASN_PRINT_P(WiperRate)
+ASN_CODEC_P(WiperSet)
+ASN_OER_P(WiperSet)
+ASN_BER_P(WiperSet)
+ASN_PRINT_P(WiperSet)
+ASN_CODEC_V(WiperStatus)
+ASN_OER_V(WiperStatus)
+ASN_BER_P(WiperStatus)
+ASN_PRINT_P(WiperStatus)
+ASN_CODEC_P(WorkZone)
+ASN_OER_P(WorkZone)
+ASN_BER_P(WorkZone)
+ASN_PRINT_P(WorkZone)
+ASN_CODEC_P(WorkZone_element)
+ASN_OER_P(WorkZone_element)
+ASN_BER_P(WorkZone_element)
+ASN_PRINT_P(WorkZone_element)
+ASN_CODEC_P(WorkZone_element_item)
+ASN_OER_P(WorkZone_element_item)
+ASN_BER_P(WorkZone_element_item)
+ASN_PRINT_P(WorkZone_element_item)
+ASN_CODEC_V(YawRate)
+ASN_OER_V(YawRate)
+ASN_BER_P(YawRate)
+ASN_PRINT_P(YawRate)
+ASN_CODEC_V(YawRateConfidence)
+ASN_OER_V(YawRateConfidence)
+ASN_BER_P(YawRateConfidence)
+ASN_PRINT_P(YawRateConfidence)
+ASN_CODEC_V(Year)
+ASN_OER_V(Year)
+ASN_BER_P(Year)
+ASN_PRINT_P(Year)
+ASN_CODEC_V(ZoneLength)
+ASN_OER_V(ZoneLength)
+ASN_BER_P(ZoneLength)
+ASN_PRINT_P(ZoneLength)
+ASN_CODEC_V(Zoom)
+ASN_OER_V(Zoom)
+ASN_BER_P(Zoom)
+ASN_PRINT_P(Zoom)
+ASN_CODEC_P(_SeqOfPublicationData)
+ASN_OER_P(_SeqOfPublicationData)
+ASN_BER_P(_SeqOfPublicationData)
+ASN_PRINT_P(_SeqOfPublicationData)
+
+const ASN_TYPE asn_type_table[] =
+{
+	{ "AccelSteerYawRateConfidence", sizeof(AccelSteerYawRateConfidence), 0, sPerEnc_AccelSteerYawRateConfidence, sPerDec_AccelSteerYawRateConfidence, sOerEnc_AccelSteerYawRateConfidence, sOerDec_AccelSteerYawRateConfidence, sBerEnc_AccelSteerYawRateConfidence, sBerDec_AccelSteerYawRateConfidence, sPrint_AccelSteerYawRateConfidence, 0, 8, 8, 3, 3 },
+	{ "Acceleration", sizeof(Acceleration), 0, sPerEnc_Acceleration, sPerDec_Acceleration, sOerEnc_Acceleration, sOerDec_Acceleration, sBerEnc_Acceleration, sBerDec_Acceleration, sPrint_Acceleration, 0, 12, 12, 2, 2 },
+	{ "AccelerationConfidence", sizeof(AccelerationConfidence), 0, sPerEnc_AccelerationConfidence, sPerDec_AccelerationConfidence, sOerEnc_AccelerationConfidence, sOerDec_AccelerationConfidence, sBerEnc_AccelerationConfidence, sBerDec_AccelerationConfidence, sPrint_AccelerationConfidence, 0, 3, 3, 1, 1 },
+	{ "AccelerationSet4Way", sizeof(AccelerationSet4Way), 0, sPerEnc_AccelerationSet4Way, sPerDec_AccelerationSet4Way, sOerEnc_AccelerationSet4Way, sOerDec_AccelerationSet4Way, sBerEnc_AccelerationSet4Way, sBerDec_AccelerationSet4Way, sPrint_AccelerationSet4Way, 0, 48, 48, 7, 7 },
+	{ "Accept", sizeof(Accept), 0, sPerEnc_Accept, sPerDec_Accept, sOerEnc_Accept, sOerDec_Accept, sBerEnc_Accept, sBerDec_Accept, sPrint_Accept, ASN_SIZE_UNBOUNDED, 34, 0, 5, 0 },
+	{ "Accept_datexAccept_Type", sizeof(Accept_datexAccept_Type), 0, sPerEnc_Accept_datexAccept_Type, sPerDec_Accept_datexAccept_Type, sOerEnc_Accept_datexAccept_Type, sOerDec_Accept_datexAccept_Type, sBerEnc_Accept_datexAccept_Type, sBerDec_Accept_datexAccept_Type, sPrint_Accept_datexAccept_Type, ASN_SIZE_UNBOUNDED, 2, 0, 1, 0 },
+	{ "AddGrpB_Angle", sizeof(AddGrpB_Angle), sTest_AddGrpB_Angle, sPerEnc_AddGrpB_Angle, sPerDec_AddGrpB_Angle, sOerEnc_AddGrpB_Angle, sOerDec_AddGrpB_Angle, sBerEnc_AddGrpB_Angle, sBerDec_AddGrpB_Angle, sPrint_AddGrpB_Angle, 0, 8, 8, 1, 1 },
+	{ "AddGrpB_Elevation", sizeof(AddGrpB_Elevation), 0, sPerEnc_AddGrpB_Elevation, sPerDec_AddGrpB_Elevation, sOerEnc_AddGrpB_Elevation, sOerDec_AddGrpB_Elevation, sBerEnc_AddGrpB_Elevation, sBerDec_AddGrpB_Elevation, sPrint_AddGrpB_Elevation, 0, 16, 16, 2, 2 },
+	{ "AddGrpB_MsgCount", sizeof(AddGrpB_MsgCount), sTest_AddGrpB_MsgCount, sPerEnc_AddGrpB_MsgCount, sPerDec_AddGrpB_MsgCount, sOerEnc_AddGrpB_MsgCount, sOerDec_AddGrpB_MsgCount, sBerEnc_AddGrpB_MsgCount, sBerDec_AddGrpB_MsgCount, sPrint_AddGrpB_MsgCount, 0, 8, 8, 1, 1 },
+	{ "AddGrpB_TimeMark", sizeof(AddGrpB_TimeMark), sTest_AddGrpB_TimeMark, sPerEnc_AddGrpB_TimeMark, sPerDec_AddGrpB_TimeMark, sOerEnc_AddGrpB_TimeMark, sOerDec_AddGrpB_TimeMark, sBerEnc_AddGrpB_TimeMark, sBerDec_AddGrpB_TimeMark, sPrint_AddGrpB_TimeMark, 0, 63, 63, 11, 11 },
+	{ "AdvisorySpeed", sizeof(AdvisorySpeed), 0, sPerEnc_AdvisorySpeed, sPerDec_AdvisorySpeed, sOerEnc_AdvisorySpeed, sOerDec_AdvisorySpeed, sBerEnc_AdvisorySpeed, sBerDec_AdvisorySpeed, sPrint_AdvisorySpeed, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 9, 0, 2, 0 },
+	{ "AdvisorySpeedList", sizeof(AdvisorySpeedList), 0, sPerEnc_AdvisorySpeedList, sPerDec_AdvisorySpeedList, sOerEnc_AdvisorySpeedList, sOerDec_AdvisorySpeedList, sBerEnc_AdvisorySpeedList, sBerDec_AdvisorySpeedList, sPrint_AdvisorySpeedList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 13, 0, 4, 0 },
+	{ "AdvisorySpeedType", sizeof(AdvisorySpeedType), 0, sPerEnc_AdvisorySpeedType, sPerDec_AdvisorySpeedType, sOerEnc_AdvisorySpeedType, sOerDec_AdvisorySpeedType, sBerEnc_AdvisorySpeedType, sBerDec_AdvisorySpeedType, sPrint_AdvisorySpeedType, ASN_SIZE_EXT, 3, 3, 1, 1 },
+	{ "AdvisorySpeed_regional", sizeof(AdvisorySpeed_regional), 0, sPerEnc_AdvisorySpeed_regional, sPerDec_AdvisorySpeed_regional, sOerEnc_AdvisorySpeed_regional, sOerDec_AdvisorySpeed_regional, sBerEnc_AdvisorySpeed_regional, sBerDec_AdvisorySpeed_regional, sPrint_AdvisorySpeed_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "AllowedManeuvers", sizeof(AllowedManeuvers), 0, sPerEnc_AllowedManeuvers, sPerDec_AllowedManeuvers, sOerEnc_AllowedManeuvers, sOerDec_AllowedManeuvers, sBerEnc_AllowedManeuvers, sBerDec_AllowedManeuvers, sPrint_AllowedManeuvers, 0, 12, 12, 2, 2 },
+	{ "AlternateRequest", sizeof(AlternateRequest), 0, sPerEnc_AlternateRequest, sPerDec_AlternateRequest, sOerEnc_AlternateRequest, sOerDec_AlternateRequest, sBerEnc_AlternateRequest, sBerDec_AlternateRequest, sPrint_AlternateRequest, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 5, 0, 2, 0 },
+	{ "Altitude", sizeof(Altitude), 0, sPerEnc_Altitude, sPerDec_Altitude, sOerEnc_Altitude, sOerDec_Altitude, sBerEnc_Altitude, sBerDec_Altitude, sPrint_Altitude, 0, 24, 24, 5, 5 },
+	{ "AltitudeConfidence", sizeof(AltitudeConfidence), 0, sPerEnc_AltitudeConfidence, sPerDec_AltitudeConfidence, sOerEnc_AltitudeConfidence, sOerDec_AltitudeConfidence, sBerEnc_AltitudeConfidence, sBerDec_AltitudeConfidence, sPrint_AltitudeConfidence, 0, 4, 4, 1, 1 },
+	{ "AltitudeValue", sizeof(AltitudeValue), 0, sPerEnc_AltitudeValue, sPerDec_AltitudeValue, sOerEnc_AltitudeValue, sOerDec_AltitudeValue, sBerEnc_AltitudeValue, sBerDec_AltitudeValue, sPrint_AltitudeValue, 0, 20, 20, 4, 4 },
+	{ "AmbientAirPressure", sizeof(AmbientAirPressure), 0, sPerEnc_AmbientAirPressure, sPerDec_AmbientAirPressure, sOerEnc_AmbientAirPressure, sOerDec_AmbientAirPressure, sBerEnc_AmbientAirPressure, sBerDec_AmbientAirPressure, sPrint_AmbientAirPressure, 0, 8, 8, 1, 1 },
+	{ "AmbientAirTemperature", sizeof(AmbientAirTemperature), 0, sPerEnc_AmbientAirTemperature, sPerDec_AmbientAirTemperature, sOerEnc_AmbientAirTemperature, sOerDec_AmbientAirTemperature, sBerEnc_AmbientAirTemperature, sBerDec_AmbientAirTemperature, sPrint_AmbientAirTemperature, 0, 8, 8, 1, 1 },
+	{ "Angle", sizeof(Angle), 0, sPerEnc_Angle, sPerDec_Angle, sOerEnc_Angle, sOerDec_Angle, sBerEnc_Angle, sBerDec_Angle, sPrint_Angle, 0, 15, 15, 2, 2 },
+	{ "AnimalPropelledType", sizeof(AnimalPropelledType), 0, sPerEnc_AnimalPropelledType, sPerDec_AnimalPropelledType, sOerEnc_AnimalPropelledType, sOerDec_AnimalPropelledType, sBerEnc_AnimalPropelledType, sBerDec_AnimalPropelledType, sPrint_AnimalPropelledType, ASN_SIZE_EXT, 3, 3, 1, 1 },
+	{ "AnimalType", sizeof(AnimalType), 0, sPerEnc_AnimalType, sPerDec_AnimalType, sOerEnc_AnimalType, sOerDec_AnimalType, sBerEnc_AnimalType, sBerDec_AnimalType, sPrint_AnimalType, ASN_SIZE_EXT, 3, 3, 1, 1 },
+	{ "AntennaOffsetSet", sizeof(AntennaOffsetSet), 0, sPerEnc_AntennaOffsetSet, sPerDec_AntennaOffsetSet, sOerEnc_AntennaOffsetSet, sOerDec_AntennaOffsetSet, sBerEnc_AntennaOffsetSet, sBerDec_AntennaOffsetSet, sPrint_AntennaOffsetSet, 0, 31, 31, 6, 6 },
+	{ "AntiLockBrakeStatus", sizeof(AntiLockBrakeStatus), 0, sPerEnc_AntiLockBrakeStatus, sPerDec_AntiLockBrakeStatus, sOerEnc_AntiLockBrakeStatus, sOerDec_AntiLockBrakeStatus, sBerEnc_AntiLockBrakeStatus, sBerDec_AntiLockBrakeStatus, sPrint_AntiLockBrakeStatus, 0, 2, 2, 1, 1 },
+	{ "ApproachID", sizeof(ApproachID), 0, sPerEnc_ApproachID, sPerDec_ApproachID, sOerEnc_ApproachID, sOerDec_ApproachID, sBerEnc_ApproachID, sBerDec_ApproachID, sPrint_ApproachID, 0, 4, 4, 1, 1 },
+	{ "ApproachOrLane", sizeof(ApproachOrLane), 0, sPerEnc_ApproachOrLane, sPerDec_ApproachOrLane, sOerEnc_ApproachOrLane, sOerDec_ApproachOrLane, sBerEnc_ApproachOrLane, sBerDec_ApproachOrLane, sPrint_ApproachOrLane, 0, 5, 9, 2, 2 },
+	{ "Attachment", sizeof(Attachment), 0, sPerEnc_Attachment, sPerDec_Attachment, sOerEnc_Attachment, sOerDec_Attachment, sBerEnc_Attachment, sBerDec_Attachment, sPrint_Attachment, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "AttachmentRadius", sizeof(AttachmentRadius), 0, sPerEnc_AttachmentRadius, sPerDec_AttachmentRadius, sOerEnc_AttachmentRadius, sOerDec_AttachmentRadius, sBerEnc_AttachmentRadius, sBerDec_AttachmentRadius, sPrint_AttachmentRadius, 0, 8, 8, 1, 1 },
+	{ "AuxiliaryBrakeStatus", sizeof(AuxiliaryBrakeStatus), 0, sPerEnc_AuxiliaryBrakeStatus, sPerDec_AuxiliaryBrakeStatus, sOerEnc_AuxiliaryBrakeStatus, sOerDec_AuxiliaryBrakeStatus, sBerEnc_AuxiliaryBrakeStatus, sBerDec_AuxiliaryBrakeStatus, sPrint_AuxiliaryBrakeStatus, 0, 2, 2, 1, 1 },
+	{ "AxleLocation", sizeof(AxleLocation), 0, sPerEnc_AxleLocation, sPerDec_AxleLocation, sOerEnc_AxleLocation, sOerDec_AxleLocation, sBerEnc_AxleLocation, sBerDec_AxleLocation, sPrint_AxleLocation, 0, 8, 8, 1, 1 },
+	{ "AxleWeight", sizeof(AxleWeight), 0, sPerEnc_AxleWeight, sPerDec_AxleWeight, sOerEnc_AxleWeight, sOerDec_AxleWeight, sBerEnc_AxleWeight, sBerDec_AxleWeight, sPrint_AxleWeight, 0, 16, 16, 2, 2 },
+	{ "AxleWeightList", sizeof(AxleWeightList), 0, sPerEnc_AxleWeightList, sPerDec_AxleWeightList, sOerEnc_AxleWeightList, sOerDec_AxleWeightList, sBerEnc_AxleWeightList, sBerDec_AxleWeightList, sPrint_AxleWeightList, ASN_SIZE_EXT, 7, 436, 3, 66 },
+	{ "AxleWeightSet", sizeof(AxleWeightSet), 0, sPerEnc_AxleWeightSet, sPerDec_AxleWeightSet, sOerEnc_AxleWeightSet, sOerDec_AxleWeightSet, sBerEnc_AxleWeightSet, sBerDec_AxleWeightSet, sPrint_AxleWeightSet, ASN_SIZE_EXT, 3, 27, 1, 4 },
+	{ "BSMcoreData", sizeof(BSMcoreData), 0, sPerEnc_BSMcoreData, sPerDec_BSMcoreData, sOerEnc_BSMcoreData, sOerDec_BSMcoreData, sBerEnc_BSMcoreData, sBerDec_BSMcoreData, sPrint_BSMcoreData, 0, 290, 290, 46, 46 },
+	{ "BasicSafetyMessage", sizeof(BasicSafetyMessage), sTest_BasicSafetyMessage, sPerEnc_BasicSafetyMessage, sPerDec_BasicSafetyMessage, sOerEnc_BasicSafetyMessage, sOerDec_BasicSafetyMessage, sBerEnc_BasicSafetyMessage, sBerDec_BasicSafetyMessage, sPrint_BasicSafetyMessage, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 293, 0, 47, 0 },
+	{ "BasicSafetyMessage_partII", sizeof(BasicSafetyMessage_partII), 0, sPerEnc_BasicSafetyMessage_partII, sPerDec_BasicSafetyMessage_partII, sOerEnc_BasicSafetyMessage_partII, sOerDec_BasicSafetyMessage_partII, sBerEnc_BasicSafetyMessage_partII, sBerDec_BasicSafetyMessage_partII, sPrint_BasicSafetyMessage_partII, ASN_SIZE_UNBOUNDED, 25, 0, 4, 0 },
+	{ "BasicSafetyMessage_regional", sizeof(BasicSafetyMessage_regional), 0, sPerEnc_BasicSafetyMessage_regional, sPerDec_BasicSafetyMessage_regional, sOerEnc_BasicSafetyMessage_regional, sOerDec_BasicSafetyMessage_regional, sBerEnc_BasicSafetyMessage_regional, sBerDec_BasicSafetyMessage_regional, sPrint_BasicSafetyMessage_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "BasicVehicleClass", sizeof(BasicVehicleClass), 0, sPerEnc_BasicVehicleClass, sPerDec_BasicVehicleClass, sOerEnc_BasicVehicleClass, sOerDec_BasicVehicleClass, sBerEnc_BasicVehicleClass, sBerDec_BasicVehicleClass, sPrint_BasicVehicleClass, 0, 8, 8, 1, 1 },
+	{ "BasicVehicleRole", sizeof(BasicVehicleRole), 0, sPerEnc_BasicVehicleRole, sPerDec_BasicVehicleRole, sOerEnc_BasicVehicleRole, sOerDec_BasicVehicleRole, sBerEnc_BasicVehicleRole, sBerDec_BasicVehicleRole, sPrint_BasicVehicleRole, ASN_SIZE_EXT, 6, 6, 1, 1 },
+	{ "BrakeAppliedPressure", sizeof(BrakeAppliedPressure), 0, sPerEnc_BrakeAppliedPressure, sPerDec_BrakeAppliedPressure, sOerEnc_BrakeAppliedPressure, sOerDec_BrakeAppliedPressure, sBerEnc_BrakeAppliedPressure, sBerDec_BrakeAppliedPressure, sPrint_BrakeAppliedPressure, 0, 4, 4, 1, 1 },
+	{ "BrakeAppliedStatus", sizeof(BrakeAppliedStatus), 0, sPerEnc_BrakeAppliedStatus, sPerDec_BrakeAppliedStatus, sOerEnc_BrakeAppliedStatus, sOerDec_BrakeAppliedStatus, sBerEnc_BrakeAppliedStatus, sBerDec_BrakeAppliedStatus, sPrint_BrakeAppliedStatus, 0, 5, 5, 1, 1 },
+	{ "BrakeBoostApplied", sizeof(BrakeBoostApplied), 0, sPerEnc_BrakeBoostApplied, sPerDec_BrakeBoostApplied, sOerEnc_BrakeBoostApplied, sOerDec_BrakeBoostApplied, sBerEnc_BrakeBoostApplied, sBerDec_BrakeBoostApplied, sPrint_BrakeBoostApplied, 0, 2, 2, 1, 1 },
+	{ "BrakeSystemStatus", sizeof(BrakeSystemStatus), 0, sPerEnc_BrakeSystemStatus, sPerDec_BrakeSystemStatus, sOerEnc_BrakeSystemStatus, sOerDec_BrakeSystemStatus, sBerEnc_BrakeSystemStatus, sBerDec_BrakeSystemStatus, sPrint_BrakeSystemStatus, 0, 15, 15, 6, 6 },
+	{ "BumperHeight", sizeof(BumperHeight), 0, sPerEnc_BumperHeight, sPerDec_BumperHeight, sOerEnc_BumperHeight, sOerDec_BumperHeight, sBerEnc_BumperHeight, sBerDec_BumperHeight, sPrint_BumperHeight, 0, 7, 7, 1, 1 },
+	{ "BumperHeights", sizeof(BumperHeights), 0, sPerEnc_BumperHeights, sPerDec_BumperHeights, sOerEnc_BumperHeights, sOerDec_BumperHeights, sBerEnc_BumperHeights, sBerDec_BumperHeights, sPrint_BumperHeights, 0, 14, 14, 2, 2 },
+	{ "C2CAuthenticatedMessage", sizeof(C2CAuthenticatedMessage), sTest_C2CAuthenticatedMessage, sPerEnc_C2CAuthenticatedMessage, sPerDec_C2CAuthenticatedMessage, sOerEnc_C2CAuthenticatedMessage, sOerDec_C2CAuthenticatedMessage, sBerEnc_C2CAuthenticatedMessage, sBerDec_C2CAuthenticatedMessage, sPrint_C2CAuthenticatedMessage, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 60, 0, 9, 0 },
+	{ "C2CAuthenticatedMessage_datex_AuthenticationInfo_text", sizeof(C2CAuthenticatedMessage_datex_AuthenticationInfo_text), 0, sPerEnc_C2CAuthenticatedMessage_datex_AuthenticationInfo_text, sPerDec_C2CAuthenticatedMessage_datex_AuthenticationInfo_text, sOerEnc_C2CAuthenticatedMessage_datex_AuthenticationInfo_text, sOerDec_C2CAuthenticatedMessage_datex_AuthenticationInfo_text, sBerEnc_C2CAuthenticatedMessage_datex_AuthenticationInfo_text, sBerDec_C2CAuthenticatedMessage_datex_AuthenticationInfo_text, sPrint_C2CAuthenticatedMessage_datex_AuthenticationInfo_text, 0, 8, 2048, 1, 257 },
+	{ "CITSLog", sizeof(CITSLog), 0, sPerEnc_CITSLog, sPerDec_CITSLog, sOerEnc_CITSLog, sOerDec_CITSLog, sBerEnc_CITSLog, sBerDec_CITSLog, sPrint_CITSLog, ASN_SIZE_EXT, 90, 149, 14, 24 },
+	{ "CITSPVD", sizeof(CITSPVD), 0, sPerEnc_CITSPVD, sPerDec_CITSPVD, sOerEnc_CITSPVD, sOerDec_CITSPVD, sBerEnc_CITSPVD, sBerDec_CITSPVD, sPrint_CITSPVD, ASN_SIZE_EXT, 7, 322, 1, 48 },
+	{ "CITSPVD_worklanes", sizeof(CITSPVD_worklanes), 0, sPerEnc_CITSPVD_worklanes, sPerDec_CITSPVD_worklanes, sOerEnc_CITSPVD_worklanes, sOerDec_CITSPVD_worklanes, sBerEnc_CITSPVD_worklanes, sBerDec_CITSPVD_worklanes, sPrint_CITSPVD_worklanes, 0, 12, 132, 3, 18 },
+	{ "CITSRSA", sizeof(CITSRSA), 0, sPerEnc_CITSRSA, sPerDec_CITSRSA, sOerEnc_CITSRSA, sOerDec_CITSRSA, sBerEnc_CITSRSA, sBerDec_CITSRSA, sPrint_CITSRSA, ASN_SIZE_EXT, 7, 112, 1, 16 },
+	{ "CITSRSA_laneset", sizeof(CITSRSA_laneset), 0, sPerEnc_CITSRSA_laneset, sPerDec_CITSRSA_laneset, sOerEnc_CITSRSA_laneset, sOerDec_CITSRSA_laneset, sBerEnc_CITSRSA_laneset, sBerDec_CITSRSA_laneset, sPrint_CITSRSA_laneset, 0, 10, 34, 3, 6 },
+	{ "CargoWeight", sizeof(CargoWeight), 0, sPerEnc_CargoWeight, sPerDec_CargoWeight, sOerEnc_CargoWeight, sOerDec_CargoWeight, sBerEnc_CargoWeight, sBerDec_CargoWeight, sPrint_CargoWeight, 0, 16, 16, 2, 2 },
+	{ "Circle", sizeof(Circle), 0, sPerEnc_Circle, sPerDec_Circle, sOerEnc_Circle, sOerDec_Circle, sBerEnc_Circle, sBerDec_Circle, sPrint_Circle, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 81, 0, 12, 0 },
+	{ "CoarseHeading", sizeof(CoarseHeading), 0, sPerEnc_CoarseHeading, sPerDec_CoarseHeading, sOerEnc_CoarseHeading, sOerDec_CoarseHeading, sBerEnc_CoarseHeading, sBerDec_CoarseHeading, sPrint_CoarseHeading, 0, 8, 8, 1, 1 },
+	{ "CodeWord", sizeof(CodeWord), sTest_CodeWord, sPerEnc_CodeWord, sPerDec_CodeWord, sOerEnc_CodeWord, sOerDec_CodeWord, sBerEnc_CodeWord, sBerDec_CodeWord, sPrint_CodeWord, 0, 12, 132, 2, 17 },
+	{ "CoefficientOfFriction", sizeof(CoefficientOfFriction), 0, sPerEnc_CoefficientOfFriction, sPerDec_CoefficientOfFriction, sOerEnc_CoefficientOfFriction, sOerDec_CoefficientOfFriction, sBerEnc_CoefficientOfFriction, sBerDec_CoefficientOfFriction, sPrint_CoefficientOfFriction, 0, 6, 6, 1, 1 },
+	{ "CommonSafetyRequest", sizeof(CommonSafetyRequest), sTest_CommonSafetyRequest, sPerEnc_CommonSafetyRequest, sPerDec_CommonSafetyRequest, sOerEnc_CommonSafetyRequest, sOerDec_CommonSafetyRequest, sBerEnc_CommonSafetyRequest, sBerDec_CommonSafetyRequest, sPrint_CommonSafetyRequest, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 16, 0, 4, 0 },
+	{ "CommonSafetyRequest_regional", sizeof(CommonSafetyRequest_regional), 0, sPerEnc_CommonSafetyRequest_regional, sPerDec_CommonSafetyRequest_regional, sOerEnc_CommonSafetyRequest_regional, sOerDec_CommonSafetyRequest_regional, sBerEnc_CommonSafetyRequest_regional, sBerDec_CommonSafetyRequest_regional, sPrint_CommonSafetyRequest_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "ComputedLane", sizeof(ComputedLane), 0, sPerEnc_ComputedLane, sPerDec_ComputedLane, sOerEnc_ComputedLane, sOerDec_ComputedLane, sBerEnc_ComputedLane, sBerDec_ComputedLane, sPrint_ComputedLane, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 39, 0, 8, 0 },
+	{ "ComputedLane_offsetXaxis", sizeof(ComputedLane_offsetXaxis), 0, sPerEnc_ComputedLane_offsetXaxis, sPerDec_ComputedLane_offsetXaxis, sOerEnc_ComputedLane_offsetXaxis, sOerDec_ComputedLane_offsetXaxis, sBerEnc_ComputedLane_offsetXaxis, sBerDec_ComputedLane_offsetXaxis, sPrint_ComputedLane_offsetXaxis, 0, 13, 17, 3, 3 },
+	{ "ComputedLane_offsetYaxis", sizeof(ComputedLane_offsetYaxis), 0, sPerEnc_ComputedLane_offsetYaxis, sPerDec_ComputedLane_offsetYaxis, sOerEnc_ComputedLane_offsetYaxis, sOerDec_ComputedLane_offsetYaxis, sBerEnc_ComputedLane_offsetYaxis, sBerDec_ComputedLane_offsetYaxis, sPrint_ComputedLane_offsetYaxis, 0, 13, 17, 3, 3 },
+	{ "ComputedLane_regional", sizeof(ComputedLane_regional), 0, sPerEnc_ComputedLane_regional, sPerDec_ComputedLane_regional, sOerEnc_ComputedLane_regional, sOerDec_ComputedLane_regional, sBerEnc_ComputedLane_regional, sBerDec_ComputedLane_regional, sPrint_ComputedLane_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "Confidence", sizeof(Confidence), 0, sPerEnc_Confidence, sPerDec_Confidence, sOerEnc_Confidence, sOerDec_Confidence, sBerEnc_Confidence, sBerDec_Confidence, sPrint_Confidence, 0, 8, 8, 1, 1 },
+	{ "ConfidenceSet", sizeof(ConfidenceSet), 0, sPerEnc_ConfidenceSet, sPerDec_ConfidenceSet, sOerEnc_ConfidenceSet, sOerDec_ConfidenceSet, sBerEnc_ConfidenceSet, sBerDec_ConfidenceSet, sPrint_ConfidenceSet, ASN_SIZE_EXT, 8, 45, 1, 13 },
+	{ "ConnectingLane", sizeof(ConnectingLane), 0, sPerEnc_ConnectingLane, sPerDec_ConnectingLane, sOerEnc_ConnectingLane, sOerDec_ConnectingLane, sBerEnc_ConnectingLane, sBerDec_ConnectingLane, sPrint_ConnectingLane, 0, 9, 21, 2, 4 },
+	{ "Connection", sizeof(Connection), 0, sPerEnc_Connection, sPerDec_Connection, sOerEnc_Connection, sOerDec_Connection, sBerEnc_Connection, sBerDec_Connection, sPrint_Connection, 0, 13, 82, 3, 13 },
+	{ "ConnectionManeuverAssist", sizeof(ConnectionManeuverAssist), 0, sPerEnc_ConnectionManeuverAssist, sPerDec_ConnectionManeuverAssist, sOerEnc_ConnectionManeuverAssist, sOerDec_ConnectionManeuverAssist, sBerEnc_ConnectionManeuverAssist, sBerDec_ConnectionManeuverAssist, sPrint_ConnectionManeuverAssist, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 14, 0, 2, 0 },
+	{ "ConnectionManeuverAssist_addGrpC", sizeof(ConnectionManeuverAssist_addGrpC), sTest_ConnectionManeuverAssist_addGrpC, sPerEnc_ConnectionManeuverAssist_addGrpC, sPerDec_ConnectionManeuverAssist_addGrpC, sOerEnc_ConnectionManeuverAssist_addGrpC, sOerDec_ConnectionManeuverAssist_addGrpC, sBerEnc_ConnectionManeuverAssist_addGrpC, sBerDec_ConnectionManeuverAssist_addGrpC, sPrint_ConnectionManeuverAssist_addGrpC, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 45, 0, 9, 0 },
+	{ "ConnectionManeuverAssist_regional", sizeof(ConnectionManeuverAssist_regional), 0, sPerEnc_ConnectionManeuverAssist_regional, sPerDec_ConnectionManeuverAssist_regional, sOerEnc_ConnectionManeuverAssist_regional, sOerDec_ConnectionManeuverAssist_regional, sBerEnc_ConnectionManeuverAssist_regional, sBerDec_ConnectionManeuverAssist_regional, sPrint_ConnectionManeuverAssist_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "ConnectsToList", sizeof(ConnectsToList), 0, sPerEnc_ConnectsToList, sPerDec_ConnectsToList, sOerEnc_ConnectsToList, sOerDec_ConnectsToList, sBerEnc_ConnectsToList, sBerDec_ConnectsToList, sPrint_ConnectsToList, 0, 17, 1316, 5, 210 },
+	{ "Cost", sizeof(Cost), 0, sPerEnc_Cost, sPerDec_Cost, sOerEnc_Cost, sOerDec_Cost, sBerEnc_Cost, sBerDec_Cost, sPrint_Cost, 0, 56, 168, 7, 21 },
+	{ "Cost_amount_Currency_code", sizeof(Cost_amount_Currency_code), 0, sPerEnc_Cost_amount_Currency_code, sPerDec_Cost_amount_Currency_code, sOerEnc_Cost_amount_Currency_code, sOerDec_Cost_amount_Currency_code, sBerEnc_Cost_amount_Currency_code, sBerDec_Cost_amount_Currency_code, sPrint_Cost_amount_Currency_code, 0, 24, 24, 3, 3 },
+	{ "Count", sizeof(Count), sTest_Count, sPerEnc_Count, sPerDec_Count, sOerEnc_Count, sOerDec_Count, sBerEnc_Count, sBerDec_Count, sPrint_Count, 0, 6, 6, 1, 1 },
+	{ "DDate", sizeof(DDate), sTest_DDate, sPerEnc_DDate, sPerDec_DDate, sOerEnc_DDate, sOerDec_DDate, sBerEnc_DDate, sBerDec_DDate, sPrint_DDate, 0, 21, 21, 4, 4 },
+	{ "DDateTime", sizeof(DDateTime), 0, sPerEnc_DDateTime, sPerDec_DDateTime, sOerEnc_DDateTime, sOerDec_DDateTime, sBerEnc_DDateTime, sBerDec_DDateTime, sPrint_DDateTime, 0, 7, 66, 1, 11 },
+	{ "DDay", sizeof(DDay), 0, sPerEnc_DDay, sPerDec_DDay, sOerEnc_DDay, sOerDec_DDay, sBerEnc_DDay, sBerDec_DDay, sPrint_DDay, 0, 5, 5, 1, 1 },
+	{ "DFullTime", sizeof(DFullTime), sTest_DFullTime, sPerEnc_DFullTime, sPerDec_DFullTime, sOerEnc_DFullTime, sOerDec_DFullTime, sBerEnc_DFullTime, sBerDec_DFullTime, sPrint_DFullTime, 0, 32, 32, 6, 6 },
+	{ "DHour", sizeof(DHour), 0, sPerEnc_DHour, sPerDec_DHour, sOerEnc_DHour, sOerDec_DHour, sBerEnc_DHour, sBerDec_DHour, sPrint_DHour, 0, 5, 5, 1, 1 },
+	{ "DMinute", sizeof(DMinute), 0, sPerEnc_DMinute, sPerDec_DMinute, sOerEnc_DMinute, sOerDec_DMinute, sBerEnc_DMinute, sBerDec_DMinute, sPrint_DMinute, 0, 6, 6, 1, 1 },
+	{ "DMonth", sizeof(DMonth), 0, sPerEnc_DMonth, sPerDec_DMonth, sOerEnc_DMonth, sOerDec_DMonth, sBerEnc_DMonth, sBerDec_DMonth, sPrint_DMonth, 0, 4, 4, 1, 1 },
+	{ "DMonthDay", sizeof(DMonthDay), sTest_DMonthDay, sPerEnc_DMonthDay, sPerDec_DMonthDay, sOerEnc_DMonthDay, sOerDec_DMonthDay, sBerEnc_DMonthDay, sBerDec_DMonthDay, sPrint_DMonthDay, 0, 9, 9, 2, 2 },
+	{ "DOffset", sizeof(DOffset), 0, sPerEnc_DOffset, sPerDec_DOffset, sOerEnc_DOffset, sOerDec_DOffset, sBerEnc_DOffset, sBerDec_DOffset, sPrint_DOffset, 0, 11, 11, 2, 2 },
+	{ "DSRCmsgID", sizeof(DSRCmsgID), 0, sPerEnc_DSRCmsgID, sPerDec_DSRCmsgID, sOerEnc_DSRCmsgID, sOerDec_DSRCmsgID, sBerEnc_DSRCmsgID, sBerDec_DSRCmsgID, sPrint_DSRCmsgID, 0, 15, 15, 2, 2 },
+	{ "DSecond", sizeof(DSecond), 0, sPerEnc_DSecond, sPerDec_DSecond, sOerEnc_DSecond, sOerDec_DSecond, sBerEnc_DSecond, sBerDec_DSecond, sPrint_DSecond, 0, 16, 16, 2, 2 },
+	{ "DTime", sizeof(DTime), sTest_DTime, sPerEnc_DTime, sPerDec_DTime, sOerEnc_DTime, sOerDec_DTime, sBerEnc_DTime, sBerDec_DTime, sPrint_DTime, 0, 28, 39, 5, 7 },
+	{ "DYear", sizeof(DYear), 0, sPerEnc_DYear, sPerDec_DYear, sOerEnc_DYear, sOerDec_DYear, sBerEnc_DYear, sBerDec_DYear, sPrint_DYear, 0, 12, 12, 2, 2 },
+	{ "DYearMonth", sizeof(DYearMonth), sTest_DYearMonth, sPerEnc_DYearMonth, sPerDec_DYearMonth, sOerEnc_DYearMonth, sOerDec_DYearMonth, sBerEnc_DYearMonth, sBerDec_DYearMonth, sPrint_DYearMonth, 0, 16, 16, 3, 3 },
+	{ "DataParameters", sizeof(DataParameters), 0, sPerEnc_DataParameters, sPerDec_DataParameters, sOerEnc_DataParameters, sOerDec_DataParameters, sBerEnc_DataParameters, sBerDec_DataParameters, sPrint_DataParameters, ASN_SIZE_EXT, 5, 7177, 1, 1029 },
+	{ "DatexDataPacket", sizeof(DatexDataPacket), sTest_DatexDataPacket, sPerEnc_DatexDataPacket, sPerDec_DatexDataPacket, sOerEnc_DatexDataPacket, sOerDec_DatexDataPacket, sBerEnc_DatexDataPacket, sBerDec_DatexDataPacket, sPrint_DatexDataPacket, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "DatexDataPacket_datex_Crc_nbr", sizeof(DatexDataPacket_datex_Crc_nbr), 0, sPerEnc_DatexDataPacket_datex_Crc_nbr, sPerDec_DatexDataPacket_datex_Crc_nbr, sOerEnc_DatexDataPacket_datex_Crc_nbr, sOerDec_DatexDataPacket_datex_Crc_nbr, sBerEnc_DatexDataPacket_datex_Crc_nbr, sBerDec_DatexDataPacket_datex_Crc_nbr, sPrint_DatexDataPacket_datex_Crc_nbr, 0, 16, 16, 2, 2 },
+	{ "DatexDataPacket_datex_Version_number", sizeof(DatexDataPacket_datex_Version_number), 0, sPerEnc_DatexDataPacket_datex_Version_number, sPerDec_DatexDataPacket_datex_Version_number, sOerEnc_DatexDataPacket_datex_Version_number, sOerDec_DatexDataPacket_datex_Version_number, sBerEnc_DatexDataPacket_datex_Version_number, sBerDec_DatexDataPacket_datex_Version_number, sPrint_DatexDataPacket_datex_Version_number, ASN_SIZE_EXT, 2, 2, 1, 1 },
+	{ "Day", sizeof(Day), 0, sPerEnc_Day, sPerDec_Day, sOerEnc_Day, sOerDec_Day, sBerEnc_Day, sBerDec_Day, sPrint_Day, 0, 8, 8, 1, 1 },
+	{ "DayOfWeek", sizeof(DayOfWeek), 0, sPerEnc_DayOfWeek, sPerDec_DayOfWeek, sOerEnc_DayOfWeek, sOerDec_DayOfWeek, sBerEnc_DayOfWeek, sBerDec_DayOfWeek, sPrint_DayOfWeek, 0, 3, 3, 1, 1 },
+	{ "DegreesLat", sizeof(DegreesLat), 0, sPerEnc_DegreesLat, sPerDec_DegreesLat, sOerEnc_DegreesLat, sOerDec_DegreesLat, sBerEnc_DegreesLat, sBerDec_DegreesLat, sPrint_DegreesLat, 0, 8, 8, 1, 1 },
+	{ "DegreesLong", sizeof(DegreesLong), 0, sPerEnc_DegreesLong, sPerDec_DegreesLong, sOerEnc_DegreesLong, sOerDec_DegreesLong, sBerEnc_DegreesLong, sBerDec_DegreesLong, sPrint_DegreesLong, 0, 9, 9, 2, 2 },
+	{ "DeltaAngle", sizeof(DeltaAngle), 0, sPerEnc_DeltaAngle, sPerDec_DeltaAngle, sOerEnc_DeltaAngle, sOerDec_DeltaAngle, sBerEnc_DeltaAngle, sBerDec_DeltaAngle, sPrint_DeltaAngle, 0, 9, 9, 2, 2 },
+	{ "DeltaTime", sizeof(DeltaTime), 0, sPerEnc_DeltaTime, sPerDec_DeltaTime, sOerEnc_DeltaTime, sOerDec_DeltaTime, sBerEnc_DeltaTime, sBerDec_DeltaTime, sPrint_DeltaTime, 0, 8, 8, 1, 1 },
+	{ "DescriptiveName", sizeof(DescriptiveName), 0, sPerEnc_DescriptiveName, sPerDec_DescriptiveName, sOerEnc_DescriptiveName, sOerDec_DescriptiveName, sBerEnc_DescriptiveName, sBerDec_DescriptiveName, sPrint_DescriptiveName, 0, 13, 447, 2, 64 },
+	{ "DirectionOfUse", sizeof(DirectionOfUse), 0, sPerEnc_DirectionOfUse, sPerDec_DirectionOfUse, sOerEnc_DirectionOfUse, sOerDec_DirectionOfUse, sBerEnc_DirectionOfUse, sBerDec_DirectionOfUse, sPrint_DirectionOfUse, 0, 2, 2, 1, 1 },
+	{ "DisabledVehicle", sizeof(DisabledVehicle), 0, sPerEnc_DisabledVehicle, sPerDec_DisabledVehicle, sOerEnc_DisabledVehicle, sOerDec_DisabledVehicle, sBerEnc_DisabledVehicle, sBerDec_DisabledVehicle, sPrint_DisabledVehicle, ASN_SIZE_EXT, 7, 15, 3, 6 },
+	{ "DistanceUnits", sizeof(DistanceUnits), 0, sPerEnc_DistanceUnits, sPerDec_DistanceUnits, sOerEnc_DistanceUnits, sOerDec_DistanceUnits, sBerEnc_DistanceUnits, sBerDec_DistanceUnits, sPrint_DistanceUnits, 0, 3, 3, 1, 1 },
+	{ "DriveAxleLiftAirPressure", sizeof(DriveAxleLiftAirPressure), 0, sPerEnc_DriveAxleLiftAirPressure, sPerDec_DriveAxleLiftAirPressure, sOerEnc_DriveAxleLiftAirPressure, sOerDec_DriveAxleLiftAirPressure, sBerEnc_DriveAxleLiftAirPressure, sBerDec_DriveAxleLiftAirPressure, sPrint_DriveAxleLiftAirPressure, 0, 10, 10, 2, 2 },
+	{ "DriveAxleLocation", sizeof(DriveAxleLocation), 0, sPerEnc_DriveAxleLocation, sPerDec_DriveAxleLocation, sOerEnc_DriveAxleLocation, sOerDec_DriveAxleLocation, sBerEnc_DriveAxleLocation, sBerDec_DriveAxleLocation, sPrint_DriveAxleLocation, 0, 8, 8, 1, 1 },
+	{ "DriveAxleLubePressure", sizeof(DriveAxleLubePressure), 0, sPerEnc_DriveAxleLubePressure, sPerDec_DriveAxleLubePressure, sOerEnc_DriveAxleLubePressure, sOerDec_DriveAxleLubePressure, sBerEnc_DriveAxleLubePressure, sBerDec_DriveAxleLubePressure, sPrint_DriveAxleLubePressure, 0, 8, 8, 1, 1 },
+	{ "DriveAxleTemperature", sizeof(DriveAxleTemperature), 0, sPerEnc_DriveAxleTemperature, sPerDec_DriveAxleTemperature, sOerEnc_DriveAxleTemperature, sOerDec_DriveAxleTemperature, sBerEnc_DriveAxleTemperature, sBerDec_DriveAxleTemperature, sPrint_DriveAxleTemperature, 0, 8, 8, 2, 2 },
+	{ "DrivenLineOffsetLg", sizeof(DrivenLineOffsetLg), 0, sPerEnc_DrivenLineOffsetLg, sPerDec_DrivenLineOffsetLg, sOerEnc_DrivenLineOffsetLg, sOerDec_DrivenLineOffsetLg, sBerEnc_DrivenLineOffsetLg, sBerDec_DrivenLineOffsetLg, sPrint_DrivenLineOffsetLg, 0, 16, 16, 2, 2 },
+	{ "DrivenLineOffsetSm", sizeof(DrivenLineOffsetSm), 0, sPerEnc_DrivenLineOffsetSm, sPerDec_DrivenLineOffsetSm, sOerEnc_DrivenLineOffsetSm, sOerDec_DrivenLineOffsetSm, sBerEnc_DrivenLineOffsetSm, sBerDec_DrivenLineOffsetSm, sPrint_DrivenLineOffsetSm, 0, 12, 12, 2, 2 },
+	{ "DrivingWheelAngle", sizeof(DrivingWheelAngle), 0, sPerEnc_DrivingWheelAngle, sPerDec_DrivingWheelAngle, sOerEnc_DrivingWheelAngle, sOerDec_DrivingWheelAngle, sBerEnc_DrivingWheelAngle, sBerDec_DrivingWheelAngle, sPrint_DrivingWheelAngle, 0, 8, 8, 1, 1 },
+	{ "Duration", sizeof(Duration), sTest_Duration, sPerEnc_Duration, sPerDec_Duration, sOerEnc_Duration, sOerDec_Duration, sBerEnc_Duration, sBerDec_Duration, sPrint_Duration, 0, 12, 12, 2, 2 },
+	{ "Elevation", sizeof(Elevation), 0, sPerEnc_Elevation, sPerDec_Elevation, sOerEnc_Elevation, sOerDec_Elevation, sBerEnc_Elevation, sBerDec_Elevation, sPrint_Elevation, 0, 16, 16, 4, 4 },
+	{ "ElevationConfidence", sizeof(ElevationConfidence), 0, sPerEnc_ElevationConfidence, sPerDec_ElevationConfidence, sOerEnc_ElevationConfidence, sOerDec_ElevationConfidence, sBerEnc_ElevationConfidence, sBerDec_ElevationConfidence, sPrint_ElevationConfidence, 0, 4, 4, 1, 1 },
+	{ "EmergencyDetails", sizeof(EmergencyDetails), 0, sPerEnc_EmergencyDetails, sPerDec_EmergencyDetails, sOerEnc_EmergencyDetails, sOerDec_EmergencyDetails, sBerEnc_EmergencyDetails, sBerDec_EmergencyDetails, sPrint_EmergencyDetails, ASN_SIZE_EXT, 15, 41, 5, 10 },
+	{ "EmergencyVehicleAlert", sizeof(EmergencyVehicleAlert), sTest_EmergencyVehicleAlert, sPerEnc_EmergencyVehicleAlert, sPerDec_EmergencyVehicleAlert, sOerEnc_EmergencyVehicleAlert, sOerDec_EmergencyVehicleAlert, sBerEnc_EmergencyVehicleAlert, sBerDec_EmergencyVehicleAlert, sPrint_EmergencyVehicleAlert, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 43, 0, 7, 0 },
+	{ "EmergencyVehicleAlert_regional", sizeof(EmergencyVehicleAlert_regional), 0, sPerEnc_EmergencyVehicleAlert_regional, sPerDec_EmergencyVehicleAlert_regional, sOerEnc_EmergencyVehicleAlert_regional, sOerDec_EmergencyVehicleAlert_regional, sBerEnc_EmergencyVehicleAlert_regional, sBerDec_EmergencyVehicleAlert_regional, sPrint_EmergencyVehicleAlert_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "EmissionType", sizeof(EmissionType), 0, sPerEnc_EmissionType, sPerDec_EmissionType, sOerEnc_EmissionType, sOerDec_EmissionType, sBerEnc_EmissionType, sBerDec_EmissionType, sPrint_EmissionType, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "EnabledLaneList", sizeof(EnabledLaneList), 0, sPerEnc_EnabledLaneList, sPerDec_EnabledLaneList, sOerEnc_EnabledLaneList, sOerDec_EnabledLaneList, sBerEnc_EnabledLaneList, sBerDec_EnabledLaneList, sPrint_EnabledLaneList, 0, 12, 132, 3, 18 },
+	{ "EssMobileFriction", sizeof(EssMobileFriction), 0, sPerEnc_EssMobileFriction, sPerDec_EssMobileFriction, sOerEnc_EssMobileFriction, sOerDec_EssMobileFriction, sBerEnc_EssMobileFriction, sBerDec_EssMobileFriction, sPrint_EssMobileFriction, 0, 7, 7, 1, 1 },
+	{ "EssPrecipRate", sizeof(EssPrecipRate), 0, sPerEnc_EssPrecipRate, sPerDec_EssPrecipRate, sOerEnc_EssPrecipRate, sOerDec_EssPrecipRate, sBerEnc_EssPrecipRate, sBerDec_EssPrecipRate, sPrint_EssPrecipRate, 0, 16, 16, 2, 2 },
+	{ "EssPrecipSituation", sizeof(EssPrecipSituation), 0, sPerEnc_EssPrecipSituation, sPerDec_EssPrecipSituation, sOerEnc_EssPrecipSituation, sOerDec_EssPrecipSituation, sBerEnc_EssPrecipSituation, sBerDec_EssPrecipSituation, sPrint_EssPrecipSituation, 0, 4, 4, 1, 1 },
+	{ "EssPrecipYesNo", sizeof(EssPrecipYesNo), 0, sPerEnc_EssPrecipYesNo, sPerDec_EssPrecipYesNo, sOerEnc_EssPrecipYesNo, sOerDec_EssPrecipYesNo, sBerEnc_EssPrecipYesNo, sBerDec_EssPrecipYesNo, sPrint_EssPrecipYesNo, 0, 2, 2, 1, 1 },
+	{ "EssSolarRadiation", sizeof(EssSolarRadiation), 0, sPerEnc_EssSolarRadiation, sPerDec_EssSolarRadiation, sOerEnc_EssSolarRadiation, sOerDec_EssSolarRadiation, sBerEnc_EssSolarRadiation, sBerDec_EssSolarRadiation, sPrint_EssSolarRadiation, 0, 16, 16, 2, 2 },
+	{ "EventDescription", sizeof(EventDescription), 0, sPerEnc_EventDescription, sPerDec_EventDescription, sOerEnc_EventDescription, sOerDec_EventDescription, sBerEnc_EventDescription, sBerDec_EventDescription, sPrint_EventDescription, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 22, 0, 3, 0 },
+	{ "EventDescription_description", sizeof(EventDescription_description), 0, sPerEnc_EventDescription_description, sPerDec_EventDescription_description, sOerEnc_EventDescription_description, sOerDec_EventDescription_description, sBerEnc_EventDescription_description, sBerDec_EventDescription_description, sPrint_EventDescription_description, 0, 19, 131, 4, 18 },
+	{ "EventDescription_regional", sizeof(EventDescription_regional), 0, sPerEnc_EventDescription_regional, sPerDec_EventDescription_regional, sOerEnc_EventDescription_regional, sOerDec_EventDescription_regional, sBerEnc_EventDescription_regional, sBerDec_EventDescription_regional, sPrint_EventDescription_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "ExitService", sizeof(ExitService), 0, sPerEnc_ExitService, sPerDec_ExitService, sOerEnc_ExitService, sOerDec_ExitService, sBerEnc_ExitService, sBerDec_ExitService, sPrint_ExitService, 0, 16, 1876, 5, 290 },
+	{ "ExitService_element", sizeof(ExitService_element), 0, sPerEnc_ExitService_element, sPerDec_ExitService_element, sOerEnc_ExitService_element, sOerDec_ExitService_element, sBerEnc_ExitService_element, sBerDec_ExitService_element, sPrint_ExitService_element, 0, 12, 117, 3, 18 },
+	{ "ExitService_element_item", sizeof(ExitService_element_item), 0, sPerEnc_ExitService_element_item, sPerDec_ExitService_element_item, sOerEnc_ExitService_element_item, sOerDec_ExitService_element_item, sBerEnc_ExitService_element_item, sBerDec_ExitService_element_item, sPrint_ExitService_element_item, 0, 12, 117, 3, 18 },
+	{ "Extent", sizeof(Extent), 0, sPerEnc_Extent, sPerDec_Extent, sOerEnc_Extent, sOerDec_Extent, sBerEnc_Extent, sBerDec_Extent, sPrint_Extent, 0, 4, 4, 1, 1 },
+	{ "ExteriorLights", sizeof(ExteriorLights), 0, sPerEnc_ExteriorLights, sPerDec_ExteriorLights, sOerEnc_ExteriorLights, sOerDec_ExteriorLights, sBerEnc_ExteriorLights, sBerDec_ExteriorLights, sPrint_ExteriorLights, ASN_SIZE_EXT, 10, 10, 4, 4 },
+	{ "FrED", sizeof(FrED), 0, sPerEnc_FrED, sPerDec_FrED, sOerEnc_FrED, sOerDec_FrED, sBerEnc_FrED, sBerDec_FrED, sPrint_FrED, 0, 32, 32, 4, 4 },
+	{ "FuelType", sizeof(FuelType), 0, sPerEnc_FuelType, sPerDec_FuelType, sOerEnc_FuelType, sOerDec_FuelType, sBerEnc_FuelType, sBerDec_FuelType, sPrint_FuelType, 0, 4, 4, 1, 1 },
+	{ "FullPositionVector", sizeof(FullPositionVector), 0, sPerEnc_FullPositionVector, sPerDec_FullPositionVector, sOerEnc_FullPositionVector, sOerDec_FullPositionVector, sBerEnc_FullPositionVector, sBerDec_FullPositionVector, sPrint_FullPositionVector, ASN_SIZE_EXT, 72, 239, 10, 40 },
+	{ "FurtherInfoID", sizeof(FurtherInfoID), 0, sPerEnc_FurtherInfoID, sPerDec_FurtherInfoID, sOerEnc_FurtherInfoID, sOerDec_FurtherInfoID, sBerEnc_FurtherInfoID, sBerDec_FurtherInfoID, sPrint_FurtherInfoID, 0, 16, 16, 2, 2 },
+	{ "GNSSstatus", sizeof(GNSSstatus), 0, sPerEnc_GNSSstatus, sPerDec_GNSSstatus, sOerEnc_GNSSstatus, sOerDec_GNSSstatus, sBerEnc_GNSSstatus, sBerDec_GNSSstatus, sPrint_GNSSstatus, 0, 8, 8, 1, 1 },
+	{ "GenericLane", sizeof(GenericLane), 0, sPerEnc_GenericLane, sPerDec_GenericLane, sOerEnc_GenericLane, sOerDec_GenericLane, sBerEnc_GenericLane, sBerDec_GenericLane, sPrint_GenericLane, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 83, 0, 18, 0 },
+	{ "GenericLane_regional", sizeof(GenericLane_regional), 0, sPerEnc_GenericLane_regional, sPerDec_GenericLane_regional, sOerEnc_GenericLane_regional, sOerDec_GenericLane_regional, sBerEnc_GenericLane_regional, sBerDec_GenericLane_regional, sPrint_GenericLane_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "GenericLocations", sizeof(GenericLocations), 0, sPerEnc_GenericLocations, sPerDec_GenericLocations, sOerEnc_GenericLocations, sOerDec_GenericLocations, sBerEnc_GenericLocations, sBerDec_GenericLocations, sPrint_GenericLocations, ASN_SIZE_EXT, 8, 8, 3, 3 },
+	{ "GenericSignage", sizeof(GenericSignage), 0, sPerEnc_GenericSignage, sPerDec_GenericSignage, sOerEnc_GenericSignage, sOerDec_GenericSignage, sBerEnc_GenericSignage, sBerDec_GenericSignage, sPrint_GenericSignage, 0, 16, 1876, 5, 290 },
+	{ "GenericSignage_element", sizeof(GenericSignage_element), 0, sPerEnc_GenericSignage_element, sPerDec_GenericSignage_element, sOerEnc_GenericSignage_element, sOerDec_GenericSignage_element, sBerEnc_GenericSignage_element, sBerDec_GenericSignage_element, sPrint_GenericSignage_element, 0, 12, 117, 3, 18 },
+	{ "GenericSignage_element_item", sizeof(GenericSignage_element_item), 0, sPerEnc_GenericSignage_element_item, sPerDec_GenericSignage_element_item, sOerEnc_GenericSignage_element_item, sOerDec_GenericSignage_element_item, sBerEnc_GenericSignage_element_item, sBerDec_GenericSignage_element_item, sPrint_GenericSignage_element_item, 0, 12, 117, 3, 18 },
+	{ "GeographicalPath", sizeof(GeographicalPath), 0, sPerEnc_GeographicalPath, sPerDec_GeographicalPath, sOerEnc_GeographicalPath, sOerDec_GeographicalPath, sBerEnc_GeographicalPath, sBerDec_GeographicalPath, sPrint_GeographicalPath, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 10, 0, 2, 0 },
+	{ "GeographicalPath_description", sizeof(GeographicalPath_description), 0, sPerEnc_GeographicalPath_description, sPerDec_GeographicalPath_description, sOerEnc_GeographicalPath_description, sOerDec_GeographicalPath_description, sBerEnc_GeographicalPath_description, sBerDec_GeographicalPath_description, sPrint_GeographicalPath_description, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 46, 0, 12, 0 },
+	{ "GeographicalPath_regional", sizeof(GeographicalPath_regional), 0, sPerEnc_GeographicalPath_regional, sPerDec_GeographicalPath_regional, sOerEnc_GeographicalPath_regional, sOerDec_GeographicalPath_regional, sBerEnc_GeographicalPath_regional, sBerDec_GeographicalPath_regional, sPrint_GeographicalPath_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "GeometricProjection", sizeof(GeometricProjection), 0, sPerEnc_GeometricProjection, sPerDec_GeometricProjection, sOerEnc_GeometricProjection, sOerDec_GeometricProjection, sBerEnc_GeometricProjection, sBerDec_GeometricProjection, sPrint_GeometricProjection, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 101, 0, 15, 0 },
+	{ "GeometricProjection_regional", sizeof(GeometricProjection_regional), 0, sPerEnc_GeometricProjection_regional, sPerDec_GeometricProjection_regional, sOerEnc_GeometricProjection_regional, sOerDec_GeometricProjection_regional, sBerEnc_GeometricProjection_regional, sBerDec_GeometricProjection_regional, sPrint_GeometricProjection_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "GrossDistance", sizeof(GrossDistance), 0, sPerEnc_GrossDistance, sPerDec_GrossDistance, sOerEnc_GrossDistance, sOerDec_GrossDistance, sBerEnc_GrossDistance, sBerDec_GrossDistance, sPrint_GrossDistance, 0, 10, 10, 2, 2 },
+	{ "GrossSpeed", sizeof(GrossSpeed), 0, sPerEnc_GrossSpeed, sPerDec_GrossSpeed, sOerEnc_GrossSpeed, sOerDec_GrossSpeed, sBerEnc_GrossSpeed, sBerDec_GrossSpeed, sPrint_GrossSpeed, 0, 5, 5, 1, 1 },
+	{ "Header", sizeof(Header), 0, sPerEnc_Header, sPerDec_Header, sOerEnc_Header, sOerDec_Header, sBerEnc_Header, sBerDec_Header, sPrint_Header, ASN_SIZE_EXT, 5, 60, 1, 10 },
+	{ "HeaderOptions", sizeof(HeaderOptions), 0, sPerEnc_HeaderOptions, sPerDec_HeaderOptions, sOerEnc_HeaderOptions, sOerDec_HeaderOptions, sBerEnc_HeaderOptions, sBerDec_HeaderOptions, sPrint_HeaderOptions, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 8, 0, 1, 0 },
+	{ "Heading", sizeof(Heading), 0, sPerEnc_Heading, sPerDec_Heading, sOerEnc_Heading, sOerDec_Heading, sBerEnc_Heading, sBerDec_Heading, sPrint_Heading, 0, 15, 15, 2, 2 },
+	{ "HeadingConfidence", sizeof(HeadingConfidence), 0, sPerEnc_HeadingConfidence, sPerDec_HeadingConfidence, sOerEnc_HeadingConfidence, sOerDec_HeadingConfidence, sBerEnc_HeadingConfidence, sBerDec_HeadingConfidence, sPrint_HeadingConfidence, 0, 3, 3, 1, 1 },
+	{ "HeadingSlice", sizeof(HeadingSlice), 0, sPerEnc_HeadingSlice, sPerDec_HeadingSlice, sOerEnc_HeadingSlice, sOerDec_HeadingSlice, sBerEnc_HeadingSlice, sBerDec_HeadingSlice, sPrint_HeadingSlice, 0, 16, 16, 2, 2 },
+	{ "Holiday", sizeof(Holiday), 0, sPerEnc_Holiday, sPerDec_Holiday, sOerEnc_Holiday, sOerDec_Holiday, sBerEnc_Holiday, sBerDec_Holiday, sPrint_Holiday, 0, 1, 1, 1, 1 },
+	{ "Hour", sizeof(Hour), 0, sPerEnc_Hour, sPerDec_Hour, sOerEnc_Hour, sOerDec_Hour, sBerEnc_Hour, sBerDec_Hour, sPrint_Hour, 0, 8, 8, 1, 1 },
+	{ "HumanPropelledType", sizeof(HumanPropelledType), 0, sPerEnc_HumanPropelledType, sPerDec_HumanPropelledType, sOerEnc_HumanPropelledType, sOerDec_HumanPropelledType, sBerEnc_HumanPropelledType, sBerDec_HumanPropelledType, sPrint_HumanPropelledType, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "ITIScodes", sizeof(ITIScodes), 0, sPerEnc_ITIScodes, sPerDec_ITIScodes, sOerEnc_ITIScodes, sOerDec_ITIScodes, sBerEnc_ITIScodes, sBerDec_ITIScodes, sPrint_ITIScodes, 0, 16, 16, 2, 2 },
+	{ "ITIScodesAndText", sizeof(ITIScodesAndText), 0, sPerEnc_ITIScodesAndText, sPerDec_ITIScodesAndText, sOerEnc_ITIScodesAndText, sOerDec_ITIScodesAndText, sBerEnc_ITIScodesAndText, sBerDec_ITIScodesAndText, sPrint_ITIScodesAndText, 0, 24, 3201707, 5, 400402 },
+	{ "ITIScodesAndText_element", sizeof(ITIScodesAndText_element), 0, sPerEnc_ITIScodesAndText_element, sPerDec_ITIScodesAndText_element, sOerEnc_ITIScodesAndText_element, sOerDec_ITIScodesAndText_element, sBerEnc_ITIScodesAndText_element, sBerDec_ITIScodesAndText_element, sPrint_ITIScodesAndText_element, 0, 17, 32017, 3, 4004 },
+	{ "ITIScodesAndText_element_item", sizeof(ITIScodesAndText_element_item), 0, sPerEnc_ITIScodesAndText_element_item, sPerDec_ITIScodesAndText_element_item, sOerEnc_ITIScodesAndText_element_item, sOerDec_ITIScodesAndText_element_item, sBerEnc_ITIScodesAndText_element_item, sBerDec_ITIScodesAndText_element_item, sPrint_ITIScodesAndText_element_item, 0, 17, 32017, 3, 4004 },
+	{ "ITIStext", sizeof(ITIStext), 0, sPerEnc_ITIStext, sPerDec_ITIStext, sOerEnc_ITIStext, sOerDec_ITIStext, sBerEnc_ITIStext, sBerDec_ITIStext, sPrint_ITIStext, 0, 16, 32016, 2, 4003 },
+	{ "ITIStextPhrase", sizeof(ITIStextPhrase), 0, sPerEnc_ITIStextPhrase, sPerDec_ITIStextPhrase, sOerEnc_ITIStextPhrase, sOerDec_ITIStextPhrase, sBerEnc_ITIStextPhrase, sBerDec_ITIStextPhrase, sPrint_ITIStextPhrase, 0, 11, 116, 2, 17 },
+	{ "IncidentResponseEquipment", sizeof(IncidentResponseEquipment), 0, sPerEnc_IncidentResponseEquipment, sPerDec_IncidentResponseEquipment, sOerEnc_IncidentResponseEquipment, sOerDec_IncidentResponseEquipment, sBerEnc_IncidentResponseEquipment, sBerDec_IncidentResponseEquipment, sPrint_IncidentResponseEquipment, ASN_SIZE_EXT, 8, 8, 3, 3 },
+	{ "Initiate", sizeof(Initiate), 0, sPerEnc_Initiate, sPerDec_Initiate, sOerEnc_Initiate, sOerDec_Initiate, sBerEnc_Initiate, sBerDec_Initiate, sPrint_Initiate, 0, 16, 2592, 2, 324 },
+	{ "IntersectionAccessPoint", sizeof(IntersectionAccessPoint), 0, sPerEnc_IntersectionAccessPoint, sPerDec_IntersectionAccessPoint, sOerEnc_IntersectionAccessPoint, sOerDec_IntersectionAccessPoint, sBerEnc_IntersectionAccessPoint, sBerDec_IntersectionAccessPoint, sPrint_IntersectionAccessPoint, ASN_SIZE_EXT, 7, 11, 2, 2 },
+	{ "IntersectionCollision", sizeof(IntersectionCollision), sTest_IntersectionCollision, sPerEnc_IntersectionCollision, sPerDec_IntersectionCollision, sOerEnc_IntersectionCollision, sOerDec_IntersectionCollision, sBerEnc_IntersectionCollision, sBerDec_IntersectionCollision, sPrint_IntersectionCollision, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 81, 0, 15, 0 },
+	{ "IntersectionCollision_regional", sizeof(IntersectionCollision_regional), 0, sPerEnc_IntersectionCollision_regional, sPerDec_IntersectionCollision_regional, sOerEnc_IntersectionCollision_regional, sOerDec_IntersectionCollision_regional, sBerEnc_IntersectionCollision_regional, sBerDec_IntersectionCollision_regional, sPrint_IntersectionCollision_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "IntersectionGeometry", sizeof(IntersectionGeometry), 0, sPerEnc_IntersectionGeometry, sPerDec_IntersectionGeometry, sOerEnc_IntersectionGeometry, sOerDec_IntersectionGeometry, sBerEnc_IntersectionGeometry, sBerDec_IntersectionGeometry, sPrint_IntersectionGeometry, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 187, 0, 34, 0 },
+	{ "IntersectionGeometryList", sizeof(IntersectionGeometryList), 0, sPerEnc_IntersectionGeometryList, sPerDec_IntersectionGeometryList, sOerEnc_IntersectionGeometryList, sOerDec_IntersectionGeometryList, sBerEnc_IntersectionGeometryList, sBerDec_IntersectionGeometryList, sPrint_IntersectionGeometryList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 192, 0, 36, 0 },
+	{ "IntersectionGeometry_regional", sizeof(IntersectionGeometry_regional), 0, sPerEnc_IntersectionGeometry_regional, sPerDec_IntersectionGeometry_regional, sOerEnc_IntersectionGeometry_regional, sOerDec_IntersectionGeometry_regional, sBerEnc_IntersectionGeometry_regional, sBerDec_IntersectionGeometry_regional, sPrint_IntersectionGeometry_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "IntersectionID", sizeof(IntersectionID), 0, sPerEnc_IntersectionID, sPerDec_IntersectionID, sOerEnc_IntersectionID, sOerDec_IntersectionID, sBerEnc_IntersectionID, sBerDec_IntersectionID, sPrint_IntersectionID, 0, 16, 16, 2, 2 },
+	{ "IntersectionReferenceID", sizeof(IntersectionReferenceID), 0, sPerEnc_IntersectionReferenceID, sPerDec_IntersectionReferenceID, sOerEnc_IntersectionReferenceID, sOerDec_IntersectionReferenceID, sBerEnc_IntersectionReferenceID, sBerDec_IntersectionReferenceID, sPrint_IntersectionReferenceID, 0, 17, 33, 3, 5 },
+	{ "IntersectionState", sizeof(IntersectionState), 0, sPerEnc_IntersectionState, sPerDec_IntersectionState, sOerEnc_IntersectionState, sOerDec_IntersectionState, sBerEnc_IntersectionState, sBerDec_IntersectionState, sPrint_IntersectionState, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 79, 0, 15, 0 },
+	{ "IntersectionStateList", sizeof(IntersectionStateList), 0, sPerEnc_IntersectionStateList, sPerDec_IntersectionStateList, sOerEnc_IntersectionStateList, sOerDec_IntersectionStateList, sBerEnc_IntersectionStateList, sBerDec_IntersectionStateList, sPrint_IntersectionStateList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 84, 0, 17, 0 },
+	{ "IntersectionState_addGrpC", sizeof(IntersectionState_addGrpC), sTest_IntersectionState_addGrpC, sPerEnc_IntersectionState_addGrpC, sPerDec_IntersectionState_addGrpC, sOerEnc_IntersectionState_addGrpC, sOerDec_IntersectionState_addGrpC, sBerEnc_IntersectionState_addGrpC, sBerDec_IntersectionState_addGrpC, sPrint_IntersectionState_addGrpC, ASN_SIZE_EXT, 2, 456, 1, 73 },
+	{ "IntersectionState_regional", sizeof(IntersectionState_regional), 0, sPerEnc_IntersectionState_regional, sPerDec_IntersectionState_regional, sOerEnc_IntersectionState_regional, sOerDec_IntersectionState_regional, sBerEnc_IntersectionState_regional, sBerDec_IntersectionState_regional, sPrint_IntersectionState_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "IntersectionStatusObject", sizeof(IntersectionStatusObject), 0, sPerEnc_IntersectionStatusObject, sPerDec_IntersectionStatusObject, sOerEnc_IntersectionStatusObject, sOerDec_IntersectionStatusObject, sBerEnc_IntersectionStatusObject, sBerDec_IntersectionStatusObject, sPrint_IntersectionStatusObject, 0, 16, 16, 2, 2 },
+	{ "IsDolly", sizeof(IsDolly), 0, sPerEnc_IsDolly, sPerDec_IsDolly, sOerEnc_IsDolly, sOerDec_IsDolly, sBerEnc_IsDolly, sBerDec_IsDolly, sPrint_IsDolly, 0, 1, 1, 1, 1 },
+	{ "Iso3833VehicleType", sizeof(Iso3833VehicleType), 0, sPerEnc_Iso3833VehicleType, sPerDec_Iso3833VehicleType, sOerEnc_Iso3833VehicleType, sOerDec_Iso3833VehicleType, sBerEnc_Iso3833VehicleType, sBerDec_Iso3833VehicleType, sPrint_Iso3833VehicleType, 0, 7, 7, 1, 1 },
+	{ "J1939data", sizeof(J1939data), 0, sPerEnc_J1939data, sPerDec_J1939data, sOerEnc_J1939data, sOerDec_J1939data, sBerEnc_J1939data, sBerDec_J1939data, sPrint_J1939data, ASN_SIZE_EXT, 11, 1541, 2, 275 },
+	{ "LaneAttributes", sizeof(LaneAttributes), 0, sPerEnc_LaneAttributes, sPerDec_LaneAttributes, sOerEnc_LaneAttributes, sOerDec_LaneAttributes, sBerEnc_LaneAttributes, sBerDec_LaneAttributes, sPrint_LaneAttributes, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 26, 0, 7, 0 },
+	{ "LaneAttributes_Barrier", sizeof(LaneAttributes_Barrier), 0, sPerEnc_LaneAttributes_Barrier, sPerDec_LaneAttributes_Barrier, sOerEnc_LaneAttributes_Barrier, sOerDec_LaneAttributes_Barrier, sBerEnc_LaneAttributes_Barrier, sBerDec_LaneAttributes_Barrier, sPrint_LaneAttributes_Barrier, 0, 16, 16, 2, 2 },
+	{ "LaneAttributes_Bike", sizeof(LaneAttributes_Bike), 0, sPerEnc_LaneAttributes_Bike, sPerDec_LaneAttributes_Bike, sOerEnc_LaneAttributes_Bike, sOerDec_LaneAttributes_Bike, sBerEnc_LaneAttributes_Bike, sBerDec_LaneAttributes_Bike, sPrint_LaneAttributes_Bike, 0, 16, 16, 2, 2 },
+	{ "LaneAttributes_Crosswalk", sizeof(LaneAttributes_Crosswalk), 0, sPerEnc_LaneAttributes_Crosswalk, sPerDec_LaneAttributes_Crosswalk, sOerEnc_LaneAttributes_Crosswalk, sOerDec_LaneAttributes_Crosswalk, sBerEnc_LaneAttributes_Crosswalk, sBerDec_LaneAttributes_Crosswalk, sPrint_LaneAttributes_Crosswalk, 0, 16, 16, 2, 2 },
+	{ "LaneAttributes_Parking", sizeof(LaneAttributes_Parking), 0, sPerEnc_LaneAttributes_Parking, sPerDec_LaneAttributes_Parking, sOerEnc_LaneAttributes_Parking, sOerDec_LaneAttributes_Parking, sBerEnc_LaneAttributes_Parking, sBerDec_LaneAttributes_Parking, sPrint_LaneAttributes_Parking, 0, 16, 16, 2, 2 },
+	{ "LaneAttributes_Sidewalk", sizeof(LaneAttributes_Sidewalk), 0, sPerEnc_LaneAttributes_Sidewalk, sPerDec_LaneAttributes_Sidewalk, sOerEnc_LaneAttributes_Sidewalk, sOerDec_LaneAttributes_Sidewalk, sBerEnc_LaneAttributes_Sidewalk, sBerDec_LaneAttributes_Sidewalk, sPrint_LaneAttributes_Sidewalk, 0, 16, 16, 2, 2 },
+	{ "LaneAttributes_Striping", sizeof(LaneAttributes_Striping), 0, sPerEnc_LaneAttributes_Striping, sPerDec_LaneAttributes_Striping, sOerEnc_LaneAttributes_Striping, sOerDec_LaneAttributes_Striping, sBerEnc_LaneAttributes_Striping, sBerDec_LaneAttributes_Striping, sPrint_LaneAttributes_Striping, 0, 16, 16, 2, 2 },
+	{ "LaneAttributes_TrackedVehicle", sizeof(LaneAttributes_TrackedVehicle), 0, sPerEnc_LaneAttributes_TrackedVehicle, sPerDec_LaneAttributes_TrackedVehicle, sOerEnc_LaneAttributes_TrackedVehicle, sOerDec_LaneAttributes_TrackedVehicle, sBerEnc_LaneAttributes_TrackedVehicle, sBerDec_LaneAttributes_TrackedVehicle, sPrint_LaneAttributes_TrackedVehicle, 0, 16, 16, 2, 2 },
+	{ "LaneAttributes_Vehicle", sizeof(LaneAttributes_Vehicle), 0, sPerEnc_LaneAttributes_Vehicle, sPerDec_LaneAttributes_Vehicle, sOerEnc_LaneAttributes_Vehicle, sOerDec_LaneAttributes_Vehicle, sBerEnc_LaneAttributes_Vehicle, sBerDec_LaneAttributes_Vehicle, sPrint_LaneAttributes_Vehicle, ASN_SIZE_EXT, 9, 9, 3, 3 },
+	{ "LaneConnectionID", sizeof(LaneConnectionID), 0, sPerEnc_LaneConnectionID, sPerDec_LaneConnectionID, sOerEnc_LaneConnectionID, sOerDec_LaneConnectionID, sBerEnc_LaneConnectionID, sBerDec_LaneConnectionID, sPrint_LaneConnectionID, 0, 8, 8, 1, 1 },
+	{ "LaneDataAttribute", sizeof(LaneDataAttribute), 0, sPerEnc_LaneDataAttribute, sPerDec_LaneDataAttribute, sOerEnc_LaneDataAttribute, sOerDec_LaneDataAttribute, sBerEnc_LaneDataAttribute, sBerDec_LaneDataAttribute, sPrint_LaneDataAttribute, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 12, 0, 2, 0 },
+	{ "LaneDataAttributeList", sizeof(LaneDataAttributeList), 0, sPerEnc_LaneDataAttributeList, sPerDec_LaneDataAttributeList, sOerEnc_LaneDataAttributeList, sOerDec_LaneDataAttributeList, sBerEnc_LaneDataAttributeList, sBerDec_LaneDataAttributeList, sPrint_LaneDataAttributeList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 15, 0, 4, 0 },
+	{ "LaneDataAttribute_addGrpB", sizeof(LaneDataAttribute_addGrpB), sTest_LaneDataAttribute_addGrpB, sPerEnc_LaneDataAttribute_addGrpB, sPerDec_LaneDataAttribute_addGrpB, sOerEnc_LaneDataAttribute_addGrpB, sOerDec_LaneDataAttribute_addGrpB, sBerEnc_LaneDataAttribute_addGrpB, sBerDec_LaneDataAttribute_addGrpB, sPrint_LaneDataAttribute_addGrpB, ASN_SIZE_EXT, 1, 1, 1, 1 },
+	{ "LaneDataAttribute_regional", sizeof(LaneDataAttribute_regional), 0, sPerEnc_LaneDataAttribute_regional, sPerDec_LaneDataAttribute_regional, sOerEnc_LaneDataAttribute_regional, sOerDec_LaneDataAttribute_regional, sBerEnc_LaneDataAttribute_regional, sBerDec_LaneDataAttribute_regional, sPrint_LaneDataAttribute_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "LaneDirection", sizeof(LaneDirection), 0, sPerEnc_LaneDirection, sPerDec_LaneDirection, sOerEnc_LaneDirection, sOerDec_LaneDirection, sBerEnc_LaneDirection, sBerDec_LaneDirection, sPrint_LaneDirection, 0, 2, 2, 1, 1 },
+	{ "LaneID", sizeof(LaneID), 0, sPerEnc_LaneID, sPerDec_LaneID, sOerEnc_LaneID, sOerDec_LaneID, sBerEnc_LaneID, sBerDec_LaneID, sPrint_LaneID, 0, 8, 8, 1, 1 },
+	{ "LaneList", sizeof(LaneList), 0, sPerEnc_LaneList, sPerDec_LaneList, sOerEnc_LaneList, sOerDec_LaneList, sBerEnc_LaneList, sBerDec_LaneList, sPrint_LaneList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 91, 0, 20, 0 },
+	{ "LaneSharing", sizeof(LaneSharing), 0, sPerEnc_LaneSharing, sPerDec_LaneSharing, sOerEnc_LaneSharing, sOerDec_LaneSharing, sBerEnc_LaneSharing, sBerDec_LaneSharing, sPrint_LaneSharing, 0, 10, 10, 2, 2 },
+	{ "LaneTypeAttributes", sizeof(LaneTypeAttributes), 0, sPerEnc_LaneTypeAttributes, sPerDec_LaneTypeAttributes, sOerEnc_LaneTypeAttributes, sOerDec_LaneTypeAttributes, sBerEnc_LaneTypeAttributes, sBerDec_LaneTypeAttributes, sPrint_LaneTypeAttributes, ASN_SIZE_EXT, 13, 20, 3, 4 },
+	{ "LaneWidth", sizeof(LaneWidth), 0, sPerEnc_LaneWidth, sPerDec_LaneWidth, sOerEnc_LaneWidth, sOerDec_LaneWidth, sBerEnc_LaneWidth, sBerDec_LaneWidth, sPrint_LaneWidth, 0, 15, 15, 2, 2 },
+	{ "Latitude", sizeof(Latitude), 0, sPerEnc_Latitude, sPerDec_Latitude, sOerEnc_Latitude, sOerDec_Latitude, sBerEnc_Latitude, sBerDec_Latitude, sPrint_Latitude, 0, 31, 31, 4, 4 },
+	{ "LatitudeDMS", sizeof(LatitudeDMS), 0, sPerEnc_LatitudeDMS, sPerDec_LatitudeDMS, sOerEnc_LatitudeDMS, sOerDec_LatitudeDMS, sBerEnc_LatitudeDMS, sBerDec_LatitudeDMS, sPrint_LatitudeDMS, 0, 26, 26, 4, 4 },
+	{ "LatitudeDMS2", sizeof(LatitudeDMS2), 0, sPerEnc_LatitudeDMS2, sPerDec_LatitudeDMS2, sOerEnc_LatitudeDMS2, sOerDec_LatitudeDMS2, sBerEnc_LatitudeDMS2, sBerDec_LatitudeDMS2, sPrint_LatitudeDMS2, 0, 27, 27, 4, 4 },
+	{ "LayerID", sizeof(LayerID), 0, sPerEnc_LayerID, sPerDec_LayerID, sOerEnc_LayerID, sOerDec_LayerID, sBerEnc_LayerID, sBerDec_LayerID, sPrint_LayerID, 0, 7, 7, 1, 1 },
+	{ "LayerType", sizeof(LayerType), 0, sPerEnc_LayerType, sPerDec_LayerType, sOerEnc_LayerType, sOerDec_LayerType, sBerEnc_LayerType, sBerDec_LayerType, sPrint_LayerType, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "LightbarInUse", sizeof(LightbarInUse), 0, sPerEnc_LightbarInUse, sPerDec_LightbarInUse, sOerEnc_LightbarInUse, sOerDec_LightbarInUse, sBerEnc_LightbarInUse, sBerDec_LightbarInUse, sPrint_LightbarInUse, 0, 3, 3, 1, 1 },
+	{ "Location_quality", sizeof(Location_quality), sTest_Location_quality, sPerEnc_Location_quality, sPerDec_Location_quality, sOerEnc_Location_quality, sOerDec_Location_quality, sBerEnc_Location_quality, sBerDec_Location_quality, sPrint_Location_quality, 0, 3, 3, 1, 1 },
+	{ "Location_tech", sizeof(Location_tech), sTest_Location_tech, sPerEnc_Location_tech, sPerDec_Location_tech, sOerEnc_Location_tech, sOerDec_Location_tech, sBerEnc_Location_tech, sBerDec_Location_tech, sPrint_Location_tech, ASN_SIZE_EXT, 5, 5, 1, 1 },
+	{ "Login", sizeof(Login), 0, sPerEnc_Login, sPerDec_Login, sOerEnc_Login, sOerDec_Login, sBerEnc_Login, sBerDec_Login, sPrint_Login, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 82, 0, 12, 0 },
+	{ "Login_datexLogin_EncodingRules_id", sizeof(Login_datexLogin_EncodingRules_id), 0, sPerEnc_Login_datexLogin_EncodingRules_id, sPerDec_Login_datexLogin_EncodingRules_id, sOerEnc_Login_datexLogin_EncodingRules_id, sOerDec_Login_datexLogin_EncodingRules_id, sBerEnc_Login_datexLogin_EncodingRules_id, sBerDec_Login_datexLogin_EncodingRules_id, sPrint_Login_datexLogin_EncodingRules_id, ASN_SIZE_UNBOUNDED, 8, 0, 2, 0 },
+	{ "Login_datexLogin_Initiator_cd", sizeof(Login_datexLogin_Initiator_cd), 0, sPerEnc_Login_datexLogin_Initiator_cd, sPerDec_Login_datexLogin_Initiator_cd, sOerEnc_Login_datexLogin_Initiator_cd, sOerDec_Login_datexLogin_Initiator_cd, sBerEnc_Login_datexLogin_Initiator_cd, sBerDec_Login_datexLogin_Initiator_cd, sPrint_Login_datexLogin_Initiator_cd, ASN_SIZE_EXT, 2, 2, 1, 1 },
+	{ "Logout", sizeof(Logout), 0, sPerEnc_Logout, sPerDec_Logout, sOerEnc_Logout, sOerDec_Logout, sBerEnc_Logout, sBerDec_Logout, sPrint_Logout, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "Longitude", sizeof(Longitude), 0, sPerEnc_Longitude, sPerDec_Longitude, sOerEnc_Longitude, sOerDec_Longitude, sBerEnc_Longitude, sBerDec_Longitude, sPrint_Longitude, 0, 32, 32, 4, 4 },
+	{ "LongitudeDMS", sizeof(LongitudeDMS), 0, sPerEnc_LongitudeDMS, sPerDec_LongitudeDMS, sOerEnc_LongitudeDMS, sOerDec_LongitudeDMS, sBerEnc_LongitudeDMS, sBerDec_LongitudeDMS, sPrint_LongitudeDMS, 0, 27, 27, 4, 4 },
+	{ "LongitudeDMS2", sizeof(LongitudeDMS2), 0, sPerEnc_LongitudeDMS2, sPerDec_LongitudeDMS2, sOerEnc_LongitudeDMS2, sOerDec_LongitudeDMS2, sBerEnc_LongitudeDMS2, sBerDec_LongitudeDMS2, sPrint_LongitudeDMS2, 0, 28, 28, 5, 5 },
+	{ "MUTCDCode", sizeof(MUTCDCode), 0, sPerEnc_MUTCDCode, sPerDec_MUTCDCode, sOerEnc_MUTCDCode, sOerDec_MUTCDCode, sBerEnc_MUTCDCode, sBerDec_MUTCDCode, sPrint_MUTCDCode, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "ManeuverAssistList", sizeof(ManeuverAssistList), 0, sPerEnc_ManeuverAssistList, sPerDec_ManeuverAssistList, sOerEnc_ManeuverAssistList, sOerDec_ManeuverAssistList, sBerEnc_ManeuverAssistList, sBerDec_ManeuverAssistList, sPrint_ManeuverAssistList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 18, 0, 4, 0 },
+	{ "MapData", sizeof(MapData), sTest_MapData, sPerEnc_MapData, sPerDec_MapData, sOerEnc_MapData, sOerDec_MapData, sBerEnc_MapData, sBerDec_MapData, sPrint_MapData, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 16, 0, 3, 0 },
+	{ "MapData_addGrpC", sizeof(MapData_addGrpC), sTest_MapData_addGrpC, sPerEnc_MapData_addGrpC, sPerDec_MapData_addGrpC, sOerEnc_MapData_addGrpC, sOerDec_MapData_addGrpC, sBerEnc_MapData_addGrpC, sBerDec_MapData_addGrpC, sPrint_MapData_addGrpC, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 2, 0, 1, 0 },
+	{ "MapData_regional", sizeof(MapData_regional), 0, sPerEnc_MapData_regional, sPerDec_MapData_regional, sOerEnc_MapData_regional, sOerDec_MapData_regional, sBerEnc_MapData_regional, sBerDec_MapData_regional, sPrint_MapData_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "MaxTimetoChange", sizeof(MaxTimetoChange), 0, sPerEnc_MaxTimetoChange, sPerDec_MaxTimetoChange, sOerEnc_MaxTimetoChange, sOerDec_MaxTimetoChange, sBerEnc_MaxTimetoChange, sBerDec_MaxTimetoChange, sPrint_MaxTimetoChange, 0, 12, 12, 2, 2 },
+	{ "MergeDivergeNodeAngle", sizeof(MergeDivergeNodeAngle), 0, sPerEnc_MergeDivergeNodeAngle, sPerDec_MergeDivergeNodeAngle, sOerEnc_MergeDivergeNodeAngle, sOerDec_MergeDivergeNodeAngle, sBerEnc_MergeDivergeNodeAngle, sBerDec_MergeDivergeNodeAngle, sPrint_MergeDivergeNodeAngle, 0, 9, 9, 2, 2 },
+	{ "MessageBLOB", sizeof(MessageBLOB), sTest_MessageBLOB, sPerEnc_MessageBLOB, sPerDec_MessageBLOB, sOerEnc_MessageBLOB, sOerDec_MessageBLOB, sBerEnc_MessageBLOB, sBerDec_MessageBLOB, sPrint_MessageBLOB, 0, 91, 16011, 11, 2003 },
+	{ "MessageFrame", sizeof(MessageFrame), 0, sPerEnc_MessageFrame, sPerDec_MessageFrame, sOerEnc_MessageFrame, sOerDec_MessageFrame, sBerEnc_MessageFrame, sBerDec_MessageFrame, sPrint_MessageFrame, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 32, 0, 4, 0 },
+	{ "MinTimetoChange", sizeof(MinTimetoChange), 0, sPerEnc_MinTimetoChange, sPerDec_MinTimetoChange, sOerEnc_MinTimetoChange, sOerDec_MinTimetoChange, sBerEnc_MinTimetoChange, sBerDec_MinTimetoChange, sPrint_MinTimetoChange, 0, 12, 12, 2, 2 },
+	{ "Minute", sizeof(Minute), 0, sPerEnc_Minute, sPerDec_Minute, sOerEnc_Minute, sOerDec_Minute, sBerEnc_Minute, sBerDec_Minute, sPrint_Minute, 0, 8, 8, 1, 1 },
+	{ "MinuteOfTheYear", sizeof(MinuteOfTheYear), 0, sPerEnc_MinuteOfTheYear, sPerDec_MinuteOfTheYear, sOerEnc_MinuteOfTheYear, sOerDec_MinuteOfTheYear, sBerEnc_MinuteOfTheYear, sBerDec_MinuteOfTheYear, sPrint_MinuteOfTheYear, 0, 20, 20, 4, 4 },
+	{ "MinutesAngle", sizeof(MinutesAngle), 0, sPerEnc_MinutesAngle, sPerDec_MinutesAngle, sOerEnc_MinutesAngle, sOerDec_MinutesAngle, sBerEnc_MinutesAngle, sBerDec_MinutesAngle, sPrint_MinutesAngle, 0, 6, 6, 1, 1 },
+	{ "MinutesDuration", sizeof(MinutesDuration), 0, sPerEnc_MinutesDuration, sPerDec_MinutesDuration, sOerEnc_MinutesDuration, sOerDec_MinutesDuration, sBerEnc_MinutesDuration, sBerDec_MinutesDuration, sPrint_MinutesDuration, 0, 15, 15, 2, 2 },
+	{ "Month", sizeof(Month), 0, sPerEnc_Month, sPerDec_Month, sOerEnc_Month, sOerDec_Month, sBerEnc_Month, sBerDec_Month, sPrint_Month, 0, 8, 8, 1, 1 },
+	{ "MotorizedPropelledType", sizeof(MotorizedPropelledType), 0, sPerEnc_MotorizedPropelledType, sPerDec_MotorizedPropelledType, sOerEnc_MotorizedPropelledType, sOerDec_MotorizedPropelledType, sBerEnc_MotorizedPropelledType, sBerDec_MotorizedPropelledType, sPrint_MotorizedPropelledType, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "MovementEvent", sizeof(MovementEvent), 0, sPerEnc_MovementEvent, sPerDec_MovementEvent, sOerEnc_MovementEvent, sOerDec_MovementEvent, sBerEnc_MovementEvent, sBerDec_MovementEvent, sPrint_MovementEvent, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 8, 0, 2, 0 },
+	{ "MovementEventList", sizeof(MovementEventList), 0, sPerEnc_MovementEventList, sPerDec_MovementEventList, sOerEnc_MovementEventList, sOerDec_MovementEventList, sBerEnc_MovementEventList, sBerDec_MovementEventList, sPrint_MovementEventList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 12, 0, 4, 0 },
+	{ "MovementEvent_addGrpB", sizeof(MovementEvent_addGrpB), sTest_MovementEvent_addGrpB, sPerEnc_MovementEvent_addGrpB, sPerDec_MovementEvent_addGrpB, sOerEnc_MovementEvent_addGrpB, sOerDec_MovementEvent_addGrpB, sBerEnc_MovementEvent_addGrpB, sBerDec_MovementEvent_addGrpB, sPrint_MovementEvent_addGrpB, ASN_SIZE_EXT, 18, 76, 3, 12 },
+	{ "MovementEvent_regional", sizeof(MovementEvent_regional), 0, sPerEnc_MovementEvent_regional, sPerDec_MovementEvent_regional, sOerEnc_MovementEvent_regional, sOerDec_MovementEvent_regional, sBerEnc_MovementEvent_regional, sBerDec_MovementEvent_regional, sPrint_MovementEvent_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "MovementList", sizeof(MovementList), 0, sPerEnc_MovementList, sPerDec_MovementList, sOerEnc_MovementList, sOerDec_MovementList, sBerEnc_MovementList, sBerDec_MovementList, sPrint_MovementList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 32, 0, 8, 0 },
+	{ "MovementPhaseState", sizeof(MovementPhaseState), 0, sPerEnc_MovementPhaseState, sPerDec_MovementPhaseState, sOerEnc_MovementPhaseState, sOerDec_MovementPhaseState, sBerEnc_MovementPhaseState, sBerDec_MovementPhaseState, sPrint_MovementPhaseState, 0, 4, 4, 1, 1 },
+	{ "MovementState", sizeof(MovementState), 0, sPerEnc_MovementState, sPerDec_MovementState, sOerEnc_MovementState, sOerDec_MovementState, sBerEnc_MovementState, sBerDec_MovementState, sPrint_MovementState, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 24, 0, 6, 0 },
+	{ "MovementState_regional", sizeof(MovementState_regional), 0, sPerEnc_MovementState_regional, sPerDec_MovementState_regional, sOerEnc_MovementState_regional, sOerDec_MovementState_regional, sBerEnc_MovementState_regional, sBerDec_MovementState_regional, sPrint_MovementState_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "MsgCRC", sizeof(MsgCRC), 0, sPerEnc_MsgCRC, sPerDec_MsgCRC, sOerEnc_MsgCRC, sOerDec_MsgCRC, sBerEnc_MsgCRC, sBerDec_MsgCRC, sPrint_MsgCRC, 0, 16, 16, 2, 2 },
+	{ "MsgCount", sizeof(MsgCount), 0, sPerEnc_MsgCount, sPerDec_MsgCount, sOerEnc_MsgCount, sOerDec_MsgCount, sBerEnc_MsgCount, sBerDec_MsgCount, sPrint_MsgCount, 0, 7, 7, 1, 1 },
+	{ "MultiVehicleResponse", sizeof(MultiVehicleResponse), 0, sPerEnc_MultiVehicleResponse, sPerDec_MultiVehicleResponse, sOerEnc_MultiVehicleResponse, sOerDec_MultiVehicleResponse, sBerEnc_MultiVehicleResponse, sBerDec_MultiVehicleResponse, sPrint_MultiVehicleResponse, 0, 2, 2, 1, 1 },
+	{ "NMEA_MsgType", sizeof(NMEA_MsgType), 0, sPerEnc_NMEA_MsgType, sPerDec_NMEA_MsgType, sOerEnc_NMEA_MsgType, sOerDec_NMEA_MsgType, sBerEnc_NMEA_MsgType, sBerDec_NMEA_MsgType, sPrint_NMEA_MsgType, 0, 15, 15, 2, 2 },
+	{ "NMEA_Payload", sizeof(NMEA_Payload), 0, sPerEnc_NMEA_Payload, sPerDec_NMEA_Payload, sOerEnc_NMEA_Payload, sOerDec_NMEA_Payload, sBerEnc_NMEA_Payload, sBerDec_NMEA_Payload, sPrint_NMEA_Payload, 0, 18, 8194, 2, 1026 },
+	{ "NMEA_Revision", sizeof(NMEA_Revision), 0, sPerEnc_NMEA_Revision, sPerDec_NMEA_Revision, sOerEnc_NMEA_Revision, sOerDec_NMEA_Revision, sBerEnc_NMEA_Revision, sBerDec_NMEA_Revision, sPrint_NMEA_Revision, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "NMEAcorrections", sizeof(NMEAcorrections), sTest_NMEAcorrections, sPerEnc_NMEAcorrections, sPerDec_NMEAcorrections, sOerEnc_NMEAcorrections, sOerDec_NMEAcorrections, sBerEnc_NMEAcorrections, sBerDec_NMEAcorrections, sPrint_NMEAcorrections, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 24, 0, 3, 0 },
+	{ "NMEAcorrections_regional", sizeof(NMEAcorrections_regional), 0, sPerEnc_NMEAcorrections_regional, sPerDec_NMEAcorrections_regional, sOerEnc_NMEAcorrections_regional, sOerDec_NMEAcorrections_regional, sBerEnc_NMEAcorrections_regional, sBerDec_NMEAcorrections_regional, sPrint_NMEAcorrections_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "NodeAttributeLL", sizeof(NodeAttributeLL), 0, sPerEnc_NodeAttributeLL, sPerDec_NodeAttributeLL, sOerEnc_NodeAttributeLL, sOerDec_NodeAttributeLL, sBerEnc_NodeAttributeLL, sBerDec_NodeAttributeLL, sPrint_NodeAttributeLL, ASN_SIZE_EXT, 5, 5, 1, 1 },
+	{ "NodeAttributeLLList", sizeof(NodeAttributeLLList), 0, sPerEnc_NodeAttributeLLList, sPerDec_NodeAttributeLLList, sOerEnc_NodeAttributeLLList, sOerDec_NodeAttributeLLList, sBerEnc_NodeAttributeLLList, sBerDec_NodeAttributeLLList, sPrint_NodeAttributeLLList, ASN_SIZE_EXT, 8, 43, 3, 10 },
+	{ "NodeAttributeSetLL", sizeof(NodeAttributeSetLL), 0, sPerEnc_NodeAttributeSetLL, sPerDec_NodeAttributeSetLL, sOerEnc_NodeAttributeSetLL, sOerDec_NodeAttributeSetLL, sBerEnc_NodeAttributeSetLL, sBerDec_NodeAttributeSetLL, sPrint_NodeAttributeSetLL, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 8, 0, 1, 0 },
+	{ "NodeAttributeSetLL_regional", sizeof(NodeAttributeSetLL_regional), 0, sPerEnc_NodeAttributeSetLL_regional, sPerDec_NodeAttributeSetLL_regional, sOerEnc_NodeAttributeSetLL_regional, sOerDec_NodeAttributeSetLL_regional, sBerEnc_NodeAttributeSetLL_regional, sBerDec_NodeAttributeSetLL_regional, sPrint_NodeAttributeSetLL_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "NodeAttributeSetXY", sizeof(NodeAttributeSetXY), 0, sPerEnc_NodeAttributeSetXY, sPerDec_NodeAttributeSetXY, sOerEnc_NodeAttributeSetXY, sOerDec_NodeAttributeSetXY, sBerEnc_NodeAttributeSetXY, sBerDec_NodeAttributeSetXY, sPrint_NodeAttributeSetXY, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 8, 0, 1, 0 },
+	{ "NodeAttributeSetXY_regional", sizeof(NodeAttributeSetXY_regional), 0, sPerEnc_NodeAttributeSetXY_regional, sPerDec_NodeAttributeSetXY_regional, sOerEnc_NodeAttributeSetXY_regional, sOerDec_NodeAttributeSetXY_regional, sBerEnc_NodeAttributeSetXY_regional, sBerDec_NodeAttributeSetXY_regional, sPrint_NodeAttributeSetXY_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "NodeAttributeXY", sizeof(NodeAttributeXY), 0, sPerEnc_NodeAttributeXY, sPerDec_NodeAttributeXY, sOerEnc_NodeAttributeXY, sOerDec_NodeAttributeXY, sBerEnc_NodeAttributeXY, sBerDec_NodeAttributeXY, sPrint_NodeAttributeXY, ASN_SIZE_EXT, 5, 5, 1, 1 },
+	{ "NodeAttributeXYList", sizeof(NodeAttributeXYList), 0, sPerEnc_NodeAttributeXYList, sPerDec_NodeAttributeXYList, sOerEnc_NodeAttributeXYList, sOerDec_NodeAttributeXYList, sBerEnc_NodeAttributeXYList, sBerDec_NodeAttributeXYList, sPrint_NodeAttributeXYList, ASN_SIZE_EXT, 8, 43, 3, 10 },
+	{ "NodeLL", sizeof(NodeLL), 0, sPerEnc_NodeLL, sPerDec_NodeLL, sOerEnc_NodeLL, sOerDec_NodeLL, sBerEnc_NodeLL, sBerDec_NodeLL, sPrint_NodeLL, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 29, 0, 4, 0 },
+	{ "NodeListLL", sizeof(NodeListLL), 0, sPerEnc_NodeListLL, sPerDec_NodeListLL, sOerEnc_NodeListLL, sOerDec_NodeListLL, sBerEnc_NodeListLL, sBerDec_NodeListLL, sPrint_NodeListLL, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 65, 0, 11, 0 },
+	{ "NodeListXY", sizeof(NodeListXY), 0, sPerEnc_NodeListXY, sPerDec_NodeListXY, sOerEnc_NodeListXY, sOerDec_NodeListXY, sBerEnc_NodeListXY, sBerDec_NodeListXY, sPrint_NodeListXY, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 41, 0, 9, 0 },
+	{ "NodeOffsetPointLL", sizeof(NodeOffsetPointLL), 0, sPerEnc_NodeOffsetPointLL, sPerDec_NodeOffsetPointLL, sOerEnc_NodeOffsetPointLL, sOerDec_NodeOffsetPointLL, sBerEnc_NodeOffsetPointLL, sBerDec_NodeOffsetPointLL, sPrint_NodeOffsetPointLL, ASN_SIZE_UNBOUNDED, 27, 0, 3, 0 },
+	{ "NodeOffsetPointXY", sizeof(NodeOffsetPointXY), 0, sPerEnc_NodeOffsetPointXY, sPerDec_NodeOffsetPointXY, sOerEnc_NodeOffsetPointXY, sOerDec_NodeOffsetPointXY, sBerEnc_NodeOffsetPointXY, sBerDec_NodeOffsetPointXY, sPrint_NodeOffsetPointXY, ASN_SIZE_UNBOUNDED, 23, 0, 3, 0 },
+	{ "NodeOffsetPointXY_addGrpB", sizeof(NodeOffsetPointXY_addGrpB), sTest_NodeOffsetPointXY_addGrpB, sPerEnc_NodeOffsetPointXY_addGrpB, sPerDec_NodeOffsetPointXY_addGrpB, sOerEnc_NodeOffsetPointXY_addGrpB, sOerDec_NodeOffsetPointXY_addGrpB, sBerEnc_NodeOffsetPointXY_addGrpB, sBerDec_NodeOffsetPointXY_addGrpB, sPrint_NodeOffsetPointXY_addGrpB, ASN_SIZE_EXT, 55, 57, 9, 10 },
+	{ "NodeSetLL", sizeof(NodeSetLL), 0, sPerEnc_NodeSetLL, sPerDec_NodeSetLL, sOerEnc_NodeSetLL, sOerDec_NodeSetLL, sBerEnc_NodeSetLL, sBerDec_NodeSetLL, sPrint_NodeSetLL, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 64, 0, 10, 0 },
+	{ "NodeSetXY", sizeof(NodeSetXY), 0, sPerEnc_NodeSetXY, sPerDec_NodeSetXY, sOerEnc_NodeSetXY, sOerDec_NodeSetXY, sBerEnc_NodeSetXY, sBerDec_NodeSetXY, sPrint_NodeSetXY, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 56, 0, 10, 0 },
+	{ "NodeXY", sizeof(NodeXY), 0, sPerEnc_NodeXY, sPerDec_NodeXY, sOerEnc_NodeXY, sOerDec_NodeXY, sBerEnc_NodeXY, sBerDec_NodeXY, sPrint_NodeXY, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 25, 0, 4, 0 },
+	{ "Node_LL_24B", sizeof(Node_LL_24B), 0, sPerEnc_Node_LL_24B, sPerDec_Node_LL_24B, sOerEnc_Node_LL_24B, sOerDec_Node_LL_24B, sBerEnc_Node_LL_24B, sBerDec_Node_LL_24B, sPrint_Node_LL_24B, 0, 24, 24, 4, 4 },
+	{ "Node_LL_28B", sizeof(Node_LL_28B), 0, sPerEnc_Node_LL_28B, sPerDec_Node_LL_28B, sOerEnc_Node_LL_28B, sOerDec_Node_LL_28B, sBerEnc_Node_LL_28B, sBerDec_Node_LL_28B, sPrint_Node_LL_28B, 0, 28, 28, 4, 4 },
+	{ "Node_LL_32B", sizeof(Node_LL_32B), 0, sPerEnc_Node_LL_32B, sPerDec_Node_LL_32B, sOerEnc_Node_LL_32B, sOerDec_Node_LL_32B, sBerEnc_Node_LL_32B, sBerDec_Node_LL_32B, sPrint_Node_LL_32B, 0, 32, 32, 4, 4 },
+	{ "Node_LL_36B", sizeof(Node_LL_36B), 0, sPerEnc_Node_LL_36B, sPerDec_Node_LL_36B, sOerEnc_Node_LL_36B, sOerDec_Node_LL_36B, sBerEnc_Node_LL_36B, sBerDec_Node_LL_36B, sPrint_Node_LL_36B, 0, 36, 36, 8, 8 },
+	{ "Node_LL_44B", sizeof(Node_LL_44B), 0, sPerEnc_Node_LL_44B, sPerDec_Node_LL_44B, sOerEnc_Node_LL_44B, sOerDec_Node_LL_44B, sBerEnc_Node_LL_44B, sBerDec_Node_LL_44B, sPrint_Node_LL_44B, 0, 44, 44, 8, 8 },
+	{ "Node_LL_48B", sizeof(Node_LL_48B), 0, sPerEnc_Node_LL_48B, sPerDec_Node_LL_48B, sOerEnc_Node_LL_48B, sOerDec_Node_LL_48B, sBerEnc_Node_LL_48B, sBerDec_Node_LL_48B, sPrint_Node_LL_48B, 0, 48, 48, 8, 8 },
+	{ "Node_LLdms_48b", sizeof(Node_LLdms_48b), 0, sPerEnc_Node_LLdms_48b, sPerDec_Node_LLdms_48b, sOerEnc_Node_LLdms_48b, sOerDec_Node_LLdms_48b, sBerEnc_Node_LLdms_48b, sBerDec_Node_LLdms_48b, sPrint_Node_LLdms_48b, 0, 53, 53, 8, 8 },
+	{ "Node_LLdms_80b", sizeof(Node_LLdms_80b), 0, sPerEnc_Node_LLdms_80b, sPerDec_Node_LLdms_80b, sOerEnc_Node_LLdms_80b, sOerDec_Node_LLdms_80b, sBerEnc_Node_LLdms_80b, sBerDec_Node_LLdms_80b, sPrint_Node_LLdms_80b, 0, 55, 55, 9, 9 },
+	{ "Node_LLmD_64b", sizeof(Node_LLmD_64b), 0, sPerEnc_Node_LLmD_64b, sPerDec_Node_LLmD_64b, sOerEnc_Node_LLmD_64b, sOerDec_Node_LLmD_64b, sBerEnc_Node_LLmD_64b, sBerDec_Node_LLmD_64b, sPrint_Node_LLmD_64b, 0, 63, 63, 8, 8 },
+	{ "Node_XY_20b", sizeof(Node_XY_20b), 0, sPerEnc_Node_XY_20b, sPerDec_Node_XY_20b, sOerEnc_Node_XY_20b, sOerDec_Node_XY_20b, sBerEnc_Node_XY_20b, sBerDec_Node_XY_20b, sPrint_Node_XY_20b, 0, 20, 20, 4, 4 },
+	{ "Node_XY_22b", sizeof(Node_XY_22b), 0, sPerEnc_Node_XY_22b, sPerDec_Node_XY_22b, sOerEnc_Node_XY_22b, sOerDec_Node_XY_22b, sBerEnc_Node_XY_22b, sBerDec_Node_XY_22b, sPrint_Node_XY_22b, 0, 22, 22, 4, 4 },
+	{ "Node_XY_24b", sizeof(Node_XY_24b), 0, sPerEnc_Node_XY_24b, sPerDec_Node_XY_24b, sOerEnc_Node_XY_24b, sOerDec_Node_XY_24b, sBerEnc_Node_XY_24b, sBerDec_Node_XY_24b, sPrint_Node_XY_24b, 0, 24, 24, 4, 4 },
+	{ "Node_XY_26b", sizeof(Node_XY_26b), 0, sPerEnc_Node_XY_26b, sPerDec_Node_XY_26b, sOerEnc_Node_XY_26b, sOerDec_Node_XY_26b, sBerEnc_Node_XY_26b, sBerDec_Node_XY_26b, sPrint_Node_XY_26b, 0, 26, 26, 4, 4 },
+	{ "Node_XY_28b", sizeof(Node_XY_28b), 0, sPerEnc_Node_XY_28b, sPerDec_Node_XY_28b, sOerEnc_Node_XY_28b, sOerDec_Node_XY_28b, sBerEnc_Node_XY_28b, sBerDec_Node_XY_28b, sPrint_Node_XY_28b, 0, 28, 28, 4, 4 },
+	{ "Node_XY_32b", sizeof(Node_XY_32b), 0, sPerEnc_Node_XY_32b, sPerDec_Node_XY_32b, sOerEnc_Node_XY_32b, sOerDec_Node_XY_32b, sBerEnc_Node_XY_32b, sBerDec_Node_XY_32b, sPrint_Node_XY_32b, 0, 32, 32, 4, 4 },
+	{ "NumberOfParticipantsInCluster", sizeof(NumberOfParticipantsInCluster), 0, sPerEnc_NumberOfParticipantsInCluster, sPerDec_NumberOfParticipantsInCluster, sOerEnc_NumberOfParticipantsInCluster, sOerDec_NumberOfParticipantsInCluster, sBerEnc_NumberOfParticipantsInCluster, sBerDec_NumberOfParticipantsInCluster, sPrint_NumberOfParticipantsInCluster, ASN_SIZE_EXT, 3, 3, 1, 1 },
+	{ "ObjectCount", sizeof(ObjectCount), 0, sPerEnc_ObjectCount, sPerDec_ObjectCount, sOerEnc_ObjectCount, sOerDec_ObjectCount, sBerEnc_ObjectCount, sBerDec_ObjectCount, sPrint_ObjectCount, 0, 10, 10, 2, 2 },
+	{ "ObstacleDetection", sizeof(ObstacleDetection), 0, sPerEnc_ObstacleDetection, sPerDec_ObstacleDetection, sOerEnc_ObstacleDetection, sOerDec_ObstacleDetection, sBerEnc_ObstacleDetection, sBerDec_ObstacleDetection, sPrint_ObstacleDetection, ASN_SIZE_EXT, 41, 118, 6, 22 },
+	{ "ObstacleDirection", sizeof(ObstacleDirection), 0, sPerEnc_ObstacleDirection, sPerDec_ObstacleDirection, sOerEnc_ObstacleDirection, sOerDec_ObstacleDirection, sBerEnc_ObstacleDirection, sBerDec_ObstacleDirection, sPrint_ObstacleDirection, 0, 15, 15, 2, 2 },
+	{ "ObstacleDistance", sizeof(ObstacleDistance), 0, sPerEnc_ObstacleDistance, sPerDec_ObstacleDistance, sOerEnc_ObstacleDistance, sOerDec_ObstacleDistance, sBerEnc_ObstacleDistance, sBerDec_ObstacleDistance, sPrint_ObstacleDistance, 0, 15, 15, 2, 2 },
+	{ "OffsetLL_B12", sizeof(OffsetLL_B12), 0, sPerEnc_OffsetLL_B12, sPerDec_OffsetLL_B12, sOerEnc_OffsetLL_B12, sOerDec_OffsetLL_B12, sBerEnc_OffsetLL_B12, sBerDec_OffsetLL_B12, sPrint_OffsetLL_B12, 0, 12, 12, 2, 2 },
+	{ "OffsetLL_B14", sizeof(OffsetLL_B14), 0, sPerEnc_OffsetLL_B14, sPerDec_OffsetLL_B14, sOerEnc_OffsetLL_B14, sOerDec_OffsetLL_B14, sBerEnc_OffsetLL_B14, sBerDec_OffsetLL_B14, sPrint_OffsetLL_B14, 0, 14, 14, 2, 2 },
+	{ "OffsetLL_B16", sizeof(OffsetLL_B16), 0, sPerEnc_OffsetLL_B16, sPerDec_OffsetLL_B16, sOerEnc_OffsetLL_B16, sOerDec_OffsetLL_B16, sBerEnc_OffsetLL_B16, sBerDec_OffsetLL_B16, sPrint_OffsetLL_B16, 0, 16, 16, 2, 2 },
+	{ "OffsetLL_B18", sizeof(OffsetLL_B18), 0, sPerEnc_OffsetLL_B18, sPerDec_OffsetLL_B18, sOerEnc_OffsetLL_B18, sOerDec_OffsetLL_B18, sBerEnc_OffsetLL_B18, sBerDec_OffsetLL_B18, sPrint_OffsetLL_B18, 0, 18, 18, 4, 4 },
+	{ "OffsetLL_B22", sizeof(OffsetLL_B22), 0, sPerEnc_OffsetLL_B22, sPerDec_OffsetLL_B22, sOerEnc_OffsetLL_B22, sOerDec_OffsetLL_B22, sBerEnc_OffsetLL_B22, sBerDec_OffsetLL_B22, sPrint_OffsetLL_B22, 0, 22, 22, 4, 4 },
+	{ "OffsetLL_B24", sizeof(OffsetLL_B24), 0, sPerEnc_OffsetLL_B24, sPerDec_OffsetLL_B24, sOerEnc_OffsetLL_B24, sOerDec_OffsetLL_B24, sBerEnc_OffsetLL_B24, sBerDec_OffsetLL_B24, sPrint_OffsetLL_B24, 0, 24, 24, 4, 4 },
+	{ "OffsetSystem", sizeof(OffsetSystem), 0, sPerEnc_OffsetSystem, sPerDec_OffsetSystem, sOerEnc_OffsetSystem, sOerDec_OffsetSystem, sBerEnc_OffsetSystem, sBerDec_OffsetSystem, sPrint_OffsetSystem, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 43, 0, 11, 0 },
+	{ "OffsetSystem_offset", sizeof(OffsetSystem_offset), 0, sPerEnc_OffsetSystem_offset, sPerDec_OffsetSystem_offset, sOerEnc_OffsetSystem_offset, sOerDec_OffsetSystem_offset, sBerEnc_OffsetSystem_offset, sBerDec_OffsetSystem_offset, sPrint_OffsetSystem_offset, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 42, 0, 10, 0 },
+	{ "Offset_B09", sizeof(Offset_B09), 0, sPerEnc_Offset_B09, sPerDec_Offset_B09, sOerEnc_Offset_B09, sOerDec_Offset_B09, sBerEnc_Offset_B09, sBerDec_Offset_B09, sPrint_Offset_B09, 0, 9, 9, 2, 2 },
+	{ "Offset_B10", sizeof(Offset_B10), 0, sPerEnc_Offset_B10, sPerDec_Offset_B10, sOerEnc_Offset_B10, sOerDec_Offset_B10, sBerEnc_Offset_B10, sBerDec_Offset_B10, sPrint_Offset_B10, 0, 10, 10, 2, 2 },
+	{ "Offset_B11", sizeof(Offset_B11), 0, sPerEnc_Offset_B11, sPerDec_Offset_B11, sOerEnc_Offset_B11, sOerDec_Offset_B11, sBerEnc_Offset_B11, sBerDec_Offset_B11, sPrint_Offset_B11, 0, 11, 11, 2, 2 },
+	{ "Offset_B12", sizeof(Offset_B12), 0, sPerEnc_Offset_B12, sPerDec_Offset_B12, sOerEnc_Offset_B12, sOerDec_Offset_B12, sBerEnc_Offset_B12, sBerDec_Offset_B12, sPrint_Offset_B12, 0, 12, 12, 2, 2 },
+	{ "Offset_B13", sizeof(Offset_B13), 0, sPerEnc_Offset_B13, sPerDec_Offset_B13, sOerEnc_Offset_B13, sOerDec_Offset_B13, sBerEnc_Offset_B13, sBerDec_Offset_B13, sPrint_Offset_B13, 0, 13, 13, 2, 2 },
+	{ "Offset_B14", sizeof(Offset_B14), 0, sPerEnc_Offset_B14, sPerDec_Offset_B14, sOerEnc_Offset_B14, sOerDec_Offset_B14, sBerEnc_Offset_B14, sBerDec_Offset_B14, sPrint_Offset_B14, 0, 14, 14, 2, 2 },
+	{ "Offset_B16", sizeof(Offset_B16), 0, sPerEnc_Offset_B16, sPerDec_Offset_B16, sOerEnc_Offset_B16, sOerDec_Offset_B16, sBerEnc_Offset_B16, sBerDec_Offset_B16, sPrint_Offset_B16, 0, 16, 16, 2, 2 },
+	{ "OverlayLaneList", sizeof(OverlayLaneList), 0, sPerEnc_OverlayLaneList, sPerDec_OverlayLaneList, sOerEnc_OverlayLaneList, sOerDec_OverlayLaneList, sBerEnc_OverlayLaneList, sBerDec_OverlayLaneList, sPrint_OverlayLaneList, 0, 11, 43, 3, 7 },
+	{ "PDUs", sizeof(PDUs), 0, sPerEnc_PDUs, sPerDec_PDUs, sOerEnc_PDUs, sOerDec_PDUs, sBerEnc_PDUs, sBerDec_PDUs, sPrint_PDUs, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 8, 0, 2, 0 },
+	{ "PVD_addGrpD", sizeof(PVD_addGrpD), sTest_PVD_addGrpD, sPerEnc_PVD_addGrpD, sPerDec_PVD_addGrpD, sOerEnc_PVD_addGrpD, sOerDec_PVD_addGrpD, sBerEnc_PVD_addGrpD, sBerDec_PVD_addGrpD, sPrint_PVD_addGrpD, ASN_SIZE_EXT, 2, 10311, 1, 1539 },
+	{ "PVD_addGrpD_cits", sizeof(PVD_addGrpD_cits), 0, sPerEnc_PVD_addGrpD_cits, sPerDec_PVD_addGrpD_cits, sOerEnc_PVD_addGrpD_cits, sOerDec_PVD_addGrpD_cits, sBerEnc_PVD_addGrpD_cits, sBerDec_PVD_addGrpD_cits, sPrint_PVD_addGrpD_cits, ASN_SIZE_EXT, 12, 10309, 3, 1538 },
+	{ "PartII_Id", sizeof(PartII_Id), 0, sPerEnc_PartII_Id, sPerDec_PartII_Id, sOerEnc_PartII_Id, sOerDec_PartII_Id, sBerEnc_PartII_Id, sBerDec_PartII_Id, sPrint_PartII_Id, 0, 6, 6, 1, 1 },
+	{ "PartIIcontent", sizeof(PartIIcontent), 0, sPerEnc_PartIIcontent, sPerDec_PartIIcontent, sOerEnc_PartIIcontent, sOerDec_PartIIcontent, sBerEnc_PartIIcontent, sBerDec_PartIIcontent, sPrint_PartIIcontent, ASN_SIZE_UNBOUNDED, 22, 0, 2, 0 },
+	{ "PathHistory", sizeof(PathHistory), 0, sPerEnc_PathHistory, sPerDec_PathHistory, sOerEnc_PathHistory, sOerDec_PathHistory, sBerEnc_PathHistory, sBerDec_PathHistory, sPrint_PathHistory, ASN_SIZE_EXT, 76, 3038, 16, 504 },
+	{ "PathHistoryPoint", sizeof(PathHistoryPoint), 0, sPerEnc_PathHistoryPoint, sPerDec_PathHistoryPoint, sOerEnc_PathHistoryPoint, sOerDec_PathHistoryPoint, sBerEnc_PathHistoryPoint, sBerDec_PathHistoryPoint, sPrint_PathHistoryPoint, ASN_SIZE_EXT, 68, 121, 13, 20 },
+	{ "PathHistoryPointList", sizeof(PathHistoryPointList), 0, sPerEnc_PathHistoryPointList, sPerDec_PathHistoryPointList, sOerEnc_PathHistoryPointList, sOerDec_PathHistoryPointList, sBerEnc_PathHistoryPointList, sBerDec_PathHistoryPointList, sPrint_PathHistoryPointList, ASN_SIZE_EXT, 73, 2788, 15, 462 },
+	{ "PathPrediction", sizeof(PathPrediction), 0, sPerEnc_PathPrediction, sPerDec_PathPrediction, sOerEnc_PathPrediction, sOerDec_PathPrediction, sBerEnc_PathPrediction, sBerDec_PathPrediction, sPrint_PathPrediction, ASN_SIZE_EXT, 25, 25, 4, 4 },
+	{ "PayloadData", sizeof(PayloadData), sTest_PayloadData, sPerEnc_PayloadData, sPerDec_PayloadData, sOerEnc_PayloadData, sOerDec_PayloadData, sBerEnc_PayloadData, sBerDec_PayloadData, sPrint_PayloadData, 0, 19, 16395, 2, 2051 },
+	{ "PedestrianBicycleDetect", sizeof(PedestrianBicycleDetect), 0, sPerEnc_PedestrianBicycleDetect, sPerDec_PedestrianBicycleDetect, sOerEnc_PedestrianBicycleDetect, sOerDec_PedestrianBicycleDetect, sBerEnc_PedestrianBicycleDetect, sBerDec_PedestrianBicycleDetect, sPrint_PedestrianBicycleDetect, 0, 1, 1, 1, 1 },
+	{ "PersonalAssistive", sizeof(PersonalAssistive), 0, sPerEnc_PersonalAssistive, sPerDec_PersonalAssistive, sOerEnc_PersonalAssistive, sOerDec_PersonalAssistive, sBerEnc_PersonalAssistive, sBerDec_PersonalAssistive, sPrint_PersonalAssistive, ASN_SIZE_EXT, 7, 7, 3, 3 },
+	{ "PersonalClusterRadius", sizeof(PersonalClusterRadius), 0, sPerEnc_PersonalClusterRadius, sPerDec_PersonalClusterRadius, sOerEnc_PersonalClusterRadius, sOerDec_PersonalClusterRadius, sBerEnc_PersonalClusterRadius, sBerDec_PersonalClusterRadius, sPrint_PersonalClusterRadius, 0, 7, 7, 1, 1 },
+	{ "PersonalCrossingInProgress", sizeof(PersonalCrossingInProgress), 0, sPerEnc_PersonalCrossingInProgress, sPerDec_PersonalCrossingInProgress, sOerEnc_PersonalCrossingInProgress, sOerDec_PersonalCrossingInProgress, sBerEnc_PersonalCrossingInProgress, sBerDec_PersonalCrossingInProgress, sPrint_PersonalCrossingInProgress, 0, 1, 1, 1, 1 },
+	{ "PersonalCrossingRequest", sizeof(PersonalCrossingRequest), 0, sPerEnc_PersonalCrossingRequest, sPerDec_PersonalCrossingRequest, sOerEnc_PersonalCrossingRequest, sOerDec_PersonalCrossingRequest, sBerEnc_PersonalCrossingRequest, sBerDec_PersonalCrossingRequest, sPrint_PersonalCrossingRequest, 0, 1, 1, 1, 1 },
+	{ "PersonalDeviceUsageState", sizeof(PersonalDeviceUsageState), 0, sPerEnc_PersonalDeviceUsageState, sPerDec_PersonalDeviceUsageState, sOerEnc_PersonalDeviceUsageState, sOerDec_PersonalDeviceUsageState, sBerEnc_PersonalDeviceUsageState, sBerDec_PersonalDeviceUsageState, sPrint_PersonalDeviceUsageState, ASN_SIZE_EXT, 10, 10, 4, 4 },
+	{ "PersonalDeviceUserType", sizeof(PersonalDeviceUserType), 0, sPerEnc_PersonalDeviceUserType, sPerDec_PersonalDeviceUserType, sOerEnc_PersonalDeviceUserType, sOerDec_PersonalDeviceUserType, sBerEnc_PersonalDeviceUserType, sBerDec_PersonalDeviceUserType, sPrint_PersonalDeviceUserType, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "PersonalSafetyMessage", sizeof(PersonalSafetyMessage), sTest_PersonalSafetyMessage, sPerEnc_PersonalSafetyMessage, sPerDec_PersonalSafetyMessage, sOerEnc_PersonalSafetyMessage, sOerDec_PersonalSafetyMessage, sBerEnc_PersonalSafetyMessage, sBerDec_PersonalSafetyMessage, sPrint_PersonalSafetyMessage, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 204, 0, 28, 0 },
+	{ "PersonalSafetyMessage_regional", sizeof(PersonalSafetyMessage_regional), 0, sPerEnc_PersonalSafetyMessage_regional, sPerDec_PersonalSafetyMessage_regional, sOerEnc_PersonalSafetyMessage_regional, sOerDec_PersonalSafetyMessage_regional, sBerEnc_PersonalSafetyMessage_regional, sBerDec_PersonalSafetyMessage_regional, sPrint_PersonalSafetyMessage_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "PivotPointDescription", sizeof(PivotPointDescription), 0, sPerEnc_PivotPointDescription, sPerDec_PivotPointDescription, sOerEnc_PivotPointDescription, sOerDec_PivotPointDescription, sBerEnc_PivotPointDescription, sBerDec_PivotPointDescription, sPrint_PivotPointDescription, ASN_SIZE_EXT, 28, 28, 6, 6 },
+	{ "PivotingAllowed", sizeof(PivotingAllowed), 0, sPerEnc_PivotingAllowed, sPerDec_PivotingAllowed, sOerEnc_PivotingAllowed, sOerDec_PivotingAllowed, sBerEnc_PivotingAllowed, sBerDec_PivotingAllowed, sPrint_PivotingAllowed, 0, 1, 1, 1, 1 },
+	{ "Position3D", sizeof(Position3D), 0, sPerEnc_Position3D, sPerDec_Position3D, sOerEnc_Position3D, sOerDec_Position3D, sBerEnc_Position3D, sBerDec_Position3D, sPrint_Position3D, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 66, 0, 9, 0 },
+	{ "Position3D_addGrpB", sizeof(Position3D_addGrpB), sTest_Position3D_addGrpB, sPerEnc_Position3D_addGrpB, sPerDec_Position3D_addGrpB, sOerEnc_Position3D_addGrpB, sOerDec_Position3D_addGrpB, sBerEnc_Position3D_addGrpB, sBerDec_Position3D_addGrpB, sPrint_Position3D_addGrpB, ASN_SIZE_EXT, 72, 72, 12, 12 },
+	{ "Position3D_addGrpC", sizeof(Position3D_addGrpC), sTest_Position3D_addGrpC, sPerEnc_Position3D_addGrpC, sPerDec_Position3D_addGrpC, sOerEnc_Position3D_addGrpC, sOerDec_Position3D_addGrpC, sBerEnc_Position3D_addGrpC, sBerDec_Position3D_addGrpC, sPrint_Position3D_addGrpC, ASN_SIZE_EXT, 25, 25, 6, 6 },
+	{ "Position3D_regional", sizeof(Position3D_regional), 0, sPerEnc_Position3D_regional, sPerDec_Position3D_regional, sOerEnc_Position3D_regional, sOerDec_Position3D_regional, sBerEnc_Position3D_regional, sBerDec_Position3D_regional, sPrint_Position3D_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "PositionConfidence", sizeof(PositionConfidence), 0, sPerEnc_PositionConfidence, sPerDec_PositionConfidence, sOerEnc_PositionConfidence, sOerDec_PositionConfidence, sBerEnc_PositionConfidence, sBerDec_PositionConfidence, sPrint_PositionConfidence, 0, 4, 4, 1, 1 },
+	{ "PositionConfidenceSet", sizeof(PositionConfidenceSet), 0, sPerEnc_PositionConfidenceSet, sPerDec_PositionConfidenceSet, sOerEnc_PositionConfidenceSet, sOerDec_PositionConfidenceSet, sBerEnc_PositionConfidenceSet, sBerDec_PositionConfidenceSet, sPrint_PositionConfidenceSet, 0, 8, 8, 2, 2 },
+	{ "PositionalAccuracy", sizeof(PositionalAccuracy), 0, sPerEnc_PositionalAccuracy, sPerDec_PositionalAccuracy, sOerEnc_PositionalAccuracy, sOerDec_PositionalAccuracy, sBerEnc_PositionalAccuracy, sBerDec_PositionalAccuracy, sPrint_PositionalAccuracy, 0, 32, 32, 4, 4 },
+	{ "PreemptPriorityList", sizeof(PreemptPriorityList), 0, sPerEnc_PreemptPriorityList, sPerDec_PreemptPriorityList, sOerEnc_PreemptPriorityList, sOerDec_PreemptPriorityList, sBerEnc_PreemptPriorityList, sBerDec_PreemptPriorityList, sPrint_PreemptPriorityList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 30, 0, 5, 0 },
+	{ "PrioritizationResponse", sizeof(PrioritizationResponse), 0, sPerEnc_PrioritizationResponse, sPerDec_PrioritizationResponse, sOerEnc_PrioritizationResponse, sOerDec_PrioritizationResponse, sBerEnc_PrioritizationResponse, sBerDec_PrioritizationResponse, sPrint_PrioritizationResponse, ASN_SIZE_EXT, 45, 45, 7, 7 },
+	{ "PrioritizationResponseList", sizeof(PrioritizationResponseList), 0, sPerEnc_PrioritizationResponseList, sPerDec_PrioritizationResponseList, sOerEnc_PrioritizationResponseList, sOerDec_PrioritizationResponseList, sBerEnc_PrioritizationResponseList, sBerDec_PrioritizationResponseList, sPrint_PrioritizationResponseList, ASN_SIZE_EXT, 49, 454, 9, 72 },
+	{ "PrioritizationResponseStatus", sizeof(PrioritizationResponseStatus), 0, sPerEnc_PrioritizationResponseStatus, sPerDec_PrioritizationResponseStatus, sOerEnc_PrioritizationResponseStatus, sOerDec_PrioritizationResponseStatus, sBerEnc_PrioritizationResponseStatus, sBerDec_PrioritizationResponseStatus, sPrint_PrioritizationResponseStatus, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "Priority", sizeof(Priority), 0, sPerEnc_Priority, sPerDec_Priority, sOerEnc_Priority, sOerDec_Priority, sBerEnc_Priority, sBerDec_Priority, sPrint_Priority, 0, 8, 8, 1, 1 },
+	{ "PriorityRequestType", sizeof(PriorityRequestType), 0, sPerEnc_PriorityRequestType, sPerDec_PriorityRequestType, sOerEnc_PriorityRequestType, sOerDec_PriorityRequestType, sBerEnc_PriorityRequestType, sBerDec_PriorityRequestType, sPrint_PriorityRequestType, ASN_SIZE_EXT, 3, 3, 1, 1 },
+	{ "PrivilegedEventFlags", sizeof(PrivilegedEventFlags), 0, sPerEnc_PrivilegedEventFlags, sPerDec_PrivilegedEventFlags, sOerEnc_PrivilegedEventFlags, sOerDec_PrivilegedEventFlags, sBerEnc_PrivilegedEventFlags, sBerDec_PrivilegedEventFlags, sPrint_PrivilegedEventFlags, 0, 16, 16, 2, 2 },
+	{ "PrivilegedEvents", sizeof(PrivilegedEvents), 0, sPerEnc_PrivilegedEvents, sPerDec_PrivilegedEvents, sOerEnc_PrivilegedEvents, sOerDec_PrivilegedEvents, sBerEnc_PrivilegedEvents, sBerDec_PrivilegedEvents, sPrint_PrivilegedEvents, ASN_SIZE_EXT, 22, 22, 4, 4 },
+	{ "ProbeDataManagement", sizeof(ProbeDataManagement), sTest_ProbeDataManagement, sPerEnc_ProbeDataManagement, sPerDec_ProbeDataManagement, sOerEnc_ProbeDataManagement, sOerDec_ProbeDataManagement, sBerEnc_ProbeDataManagement, sBerDec_ProbeDataManagement, sPrint_ProbeDataManagement, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 77, 0, 14, 0 },
+	{ "ProbeDataManagement_regional", sizeof(ProbeDataManagement_regional), 0, sPerEnc_ProbeDataManagement_regional, sPerDec_ProbeDataManagement_regional, sOerEnc_ProbeDataManagement_regional, sOerDec_ProbeDataManagement_regional, sBerEnc_ProbeDataManagement_regional, sBerDec_ProbeDataManagement_regional, sPrint_ProbeDataManagement_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "ProbeDataManagement_snapshot", sizeof(ProbeDataManagement_snapshot), 0, sPerEnc_ProbeDataManagement_snapshot, sPerDec_ProbeDataManagement_snapshot, sOerEnc_ProbeDataManagement_snapshot, sOerDec_ProbeDataManagement_snapshot, sBerEnc_ProbeDataManagement_snapshot, sBerDec_ProbeDataManagement_snapshot, sPrint_ProbeDataManagement_snapshot, 0, 23, 31, 5, 7 },
+	{ "ProbeDataManagement_term", sizeof(ProbeDataManagement_term), 0, sPerEnc_ProbeDataManagement_term, sPerDec_ProbeDataManagement_term, sOerEnc_ProbeDataManagement_term, sOerDec_ProbeDataManagement_term, sBerEnc_ProbeDataManagement_term, sBerDec_ProbeDataManagement_term, sPrint_ProbeDataManagement_term, 0, 12, 16, 3, 3 },
+	{ "ProbeSegmentNumber", sizeof(ProbeSegmentNumber), 0, sPerEnc_ProbeSegmentNumber, sPerDec_ProbeSegmentNumber, sOerEnc_ProbeSegmentNumber, sOerDec_ProbeSegmentNumber, sBerEnc_ProbeSegmentNumber, sBerDec_ProbeSegmentNumber, sPrint_ProbeSegmentNumber, 0, 15, 15, 2, 2 },
+	{ "ProbeVehicleData", sizeof(ProbeVehicleData), sTest_ProbeVehicleData, sPerEnc_ProbeVehicleData, sPerDec_ProbeVehicleData, sOerEnc_ProbeVehicleData, sOerDec_ProbeVehicleData, sBerEnc_ProbeVehicleData, sBerDec_ProbeVehicleData, sPrint_ProbeVehicleData, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 167, 0, 26, 0 },
+	{ "ProbeVehicleData_regional", sizeof(ProbeVehicleData_regional), 0, sPerEnc_ProbeVehicleData_regional, sPerDec_ProbeVehicleData_regional, sOerEnc_ProbeVehicleData_regional, sOerDec_ProbeVehicleData_regional, sBerEnc_ProbeVehicleData_regional, sBerDec_ProbeVehicleData_regional, sPrint_ProbeVehicleData_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "ProbeVehicleData_snapshots", sizeof(ProbeVehicleData_snapshots), 0, sPerEnc_ProbeVehicleData_snapshots, sPerDec_ProbeVehicleData_snapshots, sOerEnc_ProbeVehicleData_snapshots, sOerDec_ProbeVehicleData_snapshots, sBerEnc_ProbeVehicleData_snapshots, sBerDec_ProbeVehicleData_snapshots, sPrint_ProbeVehicleData_snapshots, ASN_SIZE_EXT, 80, 206725, 13, 34882 },
+	{ "PropelledInformation", sizeof(PropelledInformation), 0, sPerEnc_PropelledInformation, sPerDec_PropelledInformation, sOerEnc_PropelledInformation, sOerDec_PropelledInformation, sBerEnc_PropelledInformation, sBerDec_PropelledInformation, sPrint_PropelledInformation, ASN_SIZE_EXT, 6, 7, 2, 2 },
+	{ "PublicSafetyAndRoadWorkerActivity", sizeof(PublicSafetyAndRoadWorkerActivity), 0, sPerEnc_PublicSafetyAndRoadWorkerActivity, sPerDec_PublicSafetyAndRoadWorkerActivity, sOerEnc_PublicSafetyAndRoadWorkerActivity, sOerDec_PublicSafetyAndRoadWorkerActivity, sBerEnc_PublicSafetyAndRoadWorkerActivity, sBerDec_PublicSafetyAndRoadWorkerActivity, sPrint_PublicSafetyAndRoadWorkerActivity, ASN_SIZE_EXT, 7, 7, 3, 3 },
+	{ "PublicSafetyDirectingTrafficSubType", sizeof(PublicSafetyDirectingTrafficSubType), 0, sPerEnc_PublicSafetyDirectingTrafficSubType, sPerDec_PublicSafetyDirectingTrafficSubType, sOerEnc_PublicSafetyDirectingTrafficSubType, sOerDec_PublicSafetyDirectingTrafficSubType, sBerEnc_PublicSafetyDirectingTrafficSubType, sBerDec_PublicSafetyDirectingTrafficSubType, sPrint_PublicSafetyDirectingTrafficSubType, ASN_SIZE_EXT, 8, 8, 3, 3 },
+	{ "PublicSafetyEventResponderWorkerType", sizeof(PublicSafetyEventResponderWorkerType), 0, sPerEnc_PublicSafetyEventResponderWorkerType, sPerDec_PublicSafetyEventResponderWorkerType, sOerEnc_PublicSafetyEventResponderWorkerType, sOerDec_PublicSafetyEventResponderWorkerType, sBerEnc_PublicSafetyEventResponderWorkerType, sBerDec_PublicSafetyEventResponderWorkerType, sPrint_PublicSafetyEventResponderWorkerType, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "Publication", sizeof(Publication), 0, sPerEnc_Publication, sPerDec_Publication, sOerEnc_Publication, sOerDec_Publication, sBerEnc_Publication, sBerDec_Publication, sPrint_Publication, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 10, 0, 3, 0 },
+	{ "PublicationData", sizeof(PublicationData), 0, sPerEnc_PublicationData, sPerDec_PublicationData, sOerEnc_PublicationData, sOerDec_PublicationData, sBerEnc_PublicationData, sBerDec_PublicationData, sPrint_PublicationData, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 71, 0, 11, 0 },
+	{ "PublicationType", sizeof(PublicationType), 0, sPerEnc_PublicationType, sPerDec_PublicationType, sOerEnc_PublicationType, sOerDec_PublicationType, sBerEnc_PublicationType, sBerDec_PublicationType, sPrint_PublicationType, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 6, 0, 2, 0 },
+	{ "PublicationType_datexPublication_Management_cd", sizeof(PublicationType_datexPublication_Management_cd), 0, sPerEnc_PublicationType_datexPublication_Management_cd, sPerDec_PublicationType_datexPublication_Management_cd, sOerEnc_PublicationType_datexPublication_Management_cd, sOerDec_PublicationType_datexPublication_Management_cd, sBerEnc_PublicationType_datexPublication_Management_cd, sBerDec_PublicationType_datexPublication_Management_cd, sPrint_PublicationType_datexPublication_Management_cd, ASN_SIZE_EXT, 5, 5, 1, 1 },
+	{ "Publish_Format", sizeof(Publish_Format), 0, sPerEnc_Publish_Format, sPerDec_Publish_Format, sOerEnc_Publish_Format, sOerDec_Publish_Format, sBerEnc_Publish_Format, sBerDec_Publish_Format, sPrint_Publish_Format, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 9, 0, 2, 0 },
+	{ "RSA_addGrpD", sizeof(RSA_addGrpD), sTest_RSA_addGrpD, sPerEnc_RSA_addGrpD, sPerDec_RSA_addGrpD, sOerEnc_RSA_addGrpD, sOerDec_RSA_addGrpD, sBerEnc_RSA_addGrpD, sBerDec_RSA_addGrpD, sPrint_RSA_addGrpD, ASN_SIZE_EXT, 2, 114, 1, 17 },
+	{ "RTCMPackage", sizeof(RTCMPackage), 0, sPerEnc_RTCMPackage, sPerDec_RTCMPackage, sOerEnc_RTCMPackage, sOerDec_RTCMPackage, sBerEnc_RTCMPackage, sBerDec_RTCMPackage, sPrint_RTCMPackage, ASN_SIZE_EXT, 23, 41014, 5, 5140 },
+	{ "RTCM_Revision", sizeof(RTCM_Revision), 0, sPerEnc_RTCM_Revision, sPerDec_RTCM_Revision, sOerEnc_RTCM_Revision, sOerDec_RTCM_Revision, sBerEnc_RTCM_Revision, sBerDec_RTCM_Revision, sPrint_RTCM_Revision, ASN_SIZE_EXT, 3, 3, 1, 1 },
+	{ "RTCMcorrections", sizeof(RTCMcorrections), sTest_RTCMcorrections, sPerEnc_RTCMcorrections, sPerDec_RTCMcorrections, sOerEnc_RTCMcorrections, sOerDec_RTCMcorrections, sBerEnc_RTCMcorrections, sBerDec_RTCMcorrections, sPrint_RTCMcorrections, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 36, 0, 7, 0 },
+	{ "RTCMcorrections_regional", sizeof(RTCMcorrections_regional), 0, sPerEnc_RTCMcorrections_regional, sPerDec_RTCMcorrections_regional, sOerEnc_RTCMcorrections_regional, sOerDec_RTCMcorrections_regional, sBerEnc_RTCMcorrections_regional, sBerDec_RTCMcorrections_regional, sPrint_RTCMcorrections_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "RTCMheader", sizeof(RTCMheader), 0, sPerEnc_RTCMheader, sPerDec_RTCMheader, sOerEnc_RTCMheader, sOerDec_RTCMheader, sBerEnc_RTCMheader, sBerDec_RTCMheader, sPrint_RTCMheader, 0, 39, 39, 7, 7 },
+	{ "RTCMmessage", sizeof(RTCMmessage), 0, sPerEnc_RTCMmessage, sPerDec_RTCMmessage, sOerEnc_RTCMmessage, sOerDec_RTCMmessage, sBerEnc_RTCMmessage, sBerDec_RTCMmessage, sPrint_RTCMmessage, 0, 18, 8194, 2, 1026 },
+	{ "RTCMmessageList", sizeof(RTCMmessageList), 0, sPerEnc_RTCMmessageList, sPerDec_RTCMmessageList, sOerEnc_RTCMmessageList, sOerDec_RTCMmessageList, sBerEnc_RTCMmessageList, sBerDec_RTCMmessageList, sPrint_RTCMmessageList, 0, 21, 40973, 4, 5132 },
+	{ "RadiusOfCurvature", sizeof(RadiusOfCurvature), 0, sPerEnc_RadiusOfCurvature, sPerDec_RadiusOfCurvature, sOerEnc_RadiusOfCurvature, sOerDec_RadiusOfCurvature, sBerEnc_RadiusOfCurvature, sBerDec_RadiusOfCurvature, sPrint_RadiusOfCurvature, 0, 16, 16, 2, 2 },
+	{ "Radius_B12", sizeof(Radius_B12), 0, sPerEnc_Radius_B12, sPerDec_Radius_B12, sOerEnc_Radius_B12, sOerDec_Radius_B12, sBerEnc_Radius_B12, sBerDec_Radius_B12, sPrint_Radius_B12, 0, 12, 12, 2, 2 },
+	{ "RainSensor", sizeof(RainSensor), 0, sPerEnc_RainSensor, sPerDec_RainSensor, sOerEnc_RainSensor, sOerDec_RainSensor, sBerEnc_RainSensor, sBerDec_RainSensor, sPrint_RainSensor, 0, 3, 3, 1, 1 },
+	{ "RegionId", sizeof(RegionId), 0, sPerEnc_RegionId, sPerDec_RegionId, sOerEnc_RegionId, sOerDec_RegionId, sBerEnc_RegionId, sBerDec_RegionId, sPrint_RegionId, 0, 8, 8, 1, 1 },
+	{ "RegionList", sizeof(RegionList), 0, sPerEnc_RegionList, sPerDec_RegionList, sOerEnc_RegionList, sOerDec_RegionList, sBerEnc_RegionList, sBerDec_RegionList, sPrint_RegionList, 0, 39, 3142, 7, 450 },
+	{ "RegionOffsets", sizeof(RegionOffsets), 0, sPerEnc_RegionOffsets, sPerDec_RegionOffsets, sOerEnc_RegionOffsets, sOerDec_RegionOffsets, sBerEnc_RegionOffsets, sBerDec_RegionOffsets, sPrint_RegionOffsets, 0, 33, 49, 5, 7 },
+	{ "RegionPointSet", sizeof(RegionPointSet), 0, sPerEnc_RegionPointSet, sPerDec_RegionPointSet, sOerEnc_RegionPointSet, sOerDec_RegionPointSet, sBerEnc_RegionPointSet, sBerDec_RegionPointSet, sPrint_RegionPointSet, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 42, 0, 8, 0 },
+	{ "RegionalExtension", sizeof(RegionalExtension), 0, sPerEnc_RegionalExtension, sPerDec_RegionalExtension, sOerEnc_RegionalExtension, sOerDec_RegionalExtension, sBerEnc_RegionalExtension, sBerDec_RegionalExtension, sPrint_RegionalExtension, ASN_SIZE_UNBOUNDED, 24, 0, 2, 0 },
+	{ "Registered", sizeof(Registered), 0, sPerEnc_Registered, sPerDec_Registered, sOerEnc_Registered, sOerDec_Registered, sBerEnc_Registered, sBerDec_Registered, sPrint_Registered, ASN_SIZE_EXT, 4, 284, 2, 51 },
+	{ "Registered_continuous", sizeof(Registered_continuous), 0, sPerEnc_Registered_continuous, sPerDec_Registered_continuous, sOerEnc_Registered_continuous, sOerDec_Registered_continuous, sBerEnc_Registered_continuous, sBerDec_Registered_continuous, sPrint_Registered_continuous, ASN_SIZE_EXT, 3, 182, 1, 33 },
+	{ "Registered_daily", sizeof(Registered_daily), 0, sPerEnc_Registered_daily, sPerDec_Registered_daily, sOerEnc_Registered_daily, sOerDec_Registered_daily, sBerEnc_Registered_daily, sBerDec_Registered_daily, sPrint_Registered_daily, ASN_SIZE_EXT, 13, 283, 2, 50 },
+	{ "Registered_daily_datexRegistered_DaysOfWeek_cd", sizeof(Registered_daily_datexRegistered_DaysOfWeek_cd), 0, sPerEnc_Registered_daily_datexRegistered_DaysOfWeek_cd, sPerDec_Registered_daily_datexRegistered_DaysOfWeek_cd, sOerEnc_Registered_daily_datexRegistered_DaysOfWeek_cd, sOerDec_Registered_daily_datexRegistered_DaysOfWeek_cd, sBerEnc_Registered_daily_datexRegistered_DaysOfWeek_cd, sBerDec_Registered_daily_datexRegistered_DaysOfWeek_cd, sPrint_Registered_daily_datexRegistered_DaysOfWeek_cd, 0, 8, 8, 1, 1 },
+	{ "RegulatorySpeedLimit", sizeof(RegulatorySpeedLimit), 0, sPerEnc_RegulatorySpeedLimit, sPerDec_RegulatorySpeedLimit, sOerEnc_RegulatorySpeedLimit, sOerDec_RegulatorySpeedLimit, sBerEnc_RegulatorySpeedLimit, sBerDec_RegulatorySpeedLimit, sPrint_RegulatorySpeedLimit, ASN_SIZE_EXT, 18, 18, 3, 3 },
+	{ "Reject", sizeof(Reject), 0, sPerEnc_Reject, sPerDec_Reject, sOerEnc_Reject, sOerDec_Reject, sBerEnc_Reject, sBerDec_Reject, sPrint_Reject, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 39, 0, 7, 0 },
+	{ "RejectType", sizeof(RejectType), 0, sPerEnc_RejectType, sPerDec_RejectType, sOerEnc_RejectType, sOerDec_RejectType, sBerEnc_RejectType, sBerDec_RejectType, sPrint_RejectType, ASN_SIZE_EXT, 6, 7, 2, 2 },
+	{ "RejectType_datexReject_Login_cd", sizeof(RejectType_datexReject_Login_cd), 0, sPerEnc_RejectType_datexReject_Login_cd, sPerDec_RejectType_datexReject_Login_cd, sOerEnc_RejectType_datexReject_Login_cd, sOerDec_RejectType_datexReject_Login_cd, sBerEnc_RejectType_datexReject_Login_cd, sBerDec_RejectType_datexReject_Login_cd, sPrint_RejectType_datexReject_Login_cd, ASN_SIZE_EXT, 5, 5, 1, 1 },
+	{ "RejectType_datexReject_Publication_cd", sizeof(RejectType_datexReject_Publication_cd), 0, sPerEnc_RejectType_datexReject_Publication_cd, sPerDec_RejectType_datexReject_Publication_cd, sOerEnc_RejectType_datexReject_Publication_cd, sOerDec_RejectType_datexReject_Publication_cd, sBerEnc_RejectType_datexReject_Publication_cd, sBerDec_RejectType_datexReject_Publication_cd, sPrint_RejectType_datexReject_Publication_cd, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "RejectType_datexReject_Subscription_cd", sizeof(RejectType_datexReject_Subscription_cd), 0, sPerEnc_RejectType_datexReject_Subscription_cd, sPerDec_RejectType_datexReject_Subscription_cd, sOerEnc_RejectType_datexReject_Subscription_cd, sOerDec_RejectType_datexReject_Subscription_cd, sBerEnc_RejectType_datexReject_Subscription_cd, sBerDec_RejectType_datexReject_Subscription_cd, sPrint_RejectType_datexReject_Subscription_cd, ASN_SIZE_EXT, 5, 5, 1, 1 },
+	{ "RequestID", sizeof(RequestID), 0, sPerEnc_RequestID, sPerDec_RequestID, sOerEnc_RequestID, sOerDec_RequestID, sBerEnc_RequestID, sBerDec_RequestID, sPrint_RequestID, 0, 8, 8, 1, 1 },
+	{ "RequestImportanceLevel", sizeof(RequestImportanceLevel), 0, sPerEnc_RequestImportanceLevel, sPerDec_RequestImportanceLevel, sOerEnc_RequestImportanceLevel, sOerDec_RequestImportanceLevel, sBerEnc_RequestImportanceLevel, sBerDec_RequestImportanceLevel, sPrint_RequestImportanceLevel, 0, 4, 4, 1, 1 },
+	{ "RequestSubRole", sizeof(RequestSubRole), 0, sPerEnc_RequestSubRole, sPerDec_RequestSubRole, sOerEnc_RequestSubRole, sOerDec_RequestSubRole, sBerEnc_RequestSubRole, sBerDec_RequestSubRole, sPrint_RequestSubRole, 0, 4, 4, 1, 1 },
+	{ "RequestedItem", sizeof(RequestedItem), 0, sPerEnc_RequestedItem, sPerDec_RequestedItem, sOerEnc_RequestedItem, sOerDec_RequestedItem, sBerEnc_RequestedItem, sBerDec_RequestedItem, sPrint_RequestedItem, ASN_SIZE_EXT, 6, 6, 1, 1 },
+	{ "RequestedItemList", sizeof(RequestedItemList), 0, sPerEnc_RequestedItemList, sPerDec_RequestedItemList, sOerEnc_RequestedItemList, sOerDec_RequestedItemList, sBerEnc_RequestedItemList, sBerDec_RequestedItemList, sPrint_RequestedItemList, ASN_SIZE_EXT, 11, 197, 3, 34 },
+	{ "RequestorDescription", sizeof(RequestorDescription), 0, sPerEnc_RequestorDescription, sPerDec_RequestorDescription, sOerEnc_RequestorDescription, sOerDec_RequestorDescription, sBerEnc_RequestorDescription, sBerDec_RequestorDescription, sPrint_RequestorDescription, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 42, 0, 7, 0 },
+	{ "RequestorDescription_regional", sizeof(RequestorDescription_regional), 0, sPerEnc_RequestorDescription_regional, sPerDec_RequestorDescription_regional, sOerEnc_RequestorDescription_regional, sOerDec_RequestorDescription_regional, sBerEnc_RequestorDescription_regional, sBerDec_RequestorDescription_regional, sPrint_RequestorDescription_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "RequestorPositionVector", sizeof(RequestorPositionVector), 0, sPerEnc_RequestorPositionVector, sPerDec_RequestorPositionVector, sOerEnc_RequestorPositionVector, sOerDec_RequestorPositionVector, sBerEnc_RequestorPositionVector, sBerDec_RequestorPositionVector, sPrint_RequestorPositionVector, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 69, 0, 10, 0 },
+	{ "RequestorType", sizeof(RequestorType), 0, sPerEnc_RequestorType, sPerDec_RequestorType, sOerEnc_RequestorType, sOerDec_RequestorType, sBerEnc_RequestorType, sBerDec_RequestorType, sPrint_RequestorType, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 12, 0, 2, 0 },
+	{ "ResponderGroupAffected", sizeof(ResponderGroupAffected), 0, sPerEnc_ResponderGroupAffected, sPerDec_ResponderGroupAffected, sOerEnc_ResponderGroupAffected, sOerDec_ResponderGroupAffected, sBerEnc_ResponderGroupAffected, sBerDec_ResponderGroupAffected, sPrint_ResponderGroupAffected, ASN_SIZE_EXT, 5, 5, 3, 3 },
+	{ "ResponseType", sizeof(ResponseType), 0, sPerEnc_ResponseType, sPerDec_ResponseType, sOerEnc_ResponseType, sOerDec_ResponseType, sBerEnc_ResponseType, sBerDec_ResponseType, sPrint_ResponseType, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "RestrictionAppliesTo", sizeof(RestrictionAppliesTo), 0, sPerEnc_RestrictionAppliesTo, sPerDec_RestrictionAppliesTo, sOerEnc_RestrictionAppliesTo, sOerDec_RestrictionAppliesTo, sBerEnc_RestrictionAppliesTo, sBerDec_RestrictionAppliesTo, sPrint_RestrictionAppliesTo, ASN_SIZE_EXT, 5, 5, 1, 1 },
+	{ "RestrictionClassAssignment", sizeof(RestrictionClassAssignment), 0, sPerEnc_RestrictionClassAssignment, sPerDec_RestrictionClassAssignment, sOerEnc_RestrictionClassAssignment, sOerDec_RestrictionClassAssignment, sBerEnc_RestrictionClassAssignment, sBerDec_RestrictionClassAssignment, sPrint_RestrictionClassAssignment, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 19, 0, 5, 0 },
+	{ "RestrictionClassID", sizeof(RestrictionClassID), 0, sPerEnc_RestrictionClassID, sPerDec_RestrictionClassID, sOerEnc_RestrictionClassID, sOerDec_RestrictionClassID, sBerEnc_RestrictionClassID, sBerDec_RestrictionClassID, sPrint_RestrictionClassID, 0, 8, 8, 1, 1 },
+	{ "RestrictionClassList", sizeof(RestrictionClassList), 0, sPerEnc_RestrictionClassList, sPerDec_RestrictionClassList, sOerEnc_RestrictionClassList, sOerDec_RestrictionClassList, sBerEnc_RestrictionClassList, sBerDec_RestrictionClassList, sPrint_RestrictionClassList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 27, 0, 7, 0 },
+	{ "RestrictionUserType", sizeof(RestrictionUserType), 0, sPerEnc_RestrictionUserType, sPerDec_RestrictionUserType, sOerEnc_RestrictionUserType, sOerDec_RestrictionUserType, sBerEnc_RestrictionUserType, sBerDec_RestrictionUserType, sPrint_RestrictionUserType, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 7, 0, 2, 0 },
+	{ "RestrictionUserTypeList", sizeof(RestrictionUserTypeList), 0, sPerEnc_RestrictionUserTypeList, sPerDec_RestrictionUserTypeList, sOerEnc_RestrictionUserTypeList, sOerDec_RestrictionUserTypeList, sBerEnc_RestrictionUserTypeList, sBerDec_RestrictionUserTypeList, sPrint_RestrictionUserTypeList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 11, 0, 4, 0 },
+	{ "RestrictionUserType_addGrpC", sizeof(RestrictionUserType_addGrpC), sTest_RestrictionUserType_addGrpC, sPerEnc_RestrictionUserType_addGrpC, sPerDec_RestrictionUserType_addGrpC, sOerEnc_RestrictionUserType_addGrpC, sOerDec_RestrictionUserType_addGrpC, sBerEnc_RestrictionUserType_addGrpC, sBerDec_RestrictionUserType_addGrpC, sPrint_RestrictionUserType_addGrpC, ASN_SIZE_EXT, 2, 6, 1, 2 },
+	{ "RestrictionUserType_regional", sizeof(RestrictionUserType_regional), 0, sPerEnc_RestrictionUserType_regional, sPerDec_RestrictionUserType_regional, sOerEnc_RestrictionUserType_regional, sOerDec_RestrictionUserType_regional, sBerEnc_RestrictionUserType_regional, sBerDec_RestrictionUserType_regional, sPrint_RestrictionUserType_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "RoadLaneSetList", sizeof(RoadLaneSetList), 0, sPerEnc_RoadLaneSetList, sPerDec_RoadLaneSetList, sOerEnc_RoadLaneSetList, sOerDec_RoadLaneSetList, sBerEnc_RoadLaneSetList, sBerDec_RoadLaneSetList, sPrint_RoadLaneSetList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 91, 0, 20, 0 },
+	{ "RoadRegulatorID", sizeof(RoadRegulatorID), 0, sPerEnc_RoadRegulatorID, sPerDec_RoadRegulatorID, sOerEnc_RoadRegulatorID, sOerDec_RoadRegulatorID, sBerEnc_RoadRegulatorID, sBerDec_RoadRegulatorID, sPrint_RoadRegulatorID, 0, 16, 16, 2, 2 },
+	{ "RoadSegment", sizeof(RoadSegment), 0, sPerEnc_RoadSegment, sPerDec_RoadSegment, sOerEnc_RoadSegment, sOerDec_RoadSegment, sBerEnc_RoadSegment, sBerDec_RoadSegment, sPrint_RoadSegment, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 186, 0, 34, 0 },
+	{ "RoadSegmentID", sizeof(RoadSegmentID), 0, sPerEnc_RoadSegmentID, sPerDec_RoadSegmentID, sOerEnc_RoadSegmentID, sOerDec_RoadSegmentID, sBerEnc_RoadSegmentID, sBerDec_RoadSegmentID, sPrint_RoadSegmentID, 0, 16, 16, 2, 2 },
+	{ "RoadSegmentList", sizeof(RoadSegmentList), 0, sPerEnc_RoadSegmentList, sPerDec_RoadSegmentList, sOerEnc_RoadSegmentList, sOerDec_RoadSegmentList, sBerEnc_RoadSegmentList, sBerDec_RoadSegmentList, sPrint_RoadSegmentList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 191, 0, 36, 0 },
+	{ "RoadSegmentReferenceID", sizeof(RoadSegmentReferenceID), 0, sPerEnc_RoadSegmentReferenceID, sPerDec_RoadSegmentReferenceID, sOerEnc_RoadSegmentReferenceID, sOerDec_RoadSegmentReferenceID, sBerEnc_RoadSegmentReferenceID, sBerDec_RoadSegmentReferenceID, sPrint_RoadSegmentReferenceID, 0, 17, 33, 3, 5 },
+	{ "RoadSegment_regional", sizeof(RoadSegment_regional), 0, sPerEnc_RoadSegment_regional, sPerDec_RoadSegment_regional, sOerEnc_RoadSegment_regional, sOerDec_RoadSegment_regional, sBerEnc_RoadSegment_regional, sBerDec_RoadSegment_regional, sPrint_RoadSegment_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "RoadSideAlert", sizeof(RoadSideAlert), 0, sPerEnc_RoadSideAlert, sPerDec_RoadSideAlert, sOerEnc_RoadSideAlert, sOerDec_RoadSideAlert, sBerEnc_RoadSideAlert, sBerDec_RoadSideAlert, sPrint_RoadSideAlert, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 32, 0, 5, 0 },
+	{ "RoadSideAlert_description", sizeof(RoadSideAlert_description), 0, sPerEnc_RoadSideAlert_description, sPerDec_RoadSideAlert_description, sOerEnc_RoadSideAlert_description, sOerDec_RoadSideAlert_description, sBerEnc_RoadSideAlert_description, sBerDec_RoadSideAlert_description, sPrint_RoadSideAlert_description, 0, 19, 131, 4, 18 },
+	{ "RoadSideAlert_regional", sizeof(RoadSideAlert_regional), 0, sPerEnc_RoadSideAlert_regional, sPerDec_RoadSideAlert_regional, sOerEnc_RoadSideAlert_regional, sOerDec_RoadSideAlert_regional, sBerEnc_RoadSideAlert_regional, sBerDec_RoadSideAlert_regional, sPrint_RoadSideAlert_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "RoadSignID", sizeof(RoadSignID), 0, sPerEnc_RoadSignID, sPerDec_RoadSignID, sOerEnc_RoadSignID, sOerDec_RoadSignID, sBerEnc_RoadSignID, sBerDec_RoadSignID, sPrint_RoadSignID, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 84, 0, 12, 0 },
+	{ "RoadwayCrownAngle", sizeof(RoadwayCrownAngle), 0, sPerEnc_RoadwayCrownAngle, sPerDec_RoadwayCrownAngle, sOerEnc_RoadwayCrownAngle, sOerDec_RoadwayCrownAngle, sBerEnc_RoadwayCrownAngle, sBerDec_RoadwayCrownAngle, sPrint_RoadwayCrownAngle, 0, 8, 8, 1, 1 },
+	{ "SPAT", sizeof(SPAT), sTest_SPAT, sPerEnc_SPAT, sPerDec_SPAT, sOerEnc_SPAT, sOerDec_SPAT, sBerEnc_SPAT, sBerDec_SPAT, sPrint_SPAT, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 88, 0, 18, 0 },
+	{ "SPAT_regional", sizeof(SPAT_regional), 0, sPerEnc_SPAT_regional, sPerDec_SPAT_regional, sOerEnc_SPAT_regional, sOerDec_SPAT_regional, sBerEnc_SPAT_regional, sBerDec_SPAT_regional, sPrint_SPAT_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "SSPindex", sizeof(SSPindex), 0, sPerEnc_SSPindex, sPerDec_SSPindex, sOerEnc_SSPindex, sOerDec_SSPindex, sBerEnc_SSPindex, sBerDec_SSPindex, sPrint_SSPindex, 0, 5, 5, 1, 1 },
+	{ "Sample", sizeof(Sample), 0, sPerEnc_Sample, sPerDec_Sample, sOerEnc_Sample, sOerDec_Sample, sBerEnc_Sample, sBerDec_Sample, sPrint_Sample, 0, 16, 16, 2, 2 },
+	{ "Scale_B12", sizeof(Scale_B12), 0, sPerEnc_Scale_B12, sPerDec_Scale_B12, sOerEnc_Scale_B12, sOerDec_Scale_B12, sBerEnc_Scale_B12, sBerDec_Scale_B12, sPrint_Scale_B12, 0, 12, 12, 2, 2 },
+	{ "Second", sizeof(Second), 0, sPerEnc_Second, sPerDec_Second, sOerEnc_Second, sOerDec_Second, sBerEnc_Second, sBerDec_Second, sPrint_Second, 0, 6, 6, 1, 1 },
+	{ "SecondOfTime", sizeof(SecondOfTime), 0, sPerEnc_SecondOfTime, sPerDec_SecondOfTime, sOerEnc_SecondOfTime, sOerDec_SecondOfTime, sBerEnc_SecondOfTime, sBerDec_SecondOfTime, sPrint_SecondOfTime, 0, 6, 6, 1, 1 },
+	{ "SecondsAngle", sizeof(SecondsAngle), 0, sPerEnc_SecondsAngle, sPerDec_SecondsAngle, sOerEnc_SecondsAngle, sOerDec_SecondsAngle, sBerEnc_SecondsAngle, sBerDec_SecondsAngle, sPrint_SecondsAngle, 0, 13, 13, 2, 2 },
+	{ "SegmentAttributeLL", sizeof(SegmentAttributeLL), 0, sPerEnc_SegmentAttributeLL, sPerDec_SegmentAttributeLL, sOerEnc_SegmentAttributeLL, sOerDec_SegmentAttributeLL, sBerEnc_SegmentAttributeLL, sBerDec_SegmentAttributeLL, sPrint_SegmentAttributeLL, ASN_SIZE_EXT, 7, 7, 1, 1 },
+	{ "SegmentAttributeLLList", sizeof(SegmentAttributeLLList), 0, sPerEnc_SegmentAttributeLLList, sPerDec_SegmentAttributeLLList, sOerEnc_SegmentAttributeLLList, sOerDec_SegmentAttributeLLList, sBerEnc_SegmentAttributeLLList, sBerDec_SegmentAttributeLLList, sPrint_SegmentAttributeLLList, ASN_SIZE_EXT, 10, 59, 3, 10 },
+	{ "SegmentAttributeXY", sizeof(SegmentAttributeXY), 0, sPerEnc_SegmentAttributeXY, sPerDec_SegmentAttributeXY, sOerEnc_SegmentAttributeXY, sOerDec_SegmentAttributeXY, sBerEnc_SegmentAttributeXY, sBerDec_SegmentAttributeXY, sPrint_SegmentAttributeXY, ASN_SIZE_EXT, 7, 7, 1, 1 },
+	{ "SegmentAttributeXYList", sizeof(SegmentAttributeXYList), 0, sPerEnc_SegmentAttributeXYList, sPerDec_SegmentAttributeXYList, sOerEnc_SegmentAttributeXYList, sOerDec_SegmentAttributeXYList, sBerEnc_SegmentAttributeXYList, sBerDec_SegmentAttributeXYList, sPrint_SegmentAttributeXYList, ASN_SIZE_EXT, 10, 59, 3, 10 },
+	{ "SemiMajorAxisAccuracy", sizeof(SemiMajorAxisAccuracy), 0, sPerEnc_SemiMajorAxisAccuracy, sPerDec_SemiMajorAxisAccuracy, sOerEnc_SemiMajorAxisAccuracy, sOerDec_SemiMajorAxisAccuracy, sBerEnc_SemiMajorAxisAccuracy, sBerDec_SemiMajorAxisAccuracy, sPrint_SemiMajorAxisAccuracy, 0, 8, 8, 1, 1 },
+	{ "SemiMajorAxisOrientation", sizeof(SemiMajorAxisOrientation), 0, sPerEnc_SemiMajorAxisOrientation, sPerDec_SemiMajorAxisOrientation, sOerEnc_SemiMajorAxisOrientation, sOerDec_SemiMajorAxisOrientation, sBerEnc_SemiMajorAxisOrientation, sBerDec_SemiMajorAxisOrientation, sPrint_SemiMajorAxisOrientation, 0, 16, 16, 2, 2 },
+	{ "SemiMinorAxisAccuracy", sizeof(SemiMinorAxisAccuracy), 0, sPerEnc_SemiMinorAxisAccuracy, sPerDec_SemiMinorAxisAccuracy, sOerEnc_SemiMinorAxisAccuracy, sOerDec_SemiMinorAxisAccuracy, sBerEnc_SemiMinorAxisAccuracy, sBerDec_SemiMinorAxisAccuracy, sPrint_SemiMinorAxisAccuracy, 0, 8, 8, 1, 1 },
+	{ "ShapePointSet", sizeof(ShapePointSet), 0, sPerEnc_ShapePointSet, sPerDec_ShapePointSet, sOerEnc_ShapePointSet, sOerDec_ShapePointSet, sBerEnc_ShapePointSet, sBerDec_ShapePointSet, sPrint_ShapePointSet, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 45, 0, 10, 0 },
+	{ "SignPrority", sizeof(SignPrority), 0, sPerEnc_SignPrority, sPerDec_SignPrority, sOerEnc_SignPrority, sOerDec_SignPrority, sBerEnc_SignPrority, sBerDec_SignPrority, sPrint_SignPrority, 0, 3, 3, 1, 1 },
+	{ "SignalControlZone", sizeof(SignalControlZone), 0, sPerEnc_SignalControlZone, sPerDec_SignalControlZone, sOerEnc_SignalControlZone, sOerDec_SignalControlZone, sBerEnc_SignalControlZone, sBerDec_SignalControlZone, sPrint_SignalControlZone, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 25, 0, 3, 0 },
+	{ "SignalGroupID", sizeof(SignalGroupID), 0, sPerEnc_SignalGroupID, sPerDec_SignalGroupID, sOerEnc_SignalGroupID, sOerDec_SignalGroupID, sBerEnc_SignalGroupID, sBerDec_SignalGroupID, sPrint_SignalGroupID, 0, 8, 8, 1, 1 },
+	{ "SignalHeadLocation", sizeof(SignalHeadLocation), 0, sPerEnc_SignalHeadLocation, sPerDec_SignalHeadLocation, sOerEnc_SignalHeadLocation, sOerDec_SignalHeadLocation, sBerEnc_SignalHeadLocation, sBerDec_SignalHeadLocation, sPrint_SignalHeadLocation, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 32, 0, 5, 0 },
+	{ "SignalHeadLocationList", sizeof(SignalHeadLocationList), 0, sPerEnc_SignalHeadLocationList, sPerDec_SignalHeadLocationList, sOerEnc_SignalHeadLocationList, sOerDec_SignalHeadLocationList, sBerEnc_SignalHeadLocationList, sBerDec_SignalHeadLocationList, sPrint_SignalHeadLocationList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 37, 0, 7, 0 },
+	{ "SignalReqScheme", sizeof(SignalReqScheme), sTest_SignalReqScheme, sPerEnc_SignalReqScheme, sPerDec_SignalReqScheme, sOerEnc_SignalReqScheme, sOerDec_SignalReqScheme, sBerEnc_SignalReqScheme, sBerDec_SignalReqScheme, sPrint_SignalReqScheme, 0, 8, 8, 1, 1 },
+	{ "SignalRequest", sizeof(SignalRequest), 0, sPerEnc_SignalRequest, sPerDec_SignalRequest, sOerEnc_SignalRequest, sOerDec_SignalRequest, sBerEnc_SignalRequest, sBerDec_SignalRequest, sPrint_SignalRequest, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 38, 0, 8, 0 },
+	{ "SignalRequestList", sizeof(SignalRequestList), 0, sPerEnc_SignalRequestList, sPerDec_SignalRequestList, sOerEnc_SignalRequestList, sOerDec_SignalRequestList, sBerEnc_SignalRequestList, sBerDec_SignalRequestList, sPrint_SignalRequestList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 48, 0, 11, 0 },
+	{ "SignalRequestMessage", sizeof(SignalRequestMessage), sTest_SignalRequestMessage, sPerEnc_SignalRequestMessage, sPerDec_SignalRequestMessage, sOerEnc_SignalRequestMessage, sOerDec_SignalRequestMessage, sBerEnc_SignalRequestMessage, sBerDec_SignalRequestMessage, sPrint_SignalRequestMessage, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 63, 0, 10, 0 },
+	{ "SignalRequestMessage_regional", sizeof(SignalRequestMessage_regional), 0, sPerEnc_SignalRequestMessage_regional, sPerDec_SignalRequestMessage_regional, sOerEnc_SignalRequestMessage_regional, sOerDec_SignalRequestMessage_regional, sBerEnc_SignalRequestMessage_regional, sBerDec_SignalRequestMessage_regional, sPrint_SignalRequestMessage_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "SignalRequestPackage", sizeof(SignalRequestPackage), 0, sPerEnc_SignalRequestPackage, sPerDec_SignalRequestPackage, sOerEnc_SignalRequestPackage, sOerDec_SignalRequestPackage, sBerEnc_SignalRequestPackage, sBerDec_SignalRequestPackage, sPrint_SignalRequestPackage, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 43, 0, 9, 0 },
+	{ "SignalRequestPackage_regional", sizeof(SignalRequestPackage_regional), 0, sPerEnc_SignalRequestPackage_regional, sPerDec_SignalRequestPackage_regional, sOerEnc_SignalRequestPackage_regional, sOerDec_SignalRequestPackage_regional, sBerEnc_SignalRequestPackage_regional, sBerDec_SignalRequestPackage_regional, sPrint_SignalRequestPackage_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "SignalRequest_regional", sizeof(SignalRequest_regional), 0, sPerEnc_SignalRequest_regional, sPerDec_SignalRequest_regional, sOerEnc_SignalRequest_regional, sOerDec_SignalRequest_regional, sBerEnc_SignalRequest_regional, sBerDec_SignalRequest_regional, sPrint_SignalRequest_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "SignalRequesterInfo", sizeof(SignalRequesterInfo), 0, sPerEnc_SignalRequesterInfo, sPerDec_SignalRequesterInfo, sOerEnc_SignalRequesterInfo, sOerDec_SignalRequesterInfo, sBerEnc_SignalRequesterInfo, sBerDec_SignalRequesterInfo, sPrint_SignalRequesterInfo, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 51, 0, 8, 0 },
+	{ "SignalStatus", sizeof(SignalStatus), 0, sPerEnc_SignalStatus, sPerDec_SignalStatus, sOerEnc_SignalStatus, sOerDec_SignalStatus, sBerEnc_SignalStatus, sBerDec_SignalStatus, sPrint_SignalStatus, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 49, 0, 11, 0 },
+	{ "SignalStatusList", sizeof(SignalStatusList), 0, sPerEnc_SignalStatusList, sPerDec_SignalStatusList, sOerEnc_SignalStatusList, sOerDec_SignalStatusList, sBerEnc_SignalStatusList, sBerDec_SignalStatusList, sPrint_SignalStatusList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 54, 0, 13, 0 },
+	{ "SignalStatusMessage", sizeof(SignalStatusMessage), sTest_SignalStatusMessage, sPerEnc_SignalStatusMessage, sPerDec_SignalStatusMessage, sOerEnc_SignalStatusMessage, sOerDec_SignalStatusMessage, sBerEnc_SignalStatusMessage, sBerDec_SignalStatusMessage, sPrint_SignalStatusMessage, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 74, 0, 16, 0 },
+	{ "SignalStatusMessage_regional", sizeof(SignalStatusMessage_regional), 0, sPerEnc_SignalStatusMessage_regional, sPerDec_SignalStatusMessage_regional, sOerEnc_SignalStatusMessage_regional, sOerDec_SignalStatusMessage_regional, sBerEnc_SignalStatusMessage_regional, sBerDec_SignalStatusMessage_regional, sPrint_SignalStatusMessage_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "SignalStatusPackage", sizeof(SignalStatusPackage), 0, sPerEnc_SignalStatusPackage, sPerDec_SignalStatusPackage, sOerEnc_SignalStatusPackage, sOerDec_SignalStatusPackage, sBerEnc_SignalStatusPackage, sBerDec_SignalStatusPackage, sPrint_SignalStatusPackage, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 18, 0, 4, 0 },
+	{ "SignalStatusPackageList", sizeof(SignalStatusPackageList), 0, sPerEnc_SignalStatusPackageList, sPerDec_SignalStatusPackageList, sOerEnc_SignalStatusPackageList, sOerDec_SignalStatusPackageList, sBerEnc_SignalStatusPackageList, sBerDec_SignalStatusPackageList, sPrint_SignalStatusPackageList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 23, 0, 6, 0 },
+	{ "SignalStatusPackage_regional", sizeof(SignalStatusPackage_regional), 0, sPerEnc_SignalStatusPackage_regional, sPerDec_SignalStatusPackage_regional, sOerEnc_SignalStatusPackage_regional, sOerDec_SignalStatusPackage_regional, sBerEnc_SignalStatusPackage_regional, sBerDec_SignalStatusPackage_regional, sPrint_SignalStatusPackage_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "SignalStatus_regional", sizeof(SignalStatus_regional), 0, sPerEnc_SignalStatus_regional, sPerDec_SignalStatus_regional, sOerEnc_SignalStatus_regional, sOerDec_SignalStatus_regional, sBerEnc_SignalStatus_regional, sBerDec_SignalStatus_regional, sPrint_SignalStatus_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "SirenInUse", sizeof(SirenInUse), 0, sPerEnc_SirenInUse, sPerDec_SirenInUse, sOerEnc_SirenInUse, sOerDec_SirenInUse, sBerEnc_SirenInUse, sBerDec_SirenInUse, sPrint_SirenInUse, 0, 2, 2, 1, 1 },
+	{ "Snapshot", sizeof(Snapshot), 0, sPerEnc_Snapshot, sPerDec_Snapshot, sOerEnc_Snapshot, sOerDec_Snapshot, sBerEnc_Snapshot, sBerDec_Snapshot, sPrint_Snapshot, ASN_SIZE_EXT, 75, 6460, 11, 1090 },
+	{ "SnapshotDistance", sizeof(SnapshotDistance), 0, sPerEnc_SnapshotDistance, sPerDec_SnapshotDistance, sOerEnc_SnapshotDistance, sOerDec_SnapshotDistance, sBerEnc_SnapshotDistance, sBerDec_SnapshotDistance, sPrint_SnapshotDistance, 0, 30, 30, 6, 6 },
+	{ "SnapshotTime", sizeof(SnapshotTime), 0, sPerEnc_SnapshotTime, sPerDec_SnapshotTime, sOerEnc_SnapshotTime, sOerDec_SnapshotTime, sBerEnc_SnapshotTime, sBerDec_SnapshotTime, sPrint_SnapshotTime, 0, 22, 22, 4, 4 },
+	{ "SpecialVehicleExtensions", sizeof(SpecialVehicleExtensions), sTest_SpecialVehicleExtensions, sPerEnc_SpecialVehicleExtensions, sPerDec_SpecialVehicleExtensions, sOerEnc_SpecialVehicleExtensions, sOerDec_SpecialVehicleExtensions, sBerEnc_SpecialVehicleExtensions, sBerDec_SpecialVehicleExtensions, sPrint_SpecialVehicleExtensions, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 4, 0, 1, 0 },
+	{ "Speed", sizeof(Speed), 0, sPerEnc_Speed, sPerDec_Speed, sOerEnc_Speed, sOerDec_Speed, sBerEnc_Speed, sBerDec_Speed, sPrint_Speed, 0, 13, 13, 2, 2 },
+	{ "SpeedAdvice", sizeof(SpeedAdvice), 0, sPerEnc_SpeedAdvice, sPerDec_SpeedAdvice, sOerEnc_SpeedAdvice, sOerDec_SpeedAdvice, sBerEnc_SpeedAdvice, sBerDec_SpeedAdvice, sPrint_SpeedAdvice, 0, 9, 9, 2, 2 },
+	{ "SpeedConfidence", sizeof(SpeedConfidence), 0, sPerEnc_SpeedConfidence, sPerDec_SpeedConfidence, sOerEnc_SpeedConfidence, sOerDec_SpeedConfidence, sBerEnc_SpeedConfidence, sBerDec_SpeedConfidence, sPrint_SpeedConfidence, 0, 3, 3, 1, 1 },
+	{ "SpeedLimit", sizeof(SpeedLimit), 0, sPerEnc_SpeedLimit, sPerDec_SpeedLimit, sOerEnc_SpeedLimit, sOerDec_SpeedLimit, sBerEnc_SpeedLimit, sBerDec_SpeedLimit, sPrint_SpeedLimit, 0, 16, 1876, 5, 290 },
+	{ "SpeedLimitList", sizeof(SpeedLimitList), 0, sPerEnc_SpeedLimitList, sPerDec_SpeedLimitList, sOerEnc_SpeedLimitList, sOerDec_SpeedLimitList, sBerEnc_SpeedLimitList, sBerDec_SpeedLimitList, sPrint_SpeedLimitList, ASN_SIZE_EXT, 22, 166, 5, 29 },
+	{ "SpeedLimitType", sizeof(SpeedLimitType), 0, sPerEnc_SpeedLimitType, sPerDec_SpeedLimitType, sOerEnc_SpeedLimitType, sOerDec_SpeedLimitType, sBerEnc_SpeedLimitType, sBerDec_SpeedLimitType, sPrint_SpeedLimitType, ASN_SIZE_EXT, 5, 5, 1, 1 },
+	{ "SpeedLimit_element", sizeof(SpeedLimit_element), 0, sPerEnc_SpeedLimit_element, sPerDec_SpeedLimit_element, sOerEnc_SpeedLimit_element, sOerDec_SpeedLimit_element, sBerEnc_SpeedLimit_element, sBerDec_SpeedLimit_element, sPrint_SpeedLimit_element, 0, 12, 117, 3, 18 },
+	{ "SpeedLimit_element_item", sizeof(SpeedLimit_element_item), 0, sPerEnc_SpeedLimit_element_item, sPerDec_SpeedLimit_element_item, sOerEnc_SpeedLimit_element_item, sOerDec_SpeedLimit_element_item, sBerEnc_SpeedLimit_element_item, sBerDec_SpeedLimit_element_item, sPrint_SpeedLimit_element_item, 0, 12, 117, 3, 18 },
+	{ "SpeedProfile", sizeof(SpeedProfile), 0, sPerEnc_SpeedProfile, sPerDec_SpeedProfile, sOerEnc_SpeedProfile, sOerDec_SpeedProfile, sBerEnc_SpeedProfile, sBerDec_SpeedProfile, sPrint_SpeedProfile, ASN_SIZE_EXT, 11, 106, 4, 23 },
+	{ "SpeedProfileMeasurement", sizeof(SpeedProfileMeasurement), 0, sPerEnc_SpeedProfileMeasurement, sPerDec_SpeedProfileMeasurement, sOerEnc_SpeedProfileMeasurement, sOerDec_SpeedProfileMeasurement, sBerEnc_SpeedProfileMeasurement, sBerDec_SpeedProfileMeasurement, sPrint_SpeedProfileMeasurement, 0, 5, 5, 1, 1 },
+	{ "SpeedProfileMeasurementList", sizeof(SpeedProfileMeasurementList), 0, sPerEnc_SpeedProfileMeasurementList, sPerDec_SpeedProfileMeasurementList, sOerEnc_SpeedProfileMeasurementList, sOerDec_SpeedProfileMeasurementList, sBerEnc_SpeedProfileMeasurementList, sBerDec_SpeedProfileMeasurementList, sPrint_SpeedProfileMeasurementList, 0, 10, 105, 3, 22 },
+	{ "SpeedandHeadingandThrottleConfidence", sizeof(SpeedandHeadingandThrottleConfidence), 0, sPerEnc_SpeedandHeadingandThrottleConfidence, sPerDec_SpeedandHeadingandThrottleConfidence, sOerEnc_SpeedandHeadingandThrottleConfidence, sOerDec_SpeedandHeadingandThrottleConfidence, sBerEnc_SpeedandHeadingandThrottleConfidence, sBerDec_SpeedandHeadingandThrottleConfidence, sPrint_SpeedandHeadingandThrottleConfidence, 0, 8, 8, 3, 3 },
+	{ "StabilityControlStatus", sizeof(StabilityControlStatus), 0, sPerEnc_StabilityControlStatus, sPerDec_StabilityControlStatus, sOerEnc_StabilityControlStatus, sOerDec_StabilityControlStatus, sBerEnc_StabilityControlStatus, sBerDec_StabilityControlStatus, sPrint_StabilityControlStatus, 0, 2, 2, 1, 1 },
+	{ "StationID", sizeof(StationID), 0, sPerEnc_StationID, sPerDec_StationID, sOerEnc_StationID, sOerDec_StationID, sBerEnc_StationID, sBerDec_StationID, sPrint_StationID, 0, 32, 32, 4, 4 },
+	{ "SteeringAxleLubePressure", sizeof(SteeringAxleLubePressure), 0, sPerEnc_SteeringAxleLubePressure, sPerDec_SteeringAxleLubePressure, sOerEnc_SteeringAxleLubePressure, sOerDec_SteeringAxleLubePressure, sBerEnc_SteeringAxleLubePressure, sBerDec_SteeringAxleLubePressure, sPrint_SteeringAxleLubePressure, 0, 8, 8, 1, 1 },
+	{ "SteeringAxleTemperature", sizeof(SteeringAxleTemperature), 0, sPerEnc_SteeringAxleTemperature, sPerDec_SteeringAxleTemperature, sOerEnc_SteeringAxleTemperature, sOerDec_SteeringAxleTemperature, sBerEnc_SteeringAxleTemperature, sBerDec_SteeringAxleTemperature, sPrint_SteeringAxleTemperature, 0, 8, 8, 2, 2 },
+	{ "SteeringWheelAngle", sizeof(SteeringWheelAngle), 0, sPerEnc_SteeringWheelAngle, sPerDec_SteeringWheelAngle, sOerEnc_SteeringWheelAngle, sOerDec_SteeringWheelAngle, sBerEnc_SteeringWheelAngle, sBerDec_SteeringWheelAngle, sPrint_SteeringWheelAngle, 0, 8, 8, 1, 1 },
+	{ "SteeringWheelAngleConfidence", sizeof(SteeringWheelAngleConfidence), 0, sPerEnc_SteeringWheelAngleConfidence, sPerDec_SteeringWheelAngleConfidence, sOerEnc_SteeringWheelAngleConfidence, sOerDec_SteeringWheelAngleConfidence, sBerEnc_SteeringWheelAngleConfidence, sBerDec_SteeringWheelAngleConfidence, sPrint_SteeringWheelAngleConfidence, 0, 2, 2, 1, 1 },
+	{ "SteeringWheelAngleRateOfChange", sizeof(SteeringWheelAngleRateOfChange), 0, sPerEnc_SteeringWheelAngleRateOfChange, sPerDec_SteeringWheelAngleRateOfChange, sOerEnc_SteeringWheelAngleRateOfChange, sOerDec_SteeringWheelAngleRateOfChange, sBerEnc_SteeringWheelAngleRateOfChange, sBerDec_SteeringWheelAngleRateOfChange, sPrint_SteeringWheelAngleRateOfChange, 0, 8, 8, 1, 1 },
+	{ "Subscription", sizeof(Subscription), 0, sPerEnc_Subscription, sPerDec_Subscription, sOerEnc_Subscription, sOerDec_Subscription, sBerEnc_Subscription, sBerDec_Subscription, sPrint_Subscription, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 38, 0, 7, 0 },
+	{ "SubscriptionData", sizeof(SubscriptionData), 0, sPerEnc_SubscriptionData, sPerDec_SubscriptionData, sOerEnc_SubscriptionData, sOerDec_SubscriptionData, sBerEnc_SubscriptionData, sBerDec_SubscriptionData, sPrint_SubscriptionData, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 44, 0, 10, 0 },
+	{ "SubscriptionData_datexSubscribe_PublishFormat_cd", sizeof(SubscriptionData_datexSubscribe_PublishFormat_cd), 0, sPerEnc_SubscriptionData_datexSubscribe_PublishFormat_cd, sPerDec_SubscriptionData_datexSubscribe_PublishFormat_cd, sOerEnc_SubscriptionData_datexSubscribe_PublishFormat_cd, sOerDec_SubscriptionData_datexSubscribe_PublishFormat_cd, sBerEnc_SubscriptionData_datexSubscribe_PublishFormat_cd, sBerDec_SubscriptionData_datexSubscribe_PublishFormat_cd, sPrint_SubscriptionData_datexSubscribe_PublishFormat_cd, ASN_SIZE_EXT, 3, 3, 1, 1 },
+	{ "SubscriptionData_datexSubscribe_Status_cd", sizeof(SubscriptionData_datexSubscribe_Status_cd), 0, sPerEnc_SubscriptionData_datexSubscribe_Status_cd, sPerDec_SubscriptionData_datexSubscribe_Status_cd, sOerEnc_SubscriptionData_datexSubscribe_Status_cd, sOerDec_SubscriptionData_datexSubscribe_Status_cd, sBerEnc_SubscriptionData_datexSubscribe_Status_cd, sBerDec_SubscriptionData_datexSubscribe_Status_cd, sPrint_SubscriptionData_datexSubscribe_Status_cd, 0, 1, 1, 1, 1 },
+	{ "SubscriptionMode", sizeof(SubscriptionMode), 0, sPerEnc_SubscriptionMode, sPerDec_SubscriptionMode, sOerEnc_SubscriptionMode, sOerDec_SubscriptionMode, sBerEnc_SubscriptionMode, sBerDec_SubscriptionMode, sPrint_SubscriptionMode, ASN_SIZE_EXT, 2, 286, 1, 52 },
+	{ "SubscriptionType", sizeof(SubscriptionType), 0, sPerEnc_SubscriptionType, sPerDec_SubscriptionType, sOerEnc_SubscriptionType, sOerDec_SubscriptionType, sBerEnc_SubscriptionType, sBerDec_SubscriptionType, sPrint_SubscriptionType, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 5, 0, 2, 0 },
+	{ "SubscriptionType_datexSubscribe_CancelReason_cd", sizeof(SubscriptionType_datexSubscribe_CancelReason_cd), 0, sPerEnc_SubscriptionType_datexSubscribe_CancelReason_cd, sPerDec_SubscriptionType_datexSubscribe_CancelReason_cd, sOerEnc_SubscriptionType_datexSubscribe_CancelReason_cd, sOerDec_SubscriptionType_datexSubscribe_CancelReason_cd, sBerEnc_SubscriptionType_datexSubscribe_CancelReason_cd, sBerDec_SubscriptionType_datexSubscribe_CancelReason_cd, sPrint_SubscriptionType_datexSubscribe_CancelReason_cd, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "SummerTime", sizeof(SummerTime), 0, sPerEnc_SummerTime, sPerDec_SummerTime, sOerEnc_SummerTime, sOerDec_SummerTime, sBerEnc_SummerTime, sBerDec_SummerTime, sPrint_SummerTime, 0, 1, 1, 1, 1 },
+	{ "SunSensor", sizeof(SunSensor), 0, sPerEnc_SunSensor, sPerDec_SunSensor, sOerEnc_SunSensor, sOerDec_SunSensor, sBerEnc_SunSensor, sBerDec_SunSensor, sPrint_SunSensor, 0, 10, 10, 2, 2 },
+	{ "SupplementalVehicleExtensions", sizeof(SupplementalVehicleExtensions), sTest_SupplementalVehicleExtensions, sPerEnc_SupplementalVehicleExtensions, sPerDec_SupplementalVehicleExtensions, sOerEnc_SupplementalVehicleExtensions, sOerDec_SupplementalVehicleExtensions, sBerEnc_SupplementalVehicleExtensions, sBerDec_SupplementalVehicleExtensions, sPrint_SupplementalVehicleExtensions, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 11, 0, 2, 0 },
+	{ "SupplementalVehicleExtensions_regional", sizeof(SupplementalVehicleExtensions_regional), 0, sPerEnc_SupplementalVehicleExtensions_regional, sPerDec_SupplementalVehicleExtensions_regional, sOerEnc_SupplementalVehicleExtensions_regional, sOerDec_SupplementalVehicleExtensions_regional, sBerEnc_SupplementalVehicleExtensions_regional, sBerDec_SupplementalVehicleExtensions_regional, sPrint_SupplementalVehicleExtensions_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "TemporaryID", sizeof(TemporaryID), 0, sPerEnc_TemporaryID, sPerDec_TemporaryID, sOerEnc_TemporaryID, sOerDec_TemporaryID, sBerEnc_TemporaryID, sBerDec_TemporaryID, sPrint_TemporaryID, 0, 32, 32, 4, 4 },
+	{ "TenthSecond", sizeof(TenthSecond), 0, sPerEnc_TenthSecond, sPerDec_TenthSecond, sOerEnc_TenthSecond, sOerDec_TenthSecond, sBerEnc_TenthSecond, sBerDec_TenthSecond, sPrint_TenthSecond, 0, 4, 4, 1, 1 },
+	{ "TermDistance", sizeof(TermDistance), 0, sPerEnc_TermDistance, sPerDec_TermDistance, sOerEnc_TermDistance, sOerDec_TermDistance, sBerEnc_TermDistance, sBerDec_TermDistance, sPrint_TermDistance, 0, 15, 15, 2, 2 },
+	{ "TermTime", sizeof(TermTime), 0, sPerEnc_TermTime, sPerDec_TermTime, sOerEnc_TermTime, sOerDec_TermTime, sBerEnc_TermTime, sBerDec_TermTime, sPrint_TermTime, 0, 11, 11, 2, 2 },
+	{ "Terminate", sizeof(Terminate), 0, sPerEnc_Terminate, sPerDec_Terminate, sOerEnc_Terminate, sOerDec_Terminate, sBerEnc_Terminate, sBerDec_Terminate, sPrint_Terminate, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "TestMessage00", sizeof(TestMessage00), sTest_TestMessage00, sPerEnc_TestMessage00, sPerDec_TestMessage00, sOerEnc_TestMessage00, sOerDec_TestMessage00, sBerEnc_TestMessage00, sBerDec_TestMessage00, sPrint_TestMessage00, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "TestMessage01", sizeof(TestMessage01), sTest_TestMessage01, sPerEnc_TestMessage01, sPerDec_TestMessage01, sOerEnc_TestMessage01, sOerDec_TestMessage01, sBerEnc_TestMessage01, sBerDec_TestMessage01, sPrint_TestMessage01, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "TestMessage02", sizeof(TestMessage02), sTest_TestMessage02, sPerEnc_TestMessage02, sPerDec_TestMessage02, sOerEnc_TestMessage02, sOerDec_TestMessage02, sBerEnc_TestMessage02, sBerDec_TestMessage02, sPrint_TestMessage02, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "TestMessage03", sizeof(TestMessage03), sTest_TestMessage03, sPerEnc_TestMessage03, sPerDec_TestMessage03, sOerEnc_TestMessage03, sOerDec_TestMessage03, sBerEnc_TestMessage03, sBerDec_TestMessage03, sPrint_TestMessage03, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "TestMessage04", sizeof(TestMessage04), sTest_TestMessage04, sPerEnc_TestMessage04, sPerDec_TestMessage04, sOerEnc_TestMessage04, sOerDec_TestMessage04, sBerEnc_TestMessage04, sBerDec_TestMessage04, sPrint_TestMessage04, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "TestMessage05", sizeof(TestMessage05), sTest_TestMessage05, sPerEnc_TestMessage05, sPerDec_TestMessage05, sOerEnc_TestMessage05, sOerDec_TestMessage05, sBerEnc_TestMessage05, sBerDec_TestMessage05, sPrint_TestMessage05, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "TestMessage06", sizeof(TestMessage06), sTest_TestMessage06, sPerEnc_TestMessage06, sPerDec_TestMessage06, sOerEnc_TestMessage06, sOerDec_TestMessage06, sBerEnc_TestMessage06, sBerDec_TestMessage06, sPrint_TestMessage06, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "TestMessage07", sizeof(TestMessage07), sTest_TestMessage07, sPerEnc_TestMessage07, sPerDec_TestMessage07, sOerEnc_TestMessage07, sOerDec_TestMessage07, sBerEnc_TestMessage07, sBerDec_TestMessage07, sPrint_TestMessage07, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "TestMessage08", sizeof(TestMessage08), sTest_TestMessage08, sPerEnc_TestMessage08, sPerDec_TestMessage08, sOerEnc_TestMessage08, sOerDec_TestMessage08, sBerEnc_TestMessage08, sBerDec_TestMessage08, sPrint_TestMessage08, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "TestMessage09", sizeof(TestMessage09), sTest_TestMessage09, sPerEnc_TestMessage09, sPerDec_TestMessage09, sOerEnc_TestMessage09, sOerDec_TestMessage09, sBerEnc_TestMessage09, sBerDec_TestMessage09, sPrint_TestMessage09, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "TestMessage10", sizeof(TestMessage10), sTest_TestMessage10, sPerEnc_TestMessage10, sPerDec_TestMessage10, sOerEnc_TestMessage10, sOerDec_TestMessage10, sBerEnc_TestMessage10, sBerDec_TestMessage10, sPrint_TestMessage10, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "TestMessage11", sizeof(TestMessage11), sTest_TestMessage11, sPerEnc_TestMessage11, sPerDec_TestMessage11, sOerEnc_TestMessage11, sOerDec_TestMessage11, sBerEnc_TestMessage11, sBerDec_TestMessage11, sPrint_TestMessage11, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "TestMessage12", sizeof(TestMessage12), sTest_TestMessage12, sPerEnc_TestMessage12, sPerDec_TestMessage12, sOerEnc_TestMessage12, sOerDec_TestMessage12, sBerEnc_TestMessage12, sBerDec_TestMessage12, sPrint_TestMessage12, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "TestMessage13", sizeof(TestMessage13), sTest_TestMessage13, sPerEnc_TestMessage13, sPerDec_TestMessage13, sOerEnc_TestMessage13, sOerDec_TestMessage13, sBerEnc_TestMessage13, sBerDec_TestMessage13, sPrint_TestMessage13, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "TestMessage14", sizeof(TestMessage14), sTest_TestMessage14, sPerEnc_TestMessage14, sPerDec_TestMessage14, sOerEnc_TestMessage14, sOerDec_TestMessage14, sBerEnc_TestMessage14, sBerDec_TestMessage14, sPrint_TestMessage14, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "TestMessage15", sizeof(TestMessage15), sTest_TestMessage15, sPerEnc_TestMessage15, sPerDec_TestMessage15, sOerEnc_TestMessage15, sOerDec_TestMessage15, sBerEnc_TestMessage15, sBerDec_TestMessage15, sPrint_TestMessage15, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 3, 0, 1, 0 },
+	{ "ThrottleConfidence", sizeof(ThrottleConfidence), 0, sPerEnc_ThrottleConfidence, sPerDec_ThrottleConfidence, sOerEnc_ThrottleConfidence, sOerDec_ThrottleConfidence, sBerEnc_ThrottleConfidence, sBerDec_ThrottleConfidence, sPrint_ThrottleConfidence, 0, 2, 2, 1, 1 },
+	{ "ThrottlePosition", sizeof(ThrottlePosition), 0, sPerEnc_ThrottlePosition, sPerDec_ThrottlePosition, sOerEnc_ThrottlePosition, sOerDec_ThrottlePosition, sBerEnc_ThrottlePosition, sBerDec_ThrottlePosition, sPrint_ThrottlePosition, 0, 8, 8, 1, 1 },
+	{ "Time", sizeof(Time), 0, sPerEnc_Time, sPerDec_Time, sOerEnc_Time, sOerDec_Time, sBerEnc_Time, sBerDec_Time, sPrint_Time, ASN_SIZE_EXT, 14, 75, 3, 14 },
+	{ "TimeChangeDetails", sizeof(TimeChangeDetails), 0, sPerEnc_TimeChangeDetails, sPerDec_TimeChangeDetails, sOerEnc_TimeChangeDetails, sOerDec_TimeChangeDetails, sBerEnc_TimeChangeDetails, sBerDec_TimeChangeDetails, sPrint_TimeChangeDetails, 0, 21, 89, 3, 12 },
+	{ "TimeConfidence", sizeof(TimeConfidence), 0, sPerEnc_TimeConfidence, sPerDec_TimeConfidence, sOerEnc_TimeConfidence, sOerDec_TimeConfidence, sBerEnc_TimeConfidence, sBerDec_TimeConfidence, sPrint_TimeConfidence, 0, 6, 6, 1, 1 },
+	{ "TimeIntervalConfidence", sizeof(TimeIntervalConfidence), 0, sPerEnc_TimeIntervalConfidence, sPerDec_TimeIntervalConfidence, sOerEnc_TimeIntervalConfidence, sOerDec_TimeIntervalConfidence, sBerEnc_TimeIntervalConfidence, sBerDec_TimeIntervalConfidence, sPrint_TimeIntervalConfidence, 0, 4, 4, 1, 1 },
+	{ "TimeMark", sizeof(TimeMark), 0, sPerEnc_TimeMark, sPerDec_TimeMark, sOerEnc_TimeMark, sOerDec_TimeMark, sBerEnc_TimeMark, sBerDec_TimeMark, sPrint_TimeMark, 0, 16, 16, 2, 2 },
+	{ "TimeOffset", sizeof(TimeOffset), 0, sPerEnc_TimeOffset, sPerDec_TimeOffset, sOerEnc_TimeOffset, sOerDec_TimeOffset, sBerEnc_TimeOffset, sBerDec_TimeOffset, sPrint_TimeOffset, 0, 16, 16, 2, 2 },
+	{ "TimeRemaining", sizeof(TimeRemaining), 0, sPerEnc_TimeRemaining, sPerDec_TimeRemaining, sOerEnc_TimeRemaining, sOerDec_TimeRemaining, sBerEnc_TimeRemaining, sBerDec_TimeRemaining, sPrint_TimeRemaining, 0, 14, 14, 2, 2 },
+	{ "Time_time_SecondFractions", sizeof(Time_time_SecondFractions), 0, sPerEnc_Time_time_SecondFractions, sPerDec_Time_time_SecondFractions, sOerEnc_Time_time_SecondFractions, sOerDec_Time_time_SecondFractions, sBerEnc_Time_time_SecondFractions, sBerDec_Time_time_SecondFractions, sPrint_Time_time_SecondFractions, ASN_SIZE_EXT, 7, 13, 2, 3 },
+	{ "Time_time_Timezone", sizeof(Time_time_Timezone), 0, sPerEnc_Time_time_Timezone, sPerDec_Time_time_Timezone, sOerEnc_Time_time_Timezone, sOerDec_Time_time_Timezone, sBerEnc_Time_time_Timezone, sBerDec_Time_time_Timezone, sPrint_Time_time_Timezone, 0, 2, 13, 1, 3 },
+	{ "TireData", sizeof(TireData), 0, sPerEnc_TireData, sPerDec_TireData, sOerEnc_TireData, sOerDec_TireData, sBerEnc_TireData, sBerDec_TireData, sPrint_TireData, ASN_SIZE_EXT, 8, 63, 1, 12 },
+	{ "TireDataList", sizeof(TireDataList), 0, sPerEnc_TireDataList, sPerDec_TireDataList, sOerEnc_TireDataList, sOerDec_TireDataList, sBerEnc_TireDataList, sBerDec_TireDataList, sPrint_TireDataList, ASN_SIZE_EXT, 12, 1012, 3, 194 },
+	{ "TireLeakageRate", sizeof(TireLeakageRate), 0, sPerEnc_TireLeakageRate, sPerDec_TireLeakageRate, sOerEnc_TireLeakageRate, sOerDec_TireLeakageRate, sBerEnc_TireLeakageRate, sBerDec_TireLeakageRate, sPrint_TireLeakageRate, 0, 16, 16, 2, 2 },
+	{ "TireLocation", sizeof(TireLocation), 0, sPerEnc_TireLocation, sPerDec_TireLocation, sOerEnc_TireLocation, sOerDec_TireLocation, sBerEnc_TireLocation, sBerDec_TireLocation, sPrint_TireLocation, 0, 8, 8, 1, 1 },
+	{ "TirePressure", sizeof(TirePressure), 0, sPerEnc_TirePressure, sPerDec_TirePressure, sOerEnc_TirePressure, sOerDec_TirePressure, sBerEnc_TirePressure, sBerDec_TirePressure, sPrint_TirePressure, 0, 8, 8, 1, 1 },
+	{ "TirePressureThresholdDetection", sizeof(TirePressureThresholdDetection), 0, sPerEnc_TirePressureThresholdDetection, sPerDec_TirePressureThresholdDetection, sOerEnc_TirePressureThresholdDetection, sOerDec_TirePressureThresholdDetection, sBerEnc_TirePressureThresholdDetection, sBerDec_TirePressureThresholdDetection, sPrint_TirePressureThresholdDetection, 0, 3, 3, 1, 1 },
+	{ "TireTemp", sizeof(TireTemp), 0, sPerEnc_TireTemp, sPerDec_TireTemp, sOerEnc_TireTemp, sOerDec_TireTemp, sBerEnc_TireTemp, sBerDec_TireTemp, sPrint_TireTemp, 0, 16, 16, 4, 4 },
+	{ "TractionControlStatus", sizeof(TractionControlStatus), 0, sPerEnc_TractionControlStatus, sPerDec_TractionControlStatus, sOerEnc_TractionControlStatus, sOerDec_TractionControlStatus, sBerEnc_TractionControlStatus, sBerDec_TractionControlStatus, sPrint_TractionControlStatus, 0, 2, 2, 1, 1 },
+	{ "TrailerData", sizeof(TrailerData), 0, sPerEnc_TrailerData, sPerDec_TrailerData, sOerEnc_TrailerData, sOerDec_TrailerData, sBerEnc_TrailerData, sBerDec_TrailerData, sPrint_TrailerData, ASN_SIZE_EXT, 121, 14845, 27, 2298 },
+	{ "TrailerHistoryPoint", sizeof(TrailerHistoryPoint), 0, sPerEnc_TrailerHistoryPoint, sPerDec_TrailerHistoryPoint, sOerEnc_TrailerHistoryPoint, sOerDec_TrailerHistoryPoint, sBerEnc_TrailerHistoryPoint, sBerDec_TrailerHistoryPoint, sPrint_TrailerHistoryPoint, ASN_SIZE_EXT, 58, 73, 9, 11 },
+	{ "TrailerHistoryPointList", sizeof(TrailerHistoryPointList), 0, sPerEnc_TrailerHistoryPointList, sPerDec_TrailerHistoryPointList, sOerEnc_TrailerHistoryPointList, sOerDec_TrailerHistoryPointList, sBerEnc_TrailerHistoryPointList, sBerDec_TrailerHistoryPointList, sPrint_TrailerHistoryPointList, ASN_SIZE_EXT, 63, 1684, 11, 255 },
+	{ "TrailerMass", sizeof(TrailerMass), 0, sPerEnc_TrailerMass, sPerDec_TrailerMass, sOerEnc_TrailerMass, sOerDec_TrailerMass, sBerEnc_TrailerMass, sBerDec_TrailerMass, sPrint_TrailerMass, 0, 8, 8, 1, 1 },
+	{ "TrailerUnitDescription", sizeof(TrailerUnitDescription), 0, sPerEnc_TrailerUnitDescription, sPerDec_TrailerUnitDescription, sOerEnc_TrailerUnitDescription, sOerDec_TrailerUnitDescription, sBerEnc_TrailerUnitDescription, sBerDec_TrailerUnitDescription, sPrint_TrailerUnitDescription, ASN_SIZE_EXT, 84, 1851, 17, 286 },
+	{ "TrailerUnitDescriptionList", sizeof(TrailerUnitDescriptionList), 0, sPerEnc_TrailerUnitDescriptionList, sPerDec_TrailerUnitDescriptionList, sOerEnc_TrailerUnitDescriptionList, sOerDec_TrailerUnitDescriptionList, sBerEnc_TrailerUnitDescriptionList, sBerDec_TrailerUnitDescriptionList, sPrint_TrailerUnitDescriptionList, ASN_SIZE_EXT, 87, 14811, 19, 2290 },
+	{ "TrailerWeight", sizeof(TrailerWeight), 0, sPerEnc_TrailerWeight, sPerDec_TrailerWeight, sOerEnc_TrailerWeight, sOerDec_TrailerWeight, sBerEnc_TrailerWeight, sBerDec_TrailerWeight, sPrint_TrailerWeight, 0, 16, 16, 2, 2 },
+	{ "TransferDone", sizeof(TransferDone), 0, sPerEnc_TransferDone, sPerDec_TransferDone, sOerEnc_TransferDone, sOerDec_TransferDone, sBerEnc_TransferDone, sBerDec_TransferDone, sPrint_TransferDone, 0, 41, 64049, 6, 8008 },
+	{ "TransitStatus", sizeof(TransitStatus), 0, sPerEnc_TransitStatus, sPerDec_TransitStatus, sOerEnc_TransitStatus, sOerDec_TransitStatus, sBerEnc_TransitStatus, sBerDec_TransitStatus, sPrint_TransitStatus, 0, 6, 6, 1, 1 },
+	{ "TransitVehicleOccupancy", sizeof(TransitVehicleOccupancy), 0, sPerEnc_TransitVehicleOccupancy, sPerDec_TransitVehicleOccupancy, sOerEnc_TransitVehicleOccupancy, sOerDec_TransitVehicleOccupancy, sBerEnc_TransitVehicleOccupancy, sBerDec_TransitVehicleOccupancy, sPrint_TransitVehicleOccupancy, 0, 3, 3, 1, 1 },
+	{ "TransitVehicleStatus", sizeof(TransitVehicleStatus), 0, sPerEnc_TransitVehicleStatus, sPerDec_TransitVehicleStatus, sOerEnc_TransitVehicleStatus, sOerDec_TransitVehicleStatus, sBerEnc_TransitVehicleStatus, sBerDec_TransitVehicleStatus, sPrint_TransitVehicleStatus, 0, 8, 8, 1, 1 },
+	{ "TransmissionAndSpeed", sizeof(TransmissionAndSpeed), 0, sPerEnc_TransmissionAndSpeed, sPerDec_TransmissionAndSpeed, sOerEnc_TransmissionAndSpeed, sOerDec_TransmissionAndSpeed, sBerEnc_TransmissionAndSpeed, sBerDec_TransmissionAndSpeed, sPrint_TransmissionAndSpeed, 0, 16, 16, 3, 3 },
+	{ "TransmissionState", sizeof(TransmissionState), 0, sPerEnc_TransmissionState, sPerDec_TransmissionState, sOerEnc_TransmissionState, sOerDec_TransmissionState, sBerEnc_TransmissionState, sBerDec_TransmissionState, sPrint_TransmissionState, 0, 3, 3, 1, 1 },
+	{ "TravelerDataFrame", sizeof(TravelerDataFrame), 0, sPerEnc_TravelerDataFrame, sPerDec_TravelerDataFrame, sOerEnc_TravelerDataFrame, sOerDec_TravelerDataFrame, sBerEnc_TravelerDataFrame, sBerDec_TravelerDataFrame, sPrint_TravelerDataFrame, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 114, 0, 26, 0 },
+	{ "TravelerDataFrameList", sizeof(TravelerDataFrameList), 0, sPerEnc_TravelerDataFrameList, sPerDec_TravelerDataFrameList, sOerEnc_TravelerDataFrameList, sOerDec_TravelerDataFrameList, sBerEnc_TravelerDataFrameList, sBerDec_TravelerDataFrameList, sPrint_TravelerDataFrameList, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 117, 0, 28, 0 },
+	{ "TravelerDataFrame_content", sizeof(TravelerDataFrame_content), 0, sPerEnc_TravelerDataFrame_content, sPerDec_TravelerDataFrame_content, sOerEnc_TravelerDataFrame_content, sOerDec_TravelerDataFrame_content, sBerEnc_TravelerDataFrame_content, sBerDec_TravelerDataFrame_content, sPrint_TravelerDataFrame_content, 0, 19, 3201710, 6, 400403 },
+	{ "TravelerDataFrame_msgId", sizeof(TravelerDataFrame_msgId), 0, sPerEnc_TravelerDataFrame_msgId, sPerDec_TravelerDataFrame_msgId, sOerEnc_TravelerDataFrame_msgId, sOerDec_TravelerDataFrame_msgId, sBerEnc_TravelerDataFrame_msgId, sBerDec_TravelerDataFrame_msgId, sPrint_TravelerDataFrame_msgId, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 17, 0, 3, 0 },
+	{ "TravelerDataFrame_regions", sizeof(TravelerDataFrame_regions), 0, sPerEnc_TravelerDataFrame_regions, sPerDec_TravelerDataFrame_regions, sOerEnc_TravelerDataFrame_regions, sOerDec_TravelerDataFrame_regions, sBerEnc_TravelerDataFrame_regions, sBerDec_TravelerDataFrame_regions, sPrint_TravelerDataFrame_regions, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 14, 0, 4, 0 },
+	{ "TravelerInfoType", sizeof(TravelerInfoType), 0, sPerEnc_TravelerInfoType, sPerDec_TravelerInfoType, sOerEnc_TravelerInfoType, sOerDec_TravelerInfoType, sBerEnc_TravelerInfoType, sBerDec_TravelerInfoType, sPrint_TravelerInfoType, ASN_SIZE_EXT, 3, 3, 1, 1 },
+	{ "TravelerInformation", sizeof(TravelerInformation), sTest_TravelerInformation, sPerEnc_TravelerInformation, sPerDec_TravelerInformation, sOerEnc_TravelerInformation, sOerDec_TravelerInformation, sBerEnc_TravelerInformation, sBerDec_TravelerInformation, sPrint_TravelerInformation, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 129, 0, 30, 0 },
+	{ "TravelerInformation_regional", sizeof(TravelerInformation_regional), 0, sPerEnc_TravelerInformation_regional, sPerDec_TravelerInformation_regional, sOerEnc_TravelerInformation_regional, sOerDec_TravelerInformation_regional, sBerEnc_TravelerInformation_regional, sBerDec_TravelerInformation_regional, sPrint_TravelerInformation_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "URL_Base", sizeof(URL_Base), 0, sPerEnc_URL_Base, sPerDec_URL_Base, sOerEnc_URL_Base, sOerDec_URL_Base, sBerEnc_URL_Base, sBerDec_URL_Base, sPrint_URL_Base, 0, 13, 321, 2, 46 },
+	{ "URL_Link", sizeof(URL_Link), sTest_URL_Link, sPerEnc_URL_Link, sPerDec_URL_Link, sOerEnc_URL_Link, sOerDec_URL_Link, sBerEnc_URL_Link, sBerDec_URL_Link, sPrint_URL_Link, 0, 15, 1793, 2, 257 },
+	{ "URL_Short", sizeof(URL_Short), 0, sPerEnc_URL_Short, sPerDec_URL_Short, sOerEnc_URL_Short, sOerDec_URL_Short, sBerEnc_URL_Short, sBerDec_URL_Short, sPrint_URL_Short, 0, 11, 109, 2, 16 },
+	{ "UniqueMSGID", sizeof(UniqueMSGID), 0, sPerEnc_UniqueMSGID, sPerDec_UniqueMSGID, sOerEnc_UniqueMSGID, sOerDec_UniqueMSGID, sBerEnc_UniqueMSGID, sBerDec_UniqueMSGID, sPrint_UniqueMSGID, 0, 72, 72, 9, 9 },
+	{ "UserSizeAndBehaviour", sizeof(UserSizeAndBehaviour), 0, sPerEnc_UserSizeAndBehaviour, sPerDec_UserSizeAndBehaviour, sOerEnc_UserSizeAndBehaviour, sOerDec_UserSizeAndBehaviour, sBerEnc_UserSizeAndBehaviour, sBerDec_UserSizeAndBehaviour, sPrint_UserSizeAndBehaviour, ASN_SIZE_EXT, 6, 6, 3, 3 },
+	{ "VINstring", sizeof(VINstring), 0, sPerEnc_VINstring, sPerDec_VINstring, sOerEnc_VINstring, sOerDec_VINstring, sBerEnc_VINstring, sBerDec_VINstring, sPrint_VINstring, 0, 13, 141, 2, 18 },
+	{ "ValidRegion", sizeof(ValidRegion), 0, sPerEnc_ValidRegion, sPerDec_ValidRegion, sOerEnc_ValidRegion, sOerDec_ValidRegion, sBerEnc_ValidRegion, sBerDec_ValidRegion, sPrint_ValidRegion, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 61, 0, 12, 0 },
+	{ "ValidRegion_area", sizeof(ValidRegion_area), 0, sPerEnc_ValidRegion_area, sPerDec_ValidRegion_area, sOerEnc_ValidRegion_area, sOerDec_ValidRegion_area, sBerEnc_ValidRegion_area, sBerDec_ValidRegion_area, sPrint_ValidRegion_area, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 44, 0, 9, 0 },
+	{ "VehicleClassification", sizeof(VehicleClassification), 0, sPerEnc_VehicleClassification, sPerDec_VehicleClassification, sOerEnc_VehicleClassification, sOerDec_VehicleClassification, sBerEnc_VehicleClassification, sBerDec_VehicleClassification, sPrint_VehicleClassification, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 10, 0, 2, 0 },
+	{ "VehicleClassification_regional", sizeof(VehicleClassification_regional), 0, sPerEnc_VehicleClassification_regional, sPerDec_VehicleClassification_regional, sOerEnc_VehicleClassification_regional, sOerDec_VehicleClassification_regional, sBerEnc_VehicleClassification_regional, sBerDec_VehicleClassification_regional, sPrint_VehicleClassification_regional, ASN_SIZE_UNBOUNDED, 26, 0, 4, 0 },
+	{ "VehicleData", sizeof(VehicleData), 0, sPerEnc_VehicleData, sPerDec_VehicleData, sOerEnc_VehicleData, sOerDec_VehicleData, sBerEnc_VehicleData, sBerDec_VehicleData, sPrint_VehicleData, ASN_SIZE_EXT, 5, 50, 1, 7 },
+	{ "VehicleEventFlags", sizeof(VehicleEventFlags), 0, sPerEnc_VehicleEventFlags, sPerDec_VehicleEventFlags, sOerEnc_VehicleEventFlags, sOerDec_VehicleEventFlags, sBerEnc_VehicleEventFlags, sBerDec_VehicleEventFlags, sPrint_VehicleEventFlags, ASN_SIZE_EXT, 14, 14, 4, 4 },
+	{ "VehicleGroupAffected", sizeof(VehicleGroupAffected), 0, sPerEnc_VehicleGroupAffected, sPerDec_VehicleGroupAffected, sOerEnc_VehicleGroupAffected, sOerDec_VehicleGroupAffected, sBerEnc_VehicleGroupAffected, sBerDec_VehicleGroupAffected, sPrint_VehicleGroupAffected, ASN_SIZE_EXT, 7, 7, 3, 3 },
+	{ "VehicleHeight", sizeof(VehicleHeight), 0, sPerEnc_VehicleHeight, sPerDec_VehicleHeight, sOerEnc_VehicleHeight, sOerDec_VehicleHeight, sBerEnc_VehicleHeight, sBerDec_VehicleHeight, sPrint_VehicleHeight, 0, 7, 7, 1, 1 },
+	{ "VehicleID", sizeof(VehicleID), 0, sPerEnc_VehicleID, sPerDec_VehicleID, sOerEnc_VehicleID, sOerDec_VehicleID, sBerEnc_VehicleID, sBerDec_VehicleID, sPrint_VehicleID, 0, 33, 33, 5, 5 },
+	{ "VehicleIdent", sizeof(VehicleIdent), 0, sPerEnc_VehicleIdent, sPerDec_VehicleIdent, sOerEnc_VehicleIdent, sOerDec_VehicleIdent, sBerEnc_VehicleIdent, sBerDec_VehicleIdent, sPrint_VehicleIdent, ASN_SIZE_EXT, 7, 872, 1, 126 },
+	{ "VehicleIdent_vehicleClass", sizeof(VehicleIdent_vehicleClass), 0, sPerEnc_VehicleIdent_vehicleClass, sPerDec_VehicleIdent_vehicleClass, sOerEnc_VehicleIdent_vehicleClass, sOerDec_VehicleIdent_vehicleClass, sBerEnc_VehicleIdent_vehicleClass, sBerDec_VehicleIdent_vehicleClass, sPrint_VehicleIdent_vehicleClass, ASN_SIZE_EXT, 7, 10, 4, 4 },
+	{ "VehicleLength", sizeof(VehicleLength), 0, sPerEnc_VehicleLength, sPerDec_VehicleLength, sOerEnc_VehicleLength, sOerDec_VehicleLength, sBerEnc_VehicleLength, sBerDec_VehicleLength, sPrint_VehicleLength, 0, 12, 12, 2, 2 },
+	{ "VehicleMass", sizeof(VehicleMass), 0, sPerEnc_VehicleMass, sPerDec_VehicleMass, sOerEnc_VehicleMass, sOerDec_VehicleMass, sBerEnc_VehicleMass, sBerDec_VehicleMass, sPrint_VehicleMass, 0, 8, 8, 1, 1 },
+	{ "VehicleSafetyExtensions", sizeof(VehicleSafetyExtensions), 0, sPerEnc_VehicleSafetyExtensions, sPerDec_VehicleSafetyExtensions, sOerEnc_VehicleSafetyExtensions, sOerDec_VehicleSafetyExtensions, sBerEnc_VehicleSafetyExtensions, sBerDec_VehicleSafetyExtensions, sPrint_VehicleSafetyExtensions, ASN_SIZE_EXT, 5, 3092, 1, 517 },
+	{ "VehicleSize", sizeof(VehicleSize), 0, sPerEnc_VehicleSize, sPerDec_VehicleSize, sOerEnc_VehicleSize, sOerDec_VehicleSize, sBerEnc_VehicleSize, sBerDec_VehicleSize, sPrint_VehicleSize, 0, 22, 22, 4, 4 },
+	{ "VehicleStatus", sizeof(VehicleStatus), 0, sPerEnc_VehicleStatus, sPerDec_VehicleStatus, sOerEnc_VehicleStatus, sOerDec_VehicleStatus, sBerEnc_VehicleStatus, sBerDec_VehicleStatus, sPrint_VehicleStatus, ASN_SIZE_EXT, 23, 3126, 3, 532 },
+	{ "VehicleStatusDeviceTypeTag", sizeof(VehicleStatusDeviceTypeTag), 0, sPerEnc_VehicleStatusDeviceTypeTag, sPerDec_VehicleStatusDeviceTypeTag, sOerEnc_VehicleStatusDeviceTypeTag, sOerDec_VehicleStatusDeviceTypeTag, sBerEnc_VehicleStatusDeviceTypeTag, sBerDec_VehicleStatusDeviceTypeTag, sPrint_VehicleStatusDeviceTypeTag, ASN_SIZE_EXT, 6, 6, 1, 1 },
+	{ "VehicleStatusRequest", sizeof(VehicleStatusRequest), 0, sPerEnc_VehicleStatusRequest, sPerDec_VehicleStatusRequest, sOerEnc_VehicleStatusRequest, sOerDec_VehicleStatusRequest, sBerEnc_VehicleStatusRequest, sBerDec_VehicleStatusRequest, sPrint_VehicleStatusRequest, ASN_SIZE_EXT, 11, 48, 2, 8 },
+	{ "VehicleStatusRequestList", sizeof(VehicleStatusRequestList), 0, sPerEnc_VehicleStatusRequestList, sPerDec_VehicleStatusRequestList, sOerEnc_VehicleStatusRequestList, sOerDec_VehicleStatusRequestList, sBerEnc_VehicleStatusRequestList, sBerDec_VehicleStatusRequestList, sPrint_VehicleStatusRequestList, ASN_SIZE_EXT, 16, 1541, 4, 258 },
+	{ "VehicleStatus_accelSets", sizeof(VehicleStatus_accelSets), 0, sPerEnc_VehicleStatus_accelSets, sPerDec_VehicleStatus_accelSets, sOerEnc_VehicleStatus_accelSets, sOerDec_VehicleStatus_accelSets, sBerEnc_VehicleStatus_accelSets, sBerDec_VehicleStatus_accelSets, sPrint_VehicleStatus_accelSets, ASN_SIZE_EXT, 5, 109, 1, 24 },
+	{ "VehicleStatus_object", sizeof(VehicleStatus_object), 0, sPerEnc_VehicleStatus_object, sPerDec_VehicleStatus_object, sOerEnc_VehicleStatus_object, sOerDec_VehicleStatus_object, sBerEnc_VehicleStatus_object, sBerDec_VehicleStatus_object, sPrint_VehicleStatus_object, 0, 37, 96, 5, 15 },
+	{ "VehicleStatus_steering", sizeof(VehicleStatus_steering), 0, sPerEnc_VehicleStatus_steering, sPerDec_VehicleStatus_steering, sOerEnc_VehicleStatus_steering, sOerDec_VehicleStatus_steering, sBerEnc_VehicleStatus_steering, sBerDec_VehicleStatus_steering, sPrint_VehicleStatus_steering, 0, 11, 29, 2, 5 },
+	{ "VehicleStatus_vehicleData", sizeof(VehicleStatus_vehicleData), 0, sPerEnc_VehicleStatus_vehicleData, sPerDec_VehicleStatus_vehicleData, sOerEnc_VehicleStatus_vehicleData, sOerDec_VehicleStatus_vehicleData, sBerEnc_VehicleStatus_vehicleData, sBerDec_VehicleStatus_vehicleData, sPrint_VehicleStatus_vehicleData, ASN_SIZE_EXT, 50, 50, 7, 7 },
+	{ "VehicleStatus_weatherReport", sizeof(VehicleStatus_weatherReport), 0, sPerEnc_VehicleStatus_weatherReport, sPerDec_VehicleStatus_weatherReport, sOerEnc_VehicleStatus_weatherReport, sOerDec_VehicleStatus_weatherReport, sBerEnc_VehicleStatus_weatherReport, sBerDec_VehicleStatus_weatherReport, sPrint_VehicleStatus_weatherReport, 0, 6, 49, 2, 8 },
+	{ "VehicleToLanePosition", sizeof(VehicleToLanePosition), 0, sPerEnc_VehicleToLanePosition, sPerDec_VehicleToLanePosition, sOerEnc_VehicleToLanePosition, sOerDec_VehicleToLanePosition, sBerEnc_VehicleToLanePosition, sBerDec_VehicleToLanePosition, sPrint_VehicleToLanePosition, ASN_SIZE_EXT, 41, 41, 6, 6 },
+	{ "VehicleToLanePositionList", sizeof(VehicleToLanePositionList), 0, sPerEnc_VehicleToLanePositionList, sPerDec_VehicleToLanePositionList, sOerEnc_VehicleToLanePositionList, sOerDec_VehicleToLanePositionList, sBerEnc_VehicleToLanePositionList, sBerDec_VehicleToLanePositionList, sPrint_VehicleToLanePositionList, ASN_SIZE_EXT, 44, 208, 8, 32 },
+	{ "VehicleType", sizeof(VehicleType), 0, sPerEnc_VehicleType, sPerDec_VehicleType, sOerEnc_VehicleType, sOerDec_VehicleType, sBerEnc_VehicleType, sBerDec_VehicleType, sPrint_VehicleType, ASN_SIZE_EXT, 5, 5, 1, 1 },
+	{ "VehicleWidth", sizeof(VehicleWidth), 0, sPerEnc_VehicleWidth, sPerDec_VehicleWidth, sOerEnc_VehicleWidth, sOerDec_VehicleWidth, sBerEnc_VehicleWidth, sBerDec_VehicleWidth, sPrint_VehicleWidth, 0, 10, 10, 2, 2 },
+	{ "Velocity", sizeof(Velocity), 0, sPerEnc_Velocity, sPerDec_Velocity, sOerEnc_Velocity, sOerDec_Velocity, sBerEnc_Velocity, sBerDec_Velocity, sPrint_Velocity, 0, 13, 13, 2, 2 },
+	{ "VertOffset_B07", sizeof(VertOffset_B07), 0, sPerEnc_VertOffset_B07, sPerDec_VertOffset_B07, sOerEnc_VertOffset_B07, sOerDec_VertOffset_B07, sBerEnc_VertOffset_B07, sBerDec_VertOffset_B07, sPrint_VertOffset_B07, 0, 7, 7, 1, 1 },
+	{ "VertOffset_B08", sizeof(VertOffset_B08), 0, sPerEnc_VertOffset_B08, sPerDec_VertOffset_B08, sOerEnc_VertOffset_B08, sOerDec_VertOffset_B08, sBerEnc_VertOffset_B08, sBerDec_VertOffset_B08, sPrint_VertOffset_B08, 0, 8, 8, 1, 1 },
+	{ "VertOffset_B09", sizeof(VertOffset_B09), 0, sPerEnc_VertOffset_B09, sPerDec_VertOffset_B09, sOerEnc_VertOffset_B09, sOerDec_VertOffset_B09, sBerEnc_VertOffset_B09, sBerDec_VertOffset_B09, sPrint_VertOffset_B09, 0, 9, 9, 2, 2 },
+	{ "VertOffset_B10", sizeof(VertOffset_B10), 0, sPerEnc_VertOffset_B10, sPerDec_VertOffset_B10, sOerEnc_VertOffset_B10, sOerDec_VertOffset_B10, sBerEnc_VertOffset_B10, sBerDec_VertOffset_B10, sPrint_VertOffset_B10, 0, 10, 10, 2, 2 },
+	{ "VertOffset_B11", sizeof(VertOffset_B11), 0, sPerEnc_VertOffset_B11, sPerDec_VertOffset_B11, sOerEnc_VertOffset_B11, sOerDec_VertOffset_B11, sBerEnc_VertOffset_B11, sBerDec_VertOffset_B11, sPrint_VertOffset_B11, 0, 11, 11, 2, 2 },
+	{ "VertOffset_B12", sizeof(VertOffset_B12), 0, sPerEnc_VertOffset_B12, sPerDec_VertOffset_B12, sOerEnc_VertOffset_B12, sOerDec_VertOffset_B12, sBerEnc_VertOffset_B12, sBerDec_VertOffset_B12, sPrint_VertOffset_B12, 0, 12, 12, 2, 2 },
+	{ "VerticalAcceleration", sizeof(VerticalAcceleration), 0, sPerEnc_VerticalAcceleration, sPerDec_VerticalAcceleration, sOerEnc_VerticalAcceleration, sOerDec_VerticalAcceleration, sBerEnc_VerticalAcceleration, sBerDec_VerticalAcceleration, sPrint_VerticalAcceleration, 0, 8, 8, 1, 1 },
+	{ "VerticalAccelerationThreshold", sizeof(VerticalAccelerationThreshold), 0, sPerEnc_VerticalAccelerationThreshold, sPerDec_VerticalAccelerationThreshold, sOerEnc_VerticalAccelerationThreshold, sOerDec_VerticalAccelerationThreshold, sBerEnc_VerticalAccelerationThreshold, sBerDec_VerticalAccelerationThreshold, sPrint_VerticalAccelerationThreshold, 0, 5, 5, 1, 1 },
+	{ "VerticalOffset", sizeof(VerticalOffset), sTest_VerticalOffset, sPerEnc_VerticalOffset, sPerDec_VerticalOffset, sOerEnc_VerticalOffset, sOerDec_VerticalOffset, sBerEnc_VerticalOffset, sBerDec_VerticalOffset, sPrint_VerticalOffset, ASN_SIZE_UNBOUNDED, 10, 0, 2, 0 },
+	{ "WaitOnStopline", sizeof(WaitOnStopline), 0, sPerEnc_WaitOnStopline, sPerDec_WaitOnStopline, sOerEnc_WaitOnStopline, sOerDec_WaitOnStopline, sBerEnc_WaitOnStopline, sBerDec_WaitOnStopline, sPrint_WaitOnStopline, 0, 1, 1, 1, 1 },
+	{ "WeatherProbe", sizeof(WeatherProbe), 0, sPerEnc_WeatherProbe, sPerDec_WeatherProbe, sOerEnc_WeatherProbe, sOerDec_WeatherProbe, sBerEnc_WeatherProbe, sBerDec_WeatherProbe, sPrint_WeatherProbe, ASN_SIZE_EXT, 4, 44, 1, 8 },
+	{ "WeatherReport", sizeof(WeatherReport), 0, sPerEnc_WeatherReport, sPerDec_WeatherReport, sOerEnc_WeatherReport, sOerDec_WeatherReport, sBerEnc_WeatherReport, sBerDec_WeatherReport, sPrint_WeatherReport, ASN_SIZE_EXT, 8, 57, 2, 9 },
+	{ "WheelEndElectFault", sizeof(WheelEndElectFault), 0, sPerEnc_WheelEndElectFault, sPerDec_WheelEndElectFault, sOerEnc_WheelEndElectFault, sOerDec_WheelEndElectFault, sBerEnc_WheelEndElectFault, sBerDec_WheelEndElectFault, sPrint_WheelEndElectFault, 0, 2, 2, 1, 1 },
+	{ "WheelSensorStatus", sizeof(WheelSensorStatus), 0, sPerEnc_WheelSensorStatus, sPerDec_WheelSensorStatus, sOerEnc_WheelSensorStatus, sOerDec_WheelSensorStatus, sBerEnc_WheelSensorStatus, sBerDec_WheelSensorStatus, sPrint_WheelSensorStatus, 0, 2, 2, 1, 1 },
+	{ "WiperRate", sizeof(WiperRate), 0, sPerEnc_WiperRate, sPerDec_WiperRate, sOerEnc_WiperRate, sOerDec_WiperRate, sBerEnc_WiperRate, sBerDec_WiperRate, sPrint_WiperRate, 0, 7, 7, 1, 1 },
+	{ "WiperSet", sizeof(WiperSet), 0, sPerEnc_WiperSet, sPerDec_WiperSet, sOerEnc_WiperSet, sOerDec_WiperSet, sBerEnc_WiperSet, sBerDec_WiperSet, sPrint_WiperSet, ASN_SIZE_EXT, 13, 24, 3, 5 },
+	{ "WiperStatus", sizeof(WiperStatus), 0, sPerEnc_WiperStatus, sPerDec_WiperStatus, sOerEnc_WiperStatus, sOerDec_WiperStatus, sBerEnc_WiperStatus, sBerDec_WiperStatus, sPrint_WiperStatus, ASN_SIZE_EXT, 4, 4, 1, 1 },
+	{ "WorkZone", sizeof(WorkZone), 0, sPerEnc_WorkZone, sPerDec_WorkZone, sOerEnc_WorkZone, sOerDec_WorkZone, sBerEnc_WorkZone, sBerDec_WorkZone, sPrint_WorkZone, 0, 16, 1876, 5, 290 },
+	{ "WorkZone_element", sizeof(WorkZone_element), 0, sPerEnc_WorkZone_element, sPerDec_WorkZone_element, sOerEnc_WorkZone_element, sOerDec_WorkZone_element, sBerEnc_WorkZone_element, sBerDec_WorkZone_element, sPrint_WorkZone_element, 0, 12, 117, 3, 18 },
+	{ "WorkZone_element_item", sizeof(WorkZone_element_item), 0, sPerEnc_WorkZone_element_item, sPerDec_WorkZone_element_item, sOerEnc_WorkZone_element_item, sOerDec_WorkZone_element_item, sBerEnc_WorkZone_element_item, sBerDec_WorkZone_element_item, sPrint_WorkZone_element_item, 0, 12, 117, 3, 18 },
+	{ "YawRate", sizeof(YawRate), 0, sPerEnc_YawRate, sPerDec_YawRate, sOerEnc_YawRate, sOerDec_YawRate, sBerEnc_YawRate, sBerDec_YawRate, sPrint_YawRate, 0, 16, 16, 2, 2 },
+	{ "YawRateConfidence", sizeof(YawRateConfidence), 0, sPerEnc_YawRateConfidence, sPerDec_YawRateConfidence, sOerEnc_YawRateConfidence, sOerDec_YawRateConfidence, sBerEnc_YawRateConfidence, sBerDec_YawRateConfidence, sPrint_YawRateConfidence, 0, 3, 3, 1, 1 },
+	{ "Year", sizeof(Year), 0, sPerEnc_Year, sPerDec_Year, sOerEnc_Year, sOerDec_Year, sBerEnc_Year, sBerDec_Year, sPrint_Year, 0, 16, 16, 2, 2 },
+	{ "ZoneLength", sizeof(ZoneLength), 0, sPerEnc_ZoneLength, sPerDec_ZoneLength, sOerEnc_ZoneLength, sOerDec_ZoneLength, sBerEnc_ZoneLength, sBerDec_ZoneLength, sPrint_ZoneLength, 0, 14, 14, 2, 2 },
+	{ "Zoom", sizeof(Zoom), 0, sPerEnc_Zoom, sPerDec_Zoom, sOerEnc_Zoom, sOerDec_Zoom, sBerEnc_Zoom, sBerDec_Zoom, sPrint_Zoom, 0, 4, 4, 1, 1 },
+	{ "_SeqOfPublicationData", sizeof(_SeqOfPublicationData), 0, sPerEnc__SeqOfPublicationData, sPerDec__SeqOfPublicationData, sOerEnc__SeqOfPublicationData, sOerDec__SeqOfPublicationData, sBerEnc__SeqOfPublicationData, sBerDec__SeqOfPublicationData, sPrint__SeqOfPublicationData, ASN_SIZE_EXT | ASN_SIZE_UNBOUNDED, 8, 0, 2, 0 },
+};
+
+const unsigned int asn_type_cnt = 607;
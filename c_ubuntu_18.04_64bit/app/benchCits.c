@@ -0,0 +1,819 @@
+#include <DSRC.h>
+#include <AddGrpD.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "haeCommon.h"
+#include "citsAddGrpD.h"
+#include "pvdStream.h"
+
+#define BENCH_ITERCNT			200000L
+#define BENCH_SNAPSHOT_CNT		3			/* snapshots in the PVD sample */
+
+/* PvdStream handlers walk the two pass result alongside */
+typedef struct{
+	const ProbeVehicleData *pPvd;
+	const PVD_addGrpD *pAddGrpD;
+	OSRTDListNode *pSnapshot;
+	OSRTDListNode *pCits;
+	unsigned int snapshotCnt;
+	unsigned int citsCnt;
+	int ret;
+} STREAM_CHECK;
+
+static unsigned char rsa_data[BUFF_SIZE];
+static unsigned int rsa_len;
+static unsigned char pvd_data[BUFF_SIZE];
+static unsigned int pvd_len;
+
+static int sBench_Rsa(long iterCnt);
+static int sBench_Pvd(long iterCnt);
+static int sCheck_Rsa(const CITS_RSA_MSG *pMsg, const RoadSideAlert *pRsa, const RSA_addGrpD *pAddGrpD);
+static int sCheck_Pvd(const CITS_PVD_MSG *pMsg, const ProbeVehicleData *pPvd, const PVD_addGrpD *pAddGrpD);
+static int sCheck_Stream(PVD_STREAM *pStream, const ProbeVehicleData *pPvd, const PVD_addGrpD *pAddGrpD);
+static int sStream_Snapshot(void *pArg, const PVD_STREAM_HEADER *pHeader, unsigned int idx, const Snapshot *pSnapshot);
+static int sStream_Cits(void *pArg, const PVD_STREAM_HEADER *pHeader, unsigned int idx, const CITSPVD *pCits);
+static int sStream_Count(void *pArg, const PVD_STREAM_HEADER *pHeader, unsigned int idx, const CITSPVD *pCits);
+static int sCheck_Bytes(const char *pName, OSCTXT *pA, int statA, OSCTXT *pB, int statB);
+static RegionalExtension *sFind_AddGrpD(OSRTDList *pList);
+static int sBuildSample(void);
+static double sNow(void);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: RoadSideAlert + CITSRSA and ProbeVehicleData + CITSPVD
+ *				  decode benchmark.
+ *				  Compares the generic two pass decode
+ *				  (asn1PD_RoadSideAlert / asn1PD_ProbeVehicleData, then
+ *				  asn1PD_RSA_addGrpD / asn1PD_PVD_addGrpD on the regional
+ *				  open type) with CitsRsa_Decode / CitsPvd_Decode, and
+ *				  for PVD with the per element callbacks of PvdStream.
+ *				  Before timing, the typed slots of the single pass and
+ *				  every streamed element are checked against the two
+ *				  pass result.
+ *
+ * Parameter	: argv[1] - iterations per message and way
+ *
+ * Returns		: 0, 1 when a decode fails or the two ways differ
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	long iterCnt = BENCH_ITERCNT;
+
+	if (argc > 1)
+	{
+		iterCnt = atol(argv[1]);
+	}
+
+	if (HAE_OK != sBuildSample())
+	{
+		return 1;
+	}
+
+	if (HAE_OK != sBench_Rsa(iterCnt))
+	{
+		return 1;
+	}
+
+	if (HAE_OK != sBench_Pvd(iterCnt))
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+static int sBench_Rsa(long iterCnt)
+{
+	long i;
+	int ret = HAE_OK;
+	double t0, t1;
+	OSUINT16 limitspeed = 0;
+	OSCTXT ctxt, extCtxt, msgCtxt;
+	RoadSideAlert rsa;
+	RSA_addGrpD addGrpD;
+	CITS_RSA_MSG msg;
+	RegionalExtension *pExt;
+
+	rtInitContext(&ctxt);
+	rtInitContext(&extCtxt);
+	rtInitContext(&msgCtxt);
+
+	/* both ways once, then the typed slots against the generic decode */
+	pu_setBuffer(&ctxt, rsa_data, rsa_len, FALSE);
+	memset(&rsa, 0, sizeof(rsa));
+	memset(&addGrpD, 0, sizeof(addGrpD));
+	pExt = HAE_NULL;
+	if (0 == asn1PD_RoadSideAlert(&ctxt, &rsa))
+	{
+		pExt = sFind_AddGrpD(&rsa.regional);
+	}
+	if (HAE_NULL != pExt)
+	{
+		pu_setBuffer(&extCtxt, (OSOCTET *)pExt->regExtValue.data, pExt->regExtValue.numocts, FALSE);
+		if (0 != asn1PD_RSA_addGrpD(&extCtxt, &addGrpD))
+		{
+			pExt = HAE_NULL;
+		}
+	}
+	pu_setBuffer(&msgCtxt, rsa_data, rsa_len, FALSE);
+	if ((HAE_NULL == pExt) || (0 != CitsRsa_Decode(&msgCtxt, &msg)))
+	{
+		rtxErrPrint(&ctxt);
+		rtxErrPrint(&extCtxt);
+		rtxErrPrint(&msgCtxt);
+		printf("[BENCH] ERROR : decode of RSA sample failed\n");
+		ret = HAE_ERROR;
+	}
+	else
+	{
+		ret = sCheck_Rsa(&msg, &rsa, &addGrpD);
+	}
+	rtxMemReset(&msgCtxt);
+	rtxMemReset(&extCtxt);
+	rtxMemReset(&ctxt);
+
+	if (HAE_OK == ret)
+	{
+		/* two pass: open type DList, then decode of the extension */
+		t0 = sNow();
+		for (i = 0; i < iterCnt; i++)
+		{
+			pu_setBuffer(&ctxt, rsa_data, rsa_len, FALSE);
+			memset(&rsa, 0, sizeof(rsa));
+			asn1PD_RoadSideAlert(&ctxt, &rsa);
+			pExt = sFind_AddGrpD(&rsa.regional);
+			if (HAE_NULL != pExt)
+			{
+				pu_setBuffer(&extCtxt, (OSOCTET *)pExt->regExtValue.data, pExt->regExtValue.numocts, FALSE);
+				memset(&addGrpD, 0, sizeof(addGrpD));
+				asn1PD_RSA_addGrpD(&extCtxt, &addGrpD);
+				limitspeed += addGrpD.cits.limitspeed;
+				rtxMemReset(&extCtxt);
+			}
+			rtxMemReset(&ctxt);
+		}
+		t1 = sNow();
+		printf("RSA+CITSRSA two pass   : %8.1f ns/op\n", (t1 - t0) * 1e9 / iterCnt);
+
+		/* single pass into typed slots */
+		t0 = sNow();
+		for (i = 0; i < iterCnt; i++)
+		{
+			pu_setBuffer(&ctxt, rsa_data, rsa_len, FALSE);
+			CitsRsa_Decode(&ctxt, &msg);
+			CitsRsa_GetLimitSpeed(&msg, &limitspeed);
+			rtxMemReset(&ctxt);
+		}
+		t1 = sNow();
+		printf("RSA+CITSRSA CitsRsa    : %8.1f ns/op\n", (t1 - t0) * 1e9 / iterCnt);
+		printf("limitspeed %u, %u bytes\n", limitspeed, rsa_len);
+	}
+
+	rtFreeContext(&msgCtxt);
+	rtFreeContext(&extCtxt);
+	rtFreeContext(&ctxt);
+
+	return ret;
+}
+
+static int sBench_Pvd(long iterCnt)
+{
+	long i;
+	int ret = HAE_OK;
+	double t0, t1;
+	unsigned int citsCnt = 0;
+	OSCTXT ctxt, extCtxt, msgCtxt;
+	ProbeVehicleData pvd;
+	PVD_addGrpD addGrpD;
+	static CITS_PVD_MSG msg;
+	static PVD_STREAM stream;
+	RegionalExtension *pExt;
+
+	rtInitContext(&ctxt);
+	rtInitContext(&extCtxt);
+	rtInitContext(&msgCtxt);
+	if (HAE_OK != PvdStream_Init(&stream, sStream_Snapshot, sStream_Cits, HAE_NULL))
+	{
+		return HAE_ERROR;
+	}
+
+	pu_setBuffer(&ctxt, pvd_data, pvd_len, FALSE);
+	memset(&pvd, 0, sizeof(pvd));
+	memset(&addGrpD, 0, sizeof(addGrpD));
+	pExt = HAE_NULL;
+	if (0 == asn1PD_ProbeVehicleData(&ctxt, &pvd))
+	{
+		pExt = sFind_AddGrpD(&pvd.regional);
+	}
+	if (HAE_NULL != pExt)
+	{
+		pu_setBuffer(&extCtxt, (OSOCTET *)pExt->regExtValue.data, pExt->regExtValue.numocts, FALSE);
+		if (0 != asn1PD_PVD_addGrpD(&extCtxt, &addGrpD))
+		{
+			pExt = HAE_NULL;
+		}
+	}
+	pu_setBuffer(&msgCtxt, pvd_data, pvd_len, FALSE);
+	if ((HAE_NULL == pExt) || (0 != CitsPvd_Decode(&msgCtxt, &msg)))
+	{
+		rtxErrPrint(&ctxt);
+		rtxErrPrint(&extCtxt);
+		rtxErrPrint(&msgCtxt);
+		printf("[BENCH] ERROR : decode of PVD sample failed\n");
+		ret = HAE_ERROR;
+	}
+	else
+	{
+		ret = sCheck_Pvd(&msg, &pvd, &addGrpD);
+		if (HAE_OK != sCheck_Stream(&stream, &pvd, &addGrpD))
+		{
+			ret = HAE_ERROR;
+		}
+	}
+	rtxMemReset(&msgCtxt);
+	rtxMemReset(&extCtxt);
+	rtxMemReset(&ctxt);
+
+	if (HAE_OK == ret)
+	{
+		t0 = sNow();
+		for (i = 0; i < iterCnt; i++)
+		{
+			pu_setBuffer(&ctxt, pvd_data, pvd_len, FALSE);
+			memset(&pvd, 0, sizeof(pvd));
+			asn1PD_ProbeVehicleData(&ctxt, &pvd);
+			pExt = sFind_AddGrpD(&pvd.regional);
+			if (HAE_NULL != pExt)
+			{
+				pu_setBuffer(&extCtxt, (OSOCTET *)pExt->regExtValue.data, pExt->regExtValue.numocts, FALSE);
+				memset(&addGrpD, 0, sizeof(addGrpD));
+				asn1PD_PVD_addGrpD(&extCtxt, &addGrpD);
+				citsCnt += (unsigned int)addGrpD.cits.count;
+				rtxMemReset(&extCtxt);
+			}
+			rtxMemReset(&ctxt);
+		}
+		t1 = sNow();
+		printf("PVD+CITSPVD two pass   : %8.1f ns/op\n", (t1 - t0) * 1e9 / iterCnt);
+
+		t0 = sNow();
+		for (i = 0; i < iterCnt; i++)
+		{
+			pu_setBuffer(&ctxt, pvd_data, pvd_len, FALSE);
+			CitsPvd_Decode(&ctxt, &msg);
+			citsCnt += msg.citsCnt;
+			rtxMemReset(&ctxt);
+		}
+		t1 = sNow();
+		printf("PVD+CITSPVD CitsPvd    : %8.1f ns/op\n", (t1 - t0) * 1e9 / iterCnt);
+
+		/* streaming, one element in memory at a time */
+		stream.pfSnapshot = HAE_NULL;
+		stream.pfCits = sStream_Count;
+		stream.pArg = &citsCnt;
+		t0 = sNow();
+		for (i = 0; i < iterCnt; i++)
+		{
+			PvdStream_Decode(&stream, pvd_data, pvd_len);
+		}
+		t1 = sNow();
+		printf("PVD+CITSPVD PvdStream  : %8.1f ns/op\n", (t1 - t0) * 1e9 / iterCnt);
+		printf("cits %u, %u bytes\n", citsCnt, pvd_len);
+	}
+
+	PvdStream_Free(&stream);
+	rtFreeContext(&msgCtxt);
+	rtFreeContext(&extCtxt);
+	rtFreeContext(&ctxt);
+
+	return ret;
+}
+
+/*************************************************************
+ *
+ * Function 		: sCheck_Rsa
+ *
+ * Description	: Compare the CitsRsa_Decode result with the two pass
+ *				  decode of the same RoadSideAlert
+ *
+ * Parameter	: pMsg - CitsRsa_Decode result
+ *				  pRsa - asn1PD_RoadSideAlert result
+ *				  pAddGrpD - asn1PD_RSA_addGrpD of its addGrpD regional
+ *
+ * Returns		: HAE_OK, HAE_ERROR when anything differs
+ *
+ * Notes		: Every CITSRSA field goes through its accessor. The
+ *				  root and the whole CITSRSA are then compared by their
+ *				  UPER encodings, the root without the regional list.
+ *
+ *************************************************************/
+static int sCheck_Rsa(const CITS_RSA_MSG *pMsg, const RoadSideAlert *pRsa, const RSA_addGrpD *pAddGrpD)
+{
+	int ret = HAE_OK;
+	int statA, statB;
+	OSINT16 s16;
+	OSUINT8 u8;
+	OSUINT16 u16;
+	const CITSRSA_laneset *pLaneSet;
+	const CITSRSA *pCits = &pAddGrpD->cits;
+	OSOCTET bufA[BUFF_SIZE], bufB[BUFF_SIZE];
+	OSCTXT ctxtA, ctxtB;
+	RoadSideAlert rootA, rootB;
+	CITSRSA citsA, citsB;
+
+	if (pMsg->citsPresent != pAddGrpD->m.citsPresent)
+	{
+		printf("[BENCH] ERROR : RSA cits present %u, two pass %u\n", pMsg->citsPresent, pAddGrpD->m.citsPresent);
+		return HAE_ERROR;
+	}
+
+	if ((HAE_OK == CitsRsa_GetTemperature(pMsg, &s16)) != (pCits->m.tempraturePresent != 0)
+		|| (pCits->m.tempraturePresent && (s16 != pCits->temprature)))
+	{
+		printf("[BENCH] ERROR : RSA temprature differs\n");
+		ret = HAE_ERROR;
+	}
+	if ((HAE_OK == CitsRsa_GetHumidity(pMsg, &s16)) != (pCits->m.humidityPresent != 0)
+		|| (pCits->m.humidityPresent && (s16 != pCits->humidity)))
+	{
+		printf("[BENCH] ERROR : RSA humidity differs\n");
+		ret = HAE_ERROR;
+	}
+	if ((HAE_OK == CitsRsa_GetPercent(pMsg, &u8)) != (pCits->m.percentPresent != 0)
+		|| (pCits->m.percentPresent && (u8 != pCits->percent)))
+	{
+		printf("[BENCH] ERROR : RSA percent differs\n");
+		ret = HAE_ERROR;
+	}
+	if ((HAE_OK == CitsRsa_GetLimitSpeed(pMsg, &u16)) != (pCits->m.limitspeedPresent != 0)
+		|| (pCits->m.limitspeedPresent && (u16 != pCits->limitspeed)))
+	{
+		printf("[BENCH] ERROR : RSA limitspeed differs\n");
+		ret = HAE_ERROR;
+	}
+	if ((HAE_OK == CitsRsa_GetLaneWidth(pMsg, &u16)) != (pCits->m.lanewidthPresent != 0)
+		|| (pCits->m.lanewidthPresent && (u16 != pCits->lanewidth)))
+	{
+		printf("[BENCH] ERROR : RSA lanewidth differs\n");
+		ret = HAE_ERROR;
+	}
+	if ((HAE_OK == CitsRsa_GetLaneSet(pMsg, &pLaneSet)) != (pCits->m.lanesetPresent != 0)
+		|| (pCits->m.lanesetPresent && ((pLaneSet->n != pCits->laneset.n)
+			|| memcmp(pLaneSet->elem, pCits->laneset.elem, pLaneSet->n * sizeof(LaneID)))))
+	{
+		printf("[BENCH] ERROR : RSA laneset differs\n");
+		ret = HAE_ERROR;
+	}
+
+	/* the addGrpD node is the only one CitsRsa_Decode drops */
+	if (pMsg->rsa.regional.count + 1 != pRsa->regional.count)
+	{
+		printf("[BENCH] ERROR : RSA regional count %u, two pass %u\n",
+			(unsigned int)pMsg->rsa.regional.count, (unsigned int)pRsa->regional.count);
+		ret = HAE_ERROR;
+	}
+
+	rtInitContext(&ctxtA);
+	rtInitContext(&ctxtB);
+
+	rootA = pMsg->rsa;
+	rootB = *pRsa;
+	rootA.m.regionalPresent = 0;
+	rootB.m.regionalPresent = 0;
+	pu_setBuffer(&ctxtA, bufA, sizeof(bufA), FALSE);
+	pu_setBuffer(&ctxtB, bufB, sizeof(bufB), FALSE);
+	statA = asn1PE_RoadSideAlert(&ctxtA, &rootA);
+	statB = asn1PE_RoadSideAlert(&ctxtB, &rootB);
+	if (HAE_OK != sCheck_Bytes("RSA root", &ctxtA, statA, &ctxtB, statB))
+	{
+		ret = HAE_ERROR;
+	}
+
+	citsA = pMsg->cits;
+	citsB = *pCits;
+	pu_setBuffer(&ctxtA, bufA, sizeof(bufA), FALSE);
+	pu_setBuffer(&ctxtB, bufB, sizeof(bufB), FALSE);
+	statA = asn1PE_CITSRSA(&ctxtA, &citsA);
+	statB = asn1PE_CITSRSA(&ctxtB, &citsB);
+	if (HAE_OK != sCheck_Bytes("CITSRSA", &ctxtA, statA, &ctxtB, statB))
+	{
+		ret = HAE_ERROR;
+	}
+
+	rtFreeContext(&ctxtB);
+	rtFreeContext(&ctxtA);
+
+	return ret;
+}
+
+/*************************************************************
+ *
+ * Function 		: sCheck_Pvd
+ *
+ * Description	: Compare the CitsPvd_Decode result with the two pass
+ *				  decode of the same ProbeVehicleData
+ *
+ * Parameter	: pMsg - CitsPvd_Decode result
+ *				  pPvd - asn1PD_ProbeVehicleData result
+ *				  pAddGrpD - asn1PD_PVD_addGrpD of its addGrpD regional
+ *
+ * Returns		: HAE_OK, HAE_ERROR when anything differs
+ *
+ * Notes		: As sCheck_Rsa, for every entry of the cits list.
+ *
+ *************************************************************/
+static int sCheck_Pvd(const CITS_PVD_MSG *pMsg, const ProbeVehicleData *pPvd, const PVD_addGrpD *pAddGrpD)
+{
+	int ret = HAE_OK;
+	int statA, statB;
+	unsigned int idx, citsCnt;
+	LaneID lane;
+	OSUINT8 u8;
+	const CITSLog *pLog;
+	const CITSPVD *pCits;
+	OSRTDListNode *pnode;
+	OSOCTET bufA[BUFF_SIZE], bufB[BUFF_SIZE];
+	OSCTXT ctxtA, ctxtB;
+	ProbeVehicleData rootA, rootB;
+	CITSPVD citsA, citsB;
+	CITSLog logA, logB;
+
+	citsCnt = pAddGrpD->m.citsPresent ? (unsigned int)pAddGrpD->cits.count : 0;
+	if (pMsg->citsCnt != citsCnt)
+	{
+		printf("[BENCH] ERROR : PVD cits count %u, two pass %u\n", pMsg->citsCnt, citsCnt);
+		return HAE_ERROR;
+	}
+
+	rtInitContext(&ctxtA);
+	rtInitContext(&ctxtB);
+
+	idx = 0;
+	for (pnode = pAddGrpD->cits.head; (pnode != 0) && (idx < citsCnt); pnode = pnode->next, idx++)
+	{
+		pCits = (const CITSPVD *)pnode->data;
+
+		if ((HAE_OK == CitsPvd_GetCurLane(pMsg, idx, &lane)) != (pCits->m.curlanePresent != 0)
+			|| (pCits->m.curlanePresent && (lane != pCits->curlane)))
+		{
+			printf("[BENCH] ERROR : PVD cits[%u] curlane differs\n", idx);
+			ret = HAE_ERROR;
+		}
+		if ((HAE_OK == CitsPvd_GetVehicleCnt(pMsg, idx, &u8)) != (pCits->m.vehiclecntPresent != 0)
+			|| (pCits->m.vehiclecntPresent && (u8 != pCits->vehiclecnt)))
+		{
+			printf("[BENCH] ERROR : PVD cits[%u] vehiclecnt differs\n", idx);
+			ret = HAE_ERROR;
+		}
+		if ((HAE_OK == CitsPvd_GetServiceLog(pMsg, idx, &pLog)) != (pCits->m.servicelogPresent != 0))
+		{
+			printf("[BENCH] ERROR : PVD cits[%u] servicelog presence differs\n", idx);
+			ret = HAE_ERROR;
+		}
+		else if (pCits->m.servicelogPresent)
+		{
+			logA = *pLog;
+			logB = pCits->servicelog;
+			pu_setBuffer(&ctxtA, bufA, sizeof(bufA), FALSE);
+			pu_setBuffer(&ctxtB, bufB, sizeof(bufB), FALSE);
+			statA = asn1PE_CITSLog(&ctxtA, &logA);
+			statB = asn1PE_CITSLog(&ctxtB, &logB);
+			if (HAE_OK != sCheck_Bytes("PVD servicelog", &ctxtA, statA, &ctxtB, statB))
+			{
+				ret = HAE_ERROR;
+			}
+		}
+
+		citsA = pMsg->cits[idx];
+		citsB = *pCits;
+		pu_setBuffer(&ctxtA, bufA, sizeof(bufA), FALSE);
+		pu_setBuffer(&ctxtB, bufB, sizeof(bufB), FALSE);
+		statA = asn1PE_CITSPVD(&ctxtA, &citsA);
+		statB = asn1PE_CITSPVD(&ctxtB, &citsB);
+		if (HAE_OK != sCheck_Bytes("CITSPVD", &ctxtA, statA, &ctxtB, statB))
+		{
+			ret = HAE_ERROR;
+		}
+	}
+
+	if (pMsg->pvd.regional.count + 1 != pPvd->regional.count)
+	{
+		printf("[BENCH] ERROR : PVD regional count %u, two pass %u\n",
+			(unsigned int)pMsg->pvd.regional.count, (unsigned int)pPvd->regional.count);
+		ret = HAE_ERROR;
+	}
+
+	rootA = pMsg->pvd;
+	rootB = *pPvd;
+	rootA.m.regionalPresent = 0;
+	rootB.m.regionalPresent = 0;
+	pu_setBuffer(&ctxtA, bufA, sizeof(bufA), FALSE);
+	pu_setBuffer(&ctxtB, bufB, sizeof(bufB), FALSE);
+	statA = asn1PE_ProbeVehicleData(&ctxtA, &rootA);
+	statB = asn1PE_ProbeVehicleData(&ctxtB, &rootB);
+	if (HAE_OK != sCheck_Bytes("PVD root", &ctxtA, statA, &ctxtB, statB))
+	{
+		ret = HAE_ERROR;
+	}
+
+	rtFreeContext(&ctxtB);
+	rtFreeContext(&ctxtA);
+
+	return ret;
+}
+
+/*************************************************************
+ *
+ * Function 		: sCheck_Stream
+ *
+ * Description	: Stream the PVD sample through PvdStream_Decode and
+ *				  compare every callback with the two pass decode
+ *
+ * Parameter	: pStream - initialized with sStream_Snapshot / sStream_Cits
+ *				  pPvd - asn1PD_ProbeVehicleData result
+ *				  pAddGrpD - asn1PD_PVD_addGrpD of its addGrpD regional
+ *
+ * Returns		: HAE_OK, HAE_ERROR when anything differs
+ *
+ *************************************************************/
+static int sCheck_Stream(PVD_STREAM *pStream, const ProbeVehicleData *pPvd, const PVD_addGrpD *pAddGrpD)
+{
+	int stat;
+	STREAM_CHECK check;
+
+	memset(&check, 0, sizeof(check));
+	check.pPvd = pPvd;
+	check.pAddGrpD = pAddGrpD;
+	check.pSnapshot = pPvd->snapshots.head;
+	check.pCits = pAddGrpD->cits.head;
+	check.ret = HAE_OK;
+	pStream->pArg = &check;
+
+	stat = PvdStream_Decode(pStream, pvd_data, pvd_len);
+	if (0 != stat)
+	{
+		printf("[BENCH] ERROR : PvdStream_Decode returned %d\n", stat);
+		check.ret = HAE_ERROR;
+	}
+
+	if ((check.snapshotCnt != pPvd->snapshots.count) || (check.citsCnt != pAddGrpD->cits.count))
+	{
+		printf("[BENCH] ERROR : PvdStream gave %u snapshots / %u cits, two pass %u / %u\n",
+			check.snapshotCnt, check.citsCnt, (unsigned int)pPvd->snapshots.count, (unsigned int)pAddGrpD->cits.count);
+		check.ret = HAE_ERROR;
+	}
+
+	return check.ret;
+}
+
+static int sStream_Snapshot(void *pArg, const PVD_STREAM_HEADER *pHeader, unsigned int idx, const Snapshot *pSnapshot)
+{
+	int statA, statB;
+	STREAM_CHECK *pCheck = (STREAM_CHECK *)pArg;
+	OSOCTET bufA[BUFF_SIZE], bufB[BUFF_SIZE];
+	OSCTXT ctxtA, ctxtB;
+	ProbeVehicleData rootA, rootB;
+	Snapshot snapA, snapB;
+
+	if ((idx != pCheck->snapshotCnt) || (HAE_NULL == pCheck->pSnapshot))
+	{
+		printf("[BENCH] ERROR : PvdStream snapshot %u out of order\n", idx);
+		pCheck->ret = HAE_ERROR;
+		return HAE_ERROR;
+	}
+
+	rtInitContext(&ctxtA);
+	rtInitContext(&ctxtB);
+
+	if (0 == idx)
+	{
+		/* the head has no snapshots of its own, lend it the two pass list */
+		rootA = pHeader->pvd;
+		rootB = *pCheck->pPvd;
+		rootA.snapshots = rootB.snapshots;
+		rootA.m.regionalPresent = 0;
+		rootB.m.regionalPresent = 0;
+		pu_setBuffer(&ctxtA, bufA, sizeof(bufA), FALSE);
+		pu_setBuffer(&ctxtB, bufB, sizeof(bufB), FALSE);
+		statA = asn1PE_ProbeVehicleData(&ctxtA, &rootA);
+		statB = asn1PE_ProbeVehicleData(&ctxtB, &rootB);
+		if ((HAE_OK != sCheck_Bytes("PvdStream head", &ctxtA, statA, &ctxtB, statB))
+			|| (pHeader->snapshotCnt != pCheck->pPvd->snapshots.count))
+		{
+			pCheck->ret = HAE_ERROR;
+		}
+	}
+
+	snapA = *pSnapshot;
+	snapB = *(const Snapshot *)pCheck->pSnapshot->data;
+	pu_setBuffer(&ctxtA, bufA, sizeof(bufA), FALSE);
+	pu_setBuffer(&ctxtB, bufB, sizeof(bufB), FALSE);
+	statA = asn1PE_Snapshot(&ctxtA, &snapA);
+	statB = asn1PE_Snapshot(&ctxtB, &snapB);
+	if (HAE_OK != sCheck_Bytes("PvdStream snapshot", &ctxtA, statA, &ctxtB, statB))
+	{
+		pCheck->ret = HAE_ERROR;
+	}
+
+	rtFreeContext(&ctxtB);
+	rtFreeContext(&ctxtA);
+
+	pCheck->pSnapshot = pCheck->pSnapshot->next;
+	pCheck->snapshotCnt++;
+
+	return HAE_OK;
+}
+
+static int sStream_Cits(void *pArg, const PVD_STREAM_HEADER *pHeader, unsigned int idx, const CITSPVD *pCits)
+{
+	int statA, statB;
+	STREAM_CHECK *pCheck = (STREAM_CHECK *)pArg;
+	OSOCTET bufA[BUFF_SIZE], bufB[BUFF_SIZE];
+	OSCTXT ctxtA, ctxtB;
+	CITSPVD citsA, citsB;
+
+	if ((idx != pCheck->citsCnt) || (HAE_NULL == pCheck->pCits))
+	{
+		printf("[BENCH] ERROR : PvdStream cits %u out of order\n", idx);
+		pCheck->ret = HAE_ERROR;
+		return HAE_ERROR;
+	}
+
+	rtInitContext(&ctxtA);
+	rtInitContext(&ctxtB);
+
+	citsA = *pCits;
+	citsB = *(const CITSPVD *)pCheck->pCits->data;
+	pu_setBuffer(&ctxtA, bufA, sizeof(bufA), FALSE);
+	pu_setBuffer(&ctxtB, bufB, sizeof(bufB), FALSE);
+	statA = asn1PE_CITSPVD(&ctxtA, &citsA);
+	statB = asn1PE_CITSPVD(&ctxtB, &citsB);
+	if (HAE_OK != sCheck_Bytes("PvdStream cits", &ctxtA, statA, &ctxtB, statB))
+	{
+		pCheck->ret = HAE_ERROR;
+	}
+
+	rtFreeContext(&ctxtB);
+	rtFreeContext(&ctxtA);
+
+	pCheck->pCits = pCheck->pCits->next;
+	pCheck->citsCnt++;
+
+	return HAE_OK;
+}
+
+static int sStream_Count(void *pArg, const PVD_STREAM_HEADER *pHeader, unsigned int idx, const CITSPVD *pCits)
+{
+	(*(unsigned int *)pArg)++;
+
+	return HAE_OK;
+}
+
+/* same UPER encoding on both contexts */
+static int sCheck_Bytes(const char *pName, OSCTXT *pA, int statA, OSCTXT *pB, int statB)
+{
+	size_t lenA, lenB;
+
+	if ((0 != statA) || (0 != statB))
+	{
+		rtxErrPrint(pA);
+		rtxErrPrint(pB);
+		printf("[BENCH] ERROR : %s re-encode failed\n", pName);
+		return HAE_ERROR;
+	}
+
+	lenA = pe_GetMsgLen(pA);
+	lenB = pe_GetMsgLen(pB);
+	if ((lenA != lenB) || memcmp(pA->buffer.data, pB->buffer.data, lenA))
+	{
+		printf("[BENCH] ERROR : %s differs (%zu / %zu bytes)\n", pName, lenA, lenB);
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+static RegionalExtension *sFind_AddGrpD(OSRTDList *pList)
+{
+	OSRTDListNode *pnode;
+	RegionalExtension *pExt;
+
+	for (pnode = pList->head; pnode != 0; pnode = pnode->next)
+	{
+		pExt = (RegionalExtension *)pnode->data;
+		if (ASN1V_addGrpD == pExt->regionId)
+		{
+			return pExt;
+		}
+	}
+
+	return HAE_NULL;
+}
+
+/* RoadSideAlert and ProbeVehicleData with an addGrpD regional extension
+   from asn1Test_RSA_addGrpD / asn1Test_PVD_addGrpD */
+static int sBuildSample(void)
+{
+	int stat;
+	OSCTXT ctxt;
+	OSOCTET extBuf[BUFF_SIZE];
+	RoadSideAlert rsa;
+	ProbeVehicleData *pPvd;
+	Snapshot *pSnapshot;
+	RegionalExtension ext;
+	unsigned int i;
+	RSA_addGrpD *pRsaAddGrpD;
+	PVD_addGrpD *pPvdAddGrpD;
+
+	rtInitContext(&ctxt);
+
+	pRsaAddGrpD = asn1Test_RSA_addGrpD(&ctxt);
+	pu_setBuffer(&ctxt, extBuf, sizeof(extBuf), FALSE);
+	stat = asn1PE_RSA_addGrpD(&ctxt, pRsaAddGrpD);
+
+	if (0 == stat)
+	{
+		memset(&ext, 0, sizeof(ext));
+		ext.regionId = ASN1V_addGrpD;
+		ext.regExtValue.data = extBuf;
+		ext.regExtValue.numocts = pe_GetMsgLen(&ctxt);
+
+		memset(&rsa, 0, sizeof(rsa));
+		rsa.msgCnt = 1;
+		rsa.typeEvent = 513;
+		rsa.m.priorityPresent = 1;
+		rsa.priority.numocts = 1;
+		rsa.priority.data[0] = 0x10;
+		rsa.m.regionalPresent = 1;
+		rtxDListInit(&rsa.regional);
+		rtxDListAppend(&ctxt, &rsa.regional, &ext);
+
+		pu_setBuffer(&ctxt, rsa_data, sizeof(rsa_data), FALSE);
+		stat = asn1PE_RoadSideAlert(&ctxt, &rsa);
+		rsa_len = (unsigned int)pe_GetMsgLen(&ctxt);
+	}
+
+	if (0 != stat)
+	{
+		rtxErrPrint(&ctxt);
+		printf("[BENCH] ERROR : encode of RSA sample failed\n");
+		rtFreeContext(&ctxt);
+		return HAE_ERROR;
+	}
+
+	pPvdAddGrpD = asn1Test_PVD_addGrpD(&ctxt);
+	pu_setBuffer(&ctxt, extBuf, sizeof(extBuf), FALSE);
+	stat = asn1PE_PVD_addGrpD(&ctxt, pPvdAddGrpD);
+
+	if (0 == stat)
+	{
+		memset(&ext, 0, sizeof(ext));
+		ext.regionId = ASN1V_addGrpD;
+		ext.regExtValue.data = extBuf;
+		ext.regExtValue.numocts = pe_GetMsgLen(&ctxt);
+
+		pPvd = asn1Test_ProbeVehicleData(&ctxt);
+		/* a few snapshots that differ, so PvdStream order shows */
+		for (i = pPvd->snapshots.count; i < BENCH_SNAPSHOT_CNT; i++)
+		{
+			pSnapshot = rtxMemAllocTypeZ(&ctxt, Snapshot);
+			*pSnapshot = *(Snapshot *)pPvd->snapshots.head->data;
+			pSnapshot->thePosition.lat += (Latitude)(i * 1000);
+			rtxDListAppend(&ctxt, &pPvd->snapshots, pSnapshot);
+		}
+		pPvd->m.regionalPresent = 1;
+		rtxDListInit(&pPvd->regional);
+		rtxDListAppend(&ctxt, &pPvd->regional, &ext);
+
+		pu_setBuffer(&ctxt, pvd_data, sizeof(pvd_data), FALSE);
+		stat = asn1PE_ProbeVehicleData(&ctxt, pPvd);
+		pvd_len = (unsigned int)pe_GetMsgLen(&ctxt);
+	}
+
+	if (0 != stat)
+	{
+		rtxErrPrint(&ctxt);
+		printf("[BENCH] ERROR : encode of PVD sample failed\n");
+	}
+
+	rtFreeContext(&ctxt);
+
+	return (0 == stat) ? HAE_OK : HAE_ERROR;
+}
+
+static double sNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
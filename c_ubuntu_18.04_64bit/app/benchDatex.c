@@ -0,0 +1,286 @@
+#include <ISO14827-2.h>
+#include <DSRC.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "haeCommon.h"
+#include "datexSession.h"
+
+#define DATEX_BENCH_PORT		61000
+#define DATEX_BENCH_FRAMECNT	200000L
+#define DATEX_BENCH_BATCH		DATEX_PUBLISH_MAX
+#define DATEX_BENCH_WAIT_MS		2000
+
+#define DATEX_BENCH_SUB_EVENT	1
+#define DATEX_BENCH_SUB_PERIOD	2
+
+typedef struct{
+	volatile unsigned long eventCnt;
+	volatile unsigned long periodCnt;
+	volatile unsigned long bytes;
+} DATEX_BENCH_RX;
+
+static unsigned char spat_data[BUFF_SIZE];
+static unsigned int spat_len;
+
+static int sBuildSample(void);
+static void sOnPublish(void *pArg, unsigned int subSerial, const MessageFrame *pFrame);
+static int sProvide(void *pArg, const DATEX_SUB *pSub, OSCTXT *pctxt, MessageFrame *pFrame);
+static int sWait(DATEX_SESSION *pSession, int state);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: DATEX loopback harness. A server and a client session
+ *				  in one process: login, an event driven SPaT
+ *				  subscription blasted as fast as the server can
+ *				  publish, then a 10 ms periodic MAP subscription
+ *				  served from DatexSession_Tick.
+ *
+ * Parameter	: argv[1] - "tcp" (default) or "udp"
+ *				  argv[2] - number of SPaT frames
+ *				  argv[3] - "hdr": private DATEX_FRAMING_HDR on both
+ *				  ends instead of bare packets
+ *
+ * Returns		: 0, 1 if a SPaT frame is lost over TCP or a packet
+ *				  fails to decode
+ *
+ * Notes		: UDP has no flow control, the server outruns the
+ *				  client's socket buffer and frames can be lost
+ *				  (none to a few percent of 200000 on loopback,
+ *				  from run to run). The loss is printed, it is not
+ *				  a failure.
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	long i, n;
+	long lost;
+	int ret = 0;
+	long frameCnt = DATEX_BENCH_FRAMECNT;
+	int transport = DATEX_TRANSPORT_TCP;
+	int framing = DATEX_FRAMING_NONE;
+	unsigned long last;
+	unsigned long long t0, t1, idle;
+	MessageFrame frames[DATEX_BENCH_BATCH];
+	DATEX_SESSION server, client;
+	DATEX_BENCH_RX rx;
+
+	if ((argc > 1) && (0 == strcmp(argv[1], "udp")))
+	{
+		transport = DATEX_TRANSPORT_UDP;
+	}
+	if (argc > 2)
+	{
+		frameCnt = atol(argv[2]);
+	}
+	if ((argc > 3) && (0 == strcmp(argv[3], "hdr")))
+	{
+		framing = DATEX_FRAMING_HDR;
+	}
+
+	if (HAE_OK != sBuildSample())
+	{
+		return 1;
+	}
+
+	memset(&rx, 0, sizeof(rx));
+	memset(frames, 0, sizeof(frames));
+	for (i = 0; i < DATEX_BENCH_BATCH; i++)
+	{
+		frames[i].messageId = ASN1V_signalPhaseAndTimingMessage;
+		frames[i].value.numocts = spat_len;
+		frames[i].value.data = spat_data;
+	}
+
+	if ((HAE_OK != DatexSession_Init(&server, DATEX_ROLE_SERVER, transport, HAE_NULL, sProvide, HAE_NULL)) ||
+		(HAE_OK != DatexSession_Init(&client, DATEX_ROLE_CLIENT, transport, sOnPublish, HAE_NULL, &rx)))
+	{
+		return 1;
+	}
+	DatexSession_SetIdentity(&server, "tmc", "rsu", "rsu", "secret");
+	DatexSession_SetIdentity(&client, "rsu", "tmc", "rsu", "secret");
+	DatexSession_SetFraming(&server, framing);
+	DatexSession_SetFraming(&client, framing);
+
+	if ((HAE_OK != DatexSession_Listen(&server, "127.0.0.1", DATEX_BENCH_PORT)) ||
+		(HAE_OK != DatexSession_Connect(&client, "127.0.0.1", DATEX_BENCH_PORT)) ||
+		(HAE_OK != DatexSession_Accept(&server)) ||
+		(HAE_OK != DatexSession_Start(&server)) ||
+		(HAE_OK != DatexSession_Start(&client)))
+	{
+		return 1;
+	}
+
+	/* login */
+	DatexSession_Login(&client);
+	if (HAE_OK != sWait(&client, DATEX_STATE_ONLINE))
+	{
+		printf("[BENCH] ERROR : login timed out\n");
+		return 1;
+	}
+
+	/* event driven: publish as fast as possible */
+	DatexSession_Subscribe(&client, DATEX_BENCH_SUB_EVENT, ASN1V_signalPhaseAndTimingMessage, T_SubscriptionMode_event_driven, 0);
+	t0 = DatexSession_NowMs();
+	while (HAE_OK != DatexSession_Publish(&server, DATEX_BENCH_SUB_EVENT, frames, 1))
+	{
+		if (DatexSession_NowMs() - t0 > DATEX_BENCH_WAIT_MS)
+		{
+			printf("[BENCH] ERROR : subscription timed out\n");
+			return 1;
+		}
+		usleep(1000);
+	}
+	while (rx.eventCnt < 1)
+	{
+		usleep(100);
+	}
+	rx.eventCnt = 0;
+	rx.bytes = 0;
+
+	t0 = DatexSession_NowMs();
+	for (i = 0; i < frameCnt; i += n)
+	{
+		n = (frameCnt - i > DATEX_BENCH_BATCH) ? DATEX_BENCH_BATCH : frameCnt - i;
+		if (HAE_OK != DatexSession_Publish(&server, DATEX_BENCH_SUB_EVENT, frames, n))
+		{
+			break;
+		}
+	}
+
+	/* drain; UDP may drop, so stop when nothing arrives for a while */
+	last = 0;
+	idle = DatexSession_NowMs();
+	while (rx.eventCnt < (unsigned long)frameCnt)
+	{
+		if (rx.eventCnt != last)
+		{
+			last = rx.eventCnt;
+			idle = DatexSession_NowMs();
+		}
+		else if (DatexSession_NowMs() - idle > 500)
+		{
+			break;
+		}
+		usleep(100);
+	}
+	t1 = DatexSession_NowMs();
+	if (rx.eventCnt < (unsigned long)frameCnt)
+	{
+		t1 -= 500;
+	}
+	if (t1 <= t0)
+	{
+		t1 = t0 + 1;
+	}
+
+	printf("%s publish  : %lu/%ld frames, %lu packets, %llu ms%s\n", (DATEX_TRANSPORT_TCP == transport) ? "TCP" : "UDP",
+		   rx.eventCnt, frameCnt, server.txPackets, t1 - t0,
+		   (DATEX_FRAMING_HDR == framing) ? ", private header" : "");
+	printf("throughput   : %.0f frames/s, %.1f MB/s payload\n",
+		   rx.eventCnt * 1000.0 / (t1 - t0), rx.bytes / 1000.0 / (t1 - t0));
+	lost = frameCnt - (long)rx.eventCnt;
+	printf("lost         : %ld frames (%.2f%%)\n", lost, 100.0 * lost / frameCnt);
+	if ((lost > 0) && (DATEX_TRANSPORT_TCP == transport))
+	{
+		printf("[BENCH] ERROR : %ld frames lost over TCP\n", lost);
+		ret = 1;
+	}
+
+	/* periodic: 10 ms MAP from the provider for 500 ms */
+	DatexSession_Subscribe(&client, DATEX_BENCH_SUB_PERIOD, ASN1V_mapData, T_SubscriptionMode_periodic, 10);
+	t0 = DatexSession_NowMs();
+	while ((t1 = DatexSession_NowMs()) - t0 < 500)
+	{
+		DatexSession_Tick(&server, t1);
+		usleep(1000);
+	}
+	printf("periodic     : %lu publications in 500 ms (10 ms period)\n", rx.periodCnt);
+
+	DatexSession_Cancel(&client, DATEX_BENCH_SUB_PERIOD);
+	DatexSession_Logout(&client);
+	usleep(100000);
+
+	printf("client rx    : %lu packets, %lu errors; server rx %lu packets, %lu errors\n",
+		   client.rxPackets, client.rxErrors, server.rxPackets, server.rxErrors);
+	if ((0 != client.rxErrors) || (0 != server.rxErrors))
+	{
+		printf("[BENCH] ERROR : packets that do not decode\n");
+		ret = 1;
+	}
+
+	DatexSession_Free(&client);
+	DatexSession_Free(&server);
+
+	return ret;
+}
+
+static void sOnPublish(void *pArg, unsigned int subSerial, const MessageFrame *pFrame)
+{
+	DATEX_BENCH_RX *pRx = (DATEX_BENCH_RX *)pArg;
+
+	if (DATEX_BENCH_SUB_EVENT == subSerial)
+	{
+		pRx->eventCnt++;
+		pRx->bytes += pFrame->value.numocts;
+	}
+	else
+	{
+		pRx->periodCnt++;
+	}
+}
+
+/* periodic subscriptions get the SPaT sample under the subscribed message id */
+static int sProvide(void *pArg, const DATEX_SUB *pSub, OSCTXT *pctxt, MessageFrame *pFrame)
+{
+	pFrame->messageId = pSub->messageId;
+	pFrame->value.numocts = spat_len;
+	pFrame->value.data = spat_data;
+
+	return HAE_OK;
+}
+
+static int sWait(DATEX_SESSION *pSession, int state)
+{
+	unsigned long long t0 = DatexSession_NowMs();
+
+	while (DatexSession_State(pSession) != state)
+	{
+		if (DatexSession_NowMs() - t0 > DATEX_BENCH_WAIT_MS)
+		{
+			return HAE_ERROR;
+		}
+		usleep(1000);
+	}
+
+	return HAE_OK;
+}
+
+static int sBuildSample(void)
+{
+	int stat;
+	OSCTXT ctxt;
+	SPAT *pSpat;
+
+	rtInitContext(&ctxt);
+
+	pSpat = asn1Test_SPAT(&ctxt);
+	pu_setBuffer(&ctxt, spat_data, sizeof(spat_data), FALSE);
+	stat = asn1PE_SPAT(&ctxt, pSpat);
+	spat_len = (unsigned int)pe_GetMsgLen(&ctxt);
+
+	if (0 != stat)
+	{
+		rtxErrPrint(&ctxt);
+		printf("[BENCH] ERROR : encode of SPaT sample failed\n");
+	}
+
+	rtFreeContext(&ctxt);
+
+	return (0 == stat) ? HAE_OK : HAE_ERROR;
+}
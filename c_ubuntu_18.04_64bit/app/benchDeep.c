@@ -0,0 +1,379 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "asnDeep.h"
+#include "captureLog.h"
+
+#define BENCH_ITERCNT			2000L
+#define BENCH_BUF_SIZE			65536
+
+typedef struct{
+	const char *pName;
+	unsigned int messageId;
+} BENCH_SAMPLE;
+
+static const BENCH_SAMPLE bench_sample[] =
+{
+	{ "SPaT", ASN1V_signalPhaseAndTimingMessage },
+	{ "MAP", ASN1V_mapData },
+	{ "BSM", ASN1V_basicSafetyMessage },
+	{ "TIM", ASN1V_travelerInformation },
+	{ "RTCM", ASN1V_rtcmCorrections },
+	{ "SRM", ASN1V_signalRequestMessage },
+	{ "SSM", ASN1V_signalStatusMessage },
+	{ "PSM", ASN1V_personalSafetyMessage },
+	{ "PVD", ASN1V_probeVehicleData },
+};
+
+typedef struct{
+	unsigned int cnt;
+	char first[ASN_DEEP_PATH_MAX];
+} BENCH_DIFF;
+
+static unsigned char bench_enc[BENCH_BUF_SIZE];
+static unsigned char bench_reenc[BENCH_BUF_SIZE];
+
+static int sCheck(const char *pName, const ASN_TYPE *pType, const ASN_DEEP_TYPE *pDeep, const unsigned char *pData,
+	size_t len, long iterCnt);
+static int sCheckDiff(const ASN_DEEP_TYPE *pDeep, void *pCopy);
+static int sCheckCapture(const char *pDir, int offset);
+static int sEncode(OSCTXT *pctxt, const ASN_TYPE *pType, void *pValue, unsigned char *pBuf, size_t *pLen);
+static void *sDecode(OSCTXT *pctxt, const ASN_TYPE *pType, const unsigned char *pData, size_t len);
+static void sOnDiff(void *pArg, const char *pPath);
+static double sNow(void);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: AsnDeep_Copy / AsnDeep_Compare on the test values of
+ *				  the library and optionally on a capture directory.
+ *				  A copy must outlive its decode context and encode
+ *				  to the same UPER bytes, compare equal to a second
+ *				  decode, and report a changed field by its path.
+ *				  Copy is timed against a decode, compare against an
+ *				  encode of both values and a memcmp.
+ *
+ * Parameter	: argv[1] - iterations per timing
+ *				  argv[2] - capture directory (CaptureLog)
+ *				  argv[3] - header octets before the MessageFrame
+ *
+ * Returns		: 0, 1 if a check fails
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	long iterCnt = BENCH_ITERCNT;
+	const ASN_TYPE *pType;
+	const ASN_DEEP_TYPE *pDeep;
+	void *pValue;
+	size_t len;
+	unsigned int i;
+	OSCTXT ctxt;
+	int ret = 0;
+
+	if (argc > 1)
+	{
+		iterCnt = atol(argv[1]);
+	}
+	if (iterCnt <= 0)
+	{
+		printf("usage: %s [iterations [capture dir [offset]]]\n", argv[0]);
+		return 1;
+	}
+
+	printf("%-6s %8s %8s %10s %10s %10s %10s\n", "msg", "bytes", "copy", "decode ns", "copy ns", "enc+cmp ns",
+		"compare ns");
+	for (i = 0; i < sizeof(bench_sample) / sizeof(bench_sample[0]); i++)
+	{
+		pType = AsnType_FindMessage(bench_sample[i].messageId);
+		if ((HAE_NULL == pType) || (0 == pType->pfTest) || (HAE_NULL == (pDeep = AsnDeep_Find(pType->pName))))
+		{
+			printf("[BENCH] ERROR : no type for %s\n", bench_sample[i].pName);
+			ret = 1;
+			continue;
+		}
+
+		rtInitContext(&ctxt);
+		if ((HAE_NULL == (pValue = pType->pfTest(&ctxt))) || (HAE_OK != sEncode(&ctxt, pType, pValue, bench_enc, &len)))
+		{
+			printf("[BENCH] ERROR : no test value for %s\n", bench_sample[i].pName);
+			ret = 1;
+		}
+		else if (HAE_OK != sCheck(bench_sample[i].pName, pType, pDeep, bench_enc, len, iterCnt))
+		{
+			ret = 1;
+		}
+		rtFreeContext(&ctxt);
+	}
+
+	if ((argc > 2) && (HAE_OK != sCheckCapture(argv[2], (argc > 3) ? atoi(argv[3]) : 0)))
+	{
+		ret = 1;
+	}
+
+	return ret;
+}
+
+/*************************************************************
+ *
+ * Function 		: sCheck
+ *
+ * Description	: Decode, copy out of the decode context, free the
+ *				  context and re-encode the copy; then time copy and
+ *				  compare.
+ *
+ * Parameter	: pName - sample name, HAE_NULL: checks only
+ *				  pType, pDeep - type of the message
+ *				  pData, len - UPER encoding of a value
+ *				  iterCnt - iterations per timing
+ *
+ * Returns		: HAE_OK, HAE_ERROR if a check fails
+ *
+ *************************************************************/
+static int sCheck(const char *pName, const ASN_TYPE *pType, const ASN_DEEP_TYPE *pDeep, const unsigned char *pData,
+	size_t len, long iterCnt)
+{
+	OSCTXT ctxt, ctxt2;
+	void *pValue, *pValue2, *pCopy = HAE_NULL;
+	unsigned char *pBuf = HAE_NULL;
+	size_t size, outLen;
+	volatile int sink = 0;
+	double t0, tDec, tCopy, tEnc, tCmp;
+	long i;
+	int ret = HAE_ERROR;
+
+	rtInitContext(&ctxt);
+	rtInitContext(&ctxt2);
+	if (HAE_NULL == (pValue = sDecode(&ctxt, pType, pData, len)))
+	{
+		printf("[BENCH] ERROR : %s does not decode\n", pType->pName);
+		goto done;
+	}
+	size = AsnDeep_Size(pDeep, pValue);
+	if ((HAE_NULL == (pBuf = (unsigned char *)malloc(size))) || (HAE_NULL == (pCopy = AsnDeep_Copy(pDeep, pValue, pBuf, size))))
+	{
+		printf("[BENCH] ERROR : %s copy of %lu octets failed\n", pType->pName, (unsigned long)size);
+		goto done;
+	}
+
+	/* nothing of the copy may point into the decode context */
+	rtFreeContext(&ctxt);
+	rtInitContext(&ctxt);
+	if ((HAE_OK != sEncode(&ctxt, pType, pCopy, bench_reenc, &outLen)) || (outLen != len) ||
+		(0 != memcmp(pData, bench_reenc, len)))
+	{
+		printf("[BENCH] ERROR : %s copy does not encode to the same octets\n", pType->pName);
+		goto done;
+	}
+	if ((HAE_NULL == (pValue2 = sDecode(&ctxt2, pType, pData, len))) || (0 != AsnDeep_Compare(pDeep, pCopy, pValue2)) ||
+		(0 != AsnDeep_Diff(pDeep, pValue2, pCopy, HAE_NULL, HAE_NULL)))
+	{
+		printf("[BENCH] ERROR : %s copy differs from a new decode\n", pType->pName);
+		goto done;
+	}
+	if ((0 == strcmp(pDeep->pName, "SPAT")) && (HAE_OK != sCheckDiff(pDeep, pCopy)))
+	{
+		goto done;
+	}
+	if (HAE_NULL == pName)
+	{
+		ret = HAE_OK;
+		goto done;
+	}
+
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		rtxMemReset(&ctxt);
+		pValue = rtxMemAlloc(&ctxt, pType->size);
+		memset(pValue, 0, pType->size);
+		pu_setBuffer(&ctxt, (OSOCTET *)pData, len, FALSE);
+		sink += pType->pfPerDec(&ctxt, pValue);
+	}
+	tDec = (sNow() - t0) / iterCnt;
+
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		sink += (HAE_NULL != AsnDeep_Copy(pDeep, pValue2, pBuf, AsnDeep_Size(pDeep, pValue2)));
+	}
+	tCopy = (sNow() - t0) / iterCnt;
+
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		sEncode(&ctxt, pType, pCopy, bench_enc, &len);
+		sEncode(&ctxt, pType, pValue2, bench_reenc, &outLen);
+		sink += (len != outLen) || (0 != memcmp(bench_enc, bench_reenc, len));
+	}
+	tEnc = (sNow() - t0) / iterCnt;
+
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		sink += AsnDeep_Compare(pDeep, pCopy, pValue2);
+	}
+	tCmp = (sNow() - t0) / iterCnt;
+
+	printf("%-6s %8lu %8lu %10.0f %10.0f %10.0f %10.0f\n", pName, (unsigned long)len, (unsigned long)size, tDec, tCopy,
+		tEnc, tCmp);
+	ret = HAE_OK;
+
+done:
+	rtFreeContext(&ctxt);
+	rtFreeContext(&ctxt2);
+	free(pBuf);
+
+	return ret;
+}
+
+/* a changed signal group and event of the copy, reported by path */
+static int sCheckDiff(const ASN_DEEP_TYPE *pDeep, void *pCopy)
+{
+	static const char *pExpect = "intersections[0].states[0].signalGroup";
+	SPAT *pSpat = (SPAT *)pCopy;
+	IntersectionState *pState;
+	MovementState *pMovement;
+	unsigned char *pOrig;
+	size_t size = AsnDeep_Size(pDeep, pCopy);
+	BENCH_DIFF diff;
+	int ret = HAE_ERROR;
+
+	if ((HAE_NULL == pSpat->intersections.head) ||
+		(HAE_NULL == (pState = (IntersectionState *)pSpat->intersections.head->data)->states.head))
+	{
+		return HAE_OK;
+	}
+	if (HAE_NULL == (pOrig = (unsigned char *)malloc(size)))
+	{
+		return HAE_ERROR;
+	}
+	AsnDeep_Copy(pDeep, pCopy, pOrig, size);
+
+	pMovement = (MovementState *)pState->states.head->data;
+	pMovement->signalGroup ^= 1;
+	memset(&diff, 0, sizeof(diff));
+	if ((1 != AsnDeep_Diff(pDeep, pOrig, pCopy, sOnDiff, &diff)) || (0 != strcmp(diff.first, pExpect)) ||
+		(0 == AsnDeep_Compare(pDeep, pOrig, pCopy)))
+	{
+		printf("[BENCH] ERROR : diff %u \"%s\", expected 1 \"%s\"\n", diff.cnt, diff.first, pExpect);
+	}
+	else
+	{
+		ret = HAE_OK;
+	}
+	pMovement->signalGroup ^= 1;
+	free(pOrig);
+
+	return ret;
+}
+
+/*************************************************************
+ *
+ * Function 		: sCheckCapture
+ *
+ * Description	: sCheck on the value of every MessageFrame of a
+ *				  capture directory.
+ *
+ * Parameter	: pDir - capture directory
+ *				  offset - header octets before the MessageFrame
+ *
+ * Returns		: HAE_OK, HAE_ERROR if a check fails
+ *
+ *************************************************************/
+static int sCheckCapture(const char *pDir, int offset)
+{
+	CAPTURE_READER reader;
+	CAPTURE_RECORD record;
+	const ASN_DEEP_TYPE *pDeep;
+	const ASN_TYPE *pType;
+	MessageFrame frame;
+	unsigned long cnt = 0, skipCnt = 0, errorCnt = 0;
+	OSCTXT ctxt;
+
+	if (HAE_OK != CaptureLog_OpenReader(&reader, pDir))
+	{
+		return HAE_ERROR;
+	}
+	rtInitContext(&ctxt);
+	while (HAE_OK == CaptureLog_Next(&reader, &record))
+	{
+		rtxMemReset(&ctxt);
+		memset(&frame, 0, sizeof(frame));
+		if (record.len <= (unsigned int)offset)
+		{
+			skipCnt++;
+			continue;
+		}
+		pu_setBuffer(&ctxt, (OSOCTET *)record.pData + offset, record.len - offset, FALSE);
+		if ((0 != asn1PD_MessageFrame(&ctxt, &frame)) || (HAE_NULL == (pType = AsnType_FindMessage(frame.messageId))) ||
+			(HAE_NULL == (pDeep = AsnDeep_Find(pType->pName))))
+		{
+			skipCnt++;
+			continue;
+		}
+		if (HAE_OK != sCheck(HAE_NULL, pType, pDeep, frame.value.data, frame.value.numocts, 0))
+		{
+			errorCnt++;
+		}
+		cnt++;
+	}
+	rtFreeContext(&ctxt);
+	CaptureLog_CloseReader(&reader);
+
+	printf("capture %s: %lu values checked, %lu skipped, %lu failed\n", pDir, cnt, skipCnt, errorCnt);
+
+	return (0 == errorCnt) ? HAE_OK : HAE_ERROR;
+}
+
+static int sEncode(OSCTXT *pctxt, const ASN_TYPE *pType, void *pValue, unsigned char *pBuf, size_t *pLen)
+{
+	pu_setBuffer(pctxt, pBuf, BENCH_BUF_SIZE, FALSE);
+	if (0 != pType->pfPerEnc(pctxt, pValue))
+	{
+		return HAE_ERROR;
+	}
+	*pLen = pe_GetMsgLen(pctxt);
+
+	return HAE_OK;
+}
+
+/* a zeroed value of the context, the decoders need one */
+static void *sDecode(OSCTXT *pctxt, const ASN_TYPE *pType, const unsigned char *pData, size_t len)
+{
+	void *pValue = rtxMemAllocZ(pctxt, pType->size);
+
+	if (HAE_NULL == pValue)
+	{
+		return HAE_NULL;
+	}
+	pu_setBuffer(pctxt, (OSOCTET *)pData, len, FALSE);
+
+	return (0 == pType->pfPerDec(pctxt, pValue)) ? pValue : HAE_NULL;
+}
+
+static void sOnDiff(void *pArg, const char *pPath)
+{
+	BENCH_DIFF *pDiff = (BENCH_DIFF *)pArg;
+
+	if (0 == pDiff->cnt++)
+	{
+		snprintf(pDiff->first, sizeof(pDiff->first), "%s", pPath);
+	}
+}
+
+static double sNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
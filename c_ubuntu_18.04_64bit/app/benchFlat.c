@@ -0,0 +1,482 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "asnDeep.h"
+#include "asnFlat.h"
+#include "captureLog.h"
+
+#define BENCH_ITERCNT			2000L
+#define BENCH_BUF_SIZE			65536
+#define BENCH_CORRUPT_CNT		2000		/* damaged copies of each block */
+
+typedef struct{
+	const char *pName;
+	unsigned int messageId;
+} BENCH_SAMPLE;
+
+static const BENCH_SAMPLE bench_sample[] =
+{
+	{ "SPaT", ASN1V_signalPhaseAndTimingMessage },
+	{ "MAP", ASN1V_mapData },
+	{ "BSM", ASN1V_basicSafetyMessage },
+	{ "TIM", ASN1V_travelerInformation },
+	{ "RTCM", ASN1V_rtcmCorrections },
+	{ "SRM", ASN1V_signalRequestMessage },
+	{ "SSM", ASN1V_signalStatusMessage },
+	{ "PSM", ASN1V_personalSafetyMessage },
+	{ "PVD", ASN1V_probeVehicleData },
+};
+
+/* blocks are 8 octet aligned */
+static unsigned long long bench_flat[BENCH_BUF_SIZE / 8];
+static unsigned long long bench_recv[BENCH_BUF_SIZE / 8];
+static unsigned char bench_enc[BENCH_BUF_SIZE];
+static unsigned char bench_reenc[BENCH_BUF_SIZE];
+
+static int sCheck(const char *pName, const ASN_TYPE *pType, const ASN_DEEP_TYPE *pDeep, const unsigned char *pData,
+	size_t len, long iterCnt);
+static int sCheckInPlace(const ASN_DEEP_TYPE *pDeep, const void *pValue, const void *pFlat, size_t len);
+static unsigned long sCorrupt(const ASN_TYPE *pType, const ASN_DEEP_TYPE *pDeep, size_t len);
+static int sCheckCapture(const char *pDir, int offset);
+static int sEncode(OSCTXT *pctxt, const ASN_TYPE *pType, void *pValue, unsigned char *pBuf, size_t *pLen);
+static void *sDecode(OSCTXT *pctxt, const ASN_TYPE *pType, const unsigned char *pData, size_t len);
+static double sNow(void);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: AsnFlat_Write / AsnFlat_Check / AsnFlat_Relocate on
+ *				  the test values of the library and optionally on a
+ *				  capture directory. A block copied to another buffer
+ *				  must check, read in place like the value, relocate
+ *				  to a value equal to a new decode and encode to the
+ *				  same UPER octets. Damaged blocks must be refused or
+ *				  give a value that is safe to walk (run it under
+ *				  ASan). Write + relocate is timed against UPER
+ *				  encode + decode.
+ *
+ * Parameter	: argv[1] - iterations per timing
+ *				  argv[2] - capture directory (CaptureLog)
+ *				  argv[3] - header octets before the MessageFrame
+ *
+ * Returns		: 0, 1 if a check fails
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	long iterCnt = BENCH_ITERCNT;
+	const ASN_TYPE *pType;
+	const ASN_DEEP_TYPE *pDeep;
+	void *pValue;
+	size_t len;
+	unsigned int i;
+	OSCTXT ctxt;
+	int ret = 0;
+
+	if (argc > 1)
+	{
+		iterCnt = atol(argv[1]);
+	}
+	if (iterCnt <= 0)
+	{
+		printf("usage: %s [iterations [capture dir [offset]]]\n", argv[0]);
+		return 1;
+	}
+
+	printf("%-6s %8s %8s %10s %10s %10s %10s %10s\n", "msg", "bytes", "flat", "enc ns", "dec ns", "write ns",
+		"check ns", "reloc ns");
+	for (i = 0; i < sizeof(bench_sample) / sizeof(bench_sample[0]); i++)
+	{
+		pType = AsnType_FindMessage(bench_sample[i].messageId);
+		if ((HAE_NULL == pType) || (0 == pType->pfTest) || (HAE_NULL == (pDeep = AsnDeep_Find(pType->pName))))
+		{
+			printf("[BENCH] ERROR : no type for %s\n", bench_sample[i].pName);
+			ret = 1;
+			continue;
+		}
+
+		rtInitContext(&ctxt);
+		if ((HAE_NULL == (pValue = pType->pfTest(&ctxt))) || (HAE_OK != sEncode(&ctxt, pType, pValue, bench_enc, &len)))
+		{
+			printf("[BENCH] ERROR : no test value for %s\n", bench_sample[i].pName);
+			ret = 1;
+		}
+		else if (HAE_OK != sCheck(bench_sample[i].pName, pType, pDeep, bench_enc, len, iterCnt))
+		{
+			ret = 1;
+		}
+		rtFreeContext(&ctxt);
+	}
+
+	if ((argc > 2) && (HAE_OK != sCheckCapture(argv[2], (argc > 3) ? atoi(argv[3]) : 0)))
+	{
+		ret = 1;
+	}
+
+	return ret;
+}
+
+/*************************************************************
+ *
+ * Function 		: sCheck
+ *
+ * Description	: Decode, write the flat block, free the decode
+ *				  context, pass the block on by memcpy, check and
+ *				  relocate it there; then damage it and time it.
+ *
+ * Parameter	: pName - sample name, HAE_NULL: checks only
+ *				  pType, pDeep - type of the message
+ *				  pData, len - UPER encoding of a value
+ *				  iterCnt - iterations per timing
+ *
+ * Returns		: HAE_OK, HAE_ERROR if a check fails
+ *
+ *************************************************************/
+static int sCheck(const char *pName, const ASN_TYPE *pType, const ASN_DEEP_TYPE *pDeep, const unsigned char *pData,
+	size_t len, long iterCnt)
+{
+	OSCTXT ctxt;
+	void *pValue, *pRelocated;
+	const void *pInPlace;
+	size_t flatLen, outLen;
+	unsigned long refusedCnt;
+	volatile int sink = 0;
+	double t0, tEnc, tDec, tWrite, tCheck, tReloc;
+	long i;
+	int ret = HAE_ERROR;
+
+	rtInitContext(&ctxt);
+	if ((HAE_NULL == (pValue = sDecode(&ctxt, pType, pData, len))) ||
+		(HAE_OK != AsnFlat_Write(pDeep, pValue, bench_flat, sizeof(bench_flat), &flatLen)))
+	{
+		printf("[BENCH] ERROR : %s does not decode / flatten\n", pType->pName);
+		goto done;
+	}
+	rtFreeContext(&ctxt);
+	rtInitContext(&ctxt);
+
+	/* the receiving side: another buffer, no decode context */
+	memcpy(bench_recv, bench_flat, flatLen);
+	if ((AsnFlat_Type(bench_recv, flatLen) != pDeep) || (HAE_NULL == (pInPlace = AsnFlat_Check(pDeep, bench_recv, flatLen))))
+	{
+		printf("[BENCH] ERROR : %s block does not check\n", pType->pName);
+		goto done;
+	}
+	if ((HAE_NULL == (pValue = sDecode(&ctxt, pType, pData, len))) ||
+		(HAE_OK != sCheckInPlace(pDeep, pValue, bench_recv, flatLen)))
+	{
+		goto done;
+	}
+	if ((HAE_NULL == (pRelocated = AsnFlat_Relocate(pDeep, bench_recv, flatLen))) ||
+		(0 != AsnDeep_Compare(pDeep, pRelocated, pValue)))
+	{
+		printf("[BENCH] ERROR : %s relocated value differs from a new decode\n", pType->pName);
+		goto done;
+	}
+	if ((HAE_OK != sEncode(&ctxt, pType, pRelocated, bench_reenc, &outLen)) || (outLen != len) ||
+		(0 != memcmp(pData, bench_reenc, len)))
+	{
+		printf("[BENCH] ERROR : %s relocated value does not encode to the same octets\n", pType->pName);
+		goto done;
+	}
+	/* a relocated block is no flat block any more, unless nothing was pointed to */
+	if ((flatLen > sizeof(ASN_FLAT_HDR) + ASN_DEEP_ALIGN(pDeep->size)) &&
+		(HAE_NULL != AsnFlat_Check(pDeep, bench_recv, flatLen)))
+	{
+		printf("[BENCH] ERROR : %s relocated block checks again\n", pType->pName);
+		goto done;
+	}
+	/* short blocks */
+	memcpy(bench_recv, bench_flat, flatLen);
+	if ((HAE_NULL != AsnFlat_Check(pDeep, bench_recv, flatLen - 1)) ||
+		(HAE_NULL != AsnFlat_Check(pDeep, bench_recv, sizeof(ASN_FLAT_HDR))))
+	{
+		printf("[BENCH] ERROR : %s short block checks\n", pType->pName);
+		goto done;
+	}
+	if (HAE_NULL == pName)
+	{
+		ret = HAE_OK;
+		goto done;
+	}
+	refusedCnt = sCorrupt(pType, pDeep, flatLen);
+
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		sEncode(&ctxt, pType, pValue, bench_enc, &outLen);
+	}
+	tEnc = (sNow() - t0) / iterCnt;
+
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		rtxMemReset(&ctxt);
+		sink += (HAE_NULL != sDecode(&ctxt, pType, pData, len));
+	}
+	tDec = (sNow() - t0) / iterCnt;
+	pValue = sDecode(&ctxt, pType, pData, len);
+
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		sink += AsnFlat_Write(pDeep, pValue, bench_flat, sizeof(bench_flat), &flatLen);
+	}
+	tWrite = (sNow() - t0) / iterCnt;
+
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		sink += (HAE_NULL != AsnFlat_Check(pDeep, bench_flat, flatLen));
+	}
+	tCheck = (sNow() - t0) / iterCnt;
+
+	/* the memcpy of the block is part of it, a relocated block is used up */
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		memcpy(bench_recv, bench_flat, flatLen);
+		sink += (HAE_NULL != AsnFlat_Relocate(pDeep, bench_recv, flatLen));
+	}
+	tReloc = (sNow() - t0) / iterCnt;
+
+	printf("%-6s %8lu %8lu %10.0f %10.0f %10.0f %10.0f %10.0f  %lu/%d damaged refused\n", pName, (unsigned long)len,
+		(unsigned long)flatLen, tEnc, tDec, tWrite, tCheck, tReloc, refusedCnt, BENCH_CORRUPT_CNT);
+	ret = HAE_OK;
+
+done:
+	rtFreeContext(&ctxt);
+
+	return ret;
+}
+
+/*************************************************************
+ *
+ * Function 		: sCheckInPlace
+ *
+ * Description	: Read a checked block where it is, through
+ *				  ASN_FLAT_AT, and compare with the value: the
+ *				  intersections / movements / events of a SPaT, the
+ *				  scalar fields of the root of any other type.
+ *
+ * Parameter	: pDeep - type
+ *				  pValue - decoded value
+ *				  pFlat, len - checked block
+ *
+ * Returns		: HAE_OK, HAE_ERROR if they differ
+ *
+ *************************************************************/
+static int sCheckInPlace(const ASN_DEEP_TYPE *pDeep, const void *pValue, const void *pFlat, size_t len)
+{
+	const SPAT *pSpat = (const SPAT *)AsnFlat_Check(pDeep, pFlat, len);
+	const SPAT *pOrig = (const SPAT *)pValue;
+	const OSRTDListNode *pNode, *pNode2, *pOrigNode, *pOrigNode2;
+	const IntersectionState *pState, *pOrigState;
+	const MovementState *pMovement, *pOrigMovement;
+	const char *pName;
+	OSSIZE i, j;
+
+	if (0 != strcmp(pDeep->pName, "SPAT"))
+	{
+		return HAE_OK;
+	}
+	if ((pSpat->intersections.count != pOrig->intersections.count) || (pSpat->m.timeStampPresent != pOrig->m.timeStampPresent) ||
+		(pSpat->timeStamp != pOrig->timeStamp))
+	{
+		printf("[BENCH] ERROR : SPAT in place differs\n");
+		return HAE_ERROR;
+	}
+	pNode = (const OSRTDListNode *)ASN_FLAT_AT(pFlat, pSpat->intersections.head);
+	pOrigNode = pOrig->intersections.head;
+	for (i = 0; i < pSpat->intersections.count; i++)
+	{
+		pState = (const IntersectionState *)ASN_FLAT_AT(pFlat, pNode->data);
+		pOrigState = (const IntersectionState *)pOrigNode->data;
+		pName = (const char *)ASN_FLAT_AT(pFlat, pState->name);
+		if ((pState->id.id != pOrigState->id.id) || (pState->states.count != pOrigState->states.count) ||
+			((0 != pState->m.namePresent) && ((HAE_NULL == pName) || (0 != strcmp(pName, pOrigState->name)))))
+		{
+			printf("[BENCH] ERROR : SPAT intersection %lu in place differs\n", (unsigned long)i);
+			return HAE_ERROR;
+		}
+		pNode2 = (const OSRTDListNode *)ASN_FLAT_AT(pFlat, pState->states.head);
+		pOrigNode2 = pOrigState->states.head;
+		for (j = 0; j < pState->states.count; j++)
+		{
+			pMovement = (const MovementState *)ASN_FLAT_AT(pFlat, pNode2->data);
+			pOrigMovement = (const MovementState *)pOrigNode2->data;
+			if ((pMovement->signalGroup != pOrigMovement->signalGroup) ||
+				(pMovement->state_time_speed.count != pOrigMovement->state_time_speed.count))
+			{
+				printf("[BENCH] ERROR : SPAT movement %lu/%lu in place differs\n", (unsigned long)i, (unsigned long)j);
+				return HAE_ERROR;
+			}
+			pNode2 = (const OSRTDListNode *)ASN_FLAT_AT(pFlat, pNode2->next);
+			pOrigNode2 = pOrigNode2->next;
+		}
+		pNode = (const OSRTDListNode *)ASN_FLAT_AT(pFlat, pNode->next);
+		pOrigNode = pOrigNode->next;
+	}
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: sCorrupt
+ *
+ * Description	: Damaged copies of the block in bench_flat: random
+ *				  octets changed, or a pointer field set to another
+ *				  offset. A refused block is fine; one that relocates
+ *				  is encoded, compared and deep-copied, which walks
+ *				  all of it.
+ *
+ * Parameter	: pType, pDeep - type of the block
+ *				  len - its length
+ *
+ * Returns		: number of damaged blocks refused
+ *
+ *************************************************************/
+static unsigned long sCorrupt(const ASN_TYPE *pType, const ASN_DEEP_TYPE *pDeep, size_t len)
+{
+	static unsigned long long copy[BENCH_BUF_SIZE / 8];
+	unsigned long refusedCnt = 0;
+	size_t pos, outLen, off;
+	unsigned char *p = (unsigned char *)bench_recv;
+	void *pValue;
+	OSCTXT ctxt;
+	int n, k;
+
+	srand(len);
+	rtInitContext(&ctxt);
+	for (n = 0; n < BENCH_CORRUPT_CNT; n++)
+	{
+		memcpy(bench_recv, bench_flat, len);
+		if (0 == (n & 1))
+		{
+			for (k = 1 + rand() % 4; k > 0; k--)
+			{
+				p[sizeof(ASN_FLAT_HDR) + rand() % (len - sizeof(ASN_FLAT_HDR))] ^= (unsigned char)(1 + rand() % 255);
+			}
+		}
+		else
+		{
+			/* an aligned word that looks like an offset, pointed elsewhere */
+			pos = sizeof(ASN_FLAT_HDR) + (rand() % ((len - sizeof(ASN_FLAT_HDR)) / 8)) * 8;
+			off = (size_t)(rand() % len) & ~(size_t)((n & 2) ? 7 : 0);
+			memcpy(&p[pos], &off, sizeof(off));
+		}
+
+		if (HAE_NULL == (pValue = AsnFlat_Relocate(pDeep, bench_recv, len)))
+		{
+			refusedCnt++;
+			continue;
+		}
+		rtxMemReset(&ctxt);
+		sEncode(&ctxt, pType, pValue, bench_enc, &outLen);
+		AsnDeep_Compare(pDeep, pValue, pValue);
+		AsnDeep_Copy(pDeep, pValue, copy, sizeof(copy));
+	}
+	rtFreeContext(&ctxt);
+
+	return refusedCnt;
+}
+
+/*************************************************************
+ *
+ * Function 		: sCheckCapture
+ *
+ * Description	: sCheck on the value of every MessageFrame of a
+ *				  capture directory.
+ *
+ * Parameter	: pDir - capture directory
+ *				  offset - header octets before the MessageFrame
+ *
+ * Returns		: HAE_OK, HAE_ERROR if a check fails
+ *
+ *************************************************************/
+static int sCheckCapture(const char *pDir, int offset)
+{
+	CAPTURE_READER reader;
+	CAPTURE_RECORD record;
+	const ASN_DEEP_TYPE *pDeep;
+	const ASN_TYPE *pType;
+	MessageFrame frame;
+	unsigned long cnt = 0, skipCnt = 0, errorCnt = 0;
+	OSCTXT ctxt;
+
+	if (HAE_OK != CaptureLog_OpenReader(&reader, pDir))
+	{
+		return HAE_ERROR;
+	}
+	rtInitContext(&ctxt);
+	while (HAE_OK == CaptureLog_Next(&reader, &record))
+	{
+		rtxMemReset(&ctxt);
+		memset(&frame, 0, sizeof(frame));
+		if (record.len <= (unsigned int)offset)
+		{
+			skipCnt++;
+			continue;
+		}
+		pu_setBuffer(&ctxt, (OSOCTET *)record.pData + offset, record.len - offset, FALSE);
+		if ((0 != asn1PD_MessageFrame(&ctxt, &frame)) || (HAE_NULL == (pType = AsnType_FindMessage(frame.messageId))) ||
+			(HAE_NULL == (pDeep = AsnDeep_Find(pType->pName))))
+		{
+			skipCnt++;
+			continue;
+		}
+		if (HAE_OK != sCheck(HAE_NULL, pType, pDeep, frame.value.data, frame.value.numocts, 0))
+		{
+			errorCnt++;
+		}
+		cnt++;
+	}
+	rtFreeContext(&ctxt);
+	CaptureLog_CloseReader(&reader);
+
+	printf("capture %s: %lu values checked, %lu skipped, %lu failed\n", pDir, cnt, skipCnt, errorCnt);
+
+	return (0 == errorCnt) ? HAE_OK : HAE_ERROR;
+}
+
+static int sEncode(OSCTXT *pctxt, const ASN_TYPE *pType, void *pValue, unsigned char *pBuf, size_t *pLen)
+{
+	pu_setBuffer(pctxt, pBuf, BENCH_BUF_SIZE, FALSE);
+	if (0 != pType->pfPerEnc(pctxt, pValue))
+	{
+		return HAE_ERROR;
+	}
+	*pLen = pe_GetMsgLen(pctxt);
+
+	return HAE_OK;
+}
+
+/* a zeroed value of the context, the decoders need one */
+static void *sDecode(OSCTXT *pctxt, const ASN_TYPE *pType, const unsigned char *pData, size_t len)
+{
+	void *pValue = rtxMemAllocZ(pctxt, pType->size);
+
+	if (HAE_NULL == pValue)
+	{
+		return HAE_NULL;
+	}
+	pu_setBuffer(pctxt, (OSOCTET *)pData, len, FALSE);
+
+	return (0 == pType->pfPerDec(pctxt, pValue)) ? pValue : HAE_NULL;
+}
+
+static double sNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
@@ -0,0 +1,254 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "haeCommon.h"
+#include "itisText.h"
+
+#define BENCH_ITERCNT			200000L
+#define BENCH_PACK				"itis_ko.pack"
+#define BENCH_TEXT_SIZE			512
+
+/* typeEvent in both tables, then a code only the English table has,
+   then one neither has */
+#define RSA_EXPECT_EN			"in road construction area on bridges near the foothills 513"
+#define RSA_EXPECT_KO			"공사 구간 교량 위 near the foothills 513"
+/* advisory, then workZone; text items pass through as they are */
+#define TIM_EXPECT_EN			"in tunnels detour\nbuses ahead"
+#define TIM_EXPECT_KO			"터널 내 detour\n버스 ahead"
+
+static unsigned char rsa_data[BUFF_SIZE];
+static unsigned int rsa_len;
+static unsigned char tim_data[BUFF_SIZE];
+static unsigned int tim_len;
+
+static int sCheck(const char *pName, int len, const char *pText, const char *pExpect);
+static int sBuildSample(void);
+static double sNow(void);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: ITIS text rendering check and benchmark.
+ *				  A RoadSideAlert and a TravelerInformation with known
+ *				  ITIS codes and texts are encoded, decoded and rendered
+ *				  with the built-in English table and with the Korean
+ *				  pack; the texts must match the expected strings,
+ *				  including the fallbacks to English and to the number.
+ *				  Then TIM rendering is timed both ways.
+ *
+ * Parameter	: argv[1] - iterations
+ *				  argv[2] - pack, BENCH_PACK when absent ("make packs")
+ *
+ * Returns		: 0, 1 when a text differs or the pack does not load
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	long i;
+	long iterCnt = BENCH_ITERCNT;
+	int ret = HAE_OK;
+	int len;
+	size_t sum = 0;
+	double t0, t1;
+	const char *pPack = BENCH_PACK;
+	char text[BENCH_TEXT_SIZE];
+	char small[8];
+	OSCTXT ctxt;
+	RoadSideAlert rsa;
+	TravelerInformation tim;
+	ITIS_TABLE ko;
+
+	if (argc > 1)
+	{
+		iterCnt = atol(argv[1]);
+	}
+	if (argc > 2)
+	{
+		pPack = argv[2];
+	}
+
+	if (HAE_OK != sBuildSample())
+	{
+		return 1;
+	}
+
+	if (HAE_OK != ItisText_LoadPack(&ko, pPack))
+	{
+		printf("[BENCH] ERROR : %s did not load, run \"make packs\"\n", pPack);
+		return 1;
+	}
+
+	rtInitContext(&ctxt);
+
+	memset(&rsa, 0, sizeof(rsa));
+	pu_setBuffer(&ctxt, rsa_data, rsa_len, FALSE);
+	if (0 != asn1PD_RoadSideAlert(&ctxt, &rsa))
+	{
+		rtxErrPrint(&ctxt);
+		printf("[BENCH] ERROR : decode of RSA sample failed\n");
+		ret = HAE_ERROR;
+	}
+
+	memset(&tim, 0, sizeof(tim));
+	pu_setBuffer(&ctxt, tim_data, tim_len, FALSE);
+	if ((HAE_OK == ret) && (0 != asn1PD_TravelerInformation(&ctxt, &tim)))
+	{
+		rtxErrPrint(&ctxt);
+		printf("[BENCH] ERROR : decode of TIM sample failed\n");
+		ret = HAE_ERROR;
+	}
+
+	if (HAE_OK == ret)
+	{
+		len = ItisText_RenderRsa(HAE_NULL, &rsa, text, sizeof(text));
+		if (HAE_OK != sCheck("RSA en", len, text, RSA_EXPECT_EN)) ret = HAE_ERROR;
+		len = ItisText_RenderRsa(&ko, &rsa, text, sizeof(text));
+		if (HAE_OK != sCheck("RSA ko", len, text, RSA_EXPECT_KO)) ret = HAE_ERROR;
+		len = ItisText_RenderTim(HAE_NULL, &tim, text, sizeof(text));
+		if (HAE_OK != sCheck("TIM en", len, text, TIM_EXPECT_EN)) ret = HAE_ERROR;
+		len = ItisText_RenderTim(&ko, &tim, text, sizeof(text));
+		if (HAE_OK != sCheck("TIM ko", len, text, TIM_EXPECT_KO)) ret = HAE_ERROR;
+
+		/* snprintf semantics: full length back, truncated and terminated */
+		len = ItisText_RenderTim(HAE_NULL, &tim, small, sizeof(small));
+		if ((len != (int)strlen(TIM_EXPECT_EN)) || (0 != strncmp(small, TIM_EXPECT_EN, sizeof(small) - 1))
+			|| ('\0' != small[sizeof(small) - 1]))
+		{
+			printf("[BENCH] ERROR : TIM truncated to %zu bytes gives %d \"%s\"\n", sizeof(small), len, small);
+			ret = HAE_ERROR;
+		}
+	}
+
+	if (HAE_OK == ret)
+	{
+		printf("RSA / TIM texts match, en and ko\n");
+
+		t0 = sNow();
+		for (i = 0; i < iterCnt; i++)
+		{
+			sum += ItisText_RenderTim(HAE_NULL, &tim, text, sizeof(text));
+		}
+		t1 = sNow();
+		printf("TIM render en          : %8.1f ns/op\n", (t1 - t0) * 1e9 / iterCnt);
+
+		t0 = sNow();
+		for (i = 0; i < iterCnt; i++)
+		{
+			sum += ItisText_RenderTim(&ko, &tim, text, sizeof(text));
+		}
+		t1 = sNow();
+		printf("TIM render ko          : %8.1f ns/op\n", (t1 - t0) * 1e9 / iterCnt);
+		printf("%zu bytes rendered\n", sum);
+	}
+
+	rtFreeContext(&ctxt);
+	ItisText_UnloadPack(&ko);
+
+	return (HAE_OK == ret) ? 0 : 1;
+}
+
+static int sCheck(const char *pName, int len, const char *pText, const char *pExpect)
+{
+	if ((len != (int)strlen(pExpect)) || (0 != strcmp(pText, pExpect)))
+	{
+		printf("[BENCH] ERROR : %s gives \"%s\" (%d), expected \"%s\"\n", pName, pText, len, pExpect);
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+/* RoadSideAlert with typeEvent + description, TravelerInformation from
+   asn1Test_TravelerInformation with its frames replaced by an advisory
+   and a workZone frame */
+static int sBuildSample(void)
+{
+	int stat;
+	OSCTXT ctxt;
+	RoadSideAlert rsa;
+	TravelerInformation *pTim;
+	TravelerDataFrame *pAdvisory, *pWorkZone;
+	ITIScodesAndText_element *pAdvElem;
+	WorkZone_element *pWzElem;
+
+	rtInitContext(&ctxt);
+
+	memset(&rsa, 0, sizeof(rsa));
+	rsa.msgCnt = 1;
+	rsa.typeEvent = in_road_construction_area;
+	rsa.m.descriptionPresent = 1;
+	rsa.description.n = 3;
+	rsa.description.elem[0] = on_bridges;
+	rsa.description.elem[1] = near_the_foothills;
+	rsa.description.elem[2] = 513;
+
+	pu_setBuffer(&ctxt, rsa_data, sizeof(rsa_data), FALSE);
+	stat = asn1PE_RoadSideAlert(&ctxt, &rsa);
+	rsa_len = (unsigned int)pe_GetMsgLen(&ctxt);
+
+	if (0 == stat)
+	{
+		pTim = asn1Test_TravelerInformation(&ctxt);
+		pAdvisory = rtxMemAllocTypeZ(&ctxt, TravelerDataFrame);
+		pWorkZone = rtxMemAllocTypeZ(&ctxt, TravelerDataFrame);
+		*pAdvisory = *(TravelerDataFrame *)pTim->dataFrames.head->data;
+		*pWorkZone = *pAdvisory;
+
+		pAdvisory->content.t = T_TravelerDataFrame_content_advisory;
+		pAdvisory->content.u.advisory = rtxMemAllocTypeZ(&ctxt, ITIScodesAndText);
+		rtxDListInit(pAdvisory->content.u.advisory);
+		pAdvElem = rtxMemAllocTypeZ(&ctxt, ITIScodesAndText_element);
+		pAdvElem->item.t = T_ITIScodesAndText_element_item_itis;
+		pAdvElem->item.u.itis = in_tunnels;
+		rtxDListAppend(&ctxt, pAdvisory->content.u.advisory, pAdvElem);
+		pAdvElem = rtxMemAllocTypeZ(&ctxt, ITIScodesAndText_element);
+		pAdvElem->item.t = T_ITIScodesAndText_element_item_text;
+		pAdvElem->item.u.text = (const OSUTF8CHAR *)"detour";
+		rtxDListAppend(&ctxt, pAdvisory->content.u.advisory, pAdvElem);
+
+		pWorkZone->content.t = T_TravelerDataFrame_content_workZone;
+		pWorkZone->content.u.workZone = rtxMemAllocTypeZ(&ctxt, WorkZone);
+		rtxDListInit(pWorkZone->content.u.workZone);
+		pWzElem = rtxMemAllocTypeZ(&ctxt, WorkZone_element);
+		pWzElem->item.t = T_WorkZone_element_item_itis;
+		pWzElem->item.u.itis = buses;
+		rtxDListAppend(&ctxt, pWorkZone->content.u.workZone, pWzElem);
+		pWzElem = rtxMemAllocTypeZ(&ctxt, WorkZone_element);
+		pWzElem->item.t = T_WorkZone_element_item_text;
+		pWzElem->item.u.text = "ahead";
+		rtxDListAppend(&ctxt, pWorkZone->content.u.workZone, pWzElem);
+
+		rtxDListInit(&pTim->dataFrames);
+		rtxDListAppend(&ctxt, &pTim->dataFrames, pAdvisory);
+		rtxDListAppend(&ctxt, &pTim->dataFrames, pWorkZone);
+
+		pu_setBuffer(&ctxt, tim_data, sizeof(tim_data), FALSE);
+		stat = asn1PE_TravelerInformation(&ctxt, pTim);
+		tim_len = (unsigned int)pe_GetMsgLen(&ctxt);
+	}
+
+	if (0 != stat)
+	{
+		rtxErrPrint(&ctxt);
+		printf("[BENCH] ERROR : encode of ITIS samples failed\n");
+	}
+
+	rtFreeContext(&ctxt);
+
+	return (0 == stat) ? HAE_OK : HAE_ERROR;
+}
+
+static double sNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
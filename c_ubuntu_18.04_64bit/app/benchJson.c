@@ -0,0 +1,228 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <arpa/inet.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "jsonExport.h"
+
+#define BENCH_MSGCNT			200000L
+#define BENCH_BUF_SIZE			65536
+#define BENCH_TARGET_RATE		20000.0		/* msg/s the export has to sustain */
+
+/* roadside traffic mix of one intersection, frames per second */
+typedef struct{
+	unsigned int messageId;
+	unsigned int perSecond;
+} BENCH_MIX;
+
+static const BENCH_MIX bench_mix[] =
+{
+	{ ASN1V_basicSafetyMessage, 3000 },			/* 300 vehicles, 10 Hz */
+	{ ASN1V_signalPhaseAndTimingMessage, 80 },	/* 8 controllers, 10 Hz */
+	{ ASN1V_mapData, 8 },
+	{ ASN1V_personalSafetyMessage, 40 },
+	{ ASN1V_signalRequestMessage, 2 },
+	{ ASN1V_signalStatusMessage, 8 },
+	{ ASN1V_travelerInformation, 1 },
+	{ ASN1V_probeVehicleData, 10 },
+	{ ASN1V_emergencyVehicleAlert, 1 },
+	{ ASN1V_rtcmCorrections, 1 },
+};
+
+#define BENCH_MIX_CNT			(sizeof(bench_mix) / sizeof(bench_mix[0]))
+
+typedef struct{
+	const ASN_TYPE *pType;
+	unsigned int messageId;
+	size_t perLen;						/* UPER MessageFrame */
+	unsigned char per[BENCH_BUF_SIZE];
+} BENCH_FRAME;
+
+static BENCH_FRAME bench_frame[BENCH_MIX_CNT];
+static unsigned char value_buf[BENCH_BUF_SIZE];
+
+static int sBuildFrame(BENCH_FRAME *pFrame);
+static int sExport(JSON_EXPORT *pExp, OSCTXT *pctxt, const BENCH_FRAME *pFrame, const struct sockaddr_in *pSource);
+static double sNow(void);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: JSON export of the traffic mix: every message is
+ *				  UPER decoded from its MessageFrame and exported,
+ *				  the way the receive loop does it, with the writer
+ *				  thread writing to the target. The messages are
+ *				  interleaved in the proportions of bench_mix.
+ *
+ * Parameter	: argv[1] - target (default /dev/null)
+ *				  argv[2] - messages
+ *
+ * Returns		: 0, 1 on error or below BENCH_TARGET_RATE
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	const char *pTarget = "/dev/null";
+	long msgCnt = BENCH_MSGCNT, n = 0;
+	unsigned int i, frameCnt = 0, total = 0;
+	unsigned int schedule[BENCH_MIX_CNT];
+	unsigned int credit[BENCH_MIX_CNT];
+	double t0, t1, tPrint, rate;
+	struct sockaddr_in source;
+	JSON_EXPORT exp;
+	OSCTXT ctxt;
+
+	if (argc > 1)
+	{
+		pTarget = argv[1];
+	}
+	if (argc > 2)
+	{
+		msgCnt = atol(argv[2]);
+	}
+
+	for (i = 0; i < BENCH_MIX_CNT; i++)
+	{
+		bench_frame[frameCnt].messageId = bench_mix[i].messageId;
+		if (HAE_OK != sBuildFrame(&bench_frame[frameCnt]))
+		{
+			return 1;
+		}
+		if (HAE_NULL != bench_frame[frameCnt].pType)
+		{
+			schedule[frameCnt] = bench_mix[i].perSecond;
+			credit[frameCnt] = 0;
+			total += bench_mix[i].perSecond;
+			frameCnt++;
+		}
+	}
+
+	memset(&source, 0x00, sizeof(source));
+	source.sin_family = AF_INET;
+	source.sin_addr.s_addr = htonl(0x0a000005);
+	source.sin_port = htons(60000);
+
+	if (HAE_OK != JsonExport_Open(&exp, pTarget))
+	{
+		return 1;
+	}
+	rtInitContext(&ctxt);
+
+	/* weighted round robin over the mix */
+	t0 = sNow();
+	while (n < msgCnt)
+	{
+		for (i = 0; (i < frameCnt) && (n < msgCnt); i++)
+		{
+			credit[i] += schedule[i];
+			while ((credit[i] >= total / 10) && (n < msgCnt))
+			{
+				credit[i] -= total / 10;
+				if (HAE_OK != sExport(&exp, &ctxt, &bench_frame[i], &source))
+				{
+					break;
+				}
+				n++;
+			}
+		}
+	}
+	t1 = sNow();
+	JsonExport_Close(&exp);
+	tPrint = sNow();
+
+	rate = n / (t1 - t0);
+	printf("json export : %ld messages in %.3f s, %.0f msg/s (target %.0f), %.2f us/msg\n",
+		n, t1 - t0, rate, BENCH_TARGET_RATE, (t1 - t0) * 1e6 / n);
+	printf("json export : %llu bytes written, %.0f bytes/record, %lu dropped, %lu errors, close %.3f s\n",
+		exp.writeBytes, (double)exp.writeBytes / n, exp.dropCnt, exp.errorCnt + exp.writeErrorCnt, tPrint - t1);
+
+	rtFreeContext(&ctxt);
+
+	return ((0 == exp.errorCnt) && (0 == exp.dropCnt) && (rate >= BENCH_TARGET_RATE)) ? 0 : 1;
+}
+
+static int sBuildFrame(BENCH_FRAME *pFrame)
+{
+	int ret = HAE_ERROR;
+	void *pValue;
+	MessageFrame frame;
+	OSCTXT ctxt;
+
+	pFrame->pType = AsnType_FindMessage(pFrame->messageId);
+	if ((HAE_NULL == pFrame->pType) || (0 == pFrame->pType->pfTest))
+	{
+		/* no test value in the library (RoadSideAlert) */
+		pFrame->pType = HAE_NULL;
+		return HAE_OK;
+	}
+
+	rtInitContext(&ctxt);
+	pValue = pFrame->pType->pfTest(&ctxt);
+
+	memset(&frame, 0x00, sizeof(frame));
+	frame.messageId = (DSRCmsgID)pFrame->messageId;
+	pu_setBuffer(&ctxt, value_buf, sizeof(value_buf), FALSE);
+	if ((HAE_NULL == pValue) || (0 != pFrame->pType->pfPerEnc(&ctxt, pValue)))
+	{
+		printf("[BENCH] ERROR : %s UPER encode of the test value\n", pFrame->pType->pName);
+		goto END;
+	}
+	frame.value.data = value_buf;
+	frame.value.numocts = pe_GetMsgLen(&ctxt);
+	pu_setBuffer(&ctxt, pFrame->per, sizeof(pFrame->per), FALSE);
+	if (0 != asn1PE_MessageFrame(&ctxt, &frame))
+	{
+		printf("[BENCH] ERROR : %s UPER MessageFrame\n", pFrame->pType->pName);
+		goto END;
+	}
+	pFrame->perLen = pe_GetMsgLen(&ctxt);
+
+	ret = HAE_OK;
+
+END:
+	rtFreeContext(&ctxt);
+
+	return ret;
+}
+
+/* receive loop: MessageFrame and value decode, then export */
+static int sExport(JSON_EXPORT *pExp, OSCTXT *pctxt, const BENCH_FRAME *pFrame, const struct sockaddr_in *pSource)
+{
+	struct timespec rx;
+	MessageFrame frame;
+	void *pValue;
+
+	clock_gettime(CLOCK_REALTIME, &rx);
+
+	rtxMemReset(pctxt);
+	memset(&frame, 0x00, sizeof(frame));
+	pValue = rtxMemAllocZ(pctxt, pFrame->pType->size);
+	pu_setBuffer(pctxt, (OSOCTET *)pFrame->per, pFrame->perLen, FALSE);
+	asn1PD_MessageFrame(pctxt, &frame);
+	pu_setBuffer(pctxt, (OSOCTET *)frame.value.data, frame.value.numocts, FALSE);
+	if ((HAE_NULL == pValue) || (0 != pFrame->pType->pfPerDec(pctxt, pValue)))
+	{
+		rtxErrPrint(pctxt);
+		return HAE_ERROR;
+	}
+
+	JsonExport_Message(pExp, frame.messageId, pFrame->pType, pValue, frame.value.numocts, &rx, pSource);
+
+	return HAE_OK;
+}
+
+static double sNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
@@ -0,0 +1,230 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <time.h>
+
+#include "haeCommon.h"
+#include "asnList.h"
+
+#define BENCH_ITERCNT			20000L
+#define BENCH_EVENT_CNT			255			/* longer than a real MovementEventList, only walked */
+
+static double sNow(void);
+
+/*************************************************************
+ *
+ * Function 		: sSumHand
+ *
+ * Description	: minEndTime of every event, walked as parseSpat
+ *				  does it.
+ *
+ * Parameter	: list - MovementEventList
+ *
+ * Returns		: the sum
+ *
+ *************************************************************/
+static unsigned long sSumHand(const MovementEventList &list)
+{
+	const OSRTDList *plist = &list;
+	OSUINT32 xx = 0;
+	OSRTDListNode *pnode;
+	MovementEvent *pevent;
+	unsigned long sum = 0;
+
+	for (pnode = plist->head; pnode != 0 && xx < plist->count; pnode = pnode->next)
+	{
+		pevent = (MovementEvent *)pnode->data;
+		sum += pevent->timing.minEndTime;
+		xx++;
+	}
+	return sum;
+}
+
+static unsigned long sSumView(const MovementEventList &list)
+{
+	unsigned long sum = 0;
+
+	for (const MovementEvent &event : hae::MovementEventList_view(list))
+	{
+		sum += event.timing.minEndTime;
+	}
+	return sum;
+}
+
+static unsigned long sSumFlatten(const MovementEventList &list)
+{
+	hae::span<const MovementEvent *const> events = hae::flatten(hae::MovementEventList_view(list));
+	unsigned long sum = 0;
+
+	for (std::size_t i = 0; i < events.size(); i++)
+	{
+		sum += events[i]->timing.minEndTime;
+	}
+	return sum;
+}
+
+static unsigned long sSumCopy(const MovementEventList &list)
+{
+	hae::span<const MovementEvent> events = hae::flattenCopy(hae::MovementEventList_view(list));
+	unsigned long sum = 0;
+
+	for (const MovementEvent &event : events)
+	{
+		sum += event.timing.minEndTime;
+	}
+	return sum;
+}
+
+/*************************************************************
+ *
+ * Function 		: sCountSpat
+ *
+ * Description	: Intersections, movements and events of a SPaT, by
+ *				  hand and through the views; both counts must match.
+ *
+ * Parameter	: pSpat - value
+ *				  pHand - [intersections, movements, events] by hand
+ *				  pView - the same through the views
+ *
+ * Returns		: none
+ *
+ *************************************************************/
+static void sCountSpat(const SPAT *pSpat, unsigned long *pHand, unsigned long *pView)
+{
+	OSUINT32 xx1 = 0, xx2, xx3;
+	OSRTDListNode *pnode, *pnode2, *pnode3;
+	IntersectionState *pdata;
+	MovementState *pmovement;
+
+	for (pnode = pSpat->intersections.head; pnode != 0 && xx1 < pSpat->intersections.count; pnode = pnode->next)
+	{
+		pdata = (IntersectionState *)pnode->data;
+		pHand[0]++;
+		xx2 = 0;
+		for (pnode2 = pdata->states.head; pnode2 != 0 && xx2 < pdata->states.count; pnode2 = pnode2->next)
+		{
+			pmovement = (MovementState *)pnode2->data;
+			pHand[1]++;
+			xx3 = 0;
+			for (pnode3 = pmovement->state_time_speed.head; pnode3 != 0 && xx3 < pmovement->state_time_speed.count;
+				pnode3 = pnode3->next)
+			{
+				pHand[2]++;
+				xx3++;
+			}
+			xx2++;
+		}
+		xx1++;
+	}
+
+	for (const IntersectionState &intersection : hae::IntersectionStateList_view(pSpat->intersections))
+	{
+		pView[0]++;
+		for (const MovementState &movement : hae::MovementList_view(intersection.states))
+		{
+			pView[1]++;
+			pView[2] += hae::MovementEventList_view(movement.state_time_speed).size();
+		}
+	}
+}
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: Walking an OSRTDList sequence by hand (parseSpat),
+ *				  through hae::dlist_view, and through flatten() /
+ *				  flattenCopy() into the thread scratch array, on a
+ *				  MovementEventList of BENCH_EVENT_CNT events. All
+ *				  four must give the same sum, and the views must
+ *				  count the asn1Test_SPAT value like the hand loop.
+ *
+ * Parameter	: argv[1] - walks per variant
+ *
+ * Returns		: 0, 1 if a check fails
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	long iterCnt = BENCH_ITERCNT, i;
+	unsigned long (*pfSum[4])(const MovementEventList &) = { sSumHand, sSumView, sSumFlatten, sSumCopy };
+	const char *pName[4] = { "hand", "dlist_view", "flatten", "flattenCopy" };
+	unsigned long hand[3] = { 0, 0, 0 }, view[3] = { 0, 0, 0 };
+	unsigned long expect, sum;
+	MovementEventList list;
+	MovementEvent *pEvent;
+	volatile unsigned long sink = 0;
+	OSCTXT ctxt;
+	SPAT *pSpat;
+	double start;
+	int n, ret = 0;
+
+	if (argc > 1)
+	{
+		iterCnt = atol(argv[1]);
+	}
+	if (iterCnt <= 0)
+	{
+		printf("[BENCH] ERROR : iterations %s\n", argv[1]);
+		return 1;
+	}
+
+	rtInitContext(&ctxt);
+	rtxDListInit(&list);
+	for (n = 0; n < BENCH_EVENT_CNT; n++)
+	{
+		pEvent = rtxMemAllocTypeZ(&ctxt, MovementEvent);
+		pEvent->timing.minEndTime = (TimeMark)(n * 7 % 36001);
+		rtxDListAppend(&ctxt, &list, pEvent);
+	}
+	expect = sSumHand(list);
+
+	printf("%-12s %10s\n", "walk", "ns/event");
+	for (n = 0; n < 4; n++)
+	{
+		sum = pfSum[n](list);
+		if (sum != expect)
+		{
+			printf("[BENCH] ERROR : %s sum %lu, expected %lu\n", pName[n], sum, expect);
+			ret = 1;
+			continue;
+		}
+		start = sNow();
+		for (i = 0; i < iterCnt; i++)
+		{
+			sink += pfSum[n](list);
+		}
+		printf("%-12s %10.2f\n", pName[n], (sNow() - start) / iterCnt / BENCH_EVENT_CNT);
+	}
+
+	if (HAE_NULL == (pSpat = asn1Test_SPAT(&ctxt)))
+	{
+		printf("[BENCH] ERROR : no value for SPaT\n");
+		ret = 1;
+	}
+	else
+	{
+		sCountSpat(pSpat, hand, view);
+		if (0 != memcmp(hand, view, sizeof(hand)))
+		{
+			printf("[BENCH] ERROR : SPaT walk %lu/%lu/%lu by hand, %lu/%lu/%lu by view\n", hand[0], hand[1], hand[2],
+				view[0], view[1], view[2]);
+			ret = 1;
+		}
+		printf("SPaT test value: %lu intersections, %lu movements, %lu events\n", view[0], view[1], view[2]);
+	}
+	rtFreeContext(&ctxt);
+
+	return ret;
+}
+
+static double sNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
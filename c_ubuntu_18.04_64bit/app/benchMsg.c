@@ -0,0 +1,520 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+#include <rtbersrc/asn1ber.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "jsonExport.h"
+
+#define BENCH_ITERCNT			2000L
+#define BENCH_BUF_SIZE			65536
+#define BENCH_RESULT_FILE		"benchMsg.json"
+
+#define BENCH_ENC_UPER			0
+#define BENCH_ENC_OER			1
+#define BENCH_ENC_BER			2
+#define BENCH_ENC_XER			3
+#define BENCH_ENC_JSON			4
+#define BENCH_ENC_CNT			5
+
+#define BENCH_VALUE_TEST		0			/* asn1Test_* of the library */
+#define BENCH_VALUE_NO_PART2	1			/* test value, BSM partII left out */
+#define BENCH_VALUE_RSA			2			/* the library has no asn1Test_RoadSideAlert */
+
+typedef struct{
+	const char *pName;
+	unsigned int messageId;
+	int value;							/* BENCH_VALUE_* */
+} BENCH_SAMPLE;
+
+static const BENCH_SAMPLE bench_sample[] =
+{
+	{ "SPaT", ASN1V_signalPhaseAndTimingMessage, BENCH_VALUE_TEST },
+	{ "MAP", ASN1V_mapData, BENCH_VALUE_TEST },
+	{ "BSM", ASN1V_basicSafetyMessage, BENCH_VALUE_TEST },
+	{ "BSM-noPartII", ASN1V_basicSafetyMessage, BENCH_VALUE_NO_PART2 },
+	{ "TIM", ASN1V_travelerInformation, BENCH_VALUE_TEST },
+	{ "RSA", ASN1V_roadSideAlert, BENCH_VALUE_RSA },
+	{ "RTCM", ASN1V_rtcmCorrections, BENCH_VALUE_TEST },
+	{ "SRM", ASN1V_signalRequestMessage, BENCH_VALUE_TEST },
+	{ "SSM", ASN1V_signalStatusMessage, BENCH_VALUE_TEST },
+	{ "PSM", ASN1V_personalSafetyMessage, BENCH_VALUE_TEST },
+	{ "PVD", ASN1V_probeVehicleData, BENCH_VALUE_TEST },
+};
+
+static const char *bench_enc_name[BENCH_ENC_CNT] = { "UPER", "OER", "BER", "XER", "JSON" };
+
+typedef struct{
+	int supported;
+	size_t bytes;
+	double encNs;
+	double decNs;						/* < 0: no decoder */
+	double encAllocs;					/* runtime allocations per op */
+	double decAllocs;
+	size_t decHeapBytes;				/* runtime heap of one decode in a new context */
+} BENCH_RESULT;
+
+static unsigned long bench_alloc_cnt = 0;
+static unsigned long long bench_heap_bytes = 0;
+
+static unsigned char enc_buf[BENCH_BUF_SIZE];
+static unsigned char out_buf[BENCH_BUF_SIZE];
+
+static void *sBuildValue(OSCTXT *pctxt, const BENCH_SAMPLE *pSample, const ASN_TYPE *pType);
+static int sEncode(OSCTXT *pctxt, const BENCH_SAMPLE *pSample, const ASN_TYPE *pType, int enc, void *pValue,
+	unsigned char *pBuf, const unsigned char **ppData, size_t *pLen);
+static int sDecode(OSCTXT *pctxt, const BENCH_SAMPLE *pSample, const ASN_TYPE *pType, int enc,
+	const unsigned char *pData, size_t len, void *pValue);
+static int sBenchCodec(const BENCH_SAMPLE *pSample, const ASN_TYPE *pType, int enc, void *pValue, long iterCnt,
+	BENCH_RESULT *pResult);
+static int sBenchJson(const BENCH_SAMPLE *pSample, const ASN_TYPE *pType, void *pValue, long iterCnt, BENCH_RESULT *pResult);
+static void sWriteResult(FILE *pFile, const BENCH_SAMPLE *pSample, int enc, const BENCH_RESULT *pResult, long iterCnt);
+static double sNow(void);
+static void *sMalloc(OSSIZE size);
+static void *sRealloc(void *ptr, OSSIZE size);
+static void sFree(void *ptr);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: Encode / decode cost of every DSRC message type in
+ *				  UPER, OER, BER, XER and JSON: ns/op, runtime
+ *				  allocations/op and encoded bytes, timed with
+ *				  CLOCK_MONOTONIC. Each encoding is checked first:
+ *				  decode and re-encode must give the same octets.
+ *				  One JSON line per message and encoding goes to the
+ *				  result file, for tracking regressions run to run.
+ *
+ *				  The library has no XER codecs (XER lines have
+ *				  "supported":false) and no JSON decoder; JSON encode
+ *				  is the JsonExport record, written to /dev/null.
+ *
+ * Parameter	: argv[1] - iterations per message and encoding
+ *				  argv[2] - result file (default benchMsg.json)
+ *
+ * Returns		: 0, 1 if a check fails
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	unsigned int i;
+	int enc, ret = 0;
+	long iterCnt = BENCH_ITERCNT;
+	const char *pPath = BENCH_RESULT_FILE;
+	const ASN_TYPE *pType;
+	void *pValue;
+	BENCH_RESULT result;
+	OSCTXT ctxt;
+	FILE *pFile;
+
+	if (argc > 1)
+	{
+		iterCnt = atol(argv[1]);
+	}
+	if (argc > 2)
+	{
+		pPath = argv[2];
+	}
+
+	/* before the first context, counts what the runtime allocates */
+	rtxMemSetAllocFuncs(sMalloc, sRealloc, sFree);
+
+	if (HAE_NULL == (pFile = fopen(pPath, "w")))
+	{
+		printf("[BENCH] ERROR : cannot create %s\n", pPath);
+		return 1;
+	}
+	rtInitContext(&ctxt);
+
+	printf("%-14s %-5s %6s %10s %10s %9s %9s %8s\n", "message", "enc", "bytes", "encode", "decode", "enc alloc",
+		"dec alloc", "dec heap");
+	for (i = 0; i < sizeof(bench_sample) / sizeof(bench_sample[0]); i++)
+	{
+		pType = AsnType_FindMessage(bench_sample[i].messageId);
+		if ((HAE_NULL == pType) || (HAE_NULL == (pValue = sBuildValue(&ctxt, &bench_sample[i], pType))))
+		{
+			printf("[BENCH] ERROR : no value for %s\n", bench_sample[i].pName);
+			ret = 1;
+			continue;
+		}
+
+		for (enc = 0; enc < BENCH_ENC_CNT; enc++)
+		{
+			memset(&result, 0x00, sizeof(result));
+			result.decNs = -1;
+			if (BENCH_ENC_JSON == enc)
+			{
+				ret |= sBenchJson(&bench_sample[i], pType, pValue, iterCnt, &result);
+			}
+			else if (BENCH_ENC_XER != enc)
+			{
+				ret |= sBenchCodec(&bench_sample[i], pType, enc, pValue, iterCnt, &result);
+			}
+
+			if (HAE_TRUE != result.supported)
+			{
+				printf("%-14s %-5s %6s\n", bench_sample[i].pName, bench_enc_name[enc], "n/a");
+			}
+			else if (result.decNs < 0)
+			{
+				printf("%-14s %-5s %6zu %7.0f ns %10s %9.1f\n", bench_sample[i].pName, bench_enc_name[enc],
+					result.bytes, result.encNs, "n/a", result.encAllocs);
+			}
+			else
+			{
+				printf("%-14s %-5s %6zu %7.0f ns %7.0f ns %9.1f %9.1f %8zu\n", bench_sample[i].pName, bench_enc_name[enc],
+					result.bytes, result.encNs, result.decNs, result.encAllocs, result.decAllocs, result.decHeapBytes);
+			}
+			sWriteResult(pFile, &bench_sample[i], enc, &result, iterCnt);
+		}
+	}
+
+	rtFreeContext(&ctxt);
+	if (0 != fclose(pFile))
+	{
+		printf("[BENCH] ERROR : cannot write %s\n", pPath);
+		ret = 1;
+	}
+	printf("results in %s\n", pPath);
+
+	return ret;
+}
+
+static void *sBuildValue(OSCTXT *pctxt, const BENCH_SAMPLE *pSample, const ASN_TYPE *pType)
+{
+	BasicSafetyMessage *pBsm;
+	RoadSideAlert *pRsa;
+
+	switch (pSample->value)
+	{
+		case BENCH_VALUE_TEST:
+			return (0 != pType->pfTest) ? pType->pfTest(pctxt) : HAE_NULL;
+
+		case BENCH_VALUE_NO_PART2:
+			pBsm = (BasicSafetyMessage *)pType->pfTest(pctxt);
+			if (HAE_NULL != pBsm)
+			{
+				pBsm->m.partIIPresent = 0;
+			}
+			return pBsm;
+
+		case BENCH_VALUE_RSA:
+			/* a work zone alert with position and extent */
+			pRsa = rtxMemAllocTypeZ(pctxt, RoadSideAlert);
+			if (HAE_NULL == pRsa)
+			{
+				return HAE_NULL;
+			}
+			pRsa->msgCnt = 12;
+			pRsa->m.timeStampPresent = 1;
+			pRsa->timeStamp = 421234;
+			pRsa->typeEvent = 1025;					/* road construction */
+			pRsa->m.descriptionPresent = 1;
+			pRsa->description.n = 2;
+			pRsa->description.elem[0] = 7186;		/* lane closed */
+			pRsa->description.elem[1] = 8720;		/* reduce speed */
+			pRsa->m.priorityPresent = 1;
+			pRsa->priority.numocts = 1;
+			pRsa->priority.data[0] = 0x05;
+			pRsa->m.headingPresent = 1;
+			pRsa->heading.numbits = 16;
+			pRsa->heading.data[0] = 0x0f;
+			pRsa->heading.data[1] = 0x00;
+			pRsa->m.extentPresent = 1;
+			pRsa->extent = useFor500meters;
+			pRsa->m.positionPresent = 1;
+			pRsa->position.long_ = 1270271230;
+			pRsa->position.lat = 374981230;
+			pRsa->position.m.elevationPresent = 1;
+			pRsa->position.elevation = 421;
+			pRsa->position.m.headingPresent = 1;
+			pRsa->position.heading = 7200;
+			pRsa->m.furtherInfoIDPresent = 1;
+			pRsa->furtherInfoID.numocts = 2;
+			pRsa->furtherInfoID.data[0] = 0x12;
+			pRsa->furtherInfoID.data[1] = 0x34;
+			return pRsa;
+
+		default:
+			return HAE_NULL;
+	}
+}
+
+/* the encoding of pValue in pBuf, *ppData where it starts (BER encodes
+   from the end of the buffer) */
+static int sEncode(OSCTXT *pctxt, const BENCH_SAMPLE *pSample, const ASN_TYPE *pType, int enc, void *pValue,
+	unsigned char *pBuf, const unsigned char **ppData, size_t *pLen)
+{
+	int len;
+
+	switch (enc)
+	{
+		case BENCH_ENC_UPER:
+			pu_setBuffer(pctxt, pBuf, BENCH_BUF_SIZE, FALSE);
+			if (0 != pType->pfPerEnc(pctxt, pValue))
+			{
+				return HAE_ERROR;
+			}
+			*ppData = pBuf;
+			*pLen = pe_GetMsgLen(pctxt);
+			return HAE_OK;
+
+		case BENCH_ENC_OER:
+			rtxInitContextBuffer(pctxt, pBuf, BENCH_BUF_SIZE);
+			if (0 != pType->pfOerEnc(pctxt, pValue))
+			{
+				return HAE_ERROR;
+			}
+			*ppData = pBuf;
+			*pLen = rtxCtxtGetMsgLen(pctxt);
+			return HAE_OK;
+
+		case BENCH_ENC_BER:
+			xe_setp(pctxt, pBuf, BENCH_BUF_SIZE);
+			if ((len = pType->pfBerEnc(pctxt, pValue)) <= 0)
+			{
+				return HAE_ERROR;
+			}
+			*ppData = xe_getp(pctxt);
+			*pLen = len;
+			return HAE_OK;
+
+		default:
+			return HAE_ERROR;
+	}
+}
+
+static int sDecode(OSCTXT *pctxt, const BENCH_SAMPLE *pSample, const ASN_TYPE *pType, int enc,
+	const unsigned char *pData, size_t len, void *pValue)
+{
+	switch (enc)
+	{
+		case BENCH_ENC_UPER:
+			pu_setBuffer(pctxt, (OSOCTET *)pData, len, FALSE);
+			return (0 == pType->pfPerDec(pctxt, pValue)) ? HAE_OK : HAE_ERROR;
+
+		case BENCH_ENC_OER:
+			rtxInitContextBuffer(pctxt, (OSOCTET *)pData, len);
+			return (0 == pType->pfOerDec(pctxt, pValue)) ? HAE_OK : HAE_ERROR;
+
+		case BENCH_ENC_BER:
+			xd_setp(pctxt, pData, (int)len, HAE_NULL, HAE_NULL);
+			return (0 == pType->pfBerDec(pctxt, pValue)) ? HAE_OK : HAE_ERROR;
+
+		default:
+			return HAE_ERROR;
+	}
+}
+
+/* UPER, OER, BER: check decode / re-encode, then time both ways */
+static int sBenchCodec(const BENCH_SAMPLE *pSample, const ASN_TYPE *pType, int enc, void *pValue, long iterCnt,
+	BENCH_RESULT *pResult)
+{
+	int ret = HAE_ERROR;
+	long i;
+	double t0, t1;
+	size_t len, outLen;
+	unsigned long allocCnt;
+	unsigned long long heap;
+	const unsigned char *pData, *pOut;
+	void *pDecoded;
+	OSCTXT ctxt;
+
+	rtInitContext(&ctxt);
+
+	if (HAE_OK != sEncode(&ctxt, pSample, pType, enc, pValue, enc_buf, &pData, &len))
+	{
+		printf("[BENCH] ERROR : %s %s encode\n", pSample->pName, bench_enc_name[enc]);
+		rtxErrPrint(&ctxt);
+		goto END;
+	}
+	if (pData != enc_buf)
+	{
+		memmove(enc_buf, pData, len);
+		pData = enc_buf;
+	}
+
+	/* runtime heap of one decode, the way a receiver decodes */
+	rtFreeContext(&ctxt);
+	rtInitContext(&ctxt);
+	heap = bench_heap_bytes;
+	pDecoded = rtxMemAllocZ(&ctxt, pType->size);
+	if ((HAE_NULL == pDecoded) || (HAE_OK != sDecode(&ctxt, pSample, pType, enc, pData, len, pDecoded)))
+	{
+		printf("[BENCH] ERROR : %s %s decode\n", pSample->pName, bench_enc_name[enc]);
+		rtxErrPrint(&ctxt);
+		goto END;
+	}
+	pResult->decHeapBytes = bench_heap_bytes - heap;
+	if ((HAE_OK != sEncode(&ctxt, pSample, pType, enc, pDecoded, out_buf, &pOut, &outLen)) ||
+		(outLen != len) || (0 != memcmp(pOut, pData, len)))
+	{
+		printf("[BENCH] ERROR : %s %s decode / re-encode does not give the octets back\n", pSample->pName,
+			bench_enc_name[enc]);
+		goto END;
+	}
+
+	allocCnt = bench_alloc_cnt;
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		sEncode(&ctxt, pSample, pType, enc, pValue, out_buf, &pOut, &outLen);
+	}
+	t1 = sNow();
+	pResult->encNs = (t1 - t0) * 1e9 / iterCnt;
+	pResult->encAllocs = (double)(bench_alloc_cnt - allocCnt) / iterCnt;
+
+	allocCnt = bench_alloc_cnt;
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		rtxMemReset(&ctxt);
+		pDecoded = rtxMemAllocZ(&ctxt, pType->size);
+		if (HAE_OK != sDecode(&ctxt, pSample, pType, enc, pData, len, pDecoded))
+		{
+			break;
+		}
+	}
+	t1 = sNow();
+	if (i < iterCnt)
+	{
+		rtxErrPrint(&ctxt);
+		goto END;
+	}
+	pResult->decNs = (t1 - t0) * 1e9 / iterCnt;
+	pResult->decAllocs = (double)(bench_alloc_cnt - allocCnt) / iterCnt;
+
+	pResult->supported = HAE_TRUE;
+	pResult->bytes = len;
+	ret = HAE_OK;
+
+END:
+	rtFreeContext(&ctxt);
+
+	return (HAE_OK == ret) ? 0 : 1;
+}
+
+/* JSON export record of the value, bytes from what the writer wrote */
+static int sBenchJson(const BENCH_SAMPLE *pSample, const ASN_TYPE *pType, void *pValue, long iterCnt, BENCH_RESULT *pResult)
+{
+	long i;
+	double t0, t1;
+	unsigned long allocCnt;
+	struct timespec rxTime;
+	struct sockaddr_in source;
+	JSON_EXPORT exp;
+
+	if (0 == pType->pfPrint)
+	{
+		return 0;
+	}
+	if (HAE_OK != JsonExport_Open(&exp, "/dev/null"))
+	{
+		return 1;
+	}
+	clock_gettime(CLOCK_REALTIME, &rxTime);
+	memset(&source, 0x00, sizeof(source));
+
+	allocCnt = bench_alloc_cnt;
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		JsonExport_Message(&exp, pSample->messageId, pType, pValue, 0, &rxTime, &source);
+	}
+	t1 = sNow();
+	pResult->encAllocs = (double)(bench_alloc_cnt - allocCnt) / iterCnt;
+	pResult->encNs = (t1 - t0) * 1e9 / iterCnt;
+
+	JsonExport_Close(&exp);
+	if ((0 != exp.errorCnt) || (0 != exp.dropCnt) || (0 == exp.recordCnt))
+	{
+		printf("[BENCH] ERROR : %s JSON export, %lu errors %lu dropped\n", pSample->pName, exp.errorCnt, exp.dropCnt);
+		return 1;
+	}
+	pResult->bytes = exp.writeBytes / exp.recordCnt;
+	pResult->supported = HAE_TRUE;
+
+	return 0;
+}
+
+static void sWriteResult(FILE *pFile, const BENCH_SAMPLE *pSample, int enc, const BENCH_RESULT *pResult, long iterCnt)
+{
+	fprintf(pFile, "{\"message\":\"%s\",\"id\":%u,\"encoding\":\"%s\",\"supported\":%s", pSample->pName,
+		pSample->messageId, bench_enc_name[enc], pResult->supported ? "true" : "false");
+	if (pResult->supported)
+	{
+		fprintf(pFile, ",\"iterations\":%ld,\"bytes\":%zu,\"encodeNs\":%.1f,\"encodeAllocs\":%.3f", iterCnt,
+			pResult->bytes, pResult->encNs, pResult->encAllocs);
+		if (pResult->decNs >= 0)
+		{
+			fprintf(pFile, ",\"decodeNs\":%.1f,\"decodeAllocs\":%.3f,\"decodeHeapBytes\":%zu", pResult->decNs,
+				pResult->decAllocs, pResult->decHeapBytes);
+		}
+	}
+	fprintf(pFile, "}\n");
+}
+
+static double sNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* runtime allocation functions: calls, bytes and bytes held */
+static void *sMalloc(OSSIZE size)
+{
+	size_t *p = malloc(size + 16);
+
+	if (HAE_NULL == p)
+	{
+		return HAE_NULL;
+	}
+	p[0] = size;
+	bench_alloc_cnt++;
+	bench_heap_bytes += size;
+
+	return (char *)p + 16;
+}
+
+static void *sRealloc(void *ptr, OSSIZE size)
+{
+	size_t *p, old;
+
+	if (HAE_NULL == ptr)
+	{
+		return sMalloc(size);
+	}
+	p = (size_t *)((char *)ptr - 16);
+	old = p[0];
+	if (HAE_NULL == (p = realloc(p, size + 16)))
+	{
+		return HAE_NULL;
+	}
+	p[0] = size;
+	bench_alloc_cnt++;
+	bench_heap_bytes += size - old;
+
+	return (char *)p + 16;
+}
+
+static void sFree(void *ptr)
+{
+	size_t *p;
+
+	if (HAE_NULL == ptr)
+	{
+		return;
+	}
+	p = (size_t *)((char *)ptr - 16);
+	bench_heap_bytes -= p[0];
+	free(p);
+}
@@ -0,0 +1,290 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "oerTranscoder.h"
+
+#define BENCH_ITERCNT			20000L
+#define BENCH_BUF_SIZE			65536
+
+/* roadside traffic mix of one intersection, frames per second */
+typedef struct{
+	unsigned int messageId;
+	unsigned int perSecond;
+} BENCH_MIX;
+
+static const BENCH_MIX bench_mix[] =
+{
+	{ ASN1V_basicSafetyMessage, 3000 },			/* 300 vehicles, 10 Hz */
+	{ ASN1V_signalPhaseAndTimingMessage, 80 },	/* 8 controllers, 10 Hz */
+	{ ASN1V_mapData, 8 },
+	{ ASN1V_personalSafetyMessage, 40 },
+	{ ASN1V_signalRequestMessage, 2 },
+	{ ASN1V_signalStatusMessage, 8 },
+	{ ASN1V_travelerInformation, 1 },
+	{ ASN1V_probeVehicleData, 10 },
+	{ ASN1V_emergencyVehicleAlert, 1 },
+	{ ASN1V_rtcmCorrections, 1 },
+};
+
+typedef struct{
+	const ASN_TYPE *pType;
+	unsigned int messageId;
+	unsigned int perSecond;
+	size_t perLen;						/* UPER MessageFrame */
+	size_t oerLen;						/* OER MessageFrame */
+	unsigned char per[BENCH_BUF_SIZE];
+	unsigned char oer[BENCH_BUF_SIZE];
+} BENCH_FRAME;
+
+static BENCH_FRAME bench_frame[sizeof(bench_mix) / sizeof(bench_mix[0])];
+static unsigned char out_buf[BENCH_BUF_SIZE];
+static unsigned char value_buf[BENCH_BUF_SIZE];			/* value encoding inside a frame */
+
+static int sBuildFrame(BENCH_FRAME *pFrame, OER_TRANSCODER *pXc);
+static double sBenchDecode(const BENCH_FRAME *pFrame, int oer, long iterCnt);
+static double sBenchTranscode(OER_TRANSCODER *pXc, const BENCH_FRAME *pFrame, int toOer, long iterCnt);
+static double sNow(void);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: UPER vs OER decode cost of each message of the
+ *				  traffic mix, and the cost of the transcoder both
+ *				  ways. Every frame is first checked: the transcoded
+ *				  OER frame must equal OEREnc_MessageFrame of the
+ *				  library, and OER -> UPER must give the frame back.
+ *				  The totals weigh each message by bench_mix.
+ *
+ * Parameter	: argv[1] - iterations per message
+ *
+ * Returns		: 0, 1 if a check fails
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	unsigned int i, frameCnt = 0;
+	long iterCnt = BENCH_ITERCNT;
+	double perDec, oerDec, toOer, toPer;
+	double perSum = 0, oerSum = 0, toOerSum = 0, perBytes = 0, oerBytes = 0;
+	OER_TRANSCODER xc;
+
+	if (argc > 1)
+	{
+		iterCnt = atol(argv[1]);
+	}
+	if (HAE_OK != OerTranscoder_Init(&xc))
+	{
+		return 1;
+	}
+
+	printf("%-24s %6s %6s %10s %10s %10s %10s\n", "message", "UPER", "OER", "UPER dec", "OER dec", "UPER->OER", "OER->UPER");
+	for (i = 0; i < sizeof(bench_mix) / sizeof(bench_mix[0]); i++)
+	{
+		bench_frame[frameCnt].messageId = bench_mix[i].messageId;
+		bench_frame[frameCnt].perSecond = bench_mix[i].perSecond;
+		if (HAE_OK != sBuildFrame(&bench_frame[frameCnt], &xc))
+		{
+			OerTranscoder_Free(&xc);
+			return 1;
+		}
+		if (HAE_NULL == bench_frame[frameCnt].pType)
+		{
+			continue;
+		}
+
+		perDec = sBenchDecode(&bench_frame[frameCnt], HAE_FALSE, iterCnt);
+		oerDec = sBenchDecode(&bench_frame[frameCnt], HAE_TRUE, iterCnt);
+		toOer = sBenchTranscode(&xc, &bench_frame[frameCnt], HAE_TRUE, iterCnt);
+		toPer = sBenchTranscode(&xc, &bench_frame[frameCnt], HAE_FALSE, iterCnt);
+		printf("%-24s %6zu %6zu %7.0f ns %7.0f ns %7.0f ns %7.0f ns\n", bench_frame[frameCnt].pType->pName,
+			bench_frame[frameCnt].perLen, bench_frame[frameCnt].oerLen, perDec, oerDec, toOer, toPer);
+
+		perSum += perDec * bench_frame[frameCnt].perSecond;
+		oerSum += oerDec * bench_frame[frameCnt].perSecond;
+		toOerSum += toOer * bench_frame[frameCnt].perSecond;
+		perBytes += (double)bench_frame[frameCnt].perLen * bench_frame[frameCnt].perSecond;
+		oerBytes += (double)bench_frame[frameCnt].oerLen * bench_frame[frameCnt].perSecond;
+		frameCnt++;
+	}
+
+	/* ns of CPU per second of traffic = 1e-9 of a core */
+	printf("traffic mix decode : UPER %.2f%% of a core, OER %.2f%% (x%.2f), transcode UPER->OER %.2f%%\n",
+		perSum * 1e-7, oerSum * 1e-7, perSum / oerSum, toOerSum * 1e-7);
+	printf("traffic mix bytes  : UPER %.0f B/s, OER %.0f B/s (x%.2f)\n", perBytes, oerBytes, oerBytes / perBytes);
+
+	OerTranscoder_Free(&xc);
+
+	return 0;
+}
+
+/* UPER frame from the asn1Test value, OER frame by the transcoder, both
+   checked against the library's own MessageFrame encoders */
+static int sBuildFrame(BENCH_FRAME *pFrame, OER_TRANSCODER *pXc)
+{
+	int ret = HAE_ERROR;
+	size_t len;
+	void *pValue, *pDecoded;
+	MessageFrame frame;
+	OSCTXT ctxt;
+
+	pFrame->pType = AsnType_FindMessage(pFrame->messageId);
+	if ((HAE_NULL == pFrame->pType) || (0 == pFrame->pType->pfTest))
+	{
+		/* no test value in the library (RoadSideAlert) */
+		pFrame->pType = HAE_NULL;
+		return HAE_OK;
+	}
+
+	rtInitContext(&ctxt);
+	pValue = pFrame->pType->pfTest(&ctxt);
+
+	memset(&frame, 0x00, sizeof(frame));
+	frame.messageId = (DSRCmsgID)pFrame->messageId;
+	pu_setBuffer(&ctxt, value_buf, sizeof(value_buf), FALSE);
+	if ((HAE_NULL == pValue) || (0 != pFrame->pType->pfPerEnc(&ctxt, pValue)))
+	{
+		printf("[BENCH] ERROR : %s UPER encode of the test value\n", pFrame->pType->pName);
+		goto END;
+	}
+	frame.value.data = value_buf;
+	frame.value.numocts = pe_GetMsgLen(&ctxt);
+	pu_setBuffer(&ctxt, pFrame->per, sizeof(pFrame->per), FALSE);
+	if (0 != asn1PE_MessageFrame(&ctxt, &frame))
+	{
+		printf("[BENCH] ERROR : %s UPER MessageFrame\n", pFrame->pType->pName);
+		goto END;
+	}
+	pFrame->perLen = pe_GetMsgLen(&ctxt);
+
+	if (HAE_OK != OerTranscoder_PerToOer(pXc, pFrame->per, pFrame->perLen, pFrame->oer, sizeof(pFrame->oer), &pFrame->oerLen))
+	{
+		goto END;
+	}
+
+	/* library reference: OEREnc of the decoded value inside OEREnc_MessageFrame */
+	pDecoded = rtxMemAllocZ(&ctxt, pFrame->pType->size);
+	pu_setBuffer(&ctxt, (OSOCTET *)frame.value.data, frame.value.numocts, FALSE);
+	if ((HAE_NULL == pDecoded) || (0 != pFrame->pType->pfPerDec(&ctxt, pDecoded)))
+	{
+		printf("[BENCH] ERROR : %s UPER decode\n", pFrame->pType->pName);
+		goto END;
+	}
+	rtxInitContextBuffer(&ctxt, out_buf, sizeof(out_buf));
+	if (0 != pFrame->pType->pfOerEnc(&ctxt, pDecoded))
+	{
+		printf("[BENCH] ERROR : %s OER encode\n", pFrame->pType->pName);
+		goto END;
+	}
+	frame.value.data = out_buf;
+	frame.value.numocts = rtxCtxtGetMsgLen(&ctxt);
+	rtxInitContextBuffer(&ctxt, value_buf, sizeof(value_buf));
+	if ((0 != OEREnc_MessageFrame(&ctxt, &frame)) || (rtxCtxtGetMsgLen(&ctxt) != pFrame->oerLen) ||
+		(0 != memcmp(value_buf, pFrame->oer, pFrame->oerLen)))
+	{
+		printf("[BENCH] ERROR : %s transcoded OER differs from OEREnc_MessageFrame\n", pFrame->pType->pName);
+		goto END;
+	}
+
+	if ((HAE_OK != OerTranscoder_OerToPer(pXc, pFrame->oer, pFrame->oerLen, out_buf, sizeof(out_buf), &len)) ||
+		(len != pFrame->perLen) || (0 != memcmp(out_buf, pFrame->per, len)))
+	{
+		printf("[BENCH] ERROR : %s OER -> UPER does not give the frame back\n", pFrame->pType->pName);
+		goto END;
+	}
+
+	ret = HAE_OK;
+
+END:
+	rtFreeContext(&ctxt);
+
+	return ret;
+}
+
+/* MessageFrame and value decode, the way a receiver does it */
+static double sBenchDecode(const BENCH_FRAME *pFrame, int oer, long iterCnt)
+{
+	long i;
+	double t0, t1;
+	void *pValue;
+	MessageFrame frame;
+	OSCTXT ctxt;
+
+	rtInitContext(&ctxt);
+
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		rtxMemReset(&ctxt);
+		memset(&frame, 0x00, sizeof(frame));
+		pValue = rtxMemAllocZ(&ctxt, pFrame->pType->size);
+		if (oer)
+		{
+			rtxInitContextBuffer(&ctxt, (OSOCTET *)pFrame->oer, pFrame->oerLen);
+			OERDec_MessageFrame(&ctxt, &frame);
+			rtxInitContextBuffer(&ctxt, (OSOCTET *)frame.value.data, frame.value.numocts);
+			if (0 != pFrame->pType->pfOerDec(&ctxt, pValue))
+			{
+				break;
+			}
+		}
+		else
+		{
+			pu_setBuffer(&ctxt, (OSOCTET *)pFrame->per, pFrame->perLen, FALSE);
+			asn1PD_MessageFrame(&ctxt, &frame);
+			pu_setBuffer(&ctxt, (OSOCTET *)frame.value.data, frame.value.numocts, FALSE);
+			if (0 != pFrame->pType->pfPerDec(&ctxt, pValue))
+			{
+				break;
+			}
+		}
+	}
+	t1 = sNow();
+	if (i < iterCnt)
+	{
+		rtxErrPrint(&ctxt);
+	}
+
+	rtFreeContext(&ctxt);
+
+	return (t1 - t0) * 1e9 / iterCnt;
+}
+
+static double sBenchTranscode(OER_TRANSCODER *pXc, const BENCH_FRAME *pFrame, int toOer, long iterCnt)
+{
+	long i;
+	size_t len;
+	double t0, t1;
+
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		if (toOer)
+		{
+			OerTranscoder_PerToOer(pXc, pFrame->per, pFrame->perLen, out_buf, sizeof(out_buf), &len);
+		}
+		else
+		{
+			OerTranscoder_OerToPer(pXc, pFrame->oer, pFrame->oerLen, out_buf, sizeof(out_buf), &len);
+		}
+	}
+	t1 = sNow();
+
+	return (t1 - t0) * 1e9 / iterCnt;
+}
+
+static double sNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
@@ -0,0 +1,756 @@
+#define _GNU_SOURCE
+
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <dlfcn.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "asnDeep.h"
+#include "perBitReader.h"
+
+#define BENCH_ITERCNT			200000L
+#define BENCH_PRIM_CNT			4096
+
+#define CHECK_PRIM_CNT			3000000L	/* random primitive calls */
+#define CHECK_MSG_CNT			20000L		/* damaged encodings per message type */
+#define CHECK_POOL_SIZE			4096
+#define CHECK_MSG_SIZE			65536
+
+/* the primitives perBitReader.c replaces, in the order of PER_CHECK_FUNCS */
+#define CHECK_DEC_BIT			0
+#define CHECK_DEC_BITS			1
+#define CHECK_DEC_BITS_BYTE		2
+#define CHECK_DEC_BITS_UINT16	3
+#define CHECK_DEC_BITS_SIZE		4
+#define CHECK_CONS_UNSIGNED		5
+#define CHECK_CONS_INTEGER		6
+#define CHECK_CONS_INT8			7
+#define CHECK_CONS_INT16		8
+#define CHECK_LENGTH			9
+#define CHECK_LENGTH64			10
+#define CHECK_SMALL_LENGTH		11
+#define CHECK_KIND_CNT			12
+
+typedef struct{
+	int (*rtxDecBit)(OSCTXT *, OSBOOL *);
+	int (*rtxDecBits)(OSCTXT *, OSUINT32 *, OSSIZE);
+	int (*rtxDecBitsToByte)(OSCTXT *, OSUINT8 *, OSUINT8);
+	int (*rtxDecBitsToUInt16)(OSCTXT *, OSUINT16 *, OSUINT8);
+	int (*rtxDecBitsToSize)(OSCTXT *, OSSIZE *, OSSIZE);
+	int (*pd_ConsUnsigned)(OSCTXT *, OSUINT32 *, OSUINT64, OSUINT64);
+	int (*pd_ConsInteger)(OSCTXT *, OSINT32 *, OSINT64, OSINT64);
+	int (*pd_ConsInt8)(OSCTXT *, OSINT8 *, OSINT64, OSINT64);
+	int (*pd_ConsInt16)(OSCTXT *, OSINT16 *, OSINT64, OSINT64);
+	int (*pd_Length)(OSCTXT *, OSUINT32 *);
+	int (*pd_Length64)(OSCTXT *, OSSIZE *);
+	int (*pd_SmallLength)(OSCTXT *, OSUINT32 *);
+} PER_CHECK_FUNCS;
+
+/* one random primitive call */
+typedef struct{
+	int kind;							/* CHECK_* */
+	unsigned int offset;				/* into check_pool */
+	unsigned int len;
+	unsigned int startBit;				/* bit cursor inside the first octet */
+	int aligned;
+	OSSIZE nbits;
+	OSINT64 lower;
+	OSINT64 upper;
+	int sized;							/* size constraint pending */
+	OSUINT32 rootLower, rootUpper, extLower, extUpper;
+} PER_CHECK_ARGS;
+
+typedef struct{
+	int stat;
+	OSSIZE byteIndex;
+	int bitOffset;
+	union{
+		OSBOOL b;
+		OSUINT8 u8;
+		OSUINT16 u16;
+		OSUINT32 u32;
+		OSINT8 i8;
+		OSINT16 i16;
+		OSINT32 i32;
+		OSSIZE size;
+		unsigned char raw[8];
+	} value;
+} PER_CHECK_RESULT;
+
+/* progress of the message check, shared with the child that runs it */
+typedef struct{
+	long next;							/* message being decoded */
+	int side;							/* 0 reader, 1 library */
+	unsigned long diffCnt;
+	unsigned long crashCnt;				/* the library decoder crashed */
+} PER_CHECK_SHARED;
+
+/* SPaT MessageFrame captured from the RSU (dsrc_data[16..]) */
+static unsigned char spat_sample[130] =
+{
+	0x00, 0x13, 0x7f, 0x00, 0x18, 0x80, 0xca, 0x00, 0xca, 0x01, 0x04, 0x00, 0x26, 0x64, 0xa8, 0xbb,
+	0xd0, 0x76, 0x1e, 0x9d, 0x4a, 0x50, 0x64, 0xc7, 0x91, 0x50, 0x04, 0x11, 0x40, 0x04, 0x60, 0x01,
+	0x00, 0x18, 0x39, 0x91, 0x63, 0x54, 0x02, 0x04, 0x30, 0x01, 0x27, 0x00, 0x40, 0x06, 0x1e, 0x9d,
+	0x4a, 0x50, 0x64, 0xc7, 0x91, 0x50, 0x0c, 0x10, 0xc0, 0x09, 0x4c, 0x01, 0x00, 0x18, 0x39, 0x91,
+	0x63, 0x54, 0x04, 0x04, 0x30, 0x02, 0x53, 0x00, 0x40, 0x06, 0x1e, 0x9d, 0x4a, 0x50, 0x64, 0xc7,
+	0x91, 0x50, 0x14, 0x11, 0x40, 0x04, 0x60, 0x01, 0x00, 0x18, 0x39, 0x91, 0x63, 0x54, 0x06, 0x04,
+	0x30, 0x01, 0x27, 0x00, 0x40, 0x06, 0x1e, 0x9d, 0x4a, 0x50, 0x64, 0xc7, 0x91, 0x50, 0x1c, 0x10,
+	0xc0, 0x06, 0xcc, 0x01, 0x00, 0x18, 0x39, 0x91, 0x63, 0x54, 0x08, 0x04, 0x30, 0x01, 0xb3, 0x00,
+	0x40, 0x00
+};
+
+static unsigned char bsm_data[BUFF_SIZE];
+static unsigned int bsm_len;
+
+static unsigned char prim_data[BENCH_PRIM_CNT * 4];
+
+static PER_CHECK_FUNCS check_lib;
+static const PER_CHECK_FUNCS check_fast =
+{
+	rtxDecBit, rtxDecBits, rtxDecBitsToByte, rtxDecBitsToUInt16, rtxDecBitsToSize, pd_ConsUnsigned,
+	pd_ConsInteger, pd_ConsInt8, pd_ConsInt16, pd_Length, pd_Length64, pd_SmallLength
+};
+static unsigned char check_pool[CHECK_POOL_SIZE];
+static unsigned char check_msg[CHECK_MSG_SIZE];
+static unsigned char check_work[CHECK_MSG_SIZE];
+static unsigned long long check_seed = 0x9e3779b97f4a7c15ULL;
+static unsigned long check_crash_cnt;
+
+static const char *check_type[] =
+{
+	"BasicSafetyMessage", "MapData", "SPAT", "PersonalSafetyMessage", "TravelerInformation", "SignalRequestMessage"
+};
+static const char *check_kind_name[CHECK_KIND_CNT] =
+{
+	"rtxDecBit", "rtxDecBits", "rtxDecBitsToByte", "rtxDecBitsToUInt16", "rtxDecBitsToSize", "pd_ConsUnsigned",
+	"pd_ConsInteger", "pd_ConsInt8", "pd_ConsInt16", "pd_Length", "pd_Length64", "pd_SmallLength"
+};
+
+static int sBuildSample(void);
+static double sNow(void);
+static double sBenchPrim(int kind, long iterCnt);
+static double sBenchFrame(const unsigned char *pData, unsigned int ulLength, long iterCnt);
+static int sCheckResolve(void);
+static unsigned long long sRand(void);
+static void sCheckArgs(PER_CHECK_ARGS *pArgs);
+static void sCheckRun(const PER_CHECK_FUNCS *pFuncs, OSCTXT *pctxt, const PER_CHECK_ARGS *pArgs, PER_CHECK_RESULT *pResult);
+static unsigned long sCheckPrim(long callCnt);
+static unsigned long sCheckMsg(const char *pName, long msgCnt);
+static void sCheckMsgChild(const ASN_TYPE *pType, const ASN_DEEP_TYPE *pDeep, size_t len, long msgCnt,
+	PER_CHECK_SHARED *pShared);
+
+static const char *prim_name[] = { "pd_ConsUnsigned(0..65535)", "pd_ConsInteger(-900M..900M)", "pd_Length64" };
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: Decode benchmark of the 64 bit window PER reader.
+ *				  First the reader is checked against the library
+ *				  functions (dlsym(RTLD_NEXT)): random calls of every
+ *				  replaced primitive on random buffers, cursors and
+ *				  constraints, then bit-flipped and truncated
+ *				  encodings of the common messages decoded both ways.
+ *				  Values, bit cursors and status codes have to match.
+ *				  Then the bit primitives and full MessageFrame
+ *				  decodes (captured SPaT, asn1Test BSM) are timed with
+ *				  the reader disabled (library code) and enabled.
+ *
+ * Parameter	: argv[1] - iterations of the full decodes
+ *
+ * Returns		: 0, 1 if the reader and the library differ
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	int k;
+	unsigned int t;
+	unsigned long diffCnt = 0;
+	long iterCnt = BENCH_ITERCNT;
+	double off, on;
+
+	if (argc > 1)
+	{
+		iterCnt = atol(argv[1]);
+	}
+
+	if ((HAE_OK != sBuildSample()) || (HAE_OK != sCheckResolve()))
+	{
+		return 1;
+	}
+
+	diffCnt += sCheckPrim(CHECK_PRIM_CNT);
+	for (t = 0; t < sizeof(check_type) / sizeof(check_type[0]); t++)
+	{
+		diffCnt += sCheckMsg(check_type[t], CHECK_MSG_CNT);
+	}
+	printf("differential check : %ld primitive calls, %ld damaged messages, %lu differ, %lu crash the library decoder\n",
+		CHECK_PRIM_CNT, CHECK_MSG_CNT * (long)(sizeof(check_type) / sizeof(check_type[0])), diffCnt, check_crash_cnt);
+
+	for (k = 0; k < 3; k++)
+	{
+		PerBitReader_Enable(HAE_FALSE);
+		off = sBenchPrim(k, iterCnt / 100);
+		PerBitReader_Enable(HAE_TRUE);
+		on = sBenchPrim(k, iterCnt / 100);
+		printf("%-28s : %6.1f -> %6.1f ns/op (x%.2f)\n", prim_name[k], off, on, off / on);
+	}
+
+	PerBitReader_Enable(HAE_FALSE);
+	off = sBenchFrame(spat_sample, sizeof(spat_sample), iterCnt);
+	PerBitReader_Enable(HAE_TRUE);
+	on = sBenchFrame(spat_sample, sizeof(spat_sample), iterCnt);
+	printf("%-28s : %6.1f -> %6.1f ns/op (x%.2f), %u bytes\n", "MessageFrame+SPAT (capture)", off, on, off / on, (unsigned int)sizeof(spat_sample));
+
+	PerBitReader_Enable(HAE_FALSE);
+	off = sBenchFrame(bsm_data, bsm_len, iterCnt);
+	PerBitReader_Enable(HAE_TRUE);
+	on = sBenchFrame(bsm_data, bsm_len, iterCnt);
+	printf("%-28s : %6.1f -> %6.1f ns/op (x%.2f), %u bytes\n", "MessageFrame+BSM", off, on, off / on, bsm_len);
+
+	return (0 == diffCnt) ? 0 : 1;
+}
+
+/* BENCH_PRIM_CNT back to back values per pass, ns per value */
+static double sBenchPrim(int kind, long iterCnt)
+{
+	long i;
+	int j;
+	double t0, t1;
+	OSUINT32 uval;
+	OSINT32 ival;
+	OSSIZE len;
+	unsigned long sum = 0;
+	OSCTXT ctxt;
+
+	rtInitContext(&ctxt);
+
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		pu_setBuffer(&ctxt, prim_data, sizeof(prim_data), FALSE);
+		for (j = 0; j < BENCH_PRIM_CNT; j++)
+		{
+			if (0 == kind)
+			{
+				pd_ConsUnsigned(&ctxt, &uval, 0, 65535);
+				sum += uval;
+			}
+			else if (1 == kind)
+			{
+				pd_ConsInteger(&ctxt, &ival, -900000000, 900000001);
+				sum += (unsigned long)ival;
+			}
+			else
+			{
+				pd_Length64(&ctxt, &len);
+				sum += len;
+			}
+		}
+	}
+	t1 = sNow();
+
+	rtFreeContext(&ctxt);
+
+	if (0 == sum)
+	{
+		printf("[BENCH] ERROR : no values decoded\n");
+	}
+
+	return (t1 - t0) * 1e9 / ((double)iterCnt * BENCH_PRIM_CNT);
+}
+
+/* MessageFrame, then the message in its open type value */
+static double sBenchFrame(const unsigned char *pData, unsigned int ulLength, long iterCnt)
+{
+	long i;
+	int stat;
+	double t0, t1;
+	OSCTXT ctxt;
+	MessageFrame frame;
+	SPAT spat;
+	BasicSafetyMessage bsm;
+
+	rtInitContext(&ctxt);
+
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		pu_setBuffer(&ctxt, (OSOCTET *)pData, ulLength, FALSE);
+		memset(&frame, 0, sizeof(frame));
+		stat = asn1PD_MessageFrame(&ctxt, &frame);
+		if (0 == stat)
+		{
+			pu_setBuffer(&ctxt, (OSOCTET *)frame.value.data, frame.value.numocts, FALSE);
+			if (ASN1V_signalPhaseAndTimingMessage == frame.messageId)
+			{
+				memset(&spat, 0, sizeof(spat));
+				stat = asn1PD_SPAT(&ctxt, &spat);
+			}
+			else
+			{
+				memset(&bsm, 0, sizeof(bsm));
+				stat = asn1PD_BasicSafetyMessage(&ctxt, &bsm);
+			}
+		}
+		if (0 != stat)
+		{
+			rtxErrPrint(&ctxt);
+			break;
+		}
+		rtxMemReset(&ctxt);
+	}
+	t1 = sNow();
+
+	rtFreeContext(&ctxt);
+
+	return (t1 - t0) * 1e9 / iterCnt;
+}
+
+/* BSM MessageFrame from asn1Test_BasicSafetyMessage, random primitive input */
+static int sBuildSample(void)
+{
+	int stat;
+	unsigned int i;
+	OSOCTET msgBuf[BUFF_SIZE];
+	OSCTXT ctxt;
+	MessageFrame frame;
+	BasicSafetyMessage *pBsm;
+
+	/* top bit clear keeps every length in the one byte form */
+	srand(1);
+	for (i = 0; i < sizeof(prim_data); i++)
+	{
+		prim_data[i] = (unsigned char)(rand() & 0x7f);
+	}
+
+	rtInitContext(&ctxt);
+
+	pBsm = asn1Test_BasicSafetyMessage(&ctxt);
+	pu_setBuffer(&ctxt, msgBuf, sizeof(msgBuf), FALSE);
+	stat = asn1PE_BasicSafetyMessage(&ctxt, pBsm);
+	if (0 == stat)
+	{
+		memset(&frame, 0, sizeof(frame));
+		frame.messageId = ASN1V_basicSafetyMessage;
+		frame.value.numocts = (OSUINT32)pe_GetMsgLen(&ctxt);
+		frame.value.data = msgBuf;
+
+		pu_setBuffer(&ctxt, bsm_data, sizeof(bsm_data), FALSE);
+		stat = asn1PE_MessageFrame(&ctxt, &frame);
+		bsm_len = (unsigned int)pe_GetMsgLen(&ctxt);
+	}
+
+	if (0 != stat)
+	{
+		rtxErrPrint(&ctxt);
+		printf("[BENCH] ERROR : encode of BSM sample failed\n");
+	}
+
+	rtFreeContext(&ctxt);
+
+	return (0 == stat) ? HAE_OK : HAE_ERROR;
+}
+
+static double sNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* the library functions the reader falls back to */
+static int sCheckResolve(void)
+{
+	*(void **)&check_lib.rtxDecBit = dlsym(RTLD_NEXT, "rtxDecBit");
+	*(void **)&check_lib.rtxDecBits = dlsym(RTLD_NEXT, "rtxDecBits");
+	*(void **)&check_lib.rtxDecBitsToByte = dlsym(RTLD_NEXT, "rtxDecBitsToByte");
+	*(void **)&check_lib.rtxDecBitsToUInt16 = dlsym(RTLD_NEXT, "rtxDecBitsToUInt16");
+	*(void **)&check_lib.rtxDecBitsToSize = dlsym(RTLD_NEXT, "rtxDecBitsToSize");
+	*(void **)&check_lib.pd_ConsUnsigned = dlsym(RTLD_NEXT, "pd_ConsUnsigned");
+	*(void **)&check_lib.pd_ConsInteger = dlsym(RTLD_NEXT, "pd_ConsInteger");
+	*(void **)&check_lib.pd_ConsInt8 = dlsym(RTLD_NEXT, "pd_ConsInt8");
+	*(void **)&check_lib.pd_ConsInt16 = dlsym(RTLD_NEXT, "pd_ConsInt16");
+	*(void **)&check_lib.pd_Length = dlsym(RTLD_NEXT, "pd_Length");
+	*(void **)&check_lib.pd_Length64 = dlsym(RTLD_NEXT, "pd_Length64");
+	*(void **)&check_lib.pd_SmallLength = dlsym(RTLD_NEXT, "pd_SmallLength");
+
+	if ((0 == check_lib.rtxDecBit) || (0 == check_lib.rtxDecBits) || (0 == check_lib.rtxDecBitsToByte) ||
+		(0 == check_lib.rtxDecBitsToUInt16) || (0 == check_lib.rtxDecBitsToSize) || (0 == check_lib.pd_ConsUnsigned) ||
+		(0 == check_lib.pd_ConsInteger) || (0 == check_lib.pd_ConsInt8) || (0 == check_lib.pd_ConsInt16) ||
+		(0 == check_lib.pd_Length) || (0 == check_lib.pd_Length64) || (0 == check_lib.pd_SmallLength))
+	{
+		printf("[BENCH] ERROR : cannot resolve the library primitives: %s\n", dlerror());
+		return HAE_ERROR;
+	}
+
+	/* a check against itself proves nothing */
+	if ((void *)check_lib.rtxDecBits == (void *)check_fast.rtxDecBits)
+	{
+		printf("[BENCH] ERROR : perBitReader.o is not linked in front of the library\n");
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+/* xorshift64, the same sequence on every run */
+static unsigned long long sRand(void)
+{
+	check_seed ^= check_seed << 13;
+	check_seed ^= check_seed >> 7;
+	check_seed ^= check_seed << 17;
+
+	return check_seed;
+}
+
+/* a random call, biased to the edges: short buffers, cursors near the
+   end, widths around the 8/16/32 bit limits, empty, reversed and
+   too wide ranges, pending size constraints */
+static void sCheckArgs(PER_CHECK_ARGS *pArgs)
+{
+	unsigned int width;
+	OSUINT64 range;
+
+	memset(pArgs, 0, sizeof(PER_CHECK_ARGS));
+
+	pArgs->kind = (int)(sRand() % CHECK_KIND_CNT);
+	pArgs->len = (unsigned int)((0 == sRand() % 4) ? sRand() % 64 : sRand() % 12);
+	pArgs->offset = (unsigned int)(sRand() % (CHECK_POOL_SIZE - 64));
+	pArgs->startBit = (0 == pArgs->len) ? 0 : (unsigned int)(sRand() % 8);
+	pArgs->aligned = (0 == sRand() % 16);
+
+	switch (pArgs->kind)
+	{
+		case CHECK_DEC_BITS:
+		case CHECK_DEC_BITS_SIZE:
+			pArgs->nbits = (OSSIZE)(sRand() % 36);
+			break;
+
+		case CHECK_DEC_BITS_BYTE:
+			pArgs->nbits = (OSSIZE)(sRand() % 10);
+			break;
+
+		case CHECK_DEC_BITS_UINT16:
+			pArgs->nbits = (OSSIZE)(sRand() % 18);
+			break;
+
+		case CHECK_CONS_UNSIGNED:
+		case CHECK_CONS_INTEGER:
+		case CHECK_CONS_INT8:
+		case CHECK_CONS_INT16:
+			width = (unsigned int)(sRand() % 36);
+			range = (0 == width) ? 0 : (sRand() >> (64 - width));
+			if (0 == sRand() % 4)
+			{
+				range = (0 == width) ? 0 : (~0ULL >> (64 - width));
+			}
+			if (CHECK_CONS_UNSIGNED == pArgs->kind)
+			{
+				width = (unsigned int)(sRand() % 34);
+				pArgs->lower = (OSINT64)((0 == width) ? 0 : (sRand() >> (64 - width)));
+			}
+			else
+			{
+				width = (unsigned int)(sRand() % 34);
+				pArgs->lower = (0 == width) ? 0 : (OSINT64)(sRand() >> (64 - width)) - ((OSINT64)1 << (width - 1));
+				if (CHECK_CONS_INT8 == pArgs->kind)
+				{
+					pArgs->lower = (OSINT64)(sRand() % 300) - 150;
+					range = sRand() % 300;
+				}
+				else if (CHECK_CONS_INT16 == pArgs->kind)
+				{
+					pArgs->lower = (OSINT64)(sRand() % 70000) - 35000;
+					range = sRand() % 70000;
+				}
+			}
+			pArgs->upper = pArgs->lower + (OSINT64)range;
+			if (0 == sRand() % 32)
+			{
+				pArgs->upper = pArgs->lower - 1;
+			}
+			break;
+
+		case CHECK_LENGTH:
+		case CHECK_LENGTH64:
+			if (0 == sRand() % 4)
+			{
+				pArgs->sized = HAE_TRUE;
+				pArgs->rootLower = (OSUINT32)(sRand() % 8);
+				pArgs->rootUpper = pArgs->rootLower + (OSUINT32)(sRand() % 70000);
+				if (0 == sRand() % 2)
+				{
+					pArgs->extLower = pArgs->rootUpper + 1;
+					pArgs->extUpper = pArgs->extLower + (OSUINT32)(sRand() % 70000);
+				}
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+static void sCheckRun(const PER_CHECK_FUNCS *pFuncs, OSCTXT *pctxt, const PER_CHECK_ARGS *pArgs, PER_CHECK_RESULT *pResult)
+{
+	memset(pResult, 0xa5, sizeof(PER_CHECK_RESULT));
+
+	pu_setBuffer(pctxt, check_pool + pArgs->offset, pArgs->len, pArgs->aligned);
+	pctxt->buffer.bitOffset = (OSINT16)(8 - pArgs->startBit);
+	PU_INITSIZECONSTRAINT(pctxt);
+	if (pArgs->sized)
+	{
+		PU_SETSIZECONSTRAINT(pctxt, pArgs->rootLower, pArgs->rootUpper, pArgs->extLower, pArgs->extUpper);
+	}
+
+	switch (pArgs->kind)
+	{
+		case CHECK_DEC_BIT:
+			pResult->stat = pFuncs->rtxDecBit(pctxt, &pResult->value.b);
+			break;
+		case CHECK_DEC_BITS:
+			pResult->stat = pFuncs->rtxDecBits(pctxt, &pResult->value.u32, pArgs->nbits);
+			break;
+		case CHECK_DEC_BITS_BYTE:
+			pResult->stat = pFuncs->rtxDecBitsToByte(pctxt, &pResult->value.u8, (OSUINT8)pArgs->nbits);
+			break;
+		case CHECK_DEC_BITS_UINT16:
+			pResult->stat = pFuncs->rtxDecBitsToUInt16(pctxt, &pResult->value.u16, (OSUINT8)pArgs->nbits);
+			break;
+		case CHECK_DEC_BITS_SIZE:
+			pResult->stat = pFuncs->rtxDecBitsToSize(pctxt, &pResult->value.size, pArgs->nbits);
+			break;
+		case CHECK_CONS_UNSIGNED:
+			pResult->stat = pFuncs->pd_ConsUnsigned(pctxt, &pResult->value.u32, (OSUINT64)pArgs->lower, (OSUINT64)pArgs->upper);
+			break;
+		case CHECK_CONS_INTEGER:
+			pResult->stat = pFuncs->pd_ConsInteger(pctxt, &pResult->value.i32, pArgs->lower, pArgs->upper);
+			break;
+		case CHECK_CONS_INT8:
+			pResult->stat = pFuncs->pd_ConsInt8(pctxt, &pResult->value.i8, pArgs->lower, pArgs->upper);
+			break;
+		case CHECK_CONS_INT16:
+			pResult->stat = pFuncs->pd_ConsInt16(pctxt, &pResult->value.i16, pArgs->lower, pArgs->upper);
+			break;
+		case CHECK_LENGTH:
+			pResult->stat = pFuncs->pd_Length(pctxt, &pResult->value.u32);
+			break;
+		case CHECK_LENGTH64:
+			pResult->stat = pFuncs->pd_Length64(pctxt, &pResult->value.size);
+			break;
+		default:
+			pResult->stat = pFuncs->pd_SmallLength(pctxt, &pResult->value.u32);
+			break;
+	}
+
+	pResult->byteIndex = pctxt->buffer.byteIndex;
+	pResult->bitOffset = pctxt->buffer.bitOffset;
+	rtxErrReset(pctxt);
+}
+
+/* the library side runs with the reader disabled: its primitives call
+   each other through the same interposed symbols */
+static unsigned long sCheckPrim(long callCnt)
+{
+	long i;
+	unsigned long diffCnt = 0;
+	PER_CHECK_ARGS args;
+	PER_CHECK_RESULT fast, lib;
+	OSCTXT fastCtxt, libCtxt;
+
+	for (i = 0; i < CHECK_POOL_SIZE; i++)
+	{
+		check_pool[i] = (unsigned char)sRand();
+	}
+
+	rtInitContext(&fastCtxt);
+	rtInitContext(&libCtxt);
+
+	for (i = 0; i < callCnt; i++)
+	{
+		sCheckArgs(&args);
+
+		PerBitReader_Enable(HAE_TRUE);
+		sCheckRun(&check_fast, &fastCtxt, &args, &fast);
+		PerBitReader_Enable(HAE_FALSE);
+		sCheckRun(&check_lib, &libCtxt, &args, &lib);
+
+		if ((fast.stat != lib.stat) || (fast.byteIndex != lib.byteIndex) || (fast.bitOffset != lib.bitOffset) ||
+			(0 != memcmp(fast.value.raw, lib.value.raw, sizeof(fast.value.raw))))
+		{
+			if (diffCnt++ < 10)
+			{
+				printf("[BENCH] ERROR : %s(%zu, %lld..%lld) len %u bit %u: stat %d/%d, cursor %zu.%d/%zu.%d\n",
+					check_kind_name[args.kind], args.nbits, (long long)args.lower, (long long)args.upper, args.len,
+					args.startBit, fast.stat, lib.stat, fast.byteIndex, fast.bitOffset, lib.byteIndex, lib.bitOffset);
+			}
+		}
+	}
+	PerBitReader_Enable(HAE_TRUE);
+
+	rtFreeContext(&libCtxt);
+	rtFreeContext(&fastCtxt);
+
+	return diffCnt;
+}
+
+/* asn1Test value of pName, encoded by the library, then decoded both ways
+   with 1..4 bits flipped and / or cut short; decoded values are compared
+   where both decodes succeed. Some damaged encodings crash the library
+   decoder itself, so the decodes run in a child process that is started
+   again behind the message that killed it. */
+static unsigned long sCheckMsg(const char *pName, long msgCnt)
+{
+	int status;
+	pid_t pid;
+	size_t len;
+	unsigned long diffCnt;
+	void *pValue;
+	const ASN_TYPE *pType = AsnType_Find(pName);
+	const ASN_DEEP_TYPE *pDeep = AsnDeep_Find(pName);
+	PER_CHECK_SHARED *pShared;
+	OSCTXT ctxt;
+
+	if ((HAE_NULL == pType) || (HAE_NULL == pDeep) || (0 == pType->pfTest))
+	{
+		printf("[BENCH] ERROR : no test value for %s\n", pName);
+		return 1;
+	}
+
+	rtInitContext(&ctxt);
+	pValue = pType->pfTest(&ctxt);
+	pu_setBuffer(&ctxt, check_msg, sizeof(check_msg), FALSE);
+	if ((HAE_NULL == pValue) || (0 != pType->pfPerEnc(&ctxt, pValue)))
+	{
+		printf("[BENCH] ERROR : encode of %s failed\n", pName);
+		rtFreeContext(&ctxt);
+		return 1;
+	}
+	len = pe_GetMsgLen(&ctxt);
+	rtFreeContext(&ctxt);
+
+	pShared = (PER_CHECK_SHARED *)mmap(HAE_NULL, sizeof(PER_CHECK_SHARED), PROT_READ | PROT_WRITE,
+		MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if (MAP_FAILED == pShared)
+	{
+		perror("mmap");
+		return 1;
+	}
+	memset(pShared, 0, sizeof(PER_CHECK_SHARED));
+
+	while (pShared->next < msgCnt)
+	{
+		fflush(stdout);
+		pid = fork();
+		if (0 == pid)
+		{
+			sCheckMsgChild(pType, pDeep, len, msgCnt, pShared);
+			fflush(stdout);
+			_exit(0);
+		}
+		if ((0 > pid) || (pid != waitpid(pid, &status, 0)))
+		{
+			pShared->diffCnt++;
+			break;
+		}
+		if (!WIFSIGNALED(status))
+		{
+			continue;
+		}
+
+		if (1 == pShared->side)
+		{
+			pShared->crashCnt++;
+		}
+		else
+		{
+			/* the library survives what the reader does not */
+			printf("[BENCH] ERROR : %s message %ld crashes the reader only\n", pName, pShared->next);
+			pShared->diffCnt++;
+		}
+		pShared->next++;
+	}
+
+	diffCnt = pShared->diffCnt;
+	check_crash_cnt += pShared->crashCnt;
+	munmap(pShared, sizeof(PER_CHECK_SHARED));
+
+	return diffCnt;
+}
+
+/* messages pShared->next.. of sCheckMsg; the damage of a message depends
+   on its number only, a restarted child does the same */
+static void sCheckMsgChild(const ASN_TYPE *pType, const ASN_DEEP_TYPE *pDeep, size_t len, long msgCnt,
+	PER_CHECK_SHARED *pShared)
+{
+	long i;
+	int k, stat[2];
+	size_t workLen;
+	OSSIZE byteIndex[2];
+	int bitOffset[2];
+	void *pValue[2];
+	OSCTXT ctxt[2];
+
+	rtInitContext(&ctxt[0]);
+	rtInitContext(&ctxt[1]);
+
+	for (i = pShared->next; i < msgCnt; i++)
+	{
+		check_seed = 0x9e3779b97f4a7c15ULL ^ ((unsigned long long)(i + 1) * 0xbf58476d1ce4e5b9ULL) ^ len;
+		memcpy(check_work, check_msg, len);
+		workLen = len;
+		if (0 != i % 3)
+		{
+			for (k = (int)(sRand() % 4); k >= 0; k--)
+			{
+				check_work[sRand() % len] ^= (unsigned char)(1 << (sRand() % 8));
+			}
+		}
+		if (0 != i % 2)
+		{
+			workLen = (size_t)(sRand() % len);
+		}
+
+		/* the library first: a crash there is not held against the reader */
+		pShared->next = i;
+		for (k = 1; k >= 0; k--)
+		{
+			pShared->side = k;
+			PerBitReader_Enable(0 == k);
+			rtxMemReset(&ctxt[k]);
+			pValue[k] = rtxMemAllocZ(&ctxt[k], pType->size);
+			pu_setBuffer(&ctxt[k], check_work, workLen, FALSE);
+			stat[k] = pType->pfPerDec(&ctxt[k], pValue[k]);
+			byteIndex[k] = ctxt[k].buffer.byteIndex;
+			bitOffset[k] = ctxt[k].buffer.bitOffset;
+			rtxErrReset(&ctxt[k]);
+		}
+
+		if ((stat[0] != stat[1]) || (byteIndex[0] != byteIndex[1]) || (bitOffset[0] != bitOffset[1]) ||
+			((0 == stat[0]) && (0 != AsnDeep_Compare(pDeep, pValue[0], pValue[1]))))
+		{
+			if (pShared->diffCnt++ < 10)
+			{
+				printf("[BENCH] ERROR : %s message %ld, %zu of %zu bytes: stat %d/%d, cursor %zu.%d/%zu.%d\n",
+					pType->pName, i, workLen, len, stat[0], stat[1], byteIndex[0], bitOffset[0], byteIndex[1], bitOffset[1]);
+			}
+		}
+	}
+	pShared->next = msgCnt;
+	PerBitReader_Enable(HAE_TRUE);
+
+	rtFreeContext(&ctxt[1]);
+	rtFreeContext(&ctxt[0]);
+}
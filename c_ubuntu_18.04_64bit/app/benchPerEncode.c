@@ -0,0 +1,358 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "perBitWriter.h"
+
+#define BENCH_ITERCNT			200000L
+#define BENCH_BUF_SIZE			65536
+#define BENCH_ROUNDCNT			11			/* library and writer take turns, medians are shown */
+
+static unsigned char lib_buf[BENCH_BUF_SIZE];
+static unsigned char fast_buf[BENCH_BUF_SIZE];
+
+static const char *bench_type[] =
+{
+	"SPAT", "MapData", "BasicSafetyMessage", "TravelerInformation",
+	"PersonalSafetyMessage", "SignalRequestMessage", "ProbeVehicleData"
+};
+
+static int sVerify(const ASN_TYPE *pType);
+static int sCheckSize(const ASN_TYPE *pType);
+static int sCheckSizeChild(const ASN_TYPE *pType);
+static double sBenchEncode(const ASN_TYPE *pType, void *pValue, long iterCnt, size_t *pLen);
+static double sMedian(double *pValues, unsigned int cnt);
+static double sNow(void);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: Encode benchmark of the 64 bit word PER writer.
+ *				  First every type of asn_type_table with a library
+ *				  test value is encoded with the writer disabled
+ *				  (library code) and enabled, into static and dynamic
+ *				  buffers, and the encodings are compared bit for bit.
+ *				  The UPER and OER sizes of the same values are checked
+ *				  against the static bounds of the table.
+ *				  Then the common messages are timed both ways. The
+ *				  two take turns in BENCH_ROUNDCNT rounds, so a slow
+ *				  stretch of the host hits both; the medians and the
+ *				  spread of the per round ratio are printed.
+ *
+ * Parameter	: argv[1] - iterations per message and way
+ *
+ * Returns		: 0, 1 if an encoding differs
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	unsigned int i, k, r;
+	unsigned int checkCnt = 0, diffCnt = 0, skipCnt = 0, sizeCnt = 0, crashCnt = 0, boundCnt = 0;
+	long iterCnt = BENCH_ITERCNT;
+	int stat;
+	double off[BENCH_ROUNDCNT], on[BENCH_ROUNDCNT], ratio[BENCH_ROUNDCNT];
+	double offMed, onMed, ratioMed;
+	long roundIterCnt;
+	size_t len;
+	const ASN_TYPE *pType;
+	void *pValue;
+	OSCTXT ctxt;
+
+	if (argc > 1)
+	{
+		iterCnt = atol(argv[1]);
+	}
+
+	for (i = 0; i < asn_type_cnt; i++)
+	{
+		if (0 == asn_type_table[i].pfTest)
+		{
+			continue;
+		}
+		stat = sVerify(&asn_type_table[i]);
+		if (HAE_OK == stat)
+		{
+			checkCnt++;
+		}
+		else if (HAE_ERROR == stat)
+		{
+			diffCnt++;
+		}
+		else
+		{
+			skipCnt++;
+			continue;
+		}
+
+		stat = sCheckSize(&asn_type_table[i]);
+		if (HAE_OK == stat)
+		{
+			sizeCnt++;
+		}
+		else if (HAE_ERROR == stat)
+		{
+			diffCnt++;
+		}
+		else
+		{
+			crashCnt++;
+		}
+	}
+	printf("bit-exact check : %u types identical, %u differ, %u without a valid test value\n", checkCnt, diffCnt, skipCnt);
+
+	for (i = 0; i < asn_type_cnt; i++)
+	{
+		if (!(asn_type_table[i].sizeFlags & ASN_SIZE_UNBOUNDED))
+		{
+			boundCnt++;
+		}
+	}
+	printf("size bounds     : %u of %u types bounded, %u test values inside the bounds, %u crash the library encoder\n",
+		boundCnt, asn_type_cnt, sizeCnt, crashCnt);
+
+	for (k = 0; k < sizeof(bench_type) / sizeof(bench_type[0]); k++)
+	{
+		pType = AsnType_Find(bench_type[k]);
+		if ((HAE_NULL == pType) || (0 == pType->pfTest))
+		{
+			continue;
+		}
+
+		rtInitContext(&ctxt);
+		pValue = pType->pfTest(&ctxt);
+
+		roundIterCnt = (iterCnt + BENCH_ROUNDCNT - 1) / BENCH_ROUNDCNT;
+		for (r = 0; r < BENCH_ROUNDCNT; r++)
+		{
+			/* every other round the writer first */
+			PerBitWriter_Enable(r & 1);
+			*((r & 1) ? &on[r] : &off[r]) = sBenchEncode(pType, pValue, roundIterCnt, &len);
+			PerBitWriter_Enable(!(r & 1));
+			*((r & 1) ? &off[r] : &on[r]) = sBenchEncode(pType, pValue, roundIterCnt, &len);
+			ratio[r] = off[r] / on[r];
+		}
+		PerBitWriter_Enable(HAE_TRUE);
+		offMed = sMedian(off, BENCH_ROUNDCNT);
+		onMed = sMedian(on, BENCH_ROUNDCNT);
+		/* sorted, [0] and [BENCH_ROUNDCNT - 1] are the spread */
+		ratioMed = sMedian(ratio, BENCH_ROUNDCNT);
+		printf("%-24s : %7.1f -> %7.1f ns/op (x%.2f, rounds x%.2f..%.2f), %zu bytes\n", pType->pName,
+			offMed, onMed, ratioMed, ratio[0], ratio[BENCH_ROUNDCNT - 1], len);
+
+		rtFreeContext(&ctxt);
+	}
+
+	return (0 == diffCnt) ? 0 : 1;
+}
+
+/* HAE_OK identical, HAE_ERROR different, 1 the library cannot encode the test value */
+static int sVerify(const ASN_TYPE *pType)
+{
+	int ret = HAE_OK;
+	int stat[2];
+	size_t len[2], dynLen;
+	OSOCTET *pDyn;
+	void *pValue;
+	OSCTXT ctxt, libCtxt, fastCtxt, dynCtxt;
+
+	rtInitContext(&ctxt);
+	rtInitContext(&libCtxt);
+	rtInitContext(&fastCtxt);
+	rtInitContext(&dynCtxt);
+
+	pValue = pType->pfTest(&ctxt);
+	if (HAE_NULL == pValue)
+	{
+		ret = 1;
+		goto END;
+	}
+
+	/* different garbage behind the cursor on each side */
+	memset(lib_buf, 0xa5, sizeof(lib_buf));
+	memset(fast_buf, 0x5a, sizeof(fast_buf));
+
+	PerBitWriter_Enable(HAE_FALSE);
+	pu_setBuffer(&libCtxt, lib_buf, sizeof(lib_buf), FALSE);
+	stat[0] = pType->pfPerEnc(&libCtxt, pValue);
+	len[0] = pe_GetMsgLen(&libCtxt);
+
+	PerBitWriter_Enable(HAE_TRUE);
+	pu_setBuffer(&fastCtxt, fast_buf, sizeof(fast_buf), FALSE);
+	stat[1] = pType->pfPerEnc(&fastCtxt, pValue);
+	len[1] = pe_GetMsgLen(&fastCtxt);
+
+	if ((0 != stat[0]) && (stat[0] == stat[1]))
+	{
+		ret = 1;
+		goto END;
+	}
+	if ((stat[0] != stat[1]) || (len[0] != len[1]) || (0 != memcmp(lib_buf, fast_buf, len[0])))
+	{
+		printf("[BENCH] ERROR : %s static buffer, stat %d/%d, %zu/%zu bytes\n", pType->pName, stat[0], stat[1], len[0], len[1]);
+		ret = HAE_ERROR;
+		goto END;
+	}
+
+	/* dynamic buffer, grown by the library as the fields need it */
+	pu_setBuffer(&dynCtxt, 0, 0, FALSE);
+	stat[1] = pType->pfPerEnc(&dynCtxt, pValue);
+	pDyn = pe_GetMsgPtr64(&dynCtxt, &dynLen);
+	if ((0 != stat[1]) || (dynLen != len[0]) || (0 != memcmp(lib_buf, pDyn, len[0])))
+	{
+		printf("[BENCH] ERROR : %s dynamic buffer, stat %d, %zu/%zu bytes\n", pType->pName, stat[1], len[0], dynLen);
+		ret = HAE_ERROR;
+	}
+
+END:
+	rtFreeContext(&dynCtxt);
+	rtFreeContext(&fastCtxt);
+	rtFreeContext(&libCtxt);
+	rtFreeContext(&ctxt);
+
+	return ret;
+}
+
+/* HAE_OK inside the bounds, HAE_ERROR outside, 1 the library encoder crashed.
+   Each check runs in a child process: without the fixes of oerBitString.o
+   OEREnc_* of an extensible BIT STRING reads extdata[-1]. */
+static int sCheckSize(const ASN_TYPE *pType)
+{
+	int status;
+	pid_t pid;
+
+	fflush(stdout);
+	pid = fork();
+	if (0 == pid)
+	{
+		_exit((HAE_OK == sCheckSizeChild(pType)) ? 0 : 1);
+	}
+	if ((0 > pid) || (pid != waitpid(pid, &status, 0)))
+	{
+		return HAE_ERROR;
+	}
+	if (WIFSIGNALED(status))
+	{
+		return 1;
+	}
+
+	return (0 == WEXITSTATUS(status)) ? HAE_OK : HAE_ERROR;
+}
+
+/* UPER and OER size of the test value against the table bounds. The sizes
+   are taken from the value decoded back from UPER, test values leave fields
+   PER does not read uninitialized. */
+static int sCheckSizeChild(const ASN_TYPE *pType)
+{
+	int ret = HAE_OK;
+	size_t bits = 0, bytes = 0, len;
+	OSOCTET *pMsg;
+	void *pValue;
+	OSCTXT ctxt, sizeCtxt;
+
+	rtInitContext(&ctxt);
+	rtInitContext(&sizeCtxt);
+
+	pValue = pType->pfTest(&ctxt);
+	pu_setBuffer(&ctxt, 0, 0, FALSE);
+	if (0 != pType->pfPerEnc(&ctxt, pValue))
+	{
+		ret = HAE_ERROR;
+		goto END;
+	}
+	pMsg = pe_GetMsgPtr64(&ctxt, &len);
+
+	pValue = rtxMemAllocZ(&ctxt, pType->size);
+	pu_setBuffer(&ctxt, pMsg, len, FALSE);
+	if ((HAE_NULL == pValue) || (0 != pType->pfPerDec(&ctxt, pValue)))
+	{
+		printf("[BENCH] ERROR : %s cannot decode its own encoding\n", pType->pName);
+		ret = HAE_ERROR;
+		goto END;
+	}
+
+	if ((HAE_OK != AsnType_PerSize(pType, &sizeCtxt, pValue, &bits)) ||
+		(HAE_OK != AsnType_OerSize(pType, &sizeCtxt, pValue, &bytes)))
+	{
+		printf("[BENCH] ERROR : %s size function cannot encode the value\n", pType->pName);
+		ret = HAE_ERROR;
+		goto END;
+	}
+
+	if ((bits < pType->perMinBits) || (bytes < pType->oerMinBytes) ||
+		(!(pType->sizeFlags & ASN_SIZE_UNBOUNDED) && ((bits > pType->perMaxBits) || (bytes > pType->oerMaxBytes))))
+	{
+		printf("[BENCH] ERROR : %s %zu bits [%lu, %lu], %zu bytes [%lu, %lu] flags 0x%x\n", pType->pName,
+			bits, pType->perMinBits, pType->perMaxBits, bytes, pType->oerMinBytes, pType->oerMaxBytes, pType->sizeFlags);
+		ret = HAE_ERROR;
+	}
+
+END:
+	rtFreeContext(&sizeCtxt);
+	rtFreeContext(&ctxt);
+
+	return ret;
+}
+
+/* encode iterCnt times into one buffer that covers the worst case */
+static double sBenchEncode(const ASN_TYPE *pType, void *pValue, long iterCnt, size_t *pLen)
+{
+	long i;
+	double t0, t1;
+	OSCTXT ctxt;
+
+	rtInitContext(&ctxt);
+
+	t0 = sNow();
+	for (i = 0; i < iterCnt; i++)
+	{
+		pu_setBuffer(&ctxt, fast_buf, sizeof(fast_buf), FALSE);
+		if (0 != pType->pfPerEnc(&ctxt, pValue))
+		{
+			rtxErrPrint(&ctxt);
+			break;
+		}
+	}
+	t1 = sNow();
+	*pLen = pe_GetMsgLen(&ctxt);
+
+	rtFreeContext(&ctxt);
+
+	return (t1 - t0) * 1e9 / iterCnt;
+}
+
+/* sorts pValues */
+static double sMedian(double *pValues, unsigned int cnt)
+{
+	unsigned int i, k;
+	double t;
+
+	for (i = 1; i < cnt; i++)
+	{
+		for (k = i; (k > 0) && (pValues[k - 1] > pValues[k]); k--)
+		{
+			t = pValues[k];
+			pValues[k] = pValues[k - 1];
+			pValues[k - 1] = t;
+		}
+	}
+
+	return pValues[cnt / 2];
+}
+
+static double sNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
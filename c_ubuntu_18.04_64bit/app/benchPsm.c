@@ -0,0 +1,273 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "haeCommon.h"
+#include "psmAggregator.h"
+
+#define BENCH_ITERCNT			200000L
+#define BENCH_SPEC				"100:375665000:1269780000:-6,4,6,8:8,-6,12,6"
+#define BENCH_PSM_CNT			7
+
+/* Where each PSM of the sample stands, meters east / north of the
+   intersection; the last one of a TemporaryID counts */
+typedef struct{
+	unsigned char id;
+	float x;
+	float y;
+	Velocity speed;						/* 0.02 m/s */
+	Heading heading;					/* 0.0125 degree */
+	NumberOfParticipantsInCluster clusterSize;	/* 0 = none */
+} PSM_SAMPLE;
+
+static const PSM_SAMPLE psm_sample[BENCH_PSM_CNT] =
+{
+	{ 1,   0.0f,   6.0f,    0,     0, 0 },			/* crosswalk 0, moves on below */
+	{ 2,   0.0f,   6.0f,    0,     0, small_ },		/* crosswalk 0, weight 4 */
+	{ 3,   0.0f,  10.0f,   50, 14400, 0 },			/* north of crosswalk 0, 1 m/s south: approaching */
+	{ 4,   0.0f, -20.0f,    0,     0, 0 },			/* grid only */
+	{ 5, 100.0f, 100.0f,    0,     0, 0 },			/* off the grid, not counted */
+	{ 1,  10.0f,   0.0f,    0,     0, 0 },			/* same id again: now in crosswalk 1 */
+	{ 6,  15.0f,   0.0f,   50,     0, 0 },			/* east of crosswalk 1, going north: not approaching */
+};
+
+/* expected report */
+#define EXPECT_OCCUPANCY_0		4
+#define EXPECT_APPROACHING_0	1
+#define EXPECT_APPROACH_VY_0	(-1.0f)
+#define EXPECT_OCCUPANCY_1		1
+#define EXPECT_APPROACHING_1	0
+#define EXPECT_GRID_SUM			8
+
+static unsigned char psm_data[BENCH_PSM_CNT][BUFF_SIZE];
+static unsigned int psm_len[BENCH_PSM_CNT];
+
+static PSM_AGG_REPORT last_report;
+static unsigned int report_cnt;
+
+static void sPublish(void *pArg, const PSM_AGG_REPORT *pReport);
+static int sCheck(const PSM_AGG_REPORT *pReport);
+static int sBuildSample(const PSM_AGG *pAgg);
+static double sNow(void);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: PSM aggregator check and benchmark.
+ *				  Known PSM encodings are fed into known crosswalk boxes
+ *				  (BENCH_SPEC) through PsmAgg_Input and, decoded first,
+ *				  through PsmAgg_InputPsm; both reports must hold the
+ *				  expected counts. Then both ways are timed per PSM.
+ *
+ * Parameter	: argv[1] - iterations
+ *
+ * Returns		: 0, 1 when a count differs
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	long i;
+	long iterCnt = BENCH_ITERCNT;
+	unsigned int k;
+	int ret = HAE_OK;
+	double t0, t1;
+	static PSM_AGG agg;
+	PSM_AGG_REPORT report;
+	PersonalSafetyMessage psm;
+	OSCTXT ctxt;
+
+	if (argc > 1)
+	{
+		iterCnt = atol(argv[1]);
+	}
+
+	if ((HAE_OK != PsmAgg_Init(&agg, 1000, sPublish, HAE_NULL)) || (HAE_OK != PsmAgg_AddSpec(&agg, BENCH_SPEC)))
+	{
+		return 1;
+	}
+	if ((1 != agg.intersectionCnt) || (2 != agg.intersection[0].crosswalkCnt))
+	{
+		printf("[BENCH] ERROR : \"%s\" gave %u intersection(s)\n", BENCH_SPEC, agg.intersectionCnt);
+		return 1;
+	}
+
+	if (HAE_OK != sBuildSample(&agg))
+	{
+		return 1;
+	}
+
+	rtInitContext(&ctxt);
+
+	/* encoded PSMs */
+	for (k = 0; k < BENCH_PSM_CNT; k++)
+	{
+		PsmAgg_Input(&agg, psm_data[k], psm_len[k]);
+	}
+	report_cnt = 0;
+	if ((1 != PsmAgg_Tick(&agg, 1000)) || (1 != report_cnt))
+	{
+		printf("[BENCH] ERROR : PsmAgg_Tick published %u reports\n", report_cnt);
+		ret = HAE_ERROR;
+	}
+	report = last_report;
+	if (HAE_OK != sCheck(&report))
+	{
+		printf("[BENCH] ERROR : counts of PsmAgg_Input differ\n");
+		ret = HAE_ERROR;
+	}
+
+	/* decoded PSMs, as decodeSample feeds them */
+	for (k = 0; k < BENCH_PSM_CNT; k++)
+	{
+		pu_setBuffer(&ctxt, psm_data[k], psm_len[k], FALSE);
+		memset(&psm, 0, sizeof(psm));
+		if (0 != asn1PD_PersonalSafetyMessage(&ctxt, &psm))
+		{
+			rtxErrPrint(&ctxt);
+			ret = HAE_ERROR;
+		}
+		PsmAgg_InputPsm(&agg, &psm);
+		rtxMemReset(&ctxt);
+	}
+	report_cnt = 0;
+	PsmAgg_Tick(&agg, 2000);
+	if ((1 != report_cnt) || (HAE_OK != sCheck(&last_report)) || (0 != memcmp(&report, &last_report, sizeof(report))))
+	{
+		printf("[BENCH] ERROR : counts of PsmAgg_InputPsm differ\n");
+		ret = HAE_ERROR;
+	}
+
+	if (HAE_OK == ret)
+	{
+		printf("PSM counts match, both ways\n");
+
+		t0 = sNow();
+		for (i = 0; i < iterCnt; i++)
+		{
+			PsmAgg_Input(&agg, psm_data[i % BENCH_PSM_CNT], psm_len[i % BENCH_PSM_CNT]);
+		}
+		t1 = sNow();
+		printf("PsmAgg_Input           : %8.1f ns/PSM\n", (t1 - t0) * 1e9 / iterCnt);
+
+		t0 = sNow();
+		for (i = 0; i < iterCnt; i++)
+		{
+			pu_setBuffer(&ctxt, psm_data[i % BENCH_PSM_CNT], psm_len[i % BENCH_PSM_CNT], FALSE);
+			memset(&psm, 0, sizeof(psm));
+			asn1PD_PersonalSafetyMessage(&ctxt, &psm);
+			PsmAgg_InputPsm(&agg, &psm);
+			rtxMemReset(&ctxt);
+		}
+		t1 = sNow();
+		printf("decode + InputPsm      : %8.1f ns/PSM\n", (t1 - t0) * 1e9 / iterCnt);
+	}
+
+	rtFreeContext(&ctxt);
+	PsmAgg_Free(&agg);
+
+	return (HAE_OK == ret) ? 0 : 1;
+}
+
+static void sPublish(void *pArg, const PSM_AGG_REPORT *pReport)
+{
+	last_report = *pReport;
+	report_cnt++;
+}
+
+static int sCheck(const PSM_AGG_REPORT *pReport)
+{
+	int ret = HAE_OK;
+	unsigned int row, col, sum = 0;
+	const PSM_AGG_CROSSWALK_STAT *pStat = pReport->crosswalk;
+
+	for (row = 0; row < PSM_AGG_GRID_DIM; row++)
+	{
+		for (col = 0; col < PSM_AGG_GRID_DIM; col++)
+		{
+			sum += pReport->grid[row][col];
+		}
+	}
+
+	if ((100 != pReport->intersectionId) || (2 != pReport->crosswalkCnt) || (EXPECT_GRID_SUM != sum))
+	{
+		printf("[BENCH] ERROR : intersection %u, %u crosswalks, grid %u, expected 100, 2, %u\n",
+			(unsigned int)pReport->intersectionId, pReport->crosswalkCnt, sum, EXPECT_GRID_SUM);
+		ret = HAE_ERROR;
+	}
+	if ((EXPECT_OCCUPANCY_0 != pStat[0].occupancy) || (EXPECT_APPROACHING_0 != pStat[0].approaching) ||
+		(fabsf(pStat[0].approachVy - EXPECT_APPROACH_VY_0) > 0.01f) || (fabsf(pStat[0].approachVx) > 0.01f))
+	{
+		printf("[BENCH] ERROR : crosswalk 0 %u in, %u approaching (%.2f, %.2f m/s), expected %u, %u (0, %.2f)\n",
+			pStat[0].occupancy, pStat[0].approaching, pStat[0].approachVx, pStat[0].approachVy,
+			EXPECT_OCCUPANCY_0, EXPECT_APPROACHING_0, EXPECT_APPROACH_VY_0);
+		ret = HAE_ERROR;
+	}
+	if ((EXPECT_OCCUPANCY_1 != pStat[1].occupancy) || (EXPECT_APPROACHING_1 != pStat[1].approaching))
+	{
+		printf("[BENCH] ERROR : crosswalk 1 %u in, %u approaching, expected %u, %u\n",
+			pStat[1].occupancy, pStat[1].approaching, EXPECT_OCCUPANCY_1, EXPECT_APPROACHING_1);
+		ret = HAE_ERROR;
+	}
+
+	return ret;
+}
+
+/* psm_sample encoded from asn1Test_PersonalSafetyMessage, so the
+   optional components in front of the cluster fields are there too */
+static int sBuildSample(const PSM_AGG *pAgg)
+{
+	int stat = 0;
+	unsigned int k;
+	OSCTXT ctxt;
+	PersonalSafetyMessage *pPsm;
+	const PSM_AGG_INTERSECTION *pInter = &pAgg->intersection[0];
+	const PSM_SAMPLE *pSample;
+
+	rtInitContext(&ctxt);
+
+	pPsm = asn1Test_PersonalSafetyMessage(&ctxt);
+
+	for (k = 0; (0 == stat) && (k < BENCH_PSM_CNT); k++)
+	{
+		pSample = &psm_sample[k];
+
+		pPsm->id.numocts = 4;
+		memset(pPsm->id.data, 0, sizeof(pPsm->id.data));
+		pPsm->id.data[3] = pSample->id;
+		pPsm->position.lat = pInter->refLat + (Latitude)lroundf(pSample->y / pInter->metersPerLat);
+		pPsm->position.long_ = pInter->refLon + (Longitude)lroundf(pSample->x / pInter->metersPerLon);
+		pPsm->speed = pSample->speed;
+		pPsm->heading = pSample->heading;
+		pPsm->m.clusterSizePresent = (0 != pSample->clusterSize) ? 1 : 0;
+		pPsm->clusterSize = pSample->clusterSize;
+
+		pu_setBuffer(&ctxt, psm_data[k], sizeof(psm_data[k]), FALSE);
+		stat = asn1PE_PersonalSafetyMessage(&ctxt, pPsm);
+		psm_len[k] = (unsigned int)pe_GetMsgLen(&ctxt);
+	}
+
+	if (0 != stat)
+	{
+		rtxErrPrint(&ctxt);
+		printf("[BENCH] ERROR : encode of PSM sample %u failed\n", k - 1);
+	}
+
+	rtFreeContext(&ctxt);
+
+	return (0 == stat) ? HAE_OK : HAE_ERROR;
+}
+
+static double sNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
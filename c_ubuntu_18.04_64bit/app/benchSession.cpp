@@ -0,0 +1,341 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <time.h>
+
+#include "haeCommon.h"
+#include "asnSession.h"
+
+#define BENCH_ITERCNT			20000L
+#define BENCH_WARMUP			100L		/* decodes before counting, the pool and heaps settle */
+#define BENCH_THREAD_CNT		2
+
+/* runtime allocations and operator new, from every thread */
+static std::atomic<unsigned long> bench_alloc_cnt(0);
+
+static double sNow(void);
+static void *sMalloc(OSSIZE size);
+static void *sRealloc(void *ptr, OSSIZE size);
+static void sFree(void *ptr);
+
+void *operator new(std::size_t size)
+{
+	void *p;
+
+	bench_alloc_cnt.fetch_add(1, std::memory_order_relaxed);
+	if (nullptr == (p = std::malloc((0 == size) ? 1 : size)))
+	{
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void operator delete(void *p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+/*************************************************************
+ *
+ * Function 		: sBenchPlain
+ *
+ * Description	: Decode as done without the session layer: a new
+ *				  context per message.
+ *
+ * Parameter	: data - UPER MessageFrame carrying a T
+ *				  iterCnt - decodes
+ *				  pAllocs - allocations per decode
+ *
+ * Returns		: ns per decode, < 0 on a decode error
+ *
+ *************************************************************/
+template<typename T>
+static double sBenchPlain(hae::span<const std::uint8_t> data, long iterCnt, double *pAllocs)
+{
+	OSCTXT ctxt;
+	MessageFrame frame;
+	T value;
+	unsigned long allocCnt = bench_alloc_cnt.load();
+	double start = sNow();
+	int stat = 0;
+
+	for (long i = 0; (i < iterCnt) && (0 == stat); i++)
+	{
+		memset(&frame, 0x00, sizeof(frame));
+		memset(&value, 0x00, sizeof(value));
+		rtInitContext(&ctxt);
+		pu_setBuffer(&ctxt, const_cast<OSOCTET *>(data.data()), data.size(), FALSE);
+		if (0 == (stat = asn1PD_MessageFrame(&ctxt, &frame)))
+		{
+			pu_setBuffer(&ctxt, const_cast<OSOCTET *>(frame.value.data), frame.value.numocts, FALSE);
+			stat = hae::AsnCodec<T>::decode(&ctxt, &value);
+		}
+		rtFreeContext(&ctxt);
+	}
+	*pAllocs = (double)(bench_alloc_cnt.load() - allocCnt) / iterCnt;
+
+	return (0 == stat) ? (sNow() - start) / iterCnt : -1;
+}
+
+/*************************************************************
+ *
+ * Function 		: sBenchSession
+ *
+ * Description	: Decode with hae::decodeFrame<T>, after a warm-up.
+ *				  Two messages are alive at a time, the pool then
+ *				  holds two contexts.
+ *
+ * Parameter	: data - UPER MessageFrame carrying a T
+ *				  iterCnt - decodes
+ *				  pAllocs - allocations per decode
+ *
+ * Returns		: ns per decode, < 0 on a decode error
+ *
+ *************************************************************/
+template<typename T>
+static double sBenchSession(hae::span<const std::uint8_t> data, long iterCnt, double *pAllocs)
+{
+	hae::AsnMessage<T> prev;
+	unsigned long allocCnt = 0;
+	double start = 0;
+
+	for (long i = -BENCH_WARMUP; i < iterCnt; i++)
+	{
+		if (0 == i)
+		{
+			allocCnt = bench_alloc_cnt.load();
+			start = sNow();
+		}
+		hae::AsnMessage<T> msg = hae::decodeFrame<T>(data);
+		if (!msg)
+		{
+			printf("[BENCH] ERROR : %s decode %d\n", hae::AsnCodec<T>::pName, msg.error());
+			return -1;
+		}
+		prev = std::move(msg);
+	}
+	*pAllocs = (double)(bench_alloc_cnt.load() - allocCnt) / iterCnt;
+
+	return (sNow() - start) / iterCnt;
+}
+
+/*************************************************************
+ *
+ * Function 		: sBenchType
+ *
+ * Description	: Encode the test value of T in a MessageFrame, check
+ *				  that it decodes and re-encodes to the same octets,
+ *				  then time both ways of decoding it.
+ *
+ * Parameter	: pName - printed name
+ *				  pfTest - asn1Test_* of T
+ *				  iterCnt - decodes
+ *
+ * Returns		: 0, 1 on an error
+ *
+ *************************************************************/
+template<typename T>
+static int sBenchType(const char *pName, T *(*pfTest)(OSCTXT *), long iterCnt)
+{
+	OSCTXT ctxt;
+	T *pValue;
+	double plainNs, sessionNs, plainAllocs = 0, sessionAllocs = 0;
+	int ret = 0;
+
+	rtInitContext(&ctxt);
+	if (nullptr == (pValue = pfTest(&ctxt)))
+	{
+		printf("[BENCH] ERROR : no value for %s\n", pName);
+		rtFreeContext(&ctxt);
+		return 1;
+	}
+
+	hae::AsnEncoded encoded = hae::encodeFrame(*pValue);
+	rtFreeContext(&ctxt);
+	if (!encoded)
+	{
+		printf("[BENCH] ERROR : %s encode %d\n", pName, encoded.error());
+		return 1;
+	}
+
+	{
+		hae::AsnMessage<T> msg = hae::decodeFrame<T>(encoded.bytes());
+		hae::AsnEncoded again = msg ? hae::encodeFrame(*msg) : hae::AsnEncoded();
+
+		if (!again || (again.size() != encoded.size()) || (0 != memcmp(again.data(), encoded.data(), encoded.size())))
+		{
+			printf("[BENCH] ERROR : %s does not re-encode to the same octets\n", pName);
+			return 1;
+		}
+	}
+
+	plainNs = sBenchPlain<T>(encoded.bytes(), iterCnt, &plainAllocs);
+	sessionNs = sBenchSession<T>(encoded.bytes(), iterCnt, &sessionAllocs);
+	if ((plainNs < 0) || (sessionNs < 0))
+	{
+		return 1;
+	}
+	if (0 != sessionAllocs)
+	{
+		printf("[BENCH] ERROR : %s session decode allocates\n", pName);
+		ret = 1;
+	}
+	printf("%-6s %6zu %7.0f ns %9.1f %7.0f ns %9.1f\n", pName, encoded.size(), plainNs, plainAllocs, sessionNs,
+		sessionAllocs);
+
+	return ret;
+}
+
+/*************************************************************
+ *
+ * Function 		: sThreadMain
+ *
+ * Description	: SPaT decodes on a thread of its own, its pool is its
+ *				  own. The last message is handed back to the caller.
+ *
+ * Parameter	: data - UPER MessageFrame carrying a SPAT
+ *				  iterCnt - decodes
+ *				  pNs - ns per decode
+ *				  pAllocs - allocations per decode after the warm-up
+ *				  pLast - the last message decoded
+ *
+ * Returns		: none
+ *
+ *************************************************************/
+static void sThreadMain(hae::span<const std::uint8_t> data, long iterCnt, double *pNs, double *pAllocs,
+	hae::AsnMessage<SPAT> *pLast)
+{
+	*pNs = sBenchSession<SPAT>(data, iterCnt, pAllocs);
+	*pLast = hae::decodeFrame<SPAT>(data);
+}
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: Cost of UPER MessageFrame decoding through the
+ *				  pooled sessions of asnSession.h, against a new
+ *				  context per message: ns/op and allocations/op
+ *				  (runtime heap and operator new). The session
+ *				  decode must not allocate once warmed up, on the
+ *				  main thread and on BENCH_THREAD_CNT threads.
+ *				  Messages decoded on a thread are dropped on the
+ *				  main thread, their contexts join its pool.
+ *
+ * Parameter	: argv[1] - decodes per message type
+ *
+ * Returns		: 0, 1 if a check fails
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	long iterCnt = BENCH_ITERCNT;
+	double ns[BENCH_THREAD_CNT], allocs[BENCH_THREAD_CNT];
+	hae::AsnMessage<SPAT> last[BENCH_THREAD_CNT];
+	std::thread thread[BENCH_THREAD_CNT];
+	OSCTXT ctxt;
+	SPAT *pSpat;
+	std::size_t idle;
+	int i, ret = 0;
+
+	if (argc > 1)
+	{
+		iterCnt = atol(argv[1]);
+	}
+	if (iterCnt <= 0)
+	{
+		printf("[BENCH] ERROR : iterations %s\n", argv[1]);
+		return 1;
+	}
+
+	/* before the first context, counts what the runtime allocates */
+	rtxMemSetAllocFuncs(sMalloc, sRealloc, sFree);
+
+	printf("%-6s %6s %10s %9s %10s %9s\n", "msg", "bytes", "plain", "alloc", "session", "alloc");
+	ret |= sBenchType<SPAT>("SPaT", asn1Test_SPAT, iterCnt);
+	ret |= sBenchType<MapData>("MAP", asn1Test_MapData, iterCnt);
+	ret |= sBenchType<BasicSafetyMessage>("BSM", asn1Test_BasicSafetyMessage, iterCnt);
+	ret |= sBenchType<PersonalSafetyMessage>("PSM", asn1Test_PersonalSafetyMessage, iterCnt);
+
+	rtInitContext(&ctxt);
+	if (nullptr == (pSpat = asn1Test_SPAT(&ctxt)))
+	{
+		printf("[BENCH] ERROR : no value for SPaT\n");
+		rtFreeContext(&ctxt);
+		return 1;
+	}
+	hae::AsnEncoded encoded = hae::encodeFrame(*pSpat);
+	rtFreeContext(&ctxt);
+
+	for (i = 0; i < BENCH_THREAD_CNT; i++)
+	{
+		thread[i] = std::thread(sThreadMain, encoded.bytes(), iterCnt, &ns[i], &allocs[i], &last[i]);
+	}
+	for (i = 0; i < BENCH_THREAD_CNT; i++)
+	{
+		thread[i].join();
+		if ((ns[i] < 0) || !last[i])
+		{
+			printf("[BENCH] ERROR : thread %d\n", i);
+			ret = 1;
+			continue;
+		}
+		printf("thread %d SPaT %7.0f ns %9.1f alloc\n", i, ns[i], allocs[i]);
+		if (0 != allocs[i])
+		{
+			printf("[BENCH] ERROR : thread %d session decode allocates\n", i);
+			ret = 1;
+		}
+	}
+
+	idle = hae::AsnSessionPool::local().idle();
+	for (i = 0; i < BENCH_THREAD_CNT; i++)
+	{
+		last[i].reset();
+	}
+	if (hae::AsnSessionPool::local().idle() != idle + BENCH_THREAD_CNT)
+	{
+		printf("[BENCH] ERROR : contexts of the threads not taken back\n");
+		ret = 1;
+	}
+	printf("main pool: %zu contexts created, %zu idle\n", hae::AsnSessionPool::local().created(),
+		hae::AsnSessionPool::local().idle());
+
+	return ret;
+}
+
+static double sNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void *sMalloc(OSSIZE size)
+{
+	bench_alloc_cnt.fetch_add(1, std::memory_order_relaxed);
+	return malloc(size);
+}
+
+static void *sRealloc(void *ptr, OSSIZE size)
+{
+	bench_alloc_cnt.fetch_add(1, std::memory_order_relaxed);
+	return realloc(ptr, size);
+}
+
+static void sFree(void *ptr)
+{
+	free(ptr);
+}
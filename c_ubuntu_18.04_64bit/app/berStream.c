@@ -0,0 +1,380 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+#include <rtxsrc/rtxStreamSocket.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "haeCommon.h"
+#include "berStream.h"
+
+#define BER_TLV_MORE			0			/* header or contents not read yet */
+#define BER_TLV_BAD				-1
+
+static int sTlvSize(const unsigned char *p, size_t avail, unsigned int depth, size_t *pLen);
+static int sDecode(BER_STREAM *pStream, const unsigned char *pTlv, size_t tlvLen, BER_STREAM_MSG *pMsg);
+static int sReserve(BER_STREAM *pStream, size_t need);
+static unsigned long long sNow(void);
+
+/*************************************************************
+ *
+ * Function 		: BerStream_Open
+ *
+ * Description	: Attach a connected TCP socket. The stream owns it
+ *				  from here on, BerStream_Close closes it.
+ *
+ * Parameter	: tlvMax - longest MessageFrame TLV, 0 for
+ *				  BER_STREAM_TLV_MAX
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int BerStream_Open(BER_STREAM *pStream, int fd, size_t tlvMax)
+{
+	memset(pStream, 0x00, sizeof(BER_STREAM));
+	pStream->tlvMax = (0 != tlvMax) ? tlvMax : BER_STREAM_TLV_MAX;
+
+	if (0 != rtInitContext(&pStream->ctxt))
+	{
+		printf("[BER] ERROR : rtInitContext()\n");
+		return HAE_ERROR;
+	}
+	if ((0 != rtInitContext(&pStream->strm)) || (0 != rtxStreamInit(&pStream->strm)) ||
+		(0 != rtxStreamSocketAttach(&pStream->strm, fd, OSRTSTRMF_INPUT)))
+	{
+		printf("[BER] ERROR : socket stream\n");
+		rtFreeContext(&pStream->strm);
+		rtFreeContext(&pStream->ctxt);
+		return HAE_ERROR;
+	}
+	if (HAE_OK != sReserve(pStream, BER_STREAM_CHUNK))
+	{
+		BerStream_Close(pStream);
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: BerStream_Run
+ *
+ * Description	: Read the connection until it is closed and hand
+ *				  every MessageFrame to pfMsg as soon as its last
+ *				  octet is in. The next read waits for pfMsg.
+ *
+ * Returns		: HAE_OK at a clean end of the connection, HAE_ERROR
+ *				  on a read error, broken framing, a TLV over
+ *				  tlvMax, a connection closed inside a TLV, or
+ *				  pfMsg asking to stop
+ *
+ *************************************************************/
+int BerStream_Run(BER_STREAM *pStream, BER_STREAM_FUNC pfMsg, void *pArg)
+{
+	BER_STREAM_MSG msg;
+	unsigned long long readNs = 0;
+	size_t tlvLen;
+	long len;
+	int ret;
+
+	for (;;)
+	{
+		/* everything complete in the buffer first */
+		while (pStream->head < pStream->tail)
+		{
+			/* MessageFrame is a SEQUENCE; a definite length is known before its contents */
+			tlvLen = 0;
+			ret = (0x30 == pStream->pBuf[pStream->head]) ?
+				sTlvSize(&pStream->pBuf[pStream->head], pStream->tail - pStream->head, 0, &tlvLen) : BER_TLV_BAD;
+			if (BER_TLV_BAD == ret)
+			{
+				printf("[BER] ERROR : no MessageFrame at stream octet %llu (0x%02x)\n",
+					pStream->byteCnt - (pStream->tail - pStream->head), pStream->pBuf[pStream->head]);
+				return HAE_ERROR;
+			}
+			if ((tlvLen > pStream->tlvMax) ||
+				((BER_TLV_MORE == ret) && (pStream->tail - pStream->head > pStream->tlvMax)))
+			{
+				printf("[BER] ERROR : MessageFrame over %zu octets at stream octet %llu\n", pStream->tlvMax,
+					pStream->byteCnt - (pStream->tail - pStream->head));
+				return HAE_ERROR;
+			}
+			if (BER_TLV_MORE == ret)
+			{
+				pStream->partialCnt++;
+				break;
+			}
+
+			sDecode(pStream, &pStream->pBuf[pStream->head], tlvLen, &msg);
+			msg.readNs = readNs;
+			pStream->head += tlvLen;
+			if (HAE_OK != pfMsg(pArg, &pStream->ctxt, &msg))
+			{
+				return HAE_ERROR;
+			}
+		}
+
+		/* keep the incomplete TLV, room for a chunk after it */
+		if (pStream->head == pStream->tail)
+		{
+			pStream->head = pStream->tail = 0;
+		}
+		else if (pStream->bufSize - pStream->tail < BER_STREAM_CHUNK)
+		{
+			memmove(pStream->pBuf, &pStream->pBuf[pStream->head], pStream->tail - pStream->head);
+			pStream->tail -= pStream->head;
+			pStream->head = 0;
+		}
+		if (HAE_OK != sReserve(pStream, pStream->tail + BER_STREAM_CHUNK))
+		{
+			return HAE_ERROR;
+		}
+
+		len = rtxStreamReadDirect(&pStream->strm, &pStream->pBuf[pStream->tail], pStream->bufSize - pStream->tail);
+		readNs = sNow();
+		if (len <= 0)
+		{
+			if ((0 == len) || (RTERR_ENDOFFILE == len))
+			{
+				if (pStream->head == pStream->tail)
+				{
+					return HAE_OK;
+				}
+				printf("[BER] ERROR : connection closed inside a TLV (%zu octets)\n", pStream->tail - pStream->head);
+			}
+			else
+			{
+				printf("[BER] ERROR : read (%ld)\n", len);
+			}
+			return HAE_ERROR;
+		}
+		pStream->tail += len;
+		pStream->readCnt++;
+		pStream->byteCnt += len;
+	}
+}
+
+void BerStream_Close(BER_STREAM *pStream)
+{
+	if (HAE_NULL != pStream->strm.pStream)
+	{
+		rtxStreamClose(&pStream->strm);
+	}
+	rtFreeContext(&pStream->strm);
+	rtFreeContext(&pStream->ctxt);
+	free(pStream->pBuf);
+	pStream->pBuf = HAE_NULL;
+	pStream->bufSize = 0;
+}
+
+/*************************************************************
+ *
+ * Function 		: BerStream_Encode
+ *
+ * Description	: UPER MessageFrame to BER, for feeding a stream.
+ *				  The value is encoded at the end of pOut and the
+ *				  frame in front of it.
+ *
+ * Parameter	: pctxt - memory for the decoded value, reset here
+ *				  ppBer / pBerLen - the BER MessageFrame in pOut
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int BerStream_Encode(OSCTXT *pctxt, const unsigned char *pUper, size_t uperLen, unsigned char *pOut, size_t outSize,
+	const unsigned char **ppBer, size_t *pBerLen)
+{
+	const ASN_TYPE *pType;
+	MessageFrame frame;
+	OSOCTET *pValueBer;
+	void *pValue;
+	int len;
+
+	rtxMemReset(pctxt);
+	pu_setBuffer(pctxt, (OSOCTET *)pUper, uperLen, FALSE);
+	if ((0 != asn1PD_MessageFrame(pctxt, &frame)) || (HAE_NULL == (pType = AsnType_FindMessage(frame.messageId))) ||
+		(HAE_NULL == (pValue = rtxMemAllocZ(pctxt, pType->size))))
+	{
+		return HAE_ERROR;
+	}
+	pu_setBuffer(pctxt, (OSOCTET *)frame.value.data, frame.value.numocts, FALSE);
+	if (0 != pType->pfPerDec(pctxt, pValue))
+	{
+		return HAE_ERROR;
+	}
+
+	xe_setp(pctxt, pOut, outSize);
+	if ((len = pType->pfBerEnc(pctxt, pValue)) < 0)
+	{
+		return HAE_ERROR;
+	}
+	pValueBer = xe_getp(pctxt);
+	frame.value.data = pValueBer;
+	frame.value.numocts = len;
+	xe_setp(pctxt, pOut, pValueBer - pOut);
+	if ((len = asn1E_MessageFrame(pctxt, &frame, ASN1EXPL)) < 0)
+	{
+		return HAE_ERROR;
+	}
+	*ppBer = xe_getp(pctxt);
+	*pBerLen = len;
+
+	return HAE_OK;
+}
+
+/* length of the TLV at p: BER_TLV_MORE until it is all in avail, nested
+   TLVs of an indefinite length are walked to the end-of-contents */
+static int sTlvSize(const unsigned char *p, size_t avail, unsigned int depth, size_t *pLen)
+{
+	size_t off = 1, len = 0, childLen;
+	unsigned int i, cnt;
+	int ret;
+
+	if (avail < 2)
+	{
+		return BER_TLV_MORE;
+	}
+	if (0x1f == (p[0] & 0x1f))
+	{
+		/* high tag number, base 128 */
+		for (i = 0; (off < avail) && (p[off] & 0x80); off++, i++)
+		{
+			if (i >= 4)
+			{
+				return BER_TLV_BAD;
+			}
+		}
+		if (++off >= avail)
+		{
+			return BER_TLV_MORE;
+		}
+	}
+
+	if (p[off] < 0x80)
+	{
+		len = p[off++];
+	}
+	else if (0x80 != p[off])
+	{
+		cnt = p[off++] & 0x7f;
+		if ((cnt > sizeof(unsigned int)) || (0x7f == cnt))
+		{
+			return BER_TLV_BAD;
+		}
+		if (off + cnt > avail)
+		{
+			return BER_TLV_MORE;
+		}
+		for (i = 0; i < cnt; i++)
+		{
+			len = (len << 8) | p[off++];
+		}
+	}
+	else
+	{
+		/* indefinite, constructed only */
+		off++;
+		if ((0 == (p[0] & 0x20)) || (depth >= BER_STREAM_DEPTH_MAX))
+		{
+			return BER_TLV_BAD;
+		}
+		for (;;)
+		{
+			if (off + 2 > avail)
+			{
+				return BER_TLV_MORE;
+			}
+			if ((0x00 == p[off]) && (0x00 == p[off + 1]))
+			{
+				*pLen = off + 2;
+				return 1;
+			}
+			if (1 != (ret = sTlvSize(&p[off], avail - off, depth + 1, &childLen)))
+			{
+				return ret;
+			}
+			off += childLen;
+		}
+	}
+
+	*pLen = off + len;
+
+	return (off + len <= avail) ? 1 : BER_TLV_MORE;
+}
+
+/* MessageFrame, then the value of its messageId, straight from the buffer */
+static int sDecode(BER_STREAM *pStream, const unsigned char *pTlv, size_t tlvLen, BER_STREAM_MSG *pMsg)
+{
+	OSCTXT *pctxt = &pStream->ctxt;
+	MessageFrame frame;
+
+	memset(pMsg, 0x00, sizeof(BER_STREAM_MSG));
+	pMsg->pTlv = pTlv;
+	pMsg->tlvLen = tlvLen;
+	pStream->msgCnt++;
+	pStream->maxTlvLen = (tlvLen > pStream->maxTlvLen) ? tlvLen : pStream->maxTlvLen;
+
+	rtxMemReset(pctxt);
+	asn1Init_MessageFrame(&frame);
+	xd_setp(pctxt, pTlv, tlvLen, 0, 0);
+	if (0 == (pMsg->status = asn1D_MessageFrame(pctxt, &frame, ASN1EXPL, 0)))
+	{
+		pMsg->messageId = frame.messageId;
+		pMsg->pType = AsnType_FindMessage(frame.messageId);
+		if ((HAE_NULL == pMsg->pType) || (HAE_NULL == (pMsg->pValue = rtxMemAllocZ(pctxt, pMsg->pType->size))))
+		{
+			pStream->unknownCnt++;
+			pMsg->status = RTERR_NOTSUPP;
+		}
+		else
+		{
+			xd_setp(pctxt, frame.value.data, frame.value.numocts, 0, 0);
+			pMsg->status = pMsg->pType->pfBerDec(pctxt, pMsg->pValue);
+		}
+	}
+	pMsg->decodedNs = sNow();
+	if (0 != pMsg->status)
+	{
+		pStream->errorCnt++;
+		pMsg->pValue = HAE_NULL;
+	}
+
+	return (0 == pMsg->status) ? HAE_OK : HAE_ERROR;
+}
+
+/* buffer of at least need octets, at most tlvMax + a chunk */
+static int sReserve(BER_STREAM *pStream, size_t need)
+{
+	unsigned char *pBuf;
+	size_t size;
+
+	if (need <= pStream->bufSize)
+	{
+		return HAE_OK;
+	}
+	for (size = (0 != pStream->bufSize) ? pStream->bufSize : 2 * BER_STREAM_CHUNK; size < need; size *= 2)
+	{
+	}
+	size = (size > pStream->tlvMax + BER_STREAM_CHUNK) ? pStream->tlvMax + BER_STREAM_CHUNK : size;
+	if ((size < need) || (HAE_NULL == (pBuf = (unsigned char *)realloc(pStream->pBuf, size))))
+	{
+		printf("[BER] ERROR : read buffer of %zu octets\n", need);
+		return HAE_ERROR;
+	}
+	pStream->pBuf = pBuf;
+	pStream->bufSize = size;
+
+	return HAE_OK;
+}
+
+static unsigned long long sNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
@@ -0,0 +1,68 @@
+#ifndef BER_STREAM_H
+#define BER_STREAM_H
+
+#include <DSRC.h>
+
+#include <stddef.h>
+
+#include "asnType.h"
+
+/* BER / DER MessageFrames off a TCP connection (backhaul feeds of the
+   central system). The connection is read through an rtxStreamSocket in
+   chunks of up to BER_STREAM_CHUNK octets into one read-ahead buffer;
+   the MessageFrame TLVs are framed there as the octets come in and each
+   is decoded in place the moment it is complete, a read may end in the
+   middle of a TLV or hold hundreds of them.
+
+   The buffer holds at most one incomplete TLV plus a chunk and the next
+   read only happens once everything complete has been handed out, so a
+   slow consumer leaves the data in the socket: the receive window fills
+   and TCP holds the sender back. A TLV longer than tlvMax ends the
+   connection, its framing cannot be trusted. Indefinite lengths are
+   followed to their end-of-contents. */
+
+#define BER_STREAM_CHUNK		65536
+#define BER_STREAM_TLV_MAX		(1024 * 1024)
+#define BER_STREAM_DEPTH_MAX	32			/* nested indefinite lengths */
+
+/* one MessageFrame, pTlv and pValue are valid during the callback */
+typedef struct{
+	const unsigned char *pTlv;
+	size_t tlvLen;
+	unsigned int messageId;
+	const ASN_TYPE *pType;				/* HAE_NULL: messageId without a type */
+	void *pValue;
+	int status;							/* 0: decoded */
+	unsigned long long readNs;			/* CLOCK_MONOTONIC, the read completing it */
+	unsigned long long decodedNs;
+} BER_STREAM_MSG;
+
+/* pctxt holds pValue, e.g. for pType->pfPrint; HAE_ERROR stops the stream */
+typedef int (*BER_STREAM_FUNC)(void *pArg, OSCTXT *pctxt, const BER_STREAM_MSG *pMsg);
+
+typedef struct{
+	OSCTXT strm;						/* socket input stream */
+	OSCTXT ctxt;						/* decode, memory reset per message */
+	unsigned char *pBuf;
+	size_t bufSize;
+	size_t head;						/* first octet not handed out */
+	size_t tail;						/* end of the octets read */
+	size_t tlvMax;
+
+	unsigned long long readCnt;
+	unsigned long long byteCnt;
+	unsigned long long msgCnt;
+	unsigned long long errorCnt;		/* decode errors */
+	unsigned long long unknownCnt;		/* messageId without a type */
+	unsigned long long partialCnt;		/* reads ending inside a TLV */
+	size_t maxTlvLen;
+} BER_STREAM;
+
+int BerStream_Open(BER_STREAM *pStream, int fd, size_t tlvMax);
+int BerStream_Run(BER_STREAM *pStream, BER_STREAM_FUNC pfMsg, void *pArg);
+void BerStream_Close(BER_STREAM *pStream);
+
+int BerStream_Encode(OSCTXT *pctxt, const unsigned char *pUper, size_t uperLen, unsigned char *pOut, size_t outSize,
+	const unsigned char **ppBer, size_t *pBerLen);
+
+#endif
@@ -0,0 +1,347 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+#include <rtxsrc/rtxPrintStream.h>
+#include <rtxsrc/rtxStreamSocket.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "decodeStats.h"
+#include "captureLog.h"
+#include "berStream.h"
+
+#define BER_TCP_PORT			60001
+#define BER_TCP_HDR_LEN			16			/* skipped by decodeSample */
+#define BER_TCP_FRAME_MAX		(64 * 1024)
+
+typedef struct{
+	unsigned short port;
+	size_t tlvMax;
+	unsigned int delayUs;				/* per message, a slow consumer */
+	int print;
+	int once;							/* one connection */
+	const char *pStatsPath;
+
+	const char *pCapDir;				/* send, NULL: receive */
+	unsigned int offset;
+	unsigned int loops;
+	const char *pTarget;
+} BER_TCP_CONFIG;
+
+typedef struct{
+	const BER_TCP_CONFIG *pConfig;
+	DECODE_STATS *pStats;
+} BER_TCP_RECV;
+
+static BER_TCP_CONFIG ber_config;
+static DECODE_STATS ber_stats;
+
+static int sParseArgs(int argc, char **argv, BER_TCP_CONFIG *pConfig);
+static int sReceive(const BER_TCP_CONFIG *pConfig);
+static int sMessage(void *pArg, OSCTXT *pctxt, const BER_STREAM_MSG *pMsg);
+static void sReport(const BER_STREAM *pStream, double elapsed);
+static int sSend(const BER_TCP_CONFIG *pConfig);
+static void sPrint(void *pPrntStrmInfo, const char *fmtspec, va_list arglist);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: Decode BER MessageFrames off TCP connections (the
+ *				  backhaul feed of a central system), or feed one:
+ *				  with -c the UPER frames of a capture (captureLog)
+ *				  are re-encoded in BER and written to host:port
+ *				  as fast as the receiver takes them.
+ *
+ * Parameter	: receive
+ *				  -p port      listen port (60001)
+ *				  -m octets    longest MessageFrame (1 MiB)
+ *				  -d usec      hold every message this long
+ *				  -v           print the messages
+ *				  -1           one connection, then exit
+ *				  -o file      decode stats snapshot (JSON)
+ *				  send
+ *				  -c dir       capture directory
+ *				  -k octets    header before the MessageFrame (16)
+ *				  -l loops     passes over the capture (1)
+ *				  host:port
+ *
+ * Returns		: 0, 1 on error
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	int ret;
+
+	if (HAE_OK != sParseArgs(argc, argv, &ber_config))
+	{
+		return 1;
+	}
+	if (HAE_NULL != ber_config.pCapDir)
+	{
+		return (HAE_OK == sSend(&ber_config)) ? 0 : 1;
+	}
+
+	/* before the first context, it installs the heap count */
+	DecodeStats_Init(&ber_stats);
+	ret = sReceive(&ber_config);
+	DecodeStats_Free(&ber_stats);
+
+	return (HAE_OK == ret) ? 0 : 1;
+}
+
+static int sParseArgs(int argc, char **argv, BER_TCP_CONFIG *pConfig)
+{
+	int opt;
+
+	memset(pConfig, 0x00, sizeof(BER_TCP_CONFIG));
+	pConfig->port = BER_TCP_PORT;
+	pConfig->offset = BER_TCP_HDR_LEN;
+	pConfig->loops = 1;
+
+	while (-1 != (opt = getopt(argc, argv, "p:m:d:v1o:c:k:l:")))
+	{
+		switch (opt)
+		{
+			case 'p': pConfig->port = atoi(optarg); break;
+			case 'm': pConfig->tlvMax = strtoul(optarg, HAE_NULL, 0); break;
+			case 'd': pConfig->delayUs = atoi(optarg); break;
+			case 'v': pConfig->print = HAE_TRUE; break;
+			case '1': pConfig->once = HAE_TRUE; break;
+			case 'o': pConfig->pStatsPath = optarg; break;
+			case 'c': pConfig->pCapDir = optarg; break;
+			case 'k': pConfig->offset = atoi(optarg); break;
+			case 'l': pConfig->loops = atoi(optarg); break;
+			default:
+				optind = argc + 1;
+				break;
+		}
+	}
+	if ((HAE_NULL != pConfig->pCapDir) && (optind == argc - 1))
+	{
+		pConfig->pTarget = argv[optind];
+		return HAE_OK;
+	}
+	if ((HAE_NULL == pConfig->pCapDir) && (optind == argc))
+	{
+		return HAE_OK;
+	}
+	printf("usage: %s [-p port] [-m octets] [-d usec] [-v] [-1] [-o stats.json]\n"
+		"       %s -c dir [-k offset] [-l loops] host:port\n", argv[0], argv[0]);
+
+	return HAE_ERROR;
+}
+
+/* one connection after the other */
+static int sReceive(const BER_TCP_CONFIG *pConfig)
+{
+	BER_TCP_RECV rx;
+	BER_STREAM stream;
+	struct sockaddr_in addr;
+	socklen_t addrLen;
+	unsigned long long start;
+	const char *pText;
+	size_t len;
+	FILE *pFile;
+	int listenFd, fd, on = 1, ret = HAE_OK;
+
+	if ((listenFd = socket(AF_INET, SOCK_STREAM, 0)) < 0)
+	{
+		printf("[BER] ERROR : socket() (%s)\n", strerror(errno));
+		return HAE_ERROR;
+	}
+	setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+	memset(&addr, 0x00, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	addr.sin_port = htons(pConfig->port);
+	if ((0 != bind(listenFd, (struct sockaddr *)&addr, sizeof(addr))) || (0 != listen(listenFd, 4)))
+	{
+		printf("[BER] ERROR : listen on %u (%s)\n", pConfig->port, strerror(errno));
+		close(listenFd);
+		return HAE_ERROR;
+	}
+	printf("listening on %u\n", pConfig->port);
+
+	rx.pConfig = pConfig;
+	rx.pStats = &ber_stats;
+	do
+	{
+		addrLen = sizeof(addr);
+		if ((fd = accept(listenFd, (struct sockaddr *)&addr, &addrLen)) < 0)
+		{
+			printf("[BER] ERROR : accept() (%s)\n", strerror(errno));
+			ret = HAE_ERROR;
+			break;
+		}
+		printf("connection from %s:%u\n", inet_ntoa(addr.sin_addr), ntohs(addr.sin_port));
+		if (HAE_OK != BerStream_Open(&stream, fd, pConfig->tlvMax))
+		{
+			close(fd);
+			ret = HAE_ERROR;
+			break;
+		}
+		if (pConfig->print)
+		{
+			rtxSetPrintStream(&stream.ctxt, sPrint, stdout);
+		}
+		start = DecodeStats_Now();
+		ret = BerStream_Run(&stream, sMessage, &rx);
+		sReport(&stream, (DecodeStats_Now() - start) * 1e-9);
+		BerStream_Close(&stream);
+	} while (!pConfig->once);
+	close(listenFd);
+
+	if (HAE_NULL != pConfig->pStatsPath)
+	{
+		pText = DecodeStats_Snapshot(&ber_stats, &len);
+		if ((HAE_NULL == (pFile = fopen(pConfig->pStatsPath, "w"))) || (len != fwrite(pText, 1, len, pFile)))
+		{
+			printf("[BER] ERROR : cannot write %s\n", pConfig->pStatsPath);
+		}
+		if (HAE_NULL != pFile)
+		{
+			fclose(pFile);
+		}
+	}
+
+	return ret;
+}
+
+static int sMessage(void *pArg, OSCTXT *pctxt, const BER_STREAM_MSG *pMsg)
+{
+	BER_TCP_RECV *pRecv = (BER_TCP_RECV *)pArg;
+	struct timespec ts;
+
+	DecodeStats_Record(pRecv->pStats, pMsg->messageId, pMsg->tlvLen, pMsg->status, pMsg->readNs, pMsg->decodedNs, 0, 0);
+	if ((pRecv->pConfig->print) && (0 == pMsg->status) && (0 != pMsg->pType->pfPrint))
+	{
+		pMsg->pType->pfPrint(pctxt, pMsg->pType->pName, pMsg->pValue);
+	}
+	if (0 != pRecv->pConfig->delayUs)
+	{
+		ts.tv_sec = pRecv->pConfig->delayUs / 1000000;
+		ts.tv_nsec = (pRecv->pConfig->delayUs % 1000000) * 1000;
+		nanosleep(&ts, HAE_NULL);
+	}
+
+	return HAE_OK;
+}
+
+static void sReport(const BER_STREAM *pStream, double elapsed)
+{
+	const STATS_MSG *pMsg;
+	const ASN_TYPE *pType;
+	unsigned int i;
+
+	printf("%llu messages, %llu bytes in %llu reads (%llu ending inside a message) in %.3f s = %.0f msg/s, "
+		"%.2f MB/s\n", pStream->msgCnt, pStream->byteCnt, pStream->readCnt, pStream->partialCnt, elapsed,
+		(elapsed > 0) ? pStream->msgCnt / elapsed : 0.0, (elapsed > 0) ? pStream->byteCnt / elapsed * 1e-6 : 0.0);
+	printf("%llu decode errors, %llu unknown messageIds, longest message %zu octets, read buffer %zu octets\n",
+		pStream->errorCnt, pStream->unknownCnt, pStream->maxTlvLen, pStream->bufSize);
+
+	printf("%-24s %10s %8s %12s %12s\n", "message", "decoded", "errors", "read->p50", "read->p99");
+	for (i = 0; i < STATS_MSG_CNT; i++)
+	{
+		pMsg = &ber_stats.msg[i];
+		if (0 == pMsg->msgCnt)
+		{
+			continue;
+		}
+		pType = AsnType_FindMessage(pMsg->messageId);
+		printf("%-24s %10llu %8llu %9.1f us %9.1f us\n", (HAE_NULL != pType) ? pType->pName : "unknown",
+			pMsg->msgCnt, pMsg->errorCnt, DecodeStats_HistPercentile(&pMsg->lat[STATS_LAT_DECODE], 0.5) * 1e-3,
+			DecodeStats_HistPercentile(&pMsg->lat[STATS_LAT_DECODE], 0.99) * 1e-3);
+	}
+}
+
+/* the capture in BER through a socket output stream */
+static int sSend(const BER_TCP_CONFIG *pConfig)
+{
+	static unsigned char out[BER_TCP_FRAME_MAX];
+	CAPTURE_READER reader;
+	CAPTURE_RECORD record;
+	const unsigned char *pBer;
+	unsigned long long start, cnt = 0, bytes = 0, uperBytes = 0, skipCnt = 0;
+	unsigned int loop, port;
+	char host[64];
+	size_t berLen;
+	double elapsed;
+	OSCTXT strm, ctxt;
+	int ret = HAE_OK;
+
+	if ((2 != sscanf(pConfig->pTarget, "%63[^:]:%u", host, &port)) || (port > 65535))
+	{
+		printf("[BER] ERROR : bad target %s\n", pConfig->pTarget);
+		return HAE_ERROR;
+	}
+	if (HAE_OK != CaptureLog_OpenReader(&reader, pConfig->pCapDir))
+	{
+		return HAE_ERROR;
+	}
+	rtInitContext(&ctxt);
+	if ((0 != rtInitContext(&strm)) || (0 != rtxStreamSocketCreateWriter(&strm, host, port)))
+	{
+		printf("[BER] ERROR : connect to %s\n", pConfig->pTarget);
+		rtFreeContext(&strm);
+		rtFreeContext(&ctxt);
+		CaptureLog_CloseReader(&reader);
+		return HAE_ERROR;
+	}
+
+	start = DecodeStats_Now();
+	for (loop = 0; (loop < pConfig->loops) && (HAE_OK == ret); loop++)
+	{
+		if ((loop > 0) && (HAE_OK != CaptureLog_Rewind(&reader)))
+		{
+			break;
+		}
+		while (HAE_OK == CaptureLog_Next(&reader, &record))
+		{
+			if ((record.len <= pConfig->offset) ||
+				(HAE_OK != BerStream_Encode(&ctxt, record.pData + pConfig->offset, record.len - pConfig->offset, out,
+				sizeof(out), &pBer, &berLen)))
+			{
+				skipCnt++;
+				continue;
+			}
+			/* blocks while the receiver is behind */
+			if (rtxStreamWrite(&strm, pBer, berLen) < 0)
+			{
+				printf("[BER] ERROR : write to %s\n", pConfig->pTarget);
+				ret = HAE_ERROR;
+				break;
+			}
+			cnt++;
+			bytes += berLen;
+			uperBytes += record.len - pConfig->offset;
+		}
+	}
+	rtxStreamFlush(&strm);
+	elapsed = (DecodeStats_Now() - start) * 1e-9;
+	printf("sent %llu messages, %llu BER bytes (UPER %llu) in %.3f s = %.0f msg/s, %.2f MB/s, %llu not encodable\n",
+		cnt, bytes, uperBytes, elapsed, (elapsed > 0) ? cnt / elapsed : 0.0, (elapsed > 0) ? bytes / elapsed * 1e-6 : 0.0,
+		skipCnt);
+
+	rtxStreamClose(&strm);
+	rtFreeContext(&strm);
+	rtFreeContext(&ctxt);
+	CaptureLog_CloseReader(&reader);
+
+	return ret;
+}
+
+static void sPrint(void *pPrntStrmInfo, const char *fmtspec, va_list arglist)
+{
+	vfprintf((FILE *)pPrntStrmInfo, fmtspec, arglist);
+}
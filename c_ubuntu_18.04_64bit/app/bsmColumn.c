@@ -0,0 +1,836 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "haeCommon.h"
+#include "bsmColumn.h"
+
+#define BSM_COL_STOP			1			/* pfBatch asked to stop */
+
+static const char *const bsm_col_name[BSM_COL_CNT] = {
+	"time", "tempId", "msgCnt", "secMark", "lat", "lon", "elev", "semiMajor", "semiMinor", "orientation",
+	"transmission", "speed", "heading", "angle", "accelLong", "accelLat", "accelVert", "yaw", "wheelBrakes",
+	"traction", "albs", "scs", "brakeBoost", "auxBrakes", "width", "length"
+};
+
+/* range of the columns that wrap, 0 for the others */
+static const unsigned int bsm_col_modulus[BSM_COL_CNT] = {
+	[BSM_COL_MSG_CNT] = 128,
+	[BSM_COL_SEC_MARK] = 60000,
+	[BSM_COL_ORIENTATION] = 65535,
+	[BSM_COL_HEADING] = 28800,
+};
+
+static int sCompareRow(const void *pA, const void *pB, void *pArg);
+static size_t sEncode(BSM_COL_WRITER *pWriter, unsigned int col, BSM_COL_DESC *pDesc, unsigned char *pData);
+static size_t sEncodeDict(BSM_COL_WRITER *pWriter, BSM_COL_DESC *pDesc, unsigned char *pData);
+static size_t sPack(unsigned char *pOut, const unsigned long long *pVal, unsigned int n, unsigned int width);
+static unsigned int sWidth(unsigned long long val);
+static int sWriteAll(int fd, const unsigned char *pData, size_t len);
+static int sScanBlock(BSM_COL_READER *pReader, const unsigned char *pBlock, const BSM_COL_BLOCK_HDR *pHdr,
+	const BSM_COL_SCAN *pScan, BSM_COL_FUNC pfBatch, void *pArg);
+static int sReserve(BSM_COL_READER *pReader, unsigned int rows, unsigned int tracks);
+static int sDecode(BSM_COL_READER *pReader, const unsigned char *pBlock, const BSM_COL_BLOCK_HDR *pHdr,
+	const BSM_COL_DESC *pDesc, unsigned int col);
+
+static inline unsigned long long sGet(const unsigned char *pData, unsigned long long bit, unsigned int width)
+{
+	unsigned long long word;
+
+	memcpy(&word, pData + (bit >> 3), sizeof(word));
+
+	return (word >> (bit & 7)) & ((1ULL << width) - 1);
+}
+
+static inline unsigned long long sZigzag(long long val)
+{
+	return ((unsigned long long)val << 1) ^ (unsigned long long)(val >> 63);
+}
+
+static inline long long sUnzigzag(unsigned long long val)
+{
+	return (long long)(val >> 1) ^ -(long long)(val & 1);
+}
+
+/* val - prev, the shorter way round when the column wraps */
+static inline long long sDelta(long long val, long long prev, long long modulus)
+{
+	long long delta = val - prev;
+
+	if (0 != modulus)
+	{
+		delta += (delta > modulus / 2) ? -modulus : ((delta < -modulus / 2) ? modulus : 0);
+	}
+
+	return delta;
+}
+
+const char *BsmColumn_Name(unsigned int col)
+{
+	return (col < BSM_COL_CNT) ? bsm_col_name[col] : "unknown";
+}
+
+/* column of a name, -1 if there is none */
+int BsmColumn_Find(const char *pName)
+{
+	int col;
+
+	for (col = 0; col < BSM_COL_CNT; col++)
+	{
+		if (0 == strcmp(pName, bsm_col_name[col]))
+		{
+			return col;
+		}
+	}
+
+	return -1;
+}
+
+/*************************************************************
+ *
+ * Function 		: BsmColumn_OpenWriter
+ *
+ * Description	: Open a columnar file for export, blocks go after
+ *				  the ones already in the file.
+ *
+ * Parameter	: rowsPerBlock - rows of a block, 0 for
+ *				  BSM_COL_BLOCK_ROWS
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int BsmColumn_OpenWriter(BSM_COL_WRITER *pWriter, const char *pPath, unsigned int rowsPerBlock)
+{
+	unsigned int col;
+	int ok = HAE_TRUE;
+
+	memset(pWriter, 0x00, sizeof(BSM_COL_WRITER));
+	pWriter->rowsPerBlock = (0 != rowsPerBlock) ? rowsPerBlock : BSM_COL_BLOCK_ROWS;
+
+	/* DELTA of a column: anchors and deltas, at most 8 octets a row each */
+	pWriter->outSize = sizeof(BSM_COL_BLOCK_HDR) + BSM_COL_CNT * (sizeof(BSM_COL_DESC) +
+		(size_t)pWriter->rowsPerBlock * 16 + 2 * BSM_COL_ALIGN);
+	for (col = 0; col < BSM_COL_CNT; col++)
+	{
+		ok &= (HAE_NULL != (pWriter->pCol[col] = malloc(pWriter->rowsPerBlock * sizeof(long long))));
+	}
+	ok &= (HAE_NULL != (pWriter->pSorted = malloc(pWriter->rowsPerBlock * sizeof(long long))));
+	ok &= (HAE_NULL != (pWriter->pOrder = malloc(pWriter->rowsPerBlock * sizeof(unsigned int))));
+	ok &= (HAE_NULL != (pWriter->pPack = malloc(pWriter->rowsPerBlock * sizeof(unsigned long long))));
+	ok &= (HAE_NULL != (pWriter->pOut = malloc(pWriter->outSize)));
+	if (!ok)
+	{
+		printf("[COLUMN] ERROR : no memory for %u rows\n", pWriter->rowsPerBlock);
+		pWriter->fd = -1;
+		BsmColumn_CloseWriter(pWriter);
+		return HAE_ERROR;
+	}
+
+	pWriter->fd = open(pPath, O_WRONLY | O_CREAT | O_APPEND, 0644);
+	if (pWriter->fd < 0)
+	{
+		printf("[COLUMN] ERROR : cannot open %s (%s)\n", pPath, strerror(errno));
+		BsmColumn_CloseWriter(pWriter);
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: BsmColumn_Append
+ *
+ * Description	: Add the coreData of one decoded BSM, the block is
+ *				  written when it is full.
+ *
+ * Parameter	: timeNs - CLOCK_REALTIME of the receive
+ *				  uperLen - octets of its MessageFrame, for the
+ *				  size comparison
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int BsmColumn_Append(BSM_COL_WRITER *pWriter, unsigned long long timeNs, const BSMcoreData *pCore, unsigned int uperLen)
+{
+	unsigned int row = pWriter->rowCnt;
+	long long **ppCol = pWriter->pCol;
+
+	if (pWriter->fd < 0)
+	{
+		return HAE_ERROR;
+	}
+
+	ppCol[BSM_COL_TIME][row] = timeNs / 1000;
+	ppCol[BSM_COL_TEMP_ID][row] = ((unsigned int)pCore->id.data[0] << 24) | (pCore->id.data[1] << 16) |
+		(pCore->id.data[2] << 8) | pCore->id.data[3];
+	ppCol[BSM_COL_MSG_CNT][row] = pCore->msgCnt;
+	ppCol[BSM_COL_SEC_MARK][row] = pCore->secMark;
+	ppCol[BSM_COL_LAT][row] = pCore->lat;
+	ppCol[BSM_COL_LON][row] = pCore->long_;
+	ppCol[BSM_COL_ELEV][row] = pCore->elev;
+	ppCol[BSM_COL_SEMI_MAJOR][row] = pCore->accuracy.semiMajor;
+	ppCol[BSM_COL_SEMI_MINOR][row] = pCore->accuracy.semiMinor;
+	ppCol[BSM_COL_ORIENTATION][row] = pCore->accuracy.orientation;
+	ppCol[BSM_COL_TRANSMISSION][row] = pCore->transmission;
+	ppCol[BSM_COL_SPEED][row] = pCore->speed;
+	ppCol[BSM_COL_HEADING][row] = pCore->heading;
+	ppCol[BSM_COL_ANGLE][row] = pCore->angle;
+	ppCol[BSM_COL_ACCEL_LONG][row] = pCore->accelSet.long_;
+	ppCol[BSM_COL_ACCEL_LAT][row] = pCore->accelSet.lat;
+	ppCol[BSM_COL_ACCEL_VERT][row] = pCore->accelSet.vert;
+	ppCol[BSM_COL_YAW][row] = pCore->accelSet.yaw;
+	/* BIT STRING (SIZE (5)), the octet as it is */
+	ppCol[BSM_COL_WHEEL_BRAKES][row] = pCore->brakes.wheelBrakes.data[0];
+	ppCol[BSM_COL_TRACTION][row] = pCore->brakes.traction;
+	ppCol[BSM_COL_ALBS][row] = pCore->brakes.albs;
+	ppCol[BSM_COL_SCS][row] = pCore->brakes.scs;
+	ppCol[BSM_COL_BRAKE_BOOST][row] = pCore->brakes.brakeBoost;
+	ppCol[BSM_COL_AUX_BRAKES][row] = pCore->brakes.auxBrakes;
+	ppCol[BSM_COL_WIDTH][row] = pCore->size.width;
+	ppCol[BSM_COL_LENGTH][row] = pCore->size.length;
+
+	pWriter->rowCnt++;
+	pWriter->uperBytes += uperLen;
+	pWriter->totalRowCnt++;
+	pWriter->uperByteCnt += uperLen;
+
+	return (pWriter->rowCnt < pWriter->rowsPerBlock) ? HAE_OK : BsmColumn_Flush(pWriter);
+}
+
+/*************************************************************
+ *
+ * Function 		: BsmColumn_Flush
+ *
+ * Description	: Sort the open block by (TemporaryID, time), encode
+ *				  its columns and write it with one write().
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int BsmColumn_Flush(BSM_COL_WRITER *pWriter)
+{
+	BSM_COL_BLOCK_HDR *pHdr = (BSM_COL_BLOCK_HDR *)pWriter->pOut;
+	BSM_COL_DESC *pDesc = (BSM_COL_DESC *)(pHdr + 1);
+	unsigned int i, col;
+	size_t pos, len;
+	int ret;
+
+	if ((pWriter->fd < 0) || (0 == pWriter->rowCnt))
+	{
+		return HAE_OK;
+	}
+
+	for (i = 0; i < pWriter->rowCnt; i++)
+	{
+		pWriter->pOrder[i] = i;
+	}
+	qsort_r(pWriter->pOrder, pWriter->rowCnt, sizeof(unsigned int), sCompareRow, pWriter);
+
+	memset(pWriter->pOut, 0x00, sizeof(BSM_COL_BLOCK_HDR) + BSM_COL_CNT * sizeof(BSM_COL_DESC));
+	pos = sizeof(BSM_COL_BLOCK_HDR) + BSM_COL_CNT * sizeof(BSM_COL_DESC);
+	for (col = 0; col < BSM_COL_CNT; col++)
+	{
+		if (BSM_COL_TEMP_ID == col)
+		{
+			len = sEncodeDict(pWriter, &pDesc[col], pWriter->pOut + pos);
+		}
+		else
+		{
+			len = sEncode(pWriter, col, &pDesc[col], pWriter->pOut + pos);
+		}
+		pDesc[col].off = pos;
+		pDesc[col].len = len;
+		pWriter->colByteCnt[col] += len;
+		pos += (len + BSM_COL_ALIGN - 1) & ~(size_t)(BSM_COL_ALIGN - 1);
+	}
+
+	pHdr->magic = BSM_COL_FILE_MAGIC;
+	pHdr->version = BSM_COL_FILE_VERSION;
+	pHdr->hdrSize = sizeof(BSM_COL_BLOCK_HDR);
+	pHdr->blockLen = pos;
+	pHdr->rowCnt = pWriter->rowCnt;
+	pHdr->colCnt = BSM_COL_CNT;
+	pHdr->uperBytes = pWriter->uperBytes;
+
+	ret = sWriteAll(pWriter->fd, pWriter->pOut, pos);
+	if (HAE_OK != ret)
+	{
+		printf("[COLUMN] ERROR : write block (%s)\n", strerror(errno));
+	}
+	else
+	{
+		pWriter->blockCnt++;
+		pWriter->fileByteCnt += pos;
+	}
+	pWriter->rowCnt = 0;
+	pWriter->uperBytes = 0;
+
+	return ret;
+}
+
+void BsmColumn_CloseWriter(BSM_COL_WRITER *pWriter)
+{
+	unsigned int col;
+
+	BsmColumn_Flush(pWriter);
+	if (pWriter->fd >= 0)
+	{
+		close(pWriter->fd);
+		pWriter->fd = -1;
+	}
+	for (col = 0; col < BSM_COL_CNT; col++)
+	{
+		free(pWriter->pCol[col]);
+		pWriter->pCol[col] = HAE_NULL;
+	}
+	free(pWriter->pSorted);
+	free(pWriter->pOrder);
+	free(pWriter->pPack);
+	free(pWriter->pOut);
+	pWriter->pSorted = HAE_NULL;
+	pWriter->pOrder = HAE_NULL;
+	pWriter->pPack = HAE_NULL;
+	pWriter->pOut = HAE_NULL;
+}
+
+/*************************************************************
+ *
+ * Function 		: BsmColumn_OpenReader
+ *
+ * Description	: Map a columnar file for scans.
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int BsmColumn_OpenReader(BSM_COL_READER *pReader, const char *pPath)
+{
+	struct stat st;
+	void *pMap;
+
+	memset(pReader, 0x00, sizeof(BSM_COL_READER));
+	if ((pReader->fd = open(pPath, O_RDONLY)) < 0)
+	{
+		printf("[COLUMN] ERROR : cannot open %s (%s)\n", pPath, strerror(errno));
+		return HAE_ERROR;
+	}
+	if ((0 != fstat(pReader->fd, &st)) || ((size_t)st.st_size < sizeof(BSM_COL_BLOCK_HDR)))
+	{
+		printf("[COLUMN] ERROR : %s is empty\n", pPath);
+		BsmColumn_CloseReader(pReader);
+		return HAE_ERROR;
+	}
+	pMap = mmap(HAE_NULL, st.st_size, PROT_READ, MAP_PRIVATE, pReader->fd, 0);
+	if (MAP_FAILED == pMap)
+	{
+		printf("[COLUMN] ERROR : mmap %s (%s)\n", pPath, strerror(errno));
+		BsmColumn_CloseReader(pReader);
+		return HAE_ERROR;
+	}
+	pReader->pMap = (const unsigned char *)pMap;
+	pReader->mapLen = st.st_size;
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: BsmColumn_Scan
+ *
+ * Description	: Hand every block that can hold rows in the ranges
+ *				  of pScan to pfBatch, with the columns of colMask and
+ *				  of the ranges unpacked and the rows selected.
+ *
+ * Returns		: selected rows, HAE_ERROR on a damaged file
+ *
+ *************************************************************/
+int BsmColumn_Scan(BSM_COL_READER *pReader, const BSM_COL_SCAN *pScan, BSM_COL_FUNC pfBatch, void *pArg)
+{
+	BSM_COL_BLOCK_HDR hdr;
+	size_t pos = 0;
+	int ret = HAE_OK;
+
+	pReader->blockCnt = 0;
+	pReader->skipCnt = 0;
+	pReader->rowCnt = 0;
+	pReader->selCnt = 0;
+	pReader->byteCnt = 0;
+
+	while ((HAE_OK == ret) && (pos + sizeof(BSM_COL_BLOCK_HDR) <= pReader->mapLen))
+	{
+		memcpy(&hdr, pReader->pMap + pos, sizeof(hdr));
+		if ((BSM_COL_FILE_MAGIC != hdr.magic) || (BSM_COL_FILE_VERSION != hdr.version) ||
+			(BSM_COL_CNT != hdr.colCnt) || (hdr.blockLen < hdr.hdrSize + BSM_COL_CNT * sizeof(BSM_COL_DESC)) ||
+			(pos + hdr.blockLen > pReader->mapLen) || (0 == hdr.rowCnt) || (0 != (pos % BSM_COL_ALIGN)))
+		{
+			printf("[COLUMN] ERROR : damaged block at %zu\n", pos);
+			return HAE_ERROR;
+		}
+		pReader->blockCnt++;
+		ret = sScanBlock(pReader, pReader->pMap + pos, &hdr, pScan, pfBatch, pArg);
+		pos += hdr.blockLen;
+	}
+
+	return (HAE_ERROR == ret) ? HAE_ERROR : (int)pReader->selCnt;
+}
+
+void BsmColumn_CloseReader(BSM_COL_READER *pReader)
+{
+	unsigned int col;
+
+	if (HAE_NULL != pReader->pMap)
+	{
+		munmap((void *)pReader->pMap, pReader->mapLen);
+		pReader->pMap = HAE_NULL;
+	}
+	if (pReader->fd >= 0)
+	{
+		close(pReader->fd);
+		pReader->fd = -1;
+	}
+	for (col = 0; col < BSM_COL_CNT; col++)
+	{
+		free(pReader->pCol[col]);
+		pReader->pCol[col] = HAE_NULL;
+	}
+	free(pReader->pSel);
+	free(pReader->pTrackLen);
+	pReader->pSel = HAE_NULL;
+	pReader->pTrackLen = HAE_NULL;
+	pReader->bufRows = 0;
+	pReader->bufTracks = 0;
+}
+
+/* (TemporaryID, time, arrival) */
+static int sCompareRow(const void *pA, const void *pB, void *pArg)
+{
+	const BSM_COL_WRITER *pWriter = (const BSM_COL_WRITER *)pArg;
+	unsigned int a = *(const unsigned int *)pA, b = *(const unsigned int *)pB;
+	const long long *pId = pWriter->pCol[BSM_COL_TEMP_ID], *pTime = pWriter->pCol[BSM_COL_TIME];
+
+	if (pId[a] != pId[b])
+	{
+		return (pId[a] < pId[b]) ? -1 : 1;
+	}
+	if (pTime[a] != pTime[b])
+	{
+		return (pTime[a] < pTime[b]) ? -1 : 1;
+	}
+
+	return (a < b) ? -1 : (a > b);
+}
+
+/* the smaller of FOR and DELTA, RAW if the range is too wide to pack */
+static size_t sEncode(BSM_COL_WRITER *pWriter, unsigned int col, BSM_COL_DESC *pDesc, unsigned char *pData)
+{
+	const long long *pId = pWriter->pCol[BSM_COL_TEMP_ID];
+	const unsigned int *pOrder = pWriter->pOrder;
+	long long *pVal = pWriter->pSorted;
+	unsigned long long *pPack = pWriter->pPack;
+	unsigned long long zz, minZz = ~0ULL, maxZz = 0, maxAnchor = 0, anchor;
+	unsigned int i, n = pWriter->rowCnt, tracks = 0, forWidth, deltaWidth, anchorWidth;
+	long long modulus;
+	size_t len;
+
+	pDesc->min = pDesc->max = pVal[0] = pWriter->pCol[col][pOrder[0]];
+	for (i = 1; i < n; i++)
+	{
+		pVal[i] = pWriter->pCol[col][pOrder[i]];
+		pDesc->min = (pVal[i] < pDesc->min) ? pVal[i] : pDesc->min;
+		pDesc->max = (pVal[i] > pDesc->max) ? pVal[i] : pDesc->max;
+	}
+	if (pDesc->min == pDesc->max)
+	{
+		pDesc->enc = BSM_COL_CONST;
+		return 0;
+	}
+
+	forWidth = sWidth(pDesc->max - pDesc->min);
+	if (forWidth > BSM_COL_PACK_MAX)
+	{
+		pDesc->enc = BSM_COL_RAW;
+		memcpy(pData, pVal, n * sizeof(long long));
+		return n * sizeof(long long);
+	}
+
+	/* modulo only when every value is in the range */
+	modulus = ((pDesc->min >= 0) && (pDesc->max < bsm_col_modulus[col])) ? bsm_col_modulus[col] : 0;
+	for (i = 0; i < n; i++)
+	{
+		if ((0 == i) || (pId[pOrder[i]] != pId[pOrder[i - 1]]))
+		{
+			tracks++;
+			/* not below min, the offset fits unsigned */
+			anchor = (unsigned long long)(pVal[i] - pDesc->min);
+			maxAnchor = (anchor > maxAnchor) ? anchor : maxAnchor;
+			continue;
+		}
+		zz = sZigzag(sDelta(pVal[i], pVal[i - 1], modulus));
+		minZz = (zz < minZz) ? zz : minZz;
+		maxZz = (zz > maxZz) ? zz : maxZz;
+	}
+	anchorWidth = sWidth(maxAnchor);
+	deltaWidth = (tracks < n) ? sWidth(maxZz - minZz) : 0;
+
+	if ((tracks < n) && (deltaWidth <= BSM_COL_PACK_MAX) &&
+		((unsigned long long)tracks * anchorWidth + (unsigned long long)n * deltaWidth < (unsigned long long)n * forWidth))
+	{
+		pDesc->enc = BSM_COL_DELTA;
+		pDesc->width = deltaWidth;
+		pDesc->anchorWidth = anchorWidth;
+		pDesc->trackCnt = tracks;
+		pDesc->base = minZz;
+		pDesc->modulus = modulus;
+
+		for (i = 0, tracks = 0; i < n; i++)
+		{
+			if ((0 == i) || (pId[pOrder[i]] != pId[pOrder[i - 1]]))
+			{
+				pPack[tracks++] = pVal[i] - pDesc->min;
+			}
+		}
+		len = sPack(pData, pPack, tracks, anchorWidth);
+		for (i = 0; i < n; i++)
+		{
+			/* 0 at the anchors */
+			pPack[i] = 0;
+			if ((0 != i) && (pId[pOrder[i]] == pId[pOrder[i - 1]]))
+			{
+				pPack[i] = sZigzag(sDelta(pVal[i], pVal[i - 1], modulus)) - minZz;
+			}
+		}
+		len += sPack(pData + len, pPack, n, deltaWidth);
+	}
+	else
+	{
+		pDesc->enc = BSM_COL_FOR;
+		pDesc->width = forWidth;
+		for (i = 0; i < n; i++)
+		{
+			pPack[i] = pVal[i] - pDesc->min;
+		}
+		len = sPack(pData, pPack, n, forWidth);
+	}
+	memset(pData + len, 0x00, sizeof(unsigned long long));
+
+	return len + sizeof(unsigned long long);
+}
+
+/* TemporaryID of every track, 4 octets each, then the track lengths - 1 */
+static size_t sEncodeDict(BSM_COL_WRITER *pWriter, BSM_COL_DESC *pDesc, unsigned char *pData)
+{
+	const long long *pId = pWriter->pCol[BSM_COL_TEMP_ID];
+	const unsigned int *pOrder = pWriter->pOrder;
+	unsigned long long *pPack = pWriter->pPack;
+	unsigned long long maxLen = 0;
+	unsigned int i, id, tracks = 0, n = pWriter->rowCnt;
+	size_t len;
+
+	pDesc->enc = BSM_COL_DICT;
+	pDesc->min = pId[pOrder[0]];
+	pDesc->max = pId[pOrder[n - 1]];
+	for (i = 0; i < n; i++)
+	{
+		if ((0 == i) || (pId[pOrder[i]] != pId[pOrder[i - 1]]))
+		{
+			id = pId[pOrder[i]];
+			memcpy(pData + tracks * sizeof(unsigned int), &id, sizeof(unsigned int));
+			pPack[tracks++] = 0;
+		}
+		else
+		{
+			pPack[tracks - 1]++;
+			maxLen = (pPack[tracks - 1] > maxLen) ? pPack[tracks - 1] : maxLen;
+		}
+	}
+	pDesc->trackCnt = tracks;
+	pDesc->width = sWidth(maxLen);
+
+	len = tracks * sizeof(unsigned int);
+	len += sPack(pData + len, pPack, tracks, pDesc->width);
+	memset(pData + len, 0x00, sizeof(unsigned long long));
+
+	return len + sizeof(unsigned long long);
+}
+
+static size_t sPack(unsigned char *pOut, const unsigned long long *pVal, unsigned int n, unsigned int width)
+{
+	unsigned long long acc = 0;
+	unsigned int i, bits = 0;
+	size_t len = 0;
+
+	if (0 == width)
+	{
+		return 0;
+	}
+	for (i = 0; i < n; i++)
+	{
+		acc |= pVal[i] << bits;
+		bits += width;
+		while (bits >= 8)
+		{
+			pOut[len++] = (unsigned char)acc;
+			acc >>= 8;
+			bits -= 8;
+		}
+	}
+	if (bits > 0)
+	{
+		pOut[len++] = (unsigned char)acc;
+	}
+
+	return len;
+}
+
+static unsigned int sWidth(unsigned long long val)
+{
+	return (0 == val) ? 0 : 64 - __builtin_clzll(val);
+}
+
+static int sWriteAll(int fd, const unsigned char *pData, size_t len)
+{
+	ssize_t n;
+
+	while (len > 0)
+	{
+		n = write(fd, pData, len);
+		if (n < 0)
+		{
+			if (EINTR == errno)
+			{
+				continue;
+			}
+			return HAE_ERROR;
+		}
+		pData += n;
+		len -= n;
+	}
+
+	return HAE_OK;
+}
+
+static int sScanBlock(BSM_COL_READER *pReader, const unsigned char *pBlock, const BSM_COL_BLOCK_HDR *pHdr,
+	const BSM_COL_SCAN *pScan, BSM_COL_FUNC pfBatch, void *pArg)
+{
+	const BSM_COL_DESC *pDesc = (const BSM_COL_DESC *)(pBlock + pHdr->hdrSize);
+	const BSM_COL_RANGE *pRange;
+	const long long *pVal;
+	BSM_COL_BATCH batch;
+	unsigned int i, col, r, need = pScan->colMask;
+	unsigned char *pSel;
+	long long min, max;
+
+	/* the block min / max first, most blocks stop here */
+	for (r = 0; r < pScan->rangeCnt; r++)
+	{
+		pRange = &pScan->range[r];
+		if ((pRange->col >= BSM_COL_CNT) || (pDesc[pRange->col].max < pRange->min) ||
+			(pDesc[pRange->col].min > pRange->max))
+		{
+			pReader->skipCnt++;
+			return HAE_OK;
+		}
+		need |= 1U << pRange->col;
+	}
+	for (col = 0; col < BSM_COL_CNT; col++)
+	{
+		if ((pDesc[col].off < pHdr->hdrSize) || ((size_t)pDesc[col].off + pDesc[col].len > pHdr->blockLen) ||
+			(pDesc[col].width > BSM_COL_PACK_MAX) || (pDesc[col].anchorWidth > BSM_COL_PACK_MAX))
+		{
+			printf("[COLUMN] ERROR : damaged column %s\n", bsm_col_name[col]);
+			return HAE_ERROR;
+		}
+	}
+	if (HAE_OK != sReserve(pReader, pHdr->rowCnt, pDesc[BSM_COL_TEMP_ID].trackCnt))
+	{
+		return HAE_ERROR;
+	}
+
+	/* track lengths first, TemporaryID and DELTA columns need them */
+	memset(&batch, 0x00, sizeof(batch));
+	if (HAE_OK != sDecode(pReader, pBlock, pHdr, pDesc, BSM_COL_TEMP_ID))
+	{
+		return HAE_ERROR;
+	}
+	for (col = 0; col < BSM_COL_CNT; col++)
+	{
+		if (0 == (need & (1U << col)))
+		{
+			continue;
+		}
+		if ((BSM_COL_TEMP_ID != col) && (HAE_OK != sDecode(pReader, pBlock, pHdr, pDesc, col)))
+		{
+			return HAE_ERROR;
+		}
+		batch.pCol[col] = pReader->pCol[col];
+		pReader->byteCnt += pDesc[col].len;
+	}
+
+	pSel = pReader->pSel;
+	memset(pSel, 1, pHdr->rowCnt);
+	for (r = 0; r < pScan->rangeCnt; r++)
+	{
+		pVal = pReader->pCol[pScan->range[r].col];
+		min = pScan->range[r].min;
+		max = pScan->range[r].max;
+		for (i = 0; i < pHdr->rowCnt; i++)
+		{
+			pSel[i] &= (pVal[i] >= min) & (pVal[i] <= max);
+		}
+	}
+	for (i = 0; i < pHdr->rowCnt; i++)
+	{
+		batch.selCnt += pSel[i];
+	}
+
+	pReader->rowCnt += pHdr->rowCnt;
+	pReader->selCnt += batch.selCnt;
+	if (0 == batch.selCnt)
+	{
+		return HAE_OK;
+	}
+	batch.rowCnt = pHdr->rowCnt;
+	batch.pSel = pSel;
+	batch.pDesc = pDesc;
+
+	return (HAE_OK == pfBatch(pArg, &batch)) ? HAE_OK : BSM_COL_STOP;
+}
+
+static int sReserve(BSM_COL_READER *pReader, unsigned int rows, unsigned int tracks)
+{
+	unsigned int col;
+	void *pBuf;
+
+	if (rows > pReader->bufRows)
+	{
+		for (col = 0; col < BSM_COL_CNT; col++)
+		{
+			if (HAE_NULL == (pBuf = realloc(pReader->pCol[col], rows * sizeof(long long))))
+			{
+				printf("[COLUMN] ERROR : no memory for %u rows\n", rows);
+				return HAE_ERROR;
+			}
+			pReader->pCol[col] = pBuf;
+		}
+		if (HAE_NULL == (pBuf = realloc(pReader->pSel, rows)))
+		{
+			printf("[COLUMN] ERROR : no memory for %u rows\n", rows);
+			return HAE_ERROR;
+		}
+		pReader->pSel = pBuf;
+		pReader->bufRows = rows;
+	}
+	if (tracks > pReader->bufTracks)
+	{
+		if (HAE_NULL == (pBuf = realloc(pReader->pTrackLen, tracks * sizeof(unsigned int))))
+		{
+			printf("[COLUMN] ERROR : no memory for %u tracks\n", tracks);
+			return HAE_ERROR;
+		}
+		pReader->pTrackLen = pBuf;
+		pReader->bufTracks = tracks;
+	}
+
+	return HAE_OK;
+}
+
+static int sDecode(BSM_COL_READER *pReader, const unsigned char *pBlock, const BSM_COL_BLOCK_HDR *pHdr,
+	const BSM_COL_DESC *pDesc, unsigned int col)
+{
+	const BSM_COL_DESC *pCol = &pDesc[col];
+	const unsigned char *pData = pBlock + pCol->off;
+	const unsigned int *pTrackLen = pReader->pTrackLen;
+	unsigned int tracks = pDesc[BSM_COL_TEMP_ID].trackCnt;
+	unsigned int i, k, t, id, n = pHdr->rowCnt;
+	long long *pOut = pReader->pCol[col];
+	unsigned long long bit, need;
+	long long val;
+
+	/* packed bits, 8 spare octets after them */
+	switch (pCol->enc)
+	{
+		case BSM_COL_CONST: need = 0; break;
+		case BSM_COL_FOR: need = ((unsigned long long)n * pCol->width + 7) / 8 + 8; break;
+		case BSM_COL_DELTA:
+			need = ((unsigned long long)tracks * pCol->anchorWidth + 7) / 8 + ((unsigned long long)n * pCol->width + 7) / 8 + 8;
+			break;
+		case BSM_COL_DICT: need = (unsigned long long)tracks * 4 + ((unsigned long long)tracks * pCol->width + 7) / 8 + 8; break;
+		case BSM_COL_RAW: need = (unsigned long long)n * sizeof(long long); break;
+		default: need = ~0ULL; break;
+	}
+	if ((need > pCol->len) || ((BSM_COL_DICT == pCol->enc) != (BSM_COL_TEMP_ID == col)) ||
+		((BSM_COL_DELTA == pCol->enc) && (pCol->trackCnt != tracks)))
+	{
+		printf("[COLUMN] ERROR : damaged column %s\n", bsm_col_name[col]);
+		return HAE_ERROR;
+	}
+
+	switch (pCol->enc)
+	{
+		case BSM_COL_CONST:
+			for (i = 0; i < n; i++)
+			{
+				pOut[i] = pCol->min;
+			}
+			break;
+		case BSM_COL_FOR:
+			for (i = 0, bit = 0; i < n; i++, bit += pCol->width)
+			{
+				pOut[i] = pCol->min + (long long)sGet(pData, bit, pCol->width);
+			}
+			break;
+		case BSM_COL_DELTA:
+			/* anchor of every track, then the deltas along it */
+			bit = ((unsigned long long)tracks * pCol->anchorWidth + 7) / 8 * 8;
+			for (t = 0, i = 0; t < tracks; t++)
+			{
+				val = pCol->min + (long long)sGet(pData, (unsigned long long)t * pCol->anchorWidth, pCol->anchorWidth);
+				pOut[i++] = val;
+				for (k = 1; k < pTrackLen[t]; k++, i++)
+				{
+					val += sUnzigzag(sGet(pData, bit + (unsigned long long)i * pCol->width, pCol->width) + pCol->base);
+					if (0 != pCol->modulus)
+					{
+						val += (val >= (long long)pCol->modulus) ? -(long long)pCol->modulus :
+							((val < 0) ? (long long)pCol->modulus : 0);
+					}
+					pOut[i] = val;
+				}
+			}
+			break;
+		case BSM_COL_DICT:
+			for (t = 0, i = 0; t < tracks; t++)
+			{
+				memcpy(&id, pData + t * sizeof(unsigned int), sizeof(unsigned int));
+				pReader->pTrackLen[t] = (unsigned int)sGet(pData + tracks * sizeof(unsigned int),
+					(unsigned long long)t * pCol->width, pCol->width) + 1;
+				if (pReader->pTrackLen[t] > n - i)
+				{
+					printf("[COLUMN] ERROR : damaged column %s\n", bsm_col_name[col]);
+					return HAE_ERROR;
+				}
+				for (k = 0; k < pReader->pTrackLen[t]; k++)
+				{
+					pOut[i++] = id;
+				}
+			}
+			if (i != n)
+			{
+				printf("[COLUMN] ERROR : damaged column %s\n", bsm_col_name[col]);
+				return HAE_ERROR;
+			}
+			break;
+		case BSM_COL_RAW:
+			memcpy(pOut, pData, n * sizeof(long long));
+			break;
+	}
+
+	return HAE_OK;
+}
@@ -0,0 +1,170 @@
+#ifndef BSM_COLUMN_H
+#define BSM_COLUMN_H
+
+#include <stddef.h>
+#include <DSRC.h>
+
+/* Columnar file of decoded BSMcoreData for offline scans. The file is a
+   sequence of blocks of up to rowsPerBlock rows. In a block the rows are
+   sorted by (TemporaryID, time), so a column holds one vehicle track
+   after the other, and each column is stored on its own:
+
+     BSM_COL_CONST   every row is min, no data
+     BSM_COL_FOR     value - min, bit-packed
+     BSM_COL_DELTA   per track: first value - min bit-packed (anchors),
+                     then zigzag(value - previous) - base bit-packed; the
+                     counters that wrap (msgCnt, secMark, heading ...)
+                     take the difference modulo their range
+     BSM_COL_DICT    TemporaryID: one id per track and the track lengths,
+                     bit-packed
+     BSM_COL_RAW     64 bit values (ranges too wide to pack)
+
+   The writer takes the smaller of FOR and DELTA per column and block.
+   Every column keeps its min / max in the block header, a scan skips the
+   blocks whose ranges miss its predicates and unpacks only the columns
+   it asks for. Bits are packed least significant first; a column has 8
+   spare octets at its end so the unpack loads 64 bits at any position. */
+
+#define BSM_COL_FILE_MAGIC		0x48434f4c	/* "HCOL" */
+#define BSM_COL_FILE_VERSION	1
+#define BSM_COL_BLOCK_ROWS		65536
+#define BSM_COL_ALIGN			8
+#define BSM_COL_PACK_MAX		56			/* widest packed value */
+#define BSM_COL_RANGE_MAX		8
+
+/* columns, time is the receive time in microseconds */
+#define BSM_COL_TIME			0
+#define BSM_COL_TEMP_ID			1
+#define BSM_COL_MSG_CNT			2
+#define BSM_COL_SEC_MARK		3
+#define BSM_COL_LAT				4
+#define BSM_COL_LON				5
+#define BSM_COL_ELEV			6
+#define BSM_COL_SEMI_MAJOR		7
+#define BSM_COL_SEMI_MINOR		8
+#define BSM_COL_ORIENTATION		9
+#define BSM_COL_TRANSMISSION	10
+#define BSM_COL_SPEED			11
+#define BSM_COL_HEADING			12
+#define BSM_COL_ANGLE			13
+#define BSM_COL_ACCEL_LONG		14
+#define BSM_COL_ACCEL_LAT		15
+#define BSM_COL_ACCEL_VERT		16
+#define BSM_COL_YAW				17
+#define BSM_COL_WHEEL_BRAKES	18
+#define BSM_COL_TRACTION		19
+#define BSM_COL_ALBS			20
+#define BSM_COL_SCS				21
+#define BSM_COL_BRAKE_BOOST		22
+#define BSM_COL_AUX_BRAKES		23
+#define BSM_COL_WIDTH			24
+#define BSM_COL_LENGTH			25
+#define BSM_COL_CNT				26
+
+/* encodings */
+#define BSM_COL_CONST			0
+#define BSM_COL_FOR				1
+#define BSM_COL_DELTA			2
+#define BSM_COL_DICT			3
+#define BSM_COL_RAW				4
+
+typedef struct{
+	unsigned int magic;
+	unsigned int version;
+	unsigned int hdrSize;				/* column descriptors follow */
+	unsigned int blockLen;
+	unsigned int rowCnt;
+	unsigned int colCnt;
+	unsigned int uperBytes;				/* UPER MessageFrames of the rows */
+	unsigned int reserved;
+} BSM_COL_BLOCK_HDR;
+
+typedef struct{
+	unsigned char enc;
+	unsigned char width;				/* bits of a packed value */
+	unsigned char anchorWidth;			/* DELTA: bits of an anchor */
+	unsigned char reserved;
+	unsigned int trackCnt;				/* DICT / DELTA */
+	long long min;
+	long long max;
+	long long base;						/* DELTA: smallest zigzag delta */
+	unsigned int modulus;				/* DELTA: differences modulo, 0 none */
+	unsigned int reserved2;
+	unsigned int off;					/* from the block start */
+	unsigned int len;
+} BSM_COL_DESC;
+
+typedef struct{
+	int fd;
+	unsigned int rowsPerBlock;
+	unsigned int rowCnt;				/* of the open block */
+	unsigned int uperBytes;
+	long long *pCol[BSM_COL_CNT];
+	long long *pSorted;
+	unsigned int *pOrder;
+	unsigned long long *pPack;
+	unsigned char *pOut;
+	size_t outSize;
+
+	unsigned long long totalRowCnt;
+	unsigned long long blockCnt;
+	unsigned long long uperByteCnt;
+	unsigned long long fileByteCnt;
+	unsigned long long colByteCnt[BSM_COL_CNT];
+} BSM_COL_WRITER;
+
+/* rows with min <= column <= max */
+typedef struct{
+	unsigned int col;
+	long long min;
+	long long max;
+} BSM_COL_RANGE;
+
+typedef struct{
+	BSM_COL_RANGE range[BSM_COL_RANGE_MAX];
+	unsigned int rangeCnt;
+	unsigned int colMask;				/* 1 << BSM_COL_*, columns to unpack */
+} BSM_COL_SCAN;
+
+/* one block of a scan; pCol[] of the columns not asked for are NULL */
+typedef struct{
+	unsigned int rowCnt;
+	unsigned int selCnt;
+	const unsigned char *pSel;			/* 1: the row is in every range */
+	const long long *pCol[BSM_COL_CNT];
+	const BSM_COL_DESC *pDesc;
+} BSM_COL_BATCH;
+
+/* return HAE_ERROR to stop the scan */
+typedef int (*BSM_COL_FUNC)(void *pArg, const BSM_COL_BATCH *pBatch);
+
+typedef struct{
+	int fd;
+	const unsigned char *pMap;
+	size_t mapLen;
+	long long *pCol[BSM_COL_CNT];		/* unpacked columns of a block */
+	unsigned char *pSel;
+	unsigned int *pTrackLen;
+	unsigned int bufRows;
+	unsigned int bufTracks;
+
+	unsigned long long blockCnt;		/* of the last scan */
+	unsigned long long skipCnt;			/* blocks out of its ranges */
+	unsigned long long rowCnt;			/* rows of the blocks read */
+	unsigned long long selCnt;
+	unsigned long long byteCnt;			/* column data unpacked */
+} BSM_COL_READER;
+
+const char *BsmColumn_Name(unsigned int col);
+int BsmColumn_Find(const char *pName);
+
+int BsmColumn_OpenWriter(BSM_COL_WRITER *pWriter, const char *pPath, unsigned int rowsPerBlock);
+int BsmColumn_Append(BSM_COL_WRITER *pWriter, unsigned long long timeNs, const BSMcoreData *pCore, unsigned int uperLen);
+int BsmColumn_Flush(BSM_COL_WRITER *pWriter);
+void BsmColumn_CloseWriter(BSM_COL_WRITER *pWriter);
+
+int BsmColumn_OpenReader(BSM_COL_READER *pReader, const char *pPath);
+int BsmColumn_Scan(BSM_COL_READER *pReader, const BSM_COL_SCAN *pScan, BSM_COL_FUNC pfBatch, void *pArg);
+void BsmColumn_CloseReader(BSM_COL_READER *pReader);
+
+#endif
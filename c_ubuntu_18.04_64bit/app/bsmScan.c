@@ -0,0 +1,317 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "haeCommon.h"
+#include "msgArchive.h"
+#include "bsmColumn.h"
+
+typedef struct{
+	const char *pFile;
+	const char *pArchive;				/* export, NULL: scan */
+	unsigned int rowsPerBlock;
+	unsigned int loops;
+	BSM_COL_SCAN scan;
+} SCAN_CONFIG;
+
+/* export: decode context and the writer */
+typedef struct{
+	OSCTXT ctxt;
+	BSM_COL_WRITER writer;
+	unsigned long long errorCnt;
+} SCAN_EXPORT;
+
+/* scan: sum / min / max of the selected rows per column */
+typedef struct{
+	long long sum[BSM_COL_CNT];
+	long long min[BSM_COL_CNT];
+	long long max[BSM_COL_CNT];
+	unsigned long long selCnt;
+} SCAN_AGG;
+
+static SCAN_CONFIG scan_config;
+
+static int sParseArgs(int argc, char **argv, SCAN_CONFIG *pConfig);
+static int sExport(const SCAN_CONFIG *pConfig);
+static int sExportRecord(void *pArg, const ARCHIVE_RECORD *pRecord);
+static int sScan(const SCAN_CONFIG *pConfig);
+static int sAggregate(void *pArg, const BSM_COL_BATCH *pBatch);
+static unsigned long long sNow(void);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: Export the BSMs of an archive (msgArchive) into a
+ *				  columnar file (bsmColumn), or scan one: rows in
+ *				  the column ranges of -w are selected and the
+ *				  columns of -c summed up (count, min, mean, max).
+ *
+ * Parameter	: file          columnar file
+ *				  -e archive    export the BSMs of archive
+ *				  -r rows       rows of a block (65536)
+ *				  -w col=min:max  range, up to 8
+ *				  -c col,col    columns to aggregate (all)
+ *				  -l loops      scans, for the throughput (1)
+ *
+ * Returns		: 0, 1 on error
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	if (HAE_OK != sParseArgs(argc, argv, &scan_config))
+	{
+		return 1;
+	}
+	if (HAE_NULL != scan_config.pArchive)
+	{
+		return (HAE_OK == sExport(&scan_config)) ? 0 : 1;
+	}
+
+	return (HAE_OK == sScan(&scan_config)) ? 0 : 1;
+}
+
+static int sParseArgs(int argc, char **argv, SCAN_CONFIG *pConfig)
+{
+	BSM_COL_RANGE *pRange;
+	char name[32], *pTok, *pSave;
+	int opt, col, ok = HAE_TRUE;
+
+	memset(pConfig, 0x00, sizeof(SCAN_CONFIG));
+	pConfig->loops = 1;
+
+	while (-1 != (opt = getopt(argc, argv, "e:r:w:c:l:")))
+	{
+		switch (opt)
+		{
+			case 'e': pConfig->pArchive = optarg; break;
+			case 'r': pConfig->rowsPerBlock = atoi(optarg); break;
+			case 'l': pConfig->loops = atoi(optarg); break;
+			case 'w':
+				if (pConfig->scan.rangeCnt >= BSM_COL_RANGE_MAX)
+				{
+					ok = HAE_FALSE;
+					break;
+				}
+				pRange = &pConfig->scan.range[pConfig->scan.rangeCnt++];
+				if ((3 != sscanf(optarg, "%31[^=]=%lld:%lld", name, &pRange->min, &pRange->max)) ||
+					((col = BsmColumn_Find(name)) < 0))
+				{
+					printf("[COLUMN] ERROR : bad range %s\n", optarg);
+					ok = HAE_FALSE;
+					break;
+				}
+				pRange->col = col;
+				break;
+			case 'c':
+				for (pTok = strtok_r(optarg, ",", &pSave); HAE_NULL != pTok; pTok = strtok_r(HAE_NULL, ",", &pSave))
+				{
+					if ((col = BsmColumn_Find(pTok)) < 0)
+					{
+						printf("[COLUMN] ERROR : no column %s\n", pTok);
+						ok = HAE_FALSE;
+						break;
+					}
+					pConfig->scan.colMask |= 1U << col;
+				}
+				break;
+			default:
+				ok = HAE_FALSE;
+				break;
+		}
+	}
+	if ((!ok) || (optind != argc - 1) || (0 == pConfig->loops))
+	{
+		printf("usage: %s -e archive [-r rows] file\n"
+			"       %s [-w col=min:max]... [-c col,col] [-l loops] file\n", argv[0], argv[0]);
+		return HAE_ERROR;
+	}
+	if (0 == pConfig->scan.colMask)
+	{
+		pConfig->scan.colMask = (1U << BSM_COL_CNT) - 1;
+	}
+	pConfig->pFile = argv[optind];
+
+	return HAE_OK;
+}
+
+static int sExport(const SCAN_CONFIG *pConfig)
+{
+	static SCAN_EXPORT exp;
+	ARCHIVE_READER reader;
+	ARCHIVE_QUERY query;
+	BSM_COL_WRITER *pWriter = &exp.writer;
+	unsigned int col;
+	int cnt;
+
+	if (0 != rtInitContext(&exp.ctxt))
+	{
+		printf("[COLUMN] ERROR : rtInitContext()\n");
+		return HAE_ERROR;
+	}
+	if (HAE_OK != MsgArchive_OpenReader(&reader, pConfig->pArchive))
+	{
+		rtFreeContext(&exp.ctxt);
+		return HAE_ERROR;
+	}
+	if (HAE_OK != BsmColumn_OpenWriter(pWriter, pConfig->pFile, pConfig->rowsPerBlock))
+	{
+		MsgArchive_CloseReader(&reader);
+		rtFreeContext(&exp.ctxt);
+		return HAE_ERROR;
+	}
+
+	memset(&query, 0x00, sizeof(query));
+	query.messageId = ASN1V_basicSafetyMessage;
+	query.endNs = ~0ULL;
+	cnt = MsgArchive_Query(&reader, &query, sExportRecord, &exp);
+	BsmColumn_CloseWriter(pWriter);
+	MsgArchive_CloseReader(&reader);
+	rtFreeContext(&exp.ctxt);
+	if (cnt < 0)
+	{
+		return HAE_ERROR;
+	}
+
+	printf("exported %llu BSMs in %llu blocks, %llu decode errors\n", pWriter->totalRowCnt, pWriter->blockCnt,
+		exp.errorCnt);
+	printf("UPER %llu bytes, columnar %llu bytes = %.1fx smaller, %.2f bits per row\n", pWriter->uperByteCnt,
+		pWriter->fileByteCnt, (0 != pWriter->fileByteCnt) ? (double)pWriter->uperByteCnt / pWriter->fileByteCnt : 0.0,
+		(0 != pWriter->totalRowCnt) ? pWriter->fileByteCnt * 8.0 / pWriter->totalRowCnt : 0.0);
+	for (col = 0; col < BSM_COL_CNT; col++)
+	{
+		printf("  %-14s %10llu bytes %6.2f bits/row\n", BsmColumn_Name(col), pWriter->colByteCnt[col],
+			(0 != pWriter->totalRowCnt) ? pWriter->colByteCnt[col] * 8.0 / pWriter->totalRowCnt : 0.0);
+	}
+
+	return HAE_OK;
+}
+
+static int sExportRecord(void *pArg, const ARCHIVE_RECORD *pRecord)
+{
+	SCAN_EXPORT *pExp = (SCAN_EXPORT *)pArg;
+	BasicSafetyMessage bsm;
+	MessageFrame frame;
+
+	rtxMemReset(&pExp->ctxt);
+	pu_setBuffer(&pExp->ctxt, (OSOCTET *)pRecord->pFrame, pRecord->len, FALSE);
+	if (0 == asn1PD_MessageFrame(&pExp->ctxt, &frame))
+	{
+		asn1Init_BasicSafetyMessage(&bsm);
+		pu_setBuffer(&pExp->ctxt, (OSOCTET *)frame.value.data, frame.value.numocts, FALSE);
+		if (0 == asn1PD_BasicSafetyMessage(&pExp->ctxt, &bsm))
+		{
+			return BsmColumn_Append(&pExp->writer, pRecord->timeNs, &bsm.coreData, pRecord->len);
+		}
+	}
+	pExp->errorCnt++;
+
+	return HAE_OK;
+}
+
+static int sScan(const SCAN_CONFIG *pConfig)
+{
+	BSM_COL_READER reader;
+	SCAN_AGG agg;
+	unsigned long long start, elapsed;
+	unsigned int loop, col;
+	int cnt = 0;
+
+	if (HAE_OK != BsmColumn_OpenReader(&reader, pConfig->pFile))
+	{
+		return HAE_ERROR;
+	}
+
+	start = sNow();
+	for (loop = 0; (loop < pConfig->loops) && (cnt >= 0); loop++)
+	{
+		for (col = 0; col < BSM_COL_CNT; col++)
+		{
+			agg.sum[col] = 0;
+			agg.min[col] = 0x7fffffffffffffffLL;
+			agg.max[col] = -0x7fffffffffffffffLL - 1;
+		}
+		agg.selCnt = 0;
+		cnt = BsmColumn_Scan(&reader, &pConfig->scan, sAggregate, &agg);
+	}
+	elapsed = sNow() - start;
+	if (cnt < 0)
+	{
+		BsmColumn_CloseReader(&reader);
+		return HAE_ERROR;
+	}
+
+	printf("%llu of %llu rows selected, %llu of %llu blocks skipped by min/max\n", agg.selCnt, reader.rowCnt,
+		reader.skipCnt, reader.blockCnt);
+	printf("%.3f ms per scan, %.0f Mrows/s, %.1f MB/s packed, %.1f MB/s unpacked\n", elapsed * 1e-6 / pConfig->loops,
+		(0 != elapsed) ? reader.rowCnt * pConfig->loops * 1e3 / elapsed : 0.0,
+		(0 != elapsed) ? reader.byteCnt * pConfig->loops * 1e3 / elapsed : 0.0,
+		(0 != elapsed) ? reader.rowCnt * __builtin_popcount(pConfig->scan.colMask) * 8.0 * pConfig->loops * 1e3 / elapsed : 0.0);
+	if (0 == agg.selCnt)
+	{
+		BsmColumn_CloseReader(&reader);
+		return HAE_OK;
+	}
+
+	printf("%-14s %14s %16s %14s\n", "column", "min", "mean", "max");
+	for (col = 0; col < BSM_COL_CNT; col++)
+	{
+		if (pConfig->scan.colMask & (1U << col))
+		{
+			printf("%-14s %14lld %16.2f %14lld\n", BsmColumn_Name(col), agg.min[col], (double)agg.sum[col] / agg.selCnt,
+				agg.max[col]);
+		}
+	}
+	BsmColumn_CloseReader(&reader);
+
+	return HAE_OK;
+}
+
+static int sAggregate(void *pArg, const BSM_COL_BATCH *pBatch)
+{
+	SCAN_AGG *pAgg = (SCAN_AGG *)pArg;
+	const unsigned char *pSel = pBatch->pSel;
+	const long long *pVal;
+	long long sum, min, max;
+	unsigned int i, col;
+
+	for (col = 0; col < BSM_COL_CNT; col++)
+	{
+		if (HAE_NULL == (pVal = pBatch->pCol[col]))
+		{
+			continue;
+		}
+		sum = 0;
+		min = pAgg->min[col];
+		max = pAgg->max[col];
+		for (i = 0; i < pBatch->rowCnt; i++)
+		{
+			if (pSel[i])
+			{
+				sum += pVal[i];
+				min = (pVal[i] < min) ? pVal[i] : min;
+				max = (pVal[i] > max) ? pVal[i] : max;
+			}
+		}
+		pAgg->sum[col] += sum;
+		pAgg->min[col] = min;
+		pAgg->max[col] = max;
+	}
+	pAgg->selCnt += pBatch->selCnt;
+
+	return HAE_OK;
+}
+
+static unsigned long long sNow(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
@@ -0,0 +1,426 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "haeCommon.h"
+#include "captureLog.h"
+
+#define CAPTURE_NAME_FMT		"%s/capture-%06u.hcap"
+
+static int sFindSegment(const char *pDir, int highest, unsigned int *pSegment);
+static int sCreateSegment(CAPTURE_WRITER *pWriter);
+static int sWriteAll(int fd, const unsigned char *pData, size_t len);
+static int sMapSegment(CAPTURE_READER *pReader, unsigned int segment);
+static void sUnmap(CAPTURE_READER *pReader);
+static unsigned long long sClockNs(clockid_t clock);
+
+/*************************************************************
+ *
+ * Function 		: CaptureLog_OpenWriter
+ *
+ * Description	: Create the first segment, after the ones already
+ *				  in pDir; nothing is overwritten.
+ *
+ * Parameter	: pDir - directory, created if missing
+ *				  segmentBytes - size of a segment, 0 for
+ *				  CAPTURE_SEGMENT_SIZE
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int CaptureLog_OpenWriter(CAPTURE_WRITER *pWriter, const char *pDir, size_t segmentBytes)
+{
+	memset(pWriter, 0x00, sizeof(CAPTURE_WRITER));
+	pWriter->fd = -1;
+	snprintf(pWriter->dir, sizeof(pWriter->dir), "%s", pDir);
+	pWriter->segmentBytes = (segmentBytes > CAPTURE_BUF_SIZE) ? segmentBytes : CAPTURE_SEGMENT_SIZE;
+
+	if ((0 != mkdir(pDir, 0755)) && (EEXIST != errno))
+	{
+		printf("[CAPTURE] ERROR : mkdir %s (%s)\n", pDir, strerror(errno));
+		return HAE_ERROR;
+	}
+	if (HAE_OK == sFindSegment(pDir, HAE_TRUE, &pWriter->segment))
+	{
+		pWriter->segment++;
+	}
+
+	if (HAE_NULL == (pWriter->pBuf = malloc(CAPTURE_BUF_SIZE)))
+	{
+		printf("[CAPTURE] ERROR : no memory for the buffer\n");
+		return HAE_ERROR;
+	}
+
+	return sCreateSegment(pWriter);
+}
+
+/*************************************************************
+ *
+ * Function 		: CaptureLog_Append
+ *
+ * Description	: Add one datagram. Called from the receive loop; the
+ *				  buffer is written when it is full, older than
+ *				  CAPTURE_FLUSH_MS or the segment is full.
+ *
+ * Parameter	: monoNs - CLOCK_MONOTONIC at receive
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int CaptureLog_Append(CAPTURE_WRITER *pWriter, const unsigned char *pData, unsigned int len, unsigned long long monoNs,
+	const struct sockaddr_in *pSource)
+{
+	CAPTURE_REC_HDR *pHdr;
+	size_t recSize;
+
+	if ((pWriter->fd < 0) || (len > CAPTURE_DATA_MAX))
+	{
+		return HAE_ERROR;
+	}
+	recSize = (sizeof(CAPTURE_REC_HDR) + len + CAPTURE_ALIGN - 1) & ~(size_t)(CAPTURE_ALIGN - 1);
+
+	if ((pWriter->fileLen + recSize > pWriter->segmentBytes) && (pWriter->fileLen > sizeof(CAPTURE_FILE_HDR)))
+	{
+		if ((HAE_OK != CaptureLog_Flush(pWriter)) || (HAE_OK != sCreateSegment(pWriter)))
+		{
+			return HAE_ERROR;
+		}
+	}
+	if ((pWriter->bufLen + recSize > CAPTURE_BUF_SIZE) && (HAE_OK != CaptureLog_Flush(pWriter)))
+	{
+		return HAE_ERROR;
+	}
+
+	pHdr = (CAPTURE_REC_HDR *)(pWriter->pBuf + pWriter->bufLen);
+	memset(pHdr, 0x00, sizeof(CAPTURE_REC_HDR));
+	pHdr->monoNs = monoNs;
+	pHdr->len = len;
+	if (HAE_NULL != pSource)
+	{
+		pHdr->srcAddr = pSource->sin_addr.s_addr;
+		pHdr->srcPort = pSource->sin_port;
+	}
+	memcpy(pHdr + 1, pData, len);
+	memset((unsigned char *)(pHdr + 1) + len, 0x00, recSize - sizeof(CAPTURE_REC_HDR) - len);
+
+	if (0 == pWriter->bufLen)
+	{
+		pWriter->bufFirstNs = monoNs;
+	}
+	pWriter->bufLen += recSize;
+	pWriter->fileLen += recSize;
+	pWriter->recordCnt++;
+	pWriter->byteCnt += len;
+
+	if (monoNs - pWriter->bufFirstNs >= CAPTURE_FLUSH_MS * 1000000ULL)
+	{
+		return CaptureLog_Flush(pWriter);
+	}
+
+	return HAE_OK;
+}
+
+int CaptureLog_Flush(CAPTURE_WRITER *pWriter)
+{
+	int ret = HAE_OK;
+
+	if ((pWriter->fd >= 0) && (pWriter->bufLen > 0))
+	{
+		ret = sWriteAll(pWriter->fd, pWriter->pBuf, pWriter->bufLen);
+		if (HAE_OK != ret)
+		{
+			pWriter->writeErrorCnt++;
+			printf("[CAPTURE] ERROR : write segment %u (%s)\n", pWriter->segment - 1, strerror(errno));
+		}
+		pWriter->bufLen = 0;
+	}
+
+	return ret;
+}
+
+/*************************************************************
+ *
+ * Function 		: CaptureLog_Tick
+ *
+ * Description	: Write the buffer once it is older than
+ *				  CAPTURE_FLUSH_MS. CaptureLog_Append only checks
+ *				  the age when a datagram comes in; without a tick
+ *				  the last records of a quiet channel stay in memory.
+ *
+ * Parameter	: monoNs - CLOCK_MONOTONIC now
+ *
+ * Returns		: HAE_OK, HAE_ERROR if the write failed
+ *
+ *************************************************************/
+int CaptureLog_Tick(CAPTURE_WRITER *pWriter, unsigned long long monoNs)
+{
+	if ((0 == pWriter->bufLen) || (monoNs < pWriter->bufFirstNs) ||
+		(monoNs - pWriter->bufFirstNs < CAPTURE_FLUSH_MS * 1000000ULL))
+	{
+		return HAE_OK;
+	}
+
+	return CaptureLog_Flush(pWriter);
+}
+
+void CaptureLog_CloseWriter(CAPTURE_WRITER *pWriter)
+{
+	CaptureLog_Flush(pWriter);
+	if (pWriter->fd >= 0)
+	{
+		close(pWriter->fd);
+		pWriter->fd = -1;
+	}
+	free(pWriter->pBuf);
+	pWriter->pBuf = HAE_NULL;
+}
+
+/*************************************************************
+ *
+ * Function 		: CaptureLog_OpenReader
+ *
+ * Description	: Map the oldest segment of pDir.
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int CaptureLog_OpenReader(CAPTURE_READER *pReader, const char *pDir)
+{
+	memset(pReader, 0x00, sizeof(CAPTURE_READER));
+	pReader->fd = -1;
+	snprintf(pReader->dir, sizeof(pReader->dir), "%s", pDir);
+
+	return CaptureLog_Rewind(pReader);
+}
+
+int CaptureLog_Rewind(CAPTURE_READER *pReader)
+{
+	unsigned int segment;
+
+	sUnmap(pReader);
+	if (HAE_OK != sFindSegment(pReader->dir, HAE_FALSE, &segment))
+	{
+		printf("[CAPTURE] ERROR : no capture segment in %s\n", pReader->dir);
+		return HAE_ERROR;
+	}
+
+	return sMapSegment(pReader, segment);
+}
+
+/*************************************************************
+ *
+ * Function 		: CaptureLog_Next
+ *
+ * Description	: The next record, from the next segment when the
+ *				  mapped one is done. Segments are read in order until
+ *				  one is missing.
+ *
+ * Returns		: HAE_OK, HAE_ERROR at the end of the log
+ *
+ *************************************************************/
+int CaptureLog_Next(CAPTURE_READER *pReader, CAPTURE_RECORD *pRecord)
+{
+	CAPTURE_REC_HDR hdr;
+	size_t recSize;
+
+	while (HAE_NULL != pReader->pMap)
+	{
+		if (pReader->pos + sizeof(CAPTURE_REC_HDR) <= pReader->mapLen)
+		{
+			memcpy(&hdr, pReader->pMap + pReader->pos, sizeof(hdr));
+			recSize = (sizeof(CAPTURE_REC_HDR) + hdr.len + CAPTURE_ALIGN - 1) & ~(size_t)(CAPTURE_ALIGN - 1);
+			if ((hdr.len <= CAPTURE_DATA_MAX) && (pReader->pos + recSize <= pReader->mapLen))
+			{
+				pRecord->monoNs = hdr.monoNs;
+				memset(&pRecord->source, 0x00, sizeof(pRecord->source));
+				pRecord->source.sin_family = AF_INET;
+				pRecord->source.sin_addr.s_addr = hdr.srcAddr;
+				pRecord->source.sin_port = hdr.srcPort;
+				pRecord->len = hdr.len;
+				pRecord->pData = pReader->pMap + pReader->pos + sizeof(CAPTURE_REC_HDR);
+				pReader->pos += recSize;
+				pReader->recordCnt++;
+				return HAE_OK;
+			}
+		}
+		if (pReader->pos < pReader->mapLen)
+		{
+			/* the writer stopped in the middle of a record */
+			pReader->tornCnt++;
+		}
+		if (HAE_OK != sMapSegment(pReader, pReader->segment + 1))
+		{
+			break;
+		}
+	}
+
+	return HAE_ERROR;
+}
+
+void CaptureLog_CloseReader(CAPTURE_READER *pReader)
+{
+	sUnmap(pReader);
+}
+
+/* lowest or highest segment number in pDir */
+static int sFindSegment(const char *pDir, int highest, unsigned int *pSegment)
+{
+	DIR *pDirp;
+	struct dirent *pEntry;
+	unsigned int segment;
+	char tail[8];
+	int found = HAE_FALSE;
+
+	if (HAE_NULL == (pDirp = opendir(pDir)))
+	{
+		return HAE_ERROR;
+	}
+	while (HAE_NULL != (pEntry = readdir(pDirp)))
+	{
+		if ((2 != sscanf(pEntry->d_name, "capture-%u.%7s", &segment, tail)) || (0 != strcmp(tail, "hcap")))
+		{
+			continue;
+		}
+		if ((HAE_FALSE == found) || (highest ? (segment > *pSegment) : (segment < *pSegment)))
+		{
+			*pSegment = segment;
+			found = HAE_TRUE;
+		}
+	}
+	closedir(pDirp);
+
+	return found ? HAE_OK : HAE_ERROR;
+}
+
+static int sCreateSegment(CAPTURE_WRITER *pWriter)
+{
+	char path[CAPTURE_PATH_MAX + 32];
+	CAPTURE_FILE_HDR hdr;
+
+	if (pWriter->fd >= 0)
+	{
+		close(pWriter->fd);
+	}
+	snprintf(path, sizeof(path), CAPTURE_NAME_FMT, pWriter->dir, pWriter->segment);
+	pWriter->fd = open(path, O_WRONLY | O_CREAT | O_EXCL | O_APPEND, 0644);
+	if (pWriter->fd < 0)
+	{
+		printf("[CAPTURE] ERROR : cannot create %s (%s)\n", path, strerror(errno));
+		return HAE_ERROR;
+	}
+
+	memset(&hdr, 0x00, sizeof(hdr));
+	hdr.magic = CAPTURE_FILE_MAGIC;
+	hdr.version = CAPTURE_FILE_VERSION;
+	hdr.hdrSize = sizeof(hdr);
+	hdr.segment = pWriter->segment;
+	hdr.realNs = sClockNs(CLOCK_REALTIME);
+	hdr.monoNs = sClockNs(CLOCK_MONOTONIC);
+
+	/* the header goes out with the first records */
+	memcpy(pWriter->pBuf, &hdr, sizeof(hdr));
+	pWriter->bufLen = sizeof(hdr);
+	pWriter->bufFirstNs = hdr.monoNs;
+	pWriter->fileLen = sizeof(hdr);
+	pWriter->segment++;
+
+	return HAE_OK;
+}
+
+static int sWriteAll(int fd, const unsigned char *pData, size_t len)
+{
+	ssize_t n;
+
+	while (len > 0)
+	{
+		n = write(fd, pData, len);
+		if (n < 0)
+		{
+			if (EINTR == errno)
+			{
+				continue;
+			}
+			return HAE_ERROR;
+		}
+		pData += n;
+		len -= n;
+	}
+
+	return HAE_OK;
+}
+
+static int sMapSegment(CAPTURE_READER *pReader, unsigned int segment)
+{
+	char path[CAPTURE_PATH_MAX + 32];
+	struct stat st;
+	void *pMap;
+	int fd;
+
+	snprintf(path, sizeof(path), CAPTURE_NAME_FMT, pReader->dir, segment);
+	if ((fd = open(path, O_RDONLY)) < 0)
+	{
+		return HAE_ERROR;
+	}
+	if ((0 != fstat(fd, &st)) || ((size_t)st.st_size < sizeof(CAPTURE_FILE_HDR)))
+	{
+		printf("[CAPTURE] ERROR : %s is too short\n", path);
+		close(fd);
+		return HAE_ERROR;
+	}
+	pMap = mmap(HAE_NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (MAP_FAILED == pMap)
+	{
+		printf("[CAPTURE] ERROR : mmap %s (%s)\n", path, strerror(errno));
+		close(fd);
+		return HAE_ERROR;
+	}
+	madvise(pMap, st.st_size, MADV_SEQUENTIAL);
+
+	sUnmap(pReader);
+	pReader->fd = fd;
+	pReader->pMap = (const unsigned char *)pMap;
+	pReader->mapLen = st.st_size;
+	pReader->segment = segment;
+	memcpy(&pReader->hdr, pMap, sizeof(CAPTURE_FILE_HDR));
+	if ((CAPTURE_FILE_MAGIC != pReader->hdr.magic) || (CAPTURE_FILE_VERSION != pReader->hdr.version) ||
+		(pReader->hdr.hdrSize < sizeof(CAPTURE_FILE_HDR)) || (pReader->hdr.hdrSize > pReader->mapLen))
+	{
+		printf("[CAPTURE] ERROR : %s is not a capture segment\n", path);
+		sUnmap(pReader);
+		return HAE_ERROR;
+	}
+	pReader->pos = pReader->hdr.hdrSize;
+
+	return HAE_OK;
+}
+
+static void sUnmap(CAPTURE_READER *pReader)
+{
+	if (HAE_NULL != pReader->pMap)
+	{
+		munmap((void *)pReader->pMap, pReader->mapLen);
+		pReader->pMap = HAE_NULL;
+	}
+	if (pReader->fd >= 0)
+	{
+		close(pReader->fd);
+		pReader->fd = -1;
+	}
+}
+
+static unsigned long long sClockNs(clockid_t clock)
+{
+	struct timespec ts;
+
+	clock_gettime(clock, &ts);
+
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
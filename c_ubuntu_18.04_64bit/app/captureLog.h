@@ -0,0 +1,102 @@
+#ifndef CAPTURE_LOG_H
+#define CAPTURE_LOG_H
+
+#include <stddef.h>
+#include <netinet/in.h>
+
+/* Capture of the received datagrams, append only, in segments:
+
+     <dir>/capture-000000.hcap, capture-000001.hcap, ...
+
+   A segment is a CAPTURE_FILE_HDR followed by records, each a
+   CAPTURE_REC_HDR and the datagram as received (header included), padded
+   to CAPTURE_ALIGN. The writer collects records in a buffer and writes it
+   with one write() when it is full or older than CAPTURE_FLUSH_MS, so the
+   receive loop does a large sequential write now and then instead of one
+   per datagram. CaptureLog_Tick, from a timer of the receive loop, writes
+   out a buffer that gets old on a quiet channel; a segment is closed and the next one created when it
+   reaches segmentBytes. A killed process loses at most the buffer, a
+   torn last record ends the segment for the reader.
+
+   The reader maps one segment at a time (mmap, MADV_SEQUENTIAL) and hands
+   out the records in place, segment after segment. The timestamps are
+   CLOCK_MONOTONIC of the capturing host; the segment header holds a
+   CLOCK_REALTIME / CLOCK_MONOTONIC pair taken at its creation. */
+
+#define CAPTURE_FILE_MAGIC		0x48434150	/* "HCAP" */
+#define CAPTURE_FILE_VERSION	1
+#define CAPTURE_ALIGN			8
+#define CAPTURE_BUF_SIZE		(1024 * 1024)
+#define CAPTURE_FLUSH_MS		1000
+#define CAPTURE_SEGMENT_SIZE	(64 * 1024 * 1024)
+#define CAPTURE_DATA_MAX		65535
+#define CAPTURE_PATH_MAX		256
+
+typedef struct{
+	unsigned int magic;
+	unsigned int version;
+	unsigned int hdrSize;				/* offset of the first record */
+	unsigned int segment;
+	unsigned long long realNs;			/* CLOCK_REALTIME at creation */
+	unsigned long long monoNs;			/* CLOCK_MONOTONIC at creation */
+} CAPTURE_FILE_HDR;
+
+typedef struct{
+	unsigned long long monoNs;			/* receive time */
+	unsigned int len;					/* octets of the datagram */
+	unsigned int srcAddr;				/* network order */
+	unsigned short srcPort;				/* network order */
+	unsigned short reserved;
+	unsigned int reserved2;
+} CAPTURE_REC_HDR;
+
+typedef struct{
+	char dir[CAPTURE_PATH_MAX];
+	size_t segmentBytes;
+	unsigned int segment;				/* next one to create */
+	int fd;
+	size_t fileLen;						/* of the open segment, written + buffered */
+
+	unsigned char *pBuf;
+	size_t bufLen;
+	unsigned long long bufFirstNs;		/* oldest record in the buffer */
+
+	unsigned long long recordCnt;
+	unsigned long long byteCnt;
+	unsigned long writeErrorCnt;
+} CAPTURE_WRITER;
+
+typedef struct{
+	char dir[CAPTURE_PATH_MAX];
+	unsigned int segment;				/* mapped one */
+	int fd;
+	const unsigned char *pMap;
+	size_t mapLen;
+	size_t pos;
+	CAPTURE_FILE_HDR hdr;
+
+	unsigned long long recordCnt;
+	unsigned long tornCnt;				/* segments that end in a partial record */
+} CAPTURE_READER;
+
+/* one record of the reader, pData points into the mapping */
+typedef struct{
+	unsigned long long monoNs;
+	struct sockaddr_in source;
+	unsigned int len;
+	const unsigned char *pData;
+} CAPTURE_RECORD;
+
+int CaptureLog_OpenWriter(CAPTURE_WRITER *pWriter, const char *pDir, size_t segmentBytes);
+int CaptureLog_Append(CAPTURE_WRITER *pWriter, const unsigned char *pData, unsigned int len, unsigned long long monoNs,
+	const struct sockaddr_in *pSource);
+int CaptureLog_Flush(CAPTURE_WRITER *pWriter);
+int CaptureLog_Tick(CAPTURE_WRITER *pWriter, unsigned long long monoNs);
+void CaptureLog_CloseWriter(CAPTURE_WRITER *pWriter);
+
+int CaptureLog_OpenReader(CAPTURE_READER *pReader, const char *pDir);
+int CaptureLog_Next(CAPTURE_READER *pReader, CAPTURE_RECORD *pRecord);
+int CaptureLog_Rewind(CAPTURE_READER *pReader);
+void CaptureLog_CloseReader(CAPTURE_READER *pReader);
+
+#endif
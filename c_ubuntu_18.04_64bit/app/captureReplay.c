@@ -0,0 +1,265 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "decodeStats.h"
+#include "captureLog.h"
+
+#define REPLAY_HDR_LEN			16			/* skipped by decodeSample */
+
+typedef struct{
+	const char *pDir;
+	double speed;						/* 0: max */
+	unsigned int loops;
+	unsigned int offset;
+	const char *pTarget;				/* a.b.c.d:port, NULL: decode here */
+	const char *pStatsPath;
+} REPLAY_CONFIG;
+
+static REPLAY_CONFIG replay_config = { HAE_NULL, 1.0, 1, REPLAY_HDR_LEN, HAE_NULL, HAE_NULL };
+static DECODE_STATS replay_stats;
+
+static int sParseArgs(int argc, char **argv, REPLAY_CONFIG *pConfig);
+static int sOpenTarget(const char *pTarget, struct sockaddr_in *pAddr);
+static int sDecode(const CAPTURE_RECORD *pRecord, unsigned int offset);
+static void sReport(const REPLAY_CONFIG *pConfig, unsigned long long cnt, unsigned long long bytes,
+	unsigned long long errorCnt, double elapsed);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: Replay a capture (captureLog) into the decoder, at
+ *				  the captured pace times -s, or as fast as it goes
+ *				  (-s 0) to measure decode throughput on real
+ *				  traffic. Without -u the datagrams are decoded here
+ *				  the way decodeSample does; with -u they are sent to
+ *				  a running decoder.
+ *
+ * Parameter	: dir         capture directory
+ *				  -s speed    1 = as captured, N = N times, 0 = max (1)
+ *				  -l loops    passes over the capture (1)
+ *				  -k octets   header before the MessageFrame (16)
+ *				  -u a.b.c.d:port  send over UDP instead of decoding
+ *				  -o file     decode stats snapshot (JSON)
+ *
+ * Returns		: 0, 1 on error
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	CAPTURE_READER reader;
+	CAPTURE_RECORD record;
+	struct sockaddr_in addr;
+	struct timespec ts;
+	unsigned long long start, loopStart, first = 0, due, cnt = 0, loopCnt, bytes = 0, errorCnt = 0;
+	unsigned int loop;
+	int fd = -1;
+
+	if (HAE_OK != sParseArgs(argc, argv, &replay_config))
+	{
+		return 1;
+	}
+	/* before the first context, it installs the heap count */
+	DecodeStats_Init(&replay_stats);
+
+	if ((HAE_NULL != replay_config.pTarget) && ((fd = sOpenTarget(replay_config.pTarget, &addr)) < 0))
+	{
+		return 1;
+	}
+	if (HAE_OK != CaptureLog_OpenReader(&reader, replay_config.pDir))
+	{
+		return 1;
+	}
+
+	start = DecodeStats_Now();
+	for (loop = 0; loop < replay_config.loops; loop++)
+	{
+		if ((loop > 0) && (HAE_OK != CaptureLog_Rewind(&reader)))
+		{
+			break;
+		}
+		/* each pass is paced from its own first record */
+		loopStart = DecodeStats_Now();
+		loopCnt = 0;
+		while (HAE_OK == CaptureLog_Next(&reader, &record))
+		{
+			if (0 == loopCnt++)
+			{
+				first = record.monoNs;
+			}
+			if ((replay_config.speed > 0) && (record.monoNs > first))
+			{
+				due = loopStart + (unsigned long long)((record.monoNs - first) / replay_config.speed);
+				if (due > DecodeStats_Now())
+				{
+					ts.tv_sec = due / 1000000000ULL;
+					ts.tv_nsec = due % 1000000000ULL;
+					clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, HAE_NULL);
+				}
+			}
+
+			if (fd >= 0)
+			{
+				if (sendto(fd, record.pData, record.len, 0, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+				{
+					errorCnt++;
+				}
+			}
+			else if (HAE_OK != sDecode(&record, replay_config.offset))
+			{
+				errorCnt++;
+			}
+			cnt++;
+			bytes += record.len;
+		}
+	}
+	sReport(&replay_config, cnt, bytes, errorCnt, (DecodeStats_Now() - start) * 1e-9);
+	if (0 != reader.tornCnt)
+	{
+		printf("%lu segment(s) end in a partial record\n", reader.tornCnt);
+	}
+
+	CaptureLog_CloseReader(&reader);
+	DecodeStats_Free(&replay_stats);
+	if (fd >= 0)
+	{
+		close(fd);
+	}
+
+	return 0;
+}
+
+static int sParseArgs(int argc, char **argv, REPLAY_CONFIG *pConfig)
+{
+	int opt;
+
+	while (-1 != (opt = getopt(argc, argv, "s:l:k:u:o:")))
+	{
+		switch (opt)
+		{
+			case 's': pConfig->speed = atof(optarg); break;
+			case 'l': pConfig->loops = atoi(optarg); break;
+			case 'k': pConfig->offset = atoi(optarg); break;
+			case 'u': pConfig->pTarget = optarg; break;
+			case 'o': pConfig->pStatsPath = optarg; break;
+			default:
+				optind = argc + 1;
+				break;
+		}
+	}
+	if ((optind != argc - 1) || (pConfig->speed < 0))
+	{
+		printf("usage: %s [-s speed] [-l loops] [-k offset] [-u a.b.c.d:port] [-o stats.json] dir\n", argv[0]);
+		return HAE_ERROR;
+	}
+	pConfig->pDir = argv[optind];
+
+	return HAE_OK;
+}
+
+static int sOpenTarget(const char *pTarget, struct sockaddr_in *pAddr)
+{
+	char host[64];
+	unsigned int port;
+	int fd;
+
+	memset(pAddr, 0x00, sizeof(struct sockaddr_in));
+	pAddr->sin_family = AF_INET;
+	if ((2 != sscanf(pTarget, "%63[^:]:%u", host, &port)) || (port > 65535) || (1 != inet_pton(AF_INET, host, &pAddr->sin_addr)))
+	{
+		printf("[REPLAY] ERROR : bad target %s\n", pTarget);
+		return -1;
+	}
+	pAddr->sin_port = htons(port);
+	if ((fd = socket(AF_INET, SOCK_DGRAM, 0)) < 0)
+	{
+		printf("[REPLAY] ERROR : socket() (%s)\n", strerror(errno));
+	}
+
+	return fd;
+}
+
+/* the decode path of decodeSample: context per datagram, frame, value */
+static int sDecode(const CAPTURE_RECORD *pRecord, unsigned int offset)
+{
+	unsigned long long rxNs, decodedNs;
+	size_t heap;
+	MessageFrame frame;
+	OSCTXT ctxt;
+	int status;
+
+	if (pRecord->len <= offset)
+	{
+		return HAE_ERROR;
+	}
+
+	rxNs = DecodeStats_Now();
+	heap = DecodeStats_HeapBytes();
+	rtInitContext(&ctxt);
+	status = AsnType_DecodeFrame(&ctxt, pRecord->pData + offset, pRecord->len - offset, &frame, HAE_NULL, HAE_NULL);
+	decodedNs = DecodeStats_Now();
+	heap = DecodeStats_HeapBytes() - heap;
+	rtFreeContext(&ctxt);
+
+	DecodeStats_Record(&replay_stats, frame.messageId, pRecord->len - offset, status, rxNs, decodedNs, 0, heap);
+
+	return (0 == status) ? HAE_OK : HAE_ERROR;
+}
+
+static void sReport(const REPLAY_CONFIG *pConfig, unsigned long long cnt, unsigned long long bytes,
+	unsigned long long errorCnt, double elapsed)
+{
+	const STATS_MSG *pMsg;
+	const ASN_TYPE *pType;
+	const char *pText;
+	unsigned int i;
+	size_t len;
+	FILE *pFile;
+
+	printf("replayed %llu datagrams, %llu bytes in %.3f s = %.0f msg/s, %.2f MB/s, %llu %s errors\n", cnt, bytes,
+		elapsed, (elapsed > 0) ? cnt / elapsed : 0.0, (elapsed > 0) ? bytes / elapsed * 1e-6 : 0.0, errorCnt,
+		(HAE_NULL != pConfig->pTarget) ? "send" : "decode");
+	if (HAE_NULL != pConfig->pTarget)
+	{
+		return;
+	}
+
+	printf("%-24s %10s %8s %12s %12s\n", "message", "decoded", "errors", "decode p50", "decode p99");
+	for (i = 0; i < STATS_MSG_CNT; i++)
+	{
+		pMsg = &replay_stats.msg[i];
+		if (0 == pMsg->msgCnt)
+		{
+			continue;
+		}
+		pType = AsnType_FindMessage(pMsg->messageId);
+		printf("%-24s %10llu %8llu %9.1f us %9.1f us\n", (HAE_NULL != pType) ? pType->pName : "unknown",
+			pMsg->msgCnt, pMsg->errorCnt, DecodeStats_HistPercentile(&pMsg->lat[STATS_LAT_DECODE], 0.5) * 1e-3,
+			DecodeStats_HistPercentile(&pMsg->lat[STATS_LAT_DECODE], 0.99) * 1e-3);
+	}
+
+	if (HAE_NULL != pConfig->pStatsPath)
+	{
+		pText = DecodeStats_Snapshot(&replay_stats, &len);
+		if ((HAE_NULL == (pFile = fopen(pConfig->pStatsPath, "w"))) || (len != fwrite(pText, 1, len, pFile)))
+		{
+			printf("[REPLAY] ERROR : cannot write %s\n", pConfig->pStatsPath);
+		}
+		if (HAE_NULL != pFile)
+		{
+			fclose(pFile);
+		}
+	}
+}
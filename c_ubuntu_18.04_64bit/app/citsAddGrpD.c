@@ -0,0 +1,349 @@
+#include <DSRC.h>
+#include <AddGrpD.h>
+#include <rtxsrc/rtxBitDecode.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "haeCommon.h"
+#include "citsAddGrpD.h"
+
+#define RSA_OPT_BIT_CNT			8
+#define RSA_OPT_TIMESTAMP		(1u << 7)
+#define RSA_OPT_DESCRIPTION		(1u << 6)
+#define RSA_OPT_PRIORITY		(1u << 5)
+#define RSA_OPT_HEADING			(1u << 4)
+#define RSA_OPT_EXTENT			(1u << 3)
+#define RSA_OPT_POSITION		(1u << 2)
+#define RSA_OPT_FURTHERINFOID	(1u << 1)
+#define RSA_OPT_REGIONAL		(1u << 0)
+
+#define PVD_OPT_BIT_CNT			4
+#define PVD_OPT_TIMESTAMP		(1u << 3)
+#define PVD_OPT_SEGNUM			(1u << 2)
+#define PVD_OPT_PROBEID			(1u << 1)
+#define PVD_OPT_REGIONAL		(1u << 0)
+
+typedef int (*CITS_EXT_DECODER)(OSCTXT *pctxt, void *pSlot);
+
+static int sDecode_Regional(OSCTXT *pctxt, OSRTDList *pList, CITS_EXT_DECODER pfAddGrpD, void *pSlot);
+static int sDecode_RsaAddGrpD(OSCTXT *pctxt, void *pSlot);
+static int sDecode_PvdAddGrpD(OSCTXT *pctxt, void *pSlot);
+
+/*************************************************************
+ *
+ * Function 		: CitsRsa_Decode
+ *
+ * Description	: Decode a UPER RoadSideAlert, placing RSA-addGrpD
+ *				  directly into pMsg->cits
+ *
+ * Parameter	: pctxt - context with pu_setBuffer already applied
+ *
+ * Returns		: 0 or ASN1 runtime error code
+ *
+ * Notes		: The RSA root is walked here instead of asn1PD_RoadSideAlert
+ *				  so the regional open type is decoded in the same pass.
+ *				  Extension additions after the root are not decoded.
+ *
+ *************************************************************/
+int CitsRsa_Decode(OSCTXT *pctxt, CITS_RSA_MSG *pMsg)
+{
+	int stat;
+	OSBOOL extbit;
+	OSUINT32 optbits;
+	RoadSideAlert *pRsa = &pMsg->rsa;
+
+	memset(pMsg, 0, sizeof(CITS_RSA_MSG));
+
+	stat = rtxDecBit(pctxt, &extbit);
+	if (0 == stat) stat = rtxDecBits(pctxt, &optbits, RSA_OPT_BIT_CNT);
+	if (0 != stat)
+	{
+		return stat;
+	}
+
+	pRsa->m.timeStampPresent = (optbits & RSA_OPT_TIMESTAMP) ? 1 : 0;
+	pRsa->m.descriptionPresent = (optbits & RSA_OPT_DESCRIPTION) ? 1 : 0;
+	pRsa->m.priorityPresent = (optbits & RSA_OPT_PRIORITY) ? 1 : 0;
+	pRsa->m.headingPresent = (optbits & RSA_OPT_HEADING) ? 1 : 0;
+	pRsa->m.extentPresent = (optbits & RSA_OPT_EXTENT) ? 1 : 0;
+	pRsa->m.positionPresent = (optbits & RSA_OPT_POSITION) ? 1 : 0;
+	pRsa->m.furtherInfoIDPresent = (optbits & RSA_OPT_FURTHERINFOID) ? 1 : 0;
+
+	stat = asn1PD_MsgCount(pctxt, &pRsa->msgCnt);
+	if ((0 == stat) && pRsa->m.timeStampPresent)
+		stat = asn1PD_MinuteOfTheYear(pctxt, &pRsa->timeStamp);
+	if (0 == stat)
+		stat = asn1PD_ITIScodes(pctxt, &pRsa->typeEvent);
+	if ((0 == stat) && pRsa->m.descriptionPresent)
+		stat = asn1PD_RoadSideAlert_description(pctxt, &pRsa->description);
+	if ((0 == stat) && pRsa->m.priorityPresent)
+		stat = asn1PD_Priority(pctxt, &pRsa->priority);
+	if ((0 == stat) && pRsa->m.headingPresent)
+		stat = asn1PD_HeadingSlice(pctxt, &pRsa->heading);
+	if ((0 == stat) && pRsa->m.extentPresent)
+		stat = asn1PD_Extent(pctxt, &pRsa->extent);
+	if ((0 == stat) && pRsa->m.positionPresent)
+		stat = asn1PD_FullPositionVector(pctxt, &pRsa->position);
+	if ((0 == stat) && pRsa->m.furtherInfoIDPresent)
+		stat = asn1PD_FurtherInfoID(pctxt, &pRsa->furtherInfoID);
+	if ((0 == stat) && (optbits & RSA_OPT_REGIONAL))
+	{
+		stat = sDecode_Regional(pctxt, &pRsa->regional, sDecode_RsaAddGrpD, pMsg);
+		pRsa->m.regionalPresent = (pRsa->regional.count > 0) ? 1 : 0;
+	}
+
+	return stat;
+}
+
+/*************************************************************
+ *
+ * Function 		: CitsPvd_DecodeHead
+ *
+ * Description	: Decode the UPER ProbeVehicleData root up to the
+ *				  snapshots list
+ *
+ * Parameter	: pctxt - context with pu_setBuffer already applied
+ *				  pPvd - fields in front of snapshots and m filled in,
+ *				         snapshots and regional are left alone
+ *				  pRegional - set when the regional list follows
+ *
+ * Returns		: 0 or ASN1 runtime error code
+ *
+ * Notes		: Shared by CitsPvd_Decode and PvdStream_Decode, which
+ *				  differ only in how snapshots and regional are read.
+ *
+ *************************************************************/
+int CitsPvd_DecodeHead(OSCTXT *pctxt, ProbeVehicleData *pPvd, OSBOOL *pRegional)
+{
+	int stat;
+	OSBOOL extbit;
+	OSUINT32 optbits = 0;
+
+	stat = rtxDecBit(pctxt, &extbit);
+	if (0 == stat) stat = rtxDecBits(pctxt, &optbits, PVD_OPT_BIT_CNT);
+	if (0 != stat)
+	{
+		return stat;
+	}
+
+	pPvd->m.timeStampPresent = (optbits & PVD_OPT_TIMESTAMP) ? 1 : 0;
+	pPvd->m.segNumPresent = (optbits & PVD_OPT_SEGNUM) ? 1 : 0;
+	pPvd->m.probeIDPresent = (optbits & PVD_OPT_PROBEID) ? 1 : 0;
+	*pRegional = (optbits & PVD_OPT_REGIONAL) ? TRUE : FALSE;
+
+	if (pPvd->m.timeStampPresent)
+		stat = asn1PD_MinuteOfTheYear(pctxt, &pPvd->timeStamp);
+	if ((0 == stat) && pPvd->m.segNumPresent)
+		stat = asn1PD_ProbeSegmentNumber(pctxt, &pPvd->segNum);
+	if ((0 == stat) && pPvd->m.probeIDPresent)
+		stat = asn1PD_VehicleIdent(pctxt, &pPvd->probeID);
+	if (0 == stat)
+		stat = asn1PD_FullPositionVector(pctxt, &pPvd->startVector);
+	if (0 == stat)
+		stat = asn1PD_VehicleClassification(pctxt, &pPvd->vehicleType);
+
+	return stat;
+}
+
+/*************************************************************
+ *
+ * Function 		: CitsPvd_Decode
+ *
+ * Description	: Decode a UPER ProbeVehicleData, placing the CITSPVD
+ *				  entries of PVD-addGrpD directly into pMsg->cits[]
+ *
+ * Parameter	: pctxt - context with pu_setBuffer already applied
+ *
+ * Returns		: 0 or ASN1 runtime error code
+ *
+ * Notes		: Extension additions after the root are not decoded.
+ *
+ *************************************************************/
+int CitsPvd_Decode(OSCTXT *pctxt, CITS_PVD_MSG *pMsg)
+{
+	int stat;
+	OSBOOL regional;
+	ProbeVehicleData *pPvd = &pMsg->pvd;
+
+	memset(pMsg, 0, sizeof(CITS_PVD_MSG));
+
+	stat = CitsPvd_DecodeHead(pctxt, pPvd, &regional);
+	if (0 == stat)
+		stat = asn1PD_ProbeVehicleData_snapshots(pctxt, &pPvd->snapshots);
+	if ((0 == stat) && regional)
+	{
+		stat = sDecode_Regional(pctxt, &pPvd->regional, sDecode_PvdAddGrpD, pMsg);
+		pPvd->m.regionalPresent = (pPvd->regional.count > 0) ? 1 : 0;
+	}
+
+	return stat;
+}
+
+/* regional SEQUENCE (SIZE (1..4)) OF RegionalExtension.
+   addGrpD values are decoded straight out of the open type octets,
+   other regions are kept as RegionalExtension list nodes. */
+static int sDecode_Regional(OSCTXT *pctxt, OSRTDList *pList, CITS_EXT_DECODER pfAddGrpD, void *pSlot)
+{
+	int stat;
+	size_t start;
+	OSUINT32 count, len, i;
+	RegionId regionId;
+	RegionalExtension *pExt;
+
+	rtxDListInit(pList);
+
+	stat = pd_ConsUnsigned(pctxt, &count, 1, 4);
+
+	for (i = 0; (0 == stat) && (i < count); i++)
+	{
+		start = PU_GETCTXTBITOFFSET(pctxt);
+
+		stat = asn1PD_RegionId(pctxt, &regionId);
+		if (0 != stat)
+		{
+			break;
+		}
+
+		if (ASN1V_addGrpD == regionId)
+		{
+			stat = pd_Length(pctxt, &len);
+			if (0 == stat)
+			{
+				start = PU_GETCTXTBITOFFSET(pctxt);
+				stat = pfAddGrpD(pctxt, pSlot);
+			}
+			if (0 == stat)
+			{
+				/* skip extension additions and padding of the open type */
+				start += (size_t)len * 8;
+				PU_SETCTXTBITOFFSET(pctxt, start);
+			}
+		}
+		else
+		{
+			PU_SETCTXTBITOFFSET(pctxt, start);
+
+			pExt = rtxMemAllocTypeZ(pctxt, RegionalExtension);
+			if (HAE_NULL == pExt)
+			{
+				return RTERR_NOMEM;
+			}
+			stat = asn1PD_RegionalExtension(pctxt, pExt);
+			if (0 == stat)
+			{
+				rtxDListAppend(pctxt, pList, pExt);
+			}
+		}
+	}
+
+	return stat;
+}
+
+/* RSA-addGrpD ::= SEQUENCE { cits CITSRSA OPTIONAL, ... } */
+static int sDecode_RsaAddGrpD(OSCTXT *pctxt, void *pSlot)
+{
+	int stat;
+	OSBOOL extbit, citsPresent;
+	CITS_RSA_MSG *pMsg = (CITS_RSA_MSG *)pSlot;
+
+	stat = rtxDecBit(pctxt, &extbit);
+	if (0 == stat) stat = rtxDecBit(pctxt, &citsPresent);
+	if ((0 == stat) && citsPresent)
+	{
+		stat = asn1PD_CITSRSA(pctxt, &pMsg->cits);
+		pMsg->citsPresent = (0 == stat) ? HAE_TRUE : HAE_FALSE;
+	}
+
+	return stat;
+}
+
+/* PVD-addGrpD ::= SEQUENCE { cits SEQUENCE (SIZE (1..32)) OF CITSPVD OPTIONAL, ... } */
+static int sDecode_PvdAddGrpD(OSCTXT *pctxt, void *pSlot)
+{
+	int stat;
+	OSBOOL extbit, citsPresent;
+	OSUINT32 count, i;
+	CITS_PVD_MSG *pMsg = (CITS_PVD_MSG *)pSlot;
+
+	stat = rtxDecBit(pctxt, &extbit);
+	if (0 == stat) stat = rtxDecBit(pctxt, &citsPresent);
+	if ((0 != stat) || (FALSE == citsPresent))
+	{
+		return stat;
+	}
+
+	stat = pd_ConsUnsigned(pctxt, &count, 1, CITS_PVD_MAX);
+
+	for (i = 0; (0 == stat) && (i < count); i++)
+	{
+		stat = asn1PD_CITSPVD(pctxt, &pMsg->cits[i]);
+	}
+	pMsg->citsCnt = (0 == stat) ? count : 0;
+
+	return stat;
+}
+
+int CitsRsa_GetTemperature(const CITS_RSA_MSG *pMsg, OSINT16 *pValue)
+{
+	if (!pMsg->citsPresent || !pMsg->cits.m.tempraturePresent) return HAE_ERROR;
+	*pValue = pMsg->cits.temprature;
+	return HAE_OK;
+}
+
+int CitsRsa_GetHumidity(const CITS_RSA_MSG *pMsg, OSINT16 *pValue)
+{
+	if (!pMsg->citsPresent || !pMsg->cits.m.humidityPresent) return HAE_ERROR;
+	*pValue = pMsg->cits.humidity;
+	return HAE_OK;
+}
+
+int CitsRsa_GetPercent(const CITS_RSA_MSG *pMsg, OSUINT8 *pValue)
+{
+	if (!pMsg->citsPresent || !pMsg->cits.m.percentPresent) return HAE_ERROR;
+	*pValue = pMsg->cits.percent;
+	return HAE_OK;
+}
+
+int CitsRsa_GetLimitSpeed(const CITS_RSA_MSG *pMsg, OSUINT16 *pValue)
+{
+	if (!pMsg->citsPresent || !pMsg->cits.m.limitspeedPresent) return HAE_ERROR;
+	*pValue = pMsg->cits.limitspeed;
+	return HAE_OK;
+}
+
+int CitsRsa_GetLaneWidth(const CITS_RSA_MSG *pMsg, OSUINT16 *pValue)
+{
+	if (!pMsg->citsPresent || !pMsg->cits.m.lanewidthPresent) return HAE_ERROR;
+	*pValue = pMsg->cits.lanewidth;
+	return HAE_OK;
+}
+
+int CitsRsa_GetLaneSet(const CITS_RSA_MSG *pMsg, const CITSRSA_laneset **ppValue)
+{
+	if (!pMsg->citsPresent || !pMsg->cits.m.lanesetPresent) return HAE_ERROR;
+	*ppValue = &pMsg->cits.laneset;
+	return HAE_OK;
+}
+
+int CitsPvd_GetCurLane(const CITS_PVD_MSG *pMsg, unsigned int idx, LaneID *pValue)
+{
+	if ((idx >= pMsg->citsCnt) || !pMsg->cits[idx].m.curlanePresent) return HAE_ERROR;
+	*pValue = pMsg->cits[idx].curlane;
+	return HAE_OK;
+}
+
+int CitsPvd_GetVehicleCnt(const CITS_PVD_MSG *pMsg, unsigned int idx, OSUINT8 *pValue)
+{
+	if ((idx >= pMsg->citsCnt) || !pMsg->cits[idx].m.vehiclecntPresent) return HAE_ERROR;
+	*pValue = pMsg->cits[idx].vehiclecnt;
+	return HAE_OK;
+}
+
+int CitsPvd_GetServiceLog(const CITS_PVD_MSG *pMsg, unsigned int idx, const CITSLog **ppValue)
+{
+	if ((idx >= pMsg->citsCnt) || !pMsg->cits[idx].m.servicelogPresent) return HAE_ERROR;
+	*ppValue = &pMsg->cits[idx].servicelog;
+	return HAE_OK;
+}
@@ -0,0 +1,42 @@
+#ifndef CITS_ADDGRPD_H
+#define CITS_ADDGRPD_H
+
+#include <DSRC.h>
+#include <AddGrpD.h>
+
+#define CITS_PVD_MAX			32		/* PVD-addGrpD.cits SIZE (1..32) */
+
+/* RoadSideAlert with its RSA-addGrpD decoded in place.
+   rsa.regional only keeps extensions of other regions. */
+typedef struct{
+	RoadSideAlert rsa;
+	unsigned char citsPresent;
+	CITSRSA cits;
+} CITS_RSA_MSG;
+
+/* ProbeVehicleData with its PVD-addGrpD decoded in place.
+   pvd.regional only keeps extensions of other regions. */
+typedef struct{
+	ProbeVehicleData pvd;
+	unsigned int citsCnt;
+	CITSPVD cits[CITS_PVD_MAX];
+} CITS_PVD_MSG;
+
+int CitsRsa_Decode(OSCTXT *pctxt, CITS_RSA_MSG *pMsg);
+int CitsPvd_Decode(OSCTXT *pctxt, CITS_PVD_MSG *pMsg);
+int CitsPvd_DecodeHead(OSCTXT *pctxt, ProbeVehicleData *pPvd, OSBOOL *pRegional);
+
+/* Accessors return HAE_OK and fill *pValue when the field is present,
+   HAE_ERROR otherwise. */
+int CitsRsa_GetTemperature(const CITS_RSA_MSG *pMsg, OSINT16 *pValue);
+int CitsRsa_GetHumidity(const CITS_RSA_MSG *pMsg, OSINT16 *pValue);
+int CitsRsa_GetPercent(const CITS_RSA_MSG *pMsg, OSUINT8 *pValue);
+int CitsRsa_GetLimitSpeed(const CITS_RSA_MSG *pMsg, OSUINT16 *pValue);
+int CitsRsa_GetLaneWidth(const CITS_RSA_MSG *pMsg, OSUINT16 *pValue);
+int CitsRsa_GetLaneSet(const CITS_RSA_MSG *pMsg, const CITSRSA_laneset **ppValue);
+
+int CitsPvd_GetCurLane(const CITS_PVD_MSG *pMsg, unsigned int idx, LaneID *pValue);
+int CitsPvd_GetVehicleCnt(const CITS_PVD_MSG *pMsg, unsigned int idx, OSUINT8 *pValue);
+int CitsPvd_GetServiceLog(const CITS_PVD_MSG *pMsg, unsigned int idx, const CITSLog **ppValue);
+
+#endif
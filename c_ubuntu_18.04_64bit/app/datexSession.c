@@ -0,0 +1,1416 @@
+#include <ISO14827-2.h>
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+#include "haeCommon.h"
+#include "datexSession.h"
+
+#define DATEX_RX_TIMEOUT_MS		200			/* reader wakes up this often to check for Stop */
+#define DATEX_PRIORITY			1
+
+/* {joint-iso-itu-t asn1(1) packed-encoding(3) basic(0) unaligned(1)} */
+static ASN1OBJID datex_uper_oid = { 5, { 2, 1, 3, 0, 1 } };
+
+static void *sReadThread(void *pArg);
+static void *sDecodeThread(void *pArg);
+static int sReadFrame(DATEX_SESSION *pSession, DATEX_SLOT *pSlot);
+static int sReadStream(DATEX_SESSION *pSession, DATEX_SLOT *pSlot);
+static int sRecvAll(DATEX_SESSION *pSession, unsigned char *pBuf, unsigned int len, int allowIdle);
+static int sSendLocked(DATEX_SESSION *pSession, PDUs *pPdu);
+static int sSendAccept(DATEX_SESSION *pSession, unsigned int packetNbr, OSINT32 type, OSUINT32 serial);
+static int sSendReject(DATEX_SESSION *pSession, unsigned int packetNbr, OSINT32 type, OSUINT32 code);
+static int sPublishLocked(DATEX_SESSION *pSession, unsigned int subSerial, unsigned int pubSerial, MessageFrame *pFrames,
+	unsigned int frameCnt);
+static void sHandleSlot(DATEX_SESSION *pSession, DATEX_SLOT *pSlot);
+static void sHandlePdu(DATEX_SESSION *pSession, C2CAuthenticatedMessage *pMsg);
+static void sHandleLogin(DATEX_SESSION *pSession, unsigned int packetNbr, Login *pLogin);
+static void sHandleSubscription(DATEX_SESSION *pSession, unsigned int packetNbr, Subscription *pSub);
+static void sHandlePublication(DATEX_SESSION *pSession, unsigned int packetNbr, Publication *pPub);
+static DATEX_SUB *sFindSub(DATEX_SESSION *pSession, unsigned int serial, int alloc);
+static int sTakePubSerial(DATEX_SESSION *pSession, unsigned int serial, unsigned int cnt, unsigned int *pPubSerial);
+static void sSetState(DATEX_SESSION *pSession, int state);
+static unsigned short sCrc16(const unsigned char *pBuf, unsigned int len);
+static int sSetRxTimeout(int fd);
+
+int DatexHdr_Parse(const unsigned char *pBuf, unsigned int ulLength, DATEX_HEADER *pHeader)
+{
+	if (ulLength < DATEX_HDR_SIZE)
+	{
+		return HAE_ERROR;
+	}
+
+	pHeader->marker = (pBuf[0] << 8) | pBuf[1];
+	pHeader->version = pBuf[2];
+	pHeader->type = pBuf[3];
+	pHeader->seq = ((unsigned int)pBuf[4] << 24) | (pBuf[5] << 16) | (pBuf[6] << 8) | pBuf[7];
+	pHeader->length = ((unsigned int)pBuf[8] << 24) | (pBuf[9] << 16) | (pBuf[10] << 8) | pBuf[11];
+	pHeader->timeMs = ((unsigned int)pBuf[12] << 24) | (pBuf[13] << 16) | (pBuf[14] << 8) | pBuf[15];
+
+	if ((DATEX_HDR_MARKER != pHeader->marker) || (DATEX_HDR_VERSION != pHeader->version) ||
+		(pHeader->length > DATEX_FRAME_MAX - DATEX_HDR_SIZE))
+	{
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+void DatexHdr_Build(unsigned char *pBuf, unsigned char type, unsigned int seq, unsigned int length)
+{
+	unsigned int timeMs = (unsigned int)DatexSession_NowMs();
+
+	pBuf[0] = DATEX_HDR_MARKER >> 8;
+	pBuf[1] = DATEX_HDR_MARKER & 0xff;
+	pBuf[2] = DATEX_HDR_VERSION;
+	pBuf[3] = type;
+	pBuf[4] = seq >> 24; pBuf[5] = seq >> 16; pBuf[6] = seq >> 8; pBuf[7] = seq;
+	pBuf[8] = length >> 24; pBuf[9] = length >> 16; pBuf[10] = length >> 8; pBuf[11] = length;
+	pBuf[12] = timeMs >> 24; pBuf[13] = timeMs >> 16; pBuf[14] = timeMs >> 8; pBuf[15] = timeMs;
+}
+
+/*************************************************************
+ *
+ * Function 		: DatexSession_Init
+ *
+ * Description	: Prepare a DATEX (ISO 14827-2) session
+ *
+ * Parameter	: role - DATEX_ROLE_CLIENT / DATEX_ROLE_SERVER
+ *				  transport - DATEX_TRANSPORT_TCP / DATEX_TRANSPORT_UDP
+ *				  pfPublish - client, called for every published MessageFrame
+ *				  pfProvide - server, fills periodic / single publications
+ *				  pArg - passed back to the handlers
+ *
+ * Returns		: HAE_OK / HAE_ERROR
+ *
+ * Notes		: Frames are read by a reader thread into a ring of
+ *				  DATEX_RING_CNT slots and decoded by a second thread,
+ *				  so decoding a Publication overlaps the next recv().
+ *				  Bare DatexDataPackets on the wire, see
+ *				  DatexSession_SetFraming for the private header.
+ *
+ *************************************************************/
+int DatexSession_Init(DATEX_SESSION *pSession, int role, int transport, DATEX_PUBLISH_HANDLER pfPublish, DATEX_PROVIDER pfProvide, void *pArg)
+{
+	memset(pSession, 0, sizeof(DATEX_SESSION));
+
+	pSession->role = role;
+	pSession->transport = transport;
+	pSession->framing = DATEX_FRAMING_NONE;
+	pSession->fd = -1;
+	pSession->listenFd = -1;
+	pSession->state = DATEX_STATE_IDLE;
+	pSession->heartbeatSec = 30;
+	pSession->pSender = "client";
+	pSession->pDestination = "server";
+	pSession->pfPublish = pfPublish;
+	pSession->pfProvide = pfProvide;
+	pSession->pArg = pArg;
+
+	pSession->pRing = (DATEX_SLOT *)malloc(sizeof(DATEX_SLOT) * DATEX_RING_CNT);
+	pSession->pStream = (unsigned char *)malloc(DATEX_FRAME_MAX);
+	if ((HAE_NULL == pSession->pRing) || (HAE_NULL == pSession->pStream))
+	{
+		printf("[DATEX] ERROR : no memory for receive ring\n");
+		free(pSession->pRing);
+		free(pSession->pStream);
+		pSession->pRing = HAE_NULL;
+		pSession->pStream = HAE_NULL;
+		return HAE_ERROR;
+	}
+
+	if ((0 != rtInitContext(&pSession->txCtxt)) || (0 != rtInitContext(&pSession->rxCtxt)) ||
+		(0 != rtInitContext(&pSession->lenCtxt)))
+	{
+		printf("[DATEX] ERROR : rtInitContext() for session\n");
+		free(pSession->pRing);
+		free(pSession->pStream);
+		pSession->pRing = HAE_NULL;
+		pSession->pStream = HAE_NULL;
+		return HAE_ERROR;
+	}
+
+	/* only the length of a packet is wanted there, no copy of datex_Data */
+	rtxCtxtSetFlag(&pSession->lenCtxt, ASN1FASTCOPY);
+
+	pthread_mutex_init(&pSession->stateLock, HAE_NULL);
+	pthread_mutex_init(&pSession->subLock, HAE_NULL);
+	pthread_mutex_init(&pSession->txLock, HAE_NULL);
+	pthread_mutex_init(&pSession->ringLock, HAE_NULL);
+	pthread_cond_init(&pSession->notEmpty, HAE_NULL);
+	pthread_cond_init(&pSession->notFull, HAE_NULL);
+
+	return HAE_OK;
+}
+
+void DatexSession_SetIdentity(DATEX_SESSION *pSession, const char *pSender, const char *pDestination, const char *pUser, const char *pPassword)
+{
+	pSession->pSender = pSender;
+	pSession->pDestination = pDestination;
+	pSession->pUser = pUser;
+	pSession->pPassword = pPassword;
+}
+
+/*************************************************************
+ *
+ * Function 		: DatexSession_SetFraming
+ *
+ * Description	: Choose what goes around each DatexDataPacket
+ *
+ * Parameter	: framing - DATEX_FRAMING_NONE (default): bare packets,
+ *				  what an ISO 14827-2 peer sends and expects.
+ *				  DATEX_FRAMING_HDR: the private DATEX_HEADER of this
+ *				  code base, not part of any standard, both ends
+ *				  have to ask for it.
+ *
+ * Notes		: Call before DatexSession_Start.
+ *
+ *************************************************************/
+void DatexSession_SetFraming(DATEX_SESSION *pSession, int framing)
+{
+	pSession->framing = framing;
+}
+
+void DatexSession_Free(DATEX_SESSION *pSession)
+{
+	DatexSession_Stop(pSession);
+
+	if (pSession->fd >= 0)
+	{
+		close(pSession->fd);
+		pSession->fd = -1;
+	}
+	if (pSession->listenFd >= 0)
+	{
+		close(pSession->listenFd);
+		pSession->listenFd = -1;
+	}
+
+	rtFreeContext(&pSession->txCtxt);
+	rtFreeContext(&pSession->rxCtxt);
+	rtFreeContext(&pSession->lenCtxt);
+
+	pthread_mutex_destroy(&pSession->stateLock);
+	pthread_mutex_destroy(&pSession->subLock);
+	pthread_mutex_destroy(&pSession->txLock);
+	pthread_mutex_destroy(&pSession->ringLock);
+	pthread_cond_destroy(&pSession->notEmpty);
+	pthread_cond_destroy(&pSession->notFull);
+
+	free(pSession->pRing);
+	free(pSession->pStream);
+	pSession->pRing = HAE_NULL;
+	pSession->pStream = HAE_NULL;
+}
+
+/* server: TCP listen socket or bound UDP socket */
+int DatexSession_Listen(DATEX_SESSION *pSession, const char *pAddr, unsigned short port)
+{
+	int fd;
+	int optVal = 1;
+	struct sockaddr_in addr;
+
+	fd = socket(AF_INET, (DATEX_TRANSPORT_TCP == pSession->transport) ? SOCK_STREAM : SOCK_DGRAM, 0);
+	if (fd < 0)
+	{
+		perror("socket DATEX");
+		return HAE_ERROR;
+	}
+
+	setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, (char *)&optVal, sizeof(optVal));
+
+	memset(&addr, 0x00, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = inet_addr(pAddr);
+	addr.sin_port = htons(port);
+
+	if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+	{
+		perror("bind DATEX");
+		close(fd);
+		return HAE_ERROR;
+	}
+
+	if (DATEX_TRANSPORT_TCP == pSession->transport)
+	{
+		if (listen(fd, 1) < 0)
+		{
+			perror("listen DATEX");
+			close(fd);
+			return HAE_ERROR;
+		}
+		pSession->listenFd = fd;
+	}
+	else
+	{
+		/* UDP peer is learned from the first datagram */
+		pSession->fd = fd;
+	}
+
+	return HAE_OK;
+}
+
+/* server: wait for the TCP client, nothing to do for UDP */
+int DatexSession_Accept(DATEX_SESSION *pSession)
+{
+	int fd;
+	int optVal = 1;
+	socklen_t addrLen = sizeof(pSession->peer);
+
+	if (DATEX_TRANSPORT_UDP == pSession->transport)
+	{
+		return HAE_OK;
+	}
+
+	fd = accept(pSession->listenFd, (struct sockaddr *)&pSession->peer, &addrLen);
+	if (fd < 0)
+	{
+		perror("accept DATEX");
+		return HAE_ERROR;
+	}
+
+	setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (char *)&optVal, sizeof(optVal));
+	pSession->fd = fd;
+	pSession->peerValid = HAE_TRUE;
+
+	return HAE_OK;
+}
+
+int DatexSession_Connect(DATEX_SESSION *pSession, const char *pAddr, unsigned short port)
+{
+	int fd;
+	int optVal = 1;
+
+	fd = socket(AF_INET, (DATEX_TRANSPORT_TCP == pSession->transport) ? SOCK_STREAM : SOCK_DGRAM, 0);
+	if (fd < 0)
+	{
+		perror("socket DATEX");
+		return HAE_ERROR;
+	}
+
+	memset(&pSession->peer, 0x00, sizeof(pSession->peer));
+	pSession->peer.sin_family = AF_INET;
+	pSession->peer.sin_addr.s_addr = inet_addr(pAddr);
+	pSession->peer.sin_port = htons(port);
+
+	if (connect(fd, (struct sockaddr *)&pSession->peer, sizeof(pSession->peer)) < 0)
+	{
+		perror("connect DATEX");
+		close(fd);
+		return HAE_ERROR;
+	}
+
+	if (DATEX_TRANSPORT_TCP == pSession->transport)
+	{
+		setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (char *)&optVal, sizeof(optVal));
+	}
+
+	pSession->fd = fd;
+	pSession->peerValid = HAE_TRUE;
+
+	return HAE_OK;
+}
+
+int DatexSession_Start(DATEX_SESSION *pSession)
+{
+	if ((pSession->fd < 0) || (HAE_OK != sSetRxTimeout(pSession->fd)))
+	{
+		printf("[DATEX] ERROR : session has no socket\n");
+		return HAE_ERROR;
+	}
+
+	pSession->head = 0;
+	pSession->tail = 0;
+	pSession->streamLen = 0;
+	pSession->rxEof = HAE_FALSE;
+	pSession->running = HAE_TRUE;
+
+	if (0 != pthread_create(&pSession->readThread, HAE_NULL, sReadThread, pSession))
+	{
+		pSession->running = HAE_FALSE;
+		printf("[DATEX] ERROR : reader thread\n");
+		return HAE_ERROR;
+	}
+	if (0 != pthread_create(&pSession->decodeThread, HAE_NULL, sDecodeThread, pSession))
+	{
+		pSession->running = HAE_FALSE;
+		pthread_join(pSession->readThread, HAE_NULL);
+		printf("[DATEX] ERROR : decoder thread\n");
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+/* frames already read are still decoded before the decoder exits */
+void DatexSession_Stop(DATEX_SESSION *pSession)
+{
+	if (!pSession->running)
+	{
+		return;
+	}
+
+	pthread_mutex_lock(&pSession->ringLock);
+	pSession->running = HAE_FALSE;
+	pthread_cond_broadcast(&pSession->notFull);
+	pthread_mutex_unlock(&pSession->ringLock);
+
+	pthread_join(pSession->readThread, HAE_NULL);
+	pthread_join(pSession->decodeThread, HAE_NULL);
+}
+
+int DatexSession_Login(DATEX_SESSION *pSession)
+{
+	int status;
+	PDUs pdu;
+	Login login;
+
+	pthread_mutex_lock(&pSession->txLock);
+	rtxMemReset(&pSession->txCtxt);
+
+	memset(&login, 0, sizeof(login));
+	login.datex_Sender_txt = (const OSUTF8CHAR *)pSession->pSender;
+	login.datex_Destination_txt = (const OSUTF8CHAR *)pSession->pDestination;
+	if (HAE_NULL != pSession->pUser)
+	{
+		login.datexLogin_UserName_txt.numocts = strlen(pSession->pUser);
+		login.datexLogin_UserName_txt.data = (const OSOCTET *)pSession->pUser;
+	}
+	if (HAE_NULL != pSession->pPassword)
+	{
+		login.datexLogin_Password_txt.numocts = strlen(pSession->pPassword);
+		login.datexLogin_Password_txt.data = (const OSOCTET *)pSession->pPassword;
+	}
+	rtxDListInit(&login.datexLogin_EncodingRules_id);
+	rtxDListAppend(&pSession->txCtxt, &login.datexLogin_EncodingRules_id, &datex_uper_oid);
+	login.datexLogin_HeartbeatDurationMax_qty = pSession->heartbeatSec;
+	login.datexLogin_ResponseTimeOut_qty = 10;
+	login.datexLogin_Initiator_cd = clientInitiated;
+	login.datexLogin_DatagramSize_qty = DATEX_FRAME_MAX;
+
+	pdu.t = T_PDUs_login;
+	pdu.u.login = &login;
+
+	sSetState(pSession, DATEX_STATE_LOGIN);
+	status = sSendLocked(pSession, &pdu);
+
+	pthread_mutex_unlock(&pSession->txLock);
+
+	return status;
+}
+
+int DatexSession_Logout(DATEX_SESSION *pSession)
+{
+	int status;
+	PDUs pdu;
+
+	pthread_mutex_lock(&pSession->txLock);
+	rtxMemReset(&pSession->txCtxt);
+
+	pdu.t = T_PDUs_logout;
+	pdu.u.logout = (DATEX_ROLE_CLIENT == pSession->role) ? clientRequested_1 : serverRequested_1;
+	status = sSendLocked(pSession, &pdu);
+	sSetState(pSession, DATEX_STATE_CLOSED);
+
+	pthread_mutex_unlock(&pSession->txLock);
+
+	return status;
+}
+
+/*************************************************************
+ *
+ * Function 		: DatexSession_Subscribe
+ *
+ * Description	: Client side subscription request
+ *
+ * Parameter	: serial - datexSubscribe_Serial_nbr, echoed in publications
+ *				  messageId - DSRCmsgID placed in datexSubscribe_Pdu
+ *				  mode - T_SubscriptionMode_single / _event_driven / _periodic
+ *				  periodMs - periodic update delay
+ *
+ * Returns		: HAE_OK / HAE_ERROR
+ *
+ *************************************************************/
+int DatexSession_Subscribe(DATEX_SESSION *pSession, unsigned int serial, DSRCmsgID messageId, int mode, unsigned int periodMs)
+{
+	int status;
+	PDUs pdu;
+	Subscription sub;
+	SubscriptionData data;
+	Registered registered;
+	Registered_continuous continuous;
+
+	pthread_mutex_lock(&pSession->txLock);
+	rtxMemReset(&pSession->txCtxt);
+
+	memset(&continuous, 0, sizeof(continuous));
+	continuous.datexRegistered_UpdateDelay_qty = periodMs;
+	registered.t = T_Registered_continuous;
+	registered.u.continuous = &continuous;
+
+	memset(&data, 0, sizeof(data));
+	data.datexSubscribe_Persistent_bool = FALSE;
+	data.datexSubscribe_Status_cd = new_;
+	data.datexSubscribe_Mode.t = mode;
+	if (T_SubscriptionMode_event_driven == mode)
+	{
+		data.datexSubscribe_Mode.u.event_driven = &registered;
+	}
+	else if (T_SubscriptionMode_periodic == mode)
+	{
+		data.datexSubscribe_Mode.u.periodic = &registered;
+	}
+	data.datexSubscribe_PublishFormat_cd = dataPacket;
+	data.datexSubscription_Priority_nbr = DATEX_PRIORITY;
+	data.datexSubscribe_Guarantee_bool = FALSE;
+	data.datexSubscribe_Pdu.messageId = messageId;
+
+	memset(&sub, 0, sizeof(sub));
+	sub.datexSubscribe_Serial_nbr = serial;
+	sub.datexSubscribe_Type.t = T_SubscriptionType_subscription;
+	sub.datexSubscribe_Type.u.subscription = &data;
+
+	pdu.t = T_PDUs_subscription;
+	pdu.u.subscription = &sub;
+	status = sSendLocked(pSession, &pdu);
+
+	pthread_mutex_unlock(&pSession->txLock);
+
+	return status;
+}
+
+int DatexSession_Cancel(DATEX_SESSION *pSession, unsigned int serial)
+{
+	int status;
+	PDUs pdu;
+	Subscription sub;
+
+	pthread_mutex_lock(&pSession->txLock);
+	rtxMemReset(&pSession->txCtxt);
+
+	memset(&sub, 0, sizeof(sub));
+	sub.datexSubscribe_Serial_nbr = serial;
+	sub.datexSubscribe_Type.t = T_SubscriptionType_datexSubscribe_CancelReason_cd;
+	sub.datexSubscribe_Type.u.datexSubscribe_CancelReason_cd = dataNotNeeded;
+
+	pdu.t = T_PDUs_subscription;
+	pdu.u.subscription = &sub;
+	status = sSendLocked(pSession, &pdu);
+
+	pthread_mutex_unlock(&pSession->txLock);
+
+	return status;
+}
+
+/* server: publish frames on an accepted subscription, DATEX_PUBLISH_MAX per packet */
+int DatexSession_Publish(DATEX_SESSION *pSession, unsigned int serial, MessageFrame *pFrames, unsigned int frameCnt)
+{
+	int status = HAE_OK;
+	unsigned int cnt;
+	unsigned int pubSerial;
+
+	/* serials taken under txLock go out in the same order */
+	pthread_mutex_lock(&pSession->txLock);
+	if (HAE_OK != sTakePubSerial(pSession, serial, frameCnt, &pubSerial))
+	{
+		pthread_mutex_unlock(&pSession->txLock);
+		return HAE_ERROR;
+	}
+
+	while ((HAE_OK == status) && (frameCnt > 0))
+	{
+		cnt = (frameCnt > DATEX_PUBLISH_MAX) ? DATEX_PUBLISH_MAX : frameCnt;
+
+		rtxMemReset(&pSession->txCtxt);
+		status = sPublishLocked(pSession, serial, pubSerial, pFrames, cnt);
+
+		pubSerial += cnt;
+		pFrames += cnt;
+		frameCnt -= cnt;
+	}
+	pthread_mutex_unlock(&pSession->txLock);
+
+	return status;
+}
+
+/* server: run due periodic subscriptions through pfProvide */
+int DatexSession_Tick(DATEX_SESSION *pSession, unsigned long long nowMs)
+{
+	int i;
+	int status = HAE_OK;
+	unsigned int pubSerial;
+	DATEX_SUB sub;
+	DATEX_SUB *pSub;
+	MessageFrame frame;
+
+	if ((DATEX_STATE_ONLINE != DatexSession_State(pSession)) || (HAE_NULL == pSession->pfProvide))
+	{
+		return HAE_OK;
+	}
+
+	for (i = 0; i < DATEX_SUB_MAX; i++)
+	{
+		pthread_mutex_lock(&pSession->subLock);
+		pSub = &pSession->sub[i];
+		if (!pSub->used || (T_SubscriptionMode_periodic != pSub->mode) || (nowMs < pSub->nextMs))
+		{
+			pthread_mutex_unlock(&pSession->subLock);
+			continue;
+		}
+		pSub->nextMs = nowMs + pSub->periodMs;
+		sub = *pSub;
+		pthread_mutex_unlock(&pSession->subLock);
+
+		pthread_mutex_lock(&pSession->txLock);
+		rtxMemReset(&pSession->txCtxt);
+		memset(&frame, 0, sizeof(frame));
+		/* the slot may be cancelled while the provider runs */
+		if ((HAE_OK == pSession->pfProvide(pSession->pArg, &sub, &pSession->txCtxt, &frame)) &&
+			(HAE_OK == sTakePubSerial(pSession, sub.serial, 1, &pubSerial)))
+		{
+			status |= sPublishLocked(pSession, sub.serial, pubSerial, &frame, 1);
+		}
+		pthread_mutex_unlock(&pSession->txLock);
+	}
+
+	return (HAE_OK == status) ? HAE_OK : HAE_ERROR;
+}
+
+int DatexSession_State(DATEX_SESSION *pSession)
+{
+	int state;
+
+	pthread_mutex_lock(&pSession->stateLock);
+	state = pSession->state;
+	pthread_mutex_unlock(&pSession->stateLock);
+
+	return state;
+}
+
+unsigned long long DatexSession_NowMs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (unsigned long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static void *sReadThread(void *pArg)
+{
+	int ret;
+	DATEX_SESSION *pSession = (DATEX_SESSION *)pArg;
+	DATEX_SLOT *pSlot;
+
+	for (;;)
+	{
+		/* back pressure: a full ring stops reading, TCP flow control does the rest */
+		pthread_mutex_lock(&pSession->ringLock);
+		while (pSession->running && (pSession->head - pSession->tail >= DATEX_RING_CNT))
+		{
+			pthread_cond_wait(&pSession->notFull, &pSession->ringLock);
+		}
+		pSlot = &pSession->pRing[pSession->head % DATEX_RING_CNT];
+		pthread_mutex_unlock(&pSession->ringLock);
+
+		if (!pSession->running)
+		{
+			break;
+		}
+
+		ret = sReadFrame(pSession, pSlot);
+		if (ret < 0)
+		{
+			break;
+		}
+		if (0 == ret)
+		{
+			continue;
+		}
+
+		pthread_mutex_lock(&pSession->ringLock);
+		pSession->head++;
+		pthread_cond_signal(&pSession->notEmpty);
+		pthread_mutex_unlock(&pSession->ringLock);
+	}
+
+	pthread_mutex_lock(&pSession->ringLock);
+	pSession->rxEof = HAE_TRUE;
+	pthread_cond_signal(&pSession->notEmpty);
+	pthread_mutex_unlock(&pSession->ringLock);
+
+	return HAE_NULL;
+}
+
+static void *sDecodeThread(void *pArg)
+{
+	DATEX_SESSION *pSession = (DATEX_SESSION *)pArg;
+	DATEX_SLOT *pSlot;
+
+	for (;;)
+	{
+		pthread_mutex_lock(&pSession->ringLock);
+		while ((pSession->head == pSession->tail) && !pSession->rxEof)
+		{
+			pthread_cond_wait(&pSession->notEmpty, &pSession->ringLock);
+		}
+		if (pSession->head == pSession->tail)
+		{
+			pthread_mutex_unlock(&pSession->ringLock);
+			break;
+		}
+		pSlot = &pSession->pRing[pSession->tail % DATEX_RING_CNT];
+		pthread_mutex_unlock(&pSession->ringLock);
+
+		sHandleSlot(pSession, pSlot);
+		rtxMemReset(&pSession->rxCtxt);
+
+		pthread_mutex_lock(&pSession->ringLock);
+		pSession->tail++;
+		pthread_cond_signal(&pSession->notFull);
+		pthread_mutex_unlock(&pSession->ringLock);
+	}
+
+	return HAE_NULL;
+}
+
+/* 1 = frame in slot, 0 = idle timeout, -1 = closed */
+static int sReadFrame(DATEX_SESSION *pSession, DATEX_SLOT *pSlot)
+{
+	int ret;
+	ssize_t len;
+	DATEX_HEADER header;
+	struct sockaddr_in src;
+	socklen_t srcLen = sizeof(src);
+	int useHdr = (DATEX_FRAMING_HDR == pSession->framing);
+
+	if (DATEX_TRANSPORT_UDP == pSession->transport)
+	{
+		len = recvfrom(pSession->fd, pSlot->data, DATEX_FRAME_MAX, 0, (struct sockaddr *)&src, &srcLen);
+		if (len < 0)
+		{
+			if ((EAGAIN == errno) || (EWOULDBLOCK == errno) || (EINTR == errno))
+			{
+				return pSession->running ? 0 : -1;
+			}
+			perror("recvfrom DATEX");
+			return -1;
+		}
+		/* a bare packet is checked by the decoder */
+		if (useHdr && ((HAE_OK != DatexHdr_Parse(pSlot->data, len, &header)) || (len != DATEX_HDR_SIZE + header.length)))
+		{
+			pSession->rxErrors++;
+			return 0;
+		}
+		if (!pSession->peerValid)
+		{
+			pthread_mutex_lock(&pSession->txLock);
+			pSession->peer = src;
+			pSession->peerValid = HAE_TRUE;
+			pthread_mutex_unlock(&pSession->txLock);
+		}
+		pSlot->len = len;
+		return 1;
+	}
+
+	if (!useHdr)
+	{
+		return sReadStream(pSession, pSlot);
+	}
+
+	ret = sRecvAll(pSession, pSlot->data, DATEX_HDR_SIZE, HAE_TRUE);
+	if (ret <= 0)
+	{
+		return ret;
+	}
+	if (HAE_OK != DatexHdr_Parse(pSlot->data, DATEX_HDR_SIZE, &header))
+	{
+		/* lost framing on a stream cannot be recovered */
+		printf("[DATEX] ERROR : bad frame header, closing\n");
+		pSession->rxErrors++;
+		return -1;
+	}
+	if (sRecvAll(pSession, pSlot->data + DATEX_HDR_SIZE, header.length, HAE_FALSE) < 0)
+	{
+		return -1;
+	}
+	pSlot->len = DATEX_HDR_SIZE + header.length;
+
+	return 1;
+}
+
+/* TCP without header: packets back to back, one ends where its decode stops */
+static int sReadStream(DATEX_SESSION *pSession, DATEX_SLOT *pSlot)
+{
+	int stat;
+	ssize_t ret;
+	OSSIZE len;
+	DatexDataPacket packet;
+	OSCTXT *pctxt = &pSession->lenCtxt;
+
+	for (;;)
+	{
+		if (pSession->streamLen > 0)
+		{
+			pu_setBuffer(pctxt, pSession->pStream, pSession->streamLen, FALSE);
+			memset(&packet, 0, sizeof(packet));
+			stat = asn1PD_DatexDataPacket(pctxt, &packet);
+			len = pu_getMsgLen(pctxt);
+			rtxErrReset(pctxt);
+			rtxMemReset(pctxt);
+
+			if (0 == stat)
+			{
+				memcpy(pSlot->data, pSession->pStream, len);
+				pSlot->len = len;
+				pSession->streamLen -= len;
+				memmove(pSession->pStream, pSession->pStream + len, pSession->streamLen);
+				return 1;
+			}
+			if ((RTERR_ENDOFBUF != stat) || (pSession->streamLen >= DATEX_FRAME_MAX))
+			{
+				/* lost framing on a stream cannot be recovered */
+				printf("[DATEX] ERROR : bad packet on stream (%d), closing\n", stat);
+				pSession->rxErrors++;
+				return -1;
+			}
+		}
+
+		/* more of the packet */
+		ret = recv(pSession->fd, pSession->pStream + pSession->streamLen, DATEX_FRAME_MAX - pSession->streamLen, 0);
+		if (ret > 0)
+		{
+			pSession->streamLen += ret;
+			continue;
+		}
+		if (0 == ret)
+		{
+			sSetState(pSession, DATEX_STATE_CLOSED);
+			return -1;
+		}
+		if ((EAGAIN == errno) || (EWOULDBLOCK == errno) || (EINTR == errno))
+		{
+			return pSession->running ? 0 : -1;
+		}
+		perror("recv DATEX");
+		return -1;
+	}
+}
+
+static int sRecvAll(DATEX_SESSION *pSession, unsigned char *pBuf, unsigned int len, int allowIdle)
+{
+	ssize_t ret;
+	unsigned int got = 0;
+
+	while (got < len)
+	{
+		ret = recv(pSession->fd, pBuf + got, len - got, 0);
+		if (ret > 0)
+		{
+			got += ret;
+			continue;
+		}
+		if (0 == ret)
+		{
+			sSetState(pSession, DATEX_STATE_CLOSED);
+			return -1;
+		}
+		if ((EAGAIN == errno) || (EWOULDBLOCK == errno) || (EINTR == errno))
+		{
+			if (!pSession->running)
+			{
+				return -1;
+			}
+			if (allowIdle && (0 == got))
+			{
+				return 0;
+			}
+			continue;
+		}
+		perror("recv DATEX");
+		return -1;
+	}
+
+	return 1;
+}
+
+/* txLock held; PDU -> C2CAuthenticatedMessage -> DatexDataPacket -> [header +] send */
+static int sSendLocked(DATEX_SESSION *pSession, PDUs *pPdu)
+{
+	int stat;
+	unsigned int hdrLen = (DATEX_FRAMING_HDR == pSession->framing) ? DATEX_HDR_SIZE : 0;
+	unsigned short crc;
+	OSSIZE innerLen, len;
+	ssize_t sent;
+	C2CAuthenticatedMessage msg;
+	DatexDataPacket packet;
+	OSCTXT *pctxt = &pSession->txCtxt;
+
+	if ((pSession->fd < 0) || !pSession->peerValid)
+	{
+		return HAE_ERROR;
+	}
+
+	memset(&msg, 0, sizeof(msg));
+	msg.datex_DataPacket_number = ++pSession->txSeq;
+	msg.datex_DataPacketPriority_number = DATEX_PRIORITY;
+	msg.pdu = *pPdu;
+
+	pu_setBuffer(pctxt, pSession->txInner, sizeof(pSession->txInner), FALSE);
+	stat = asn1PE_C2CAuthenticatedMessage(pctxt, &msg);
+	if (0 != stat)
+	{
+		rtxErrPrint(pctxt);
+		rtxErrReset(pctxt);
+		return HAE_ERROR;
+	}
+	innerLen = pe_GetMsgLen(pctxt);
+	crc = sCrc16(pSession->txInner, innerLen);
+
+	memset(&packet, 0, sizeof(packet));
+	packet.datex_Version_number = version1;
+	packet.datex_Data.numocts = innerLen;
+	packet.datex_Data.data = pSession->txInner;
+	packet.datex_Crc_nbr.numocts = 2;
+	packet.datex_Crc_nbr.data[0] = crc >> 8;
+	packet.datex_Crc_nbr.data[1] = crc & 0xff;
+
+	pu_setBuffer(pctxt, pSession->txBuf + hdrLen, sizeof(pSession->txBuf) - hdrLen, FALSE);
+	stat = asn1PE_DatexDataPacket(pctxt, &packet);
+	if (0 != stat)
+	{
+		rtxErrPrint(pctxt);
+		rtxErrReset(pctxt);
+		return HAE_ERROR;
+	}
+	len = pe_GetMsgLen(pctxt);
+
+	if (0 != hdrLen)
+	{
+		DatexHdr_Build(pSession->txBuf, DATEX_TYPE_PACKET, pSession->txSeq, (unsigned int)len);
+		len += hdrLen;
+	}
+
+	if (DATEX_TRANSPORT_TCP == pSession->transport)
+	{
+		OSSIZE off = 0;
+
+		while (off < len)
+		{
+			sent = send(pSession->fd, pSession->txBuf + off, len - off, MSG_NOSIGNAL);
+			if (sent < 0)
+			{
+				if (EINTR == errno)
+				{
+					continue;
+				}
+				perror("send DATEX");
+				return HAE_ERROR;
+			}
+			off += sent;
+		}
+	}
+	else
+	{
+		sent = sendto(pSession->fd, pSession->txBuf, len, 0, (struct sockaddr *)&pSession->peer, sizeof(pSession->peer));
+		if (sent < 0)
+		{
+			perror("sendto DATEX");
+			return HAE_ERROR;
+		}
+	}
+
+	pSession->txPackets++;
+
+	return HAE_OK;
+}
+
+static int sSendAccept(DATEX_SESSION *pSession, unsigned int packetNbr, OSINT32 type, OSUINT32 serial)
+{
+	int status;
+	PDUs pdu;
+	Accept accept;
+
+	memset(&accept, 0, sizeof(accept));
+	accept.datexAccept_Packet_nbr = packetNbr;
+	accept.datexAccept_Type.t = type;
+	if (T_Accept_datexAccept_Type_logIn == type)
+	{
+		accept.datexAccept_Type.u.logIn = &datex_uper_oid;
+	}
+	else if (T_Accept_datexAccept_Type_registered_subscription == type)
+	{
+		accept.datexAccept_Type.u.registered_subscription = serial;
+	}
+
+	pdu.t = T_PDUs_accept;
+	pdu.u.accept = &accept;
+
+	pthread_mutex_lock(&pSession->txLock);
+	rtxMemReset(&pSession->txCtxt);
+	status = sSendLocked(pSession, &pdu);
+	pthread_mutex_unlock(&pSession->txLock);
+
+	return status;
+}
+
+static int sSendReject(DATEX_SESSION *pSession, unsigned int packetNbr, OSINT32 type, OSUINT32 code)
+{
+	int status;
+	PDUs pdu;
+	Reject reject;
+
+	memset(&reject, 0, sizeof(reject));
+	reject.datexReject_Packet_nbr = packetNbr;
+	reject.datexReject_Type.t = type;
+	if (T_RejectType_datexReject_Login_cd == type)
+	{
+		reject.datexReject_Type.u.datexReject_Login_cd = code;
+	}
+	else if (T_RejectType_datexReject_Subscription_cd == type)
+	{
+		reject.datexReject_Type.u.datexReject_Subscription_cd = code;
+	}
+	else
+	{
+		reject.datexReject_Type.u.datexReject_Publication_cd = code;
+	}
+
+	pdu.t = T_PDUs_reject;
+	pdu.u.reject = &reject;
+
+	pthread_mutex_lock(&pSession->txLock);
+	rtxMemReset(&pSession->txCtxt);
+	status = sSendLocked(pSession, &pdu);
+	pthread_mutex_unlock(&pSession->txLock);
+
+	return status;
+}
+
+/* txLock held, frameCnt <= DATEX_PUBLISH_MAX, pubSerial from sTakePubSerial */
+static int sPublishLocked(DATEX_SESSION *pSession, unsigned int subSerial, unsigned int pubSerial, MessageFrame *pFrames,
+	unsigned int frameCnt)
+{
+	unsigned int i;
+	PDUs pdu;
+	Publication pub;
+	_SeqOfPublicationData list;
+	PublicationData data[DATEX_PUBLISH_MAX];
+
+	rtxDListInit(&list);
+	for (i = 0; i < frameCnt; i++)
+	{
+		data[i].datexPublish_SubscribeSerial_nbr = subSerial;
+		data[i].datexPublish_Serial_nbr = pubSerial + i;
+		data[i].datexPublish_LatePublicationFlag = FALSE;
+		data[i].datexPublish_Type.t = T_PublicationType_datexPublish_Data;
+		data[i].datexPublish_Type.u.datexPublish_Data = &pFrames[i];
+		rtxDListAppend(&pSession->txCtxt, &list, &data[i]);
+	}
+
+	pub.datexPublish_Guaranteed_bool = FALSE;
+	pub.datexPublish_Format.t = T_Publish_Format_datexPublish_Data;
+	pub.datexPublish_Format.u.datexPublish_Data = &list;
+
+	pdu.t = T_PDUs_publication;
+	pdu.u.publication = &pub;
+
+	return sSendLocked(pSession, &pdu);
+}
+
+static void sHandleSlot(DATEX_SESSION *pSession, DATEX_SLOT *pSlot)
+{
+	int stat;
+	unsigned short crc;
+	DATEX_HEADER header;
+	DatexDataPacket packet;
+	C2CAuthenticatedMessage msg;
+	MessageFrame frame;
+	OSCTXT *pctxt = &pSession->rxCtxt;
+
+	pSession->rxPackets++;
+
+	if (DATEX_FRAMING_HDR == pSession->framing)
+	{
+		/* checked by the reader */
+		DatexHdr_Parse(pSlot->data, pSlot->len, &header);
+		pu_setBuffer(pctxt, pSlot->data + DATEX_HDR_SIZE, header.length, FALSE);
+	}
+	else
+	{
+		memset(&header, 0, sizeof(header));
+		header.type = DATEX_TYPE_PACKET;
+		header.seq = (unsigned int)pSession->rxPackets;
+		pu_setBuffer(pctxt, pSlot->data, pSlot->len, FALSE);
+	}
+
+	if (DATEX_TYPE_FRAME == header.type)
+	{
+		/* bare MessageFrame, as broadcast by the RSU */
+		memset(&frame, 0, sizeof(frame));
+		stat = asn1PD_MessageFrame(pctxt, &frame);
+		if ((0 == stat) && (HAE_NULL != pSession->pfPublish))
+		{
+			pSession->rxFrames++;
+			pSession->pfPublish(pSession->pArg, 0, &frame);
+		}
+	}
+	else
+	{
+		memset(&packet, 0, sizeof(packet));
+		stat = asn1PD_DatexDataPacket(pctxt, &packet);
+		if (0 == stat)
+		{
+			crc = sCrc16(packet.datex_Data.data, packet.datex_Data.numocts);
+			if ((2 != packet.datex_Crc_nbr.numocts) ||
+				(packet.datex_Crc_nbr.data[0] != (crc >> 8)) || (packet.datex_Crc_nbr.data[1] != (crc & 0xff)))
+			{
+				printf("[DATEX] ERROR : CRC mismatch in packet %u\n", header.seq);
+				pSession->rxErrors++;
+				return;
+			}
+
+			pu_setBuffer(pctxt, (OSOCTET *)packet.datex_Data.data, packet.datex_Data.numocts, FALSE);
+			memset(&msg, 0, sizeof(msg));
+			stat = asn1PD_C2CAuthenticatedMessage(pctxt, &msg);
+			if (0 == stat)
+			{
+				sHandlePdu(pSession, &msg);
+			}
+		}
+	}
+
+	if (0 != stat)
+	{
+		rtxErrPrint(pctxt);
+		rtxErrReset(pctxt);
+		pSession->rxErrors++;
+	}
+}
+
+static void sHandlePdu(DATEX_SESSION *pSession, C2CAuthenticatedMessage *pMsg)
+{
+	unsigned int packetNbr = pMsg->datex_DataPacket_number;
+	PDUs *pPdu = &pMsg->pdu;
+
+	switch (pPdu->t)
+	{
+		case T_PDUs_login:
+			sHandleLogin(pSession, packetNbr, pPdu->u.login);
+			break;
+
+		case T_PDUs_subscription:
+			sHandleSubscription(pSession, packetNbr, pPdu->u.subscription);
+			break;
+
+		case T_PDUs_publication:
+			sHandlePublication(pSession, packetNbr, pPdu->u.publication);
+			break;
+
+		case T_PDUs_accept:
+			if (T_Accept_datexAccept_Type_logIn == pPdu->u.accept->datexAccept_Type.t)
+			{
+				pthread_mutex_lock(&pSession->stateLock);
+				if (DATEX_STATE_LOGIN == pSession->state)
+				{
+					pSession->state = DATEX_STATE_ONLINE;
+				}
+				pthread_mutex_unlock(&pSession->stateLock);
+			}
+			break;
+
+		case T_PDUs_reject:
+			printf("[DATEX] Reject of packet %u, type %d\n", pPdu->u.reject->datexReject_Packet_nbr, pPdu->u.reject->datexReject_Type.t);
+			if (T_RejectType_datexReject_Login_cd == pPdu->u.reject->datexReject_Type.t)
+			{
+				sSetState(pSession, DATEX_STATE_CLOSED);
+			}
+			break;
+
+		case T_PDUs_logout:
+		case T_PDUs_terminate:
+			sSetState(pSession, DATEX_STATE_CLOSED);
+			break;
+
+		default:
+			/* Initiate, FrED (heartbeat), TransferDone: nothing to do */
+			break;
+	}
+}
+
+static void sHandleLogin(DATEX_SESSION *pSession, unsigned int packetNbr, Login *pLogin)
+{
+	if (DATEX_ROLE_SERVER != pSession->role)
+	{
+		return;
+	}
+
+	if ((HAE_NULL != pSession->pUser) &&
+		((pLogin->datexLogin_UserName_txt.numocts != strlen(pSession->pUser)) ||
+		 (0 != memcmp(pLogin->datexLogin_UserName_txt.data, pSession->pUser, pLogin->datexLogin_UserName_txt.numocts)) ||
+		 (HAE_NULL == pSession->pPassword) ||
+		 (pLogin->datexLogin_Password_txt.numocts != strlen(pSession->pPassword)) ||
+		 (0 != memcmp(pLogin->datexLogin_Password_txt.data, pSession->pPassword, pLogin->datexLogin_Password_txt.numocts))))
+	{
+		printf("[DATEX] ERROR : login of %s rejected\n", (const char *)pLogin->datex_Sender_txt);
+		sSendReject(pSession, packetNbr, T_RejectType_datexReject_Login_cd, invalidNamePassword);
+		return;
+	}
+
+	pSession->heartbeatSec = pLogin->datexLogin_HeartbeatDurationMax_qty;
+	sSetState(pSession, DATEX_STATE_ONLINE);
+	sSendAccept(pSession, packetNbr, T_Accept_datexAccept_Type_logIn, 0);
+}
+
+static void sHandleSubscription(DATEX_SESSION *pSession, unsigned int packetNbr, Subscription *pSubscription)
+{
+	unsigned int serial = pSubscription->datexSubscribe_Serial_nbr;
+	int single;
+	DATEX_SUB *pSub;
+	DATEX_SUB sub;
+	SubscriptionData *pData;
+	Registered *pRegistered = HAE_NULL;
+	MessageFrame frame;
+
+	if (DATEX_ROLE_SERVER != pSession->role)
+	{
+		return;
+	}
+	if (DATEX_STATE_ONLINE != DatexSession_State(pSession))
+	{
+		sSendReject(pSession, packetNbr, T_RejectType_datexReject_Subscription_cd, other_7);
+		return;
+	}
+
+	if (T_SubscriptionType_subscription != pSubscription->datexSubscribe_Type.t)
+	{
+		/* cancel */
+		pthread_mutex_lock(&pSession->subLock);
+		pSub = sFindSub(pSession, serial, HAE_FALSE);
+		if (HAE_NULL != pSub)
+		{
+			pSub->used = HAE_FALSE;
+		}
+		pthread_mutex_unlock(&pSession->subLock);
+
+		if (HAE_NULL == pSub)
+		{
+			sSendReject(pSession, packetNbr, T_RejectType_datexReject_Subscription_cd, unknownSubscriptionNbr);
+		}
+		else
+		{
+			sSendAccept(pSession, packetNbr, T_Accept_datexAccept_Type_registered_subscription, serial);
+		}
+		return;
+	}
+
+	pData = pSubscription->datexSubscribe_Type.u.subscription;
+	if (T_SubscriptionMode_event_driven == pData->datexSubscribe_Mode.t)
+	{
+		pRegistered = pData->datexSubscribe_Mode.u.event_driven;
+	}
+	else if (T_SubscriptionMode_periodic == pData->datexSubscribe_Mode.t)
+	{
+		pRegistered = pData->datexSubscribe_Mode.u.periodic;
+		if (T_Registered_continuous != pRegistered->t)
+		{
+			/* daily schedules are not supported */
+			sSendReject(pSession, packetNbr, T_RejectType_datexReject_Subscription_cd, invalid_mode);
+			return;
+		}
+	}
+
+	/* a single request is answered here and keeps no slot; it replaces
+	   an earlier subscription of the same serial */
+	single = (T_SubscriptionMode_single == pData->datexSubscribe_Mode.t);
+
+	pthread_mutex_lock(&pSession->subLock);
+	pSub = sFindSub(pSession, serial, !single);
+	if (single)
+	{
+		if (HAE_NULL != pSub)
+		{
+			pSub->used = HAE_FALSE;
+		}
+		memset(&sub, 0, sizeof(sub));
+		sub.used = HAE_TRUE;
+		sub.serial = serial;
+		pSub = &sub;
+	}
+	if (HAE_NULL != pSub)
+	{
+		pSub->mode = pData->datexSubscribe_Mode.t;
+		pSub->messageId = pData->datexSubscribe_Pdu.messageId;
+		pSub->periodMs = 0;
+		if ((HAE_NULL != pRegistered) && (T_Registered_continuous == pRegistered->t))
+		{
+			pSub->periodMs = pRegistered->u.continuous->datexRegistered_UpdateDelay_qty;
+		}
+		pSub->nextMs = 0;
+	}
+	pthread_mutex_unlock(&pSession->subLock);
+
+	if (HAE_NULL == pSub)
+	{
+		sSendReject(pSession, packetNbr, T_RejectType_datexReject_Subscription_cd, other_7);
+		return;
+	}
+
+	if (!single)
+	{
+		sSendAccept(pSession, packetNbr, T_Accept_datexAccept_Type_registered_subscription, serial);
+		return;
+	}
+
+	sSendAccept(pSession, packetNbr, T_Accept_datexAccept_Type_single_subscription, 0);
+
+	if (HAE_NULL != pSession->pfProvide)
+	{
+		pthread_mutex_lock(&pSession->txLock);
+		rtxMemReset(&pSession->txCtxt);
+		memset(&frame, 0, sizeof(frame));
+		if (HAE_OK == pSession->pfProvide(pSession->pArg, &sub, &pSession->txCtxt, &frame))
+		{
+			sPublishLocked(pSession, sub.serial, sub.pubSerial, &frame, 1);
+		}
+		pthread_mutex_unlock(&pSession->txLock);
+	}
+}
+
+static void sHandlePublication(DATEX_SESSION *pSession, unsigned int packetNbr, Publication *pPub)
+{
+	OSRTDListNode *pnode;
+	PublicationData *pData;
+
+	if (T_Publish_Format_datexPublish_Data != pPub->datexPublish_Format.t)
+	{
+		return;
+	}
+
+	for (pnode = pPub->datexPublish_Format.u.datexPublish_Data->head; pnode != 0; pnode = pnode->next)
+	{
+		pData = (PublicationData *)pnode->data;
+
+		if (T_PublicationType_datexPublish_Data == pData->datexPublish_Type.t)
+		{
+			pSession->rxFrames++;
+			if (HAE_NULL != pSession->pfPublish)
+			{
+				pSession->pfPublish(pSession->pArg, pData->datexPublish_SubscribeSerial_nbr, pData->datexPublish_Type.u.datexPublish_Data);
+			}
+		}
+		else
+		{
+			printf("[DATEX] subscription %u management %u\n", pData->datexPublish_SubscribeSerial_nbr,
+				   pData->datexPublish_Type.u.datexPublication_Management_cd);
+		}
+	}
+
+	if (pPub->datexPublish_Guaranteed_bool)
+	{
+		sSendAccept(pSession, packetNbr, T_Accept_datexAccept_Type_publication, 0);
+	}
+}
+
+/* subLock held */
+static DATEX_SUB *sFindSub(DATEX_SESSION *pSession, unsigned int serial, int alloc)
+{
+	int i;
+	DATEX_SUB *pFree = HAE_NULL;
+
+	for (i = 0; i < DATEX_SUB_MAX; i++)
+	{
+		if (pSession->sub[i].used)
+		{
+			if (pSession->sub[i].serial == serial)
+			{
+				return &pSession->sub[i];
+			}
+		}
+		else if (HAE_NULL == pFree)
+		{
+			pFree = &pSession->sub[i];
+		}
+	}
+
+	if (alloc && (HAE_NULL != pFree))
+	{
+		memset(pFree, 0, sizeof(DATEX_SUB));
+		pFree->used = HAE_TRUE;
+		pFree->serial = serial;
+		return pFree;
+	}
+
+	return HAE_NULL;
+}
+
+/* takes cnt publication serials of a subscription, HAE_ERROR once it is gone */
+static int sTakePubSerial(DATEX_SESSION *pSession, unsigned int serial, unsigned int cnt, unsigned int *pPubSerial)
+{
+	DATEX_SUB *pSub;
+
+	pthread_mutex_lock(&pSession->subLock);
+	pSub = sFindSub(pSession, serial, HAE_FALSE);
+	if (HAE_NULL != pSub)
+	{
+		*pPubSerial = pSub->pubSerial;
+		pSub->pubSerial += cnt;
+	}
+	pthread_mutex_unlock(&pSession->subLock);
+
+	return (HAE_NULL != pSub) ? HAE_OK : HAE_ERROR;
+}
+
+static void sSetState(DATEX_SESSION *pSession, int state)
+{
+	pthread_mutex_lock(&pSession->stateLock);
+	pSession->state = state;
+	pthread_mutex_unlock(&pSession->stateLock);
+}
+
+/* CRC-16/CCITT-FALSE (poly 0x1021, init 0xffff) */
+static unsigned short sCrc16(const unsigned char *pBuf, unsigned int len)
+{
+	unsigned int i;
+	unsigned short crc = 0xffff;
+
+	for (i = 0; i < len; i++)
+	{
+		crc = (unsigned char)(crc >> 8) | (crc << 8);
+		crc ^= pBuf[i];
+		crc ^= (unsigned char)(crc & 0xff) >> 4;
+		crc ^= (crc << 8) << 4;
+		crc ^= ((crc & 0xff) << 4) << 1;
+	}
+
+	return crc;
+}
+
+static int sSetRxTimeout(int fd)
+{
+	struct timeval tv;
+
+	tv.tv_sec = DATEX_RX_TIMEOUT_MS / 1000;
+	tv.tv_usec = (DATEX_RX_TIMEOUT_MS % 1000) * 1000;
+
+	if (setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, (char *)&tv, sizeof(tv)) < 0)
+	{
+		perror("setsockopt SO_RCVTIMEO");
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
@@ -0,0 +1,160 @@
+#ifndef DATEX_SESSION_H
+#define DATEX_SESSION_H
+
+#include <ISO14827-2.h>
+#include <DSRC.h>
+
+#include <pthread.h>
+#include <netinet/in.h>
+
+/* On the wire a session sends and expects bare UPER DatexDataPackets
+   (ISO 14827-2): one per UDP datagram, back to back on a TCP stream,
+   where the reader finds the end of each packet by decoding it.
+
+   DATEX_FRAMING_HDR is a private framing of this code base and NOT part
+   of ISO 14827 or any other standard; only two ends both built from this
+   code understand it. It is off unless DatexSession_SetFraming asks for
+   it. Then a 16 byte header goes in front of every TCP frame / UDP
+   datagram, all fields big endian:
+     0..1   marker  DATEX_HDR_MARKER
+     2      version DATEX_HDR_VERSION
+     3      type    DATEX_TYPE_*
+     4..7   seq     sender packet number
+     8..11  length  payload bytes following the header
+     12..15 timeMs  sender CLOCK_MONOTONIC, ms, low 32 bits
+   The payload of DATEX_TYPE_FRAME is a bare UPER MessageFrame, the same
+   thing decodeSample finds at dsrc_data[16]. */
+#define DATEX_FRAMING_NONE		0			/* bare DatexDataPacket, default */
+#define DATEX_FRAMING_HDR		1			/* private header, not standard */
+
+#define DATEX_HDR_SIZE			16
+#define DATEX_HDR_MARKER		0x4458		/* "DX" */
+#define DATEX_HDR_VERSION		1
+
+#define DATEX_TYPE_FRAME		0			/* UPER MessageFrame */
+#define DATEX_TYPE_PACKET		1			/* UPER DatexDataPacket(C2CAuthenticatedMessage) */
+
+#define DATEX_FRAME_MAX			16384		/* [header +] packet */
+#define DATEX_RING_CNT			64			/* frames between reader and decoder */
+#define DATEX_SUB_MAX			16
+#define DATEX_PUBLISH_MAX		32			/* PublicationData per packet */
+
+#define DATEX_ROLE_CLIENT		0
+#define DATEX_ROLE_SERVER		1
+
+#define DATEX_TRANSPORT_TCP		0
+#define DATEX_TRANSPORT_UDP		1
+
+#define DATEX_STATE_IDLE		0
+#define DATEX_STATE_LOGIN		1			/* client: Login sent */
+#define DATEX_STATE_ONLINE		2
+#define DATEX_STATE_CLOSED		3
+
+typedef struct{
+	unsigned short marker;
+	unsigned char version;
+	unsigned char type;
+	unsigned int seq;
+	unsigned int length;
+	unsigned int timeMs;
+} DATEX_HEADER;
+
+typedef struct{
+	unsigned int len;					/* [header +] packet */
+	unsigned char data[DATEX_FRAME_MAX];
+} DATEX_SLOT;
+
+typedef struct{
+	unsigned char used;
+	unsigned char mode;					/* T_SubscriptionMode_* */
+	unsigned int serial;				/* datexSubscribe_Serial_nbr */
+	unsigned int periodMs;				/* periodic: datexRegistered_UpdateDelay_qty */
+	unsigned long long nextMs;
+	unsigned int pubSerial;
+	DSRCmsgID messageId;				/* from datexSubscribe_Pdu */
+} DATEX_SUB;
+
+/* client: one call per received MessageFrame, valid during the call only */
+typedef void (*DATEX_PUBLISH_HANDLER)(void *pArg, unsigned int subSerial, const MessageFrame *pFrame);
+/* server: fill *pFrame (memory from pctxt) for a due subscription,
+   return HAE_OK to publish it */
+typedef int (*DATEX_PROVIDER)(void *pArg, const DATEX_SUB *pSub, OSCTXT *pctxt, MessageFrame *pFrame);
+
+typedef struct{
+	int role;
+	int transport;
+	int framing;						/* DATEX_FRAMING_* */
+	int fd;
+	int listenFd;
+	struct sockaddr_in peer;
+	unsigned char peerValid;
+	int state;							/* DATEX_STATE_*, under stateLock */
+	pthread_mutex_t stateLock;
+
+	const char *pSender;
+	const char *pDestination;
+	const char *pUser;
+	const char *pPassword;
+	unsigned short heartbeatSec;
+
+	DATEX_PUBLISH_HANDLER pfPublish;
+	DATEX_PROVIDER pfProvide;
+	void *pArg;
+
+	DATEX_SUB sub[DATEX_SUB_MAX];
+	pthread_mutex_t subLock;
+
+	/* encoder side, any thread */
+	OSCTXT txCtxt;
+	unsigned int txSeq;
+	unsigned char txInner[DATEX_FRAME_MAX];
+	unsigned char txBuf[DATEX_FRAME_MAX];
+	pthread_mutex_t txLock;
+
+	/* reader thread fills slots, decoder thread drains them */
+	unsigned char *pStream;				/* TCP without header: bytes read past the last packet */
+	unsigned int streamLen;
+	OSCTXT lenCtxt;						/* reader: finds the end of a packet */
+	DATEX_SLOT *pRing;
+	unsigned int head;
+	unsigned int tail;
+	unsigned char rxEof;
+	pthread_mutex_t ringLock;
+	pthread_cond_t notEmpty;
+	pthread_cond_t notFull;
+	OSCTXT rxCtxt;
+	pthread_t readThread;
+	pthread_t decodeThread;
+	unsigned char running;
+
+	unsigned long rxPackets;
+	unsigned long rxFrames;				/* MessageFrames delivered to pfPublish */
+	unsigned long rxErrors;
+	unsigned long txPackets;
+} DATEX_SESSION;
+
+int DatexHdr_Parse(const unsigned char *pBuf, unsigned int ulLength, DATEX_HEADER *pHeader);
+void DatexHdr_Build(unsigned char *pBuf, unsigned char type, unsigned int seq, unsigned int length);
+
+int DatexSession_Init(DATEX_SESSION *pSession, int role, int transport, DATEX_PUBLISH_HANDLER pfPublish, DATEX_PROVIDER pfProvide, void *pArg);
+void DatexSession_SetIdentity(DATEX_SESSION *pSession, const char *pSender, const char *pDestination, const char *pUser, const char *pPassword);
+void DatexSession_SetFraming(DATEX_SESSION *pSession, int framing);
+void DatexSession_Free(DATEX_SESSION *pSession);
+
+int DatexSession_Listen(DATEX_SESSION *pSession, const char *pAddr, unsigned short port);
+int DatexSession_Accept(DATEX_SESSION *pSession);
+int DatexSession_Connect(DATEX_SESSION *pSession, const char *pAddr, unsigned short port);
+int DatexSession_Start(DATEX_SESSION *pSession);
+void DatexSession_Stop(DATEX_SESSION *pSession);
+
+int DatexSession_Login(DATEX_SESSION *pSession);
+int DatexSession_Logout(DATEX_SESSION *pSession);
+int DatexSession_Subscribe(DATEX_SESSION *pSession, unsigned int serial, DSRCmsgID messageId, int mode, unsigned int periodMs);
+int DatexSession_Cancel(DATEX_SESSION *pSession, unsigned int serial);
+int DatexSession_Publish(DATEX_SESSION *pSession, unsigned int serial, MessageFrame *pFrames, unsigned int frameCnt);
+int DatexSession_Tick(DATEX_SESSION *pSession, unsigned long long nowMs);
+int DatexSession_State(DATEX_SESSION *pSession);
+
+unsigned long long DatexSession_NowMs(void);
+
+#endif
@@ -3,6 +3,7 @@
 #include <DSRC.h>
 #include <rtxsrc/rtxMemLeakCheck.h>
 #include <rtxsrc/rtxDiag.h>
+#include <rtxsrc/rtxDiagBitTrace.h>
 #include <rtxsrc/rtxPrint.h>
 
 #include <stdio.h>
@@ -16,19 +17,14 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 
-#define	HAE_TRUE				((unsigned char)1)
-#define	HAE_FALSE				((unsigned char)0)
-
-#define	HAE_OK					((int )0)
-#define	HAE_ERROR				((int)-1)
-
-#define HAE_NULL				((void *)0)
-
-#define DSRC_PORT				60000
-#define LOCAL_PORT				50000
-#define LOCAL_SOURCE_PORT		55555
-
-#define BUFF_SIZE				1024
+#include "haeCommon.h"
+#include "asnType.h"
+#include "jsonExport.h"
+#include "flightRecorder.h"
+#include "decodeStats.h"
+#include "captureLog.h"
+#include "eventLoop.h"
+#include "psmAggregator.h"
 
 // Message ID : 19
 // unsigned char spat_sample[130] = 
@@ -59,22 +55,182 @@ SIG_SPAT sig_SPaT[7];
 struct sockaddr_in dsrc_addr, dsrx_rx_addr, local_addr;
 struct sockaddr_in source_addr;
 
-socklen_t rx_dsrc_len;
 int UDPRxDSRC;
 
-int dsrc_sock_fd;
-int local_sock_fd;
+int local_sock_fd = -1;
 
-unsigned char dsrc_data[BUFF_SIZE] = {0,};
 unsigned char local_data[BUFF_SIZE] = {0,};
-
-unsigned char sDecode_MessageFrame(OSCTXT *pctxt, unsigned char *pBuf, unsigned int ulLength, MessageFrame *pFrame);
-unsigned char sDecode_DSRCmsg(OSCTXT *pctxt, unsigned short uiMessageId, unsigned char *pBuf, unsigned int ulLength, unsigned char *pMessage);
+struct timespec dsrc_rx_time;
+
+/* DSRC_UDP=<[addr]:port[@interface]>,... are the UDP sources, a socket
+   each (a radio, a channel, an interface), read by one epoll loop in
+   this thread (default 192.168.1.255:DSRC_PORT).
+   DSRC_CONTROL_SOCKET=<path> is a UNIX datagram socket taking "stats"
+   (counters per source) and "stop".
+   DSRC_PUBLISH_PERIOD=<ms> sends the last SPaT table to the local port
+   on a timer instead of after every SPaT, in local_data. */
+EVENT_LOOP rx_loop;
+unsigned int publish_period = 0;
+unsigned char publish_new = HAE_FALSE;
+
+/* DSRC_JSON_EXPORT=<file>|-|tcp:a.b.c.d:port exports the decoded
+   messages as JSON lines */
+JSON_EXPORT json_export;
+unsigned char json_export_on = HAE_FALSE;
+
+/* last FLIGHT_RING_CNT datagrams, decode errors and crashes dumped to
+   DSRC_FLIGHT_DIR (default /tmp) */
+FLIGHT_RECORDER flight_rec;
+unsigned long flight_ticket;
+
+/* counters and latency histograms per DSRCmsgID, snapshot as JSON on the
+   UNIX socket DSRC_STATS_SOCKET and / or rewritten to DSRC_STATS_FILE
+   every DSRC_STATS_PERIOD ms (default 1000) */
+DECODE_STATS decode_stats;
+unsigned long long stats_rx_ns;
+unsigned long long stats_decoded_ns;
+size_t stats_heap_base;
+size_t stats_heap_used;
+
+/* DSRC_CAPTURE_DIR=<dir> appends every datagram to a capture log for
+   captureReplay, in segments of DSRC_CAPTURE_SEGMENT_MB (default 64); a
+   timer writes out what a quiet channel leaves in the buffer */
+CAPTURE_WRITER capture_log;
+unsigned char capture_on = HAE_FALSE;
+
+/* DSRC_PSM_INTERSECTIONS=<id>:<lat>:<lon>[:<xMin>,<yMin>,<xMax>,<yMax>]...;...
+   counts the decoded PSMs in the crosswalk boxes of those intersections
+   (lat/lon in 1/10 micro degree, boxes in meters east/north of them).
+   Every DSRC_PSM_PERIOD ms (default 1000) a PSM_AGG_REPORT per
+   intersection goes to the local port; it is longer than the BUFF_SIZE
+   SPaT table, which is how a reader tells the two apart. */
+PSM_AGG psm_agg;
+unsigned char psm_agg_on = HAE_FALSE;
+
+/* Diagnostics of the decode path. HAE_DIAG_LEVEL (make DIAG_LEVEL=n) is
+   the highest level compiled in, DSRC_DIAG_LEVEL selects one at run time
+   (default 0):
+     0 - decode only: no rtxSetDiag, pu_setTrace, bit field list or print
+     1 - one message in DSRC_TRACE_SAMPLE (default 1000) is traced
+     2 - every message is traced
+   A traced message is decoded with diagnostics and a bit field list, its
+   bit fields and value are printed. With HAE_DIAG_LEVEL 0 none of it is
+   in the binary. Errors are printed at every level. */
+#if HAE_DIAG_LEVEL > 0
+unsigned int diag_level = 0;
+unsigned int diag_sample = 1000;
+unsigned long diag_count = 0;
+unsigned char diag_trace = HAE_FALSE;			/* trace the current datagram */
+
+void sDiag_Init(void);
+unsigned char sDiag_Sample(void);
+#endif
+
+unsigned char sDecode_Frame(OSCTXT *pctxt, unsigned char *pBuf, unsigned int ulLength, MessageFrame *pFrame, void **ppValue);
 void parseSpat(SPAT *pSpat);
 
 int UDP_Init(void);
+int sRx_Init(void);
+void sRx_Dsrc(void *pArg, const EVENT_DGRAM *pDgram);
+void sRx_Publish(void *pArg, unsigned long long expired);
+void sRx_Capture(void *pArg, unsigned long long expired);
+void sRx_Psm(void *pArg, unsigned long long expired);
+int sPsm_Init(void);
+void sPsm_Publish(void *pArg, const PSM_AGG_REPORT *pReport);
+size_t sRx_Control(void *pArg, const char *pCmd, char *pReply, size_t replySize);
+void sShutdown(void);
 
 void main(void)
+{
+	/* Decode SPAT message */
+	printf("\n[SPAT] Decode\n");
+
+	/* before the first context, it installs the heap count */
+	DecodeStats_Init(&decode_stats);
+	if((HAE_NULL != getenv("DSRC_STATS_SOCKET")) || (HAE_NULL != getenv("DSRC_STATS_FILE")))
+	{
+		DecodeStats_StartExport(&decode_stats, getenv("DSRC_STATS_SOCKET"), getenv("DSRC_STATS_FILE"),
+			(HAE_NULL != getenv("DSRC_STATS_PERIOD")) ? atoi(getenv("DSRC_STATS_PERIOD")) : 1000);
+	}
+	if(UDP_Init() < 0)
+	{
+		exit(1);
+	}
+	if(HAE_NULL != getenv("DSRC_JSON_EXPORT"))
+	{
+		if(HAE_OK == JsonExport_Open(&json_export, getenv("DSRC_JSON_EXPORT")))
+		{
+			json_export_on = HAE_TRUE;
+		}
+	}
+#if HAE_DIAG_LEVEL > 0
+	sDiag_Init();
+#endif
+	if(HAE_NULL != getenv("DSRC_CAPTURE_DIR"))
+	{
+		if(HAE_OK == CaptureLog_OpenWriter(&capture_log, getenv("DSRC_CAPTURE_DIR"),
+			(HAE_NULL != getenv("DSRC_CAPTURE_SEGMENT_MB")) ? (size_t)atoi(getenv("DSRC_CAPTURE_SEGMENT_MB")) * 1024 * 1024 : 0))
+		{
+			capture_on = HAE_TRUE;
+		}
+	}
+	if(sPsm_Init() < 0)
+	{
+		sShutdown();
+		exit(1);
+	}
+	if(HAE_OK == FlightRec_Init(&flight_rec, (HAE_NULL != getenv("DSRC_FLIGHT_DIR")) ? getenv("DSRC_FLIGHT_DIR") : "/tmp"))
+	{
+		FlightRec_InstallCrashHandler(&flight_rec);
+	}
+	if(sRx_Init() < 0)
+	{
+		sShutdown();
+		exit(1);
+	}
+	printf("Start\r\n");
+
+	// printf("%d\r\n", sizeof(SIG_SPAT)*10);
+	
+	/* until "stop" on DSRC_CONTROL_SOCKET */
+	EventLoop_Run(&rx_loop);
+	sShutdown();
+	printf("Stop\r\n");
+}
+
+/* what main opened, in reverse order: the capture segment and the JSON
+   batch are written out, the threads joined, the sockets removed */
+void sShutdown(void)
+{
+	EventLoop_Free(&rx_loop);
+	FlightRec_Free(&flight_rec);
+	if(HAE_TRUE == psm_agg_on)
+	{
+		PsmAgg_Free(&psm_agg);
+		psm_agg_on = HAE_FALSE;
+	}
+	if(HAE_TRUE == capture_on)
+	{
+		CaptureLog_CloseWriter(&capture_log);
+		capture_on = HAE_FALSE;
+	}
+	if(HAE_TRUE == json_export_on)
+	{
+		JsonExport_Close(&json_export);
+		json_export_on = HAE_FALSE;
+	}
+	if(local_sock_fd >= 0)
+	{
+		close(local_sock_fd);
+		local_sock_fd = -1;
+	}
+	DecodeStats_Free(&decode_stats);
+}
+
+/* one datagram of a DSRC_UDP source: every message type is decoded and
+   counted, a SPaT is also parsed into sig_SPaT and published, a PSM goes
+   to the aggregator */
+void sRx_Dsrc(void *pArg, const EVENT_DGRAM *pDgram)
 {
 	int ret = 0;
 	int i = 0;
@@ -82,6 +238,8 @@ void main(void)
 	int send = 0;
 	// struct sig_SPaT *p = malloc(sizeof(sig_SPaT)*10);
 	void *p;
+	unsigned char *pData;
+	unsigned long long published_ns;
 
 	OSCTXT ctxt2;
 	
@@ -89,42 +247,68 @@ void main(void)
 	unsigned int ulLength;
 	MessageFrame tFrame2;
 
-	/* Decode SPAT message */
-	printf("\n[SPAT] Decode\n");
-	SPAT pSpat;
+	void *pValue;
 
-	// pEncodingData = spat_sample;
-	// ulLength = 130;
-	ulLength = 197-16;
-	if(ret = UDP_Init() < 0)
+	(void)pArg;
+
+	pData = (unsigned char *)pDgram->pData;
+	UDPRxDSRC = (int)pDgram->len;
+	memcpy(&dsrc_addr, &pDgram->from, sizeof(dsrc_addr));
+	dsrc_rx_time = pDgram->rxTime;
+	stats_rx_ns = DecodeStats_Now();
+	if(UDPRxDSRC > 0)
 	{
-		exit(1);
+		flight_ticket = FlightRec_Record(&flight_rec, pData, UDPRxDSRC, 16, &dsrc_rx_time, &dsrc_addr);
+		if(HAE_TRUE == capture_on)
+		{
+			CaptureLog_Append(&capture_log, pData, UDPRxDSRC, stats_rx_ns, &dsrc_addr);
+		}
 	}
-	printf("Start\r\n");
+#if HAE_DIAG_LEVEL > 0
+	diag_trace = sDiag_Sample();
+#endif
+	if(UDPRxDSRC > 17)
+	{	
+#if HAE_DIAG_LEVEL > 0
+		if(HAE_TRUE == diag_trace)
+		{
+			printf("recv data: %d   0x%2X\r\n", UDPRxDSRC, pData[17]);
+		}
+#endif
+		pEncodingData = &pData[16];
 
-	// printf("%d\r\n", sizeof(SIG_SPAT)*10);
-	
-	for(;;)
-	{
-		memset(&dsrc_data, 0, BUFF_SIZE);//sizeof(dsrc_data));
-		rx_dsrc_len = sizeof(dsrc_addr);
-	
-		// UDPRxDSRC = recvfrom(dsrc_sock_fd, dsrc_data, sizeof(dsrc_data), 0, (struct sockaddr *) &dsrc_addr, &rx_dsrc_len);
-		UDPRxDSRC = recvfrom(dsrc_sock_fd, dsrc_data, BUFF_SIZE, 0, (struct sockaddr *) &dsrc_addr, &rx_dsrc_len);
-		printf("recv data: %d   0x%2X\r\n", UDPRxDSRC, dsrc_data[17]);
-		if((dsrc_data[17] == 0x13))// && (UDPRxDSRC == 197))  // 0x13 == 19
-		{	
-			pEncodingData = &dsrc_data[16];
+		ulLength = UDPRxDSRC - 16;
 
-			ulLength = UDPRxDSRC - 16;
+		stats_heap_base = DecodeStats_HeapBytes();
+		stats_decoded_ns = 0;
+		published_ns = 0;
+		status = sDecode_Frame(&ctxt2, pEncodingData, ulLength, &tFrame2, &pValue);
+		FlightRec_SetStatus(&flight_rec, flight_ticket, (HAE_OK == status) ? FLIGHT_STATUS_OK : FLIGHT_STATUS_ERROR, tFrame2.messageId);
+		if(HAE_OK != status)
+		{
+			FlightRec_Dump(&flight_rec, flight_ticket);
+		}
+
+		stats_heap_used = DecodeStats_HeapBytes() - stats_heap_base;
+		if(HAE_OK != status)
+		{
+			ret = rtxErrGetStatus(&ctxt2);
+			DecodeStats_Record(&decode_stats, tFrame2.messageId, ulLength, (0 != ret) ? ret : RTERR_FAILED,
+				stats_rx_ns, DecodeStats_Now(), 0, stats_heap_used);
+		}
 
-			memset(&tFrame2, 0x00, sizeof(MessageFrame));
-			status = sDecode_MessageFrame(&ctxt2, pEncodingData, ulLength, (MessageFrame *)&tFrame2);
-			status = sDecode_DSRCmsg(&ctxt2, tFrame2.messageId, (unsigned char *)tFrame2.value.data, (unsigned int)tFrame2.value.numocts, (unsigned char *)&pSpat);
+		if((HAE_OK == status) && (HAE_TRUE == psm_agg_on) && (ASN1V_personalSafetyMessage == tFrame2.messageId))
+		{
+			PsmAgg_InputPsm(&psm_agg, (PersonalSafetyMessage *)pValue);
+		}
 
-			parseSpat((SPAT *)&pSpat);
-			
-			rtFreeContext (&ctxt2);
+		if(ASN1V_signalPhaseAndTimingMessage == tFrame2.messageId)
+		{
+			/* a failed decode leaves the value half filled */
+			if(HAE_OK == status)
+			{
+				parseSpat((SPAT *)pValue);
+			}
 			
 			p= malloc(BUFF_SIZE);// malloc(sizeof(SIG_SPAT) * 10);
 			
@@ -153,114 +337,227 @@ void main(void)
 			}
 			
 			// send = sendto(local_sock_fd, local_data, sizeof(local_data), 0, (struct sockaddr *) &local_addr, sizeof(local_addr));
-			send = sendto(local_sock_fd, p, BUFF_SIZE, 0, (struct sockaddr *) &local_addr, sizeof(local_addr));
+			if(0 == publish_period)
+			{
+				send = sendto(local_sock_fd, p, BUFF_SIZE, 0, (struct sockaddr *) &local_addr, sizeof(local_addr));
+			}
+			else
+			{
+				/* sRx_Publish sends the last one */
+				memcpy(local_data, p, BUFF_SIZE);
+				publish_new = HAE_TRUE;
+			}
+			published_ns = DecodeStats_Now();
 		
 			// free(&sig_SPaT);
 			free(p);
 
-			printf("Send SPaT Message to ROS node\r\n");
-			
+#if HAE_DIAG_LEVEL > 0
+			if(HAE_TRUE == diag_trace)
+			{
+				printf("Send SPaT Message to ROS node\r\n");
+			}
+#endif
 
 			for(i=0;i<7;i++)
 			{
 				memset(&sig_SPaT[i], 0, sizeof(SIG_SPAT));
 			}
 		}
-		
+		rtFreeContext (&ctxt2);
+
+		if(HAE_OK == status)
+		{
+			DecodeStats_Record(&decode_stats, tFrame2.messageId, ulLength, 0,
+				stats_rx_ns, stats_decoded_ns, published_ns, stats_heap_used);
+		}
 	}
-	
-	
 }
 
-unsigned char sDecode_MessageFrame(OSCTXT *pctxt, unsigned char *pBuf, unsigned int ulLength, MessageFrame *pFrame)
+/* the sources of DSRC_UDP, the control socket, the publish, capture and
+   PSM timers */
+int sRx_Init(void)
 {
-	unsigned char status = HAE_OK;
-	
-	unsigned char 	verbose = HAE_TRUE;
-	unsigned char	aligned = HAE_FALSE;
-	unsigned char	trace = HAE_TRUE;
-
-
-	/************************************************
-		1. Initialize variables
-	*************************************************/
-
-	DECLARE_MEMLEAK_DETECTOR;
+	char spec[EVENT_NAME_MAX];
+	char defSpec[EVENT_NAME_MAX];
+	const char *pList = getenv("DSRC_UDP");
+	const char *pEnd;
+	size_t len;
 
-	if(HAE_NULL == pBuf)
+	if(HAE_OK != EventLoop_Init(&rx_loop))
 	{
-		status = HAE_ERROR;
-		printf( "[CENTER] ERROR : pBuf is NULL\n");
+		return -1;
 	}
-
-	/************************************************
-		2. Initializes an OSCTXT block  
-	*************************************************/
-
-	if(HAE_OK == status)
+	if(HAE_NULL == pList)
 	{
-		status = rtInitContext (pctxt);
-		if (HAE_OK == status)
+		snprintf(defSpec, sizeof(defSpec), "192.168.1.255:%d", DSRC_PORT);
+		pList = defSpec;
+	}
+	while('\0' != *pList)
+	{
+		pEnd = strchr(pList, ',');
+		len = (HAE_NULL != pEnd) ? (size_t)(pEnd - pList) : strlen(pList);
+		if(len >= sizeof(spec))
 		{
-			rtxSetDiag (pctxt, verbose);
-			pu_setBuffer (pctxt, pBuf, ulLength, aligned);
-			pu_setTrace (pctxt, trace);
+			printf("[RX] ERROR : DSRC_UDP source %.*s too long\n", (int)len, pList);
+			return -1;
 		}
-		else
+		memcpy(spec, pList, len);
+		spec[len] = '\0';
+		if(EventLoop_AddUdp(&rx_loop, spec, sRx_Dsrc, HAE_NULL) < 0)
 		{
-			rtxErrPrint (pctxt);
-			status = HAE_ERROR;
-			printf( "[CENTER] ERROR : rtInitContext() for MessageFrame\n");
+			return -1;
 		}
+		printf("UDP DSRC Socket %s has been created.\n", spec);
+		pList += len + ((HAE_NULL != pEnd) ? 1 : 0);
 	}
 
-	/************************************************
-		3. Decoding MessageFrame 
-	*************************************************/
-
-	if(HAE_OK == status)
+	if((HAE_NULL != getenv("DSRC_CONTROL_SOCKET")) &&
+		(EventLoop_AddControl(&rx_loop, getenv("DSRC_CONTROL_SOCKET"), sRx_Control, HAE_NULL) < 0))
 	{
-		status = asn1PD_MessageFrame(pctxt, pFrame);
-		
-		if(HAE_OK == status)
+		return -1;
+	}
+	if(HAE_NULL != getenv("DSRC_PUBLISH_PERIOD"))
+	{
+		publish_period = (unsigned int)atoi(getenv("DSRC_PUBLISH_PERIOD"));
+		if((publish_period > 0) && (EventLoop_AddTimer(&rx_loop, "publish", publish_period, sRx_Publish, HAE_NULL) < 0))
 		{
-			if(HAE_TRUE == trace)
-			{
-				printf("[CENTER] decode of MessageFrame was successful\n");
-				// asn1Print_MessageFrame("Decode MessageFrame", pFrame);
-			}
+			return -1;
 		}
-		else
+	}
+	if((HAE_TRUE == capture_on) &&
+		(EventLoop_AddTimer(&rx_loop, "capture", CAPTURE_FLUSH_MS / 4, sRx_Capture, HAE_NULL) < 0))
+	{
+		return -1;
+	}
+	if((HAE_TRUE == psm_agg_on) &&
+		(EventLoop_AddTimer(&rx_loop, "psm", (psm_agg.periodMs >= 4) ? psm_agg.periodMs / 4 : 1, sRx_Psm, HAE_NULL) < 0))
+	{
+		return -1;
+	}
+	return 0;
+}
+
+/* DSRC_PUBLISH_PERIOD: the last SPaT table, if there is a new one */
+void sRx_Publish(void *pArg, unsigned long long expired)
+{
+	(void)pArg;
+	(void)expired;
+
+	if(HAE_TRUE == publish_new)
+	{
+		sendto(local_sock_fd, local_data, BUFF_SIZE, 0, (struct sockaddr *) &local_addr, sizeof(local_addr));
+		publish_new = HAE_FALSE;
+	}
+}
+
+/* DSRC_CAPTURE_DIR: the buffer of a quiet channel goes out at most
+   CAPTURE_FLUSH_MS and a quarter after its first record */
+void sRx_Capture(void *pArg, unsigned long long expired)
+{
+	(void)pArg;
+	(void)expired;
+
+	CaptureLog_Tick(&capture_log, DecodeStats_Now());
+}
+
+/* DSRC_PSM_INTERSECTIONS: PsmAgg_Tick publishes once a period is over,
+   looking four times a period keeps a late timer from skipping one */
+void sRx_Psm(void *pArg, unsigned long long expired)
+{
+	(void)pArg;
+	(void)expired;
+
+	PsmAgg_Tick(&psm_agg, DecodeStats_Now() / 1000000ULL);
+}
+
+/* one report per intersection and period, on the local port */
+void sPsm_Publish(void *pArg, const PSM_AGG_REPORT *pReport)
+{
+	(void)pArg;
+
+	sendto(local_sock_fd, pReport, sizeof(PSM_AGG_REPORT), 0, (struct sockaddr *) &local_addr, sizeof(local_addr));
+}
+
+/* DSRC_PSM_INTERSECTIONS and DSRC_PSM_PERIOD, nothing to do without them */
+int sPsm_Init(void)
+{
+	const char *pList = getenv("DSRC_PSM_INTERSECTIONS");
+	unsigned int periodMs = 1000;
+
+	if(HAE_NULL == pList)
+	{
+		return 0;
+	}
+	if((HAE_NULL != getenv("DSRC_PSM_PERIOD")) && (atoi(getenv("DSRC_PSM_PERIOD")) > 0))
+	{
+		periodMs = (unsigned int)atoi(getenv("DSRC_PSM_PERIOD"));
+	}
+	if(HAE_OK != PsmAgg_Init(&psm_agg, periodMs, sPsm_Publish, HAE_NULL))
+	{
+		return -1;
+	}
+	psm_agg_on = HAE_TRUE;
+
+	while('\0' != *pList)
+	{
+		if(HAE_OK != PsmAgg_AddSpec(&psm_agg, pList))
 		{
-			rtxErrPrint (pctxt);
-			status = HAE_ERROR;
-			printf( "[CENTER] ERROR : decode of MessageFrame failed\n");
+			return -1;
 		}
+		pList += strcspn(pList, ";");
+		pList += (';' == *pList) ? 1 : 0;
 	}
+	printf("PSM aggregation for %u intersection(s), every %u ms\n", psm_agg.intersectionCnt, periodMs);
+	return 0;
+}
 
-	return status;
+/* DSRC_CONTROL_SOCKET commands */
+size_t sRx_Control(void *pArg, const char *pCmd, char *pReply, size_t replySize)
+{
+	(void)pArg;
+
+	if(0 == strcmp(pCmd, "stats"))
+	{
+		return EventLoop_Report(&rx_loop, pReply, replySize);
+	}
+	if(0 == strcmp(pCmd, "stop"))
+	{
+		EventLoop_Stop(&rx_loop);
+		return (size_t)snprintf(pReply, replySize, "stopping\n");
+	}
+	return (size_t)snprintf(pReply, replySize, "unknown command \"%s\", stats or stop\n", pCmd);
 }
 
+
 /*************************************************************
  *
- * Function 		: sDecode_DSRCmsg
+ * Function 		: sDecode_Frame
  * 
- * Description	: Decode DSRCmsg
+ * Description	: Decode a MessageFrame and its value, of every
+ *				  message type asnType.c knows
  *
- * Parameter	: 
+ * Parameter	: pctxt - initialised here, the caller frees it
+ *				  when it is done with the value
+ *				  pBuf, ulLength - the MessageFrame
+ *				  pFrame - decoded frame, messageId 0 if it fails
+ *				  ppValue - decoded value, in memory of pctxt
  * 
- * Returns		: 
+ * Returns		: HAE_OK, HAE_ERROR
  *
- * Notes		: 
+ * Notes		: stats_decoded_ns is taken after the decode
  *
  *************************************************************/
-unsigned char sDecode_DSRCmsg(OSCTXT *pctxt, unsigned short uiMessageId, unsigned char *pBuf, unsigned int ulLength, unsigned char *pMessage)
+unsigned char sDecode_Frame(OSCTXT *pctxt, unsigned char *pBuf, unsigned int ulLength, MessageFrame *pFrame, void **ppValue)
 {
 	unsigned char status = HAE_OK;
+	const ASN_TYPE *pType = HAE_NULL;
+	int ret;
 	
-	unsigned char 	verbose = HAE_TRUE;
-	unsigned char	aligned = HAE_FALSE;
-	unsigned char	trace = HAE_TRUE;
+#if HAE_DIAG_LEVEL > 0
+	unsigned char	trace = diag_trace;
+#endif
+
 
 	/************************************************
 		1. Initialize variables
@@ -268,6 +565,9 @@ unsigned char sDecode_DSRCmsg(OSCTXT *pctxt, unsigned short uiMessageId, unsigne
 
 	DECLARE_MEMLEAK_DETECTOR;
 
+	memset(pFrame, 0x00, sizeof(MessageFrame));
+	*ppValue = HAE_NULL;
+
 	if(HAE_NULL == pBuf)
 	{
 		status = HAE_ERROR;
@@ -283,106 +583,118 @@ unsigned char sDecode_DSRCmsg(OSCTXT *pctxt, unsigned short uiMessageId, unsigne
 		status = rtInitContext (pctxt);
 		if (HAE_OK == status)
 		{
-			rtxSetDiag (pctxt, verbose);
-			pu_setBuffer (pctxt, pBuf, ulLength, aligned);
-			pu_setTrace (pctxt, trace);
+#if HAE_DIAG_LEVEL > 0
+			if(HAE_TRUE == trace)
+			{
+				rtxSetDiag (pctxt, TRUE);
+				pu_setTrace (pctxt, TRUE);
+				rtxDiagCtxtBitFieldListInit (pctxt);
+			}
+#endif
 		}
 		else
 		{
 			rtxErrPrint (pctxt);
 			status = HAE_ERROR;
-			printf( "[CENTER] ERROR : rtInitContext() for DSRCmsg\n");
+			printf( "[CENTER] ERROR : rtInitContext() for MessageFrame\n");
 		}
 	}
 
 	/************************************************
-		3. Decoding DSRCmsg
+		3. Decoding MessageFrame and its value
 	*************************************************/
 
 	if(HAE_OK == status)
 	{
-		switch(uiMessageId)
-		{
-			case ASN1V_signalPhaseAndTimingMessage:
-				status = asn1PD_SPAT(pctxt, (SPAT *)pMessage);
-				printf("Decode SPaT OK\r\n");
-				break;
-				
-			case ASN1V_mapData:
-				status = asn1PD_MapData(pctxt, (MapData *)pMessage);
-				break;
-				
-				
-			case ASN1V_roadSideAlert:
-				status = asn1PD_RoadSideAlert(pctxt, (RoadSideAlert *)pMessage);
-				break;
-				
-			case ASN1V_rtcmCorrections:
-				status = asn1PD_RTCMcorrections(pctxt, (RTCMcorrections *)pMessage);
-				break;
-				
-			case ASN1V_travelerInformation:	
-				status = asn1PD_TravelerInformation(pctxt, (TravelerInformation *)pMessage);
-				break;
-				
-			case ASN1V_basicSafetyMessage:
-				status = asn1PD_BasicSafetyMessage(pctxt, (BasicSafetyMessage *)pMessage);
-				break;
-				
-			case ASN1V_probeVehicleData:
-			default:
-				printf( "[CENTER] ERROR : DSRCmsg Invalid messageId(0x%x)\n", uiMessageId);
-				break;
-		}	
+		ret = AsnType_DecodeFrame(pctxt, pBuf, ulLength, pFrame, &pType, ppValue);
+		stats_decoded_ns = DecodeStats_Now();
 		
-		if(HAE_OK == status)
+		if(0 == ret)
 		{
+			if(HAE_TRUE == json_export_on)
+			{
+				JsonExport_Message(&json_export, pFrame->messageId, pType, *ppValue, ulLength, &dsrc_rx_time, &dsrc_addr);
+			}
+#if HAE_DIAG_LEVEL > 0
 			if(HAE_TRUE == trace)
 			{
-				switch(uiMessageId)
+				printf("[CENTER] decode of MessageFrame was successful\n");
+				pu_bindump (pctxt, "MessageFrame");
+				if(0 != pType->pfPrint)
 				{
-					case ASN1V_mapData:
-						asn1Print_MapData("MapData", (MapData *)pMessage);
-						break;
-						
-					case ASN1V_signalPhaseAndTimingMessage:
-						asn1Print_SPAT("SPAT", (SPAT *)pMessage);
-						
-						break;
-						
-					case ASN1V_roadSideAlert:
-						asn1Print_RoadSideAlert("RSA", (RoadSideAlert *)pMessage);
-						break;
-						
-					case ASN1V_rtcmCorrections:
-						asn1Print_RTCMcorrections("RTCM", (RTCMcorrections *)pMessage);
-						break;
-						
-					case ASN1V_travelerInformation:
-						asn1Print_TravelerInformation("TIM", (TravelerInformation *)pMessage);
-						break;
-						
-					case ASN1V_basicSafetyMessage:
-						asn1Print_BasicSafetyMessage("BSM", (BasicSafetyMessage *)pMessage);
-						break;
-									
-					case ASN1V_probeVehicleData:						
-					default :
-						break;
+					pType->pfPrint(pctxt, pType->pName, *ppValue);
 				}
 			}
+#endif
+		}
+		else if(RTERR_NOTSUPP == ret)
+		{
+			status = HAE_ERROR;
+			printf( "[CENTER] ERROR : DSRCmsg Invalid messageId(0x%x)\n", pFrame->messageId);
+		}
+		else
+		{
+			rtxErrPrint (pctxt);
+			status = HAE_ERROR;
+			printf( "[CENTER] ERROR : decode of %s failed\n", (HAE_NULL != pType) ? pType->pName : "MessageFrame");
 		}
-	}
-	else
-	{
-		rtxErrPrint (pctxt);
-		status = HAE_ERROR;
-		printf( "[CENTER] ERROR : decode of DSRCmsg failed\n");
 	}
 
 	return status;
 }
 
+#if HAE_DIAG_LEVEL > 0
+/*************************************************************
+ *
+ * Function 		: sDiag_Init
+ * 
+ * Description	: Run time diagnostics level from DSRC_DIAG_LEVEL,
+ *				  limited to HAE_DIAG_LEVEL, and the sampling rate
+ *				  of level 1 from DSRC_TRACE_SAMPLE
+ *
+ *************************************************************/
+void sDiag_Init(void)
+{
+	const char *pEnv;
+
+	if(HAE_NULL != (pEnv = getenv("DSRC_DIAG_LEVEL")))
+	{
+		diag_level = (unsigned int)atoi(pEnv);
+	}
+	if(diag_level > HAE_DIAG_LEVEL)
+	{
+		printf("[CENTER] diagnostics level %u, %d compiled in\n", diag_level, HAE_DIAG_LEVEL);
+		diag_level = HAE_DIAG_LEVEL;
+	}
+	if((HAE_NULL != (pEnv = getenv("DSRC_TRACE_SAMPLE"))) && (atoi(pEnv) > 0))
+	{
+		diag_sample = (unsigned int)atoi(pEnv);
+	}
+}
+
+/*************************************************************
+ *
+ * Function 		: sDiag_Sample
+ * 
+ * Description	: Decide whether the datagram just received is traced
+ *
+ * Returns		: HAE_TRUE, HAE_FALSE
+ *
+ *************************************************************/
+unsigned char sDiag_Sample(void)
+{
+	if(diag_level >= 2)
+	{
+		return HAE_TRUE;
+	}
+	if(0 == diag_level)
+	{
+		return HAE_FALSE;
+	}
+
+	return (0 == (diag_count++ % diag_sample)) ? HAE_TRUE : HAE_FALSE;
+}
+#endif
 
 void parseSpat(SPAT *pSpat)
 {
@@ -579,41 +891,15 @@ void parseSpat(SPAT *pSpat)
 	}
 }
 
+/* the local socket the SPaT table is sent from, the DSRC sources are
+   opened by sRx_Init */
 int UDP_Init(void)
 {
-	int optVal = 1;
-	int optLen = sizeof(optVal);
-
-	printf("UDP DSRC Socket has been created.\n");
-
-	// Open UDP Port for DSRC
-	if ((dsrc_sock_fd = socket(AF_INET, SOCK_DGRAM, 0)) < 0) {
-		perror("socket ");
-		return -1;
-	}
-
-	memset(&dsrc_addr, 0x00, sizeof(dsrc_addr));
-	dsrc_addr.sin_family = AF_INET;
-	// dsrc_addr.sin_addr.s_addr = inet_addr("192.168.10.101"); // FOR Lab Test
-	dsrc_addr.sin_addr.s_addr = inet_addr("192.168.1.255"); //htonl(INADDR_ANY);
-	dsrc_addr.sin_port = htons(DSRC_PORT);
-	
-	setsockopt(dsrc_sock_fd, SOL_SOCKET, SO_RCVTIMEO, (char *)&optVal, optLen);
-	
-	if (bind(dsrc_sock_fd, (struct sockaddr *) &dsrc_addr, sizeof(dsrc_addr))
-			< 0) {
-		perror("bind DSRC");
-		return 1;
-	}
-	printf("UDP DSRC Socket has been created.\n");
-
 	// Open UDP Port for Local
 	if ((local_sock_fd = socket(AF_INET, SOCK_DGRAM, 0)) < 0) {
 		perror("socket ");
 		return -1;
 	}
-    
-
 
 	memset(&local_addr, 0x00, sizeof(local_addr));
 	local_addr.sin_family = AF_INET;
@@ -627,8 +913,9 @@ int UDP_Init(void)
 	if (bind(local_sock_fd, (struct sockaddr *) &source_addr, sizeof(source_addr))
 			< 0) {
 		perror("bind Local");
-		return 1;
+		return -1;
 	}
 	printf("UDP Local Socket has been created.\n");
 
-}
\ No newline at end of file
+	return 0;
+}
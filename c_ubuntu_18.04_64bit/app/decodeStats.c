@@ -0,0 +1,580 @@
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "decodeStats.h"
+
+#define STATS_HEAP_HDR			16			/* size in front of a block, keeps malloc alignment */
+#define STATS_SEQ_RETRY			100
+
+static const char *stats_lat_name[STATS_LAT_CNT] = { "decode", "publish", "total" };
+
+static __thread size_t stats_heap_bytes = 0;
+static int stats_alloc_installed = HAE_FALSE;
+
+static unsigned int sIndex(unsigned int messageId);
+static unsigned long long sBucketLow(unsigned int idx);
+static void sAppend(DECODE_STATS *pStats, const char *fmt, ...);
+static void sAppendHist(DECODE_STATS *pStats, const STATS_HIST *pHist);
+static void *sExportThread(void *pArg);
+static void sWriteFile(DECODE_STATS *pStats);
+static void *sMalloc(OSSIZE size);
+static void *sRealloc(void *ptr, OSSIZE size);
+static void sFree(void *ptr);
+
+/*************************************************************
+ *
+ * Function 		: DecodeStats_Init
+ *
+ * Description	: Zero counters. The first call also installs the
+ *				  runtime allocation functions of the heap count, so
+ *				  it has to come before the first rtInitContext.
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int DecodeStats_Init(DECODE_STATS *pStats)
+{
+	memset(pStats, 0x00, sizeof(DECODE_STATS));
+	pStats->listenFd = -1;
+
+	if (HAE_FALSE == stats_alloc_installed)
+	{
+		rtxMemSetAllocFuncs(sMalloc, sRealloc, sFree);
+		stats_alloc_installed = HAE_TRUE;
+	}
+
+	return HAE_OK;
+}
+
+void DecodeStats_Free(DECODE_STATS *pStats)
+{
+	if (HAE_TRUE == pStats->running)
+	{
+		pStats->running = HAE_FALSE;
+		pthread_join(pStats->thread, HAE_NULL);
+	}
+	if (pStats->listenFd >= 0)
+	{
+		close(pStats->listenFd);
+		unlink(pStats->socketPath);
+		pStats->listenFd = -1;
+	}
+	free(pStats->pText);
+	pStats->pText = HAE_NULL;
+	pStats->textSize = 0;
+}
+
+/* CLOCK_MONOTONIC in ns, the time base of DecodeStats_Record */
+unsigned long long DecodeStats_Now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* bytes the ASN.1 runtime holds in the calling thread */
+size_t DecodeStats_HeapBytes(void)
+{
+	return stats_heap_bytes;
+}
+
+/*************************************************************
+ *
+ * Function 		: DecodeStats_Record
+ *
+ * Description	: Count one received message.
+ *
+ * Parameter	: messageId - DSRCmsgID
+ *				  bytes - encoded length
+ *				  errCode - 0, or the rtxErrGetStatus code of a
+ *				  failed decode
+ *				  rxNs, decodedNs, publishedNs - DecodeStats_Now at
+ *				  receive, after decode, after publish (0: not
+ *				  published)
+ *				  heapBytes - runtime heap held by the decode
+ *
+ *************************************************************/
+void DecodeStats_Record(DECODE_STATS *pStats, unsigned int messageId, size_t bytes, int errCode,
+	unsigned long long rxNs, unsigned long long decodedNs, unsigned long long publishedNs, size_t heapBytes)
+{
+	STATS_MSG *pMsg = &pStats->msg[sIndex(messageId)];
+
+	pMsg->seq++;
+	__sync_synchronize();
+
+	pMsg->messageId = messageId;
+	pMsg->msgCnt++;
+	pMsg->byteCnt += bytes;
+	pMsg->heapSum += heapBytes;
+	if (heapBytes > pMsg->heapMax)
+	{
+		pMsg->heapMax = heapBytes;
+	}
+
+	if (0 != errCode)
+	{
+		pMsg->errorCnt++;
+		pMsg->errByCode[((errCode < 0) && (errCode > -STATS_ERR_CODE_MAX)) ? -errCode : 0]++;
+	}
+	else
+	{
+		if (decodedNs >= rxNs)
+		{
+			DecodeStats_HistAdd(&pMsg->lat[STATS_LAT_DECODE], decodedNs - rxNs);
+		}
+		if ((0 != publishedNs) && (publishedNs >= decodedNs))
+		{
+			DecodeStats_HistAdd(&pMsg->lat[STATS_LAT_PUBLISH], publishedNs - decodedNs);
+			DecodeStats_HistAdd(&pMsg->lat[STATS_LAT_TOTAL], publishedNs - rxNs);
+		}
+	}
+
+	__sync_synchronize();
+	pMsg->seq++;
+}
+
+/*************************************************************
+ *
+ * Function 		: DecodeStats_StartExport
+ *
+ * Description	: Start the export thread.
+ *
+ * Parameter	: pSocketPath - UNIX socket, one snapshot per
+ *				  connection, NULL for none
+ *				  pFilePath - file rewritten every periodMs, NULL
+ *				  for none
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int DecodeStats_StartExport(DECODE_STATS *pStats, const char *pSocketPath, const char *pFilePath, unsigned int periodMs)
+{
+	struct sockaddr_un addr;
+
+	pStats->periodMs = (periodMs > 0) ? periodMs : 1000;
+	if (HAE_NULL != pFilePath)
+	{
+		snprintf(pStats->filePath, sizeof(pStats->filePath), "%s", pFilePath);
+	}
+
+	if (HAE_NULL != pSocketPath)
+	{
+		memset(&addr, 0x00, sizeof(addr));
+		addr.sun_family = AF_UNIX;
+		if (strlen(pSocketPath) >= sizeof(addr.sun_path))
+		{
+			printf("[STATS] ERROR : socket path %s too long\n", pSocketPath);
+			return HAE_ERROR;
+		}
+		strcpy(addr.sun_path, pSocketPath);
+		strcpy(pStats->socketPath, pSocketPath);
+
+		unlink(pSocketPath);
+		pStats->listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+		if ((pStats->listenFd < 0) || (0 != bind(pStats->listenFd, (struct sockaddr *)&addr, sizeof(addr))) ||
+			(0 != listen(pStats->listenFd, 4)))
+		{
+			printf("[STATS] ERROR : socket %s (%s)\n", pSocketPath, strerror(errno));
+			if (pStats->listenFd >= 0)
+			{
+				close(pStats->listenFd);
+				pStats->listenFd = -1;
+			}
+			return HAE_ERROR;
+		}
+	}
+
+	pStats->running = HAE_TRUE;
+	if (0 != pthread_create(&pStats->thread, HAE_NULL, sExportThread, pStats))
+	{
+		printf("[STATS] ERROR : pthread_create() for export\n");
+		pStats->running = HAE_FALSE;
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: DecodeStats_Snapshot
+ *
+ * Description	: Copy of the counters as one JSON object, built in
+ *				  a buffer of pStats. Called by the export thread, or
+ *				  by one thread if there is none.
+ *
+ * Returns		: the JSON text, valid until the next call
+ *
+ *************************************************************/
+const char *DecodeStats_Snapshot(DECODE_STATS *pStats, size_t *pLen)
+{
+	STATS_MSG *pSnap;
+	const ASN_TYPE *pType;
+	unsigned long seq;
+	unsigned int i, j, retry, cnt = 0;
+	int first;
+
+	for (i = 0; i < STATS_MSG_CNT; i++)
+	{
+		pSnap = &pStats->snap[i];
+		for (retry = 0; retry < STATS_SEQ_RETRY; retry++)
+		{
+			seq = pStats->msg[i].seq;
+			__sync_synchronize();
+			memcpy(pSnap, (const void *)&pStats->msg[i], sizeof(STATS_MSG));
+			__sync_synchronize();
+			if ((0 == (seq & 1)) && (seq == pStats->msg[i].seq))
+			{
+				break;
+			}
+		}
+		if (STATS_SEQ_RETRY == retry)
+		{
+			/* receive loop too busy to get a clean copy, leave it out */
+			pSnap->msgCnt = 0;
+		}
+	}
+
+	pStats->textLen = 0;
+	sAppend(pStats, "{\"timeNs\":%llu,\"messages\":[", DecodeStats_Now());
+	for (i = 0; i < STATS_MSG_CNT; i++)
+	{
+		pSnap = &pStats->snap[i];
+		if (0 == pSnap->msgCnt)
+		{
+			continue;
+		}
+		pType = AsnType_FindMessage(pSnap->messageId);
+		sAppend(pStats, "%s{\"id\":%u,\"type\":\"%s\",\"msgs\":%llu,\"bytes\":%llu,\"errors\":%llu,\"errorCodes\":{",
+			(cnt++ > 0) ? "," : "", pSnap->messageId, (HAE_NULL != pType) ? pType->pName : "unknown",
+			pSnap->msgCnt, pSnap->byteCnt, pSnap->errorCnt);
+		first = HAE_TRUE;
+		for (j = 0; j < STATS_ERR_CODE_MAX; j++)
+		{
+			if (0 != pSnap->errByCode[j])
+			{
+				if (0 == j)
+				{
+					sAppend(pStats, "%s\"other\":%llu", first ? "" : ",", pSnap->errByCode[j]);
+				}
+				else
+				{
+					sAppend(pStats, "%s\"-%u\":%llu", first ? "" : ",", j, pSnap->errByCode[j]);
+				}
+				first = HAE_FALSE;
+			}
+		}
+		sAppend(pStats, "},\"heapMax\":%llu,\"heapAvg\":%llu,\"latencyNs\":{", pSnap->heapMax, pSnap->heapSum / pSnap->msgCnt);
+		for (j = 0; j < STATS_LAT_CNT; j++)
+		{
+			sAppend(pStats, "%s\"%s\":", (j > 0) ? "," : "", stats_lat_name[j]);
+			sAppendHist(pStats, &pSnap->lat[j]);
+		}
+		sAppend(pStats, "}}");
+	}
+	sAppend(pStats, "]}\n");
+
+	if (HAE_NULL != pLen)
+	{
+		*pLen = pStats->textLen;
+	}
+
+	return (HAE_NULL != pStats->pText) ? pStats->pText : "";
+}
+
+/* DSRCmsgID 18..32 -> 0..14, testMessage00..15 (240..255) -> 15..30 */
+static unsigned int sIndex(unsigned int messageId)
+{
+	if ((messageId >= 18) && (messageId <= 32))
+	{
+		return messageId - 18;
+	}
+	if ((messageId >= 240) && (messageId <= 255))
+	{
+		return 15 + messageId - 240;
+	}
+
+	return STATS_MSG_OTHER;
+}
+
+/* below 16 ns one bucket per ns; above, the 4 bits after the highest
+   set bit pick one of 16 buckets of the power of two */
+void DecodeStats_HistAdd(STATS_HIST *pHist, unsigned long long ns)
+{
+	unsigned int idx, msb;
+
+	if (ns < STATS_SUB_CNT)
+	{
+		idx = (unsigned int)ns;
+	}
+	else
+	{
+		msb = 63 - __builtin_clzll(ns);
+		idx = (msb - STATS_SUB_BITS + 1) * STATS_SUB_CNT + (unsigned int)((ns >> (msb - STATS_SUB_BITS)) & (STATS_SUB_CNT - 1));
+		if (idx >= STATS_BUCKET_CNT)
+		{
+			idx = STATS_BUCKET_CNT - 1;
+		}
+	}
+
+	pHist->bucket[idx]++;
+	pHist->count++;
+	pHist->sumNs += ns;
+	if (ns > pHist->maxNs)
+	{
+		pHist->maxNs = ns;
+	}
+}
+
+static unsigned long long sBucketLow(unsigned int idx)
+{
+	unsigned int msb;
+
+	if (idx < STATS_SUB_CNT)
+	{
+		return idx;
+	}
+	msb = idx / STATS_SUB_CNT + STATS_SUB_BITS - 1;
+
+	return (unsigned long long)(STATS_SUB_CNT + idx % STATS_SUB_CNT) << (msb - STATS_SUB_BITS);
+}
+
+/* middle of the bucket holding the q quantile, at most the max */
+unsigned long long DecodeStats_HistPercentile(const STATS_HIST *pHist, double q)
+{
+	unsigned long long want, seen = 0, low, high;
+	unsigned int i;
+
+	if (0 == pHist->count)
+	{
+		return 0;
+	}
+	want = (unsigned long long)(q * pHist->count + 0.5);
+	if (0 == want)
+	{
+		want = 1;
+	}
+	for (i = 0; i < STATS_BUCKET_CNT; i++)
+	{
+		seen += pHist->bucket[i];
+		if (seen >= want)
+		{
+			break;
+		}
+	}
+	if (i == STATS_BUCKET_CNT)
+	{
+		return pHist->maxNs;
+	}
+	low = sBucketLow(i);
+	high = (i + 1 < STATS_BUCKET_CNT) ? sBucketLow(i + 1) : low;
+	low = low + (high - low) / 2;
+
+	return (low < pHist->maxNs) ? low : pHist->maxNs;
+}
+
+static void sAppend(DECODE_STATS *pStats, const char *fmt, ...)
+{
+	va_list ap;
+	char *pNew;
+	size_t size;
+	int n;
+
+	for (;;)
+	{
+		if (pStats->textSize > pStats->textLen)
+		{
+			va_start(ap, fmt);
+			n = vsnprintf(pStats->pText + pStats->textLen, pStats->textSize - pStats->textLen, fmt, ap);
+			va_end(ap);
+			if (n < 0)
+			{
+				return;
+			}
+			if ((size_t)n < pStats->textSize - pStats->textLen)
+			{
+				pStats->textLen += n;
+				return;
+			}
+		}
+		size = (pStats->textSize > 0) ? pStats->textSize * 2 : 65536;
+		if (HAE_NULL == (pNew = realloc(pStats->pText, size)))
+		{
+			printf("[STATS] ERROR : no memory for the snapshot\n");
+			return;
+		}
+		pStats->pText = pNew;
+		pStats->textSize = size;
+	}
+}
+
+/* summary and the non empty buckets as [low ns, count] */
+static void sAppendHist(DECODE_STATS *pStats, const STATS_HIST *pHist)
+{
+	unsigned int i;
+	int first = HAE_TRUE;
+
+	sAppend(pStats, "{\"count\":%llu,\"mean\":%llu,\"p50\":%llu,\"p90\":%llu,\"p99\":%llu,\"p999\":%llu,\"max\":%llu,\"buckets\":[",
+		pHist->count, (pHist->count > 0) ? pHist->sumNs / pHist->count : 0,
+		DecodeStats_HistPercentile(pHist, 0.5), DecodeStats_HistPercentile(pHist, 0.9),
+		DecodeStats_HistPercentile(pHist, 0.99), DecodeStats_HistPercentile(pHist, 0.999), pHist->maxNs);
+	for (i = 0; i < STATS_BUCKET_CNT; i++)
+	{
+		if (0 != pHist->bucket[i])
+		{
+			sAppend(pStats, "%s[%llu,%llu]", first ? "" : ",", sBucketLow(i), pHist->bucket[i]);
+			first = HAE_FALSE;
+		}
+	}
+	sAppend(pStats, "]}");
+}
+
+/* socket: one snapshot per connection; file: every periodMs */
+static void *sExportThread(void *pArg)
+{
+	DECODE_STATS *pStats = (DECODE_STATS *)pArg;
+	unsigned long long now, nextFile;
+	struct pollfd pfd;
+	const char *pText;
+	size_t len, done;
+	ssize_t n;
+	int fd, timeoutMs;
+
+	nextFile = DecodeStats_Now() + pStats->periodMs * 1000000ULL;
+	while (pStats->running)
+	{
+		/* short timeout: DecodeStats_Free only clears running */
+		timeoutMs = 200;
+		if ('\0' != pStats->filePath[0])
+		{
+			now = DecodeStats_Now();
+			if (now >= nextFile)
+			{
+				sWriteFile(pStats);
+				nextFile = now + pStats->periodMs * 1000000ULL;
+			}
+			if ((nextFile - now) / 1000000ULL < (unsigned long long)timeoutMs)
+			{
+				timeoutMs = (int)((nextFile - now) / 1000000ULL);
+			}
+		}
+
+		if (pStats->listenFd < 0)
+		{
+			usleep(timeoutMs * 1000);
+			continue;
+		}
+		pfd.fd = pStats->listenFd;
+		pfd.events = POLLIN;
+		if (poll(&pfd, 1, timeoutMs) <= 0)
+		{
+			continue;
+		}
+		if ((fd = accept(pStats->listenFd, HAE_NULL, HAE_NULL)) < 0)
+		{
+			continue;
+		}
+		pText = DecodeStats_Snapshot(pStats, &len);
+		for (done = 0; done < len; done += n)
+		{
+			n = send(fd, pText + done, len - done, MSG_NOSIGNAL);
+			if (n <= 0)
+			{
+				break;
+			}
+		}
+		close(fd);
+	}
+
+	return HAE_NULL;
+}
+
+static void sWriteFile(DECODE_STATS *pStats)
+{
+	char tmpPath[sizeof(pStats->filePath) + 8];
+	const char *pText;
+	size_t len;
+	FILE *pFile;
+
+	pText = DecodeStats_Snapshot(pStats, &len);
+	snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", pStats->filePath);
+	if (HAE_NULL == (pFile = fopen(tmpPath, "w")))
+	{
+		printf("[STATS] ERROR : cannot create %s\n", tmpPath);
+		return;
+	}
+	if (len != fwrite(pText, 1, len, pFile))
+	{
+		printf("[STATS] ERROR : cannot write %s\n", tmpPath);
+		fclose(pFile);
+		return;
+	}
+	if ((0 != fclose(pFile)) || (0 != rename(tmpPath, pStats->filePath)))
+	{
+		printf("[STATS] ERROR : cannot write %s\n", pStats->filePath);
+	}
+}
+
+/* runtime allocation functions: the block size in front of each block */
+static void *sMalloc(OSSIZE size)
+{
+	size_t *p = malloc(size + STATS_HEAP_HDR);
+
+	if (HAE_NULL == p)
+	{
+		return HAE_NULL;
+	}
+	p[0] = size;
+	stats_heap_bytes += size;
+
+	return (char *)p + STATS_HEAP_HDR;
+}
+
+static void *sRealloc(void *ptr, OSSIZE size)
+{
+	size_t *p, old;
+
+	if (HAE_NULL == ptr)
+	{
+		return sMalloc(size);
+	}
+	p = (size_t *)((char *)ptr - STATS_HEAP_HDR);
+	old = p[0];
+	if (HAE_NULL == (p = realloc(p, size + STATS_HEAP_HDR)))
+	{
+		return HAE_NULL;
+	}
+	p[0] = size;
+	/* a block freed in another thread than it was allocated in skews
+	   both threads' counts, the runtime does not do that */
+	stats_heap_bytes += size - old;
+
+	return (char *)p + STATS_HEAP_HDR;
+}
+
+static void sFree(void *ptr)
+{
+	size_t *p;
+
+	if (HAE_NULL == ptr)
+	{
+		return;
+	}
+	p = (size_t *)((char *)ptr - STATS_HEAP_HDR);
+	stats_heap_bytes -= p[0];
+	free(p);
+}
@@ -0,0 +1,93 @@
+#ifndef DECODE_STATS_H
+#define DECODE_STATS_H
+
+#include <stddef.h>
+#include <pthread.h>
+
+/* Decode instrumentation per DSRCmsgID: message, byte and error counters
+   (errors by rtxErrCodes / asn1ErrCodes code), heap high-water of the
+   decode and three latency histograms:
+
+     decode  - receive -> value decoded (asn1PD_ of frame and value)
+     publish - value decoded -> published (sent on, exported)
+     total   - receive -> published
+
+   The histograms are log-linear like HdrHistogram: 16 linear sub-buckets
+   per power of two, values in ns, 1/16 relative error, 1 ns .. ~1100 s.
+
+   DecodeStats_Record is called from one thread, the receive loop, and
+   takes no lock: the counters of a message type carry a sequence number
+   that is odd while they change, the export thread copies them and
+   retries while it sees a change. The export thread answers every
+   connection on a UNIX socket with one JSON snapshot and / or rewrites a
+   file with it periodically (write to <file>.tmp, rename).
+
+   The heap high-water counts what the ASN.1 runtime allocates (context
+   memory heap, dynamic buffers) in the thread, through the allocation
+   functions DecodeStats_Init installs with rtxMemSetAllocFuncs. */
+
+#define STATS_MSG_CNT			32			/* DSRCmsgID 18..32, 240..255, other */
+#define STATS_MSG_OTHER			(STATS_MSG_CNT - 1)
+#define STATS_ERR_CODE_MAX		128			/* -1..-127, [0] any other code */
+
+#define STATS_SUB_BITS			4
+#define STATS_SUB_CNT			(1 << STATS_SUB_BITS)
+#define STATS_BUCKET_CNT		((41 - STATS_SUB_BITS + 1) * STATS_SUB_CNT)	/* up to 2^41 ns */
+
+#define STATS_LAT_DECODE		0
+#define STATS_LAT_PUBLISH		1
+#define STATS_LAT_TOTAL			2
+#define STATS_LAT_CNT			3
+
+typedef struct{
+	unsigned long long count;
+	unsigned long long sumNs;
+	unsigned long long maxNs;
+	unsigned long long bucket[STATS_BUCKET_CNT];
+} STATS_HIST;
+
+typedef struct{
+	volatile unsigned long seq;			/* odd while the counters change */
+	unsigned int messageId;				/* last one seen (STATS_MSG_OTHER) */
+	unsigned long long msgCnt;
+	unsigned long long byteCnt;
+	unsigned long long errorCnt;
+	unsigned long long errByCode[STATS_ERR_CODE_MAX];
+	unsigned long long heapMax;			/* bytes */
+	unsigned long long heapSum;
+	STATS_HIST lat[STATS_LAT_CNT];
+} STATS_MSG;
+
+typedef struct{
+	STATS_MSG msg[STATS_MSG_CNT];		/* receive loop */
+	STATS_MSG snap[STATS_MSG_CNT];		/* export thread */
+
+	/* export thread */
+	pthread_t thread;
+	volatile int running;
+	int listenFd;
+	char socketPath[108];
+	char filePath[256];
+	unsigned int periodMs;
+	char *pText;
+	size_t textLen;
+	size_t textSize;
+} DECODE_STATS;
+
+int DecodeStats_Init(DECODE_STATS *pStats);
+void DecodeStats_Free(DECODE_STATS *pStats);
+
+unsigned long long DecodeStats_Now(void);
+size_t DecodeStats_HeapBytes(void);
+
+void DecodeStats_Record(DECODE_STATS *pStats, unsigned int messageId, size_t bytes, int errCode,
+	unsigned long long rxNs, unsigned long long decodedNs, unsigned long long publishedNs, size_t heapBytes);
+
+int DecodeStats_StartExport(DECODE_STATS *pStats, const char *pSocketPath, const char *pFilePath, unsigned int periodMs);
+const char *DecodeStats_Snapshot(DECODE_STATS *pStats, size_t *pLen);
+
+/* one histogram, for latencies measured outside DecodeStats_Record */
+void DecodeStats_HistAdd(STATS_HIST *pHist, unsigned long long ns);
+unsigned long long DecodeStats_HistPercentile(const STATS_HIST *pHist, double q);
+
+#endif
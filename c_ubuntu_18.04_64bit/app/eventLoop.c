@@ -0,0 +1,655 @@
+#define _GNU_SOURCE
+
+#include <rtxsrc/rtxSocket.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "haeCommon.h"
+#include "eventLoop.h"
+
+struct EVENT_BATCH{
+	struct mmsghdr msg[EVENT_BATCH_CNT];
+	struct iovec iov[EVENT_BATCH_CNT];
+	struct sockaddr_in from[EVENT_BATCH_CNT];
+	unsigned long long cmsg[EVENT_BATCH_CNT][8];		/* SCM_TIMESTAMPNS */
+	unsigned char buf[EVENT_BATCH_CNT][EVENT_DGRAM_SIZE];
+};
+
+static int sAdd(EVENT_LOOP *pLoop, int kind, const char *pName, OSRTSOCKET fd, int owned, unsigned int events);
+static void sReadUdp(EVENT_LOOP *pLoop, int id);
+static void sReadTimer(EVENT_LOOP *pLoop, int id);
+static void sReadControl(EVENT_LOOP *pLoop, int id);
+
+/*************************************************************
+ *
+ * Function 		: EventLoop_Init
+ *
+ * Description	: Empty loop.
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int EventLoop_Init(EVENT_LOOP *pLoop)
+{
+	struct EVENT_BATCH *pBatch;
+	int i;
+
+	memset(pLoop, 0x00, sizeof(EVENT_LOOP));
+	pLoop->epollFd = -1;
+	for (i = 0; i < EVENT_SOURCE_MAX; i++)
+	{
+		pLoop->source[i].fd = OSRTSOCKET_INVALID;
+	}
+	pBatch = (struct EVENT_BATCH *)calloc(1, sizeof(struct EVENT_BATCH));
+	if (HAE_NULL == pBatch)
+	{
+		printf("[EVENT] ERROR : no memory for the batch buffers\n");
+		return HAE_ERROR;
+	}
+	for (i = 0; i < EVENT_BATCH_CNT; i++)
+	{
+		pBatch->iov[i].iov_base = pBatch->buf[i];
+		pBatch->iov[i].iov_len = EVENT_DGRAM_SIZE;
+		pBatch->msg[i].msg_hdr.msg_iov = &pBatch->iov[i];
+		pBatch->msg[i].msg_hdr.msg_iovlen = 1;
+		pBatch->msg[i].msg_hdr.msg_name = &pBatch->from[i];
+		pBatch->msg[i].msg_hdr.msg_control = pBatch->cmsg[i];
+	}
+	pLoop->pBatch = pBatch;
+
+	rtxSocketsInit();
+	pLoop->epollFd = epoll_create1(EPOLL_CLOEXEC);
+	if (pLoop->epollFd < 0)
+	{
+		printf("[EVENT] ERROR : epoll_create1() (%s)\n", strerror(errno));
+		EventLoop_Free(pLoop);
+		return HAE_ERROR;
+	}
+	return HAE_OK;
+}
+
+void EventLoop_Free(EVENT_LOOP *pLoop)
+{
+	int i;
+
+	for (i = 0; i < EVENT_SOURCE_MAX; i++)
+	{
+		EventLoop_Remove(pLoop, i);
+	}
+	if (pLoop->epollFd >= 0)
+	{
+		close(pLoop->epollFd);
+		pLoop->epollFd = -1;
+	}
+	free(pLoop->pBatch);
+	pLoop->pBatch = HAE_NULL;
+}
+
+/*************************************************************
+ *
+ * Function 		: EventLoop_AddUdp
+ *
+ * Description	: Receive datagrams on a UDP port. Sockets of several
+ *				  sources may share a port (SO_REUSEADDR), e.g. one
+ *				  per interface.
+ *
+ * Parameter	: pSpec - [addr]:port[@interface]; addr a unicast or
+ *				  broadcast address of the host, empty or * for any;
+ *				  interface binds the socket to it (SO_BINDTODEVICE,
+ *				  needs CAP_NET_RAW)
+ *				  pfDgram - called for every datagram
+ *
+ * Returns		: source id, HAE_ERROR
+ *
+ *************************************************************/
+int EventLoop_AddUdp(EVENT_LOOP *pLoop, const char *pSpec, EVENT_DGRAM_FUNC pfDgram, void *pArg)
+{
+	char addrStr[EVENT_NAME_MAX];
+	const char *pIface, *pPort;
+	OSIPADDR addr = 0;
+	OSRTSOCKET fd;
+	int optVal = 1;
+	int rcvBuf = EVENT_RCVBUF_SIZE;
+	int port, id;
+	size_t len;
+
+	pPort = strrchr(pSpec, ':');
+	pIface = strchr(pSpec, '@');
+	if ((HAE_NULL == pPort) || ((HAE_NULL != pIface) && (pIface < pPort)) ||
+		((size_t)(pPort - pSpec) >= sizeof(addrStr)) || (strlen(pSpec) >= EVENT_NAME_MAX))
+	{
+		printf("[EVENT] ERROR : UDP source %s, [addr]:port[@interface] expected\n", pSpec);
+		return HAE_ERROR;
+	}
+	len = (size_t)(pPort - pSpec);
+	memcpy(addrStr, pSpec, len);
+	addrStr[len] = '\0';
+	port = atoi(pPort + 1);
+	if ((port <= 0) || (port > 65535) ||
+		((0 != len) && (0 != strcmp(addrStr, "*")) && (0 != rtxSocketStrToAddr(addrStr, &addr))))
+	{
+		printf("[EVENT] ERROR : UDP source %s, [addr]:port[@interface] expected\n", pSpec);
+		return HAE_ERROR;
+	}
+
+	if (0 != rtxSocketCreateUDP(&fd))
+	{
+		printf("[EVENT] ERROR : UDP source %s, socket (%s)\n", pSpec, strerror(errno));
+		return HAE_ERROR;
+	}
+	setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &optVal, sizeof(optVal));
+	setsockopt(fd, SOL_SOCKET, SO_BROADCAST, &optVal, sizeof(optVal));
+	setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, &optVal, sizeof(optVal));
+	setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvBuf, sizeof(rcvBuf));
+	if ((HAE_NULL != pIface) &&
+		(0 != setsockopt(fd, SOL_SOCKET, SO_BINDTODEVICE, pIface + 1, (socklen_t)strlen(pIface + 1))))
+	{
+		printf("[EVENT] ERROR : UDP source %s, interface (%s)\n", pSpec, strerror(errno));
+		rtxSocketClose(fd);
+		return HAE_ERROR;
+	}
+	if ((0 != rtxSocketBind(fd, addr, port)) || (0 != rtxSocketSetBlocking(fd, FALSE)))
+	{
+		printf("[EVENT] ERROR : UDP source %s, bind (%s)\n", pSpec, strerror(errno));
+		rtxSocketClose(fd);
+		return HAE_ERROR;
+	}
+
+	id = sAdd(pLoop, EVENT_KIND_UDP, pSpec, fd, HAE_TRUE, EPOLLIN | EPOLLET);
+	if (id >= 0)
+	{
+		pLoop->source[id].pfDgram = pfDgram;
+		pLoop->source[id].pArg = pArg;
+		/* datagrams may be waiting since the bind, there is no edge for them */
+		pLoop->source[id].ready = HAE_TRUE;
+		pLoop->readyCnt++;
+	}
+	return id;
+}
+
+/*************************************************************
+ *
+ * Function 		: EventLoop_AddTimer
+ *
+ * Description	: Call pfTimer every periodMs, the first time periodMs
+ *				  from now.
+ *
+ * Returns		: source id, HAE_ERROR
+ *
+ *************************************************************/
+int EventLoop_AddTimer(EVENT_LOOP *pLoop, const char *pName, unsigned int periodMs, EVENT_TIMER_FUNC pfTimer,
+	void *pArg)
+{
+	struct itimerspec spec;
+	int fd, id;
+
+	fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	if ((0 == periodMs) || (fd < 0))
+	{
+		printf("[EVENT] ERROR : timer %s of %u ms (%s)\n", pName, periodMs, (fd < 0) ? strerror(errno) : "no period");
+		if (fd >= 0)
+		{
+			close(fd);
+		}
+		return HAE_ERROR;
+	}
+	spec.it_interval.tv_sec = periodMs / 1000;
+	spec.it_interval.tv_nsec = (long)(periodMs % 1000) * 1000000L;
+	spec.it_value = spec.it_interval;
+	timerfd_settime(fd, 0, &spec, HAE_NULL);
+
+	id = sAdd(pLoop, EVENT_KIND_TIMER, pName, fd, HAE_TRUE, EPOLLIN | EPOLLET);
+	if (id >= 0)
+	{
+		pLoop->source[id].pfTimer = pfTimer;
+		pLoop->source[id].pArg = pArg;
+	}
+	return id;
+}
+
+/*************************************************************
+ *
+ * Function 		: EventLoop_AddControl
+ *
+ * Description	: Local control socket, a UNIX datagram socket at
+ *				  pPath (replaced if it is there, removed by
+ *				  EventLoop_Remove).
+ *
+ * Returns		: source id, HAE_ERROR
+ *
+ *************************************************************/
+int EventLoop_AddControl(EVENT_LOOP *pLoop, const char *pPath, EVENT_CONTROL_FUNC pfControl, void *pArg)
+{
+	struct sockaddr_un addr;
+	int fd, id;
+
+	memset(&addr, 0x00, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (strlen(pPath) >= sizeof(addr.sun_path))
+	{
+		printf("[EVENT] ERROR : control socket path %s too long\n", pPath);
+		return HAE_ERROR;
+	}
+	strcpy(addr.sun_path, pPath);
+
+	unlink(pPath);
+	fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+	if ((fd < 0) || (0 != bind(fd, (struct sockaddr *)&addr, sizeof(addr))))
+	{
+		printf("[EVENT] ERROR : control socket %s (%s)\n", pPath, strerror(errno));
+		if (fd >= 0)
+		{
+			close(fd);
+		}
+		return HAE_ERROR;
+	}
+
+	id = sAdd(pLoop, EVENT_KIND_CONTROL, pPath, fd, HAE_TRUE, EPOLLIN | EPOLLET);
+	if (id < 0)
+	{
+		unlink(pPath);
+		return HAE_ERROR;
+	}
+	pLoop->source[id].pfControl = pfControl;
+	pLoop->source[id].pArg = pArg;
+	strcpy(pLoop->source[id].path, pPath);
+	pLoop->source[id].ready = HAE_TRUE;
+	pLoop->readyCnt++;
+
+	return id;
+}
+
+/*************************************************************
+ *
+ * Function 		: EventLoop_AddFd
+ *
+ * Description	: Watch a socket of the caller, level-triggered. The
+ *				  loop does not read it and does not close it.
+ *
+ * Parameter	: fd - e.g. of rtxSocketCreate / rtxSocketAccept
+ *				  events - EPOLLIN, EPOLLOUT
+ *
+ * Returns		: source id, HAE_ERROR
+ *
+ *************************************************************/
+int EventLoop_AddFd(EVENT_LOOP *pLoop, const char *pName, OSRTSOCKET fd, unsigned int events, EVENT_FD_FUNC pfFd,
+	void *pArg)
+{
+	int id = sAdd(pLoop, EVENT_KIND_FD, pName, fd, HAE_FALSE, events);
+
+	if (id >= 0)
+	{
+		pLoop->source[id].pfFd = pfFd;
+		pLoop->source[id].pArg = pArg;
+	}
+	return id;
+}
+
+/* may be called from a callback, also for its own source */
+void EventLoop_Remove(EVENT_LOOP *pLoop, int id)
+{
+	EVENT_SOURCE *pSource;
+
+	if ((id < 0) || (id >= EVENT_SOURCE_MAX) || (EVENT_KIND_NONE == pLoop->source[id].kind))
+	{
+		return;
+	}
+	pSource = &pLoop->source[id];
+	epoll_ctl(pLoop->epollFd, EPOLL_CTL_DEL, pSource->fd, HAE_NULL);
+	if (HAE_TRUE == pSource->owned)
+	{
+		rtxSocketClose(pSource->fd);
+	}
+	if ('\0' != pSource->path[0])
+	{
+		unlink(pSource->path);
+	}
+	if (HAE_TRUE == pSource->ready)
+	{
+		pLoop->readyCnt--;
+	}
+	memset(pSource, 0x00, sizeof(EVENT_SOURCE));
+	pSource->fd = OSRTSOCKET_INVALID;
+}
+
+/*************************************************************
+ *
+ * Function 		: EventLoop_RunOnce
+ *
+ * Description	: Wait for events and call back for them; UDP and
+ *				  control sockets left ready are read without waiting.
+ *
+ * Parameter	: timeoutMs - longest wait, -1 no limit, 0 none
+ *
+ * Returns		: events, HAE_ERROR
+ *
+ *************************************************************/
+int EventLoop_RunOnce(EVENT_LOOP *pLoop, int timeoutMs)
+{
+	struct epoll_event ev[EVENT_WAIT_CNT];
+	EVENT_SOURCE *pSource;
+	int i, n, id;
+
+	n = epoll_wait(pLoop->epollFd, ev, EVENT_WAIT_CNT, (pLoop->readyCnt > 0) ? 0 : timeoutMs);
+	if (n < 0)
+	{
+		if (EINTR == errno)
+		{
+			return 0;
+		}
+		printf("[EVENT] ERROR : epoll_wait() (%s)\n", strerror(errno));
+		return HAE_ERROR;
+	}
+
+	/* sockets are read after the others have been seen, round by round */
+	for (i = 0; i < n; i++)
+	{
+		id = (int)ev[i].data.u32;
+		pSource = &pLoop->source[id];
+		switch (pSource->kind)
+		{
+			case EVENT_KIND_UDP:
+			case EVENT_KIND_CONTROL:
+				if (HAE_FALSE == pSource->ready)
+				{
+					pSource->ready = HAE_TRUE;
+					pLoop->readyCnt++;
+				}
+				break;
+			case EVENT_KIND_TIMER:
+				sReadTimer(pLoop, id);
+				break;
+			case EVENT_KIND_FD:
+				pSource->pfFd(pSource->pArg, pSource->fd, ev[i].events);
+				break;
+			default:
+				/* removed by a callback before */
+				break;
+		}
+	}
+	for (id = 0; (id < EVENT_SOURCE_MAX) && (pLoop->readyCnt > 0); id++)
+	{
+		if (HAE_TRUE != pLoop->source[id].ready)
+		{
+			continue;
+		}
+		if (EVENT_KIND_UDP == pLoop->source[id].kind)
+		{
+			sReadUdp(pLoop, id);
+		}
+		else
+		{
+			sReadControl(pLoop, id);
+		}
+	}
+	return n;
+}
+
+/* until EventLoop_Stop */
+int EventLoop_Run(EVENT_LOOP *pLoop)
+{
+	pLoop->running = HAE_TRUE;
+	while (HAE_TRUE == pLoop->running)
+	{
+		if (HAE_ERROR == EventLoop_RunOnce(pLoop, -1))
+		{
+			pLoop->running = HAE_FALSE;
+			return HAE_ERROR;
+		}
+	}
+	return HAE_OK;
+}
+
+/* from a callback or a signal handler */
+void EventLoop_Stop(EVENT_LOOP *pLoop)
+{
+	pLoop->running = HAE_FALSE;
+}
+
+/* readable when EventLoop_RunOnce has something to do, for a select set */
+OSRTSOCKET EventLoop_Fd(const EVENT_LOOP *pLoop)
+{
+	return pLoop->epollFd;
+}
+
+/* sources left ready, EventLoop_Fd does not show them: do not wait */
+int EventLoop_Pending(const EVENT_LOOP *pLoop)
+{
+	return (pLoop->readyCnt > 0) ? HAE_TRUE : HAE_FALSE;
+}
+
+/*************************************************************
+ *
+ * Function 		: EventLoop_Report
+ *
+ * Description	: One text line per source with its counters.
+ *
+ * Returns		: octets written, without the terminating 0
+ *
+ *************************************************************/
+size_t EventLoop_Report(const EVENT_LOOP *pLoop, char *pBuf, size_t bufSize)
+{
+	static const char *kind_name[] = { "-", "udp", "timer", "control", "fd" };
+	const EVENT_SOURCE *pSource;
+	size_t len = 0;
+	int i, n;
+
+	if (0 == bufSize)
+	{
+		return 0;
+	}
+	pBuf[0] = '\0';
+	for (i = 0; (i < EVENT_SOURCE_MAX) && (len < bufSize); i++)
+	{
+		pSource = &pLoop->source[i];
+		if (EVENT_KIND_NONE == pSource->kind)
+		{
+			continue;
+		}
+		if (EVENT_KIND_UDP == pSource->kind)
+		{
+			n = snprintf(&pBuf[len], bufSize - len, "%d %s %s dgrams %llu octets %llu truncated %llu batches %llu errors %llu\n",
+				i, kind_name[pSource->kind], pSource->name, pSource->dgramCnt, pSource->octetCnt, pSource->truncCnt,
+				pSource->batchCnt, pSource->errorCnt);
+		}
+		else
+		{
+			n = snprintf(&pBuf[len], bufSize - len, "%d %s %s events %llu errors %llu\n",
+				i, kind_name[pSource->kind], pSource->name, pSource->dgramCnt, pSource->errorCnt);
+		}
+		len += (n > 0) ? (size_t)n : 0;
+	}
+	return (len < bufSize) ? len : bufSize - 1;
+}
+
+static int sAdd(EVENT_LOOP *pLoop, int kind, const char *pName, OSRTSOCKET fd, int owned, unsigned int events)
+{
+	struct epoll_event ev;
+	EVENT_SOURCE *pSource;
+	int id;
+
+	for (id = 0; (id < EVENT_SOURCE_MAX) && (EVENT_KIND_NONE != pLoop->source[id].kind); id++)
+	{
+	}
+	if (id >= EVENT_SOURCE_MAX)
+	{
+		printf("[EVENT] ERROR : more than %d sources\n", EVENT_SOURCE_MAX);
+	}
+	else
+	{
+		memset(&ev, 0x00, sizeof(ev));
+		ev.events = events;
+		ev.data.u32 = (unsigned int)id;
+		if (0 == epoll_ctl(pLoop->epollFd, EPOLL_CTL_ADD, fd, &ev))
+		{
+			pSource = &pLoop->source[id];
+			memset(pSource, 0x00, sizeof(EVENT_SOURCE));
+			pSource->kind = kind;
+			pSource->fd = fd;
+			pSource->owned = owned;
+			snprintf(pSource->name, sizeof(pSource->name), "%s", pName);
+			return id;
+		}
+		printf("[EVENT] ERROR : epoll_ctl() of %s (%s)\n", pName, strerror(errno));
+	}
+
+	if (HAE_TRUE == owned)
+	{
+		rtxSocketClose(fd);
+	}
+	return HAE_ERROR;
+}
+
+/* EVENT_BATCH_MAX batches at most, the source stays ready if it is not empty */
+static void sReadUdp(EVENT_LOOP *pLoop, int id)
+{
+	EVENT_SOURCE *pSource = &pLoop->source[id];
+	struct EVENT_BATCH *pBatch = pLoop->pBatch;
+	struct msghdr *pHdr;
+	struct cmsghdr *pCmsg;
+	EVENT_DGRAM dgram;
+	int i, n, batch;
+
+	for (batch = 0; batch < EVENT_BATCH_MAX; batch++)
+	{
+		for (i = 0; i < EVENT_BATCH_CNT; i++)
+		{
+			pBatch->msg[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+			pBatch->msg[i].msg_hdr.msg_controllen = sizeof(pBatch->cmsg[i]);
+			pBatch->msg[i].msg_hdr.msg_flags = 0;
+		}
+		n = recvmmsg(pSource->fd, pBatch->msg, EVENT_BATCH_CNT, MSG_DONTWAIT, HAE_NULL);
+		if (n <= 0)
+		{
+			if ((n < 0) && (EINTR == errno))
+			{
+				continue;
+			}
+			if ((n < 0) && (EAGAIN != errno) && (EWOULDBLOCK != errno))
+			{
+				pSource->errorCnt++;
+			}
+			break;
+		}
+
+		pSource->batchCnt++;
+		for (i = 0; i < n; i++)
+		{
+			pHdr = &pBatch->msg[i].msg_hdr;
+			memset(&dgram, 0x00, sizeof(dgram));
+			dgram.pData = pBatch->buf[i];
+			dgram.len = (pBatch->msg[i].msg_len < EVENT_DGRAM_SIZE) ? pBatch->msg[i].msg_len : EVENT_DGRAM_SIZE;
+			dgram.truncated = (0 != (pHdr->msg_flags & MSG_TRUNC)) ? HAE_TRUE : HAE_FALSE;
+			dgram.source = id;
+			memcpy(&dgram.from, &pBatch->from[i], sizeof(dgram.from));
+			for (pCmsg = CMSG_FIRSTHDR(pHdr); HAE_NULL != pCmsg; pCmsg = CMSG_NXTHDR(pHdr, pCmsg))
+			{
+				if ((SOL_SOCKET == pCmsg->cmsg_level) && (SCM_TIMESTAMPNS == pCmsg->cmsg_type))
+				{
+					memcpy(&dgram.rxTime, CMSG_DATA(pCmsg), sizeof(dgram.rxTime));
+				}
+			}
+			if (0 == dgram.rxTime.tv_sec)
+			{
+				clock_gettime(CLOCK_REALTIME, &dgram.rxTime);
+			}
+
+			pSource->dgramCnt++;
+			pSource->octetCnt += dgram.len;
+			pSource->truncCnt += (HAE_TRUE == dgram.truncated) ? 1 : 0;
+			pSource->pfDgram(pSource->pArg, &dgram);
+			if (EVENT_KIND_UDP != pSource->kind)
+			{
+				/* removed by the callback */
+				return;
+			}
+		}
+		if (n < EVENT_BATCH_CNT)
+		{
+			break;
+		}
+	}
+
+	if (batch >= EVENT_BATCH_MAX)
+	{
+		return;
+	}
+	pSource->ready = HAE_FALSE;
+	pLoop->readyCnt--;
+}
+
+static void sReadTimer(EVENT_LOOP *pLoop, int id)
+{
+	EVENT_SOURCE *pSource = &pLoop->source[id];
+	unsigned long long expired;
+
+	if (sizeof(expired) != read(pSource->fd, &expired, sizeof(expired)))
+	{
+		return;
+	}
+	pSource->dgramCnt++;
+	pSource->pfTimer(pSource->pArg, expired);
+}
+
+/* every command waiting, the socket is empty afterwards */
+static void sReadControl(EVENT_LOOP *pLoop, int id)
+{
+	EVENT_SOURCE *pSource = &pLoop->source[id];
+	char cmd[EVENT_CONTROL_SIZE];
+	char reply[EVENT_CONTROL_SIZE * 16];
+	struct sockaddr_un from;
+	socklen_t fromLen;
+	ssize_t n;
+	size_t len;
+
+	for (;;)
+	{
+		fromLen = sizeof(from);
+		n = recvfrom(pSource->fd, cmd, sizeof(cmd) - 1, 0, (struct sockaddr *)&from, &fromLen);
+		if (n < 0)
+		{
+			if (EINTR == errno)
+			{
+				continue;
+			}
+			if ((EAGAIN != errno) && (EWOULDBLOCK != errno))
+			{
+				pSource->errorCnt++;
+			}
+			break;
+		}
+		while ((n > 0) && ((' ' == cmd[n - 1]) || ('\n' == cmd[n - 1]) || ('\r' == cmd[n - 1]) || ('\t' == cmd[n - 1])))
+		{
+			n--;
+		}
+		cmd[n] = '\0';
+
+		pSource->dgramCnt++;
+		len = pSource->pfControl(pSource->pArg, cmd, reply, sizeof(reply));
+		if (EVENT_KIND_CONTROL != pSource->kind)
+		{
+			/* removed by the callback */
+			return;
+		}
+		/* an unbound sender cannot be answered */
+		if ((len > 0) && (fromLen > sizeof(sa_family_t)))
+		{
+			sendto(pSource->fd, reply, (len < sizeof(reply)) ? len : sizeof(reply), MSG_DONTWAIT,
+				(struct sockaddr *)&from, fromLen);
+		}
+	}
+	pSource->ready = HAE_FALSE;
+	pLoop->readyCnt--;
+}
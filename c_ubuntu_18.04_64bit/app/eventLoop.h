@@ -0,0 +1,114 @@
+#ifndef EVENT_LOOP_H
+#define EVENT_LOOP_H
+
+#include <rtxsrc/rtxSocket.h>
+
+#include <stddef.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+/* One thread serving several UDP sources (a radio, a channel, an
+   interface each), periodic timers and local control sockets with epoll.
+
+   UDP sources are rtxSocket UDP sockets, non-blocking and edge-triggered:
+   a wakeup marks the source ready and the loop reads it with recvmmsg,
+   EVENT_BATCH_CNT datagrams per call, until the socket is empty. After
+   EVENT_BATCH_MAX calls a busy source waits for the next round so the
+   others get their turn; the loop does not sleep while a source is
+   left ready. Each datagram comes with the kernel receive time
+   (SO_TIMESTAMPNS), not the time the batch was read.
+
+   A timer is a timerfd on CLOCK_MONOTONIC, its callback gets the number
+   of periods since the last one (more than 1 when the loop was late).
+
+   A control socket is a UNIX datagram socket, one command per datagram;
+   the reply goes back to the sender if it has bound an address
+   (socat - UNIX-SENDTO:<path>,bind=<own path>).
+
+   Any other socket (rtxSocketAccept, a TCP client, the stats socket of
+   another module) is added with EventLoop_AddFd, level-triggered, the
+   callback reads it as it would after rtxSocketSelect. A loop that
+   already waits in rtxSocketSelect puts EventLoop_Fd into its read set
+   and calls EventLoop_RunOnce(pLoop, 0) when it is readable or while
+   EventLoop_Pending. */
+
+#define EVENT_SOURCE_MAX		32
+#define EVENT_BATCH_CNT			16			/* datagrams per recvmmsg */
+#define EVENT_BATCH_MAX			4			/* recvmmsg per source and round */
+#define EVENT_WAIT_CNT			EVENT_SOURCE_MAX
+#define EVENT_DGRAM_SIZE		2048		/* longer datagrams are cut, truncated set */
+#define EVENT_RCVBUF_SIZE		(4 * 1024 * 1024)	/* SO_RCVBUF asked for, net.core.rmem_max caps it */
+#define EVENT_CONTROL_SIZE		256
+#define EVENT_NAME_MAX			48
+
+#define EVENT_KIND_NONE			0
+#define EVENT_KIND_UDP			1
+#define EVENT_KIND_TIMER		2
+#define EVENT_KIND_CONTROL		3
+#define EVENT_KIND_FD			4
+
+typedef struct{
+	const unsigned char *pData;			/* valid during the callback */
+	size_t len;
+	int truncated;						/* longer than EVENT_DGRAM_SIZE */
+	int source;							/* EventLoop_AddUdp id */
+	struct sockaddr_in from;
+	struct timespec rxTime;				/* CLOCK_REALTIME of the kernel */
+} EVENT_DGRAM;
+
+typedef void (*EVENT_DGRAM_FUNC)(void *pArg, const EVENT_DGRAM *pDgram);
+/* expired: periods since the last call */
+typedef void (*EVENT_TIMER_FUNC)(void *pArg, unsigned long long expired);
+/* pCmd 0 terminated, trailing white space removed; returns reply octets */
+typedef size_t (*EVENT_CONTROL_FUNC)(void *pArg, const char *pCmd, char *pReply, size_t replySize);
+/* events: EPOLLIN, EPOLLOUT, EPOLLERR, EPOLLHUP ... */
+typedef void (*EVENT_FD_FUNC)(void *pArg, OSRTSOCKET fd, unsigned int events);
+
+typedef struct{
+	int kind;							/* EVENT_KIND_* */
+	OSRTSOCKET fd;
+	int owned;							/* closed by EventLoop_Remove */
+	int ready;							/* UDP: not read empty yet */
+	char name[EVENT_NAME_MAX];
+	char path[108];						/* control: unlinked at the end */
+	void *pArg;
+	EVENT_DGRAM_FUNC pfDgram;
+	EVENT_TIMER_FUNC pfTimer;
+	EVENT_CONTROL_FUNC pfControl;
+	EVENT_FD_FUNC pfFd;
+
+	unsigned long long dgramCnt;		/* datagrams, timer wakeups, commands */
+	unsigned long long octetCnt;
+	unsigned long long truncCnt;
+	unsigned long long batchCnt;		/* recvmmsg that gave datagrams */
+	unsigned long long errorCnt;
+} EVENT_SOURCE;
+
+typedef struct{
+	int epollFd;
+	volatile int running;
+	int readyCnt;						/* UDP and control sources ready */
+	EVENT_SOURCE source[EVENT_SOURCE_MAX];
+	struct EVENT_BATCH *pBatch;			/* buffers of recvmmsg, eventLoop.c */
+} EVENT_LOOP;
+
+int EventLoop_Init(EVENT_LOOP *pLoop);
+void EventLoop_Free(EVENT_LOOP *pLoop);
+
+int EventLoop_AddUdp(EVENT_LOOP *pLoop, const char *pSpec, EVENT_DGRAM_FUNC pfDgram, void *pArg);
+int EventLoop_AddTimer(EVENT_LOOP *pLoop, const char *pName, unsigned int periodMs, EVENT_TIMER_FUNC pfTimer,
+	void *pArg);
+int EventLoop_AddControl(EVENT_LOOP *pLoop, const char *pPath, EVENT_CONTROL_FUNC pfControl, void *pArg);
+int EventLoop_AddFd(EVENT_LOOP *pLoop, const char *pName, OSRTSOCKET fd, unsigned int events, EVENT_FD_FUNC pfFd,
+	void *pArg);
+void EventLoop_Remove(EVENT_LOOP *pLoop, int id);
+
+int EventLoop_RunOnce(EVENT_LOOP *pLoop, int timeoutMs);
+int EventLoop_Run(EVENT_LOOP *pLoop);
+void EventLoop_Stop(EVENT_LOOP *pLoop);
+OSRTSOCKET EventLoop_Fd(const EVENT_LOOP *pLoop);
+int EventLoop_Pending(const EVENT_LOOP *pLoop);
+size_t EventLoop_Report(const EVENT_LOOP *pLoop, char *pBuf, size_t bufSize);
+
+#endif
@@ -0,0 +1,61 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "haeCommon.h"
+#include "flightRecorder.h"
+
+static FLIGHT_RECORDER flight_rec;
+static FLIGHT_SLOT flight_slot;
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: Post-mortem of a flight-crash.bin: lists the ring
+ *				  and writes the bit trace (HTML) of the newest
+ *				  datagram, the one being decoded at the crash, and
+ *				  of every datagram whose decode failed.
+ *
+ * Parameter	: argv[1] - flight-crash.bin
+ *				  argv[2] - directory of the HTML files (default .)
+ *
+ * Returns		: 0, 1 on error
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	const char *pDir = ".";
+	unsigned long ticket, newest;
+
+	if (argc < 2)
+	{
+		printf("usage: %s flight-crash.bin [dir]\n", argv[0]);
+		return 1;
+	}
+	if (argc > 2)
+	{
+		pDir = argv[2];
+	}
+	if ((HAE_OK != FlightRec_Load(&flight_rec, argv[1])) || (0 == flight_rec.head))
+	{
+		return 1;
+	}
+
+	newest = flight_rec.head - 1;
+	FlightRec_List(&flight_rec, newest, HAE_NULL);
+
+	for (ticket = (flight_rec.head > FLIGHT_RING_CNT) ? flight_rec.head - FLIGHT_RING_CNT : 0; ticket < flight_rec.head; ticket++)
+	{
+		if (HAE_OK != FlightRec_Copy(&flight_rec, ticket, &flight_slot))
+		{
+			continue;
+		}
+		if ((ticket == newest) || (FLIGHT_STATUS_ERROR == flight_slot.status))
+		{
+			FlightRec_Trace(&flight_slot, ticket, pDir);
+			printf("datagram %lu traced to %s/flight-%lu-*.html\n", ticket, pDir, ticket);
+		}
+	}
+
+	return 0;
+}
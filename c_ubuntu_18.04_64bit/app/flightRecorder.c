@@ -0,0 +1,481 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxDiag.h>
+#include <rtxsrc/rtxDiagBitTrace.h>
+#include <rtxsrc/rtxMemory.h>
+#include <rtxsrc/rtxError.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <arpa/inet.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "flightRecorder.h"
+
+#define FLIGHT_RING_MASK		(FLIGHT_RING_CNT - 1)
+
+static FLIGHT_RECORDER *flight_crash_rec = HAE_NULL;
+
+static void *sDumpThread(void *pArg);
+static void sCrashHandler(int sig);
+static const char *sStatusName(int status);
+
+/*************************************************************
+ *
+ * Function 		: FlightRec_Init
+ *
+ * Description	: Empty ring and the dump thread.
+ *
+ * Parameter	: pDir - directory of the dumps
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int FlightRec_Init(FLIGHT_RECORDER *pRec, const char *pDir)
+{
+	memset(pRec, 0x00, sizeof(FLIGHT_RECORDER));
+
+	snprintf(pRec->dir, sizeof(pRec->dir), "%s", pDir);
+	snprintf(pRec->crashPath, sizeof(pRec->crashPath), "%s/flight-crash.bin", pDir);
+
+	pthread_mutex_init(&pRec->lock, HAE_NULL);
+	pthread_cond_init(&pRec->wake, HAE_NULL);
+
+	pRec->running = HAE_TRUE;
+	if (0 != pthread_create(&pRec->thread, HAE_NULL, sDumpThread, pRec))
+	{
+		printf("[FLIGHT] ERROR : pthread_create() for dump\n");
+		pRec->running = HAE_FALSE;
+		pthread_mutex_destroy(&pRec->lock);
+		pthread_cond_destroy(&pRec->wake);
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+void FlightRec_Free(FLIGHT_RECORDER *pRec)
+{
+	if (flight_crash_rec == pRec)
+	{
+		flight_crash_rec = HAE_NULL;
+	}
+	if (HAE_TRUE == pRec->running)
+	{
+		pthread_mutex_lock(&pRec->lock);
+		pRec->running = HAE_FALSE;
+		pthread_cond_signal(&pRec->wake);
+		pthread_mutex_unlock(&pRec->lock);
+		pthread_join(pRec->thread, HAE_NULL);
+
+		pthread_mutex_destroy(&pRec->lock);
+		pthread_cond_destroy(&pRec->wake);
+	}
+}
+
+/*************************************************************
+ *
+ * Function 		: FlightRec_InstallCrashHandler
+ *
+ * Description	: SIGSEGV, SIGBUS, SIGFPE, SIGILL and SIGABRT write
+ *				  the ring to <dir>/flight-crash.bin, then the
+ *				  signal takes its default action.
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int FlightRec_InstallCrashHandler(FLIGHT_RECORDER *pRec)
+{
+	static const int sigs[] = { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT };
+	struct sigaction sa;
+	unsigned int i;
+
+	flight_crash_rec = pRec;
+
+	memset(&sa, 0x00, sizeof(sa));
+	sa.sa_handler = sCrashHandler;
+	sa.sa_flags = SA_RESETHAND;
+	sigemptyset(&sa.sa_mask);
+	for (i = 0; i < sizeof(sigs) / sizeof(sigs[0]); i++)
+	{
+		if (0 != sigaction(sigs[i], &sa, HAE_NULL))
+		{
+			printf("[FLIGHT] ERROR : sigaction(%d)\n", sigs[i]);
+			return HAE_ERROR;
+		}
+	}
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: FlightRec_Record
+ *
+ * Description	: Copy a received datagram into the ring.
+ *
+ * Parameter	: pData, len - datagram
+ *				  offset - UPER MessageFrame in the datagram
+ *				  pRxTime - receive time, CLOCK_REALTIME
+ *				  pSource - sender, may be NULL
+ *
+ * Returns		: ticket of the datagram
+ *
+ *************************************************************/
+unsigned long FlightRec_Record(FLIGHT_RECORDER *pRec, const unsigned char *pData, unsigned int len, unsigned int offset,
+	const struct timespec *pRxTime, const struct sockaddr_in *pSource)
+{
+	unsigned long ticket = pRec->head;
+	FLIGHT_SLOT *pSlot = &pRec->ring[ticket & FLIGHT_RING_MASK];
+
+	pSlot->seq = 0;
+	__sync_synchronize();
+
+	pSlot->rxTime = *pRxTime;
+	if (HAE_NULL != pSource)
+	{
+		pSlot->source = *pSource;
+	}
+	else
+	{
+		memset(&pSlot->source, 0x00, sizeof(pSlot->source));
+	}
+	pSlot->len = len;
+	pSlot->capLen = (len < FLIGHT_DATA_MAX) ? len : FLIGHT_DATA_MAX;
+	pSlot->offset = offset;
+	pSlot->status = FLIGHT_STATUS_RECEIVED;
+	pSlot->messageId = 0;
+	memcpy(pSlot->data, pData, pSlot->capLen);
+
+	__sync_synchronize();
+	pSlot->seq = ticket + 1;
+	pRec->head = ticket + 1;
+
+	return ticket;
+}
+
+void FlightRec_SetStatus(FLIGHT_RECORDER *pRec, unsigned long ticket, int status, unsigned int messageId)
+{
+	FLIGHT_SLOT *pSlot = &pRec->ring[ticket & FLIGHT_RING_MASK];
+
+	if (pSlot->seq != ticket + 1)
+	{
+		/* overwritten meanwhile */
+		return;
+	}
+
+	pSlot->seq = 0;
+	__sync_synchronize();
+	pSlot->status = status;
+	pSlot->messageId = messageId;
+	__sync_synchronize();
+	pSlot->seq = ticket + 1;
+}
+
+/*************************************************************
+ *
+ * Function 		: FlightRec_Dump
+ *
+ * Description	: Queue the bit trace of a datagram whose decode
+ *				  failed for the dump thread.
+ *
+ * Returns		: HAE_OK, HAE_ERROR if it is not dumped
+ *
+ *************************************************************/
+int FlightRec_Dump(FLIGHT_RECORDER *pRec, unsigned long ticket)
+{
+	int ret = HAE_ERROR;
+
+	pthread_mutex_lock(&pRec->lock);
+
+	pRec->errorCnt++;
+	if ((pRec->dumpTail - pRec->dumpHead < FLIGHT_DUMP_QUEUE) &&
+		(pRec->dumpCnt + (pRec->dumpTail - pRec->dumpHead) < FLIGHT_DUMP_MAX))
+	{
+		pRec->dumpQueue[pRec->dumpTail % FLIGHT_DUMP_QUEUE] = ticket;
+		pRec->dumpTail++;
+		pthread_cond_signal(&pRec->wake);
+		ret = HAE_OK;
+	}
+	else
+	{
+		pRec->dumpDropCnt++;
+	}
+
+	pthread_mutex_unlock(&pRec->lock);
+
+	return ret;
+}
+
+/*************************************************************
+ *
+ * Function 		: FlightRec_Load
+ *
+ * Description	: Ring of a flight-crash.bin, without dump thread.
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int FlightRec_Load(FLIGHT_RECORDER *pRec, const char *pPath)
+{
+	FLIGHT_FILE_HDR hdr;
+	FILE *pFile;
+	int ret = HAE_ERROR;
+
+	memset(pRec, 0x00, sizeof(FLIGHT_RECORDER));
+
+	if (HAE_NULL == (pFile = fopen(pPath, "rb")))
+	{
+		printf("[FLIGHT] ERROR : cannot open %s\n", pPath);
+		return HAE_ERROR;
+	}
+	if ((1 != fread(&hdr, sizeof(hdr), 1, pFile)) || (FLIGHT_FILE_MAGIC != hdr.magic) ||
+		(FLIGHT_FILE_VERSION != hdr.version) || (FLIGHT_RING_CNT != hdr.slotCnt) || (sizeof(FLIGHT_SLOT) != hdr.slotSize))
+	{
+		printf("[FLIGHT] ERROR : %s is not a flight recorder file of this build\n", pPath);
+	}
+	else if (FLIGHT_RING_CNT != fread(pRec->ring, sizeof(FLIGHT_SLOT), FLIGHT_RING_CNT, pFile))
+	{
+		printf("[FLIGHT] ERROR : %s is truncated\n", pPath);
+	}
+	else
+	{
+		pRec->head = hdr.head;
+		ret = HAE_OK;
+	}
+	fclose(pFile);
+
+	return ret;
+}
+
+/*************************************************************
+ *
+ * Function 		: FlightRec_Copy
+ *
+ * Description	: Consistent copy of the slot of a ticket.
+ *
+ * Returns		: HAE_OK, HAE_ERROR if the slot holds another
+ *				  datagram or is being written
+ *
+ *************************************************************/
+int FlightRec_Copy(const FLIGHT_RECORDER *pRec, unsigned long ticket, FLIGHT_SLOT *pCopy)
+{
+	const FLIGHT_SLOT *pSlot = &pRec->ring[ticket & FLIGHT_RING_MASK];
+	unsigned long seq = pSlot->seq;
+
+	if (seq != ticket + 1)
+	{
+		return HAE_ERROR;
+	}
+	__sync_synchronize();
+	memcpy(pCopy, (const void *)pSlot, sizeof(FLIGHT_SLOT));
+	__sync_synchronize();
+
+	return ((pSlot->seq == seq) && (pCopy->capLen <= FLIGHT_DATA_MAX)) ? HAE_OK : HAE_ERROR;
+}
+
+/*************************************************************
+ *
+ * Function 		: FlightRec_Trace
+ *
+ * Description	: Decode a datagram with the bit trace on and write
+ *				  it as HTML: flight-<ticket>-MessageFrame.html and,
+ *				  if the frame decodes, flight-<ticket>-<Type>.html.
+ *
+ * Returns		: HAE_OK if the datagram decodes, HAE_ERROR
+ *
+ *************************************************************/
+int FlightRec_Trace(const FLIGHT_SLOT *pSlot, unsigned long ticket, const char *pDir)
+{
+	char path[FLIGHT_PATH_MAX + 64];
+	char text[256];
+	const ASN_TYPE *pType;
+	MessageFrame frame;
+	void *pValue;
+	OSCTXT ctxt;
+	int ret;
+
+	if (pSlot->offset >= pSlot->capLen)
+	{
+		printf("[FLIGHT] ERROR : datagram %lu has no MessageFrame\n", ticket);
+		return HAE_ERROR;
+	}
+	if (0 != rtInitContext(&ctxt))
+	{
+		printf("[FLIGHT] ERROR : rtInitContext() for trace\n");
+		return HAE_ERROR;
+	}
+
+	rtxSetDiag(&ctxt, TRUE);
+	pu_setTrace(&ctxt, TRUE);
+	rtxDiagCtxtBitFieldListInit(&ctxt);
+	pu_setBuffer(&ctxt, (OSOCTET *)pSlot->data + pSlot->offset, pSlot->capLen - pSlot->offset, FALSE);
+
+	memset(&frame, 0x00, sizeof(frame));
+	ret = asn1PD_MessageFrame(&ctxt, &frame);
+	snprintf(path, sizeof(path), "%s/flight-%lu-MessageFrame.html", pDir, ticket);
+	rtxDiagBitTracePrintHTML(path, ctxt.pBitFldList, "MessageFrame");
+
+	if ((0 == ret) && (HAE_NULL != (pType = AsnType_FindMessage(frame.messageId))))
+	{
+		pValue = rtxMemAllocZ(&ctxt, pType->size);
+		rtxDiagCtxtBitFieldListInit(&ctxt);
+		pu_setBuffer(&ctxt, (OSOCTET *)frame.value.data, frame.value.numocts, FALSE);
+		ret = (HAE_NULL != pValue) ? pType->pfPerDec(&ctxt, pValue) : RTERR_NOMEM;
+		snprintf(path, sizeof(path), "%s/flight-%lu-%s.html", pDir, ticket, pType->pName);
+		rtxDiagBitTracePrintHTML(path, ctxt.pBitFldList, pType->pName);
+	}
+
+	if (0 != ret)
+	{
+		rtxErrGetTextBuf(&ctxt, text, sizeof(text));
+		printf("[FLIGHT] datagram %lu : %s\n", ticket, text);
+	}
+	rtFreeContext(&ctxt);
+
+	return (0 == ret) ? HAE_OK : HAE_ERROR;
+}
+
+/*************************************************************
+ *
+ * Function 		: FlightRec_List
+ *
+ * Description	: The ring oldest first, one datagram per line with
+ *				  its octets in hex; mark is flagged with '>'.
+ *
+ * Parameter	: pPath - file, NULL for stdout
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int FlightRec_List(const FLIGHT_RECORDER *pRec, unsigned long mark, const char *pPath)
+{
+	static FLIGHT_SLOT copy;		/* dump thread or flightDump only */
+	char addr[INET_ADDRSTRLEN];
+	unsigned long ticket, head = pRec->head;
+	unsigned int i;
+	FILE *pFile = stdout;
+
+	if ((HAE_NULL != pPath) && (HAE_NULL == (pFile = fopen(pPath, "w"))))
+	{
+		printf("[FLIGHT] ERROR : cannot create %s\n", pPath);
+		return HAE_ERROR;
+	}
+
+	fprintf(pFile, "# ticket rxTime source len messageId status octets\n");
+	for (ticket = (head > FLIGHT_RING_CNT) ? head - FLIGHT_RING_CNT : 0; ticket < head; ticket++)
+	{
+		if (HAE_OK != FlightRec_Copy(pRec, ticket, &copy))
+		{
+			continue;
+		}
+		inet_ntop(AF_INET, &copy.source.sin_addr, addr, sizeof(addr));
+		fprintf(pFile, "%c %lu %ld.%09ld %s:%u %u %u %s ", (ticket == mark) ? '>' : ' ', ticket,
+			(long)copy.rxTime.tv_sec, copy.rxTime.tv_nsec, addr, ntohs(copy.source.sin_port),
+			copy.len, copy.messageId, sStatusName(copy.status));
+		for (i = 0; i < copy.capLen; i++)
+		{
+			fprintf(pFile, "%02x", copy.data[i]);
+		}
+		fprintf(pFile, "\n");
+	}
+
+	if (stdout != pFile)
+	{
+		fclose(pFile);
+	}
+
+	return HAE_OK;
+}
+
+/* re-decodes the datagrams of FlightRec_Dump outside the receive loop */
+static void *sDumpThread(void *pArg)
+{
+	static FLIGHT_SLOT copy;
+	FLIGHT_RECORDER *pRec = (FLIGHT_RECORDER *)pArg;
+	char path[FLIGHT_PATH_MAX + 64];
+	unsigned long ticket;
+
+	pthread_mutex_lock(&pRec->lock);
+	for (;;)
+	{
+		while (pRec->running && (pRec->dumpHead == pRec->dumpTail))
+		{
+			pthread_cond_wait(&pRec->wake, &pRec->lock);
+		}
+		if (pRec->dumpHead == pRec->dumpTail)
+		{
+			break;
+		}
+		ticket = pRec->dumpQueue[pRec->dumpHead % FLIGHT_DUMP_QUEUE];
+		pthread_mutex_unlock(&pRec->lock);
+
+		if (HAE_OK != FlightRec_Copy(pRec, ticket, &copy))
+		{
+			printf("[FLIGHT] ERROR : datagram %lu overwritten before its dump\n", ticket);
+		}
+		else
+		{
+			FlightRec_Trace(&copy, ticket, pRec->dir);
+			snprintf(path, sizeof(path), "%s/flight-%lu.txt", pRec->dir, ticket);
+			FlightRec_List(pRec, ticket, path);
+			printf("[FLIGHT] decode error of datagram %lu dumped to %s/flight-%lu-*\n", ticket, pRec->dir, ticket);
+		}
+
+		pthread_mutex_lock(&pRec->lock);
+		pRec->dumpHead++;
+		pRec->dumpCnt++;
+	}
+	pthread_mutex_unlock(&pRec->lock);
+
+	return HAE_NULL;
+}
+
+/* async signal safe: open / write / close of the ring as it is */
+static void sCrashHandler(int sig)
+{
+	FLIGHT_RECORDER *pRec = flight_crash_rec;
+	FLIGHT_FILE_HDR hdr;
+	int fd;
+
+	if (HAE_NULL != pRec)
+	{
+		fd = open(pRec->crashPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (fd >= 0)
+		{
+			hdr.magic = FLIGHT_FILE_MAGIC;
+			hdr.version = FLIGHT_FILE_VERSION;
+			hdr.slotCnt = FLIGHT_RING_CNT;
+			hdr.slotSize = sizeof(FLIGHT_SLOT);
+			hdr.head = pRec->head;
+			if (sizeof(hdr) == write(fd, &hdr, sizeof(hdr)))
+			{
+				if (sizeof(pRec->ring) != write(fd, pRec->ring, sizeof(pRec->ring)))
+				{
+					/* a short file is refused by FlightRec_Load */
+				}
+			}
+			close(fd);
+		}
+	}
+
+	/* SA_RESETHAND: default action now */
+	raise(sig);
+}
+
+static const char *sStatusName(int status)
+{
+	switch (status)
+	{
+		case FLIGHT_STATUS_OK:
+			return "ok";
+		case FLIGHT_STATUS_ERROR:
+			return "error";
+		default:
+			return "received";
+	}
+}
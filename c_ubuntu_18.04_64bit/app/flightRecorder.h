@@ -0,0 +1,98 @@
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+
+#include <pthread.h>
+#include <time.h>
+#include <netinet/in.h>
+
+/* Flight recorder of the receive loop: the last FLIGHT_RING_CNT datagrams
+   and their decode status, always on.
+
+   FlightRec_Record copies a datagram into the next slot of the ring,
+   FlightRec_SetStatus stores how its decode ended. Both are called from
+   the receive loop only and take no lock: a slot carries a sequence
+   number that is 0 while the slot is written and ticket + 1 once it is
+   complete, a reader copies the slot and keeps the copy if the number
+   did not change meanwhile.
+
+   On a decode error FlightRec_Dump hands the ticket to the dump thread,
+   which re-decodes the copy with rtxSetDiag / pu_setTrace and a bit field
+   list (OSRTDiagBitFieldList) and writes
+
+     <dir>/flight-<ticket>-MessageFrame.html   bit trace of the frame
+     <dir>/flight-<ticket>-<Type>.html         bit trace of the value
+     <dir>/flight-<ticket>.txt                 the ring, oldest first
+
+   If a decode crashes the process, the crash handler writes the ring as
+   it is to <dir>/flight-crash.bin; flightDump re-decodes it offline. */
+
+#define FLIGHT_RING_CNT			256			/* power of 2 */
+#define FLIGHT_DATA_MAX			2048		/* longer datagrams are cut */
+#define FLIGHT_DUMP_QUEUE		16
+#define FLIGHT_DUMP_MAX			100			/* dumps per run, more are only counted */
+#define FLIGHT_PATH_MAX			256
+
+#define FLIGHT_STATUS_RECEIVED	0			/* not decoded (yet) */
+#define FLIGHT_STATUS_OK		1
+#define FLIGHT_STATUS_ERROR		2
+
+#define FLIGHT_FILE_MAGIC		0x46524543	/* "FREC" */
+#define FLIGHT_FILE_VERSION		1
+
+typedef struct{
+	volatile unsigned long seq;			/* 0 while written, ticket + 1 */
+	struct timespec rxTime;				/* CLOCK_REALTIME */
+	struct sockaddr_in source;
+	unsigned int len;					/* datagram */
+	unsigned int capLen;				/* octets in data */
+	unsigned int offset;				/* UPER MessageFrame in data */
+	volatile int status;				/* FLIGHT_STATUS_* */
+	volatile unsigned int messageId;
+	unsigned char data[FLIGHT_DATA_MAX];
+} FLIGHT_SLOT;
+
+/* flight-crash.bin: header, then slotCnt slots */
+typedef struct{
+	unsigned int magic;
+	unsigned int version;
+	unsigned int slotCnt;
+	unsigned int slotSize;
+	unsigned long head;
+} FLIGHT_FILE_HDR;
+
+typedef struct{
+	FLIGHT_SLOT ring[FLIGHT_RING_CNT];
+	volatile unsigned long head;		/* next ticket */
+	char dir[FLIGHT_PATH_MAX];
+	char crashPath[FLIGHT_PATH_MAX];
+
+	/* dump thread */
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	volatile int running;
+	unsigned long dumpQueue[FLIGHT_DUMP_QUEUE];
+	unsigned int dumpHead;
+	unsigned int dumpTail;
+
+	unsigned long errorCnt;
+	unsigned long dumpCnt;
+	unsigned long dumpDropCnt;			/* queue full or FLIGHT_DUMP_MAX reached */
+} FLIGHT_RECORDER;
+
+int FlightRec_Init(FLIGHT_RECORDER *pRec, const char *pDir);
+void FlightRec_Free(FLIGHT_RECORDER *pRec);
+int FlightRec_InstallCrashHandler(FLIGHT_RECORDER *pRec);
+
+unsigned long FlightRec_Record(FLIGHT_RECORDER *pRec, const unsigned char *pData, unsigned int len, unsigned int offset,
+	const struct timespec *pRxTime, const struct sockaddr_in *pSource);
+void FlightRec_SetStatus(FLIGHT_RECORDER *pRec, unsigned long ticket, int status, unsigned int messageId);
+int FlightRec_Dump(FLIGHT_RECORDER *pRec, unsigned long ticket);
+
+/* offline: flight-crash.bin back into a recorder, trace of one slot */
+int FlightRec_Load(FLIGHT_RECORDER *pRec, const char *pPath);
+int FlightRec_Copy(const FLIGHT_RECORDER *pRec, unsigned long ticket, FLIGHT_SLOT *pCopy);
+int FlightRec_Trace(const FLIGHT_SLOT *pSlot, unsigned long ticket, const char *pDir);
+int FlightRec_List(const FLIGHT_RECORDER *pRec, unsigned long mark, const char *pPath);
+
+#endif
@@ -0,0 +1,589 @@
+#!/bin/sh
+#
+# Generates asnDeepTable.c (deep copy and field-wise compare of every
+# SEQUENCE / CHOICE / BIT STRING / OCTET STRING structure) from the C
+# structures of the generated header. Per structure T:
+#
+#   sSize_T  octets of the memory T points to (strings, open types,
+#            list nodes and elements, CHOICE alternatives by pointer)
+#   sCopy_T  *pDst holds a shallow copy of *pSrc, moves what it points
+#            to into the arena
+#   sCmp_T   field by field, absent OPTIONAL fields are not looked at
+#   sReloc_T every pointer of T and of what it points to, in the order
+#            sCopy_T allocates (pointers to offsets of a flat block and
+#            back, asnFlat.c), and the lengths the encoders trust
+#
+# Size and copy are only generated for structures holding pointers, the
+# shallow copy is the whole copy of the others; reloc also for those
+# with a length (numbits, numocts, n) somewhere.
+#
+# usage: ./genAsnDeepTable.sh header.h... > asnDeepTable.c
+#
+
+LC_ALL=C
+export LC_ALL
+
+cat "$@" | tr -d '\r' | awk -v headers="$*" '
+	BEGIN { listElem["OSRTDList"] = "ASN1OpenType" }		# extElem1: unknown extensions
+	function resolve(t) {
+		while (t in alias) t = alias[t]
+		return t
+	}
+	# what a field of type t is: S struct, L list, Z string, O open type, V scalar
+	function kind(t) {
+		t = resolve(t)
+		if (t in isStruct) return "S"
+		if (t in listElem) return "L"
+		if ("ASN1OpenType" == t) return "O"
+		if ("STRING" == t) return "Z"
+		return "V"
+	}
+	function fnName(p, t) {
+		t = resolve(t)
+		if ("ASN1OpenType" == t) return "AsnDeep_" p "Open"
+		return "s" p "_" t
+	}
+	function elemPtr(t) {
+		t = resolve(t)
+		return (("S" == kind(t) && hasPtr[t]) || ("O" == kind(t))) ? 1 : 0
+	}
+	function elemReloc(t) {
+		t = resolve(t)
+		return (("S" == kind(t) && hasReloc[t]) || ("O" == kind(t))) ? fnName("Reloc", t) : "HAE_NULL"
+	}
+	function elemCmp(t) {
+		return ("S" == kind(t) || "O" == kind(t)) ? fnName("Cmp", t) : "HAE_NULL"
+	}
+	function elemFn(p, t) {
+		return elemPtr(t) ? fnName(p, t) : "HAE_NULL"
+	}
+
+	/^\/\* List of [A-Za-z0-9_]* \*\/$/ { listOf = $4; next }
+	/^typedef OSRTDList [A-Za-z0-9_]*;$/ {
+		name = substr($3, 1, length($3) - 1)
+		listElem[name] = ("" != listOf) ? listOf : "ASN1OpenType"
+		listOf = ""
+		next
+	}
+	/^typedef const char\* [A-Za-z0-9_]*;$/ {
+		alias[substr($4, 1, length($4) - 1)] = "STRING"
+		next
+	}
+	/^typedef [A-Za-z0-9_]* [A-Za-z0-9_]*;$/ {
+		alias[substr($3, 1, length($3) - 1)] = $2
+		next
+	}
+	/^typedef struct (EXTERN )?[A-Za-z0-9_]* \{$/ {
+		inStruct = ("EXTERN" == $3) ? $4 : $3
+		order[++typeCnt] = inStruct
+		isStruct[inStruct] = 1
+		fieldCnt[inStruct] = 0
+		inM = inU = 0
+		next
+	}
+	"" == inStruct { if ($0 ~ /[^ \t]/) listOf = ""; next }
+	/^\} [A-Za-z0-9_]*;$/ { inStruct = ""; next }
+	/^ *struct \{$/ { inM = 1; next }
+	/^ *\} m;$/ { inM = 0; next }
+	inM {
+		bit = $2
+		sub(/Present$/, "", bit)
+		present[inStruct, bit] = 1
+		next
+	}
+	/^ *union \{$/ { inU = 1; next }
+	/^ *\} u;$/ { inU = 0; next }
+	inU && /^ *\/\* t = [0-9]* \*\/$/ { tag = $4; next }
+	{
+		line = $0
+		sub(/^ */, "", line)
+		sub(/;$/, "", line)
+		ptr = 0
+		if (line ~ /^const char\* /) {
+			type = "STRING"
+			fname = substr(line, 13)
+		} else {
+			n = split(line, w, " ")
+			type = w[1]
+			fname = w[n]
+			if (type ~ /\*$/) { ptr = 1; sub(/\*$/, "", type) }
+			if (fname ~ /^\*/) { ptr = 1; sub(/^\*/, "", fname) }
+		}
+		alen = ""
+		if (fname ~ /\[[0-9]*\]$/) {
+			alen = fname
+			sub(/^[^[]*\[/, "", alen)
+			sub(/\]$/, "", alen)
+			sub(/\[.*/, "", fname)
+		}
+		i = ++fieldCnt[inStruct]
+		fType[inStruct, i] = type
+		fName[inStruct, i] = fname
+		fPtr[inStruct, i] = ptr
+		fLen[inStruct, i] = alen
+		fTag[inStruct, i] = inU ? tag : ""
+	}
+
+	END {
+		# BIT STRING / OCTET STRING / SEQUENCE OF in a fixed array
+		for (k = 1; k <= typeCnt; k++) {
+			t = order[k]
+			form[t] = "SEQ"
+			if (("numbits" == fName[t, 1]) && ("data" == fName[t, 2])) form[t] = "BITS"
+			else if (("numocts" == fName[t, 1]) && ("data" == fName[t, 2])) form[t] = "OCTETS"
+			else if (("n" == fName[t, 1]) && ("elem" == fName[t, 2]) && (2 == fieldCnt[t])) form[t] = "ARRAY"
+		}
+
+		# structures holding pointers, to a fixed point
+		do {
+			changed = 0
+			for (k = 1; k <= typeCnt; k++) {
+				t = order[k]
+				if (hasPtr[t]) continue
+				p = 0
+				for (i = 1; i <= fieldCnt[t]; i++) {
+					ft = resolve(fType[t, i])
+					fk = kind(ft)
+					if (fPtr[t, i] || ("L" == fk) || ("Z" == fk) || ("O" == fk) || (("S" == fk) && hasPtr[ft])) p = 1
+				}
+				if (p) { hasPtr[t] = 1; changed = 1 }
+			}
+		} while (changed)
+		# structures with something to relocate or check: pointers, or a
+		# length the encoders trust (numbits, numocts, n of a fixed array)
+		do {
+			changed = 0
+			for (k = 1; k <= typeCnt; k++) {
+				t = order[k]
+				if (hasReloc[t]) continue
+				p = hasPtr[t] || ("SEQ" != form[t])
+				for (i = 1; i <= fieldCnt[t]; i++) {
+					ft = resolve(fType[t, i])
+					if (("S" == kind(ft)) && hasReloc[ft]) p = 1
+				}
+				if (p) { hasReloc[t] = 1; changed = 1 }
+			}
+		} while (changed)
+		for (k = 1; k <= typeCnt; k++) {
+			t = order[k]
+			choice[t] = (fieldCnt[t] > 1) && ("t" == fName[t, 1]) && ("" != fTag[t, 2])
+			# CHOICE alternatives that are lists by pointer get functions of their own
+			for (i = 1; i <= fieldCnt[t]; i++) {
+				ft = resolve(fType[t, i])
+				if (fPtr[t, i] && ("L" == kind(ft)) && !(ft in ptrList)) { ptrList[ft] = 1; ptrListOrder[++ptrListCnt] = ft }
+			}
+		}
+
+		print "/* Generated by genAsnDeepTable.sh, do not edit */"
+		print ""
+		n = split(headers, h, " ")
+		for (i = 1; i <= n; i++) {
+			sub(/.*\//, "", h[i])
+			print "#include <" h[i] ">"
+		}
+		print "#include <string.h>"
+		print ""
+		print "#include \"haeCommon.h\""
+		print "#include \"asnDeep.h\""
+		print ""
+		print "/* a field that differs: the compare stops there, the diff reports it and goes on */"
+		print "#define ASN_DEEP_DIFFER(name) \\"
+		print "\t{ ret = 1; if (HAE_NULL == pDiff) { return 1; } AsnDeep_Report(pDiff, name); }"
+		print "/* a field compared by a function of its own, under its name in the path */"
+		print "#define ASN_DEEP_INTO(name, cmp) \\"
+		print "\t{ size_t mark = AsnDeep_Push(pDiff, name); \\"
+		print "\t  if (0 != (cmp)) { ret = 1; if (HAE_NULL == pDiff) { return 1; } } \\"
+		print "\t  AsnDeep_Pop(pDiff, mark); }"
+		print ""
+
+		for (k = 1; k <= typeCnt; k++) {
+			t = order[k]
+			if (hasPtr[t]) {
+				print "static size_t sSize_" t "(const void *pv);"
+				print "static void sCopy_" t "(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);"
+			}
+			if (hasReloc[t]) print "static void sReloc_" t "(ASN_DEEP_RELOC *pReloc, void *pv);"
+			print "static int sCmp_" t "(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);"
+		}
+		for (k = 1; k <= ptrListCnt; k++) {
+			t = ptrListOrder[k]
+			print "static size_t sSize_" t "(const void *pv);"
+			print "static void sCopy_" t "(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc);"
+			print "static int sCmp_" t "(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB);"
+			print "static void sReloc_" t "(ASN_DEEP_RELOC *pReloc, void *pv);"
+		}
+		print ""
+		for (k = 1; k <= ptrListCnt; k++) genList(ptrListOrder[k])
+
+		for (k = 1; k <= typeCnt; k++) {
+			t = order[k]
+			if (hasPtr[t]) { genSize(t); genCopy(t) }
+			if (hasReloc[t]) genReloc(t)
+			genCmp(t)
+		}
+
+		print "const ASN_DEEP_TYPE asn_deep_table[] ="
+		print "{"
+		n = 0
+		for (k = 1; k <= typeCnt; k++) sorted[++n] = order[k]
+		for (i = 2; i <= n; i++) {
+			v = sorted[i]
+			for (j = i - 1; (j >= 1) && (sorted[j] > v); j--) sorted[j + 1] = sorted[j]
+			sorted[j + 1] = v
+		}
+		for (i = 1; i <= n; i++) {
+			t = sorted[i]
+			if (hasPtr[t])
+				printf "\t{ \"%s\", sizeof(%s), sSize_%s, sCopy_%s, sCmp_%s, sReloc_%s },\n", t, t, t, t, t, t
+			else if (hasReloc[t])
+				printf "\t{ \"%s\", sizeof(%s), HAE_NULL, HAE_NULL, sCmp_%s, sReloc_%s },\n", t, t, t, t
+			else
+				printf "\t{ \"%s\", sizeof(%s), HAE_NULL, HAE_NULL, sCmp_%s, HAE_NULL },\n", t, t, t
+		}
+		print "};"
+		print ""
+		print "const unsigned int asn_deep_cnt = sizeof(asn_deep_table) / sizeof(asn_deep_table[0]);"
+	}
+
+	# the statement for field i of t, value at expr (a pointer expression)
+	function sizeStmt(t, i, v, ind,    ft, fk, fn) {
+		ft = resolve(fType[t, i])
+		fk = kind(ft)
+		fn = fName[t, i]
+		if (fPtr[t, i]) {
+			if (("S" == fk && hasPtr[ft]) || "O" == fk || "L" == fk)
+				return ind "size += AsnDeep_SizePtr(" v "->u." fn ", sizeof(*" v "->u." fn "), " fnName("Size", ft) ");"
+			return ind "size += AsnDeep_SizePtr(" v "->u." fn ", sizeof(*" v "->u." fn "), HAE_NULL);"
+		}
+		fn = (("" != fTag[t, i]) ? "u." : "") fn
+		if ("Z" == fk) return ind "size += AsnDeep_SizeStr(" v "->" fn ");"
+		if ("O" == fk) return ind "size += AsnDeep_SizeOpen(&" v "->" fn ");"
+		if ("L" == fk) return ind "size += AsnDeep_SizeList(&" v "->" fn ", sizeof(" listElem[ft] "), " elemFn("Size", listElem[ft]) ");"
+		if ("S" == fk && hasPtr[ft]) return ind "size += sSize_" ft "(&" v "->" fn ");"
+		return ""
+	}
+
+	function copyStmt(t, i, ind,    ft, fk, fn) {
+		ft = resolve(fType[t, i])
+		fk = kind(ft)
+		fn = fName[t, i]
+		if (fPtr[t, i]) {
+			if (("S" == fk && hasPtr[ft]) || "O" == fk || "L" == fk)
+				return ind "pDst->u." fn " = AsnDeep_CopyPtr(pArena, pSrc->u." fn ", sizeof(*pSrc->u." fn "), " fnName("Copy", ft) ");"
+			return ind "pDst->u." fn " = AsnDeep_CopyPtr(pArena, pSrc->u." fn ", sizeof(*pSrc->u." fn "), HAE_NULL);"
+		}
+		fn = (("" != fTag[t, i]) ? "u." : "") fn
+		if ("Z" == fk) return ind "pDst->" fn " = AsnDeep_CopyStr(pArena, pSrc->" fn ");"
+		if ("O" == fk) return ind "AsnDeep_CopyOpen(pArena, &pDst->" fn ", &pSrc->" fn ");"
+		if ("L" == fk) return ind "AsnDeep_CopyList(pArena, &pDst->" fn ", &pSrc->" fn ", sizeof(" listElem[ft] "), " elemFn("Copy", listElem[ft]) ");"
+		if ("S" == fk && hasPtr[ft]) return ind "sCopy_" ft "(pArena, &pDst->" fn ", &pSrc->" fn ");"
+		return ""
+	}
+
+	function cmpStmt(t, i, ind,    ft, fk, fn, q) {
+		ft = resolve(fType[t, i])
+		fk = kind(ft)
+		fn = fName[t, i]
+		q = "\"" fn "\""
+		if (fPtr[t, i]) {
+			if ("S" == fk || "O" == fk || "L" == fk)
+				return ind "ASN_DEEP_INTO(" q ", AsnDeep_CmpPtr(pDiff, pA->u." fn ", pB->u." fn ", sizeof(*pA->u." fn "), " fnName("Cmp", ft) "))"
+			return ind "ASN_DEEP_INTO(" q ", AsnDeep_CmpPtr(pDiff, pA->u." fn ", pB->u." fn ", sizeof(*pA->u." fn "), HAE_NULL))"
+		}
+		fn = (("" != fTag[t, i]) ? "u." : "") fn
+		if ("Z" == fk) return ind "if (0 != AsnDeep_CmpStr(pA->" fn ", pB->" fn ")) ASN_DEEP_DIFFER(" q ")"
+		if ("O" == fk) return ind "ASN_DEEP_INTO(" q ", AsnDeep_CmpOpen(pDiff, &pA->" fn ", &pB->" fn "))"
+		if ("L" == fk) return ind "ASN_DEEP_INTO(" q ", AsnDeep_CmpList(pDiff, &pA->" fn ", &pB->" fn ", sizeof(" listElem[ft] "), " elemCmp(listElem[ft]) "))"
+		if ("S" == fk) return ind "ASN_DEEP_INTO(" q ", sCmp_" ft "(pDiff, &pA->" fn ", &pB->" fn "))"
+		if ("" != fLen[t, i]) return ind "if (0 != memcmp(pA->" fn ", pB->" fn ", sizeof(pA->" fn "))) ASN_DEEP_DIFFER(" q ")"
+		return ind "if (pA->" fn " != pB->" fn ") ASN_DEEP_DIFFER(" q ")"
+	}
+
+	# a list as the value of a function, for CHOICE alternatives by pointer
+	function genList(t,    e) {
+		e = listElem[t]
+		print "static size_t sSize_" t "(const void *pv)"
+		print "{"
+		print "\treturn AsnDeep_SizeList((const OSRTDList *)pv, sizeof(" e "), " elemFn("Size", e) ");"
+		print "}"
+		print ""
+		print "static void sCopy_" t "(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)"
+		print "{"
+		print "\tAsnDeep_CopyList(pArena, (OSRTDList *)pvDst, (const OSRTDList *)pvSrc, sizeof(" e "), " elemFn("Copy", e) ");"
+		print "}"
+		print ""
+		print "static int sCmp_" t "(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)"
+		print "{"
+		print "\treturn AsnDeep_CmpList(pDiff, (const OSRTDList *)pvA, (const OSRTDList *)pvB, sizeof(" e "), " elemCmp(e) ");"
+		print "}"
+		print ""
+		print "static void sReloc_" t "(ASN_DEEP_RELOC *pReloc, void *pv)"
+		print "{"
+		print "\tAsnDeep_RelocList(pReloc, (OSRTDList *)pv, sizeof(" e "), " elemReloc(e) ");"
+		print "}"
+		print ""
+	}
+
+	function relocStmt(t, i, ind,    ft, fk, fn) {
+		ft = resolve(fType[t, i])
+		fk = kind(ft)
+		fn = fName[t, i]
+		if (fPtr[t, i]) {
+			if (("S" == fk && hasReloc[ft]) || "O" == fk || "L" == fk)
+				return ind "AsnDeep_RelocObj(pReloc, &pValue->u." fn ", sizeof(*pValue->u." fn "), " fnName("Reloc", ft) ");"
+			return ind "AsnDeep_RelocObj(pReloc, &pValue->u." fn ", sizeof(*pValue->u." fn "), HAE_NULL);"
+		}
+		fn = (("" != fTag[t, i]) ? "u." : "") fn
+		if ("Z" == fk) return ind "AsnDeep_RelocStr(pReloc, &pValue->" fn ");"
+		if ("O" == fk) return ind "AsnDeep_RelocOpen(pReloc, &pValue->" fn ");"
+		if ("L" == fk) return ind "AsnDeep_RelocList(pReloc, &pValue->" fn ", sizeof(" listElem[ft] "), " elemReloc(listElem[ft]) ");"
+		if ("S" == fk && hasReloc[ft]) return ind "sReloc_" ft "(pReloc, &pValue->" fn ");"
+		return ""
+	}
+
+	function emit(s) {
+		if ("" != s) print s
+	}
+
+	function genSize(t,    i, fn, s) {
+		print "static size_t sSize_" t "(const void *pv)"
+		print "{"
+		print "\tconst " t " *pValue = (const " t " *)pv;"
+		if ("BITS" == form[t]) {
+			print ""
+			print "\treturn AsnDeep_SizeBits(pValue->numbits, sizeof(pValue->data), pValue->extdata);"
+			print "}"
+			print ""
+			return
+		}
+		if ("ARRAY" == form[t]) {
+			print ""
+			print "\treturn AsnDeep_SizeArray(pValue->elem, pValue->n, sizeof(pValue->elem) / sizeof(pValue->elem[0]), sizeof(pValue->elem[0]), " elemFn("Size", fType[t, 2]) ");"
+			print "}"
+			print ""
+			return
+		}
+		print "\tsize_t size = 0;"
+		print ""
+		if (choice[t]) {
+			print "\tswitch (pValue->t)"
+			print "\t{"
+			for (i = 2; i <= fieldCnt[t]; i++) {
+				s = sizeStmt(t, i, "pValue", "\t\t\t")
+				if ("" == s) continue
+				print "\t\tcase " fTag[t, i] ":"
+				print s
+				print "\t\t\tbreak;"
+			}
+			print "\t}"
+		} else {
+			for (i = 1; i <= fieldCnt[t]; i++) {
+				s = sizeStmt(t, i, "pValue", "\t")
+				if ("" == s) continue
+				if ((t SUBSEP fName[t, i]) in present) {
+					print "\tif (pValue->m." fName[t, i] "Present)"
+					print "\t{"
+					print "\t" s
+					print "\t}"
+				} else {
+					print s
+				}
+			}
+		}
+		print "\treturn size;"
+		print "}"
+		print ""
+	}
+
+	function genCopy(t,    i, s, n) {
+		print "static void sCopy_" t "(ASN_DEEP_ARENA *pArena, void *pvDst, const void *pvSrc)"
+		print "{"
+		print "\t" t " *pDst = (" t " *)pvDst;"
+		print "\tconst " t " *pSrc = (const " t " *)pvSrc;"
+		print ""
+		if ("BITS" == form[t]) {
+			print "\tpDst->extdata = AsnDeep_CopyBits(pArena, pSrc->numbits, sizeof(pSrc->data), pSrc->extdata);"
+			print "}"
+			print ""
+			return
+		}
+		if ("ARRAY" == form[t]) {
+			print "\tAsnDeep_CopyArray(pArena, pDst->elem, pSrc->elem, pSrc->n, sizeof(pSrc->elem) / sizeof(pSrc->elem[0]), sizeof(pSrc->elem[0]), " elemFn("Copy", fType[t, 2]) ");"
+			print "}"
+			print ""
+			return
+		}
+		if (choice[t]) {
+			print "\tswitch (pSrc->t)"
+			print "\t{"
+			for (i = 2; i <= fieldCnt[t]; i++) {
+				s = copyStmt(t, i, "\t\t\t")
+				if ("" == s) continue
+				print "\t\tcase " fTag[t, i] ":"
+				print s
+				print "\t\t\tbreak;"
+			}
+			# alternatives without pointers are in the shallow copy already
+			n = 0
+			for (i = 2; i <= fieldCnt[t]; i++) {
+				if ("" != copyStmt(t, i, "")) continue
+				print "\t\tcase " fTag[t, i] ":"
+				n++
+			}
+			if (n > 0) print "\t\t\tbreak;"
+			print "\t\tdefault:"
+			print "\t\t\tmemset(&pDst->u, 0x00, sizeof(pDst->u));"
+			print "\t\t\tbreak;"
+			print "\t}"
+		} else {
+			for (i = 1; i <= fieldCnt[t]; i++) {
+				s = copyStmt(t, i, "\t")
+				if ("" == s) continue
+				if ((t SUBSEP fName[t, i]) in present) {
+					print "\tif (pSrc->m." fName[t, i] "Present)"
+					print "\t{"
+					print "\t" s
+					print "\t}"
+					print "\telse"
+					print "\t{"
+					print "\t\tmemset(&pDst->" fName[t, i] ", 0x00, sizeof(pDst->" fName[t, i] "));"
+					print "\t}"
+				} else {
+					print s
+				}
+			}
+		}
+		print "}"
+		print ""
+	}
+
+	function genReloc(t,    i, s, n) {
+		print "static void sReloc_" t "(ASN_DEEP_RELOC *pReloc, void *pv)"
+		print "{"
+		print "\t" t " *pValue = (" t " *)pv;"
+		print ""
+		if ("BITS" == form[t]) {
+			if ("extdata" == fName[t, 3])
+				print "\tAsnDeep_RelocBits(pReloc, &pValue->extdata, pValue->numbits, sizeof(pValue->data));"
+			else
+				print "\tAsnDeep_RelocBits(pReloc, HAE_NULL, pValue->numbits, sizeof(pValue->data));"
+			print "}"
+			print ""
+			return
+		}
+		if ("OCTETS" == form[t]) {
+			print "\tAsnDeep_RelocOctets(pReloc, pValue->numocts, sizeof(pValue->data));"
+			print "}"
+			print ""
+			return
+		}
+		if ("ARRAY" == form[t]) {
+			print "\tAsnDeep_RelocArray(pReloc, pValue->elem, pValue->n, sizeof(pValue->elem) / sizeof(pValue->elem[0]), sizeof(pValue->elem[0]), " elemReloc(fType[t, 2]) ");"
+			print "}"
+			print ""
+			return
+		}
+		if (choice[t]) {
+			print "\tswitch (pValue->t)"
+			print "\t{"
+			for (i = 2; i <= fieldCnt[t]; i++) {
+				s = relocStmt(t, i, "\t\t\t")
+				if ("" == s) continue
+				print "\t\tcase " fTag[t, i] ":"
+				print s
+				print "\t\t\tbreak;"
+			}
+			n = 0
+			for (i = 2; i <= fieldCnt[t]; i++) {
+				if ("" != relocStmt(t, i, "")) continue
+				print "\t\tcase " fTag[t, i] ":"
+				n++
+			}
+			if (n > 0) print "\t\t\tbreak;"
+			# the encoders take an unknown t for an extension in extElem1
+			print "\t\tdefault:"
+			print "\t\t\tAsnDeep_RelocInvalid(pReloc);"
+			print "\t\t\tbreak;"
+			print "\t}"
+		} else {
+			for (i = 1; i <= fieldCnt[t]; i++) {
+				s = relocStmt(t, i, "\t")
+				if ("" == s) continue
+				if ((t SUBSEP fName[t, i]) in present) {
+					print "\tif (pValue->m." fName[t, i] "Present)"
+					print "\t{"
+					print "\t" s
+					print "\t}"
+				} else {
+					print s
+				}
+			}
+		}
+		print "}"
+		print ""
+	}
+
+	function genCmp(t,    i, s, fn) {
+		print "static int sCmp_" t "(ASN_DEEP_DIFF *pDiff, const void *pvA, const void *pvB)"
+		print "{"
+		print "\tconst " t " *pA = (const " t " *)pvA;"
+		print "\tconst " t " *pB = (const " t " *)pvB;"
+		if ("BITS" == form[t]) {
+			print ""
+			if ("extdata" == fName[t, 3])
+				print "\treturn AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, pA->extdata, pB->numbits, pB->data, pB->extdata, sizeof(pA->data));"
+			else
+				print "\treturn AsnDeep_CmpBits(pDiff, pA->numbits, pA->data, HAE_NULL, pB->numbits, pB->data, HAE_NULL, sizeof(pA->data));"
+			print "}"
+			print ""
+			return
+		}
+		if ("OCTETS" == form[t]) {
+			print ""
+			print "\treturn AsnDeep_CmpOctets(pDiff, pA->numocts, pA->data, pB->numocts, pB->data, sizeof(pA->data));"
+			print "}"
+			print ""
+			return
+		}
+		if ("ARRAY" == form[t]) {
+			print ""
+			print "\treturn AsnDeep_CmpArray(pDiff, pA->elem, pA->n, pB->elem, pB->n, sizeof(pA->elem) / sizeof(pA->elem[0]), sizeof(pA->elem[0]), " elemCmp(fType[t, 2]) ");"
+			print "}"
+			print ""
+			return
+		}
+		print "\tint ret = 0;"
+		print ""
+		if (choice[t]) {
+			print "\tif (pA->t != pB->t)"
+			print "\t{"
+			print "\t\tASN_DEEP_DIFFER(\"t\")"
+			print "\t\treturn ret;"
+			print "\t}"
+			print "\tswitch (pA->t)"
+			print "\t{"
+			for (i = 2; i <= fieldCnt[t]; i++) {
+				print "\t\tcase " fTag[t, i] ":"
+				print cmpStmt(t, i, "\t\t\t")
+				print "\t\t\tbreak;"
+			}
+			print "\t}"
+		} else {
+			for (i = 1; i <= fieldCnt[t]; i++) {
+				fn = fName[t, i]
+				if ((t SUBSEP fn) in present) {
+					print "\tif (pA->m." fn "Present != pB->m." fn "Present) ASN_DEEP_DIFFER(\"" fn "\")"
+					print "\telse if (pA->m." fn "Present)"
+					print "\t{"
+					print cmpStmt(t, i, "\t\t")
+					print "\t}"
+				} else {
+					print cmpStmt(t, i, "\t")
+				}
+			}
+		}
+		print "\treturn ret;"
+		print "}"
+		print ""
+	}
+'
@@ -0,0 +1,36 @@
+#!/bin/sh
+#
+# Generates asnListTable.h (element type of every SEQUENCE OF held in an
+# OSRTDList) from the "List of" comments above the typedefs of the
+# generated headers. One ASN_LIST(list, element) per type, asnList.h
+# defines ASN_LIST before including it.
+#
+# usage: ./genAsnListTable.sh header.h... > asnListTable.h
+#
+
+LC_ALL=C
+export LC_ALL
+
+cat "$@" | tr -d '\r' | awk '
+	/^\/\* List of [A-Za-z0-9_]* \*\/$/ { elem = $4; next }
+	/^typedef OSRTDList [A-Za-z0-9_]*;$/ {
+		name = substr($3, 1, length($3) - 1)
+		if ("" != elem) print name " " elem
+		elem = ""
+		next
+	}
+	/[^ \t]/ { elem = "" }
+' | sort -u | awk -v headers="$*" '
+	BEGIN {
+		print "/* Generated by genAsnListTable.sh, do not edit */"
+		print ""
+		n = split(headers, h, " ")
+		for (i = 1; i <= n; i++) {
+			sub(/.*\//, "", h[i])
+			list = list (i > 1 ? ", " : "") h[i]
+		}
+		print "/* OSRTDList typedefs of " list " */"
+		print ""
+	}
+	{ print "ASN_LIST(" $1 ", " $2 ")" }
+'
@@ -0,0 +1,123 @@
+#!/bin/sh
+#
+# Generates asnTypeTable.c (name -> codec functions and encoded size bounds
+# of every ASN.1 type) from the asn1PE_/OEREnc_/asn1E_/asn1PrtToStrm_/asn1Test_
+# prototypes of the generated headers and the ASN.1 text in their comments
+# (asnSize.awk).
+# asn1Test_ is only referenced for types libtrafficinfo1 actually exports.
+#
+# usage: ./genAsnTypeTable.sh libtrafficinfo1.so header.h... > asnTypeTable.c
+#
+
+LC_ALL=C
+export LC_ALL
+
+LIB=$1
+shift
+
+nm -D "$LIB" | awk '$2 == "T" && $3 ~ /^asn1Test_/ { print substr($3, 10) }' > asnTypeTable.tmp
+awk -f "`dirname "$0"`/asnSize.awk" "$@" > asnTypeSize.tmp
+
+cat "$@" | tr -d '\r' | tr '\n' ' ' | tr ';' '\n' | \
+	sed -n -e 's/  */ /g' -e 's/.*EXTERN \([^(]*\)\(asn1Test\|asn1PE\|OEREnc\|asn1E\|asn1PrtToStrm\)_\([A-Za-z0-9_]*\) *(\([^)]*\)).*/\2 \3 \1|\4/p' | \
+	awk -v headers="$*" '
+	FILENAME == "asnTypeTable.tmp" { lib[$1] = 1; next }
+	FILENAME == "asnTypeSize.tmp" { bound[$1] = $0; next }
+	{
+		split($0, f, "|")
+		if ($1 == "asn1PE") {
+			enc[$2] = (f[2] ~ /pvalue *$/) ? "P" : "V"
+		} else if ($1 == "OEREnc") {
+			oer[$2] = (f[2] ~ /pvalue *$/) ? "P" : "V"
+		} else if ($1 == "asn1E") {
+			ber[$2] = (f[2] ~ /\* *pvalue, *ASN1TagType tagging *$/) ? "P" : "V"
+		} else if ($1 == "asn1PrtToStrm") {
+			prt[$2] = (f[2] ~ /\* *pvalue *$/) ? "P" : "V"
+		} else if ($2 in lib) {
+			test[$2] = (f[1] ~ /\* *$/) ? "P" : "V"
+		}
+	}
+	END {
+		print "/* Generated by genAsnTypeTable.sh, do not edit */"
+		print ""
+		n = split(headers, h, " ")
+		for (i = 1; i <= n; i++) {
+			sub(/.*\//, "", h[i])
+			print "#include <" h[i] ">"
+		}
+		print "#include <rtxsrc/rtxMemory.h>"
+		print ""
+		print "#include \"asnType.h\""
+		print ""
+		print "/* codec wrappers: PE / OEREnc / E / PrtToStrm by pointer or by value, test value by pointer or by value */"
+		print "#define ASN_CODEC_P(T) \\"
+		print "\tstatic int sPerEnc_##T(OSCTXT *pctxt, void *pvalue) { return asn1PE_##T(pctxt, (T *)pvalue); } \\"
+		print "\tstatic int sPerDec_##T(OSCTXT *pctxt, void *pvalue) { return asn1PD_##T(pctxt, (T *)pvalue); }"
+		print "#define ASN_CODEC_V(T) \\"
+		print "\tstatic int sPerEnc_##T(OSCTXT *pctxt, void *pvalue) { return asn1PE_##T(pctxt, *(T *)pvalue); } \\"
+		print "\tstatic int sPerDec_##T(OSCTXT *pctxt, void *pvalue) { return asn1PD_##T(pctxt, (T *)pvalue); }"
+		print "#define ASN_OER_P(T) \\"
+		print "\tstatic int sOerEnc_##T(OSCTXT *pctxt, void *pvalue) { return OEREnc_##T(pctxt, (T *)pvalue); } \\"
+		print "\tstatic int sOerDec_##T(OSCTXT *pctxt, void *pvalue) { return OERDec_##T(pctxt, (T *)pvalue); }"
+		print "#define ASN_OER_V(T) \\"
+		print "\tstatic int sOerEnc_##T(OSCTXT *pctxt, void *pvalue) { return OEREnc_##T(pctxt, *(T *)pvalue); } \\"
+		print "\tstatic int sOerDec_##T(OSCTXT *pctxt, void *pvalue) { return OERDec_##T(pctxt, (T *)pvalue); }"
+		print "#define ASN_BER_P(T) \\"
+		print "\tstatic int sBerEnc_##T(OSCTXT *pctxt, void *pvalue) { return asn1E_##T(pctxt, (T *)pvalue, ASN1EXPL); } \\"
+		print "\tstatic int sBerDec_##T(OSCTXT *pctxt, void *pvalue) { return asn1D_##T(pctxt, (T *)pvalue, ASN1EXPL, 0); }"
+		print "#define ASN_BER_V(T) \\"
+		print "\tstatic int sBerEnc_##T(OSCTXT *pctxt, void *pvalue) { return asn1E_##T(pctxt, *(T *)pvalue, ASN1EXPL); } \\"
+		print "\tstatic int sBerDec_##T(OSCTXT *pctxt, void *pvalue) { return asn1D_##T(pctxt, (T *)pvalue, ASN1EXPL, 0); }"
+		print "#define ASN_PRINT_P(T) \\"
+		print "\tstatic int sPrint_##T(OSCTXT *pctxt, const char *name, const void *pvalue) { return asn1PrtToStrm_##T(pctxt, name, (const T *)pvalue); }"
+		print "#define ASN_PRINT_V(T) \\"
+		print "\tstatic int sPrint_##T(OSCTXT *pctxt, const char *name, const void *pvalue) { return asn1PrtToStrm_##T(pctxt, name, *(const T *)pvalue); }"
+		print "#define ASN_TEST_P(T) \\"
+		print "\tstatic void *sTest_##T(OSCTXT *pctxt) { return asn1Test_##T(pctxt); }"
+		print "#define ASN_TEST_V(T) \\"
+		print "\tstatic void *sTest_##T(OSCTXT *pctxt) { T *p = rtxMemAllocType(pctxt, T); if (0 != p) *p = asn1Test_##T(pctxt); return p; }"
+		print ""
+
+		cnt = 0
+		for (t in enc) name[++cnt] = t
+		# insertion sort, C locale order for AsnType_Find
+		for (i = 2; i <= cnt; i++) {
+			v = name[i]
+			for (j = i - 1; j >= 1 && name[j] > v; j--) name[j + 1] = name[j]
+			name[j + 1] = v
+		}
+
+		for (i = 1; i <= cnt; i++) {
+			t = name[i]
+			print "ASN_CODEC_" enc[t] "(" t ")"
+			print "ASN_OER_" oer[t] "(" t ")"
+			print "ASN_BER_" ber[t] "(" t ")"
+			print "ASN_PRINT_" prt[t] "(" t ")"
+			if (t in test) print "ASN_TEST_" test[t] "(" t ")"
+		}
+		print ""
+
+		print "const ASN_TYPE asn_type_table[] ="
+		print "{"
+		for (i = 1; i <= cnt; i++) {
+			t = name[i]
+			# name flags perMin perMax oerMin oerMax, max -1 is unbounded
+			if (t in bound) {
+				split(bound[t], b, " ")
+				flags = ""
+				if (b[2] % 2) flags = "ASN_SIZE_EXT"
+				if (int(b[2] / 2) % 2) flags = flags (flags == "" ? "" : " | ") "ASN_SIZE_UNBOUNDED"
+				if (int(b[2] / 4) % 2) flags = flags (flags == "" ? "" : " | ") "ASN_SIZE_UNKNOWN"
+				if (flags == "") flags = "0"
+				sz = flags ", " b[3] ", " ((b[4] < 0) ? 0 : b[4]) ", " b[5] ", " ((b[6] < 0) ? 0 : b[6])
+			} else {
+				sz = "ASN_SIZE_UNBOUNDED | ASN_SIZE_UNKNOWN, 0, 0, 0, 0"
+			}
+			print "\t{ \"" t "\", sizeof(" t "), " ((t in test) ? "sTest_" t : "0") ", sPerEnc_" t ", sPerDec_" t ", sOerEnc_" t ", sOerDec_" t ", sBerEnc_" t ", sBerDec_" t ", sPrint_" t ", " sz " },"
+		}
+		print "};"
+		print ""
+		print "const unsigned int asn_type_cnt = " cnt ";"
+	}' asnTypeTable.tmp asnTypeSize.tmp -
+
+rm -f asnTypeTable.tmp asnTypeSize.tmp
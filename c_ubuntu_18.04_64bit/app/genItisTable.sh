@@ -0,0 +1,94 @@
+#!/bin/sh
+#
+# Generates itisTable.c (English ITIS code -> phrase table) from the
+# ENUMERATED types of ITIS.h.
+#
+# usage: ./genItisTable.sh [ITIS.h] > itisTable.c
+#
+
+ITIS_H=${1:-../include/ITIS.h}
+
+grep -E '^[A-Za-z]+ ::= ENUMERATED \{' "$ITIS_H" | \
+	sed -e 's/^[A-Za-z]* ::= ENUMERATED {//' -e 's/}$//' | \
+	tr ',' '\n' | \
+	sed -n 's/^ *\([A-Za-z0-9-]*\)(\([0-9]*\)) *$/\2 \1/p' | \
+	sort -n -u -k1,1 | \
+	awk '
+	function phrase(name,    n, w, i, s) {
+		n = split(name, w, "-")
+		s = ""
+		for (i = 1; i <= n; i++) {
+			# ASN.1 lower-cases the first letter of acronyms (hAZMAT, lPG)
+			if (substr(w[i], 2, 1) ~ /[A-Z]/)
+				w[i] = toupper(substr(w[i], 1, 1)) substr(w[i], 2)
+			s = s (i > 1 ? " " : "") w[i]
+		}
+		return s
+	}
+	{
+		code[NR] = $1
+		text[NR] = phrase($2)
+	}
+	END {
+		print "/* Generated by genItisTable.sh from ITIS.h, do not edit */"
+		print ""
+		print "#include \"itisText.h\""
+		print ""
+
+		off = 1
+		print "static const char itis_en_str[] ="
+		print "\t\"\\0\""
+		for (i = 1; i <= NR; i++) {
+			print "\t\"" text[i] "\\0\""
+			stroff[i] = off
+			off += length(text[i]) + 1
+		}
+		print "\t;"
+		print ""
+
+		pageCnt = 0
+		for (i = 1; i <= NR; i++) {
+			p = int(code[i] / 256)
+			if (!(p in pageIdx)) {
+				pageIdx[p] = pageCnt++
+				pageNum[pageCnt] = p
+			}
+			slot[pageIdx[p] * 256 + code[i] % 256] = stroff[i]
+		}
+
+		print "static const unsigned int itis_en_dir[ITIS_PAGE_CNT] ="
+		print "{"
+		for (p = 0; p < 256; p++) {
+			line = (p % 16 == 0) ? "\t" : line " "
+			line = line ((p in pageIdx) ? pageIdx[p] + 1 : 0) ","
+			if (p % 16 == 15) print line
+		}
+		print "};"
+		print ""
+
+		print "static const unsigned int itis_en_page[" pageCnt "][ITIS_PAGE_SIZE] ="
+		print "{"
+		for (k = 0; k < pageCnt; k++) {
+			print "\t/* " pageNum[k + 1] * 256 " .. " pageNum[k + 1] * 256 + 255 " */"
+			print "\t{"
+			for (s = 0; s < 256; s++) {
+				line = (s % 16 == 0) ? "\t\t" : line " "
+				line = line ((k * 256 + s) in slot ? slot[k * 256 + s] : 0) ","
+				if (s % 16 == 15) print line
+			}
+			print "\t},"
+		}
+		print "};"
+		print ""
+
+		print "const ITIS_TABLE itis_en ="
+		print "{"
+		print "\titis_en_dir,"
+		print "\t&itis_en_page[0][0],"
+		print "\titis_en_str,"
+		print "\t" pageCnt ","
+		print "\tsizeof(itis_en_str),"
+		print "\t0,"
+		print "\t0"
+		print "};"
+	}'
@@ -0,0 +1,23 @@
+#ifndef HAE_COMMON_H
+#define HAE_COMMON_H
+
+#define	HAE_TRUE				((unsigned char)1)
+#define	HAE_FALSE				((unsigned char)0)
+
+#define	HAE_OK					((int )0)
+#define	HAE_ERROR				((int)-1)
+
+#define HAE_NULL				((void *)0)
+
+#define DSRC_PORT				60000
+#define LOCAL_PORT				50000
+#define LOCAL_SOURCE_PORT		55555
+
+#define BUFF_SIZE				1024
+
+/* decode path diagnostics compiled in, 0 none (see decodeSample.c) */
+#ifndef HAE_DIAG_LEVEL
+#define HAE_DIAG_LEVEL			0
+#endif
+
+#endif
@@ -0,0 +1,127 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "haeCommon.h"
+#include "itisText.h"
+
+#define ITIS_PACK_STR_MAX		(256 * 1024)
+#define ITIS_PACK_LINE_MAX		1024
+
+static unsigned int pack_page[ITIS_PAGE_CNT][ITIS_PAGE_SIZE];
+static char pack_str[ITIS_PACK_STR_MAX];
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: Build an ITIS localisation pack for ItisText_LoadPack
+ *
+ * Parameter	: argv[1] - source text, one "code<TAB>phrase" per line,
+ *				            '#' starts a comment line
+ *				  argv[2] - output pack
+ *
+ * Notes		: Only pages that hold at least one phrase are written.
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	FILE *pIn, *pOut;
+	char line[ITIS_PACK_LINE_MAX];
+	char *pTab, *pEnd;
+	unsigned long code;
+	unsigned int lineNo = 0;
+	unsigned int i, len, strSize = 1;
+	unsigned int pageMap[ITIS_PAGE_CNT];
+	ITIS_PACK_HEADER header;
+
+	if (argc < 3)
+	{
+		printf("usage: %s <phrases.txt> <out.pack>\n", argv[0]);
+		return 1;
+	}
+
+	pIn = fopen(argv[1], "r");
+	if (HAE_NULL == pIn)
+	{
+		perror("fopen");
+		return 1;
+	}
+
+	memset(pageMap, 0, sizeof(pageMap));
+	pack_str[0] = '\0';
+
+	while (HAE_NULL != fgets(line, sizeof(line), pIn))
+	{
+		lineNo++;
+		line[strcspn(line, "\r\n")] = '\0';
+
+		if (('#' == line[0]) || ('\0' == line[0]))
+		{
+			continue;
+		}
+
+		pTab = strchr(line, '\t');
+		code = strtoul(line, &pEnd, 10);
+		if ((HAE_NULL == pTab) || (pEnd != pTab) || (code > 0xffff) || ('\0' == pTab[1]))
+		{
+			printf("[ITIS] ERROR : %s:%u malformed line\n", argv[1], lineNo);
+			fclose(pIn);
+			return 1;
+		}
+
+		len = strlen(pTab + 1) + 1;
+		if (strSize + len > sizeof(pack_str))
+		{
+			printf("[ITIS] ERROR : %s:%u string area full\n", argv[1], lineNo);
+			fclose(pIn);
+			return 1;
+		}
+
+		memcpy(pack_str + strSize, pTab + 1, len);
+		pack_page[code >> 8][code & 0xff] = strSize;
+		pageMap[code >> 8] = 1;
+		strSize += len;
+	}
+	fclose(pIn);
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, ITIS_PACK_MAGIC, sizeof(header.magic));
+	header.version = ITIS_PACK_VERSION;
+	header.bom = ITIS_PACK_BOM;
+	header.strSize = strSize;
+	for (i = 0; i < ITIS_PAGE_CNT; i++)
+	{
+		if (pageMap[i])
+		{
+			header.dir[i] = ++header.pageCnt;
+		}
+	}
+
+	pOut = fopen(argv[2], "wb");
+	if (HAE_NULL == pOut)
+	{
+		perror("fopen");
+		return 1;
+	}
+
+	fwrite(&header, sizeof(header), 1, pOut);
+	for (i = 0; i < ITIS_PAGE_CNT; i++)
+	{
+		if (pageMap[i])
+		{
+			fwrite(pack_page[i], sizeof(pack_page[i]), 1, pOut);
+		}
+	}
+	fwrite(pack_str, strSize, 1, pOut);
+
+	if (0 != fclose(pOut))
+	{
+		perror("fclose");
+		return 1;
+	}
+
+	printf("%s : %u pages, %u string bytes\n", argv[2], header.pageCnt, strSize);
+
+	return 0;
+}
@@ -0,0 +1,335 @@
+/* Generated by genItisTable.sh from ITIS.h, do not edit */
+
+#include "itisText.h"
+
+static const char itis_en_str[] =
+	"\0"
+	"on bridges\0"
+	"in tunnels\0"
+	"entering or leaving tunnels\0"
+	"on ramps\0"
+	"in road construction area\0"
+	"around a curve\0"
+	"on minor roads\0"
+	"in the opposing lanes\0"
+	"adjacent to roadway\0"
+	"on bend\0"
+	"entire intersection\0"
+	"in the median\0"
+	"moved to side of road\0"
+	"moved to shoulder\0"
+	"on the roadway\0"
+	"in shaded areas\0"
+	"in low lying areas\0"
+	"in the downtown area\0"
+	"in the inner city area\0"
+	"in parts\0"
+	"in some places\0"
+	"in the ditch\0"
+	"in the valley\0"
+	"on hill top\0"
+	"near the foothills\0"
+	"at high altitudes\0"
+	"near the lake\0"
+	"near the shore\0"
+	"over the crest of a hill\0"
+	"other than on the roadway\0"
+	"near the beach\0"
+	"near beach access point\0"
+	"lower level\0"
+	"upper level\0"
+	"airport\0"
+	"concourse\0"
+	"gate\0"
+	"baggage claim\0"
+	"customs point\0"
+	"station\0"
+	"platform\0"
+	"dock\0"
+	"depot\0"
+	"ev charging point\0"
+	"information welcome point\0"
+	"at rest area\0"
+	"at service area\0"
+	"at weigh station\0"
+	"picnic areas\0"
+	"rest area\0"
+	"service stations\0"
+	"toilets\0"
+	"on the right\0"
+	"on the left\0"
+	"in the center\0"
+	"in the opposite direction\0"
+	"cross traffic\0"
+	"northbound traffic\0"
+	"eastbound traffic\0"
+	"southbound traffic\0"
+	"westbound traffic\0"
+	"north\0"
+	"south\0"
+	"east\0"
+	"west\0"
+	"northeast\0"
+	"northwest\0"
+	"southeast\0"
+	"southwest\0"
+	"mountain pass\0"
+	"reservation center\0"
+	"nearby basin\0"
+	"on tracks\0"
+	"dip\0"
+	"traffic circle\0"
+	"park and ride lot\0"
+	"to\0"
+	"by\0"
+	"through\0"
+	"area of\0"
+	"under\0"
+	"over\0"
+	"from\0"
+	"approaching\0"
+	"entering at\0"
+	"exiting at\0"
+	"across tracks\0"
+	"in street\0"
+	"on curve\0"
+	"shoulder\0"
+	"crossover\0"
+	"cross road\0"
+	"side road\0"
+	"bus stop\0"
+	"intersection\0"
+	"roadside park\0"
+	"all vehicles\0"
+	"bicycles\0"
+	"motorcycles\0"
+	"cars\0"
+	"light vehicles\0"
+	"cars and light vehicles\0"
+	"cars with trailers\0"
+	"cars with recreational trailers\0"
+	"vehicles with trailers\0"
+	"heavy vehicles\0"
+	"trucks\0"
+	"buses\0"
+	"articulated buses\0"
+	"school buses\0"
+	"vehicles with semi trailers\0"
+	"vehicles with double trailers\0"
+	"high profile vehicles\0"
+	"wide vehicles\0"
+	"long vehicles\0"
+	"hazardous loads\0"
+	"exceptional loads\0"
+	"abnormal loads\0"
+	"convoys\0"
+	"maintenance vehicles\0"
+	"delivery vehicles\0"
+	"vehicles with even numbered license plates\0"
+	"vehicles with odd numbered license plates\0"
+	"vehicles with parking permits\0"
+	"vehicles with catalytic converters\0"
+	"vehicles without catalytic converters\0"
+	"gas powered vehicles\0"
+	"diesel powered vehicles\0"
+	"LPG vehicles\0"
+	"military convoys\0"
+	"military vehicles\0"
+	"emergency vehicle units\0"
+	"federal law enforcement units\0"
+	"state police units\0"
+	"county police units\0"
+	"local police units\0"
+	"ambulance units\0"
+	"rescue units\0"
+	"fire units\0"
+	"HAZMAT units\0"
+	"light tow unit\0"
+	"heavy tow unit\0"
+	"freeway service patrols\0"
+	"transportation response units\0"
+	"private contractor response units\0"
+	"ground fire suppression\0"
+	"heavy ground equipment\0"
+	"aircraft\0"
+	"marine equipment\0"
+	"support equipment\0"
+	"medical rescue unit\0"
+	"other\0"
+	"ground fire suppression other\0"
+	"engine\0"
+	"truck or aerial\0"
+	"quint\0"
+	"tanker pumper combination\0"
+	"brush truck\0"
+	"aircraft rescue firefighting\0"
+	"heavy ground equipment other\0"
+	"dozer or plow\0"
+	"tractor\0"
+	"tanker or tender\0"
+	"aircraft other\0"
+	"aircraft fixed wing tanker\0"
+	"helitanker\0"
+	"helicopter\0"
+	"marine equipment other\0"
+	"fire boat with pump\0"
+	"boat no pump\0"
+	"support apparatus other\0"
+	"breathing apparatus support\0"
+	"light and air unit\0"
+	"medical rescue unit other\0"
+	"rescue unit\0"
+	"urban search rescue unit\0"
+	"high angle rescue\0"
+	"crash fire rescue\0"
+	"BLS unit\0"
+	"ALS unit\0"
+	"mobile command post\0"
+	"chief officer car\0"
+	"HAZMAT unit\0"
+	"type i hand crew\0"
+	"type ii hand crew\0"
+	"privately owned vehicle\0"
+	"other apparatus resource\0"
+	"ambulance\0"
+	"bomb squad van\0"
+	"combine harvester\0"
+	"construction vehicle\0"
+	"farm tractor\0"
+	"grass cutting machines\0"
+	"HAZMAT containment tow\0"
+	"heavy tow\0"
+	"hedge cutting machines\0"
+	"light tow\0"
+	"mobile crane\0"
+	"refuse collection vehicle\0"
+	"resurfacing vehicle\0"
+	"road sweeper\0"
+	"roadside litter collection crews\0"
+	"salvage vehicle\0"
+	"sand truck\0"
+	"snowplow\0"
+	"steam roller\0"
+	"swat team van\0"
+	"track laying vehicle\0"
+	"unknown vehicle\0"
+	"white lining vehicle\0"
+	"dump truck\0"
+	"supervisor vehicle\0"
+	"snow blower\0"
+	"rotary snow blower\0"
+	"road grader\0"
+	"steam truck\0"
+	"flatbed tow\0"
+	;
+
+static const unsigned int itis_en_dir[ITIS_PAGE_CNT] =
+{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+	0, 0, 0, 0, 2, 0, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const unsigned int itis_en_page[4][ITIS_PAGE_SIZE] =
+{
+	/* 7936 .. 8191 */
+	{
+		0, 1, 12, 23, 51, 60, 86, 101, 116, 138, 158, 166, 186, 200, 222, 240,
+		255, 271, 290, 311, 334, 343, 358, 371, 385, 397, 416, 434, 448, 463, 488, 514,
+		529, 553, 565, 577, 585, 595, 600, 614, 628, 636, 645, 650, 656, 674, 700, 713,
+		729, 746, 759, 769, 786, 794, 807, 819, 833, 859, 873, 892, 910, 929, 947, 953,
+		959, 964, 969, 979, 989, 999, 1009, 1023, 1042, 1055, 1065, 1069, 1084, 0, 1102, 1105,
+		1108, 1116, 1124, 1130, 1135, 1140, 1152, 1164, 1175, 1189, 1199, 1208, 1217, 1227, 1238, 1248,
+		1257, 1270, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	/* 9216 .. 9471 */
+	{
+		0, 1284, 1297, 1306, 1318, 1323, 1338, 1362, 1381, 1413, 1436, 1451, 1458, 1464, 1482, 1495,
+		1523, 1553, 1575, 1589, 1603, 1619, 1637, 1652, 1660, 1681, 1699, 1742, 1784, 1814, 1849, 1887,
+		1908, 1932, 1945, 1962, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	/* 9728 .. 9983 */
+	{
+		0, 1980, 2004, 2034, 2053, 2073, 2092, 2108, 2121, 2132, 2145, 2160, 2175, 2199, 2229, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	/* 9984 .. 10239 */
+	{
+		0, 2263, 2287, 0, 2310, 2319, 2336, 2354, 0, 2374, 2380, 2410, 2417, 2433, 2439, 0,
+		2465, 2477, 0, 0, 2506, 2535, 2549, 0, 2557, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2574, 2589, 2616, 2627, 0, 0, 0, 0,
+		0, 0, 2638, 2661, 2681, 0, 0, 0, 0, 0, 0, 0, 2694, 2718, 2746, 0,
+		0, 0, 0, 0, 0, 0, 2765, 2791, 2803, 2828, 2846, 2864, 2873, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2882, 2902, 2920, 2932, 2949,
+		0, 0, 0, 2967, 2991, 3016, 3026, 3041, 3059, 3080, 3093, 3116, 3139, 3149, 3172, 3182,
+		3195, 3221, 3241, 3254, 3287, 3303, 3314, 3323, 3336, 3350, 3371, 3387, 3408, 3419, 3438, 3450,
+		3469, 3481, 3493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+};
+
+const ITIS_TABLE itis_en =
+{
+	itis_en_dir,
+	&itis_en_page[0][0],
+	itis_en_str,
+	4,
+	sizeof(itis_en_str),
+	0,
+	0
+};
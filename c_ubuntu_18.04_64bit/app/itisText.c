@@ -0,0 +1,331 @@
+#include <DSRC.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "haeCommon.h"
+#include "itisText.h"
+
+static void sAppend(char *pBuf, size_t bufSize, size_t *pLen, const char *pText);
+static void sAppendCode(const ITIS_TABLE *pLocale, ITIScodes code, char *pBuf, size_t bufSize, size_t *pLen);
+static void sAppendItem(const ITIS_TABLE *pLocale, int isItis, ITIScodes code, const char *pText,
+						char *pBuf, size_t bufSize, size_t *pLen);
+static void sAppendContent(const ITIS_TABLE *pLocale, const TravelerDataFrame_content *pContent,
+						   char *pBuf, size_t bufSize, size_t *pLen);
+
+const char *ItisText_Lookup(const ITIS_TABLE *pTable, ITIScodes code)
+{
+	unsigned int page, off;
+
+	page = pTable->pDir[code >> 8];
+	if (0 == page)
+	{
+		return HAE_NULL;
+	}
+
+	off = pTable->pPage[(page - 1) * ITIS_PAGE_SIZE + (code & 0xff)];
+
+	return (0 == off) ? HAE_NULL : pTable->pStr + off;
+}
+
+/*************************************************************
+ *
+ * Function 		: ItisText_LoadPack
+ *
+ * Description	: Map a localisation pack built by itisPack
+ *
+ * Parameter	: pTable - filled on success
+ *				  pPath - pack file
+ *
+ * Returns		: HAE_OK / HAE_ERROR
+ *
+ * Notes		: The pack is validated once here so lookups need no
+ *				  bounds checks.
+ *
+ *************************************************************/
+int ItisText_LoadPack(ITIS_TABLE *pTable, const char *pPath)
+{
+	int fd;
+	unsigned int i;
+	size_t need;
+	struct stat st;
+	void *pMap;
+	const ITIS_PACK_HEADER *pHeader;
+	const unsigned int *pPage;
+	const char *pStr;
+
+	memset(pTable, 0, sizeof(ITIS_TABLE));
+
+	fd = open(pPath, O_RDONLY);
+	if (fd < 0)
+	{
+		perror("open ITIS pack");
+		return HAE_ERROR;
+	}
+
+	if ((fstat(fd, &st) < 0) || ((size_t)st.st_size < sizeof(ITIS_PACK_HEADER)))
+	{
+		close(fd);
+		printf("[ITIS] ERROR : %s is not an ITIS pack\n", pPath);
+		return HAE_ERROR;
+	}
+
+	pMap = mmap(HAE_NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (MAP_FAILED == pMap)
+	{
+		perror("mmap ITIS pack");
+		return HAE_ERROR;
+	}
+
+	pHeader = (const ITIS_PACK_HEADER *)pMap;
+	pPage = (const unsigned int *)(pHeader + 1);
+	pStr = (const char *)(pPage + (size_t)pHeader->pageCnt * ITIS_PAGE_SIZE);
+	need = sizeof(ITIS_PACK_HEADER) + (size_t)pHeader->pageCnt * ITIS_PAGE_SIZE * sizeof(unsigned int) + pHeader->strSize;
+
+	if ((0 != memcmp(pHeader->magic, ITIS_PACK_MAGIC, sizeof(pHeader->magic))) ||
+		(ITIS_PACK_VERSION != pHeader->version) || (ITIS_PACK_BOM != pHeader->bom) ||
+		(pHeader->pageCnt > ITIS_PAGE_CNT) || (0 == pHeader->strSize) ||
+		(need != (size_t)st.st_size) || ('\0' != pStr[pHeader->strSize - 1]))
+	{
+		munmap(pMap, st.st_size);
+		printf("[ITIS] ERROR : %s is not a valid ITIS pack\n", pPath);
+		return HAE_ERROR;
+	}
+
+	for (i = 0; i < ITIS_PAGE_CNT; i++)
+	{
+		if (pHeader->dir[i] > pHeader->pageCnt)
+		{
+			break;
+		}
+	}
+	for (need = 0; (i == ITIS_PAGE_CNT) && (need < (size_t)pHeader->pageCnt * ITIS_PAGE_SIZE); need++)
+	{
+		if (pPage[need] >= pHeader->strSize)
+		{
+			break;
+		}
+	}
+	if ((i != ITIS_PAGE_CNT) || (need != (size_t)pHeader->pageCnt * ITIS_PAGE_SIZE))
+	{
+		munmap(pMap, st.st_size);
+		printf("[ITIS] ERROR : %s has out of range entries\n", pPath);
+		return HAE_ERROR;
+	}
+
+	pTable->pDir = pHeader->dir;
+	pTable->pPage = pPage;
+	pTable->pStr = pStr;
+	pTable->pageCnt = pHeader->pageCnt;
+	pTable->strSize = pHeader->strSize;
+	pTable->pMap = pMap;
+	pTable->mapSize = st.st_size;
+
+	return HAE_OK;
+}
+
+void ItisText_UnloadPack(ITIS_TABLE *pTable)
+{
+	if (HAE_NULL != pTable->pMap)
+	{
+		munmap(pTable->pMap, pTable->mapSize);
+	}
+	memset(pTable, 0, sizeof(ITIS_TABLE));
+}
+
+int ItisText_RenderCode(const ITIS_TABLE *pLocale, ITIScodes code, char *pBuf, size_t bufSize)
+{
+	size_t len = 0;
+
+	if (bufSize > 0) pBuf[0] = '\0';
+	sAppendCode(pLocale, code, pBuf, bufSize, &len);
+
+	return (int)len;
+}
+
+int ItisText_RenderList(const ITIS_TABLE *pLocale, const ITIScodesAndText *pList, char *pBuf, size_t bufSize)
+{
+	size_t len = 0;
+	OSRTDListNode *pnode;
+	const ITIScodesAndText_element *pElem;
+
+	if (bufSize > 0) pBuf[0] = '\0';
+
+	for (pnode = pList->head; pnode != 0; pnode = pnode->next)
+	{
+		pElem = (const ITIScodesAndText_element *)pnode->data;
+
+		if (pnode != pList->head)
+		{
+			sAppend(pBuf, bufSize, &len, " ");
+		}
+		sAppendItem(pLocale, (T_ITIScodesAndText_element_item_itis == pElem->item.t), pElem->item.u.itis,
+					(T_ITIScodesAndText_element_item_text == pElem->item.t) ? (const char *)pElem->item.u.text : HAE_NULL,
+					pBuf, bufSize, &len);
+	}
+
+	return (int)len;
+}
+
+/* typeEvent followed by the description codes */
+int ItisText_RenderRsa(const ITIS_TABLE *pLocale, const RoadSideAlert *pRsa, char *pBuf, size_t bufSize)
+{
+	size_t len = 0, i;
+
+	if (bufSize > 0) pBuf[0] = '\0';
+
+	sAppendCode(pLocale, pRsa->typeEvent, pBuf, bufSize, &len);
+
+	if (pRsa->m.descriptionPresent)
+	{
+		for (i = 0; i < pRsa->description.n; i++)
+		{
+			sAppend(pBuf, bufSize, &len, " ");
+			sAppendCode(pLocale, pRsa->description.elem[i], pBuf, bufSize, &len);
+		}
+	}
+
+	return (int)len;
+}
+
+/* one line per TravelerDataFrame content */
+int ItisText_RenderTim(const ITIS_TABLE *pLocale, const TravelerInformation *pTim, char *pBuf, size_t bufSize)
+{
+	size_t len = 0;
+	OSRTDListNode *pnode;
+	const TravelerDataFrame *pFrame;
+
+	if (bufSize > 0) pBuf[0] = '\0';
+
+	for (pnode = pTim->dataFrames.head; pnode != 0; pnode = pnode->next)
+	{
+		pFrame = (const TravelerDataFrame *)pnode->data;
+
+		if (pnode != pTim->dataFrames.head)
+		{
+			sAppend(pBuf, bufSize, &len, "\n");
+		}
+
+		sAppendContent(pLocale, &pFrame->content, pBuf, bufSize, &len);
+	}
+
+	return (int)len;
+}
+
+/* WorkZone, GenericSignage, SpeedLimit and ExitService each have their
+   own generated element type with the same itis / text CHOICE */
+static void sAppendContent(const ITIS_TABLE *pLocale, const TravelerDataFrame_content *pContent,
+						   char *pBuf, size_t bufSize, size_t *pLen)
+{
+	OSRTDListNode *pnode;
+	const WorkZone_element *pWorkZone;
+	const GenericSignage_element *pSign;
+	const SpeedLimit_element *pSpeed;
+	const ExitService_element *pExit;
+
+	switch (pContent->t)
+	{
+		case T_TravelerDataFrame_content_advisory:
+			*pLen += ItisText_RenderList(pLocale, pContent->u.advisory, (*pLen < bufSize) ? pBuf + *pLen : HAE_NULL,
+										 (*pLen < bufSize) ? bufSize - *pLen : 0);
+			break;
+		case T_TravelerDataFrame_content_workZone:
+			for (pnode = pContent->u.workZone->head; pnode != 0; pnode = pnode->next)
+			{
+				pWorkZone = (const WorkZone_element *)pnode->data;
+				if (pnode != pContent->u.workZone->head) sAppend(pBuf, bufSize, pLen, " ");
+				sAppendItem(pLocale, (T_WorkZone_element_item_itis == pWorkZone->item.t), pWorkZone->item.u.itis,
+							(T_WorkZone_element_item_text == pWorkZone->item.t) ? pWorkZone->item.u.text : HAE_NULL,
+							pBuf, bufSize, pLen);
+			}
+			break;
+		case T_TravelerDataFrame_content_genericSign:
+			for (pnode = pContent->u.genericSign->head; pnode != 0; pnode = pnode->next)
+			{
+				pSign = (const GenericSignage_element *)pnode->data;
+				if (pnode != pContent->u.genericSign->head) sAppend(pBuf, bufSize, pLen, " ");
+				sAppendItem(pLocale, (T_GenericSignage_element_item_itis == pSign->item.t), pSign->item.u.itis,
+							(T_GenericSignage_element_item_text == pSign->item.t) ? pSign->item.u.text : HAE_NULL,
+							pBuf, bufSize, pLen);
+			}
+			break;
+		case T_TravelerDataFrame_content_speedLimit:
+			for (pnode = pContent->u.speedLimit->head; pnode != 0; pnode = pnode->next)
+			{
+				pSpeed = (const SpeedLimit_element *)pnode->data;
+				if (pnode != pContent->u.speedLimit->head) sAppend(pBuf, bufSize, pLen, " ");
+				sAppendItem(pLocale, (T_SpeedLimit_element_item_itis == pSpeed->item.t), pSpeed->item.u.itis,
+							(T_SpeedLimit_element_item_text == pSpeed->item.t) ? pSpeed->item.u.text : HAE_NULL,
+							pBuf, bufSize, pLen);
+			}
+			break;
+		case T_TravelerDataFrame_content_exitService:
+			for (pnode = pContent->u.exitService->head; pnode != 0; pnode = pnode->next)
+			{
+				pExit = (const ExitService_element *)pnode->data;
+				if (pnode != pContent->u.exitService->head) sAppend(pBuf, bufSize, pLen, " ");
+				sAppendItem(pLocale, (T_ExitService_element_item_itis == pExit->item.t), pExit->item.u.itis,
+							(T_ExitService_element_item_text == pExit->item.t) ? pExit->item.u.text : HAE_NULL,
+							pBuf, bufSize, pLen);
+			}
+			break;
+		default:
+			break;
+	}
+}
+
+/* one itis / text CHOICE, pText NULL unless it is the text alternative */
+static void sAppendItem(const ITIS_TABLE *pLocale, int isItis, ITIScodes code, const char *pText,
+						char *pBuf, size_t bufSize, size_t *pLen)
+{
+	if (isItis)
+	{
+		sAppendCode(pLocale, code, pBuf, bufSize, pLen);
+	}
+	else if (HAE_NULL != pText)
+	{
+		sAppend(pBuf, bufSize, pLen, pText);
+	}
+}
+
+static void sAppend(char *pBuf, size_t bufSize, size_t *pLen, const char *pText)
+{
+	size_t n = strlen(pText);
+
+	if (*pLen + 1 < bufSize)
+	{
+		size_t room = bufSize - *pLen - 1;
+		size_t copy = (n < room) ? n : room;
+
+		memcpy(pBuf + *pLen, pText, copy);
+		pBuf[*pLen + copy] = '\0';
+	}
+	*pLen += n;
+}
+
+static void sAppendCode(const ITIS_TABLE *pLocale, ITIScodes code, char *pBuf, size_t bufSize, size_t *pLen)
+{
+	char number[8];
+	const char *pText = HAE_NULL;
+
+	if (HAE_NULL != pLocale)
+	{
+		pText = ItisText_Lookup(pLocale, code);
+	}
+	if (HAE_NULL == pText)
+	{
+		pText = ItisText_Lookup(&itis_en, code);
+	}
+	if (HAE_NULL == pText)
+	{
+		snprintf(number, sizeof(number), "%u", (unsigned int)code);
+		pText = number;
+	}
+
+	sAppend(pBuf, bufSize, pLen, pText);
+}
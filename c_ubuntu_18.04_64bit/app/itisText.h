@@ -0,0 +1,54 @@
+#ifndef ITIS_TEXT_H
+#define ITIS_TEXT_H
+
+#include <stddef.h>
+#include <DSRC.h>
+
+#define ITIS_PAGE_CNT			256		/* code >> 8 */
+#define ITIS_PAGE_SIZE			256		/* code & 0xff */
+
+#define ITIS_PACK_MAGIC			"ITISPACK"
+#define ITIS_PACK_VERSION		1
+#define ITIS_PACK_BOM			0x01020304u
+
+/* Two level code -> phrase table. pDir[code >> 8] holds a page number
+   + 1 (0 = no page), the page holds offsets into pStr (0 = no phrase).
+   The compiled-in English table and memory-mapped localisation packs
+   share this layout, so a lookup is two array reads either way. */
+typedef struct{
+	const unsigned int *pDir;			/* [ITIS_PAGE_CNT] */
+	const unsigned int *pPage;			/* [pageCnt][ITIS_PAGE_SIZE] */
+	const char *pStr;					/* starts with a NUL, UTF-8 phrases */
+	unsigned int pageCnt;
+	unsigned int strSize;
+	void *pMap;							/* mmap'd pack, NULL for built-in tables */
+	size_t mapSize;
+} ITIS_TABLE;
+
+/* Localisation pack file, host byte order:
+   ITIS_PACK_HEADER, pageCnt pages of ITIS_PAGE_SIZE offsets, strings */
+typedef struct{
+	char magic[8];
+	unsigned int version;
+	unsigned int bom;
+	unsigned int pageCnt;
+	unsigned int strSize;
+	unsigned int dir[ITIS_PAGE_CNT];
+} ITIS_PACK_HEADER;
+
+extern const ITIS_TABLE itis_en;		/* itisTable.c, generated from ITIS.h */
+
+const char *ItisText_Lookup(const ITIS_TABLE *pTable, ITIScodes code);
+
+int ItisText_LoadPack(ITIS_TABLE *pTable, const char *pPath);
+void ItisText_UnloadPack(ITIS_TABLE *pTable);
+
+/* Renderers write at most bufSize bytes including the terminating NUL
+   and return the length of the full text, like snprintf. pLocale may
+   be NULL; missing phrases fall back to English, then to the number. */
+int ItisText_RenderCode(const ITIS_TABLE *pLocale, ITIScodes code, char *pBuf, size_t bufSize);
+int ItisText_RenderList(const ITIS_TABLE *pLocale, const ITIScodesAndText *pList, char *pBuf, size_t bufSize);
+int ItisText_RenderRsa(const ITIS_TABLE *pLocale, const RoadSideAlert *pRsa, char *pBuf, size_t bufSize);
+int ItisText_RenderTim(const ITIS_TABLE *pLocale, const TravelerInformation *pTim, char *pBuf, size_t bufSize);
+
+#endif
@@ -0,0 +1,749 @@
+#include <rtsrc/rtContext.h>
+#include <rtxsrc/rtxBuffer.h>
+#include <rtxsrc/rtxPrintStream.h>
+#include <rtxsrc/rtxError.h>
+#include <rtjsonsrc/osrtjson.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+
+#include "haeCommon.h"
+#include "jsonExport.h"
+
+static void sPrint(void *pPrntStrmInfo, const char *fmtspec, va_list arglist);
+static int sFormat(JSON_EXPORT *pExp, const char *fmtspec, va_list arglist);
+static void sLine(JSON_EXPORT *pExp, char *pLine, size_t len);
+static void sKey(JSON_EXPORT *pExp, const char *pName, size_t len);
+static void sValue(JSON_EXPORT *pExp, const char *pValue, size_t len);
+static void sBitString(JSON_EXPORT *pExp, const char *pValue, size_t len);
+static void sRaw(JSON_EXPORT *pExp, const char *pData, size_t len);
+static void sString(JSON_EXPORT *pExp, const char *pData, size_t len);
+static int sBatchAppend(JSON_EXPORT *pExp, const unsigned char *pData, size_t len);
+static void *sWriteThread(void *pArg);
+static void sWrite(JSON_EXPORT *pExp, const unsigned char *pData, size_t len);
+static int sOpenTarget(JSON_EXPORT *pExp, const char *pTarget);
+
+/*************************************************************
+ *
+ * Function 		: JsonExport_Open
+ *
+ * Description	: Open the target and start the writer thread.
+ *
+ * Parameter	: pTarget - "-" stdout, "tcp:a.b.c.d:port" a TCP
+ *				  connection, anything else a file opened for append
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int JsonExport_Open(JSON_EXPORT *pExp, const char *pTarget)
+{
+	pthread_condattr_t attr;
+
+	memset(pExp, 0x00, sizeof(JSON_EXPORT));
+	pExp->fd = -1;
+
+	if (0 != rtInitContext(&pExp->ctxt))
+	{
+		printf("[JSON] ERROR : rtInitContext() for export\n");
+		return HAE_ERROR;
+	}
+	/* dynamic output buffer, kept between records */
+	rtxInitContextBuffer(&pExp->ctxt, HAE_NULL, 0);
+	rtxSetPrintStream(&pExp->ctxt, sPrint, pExp);
+
+	if (HAE_OK != sOpenTarget(pExp, pTarget))
+	{
+		rtFreeContext(&pExp->ctxt);
+		return HAE_ERROR;
+	}
+
+	pthread_mutex_init(&pExp->lock, HAE_NULL);
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&pExp->wake, &attr);
+	pthread_condattr_destroy(&attr);
+
+	pExp->running = HAE_TRUE;
+	if (0 != pthread_create(&pExp->thread, HAE_NULL, sWriteThread, pExp))
+	{
+		printf("[JSON] ERROR : pthread_create() for writer\n");
+		pExp->running = HAE_FALSE;
+		JsonExport_Close(pExp);
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: JsonExport_Close
+ *
+ * Description	: Write what is pending, stop the writer thread and
+ *				  close the target.
+ *
+ *************************************************************/
+void JsonExport_Close(JSON_EXPORT *pExp)
+{
+	if (HAE_TRUE == pExp->running)
+	{
+		pthread_mutex_lock(&pExp->lock);
+		pExp->running = HAE_FALSE;
+		pthread_cond_signal(&pExp->wake);
+		pthread_mutex_unlock(&pExp->lock);
+		pthread_join(pExp->thread, HAE_NULL);
+	}
+	pthread_mutex_destroy(&pExp->lock);
+	pthread_cond_destroy(&pExp->wake);
+
+	if ((pExp->fd >= 0) && pExp->ownFd)
+	{
+		close(pExp->fd);
+	}
+	pExp->fd = -1;
+
+	free(pExp->pending.pData);
+	free(pExp->spare.pData);
+	memset(&pExp->pending, 0x00, sizeof(JSON_BATCH));
+	memset(&pExp->spare, 0x00, sizeof(JSON_BATCH));
+
+	rtFreeContext(&pExp->ctxt);
+}
+
+/*************************************************************
+ *
+ * Function 		: JsonExport_Message
+ *
+ * Description	: Queue one decoded message as a JSON record.
+ *
+ * Parameter	: messageId - DSRCmsgID of the MessageFrame
+ *				  pType, pValue - decoded value
+ *				  len - octets of the encoded value
+ *				  pRxTime - receive time, CLOCK_REALTIME
+ *				  pSource - sender, may be NULL
+ *
+ * Returns		: HAE_OK, HAE_ERROR if the record was not queued
+ *
+ *************************************************************/
+int JsonExport_Message(JSON_EXPORT *pExp, unsigned int messageId, const ASN_TYPE *pType, const void *pValue,
+	size_t len, const struct timespec *pRxTime, const struct sockaddr_in *pSource)
+{
+	OSCTXT *pctxt = &pExp->ctxt;
+	char text[64];
+	char addr[INET_ADDRSTRLEN];
+	int n;
+
+	pctxt->buffer.byteIndex = 0;
+	pExp->convStatus = HAE_OK;
+	pExp->lineLen = 0;
+
+	/* envelope, "msg" follows as the 6th member of depth 0 */
+	sRaw(pExp, "{\"rxNs\":", 8);
+	rtJsonEncUInt64Value(pctxt, (OSUINT64)pRxTime->tv_sec * 1000000000ULL + (OSUINT64)pRxTime->tv_nsec);
+	if (HAE_NULL != pSource)
+	{
+		inet_ntop(AF_INET, &pSource->sin_addr, addr, sizeof(addr));
+		n = snprintf(text, sizeof(text), "%s:%u", addr, ntohs(pSource->sin_port));
+		sRaw(pExp, ",\"src\":", 7);
+		sString(pExp, text, n);
+	}
+	n = snprintf(text, sizeof(text), ",\"id\":%u,\"type\":", messageId);
+	sRaw(pExp, text, n);
+	sString(pExp, pType->pName, strlen(pType->pName));
+	n = snprintf(text, sizeof(text), ",\"len\":%zu", len);
+	sRaw(pExp, text, n);
+
+	pExp->depth = 0;
+	pExp->level[0].memberCnt = 1;
+	pExp->level[0].inArray = HAE_FALSE;
+	if (0 != pType->pfPrint(pctxt, "msg", pValue))
+	{
+		pExp->convStatus = HAE_ERROR;
+	}
+	if (pExp->lineLen > 0)
+	{
+		sLine(pExp, pExp->line, pExp->lineLen);
+		pExp->lineLen = 0;
+	}
+	if (0 != pExp->depth)
+	{
+		pExp->convStatus = HAE_ERROR;
+	}
+	sRaw(pExp, "}\n", 2);
+
+	if (HAE_OK != pExp->convStatus)
+	{
+		pExp->errorCnt++;
+		rtxErrReset(pctxt);
+		printf("[JSON] ERROR : conversion of %s failed\n", pType->pName);
+		return HAE_ERROR;
+	}
+
+	return sBatchAppend(pExp, pctxt->buffer.data, pctxt->buffer.byteIndex);
+}
+
+/* print stream of the context: the printer hands over fragments (indent,
+   name, value, ...), complete lines are converted */
+static void sPrint(void *pPrntStrmInfo, const char *fmtspec, va_list arglist)
+{
+	JSON_EXPORT *pExp = (JSON_EXPORT *)pPrntStrmInfo;
+	size_t start = pExp->lineLen;
+	char *pStart, *pEnd;
+
+	/* indent, one " " per call, is dropped at the start of a line */
+	if ((0 == pExp->lineLen) && (' ' == fmtspec[0]) && ('\0' == fmtspec[1]))
+	{
+		return;
+	}
+	if (HAE_OK != sFormat(pExp, fmtspec, arglist))
+	{
+		return;
+	}
+
+	pStart = pExp->line + start;
+	while (HAE_NULL != (pEnd = memchr(pStart, '\n', pExp->line + pExp->lineLen - pStart)))
+	{
+		sLine(pExp, pExp->line, pEnd - pExp->line);
+		pExp->lineLen -= pEnd + 1 - pExp->line;
+		memmove(pExp->line, pEnd + 1, pExp->lineLen);
+		pStart = pExp->line;
+	}
+}
+
+/* %s, %d, %u and %02x are what the printer uses, by hand they cost a
+   fraction of vsnprintf; any other conversion goes to vsnprintf */
+static int sFormat(JSON_EXPORT *pExp, const char *fmtspec, va_list arglist)
+{
+	static const char hex[] = "0123456789abcdef";
+	char *pOut = pExp->line + pExp->lineLen;
+	char *pMax = pExp->line + JSON_EXPORT_LINE_MAX - 1;
+	char digits[12];
+	const char *p, *pStr;
+	unsigned int u;
+	size_t n, room;
+	va_list copy;
+	int i, d;
+
+	va_copy(copy, arglist);
+	for (p = fmtspec; *p != '\0'; p++)
+	{
+		if ('%' != *p)
+		{
+			if (pOut < pMax)
+			{
+				*pOut++ = *p;
+			}
+			continue;
+		}
+
+		p++;
+		if ('s' == *p)
+		{
+			pStr = va_arg(arglist, const char *);
+			n = strlen(pStr);
+			if (n > (size_t)(pMax - pOut))
+			{
+				n = pMax - pOut;
+			}
+			memcpy(pOut, pStr, n);
+			pOut += n;
+		}
+		else if (('d' == *p) || ('u' == *p))
+		{
+			if ('d' == *p)
+			{
+				d = va_arg(arglist, int);
+				u = (d < 0) ? 0u - (unsigned int)d : (unsigned int)d;
+				if ((d < 0) && (pOut < pMax))
+				{
+					*pOut++ = '-';
+				}
+			}
+			else
+			{
+				u = va_arg(arglist, unsigned int);
+			}
+			i = 0;
+			do
+			{
+				digits[i++] = (char)('0' + u % 10);
+				u /= 10;
+			} while (u > 0);
+			while ((i > 0) && (pOut < pMax))
+			{
+				*pOut++ = digits[--i];
+			}
+		}
+		else if (('0' == p[0]) && ('2' == p[1]) && ('x' == p[2]))
+		{
+			p += 2;
+			u = va_arg(arglist, unsigned int);
+			if (pOut + 2 <= pMax)
+			{
+				*pOut++ = hex[(u >> 4) & 0x0f];
+				*pOut++ = hex[u & 0x0f];
+			}
+		}
+		else
+		{
+			room = JSON_EXPORT_LINE_MAX - pExp->lineLen;
+			i = vsnprintf(pExp->line + pExp->lineLen, room, fmtspec, copy);
+			va_end(copy);
+			if (i < 0)
+			{
+				return HAE_ERROR;
+			}
+			pExp->lineLen += ((size_t)i < room) ? (size_t)i : room - 1;
+			return HAE_OK;
+		}
+	}
+	va_end(copy);
+
+	pExp->lineLen = pOut - pExp->line;
+
+	return HAE_OK;
+}
+
+/* "name {", "}", "name = value", name may be "name[i]" */
+static void sLine(JSON_EXPORT *pExp, char *pLine, size_t len)
+{
+	JSON_LEVEL *pLevel;
+	char *pEq;
+
+	while ((len > 0) && (' ' == *pLine))
+	{
+		pLine++;
+		len--;
+	}
+	while ((len > 0) && ((' ' == pLine[len - 1]) || ('\r' == pLine[len - 1])))
+	{
+		len--;
+	}
+	if (0 == len)
+	{
+		return;
+	}
+
+	if ((1 == len) && ('}' == pLine[0]))
+	{
+		pLevel = &pExp->level[pExp->depth];
+		if (0 == pExp->depth)
+		{
+			pExp->convStatus = HAE_ERROR;
+			return;
+		}
+		if (pLevel->inArray)
+		{
+			sRaw(pExp, "]", 1);
+		}
+		sRaw(pExp, "}", 1);
+		pExp->depth--;
+		return;
+	}
+
+	pLine[len] = '\0';
+	pEq = strstr(pLine, " = ");
+	if ((HAE_NULL == pEq) && (len >= 2) && (' ' == pLine[len - 2]) && ('{' == pLine[len - 1]))
+	{
+		if (pExp->depth + 1 >= JSON_EXPORT_DEPTH_MAX)
+		{
+			pExp->convStatus = HAE_ERROR;
+			return;
+		}
+		sKey(pExp, pLine, len - 2);
+		sRaw(pExp, "{", 1);
+		pExp->depth++;
+		pExp->level[pExp->depth].memberCnt = 0;
+		pExp->level[pExp->depth].inArray = HAE_FALSE;
+	}
+	else if (HAE_NULL != pEq)
+	{
+		sKey(pExp, pLine, pEq - pLine);
+		sValue(pExp, pEq + 3, len - (pEq + 3 - pLine));
+	}
+	/* anything else is not printer output, skipped */
+}
+
+/* member name; the elements name[0], name[1], ... of a SEQUENCE OF
+   follow each other and share one "name":[ */
+static void sKey(JSON_EXPORT *pExp, const char *pName, size_t len)
+{
+	JSON_LEVEL *pLevel = &pExp->level[pExp->depth];
+	const char *pIndex = memchr(pName, '[', len);
+	size_t nameLen = (HAE_NULL != pIndex) ? (size_t)(pIndex - pName) : len;
+
+	if (pLevel->inArray)
+	{
+		if ((HAE_NULL != pIndex) && (nameLen == strlen(pLevel->arrayName)) &&
+			(0 == memcmp(pName, pLevel->arrayName, nameLen)))
+		{
+			sRaw(pExp, ",", 1);
+			return;
+		}
+		sRaw(pExp, "]", 1);
+		pLevel->inArray = HAE_FALSE;
+	}
+
+	if (pLevel->memberCnt++ > 0)
+	{
+		sRaw(pExp, ",", 1);
+	}
+	sString(pExp, pName, nameLen);
+	sRaw(pExp, ":", 1);
+
+	if (HAE_NULL != pIndex)
+	{
+		sRaw(pExp, "[", 1);
+		if (nameLen >= JSON_EXPORT_NAME_MAX)
+		{
+			nameLen = JSON_EXPORT_NAME_MAX - 1;
+		}
+		memcpy(pLevel->arrayName, pName, nameLen);
+		pLevel->arrayName[nameLen] = '\0';
+		pLevel->inArray = HAE_TRUE;
+	}
+}
+
+static void sValue(JSON_EXPORT *pExp, const char *pValue, size_t len)
+{
+	size_t i = 0;
+
+	if ((len >= 2) && ('\'' == pValue[0]) && ('\'' == pValue[len - 1]))
+	{
+		sString(pExp, pValue + 1, len - 2);
+		return;
+	}
+	if ((len >= 2) && ('0' == pValue[0]) && ('x' == pValue[1]))
+	{
+		/* OCTET STRING / open type, hex digits */
+		sString(pExp, pValue + 2, len - 2);
+		return;
+	}
+	if ('{' == pValue[0])
+	{
+		sBitString(pExp, pValue, len);
+		return;
+	}
+	if ((4 == len) && (0 == memcmp(pValue, "TRUE", 4)))
+	{
+		rtJsonEncBoolValue(&pExp->ctxt, TRUE);
+		return;
+	}
+	if ((5 == len) && (0 == memcmp(pValue, "FALSE", 5)))
+	{
+		rtJsonEncBoolValue(&pExp->ctxt, FALSE);
+		return;
+	}
+
+	/* INTEGER: -?[0-9]+, anything else (ENUMERATED, NULL) as a string */
+	if ('-' == pValue[0])
+	{
+		i++;
+	}
+	if (i < len)
+	{
+		while ((i < len) && (pValue[i] >= '0') && (pValue[i] <= '9'))
+		{
+			i++;
+		}
+		if (i == len)
+		{
+			sRaw(pExp, pValue, len);
+			return;
+		}
+	}
+	sString(pExp, pValue, len);
+}
+
+/* "{ 10, 39 00xxxxxx }": bit count, whole octets in hex, then the last
+   octet bit by bit with x for the unused bits -> "0011100100" */
+static void sBitString(JSON_EXPORT *pExp, const char *pValue, size_t len)
+{
+	char bits[JSON_EXPORT_LINE_MAX];
+	unsigned long numbits;
+	size_t i, j, cnt = 0;
+	unsigned int octet;
+	char *pEnd;
+
+	numbits = strtoul(pValue + 1, &pEnd, 10);
+	i = pEnd - pValue;
+	if ((i >= len) || (',' != pValue[i]))
+	{
+		sString(pExp, pValue, len);
+		return;
+	}
+	if (numbits > sizeof(bits))
+	{
+		numbits = sizeof(bits);
+	}
+
+	for (i++; (i < len) && (cnt < numbits); )
+	{
+		if ((' ' == pValue[i]) || ('}' == pValue[i]))
+		{
+			i++;
+			continue;
+		}
+		for (j = i; (j < len) && (' ' != pValue[j]) && ('}' != pValue[j]); j++)
+		{
+		}
+		if (2 == j - i)
+		{
+			octet = (unsigned int)strtoul(&pValue[i], HAE_NULL, 16);
+			for (j = 0; (j < 8) && (cnt < numbits); j++)
+			{
+				bits[cnt++] = (octet & (0x80 >> j)) ? '1' : '0';
+			}
+			i += 2;
+		}
+		else
+		{
+			for (; (i < j) && (cnt < numbits); i++)
+			{
+				if (('0' == pValue[i]) || ('1' == pValue[i]))
+				{
+					bits[cnt++] = pValue[i];
+				}
+			}
+			i = j;
+		}
+	}
+
+	sString(pExp, bits, cnt);
+}
+
+static void sRaw(JSON_EXPORT *pExp, const char *pData, size_t len)
+{
+	if (0 != rtxWriteBytes(&pExp->ctxt, (const OSOCTET *)pData, len))
+	{
+		pExp->convStatus = HAE_ERROR;
+	}
+}
+
+/* quoted and escaped; rtJsonEncStringValue2 leaves control characters
+   as they are, which IA5String values may carry */
+static void sString(JSON_EXPORT *pExp, const char *pData, size_t len)
+{
+	static const char hex[] = "0123456789abcdef";
+	char esc[6] = { '\\', 'u', '0', '0', 0, 0 };
+	size_t i, start = 0;
+	unsigned char c;
+
+	sRaw(pExp, "\"", 1);
+	for (i = 0; i < len; i++)
+	{
+		c = (unsigned char)pData[i];
+		if ((c >= 0x20) && ('"' != c) && ('\\' != c))
+		{
+			continue;
+		}
+		sRaw(pExp, pData + start, i - start);
+		if (c >= 0x20)
+		{
+			esc[1] = c;
+			sRaw(pExp, esc, 2);
+		}
+		else
+		{
+			esc[1] = 'u';
+			esc[4] = hex[c >> 4];
+			esc[5] = hex[c & 0x0f];
+			sRaw(pExp, esc, 6);
+		}
+		start = i + 1;
+	}
+	sRaw(pExp, pData + start, len - start);
+	sRaw(pExp, "\"", 1);
+}
+
+static int sBatchAppend(JSON_EXPORT *pExp, const unsigned char *pData, size_t len)
+{
+	JSON_BATCH *pBatch = &pExp->pending;
+	unsigned char *pNew;
+	size_t size;
+
+	pthread_mutex_lock(&pExp->lock);
+
+	if (pBatch->len + len > pBatch->size)
+	{
+		if (pBatch->len + len > JSON_EXPORT_PENDING_MAX)
+		{
+			pExp->dropCnt++;
+			pthread_mutex_unlock(&pExp->lock);
+			return HAE_ERROR;
+		}
+		size = (pBatch->size > 0) ? pBatch->size * 2 : JSON_EXPORT_BATCH * 2;
+		while (size < pBatch->len + len)
+		{
+			size *= 2;
+		}
+		if (HAE_NULL == (pNew = realloc(pBatch->pData, size)))
+		{
+			pExp->dropCnt++;
+			pthread_mutex_unlock(&pExp->lock);
+			return HAE_ERROR;
+		}
+		pBatch->pData = pNew;
+		pBatch->size = size;
+	}
+
+	memcpy(pBatch->pData + pBatch->len, pData, len);
+	pBatch->len += len;
+	pExp->recordCnt++;
+	if (pBatch->len >= JSON_EXPORT_BATCH)
+	{
+		pthread_cond_signal(&pExp->wake);
+	}
+
+	pthread_mutex_unlock(&pExp->lock);
+
+	return HAE_OK;
+}
+
+/* waits for JSON_EXPORT_BATCH bytes or JSON_EXPORT_FLUSH_MS, swaps the
+   pending batch with the spare one and writes it without the lock */
+static void *sWriteThread(void *pArg)
+{
+	JSON_EXPORT *pExp = (JSON_EXPORT *)pArg;
+	JSON_BATCH batch;
+	struct timespec deadline;
+	int rc;
+
+	pthread_mutex_lock(&pExp->lock);
+	for (;;)
+	{
+		clock_gettime(CLOCK_MONOTONIC, &deadline);
+		deadline.tv_nsec += JSON_EXPORT_FLUSH_MS * 1000000L;
+		if (deadline.tv_nsec >= 1000000000L)
+		{
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000L;
+		}
+		rc = 0;
+		while (pExp->running && (pExp->pending.len < JSON_EXPORT_BATCH) && (ETIMEDOUT != rc))
+		{
+			rc = pthread_cond_timedwait(&pExp->wake, &pExp->lock, &deadline);
+		}
+
+		if (0 == pExp->pending.len)
+		{
+			if (!pExp->running)
+			{
+				break;
+			}
+			continue;
+		}
+
+		batch = pExp->pending;
+		pExp->pending = pExp->spare;
+		pExp->spare = batch;
+		pthread_mutex_unlock(&pExp->lock);
+
+		sWrite(pExp, pExp->spare.pData, pExp->spare.len);
+		pExp->spare.len = 0;
+
+		pthread_mutex_lock(&pExp->lock);
+	}
+	pthread_mutex_unlock(&pExp->lock);
+
+	return HAE_NULL;
+}
+
+static void sWrite(JSON_EXPORT *pExp, const unsigned char *pData, size_t len)
+{
+	ssize_t n;
+
+	while (len > 0)
+	{
+		if (pExp->isSocket)
+		{
+			n = send(pExp->fd, pData, len, MSG_NOSIGNAL);
+		}
+		else
+		{
+			n = write(pExp->fd, pData, len);
+		}
+		if (n < 0)
+		{
+			if (EINTR == errno)
+			{
+				continue;
+			}
+			pExp->writeErrorCnt++;
+			printf("[JSON] ERROR : write of %zu bytes failed (%s)\n", len, strerror(errno));
+			return;
+		}
+		pData += n;
+		len -= n;
+		pExp->writeBytes += n;
+	}
+}
+
+static int sOpenTarget(JSON_EXPORT *pExp, const char *pTarget)
+{
+	struct sockaddr_in addr;
+	char host[INET_ADDRSTRLEN];
+	const char *pPort;
+	size_t len;
+
+	if (0 == strcmp(pTarget, "-"))
+	{
+		pExp->fd = STDOUT_FILENO;
+		pExp->ownFd = HAE_FALSE;
+		return HAE_OK;
+	}
+
+	if (0 == strncmp(pTarget, "tcp:", 4))
+	{
+		pTarget += 4;
+		pPort = strrchr(pTarget, ':');
+		len = (HAE_NULL != pPort) ? (size_t)(pPort - pTarget) : 0;
+		memset(&addr, 0x00, sizeof(addr));
+		addr.sin_family = AF_INET;
+		if ((0 == len) || (len >= sizeof(host)))
+		{
+			printf("[JSON] ERROR : target tcp:%s is not tcp:a.b.c.d:port\n", pTarget);
+			return HAE_ERROR;
+		}
+		memcpy(host, pTarget, len);
+		host[len] = '\0';
+		addr.sin_port = htons((unsigned short)atoi(pPort + 1));
+		if (1 != inet_pton(AF_INET, host, &addr.sin_addr))
+		{
+			printf("[JSON] ERROR : target tcp:%s is not tcp:a.b.c.d:port\n", pTarget);
+			return HAE_ERROR;
+		}
+
+		pExp->fd = socket(AF_INET, SOCK_STREAM, 0);
+		if ((pExp->fd < 0) || (0 != connect(pExp->fd, (struct sockaddr *)&addr, sizeof(addr))))
+		{
+			printf("[JSON] ERROR : connect to %s failed (%s)\n", pTarget, strerror(errno));
+			if (pExp->fd >= 0)
+			{
+				close(pExp->fd);
+			}
+			pExp->fd = -1;
+			return HAE_ERROR;
+		}
+		pExp->isSocket = HAE_TRUE;
+		pExp->ownFd = HAE_TRUE;
+		return HAE_OK;
+	}
+
+	pExp->fd = open(pTarget, O_WRONLY | O_CREAT | O_APPEND, 0644);
+	if (pExp->fd < 0)
+	{
+		printf("[JSON] ERROR : open of %s failed (%s)\n", pTarget, strerror(errno));
+		return HAE_ERROR;
+	}
+	pExp->ownFd = HAE_TRUE;
+
+	return HAE_OK;
+}
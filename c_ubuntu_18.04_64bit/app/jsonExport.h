@@ -0,0 +1,81 @@
+#ifndef JSON_EXPORT_H
+#define JSON_EXPORT_H
+
+#include <rtxsrc/rtxContext.h>
+
+#include <pthread.h>
+#include <time.h>
+#include <netinet/in.h>
+
+#include "asnType.h"
+
+/* Newline delimited JSON export of decoded messages, one record per line:
+
+   {"rxNs":1760870222000000000,"src":"10.0.0.5:60000","id":19,"type":"SPAT","len":181,"msg":{...}}
+
+   rxNs is the receive time (CLOCK_REALTIME, ns), len the octets of the
+   value inside the MessageFrame. The generated library has no JSON
+   encoders, so "msg" is built from the asn1PrtToStrm_ output of the type:
+   the print stream of the exporter's context turns each printed line
+   into JSON while it is printed (SEQUENCE / CHOICE -> object, SEQUENCE OF
+   -> array, INTEGER -> number, BOOLEAN -> true / false, everything else
+   -> string, BIT STRING as "0101..."). Records are built in the context's
+   output buffer, which grows to the largest record and is reused, and
+   copied into the pending batch; a writer thread swaps the batch for
+   the spare one and writes it to the target in one call.
+
+   JsonExport_Message is called from one thread, the receive loop. */
+
+#define JSON_EXPORT_LINE_MAX		8192		/* one printed line, longer values are cut */
+#define JSON_EXPORT_DEPTH_MAX		32
+#define JSON_EXPORT_NAME_MAX		64
+#define JSON_EXPORT_BATCH			65536		/* pending bytes that wake the writer */
+#define JSON_EXPORT_PENDING_MAX		(16 * 1024 * 1024)	/* above this records are dropped */
+#define JSON_EXPORT_FLUSH_MS		100			/* max age of a pending record */
+
+typedef struct{
+	unsigned int memberCnt;
+	unsigned char inArray;
+	char arrayName[JSON_EXPORT_NAME_MAX];	/* open "name":[ of name[i] lines */
+} JSON_LEVEL;
+
+typedef struct{
+	unsigned char *pData;
+	size_t len;
+	size_t size;
+} JSON_BATCH;
+
+typedef struct{
+	OSCTXT ctxt;						/* print stream and record buffer */
+	int fd;
+	unsigned char isSocket;
+	unsigned char ownFd;
+
+	/* print stream -> JSON */
+	char line[JSON_EXPORT_LINE_MAX];
+	size_t lineLen;
+	unsigned int depth;
+	JSON_LEVEL level[JSON_EXPORT_DEPTH_MAX];
+	int convStatus;
+
+	/* writer thread */
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	volatile int running;
+	JSON_BATCH pending;					/* filled by JsonExport_Message */
+	JSON_BATCH spare;					/* written by the writer thread */
+
+	unsigned long recordCnt;			/* records queued */
+	unsigned long errorCnt;				/* records that could not be converted */
+	unsigned long dropCnt;				/* records dropped, writer behind */
+	unsigned long long writeBytes;
+	unsigned long writeErrorCnt;
+} JSON_EXPORT;
+
+int JsonExport_Open(JSON_EXPORT *pExp, const char *pTarget);
+void JsonExport_Close(JSON_EXPORT *pExp);
+int JsonExport_Message(JSON_EXPORT *pExp, unsigned int messageId, const ASN_TYPE *pType, const void *pValue,
+	size_t len, const struct timespec *pRxTime, const struct sockaddr_in *pSource);
+
+#endif
@@ -0,0 +1,893 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "msgArchive.h"
+
+#define ARCHIVE_KEY_TEMP_ID			0
+#define ARCHIVE_KEY_INTERSECTION	1
+
+/* bit cursor of the peek, UPER is most significant bit first */
+typedef struct{
+	const unsigned char *pData;
+	size_t bitLen;
+	size_t pos;
+} ARCHIVE_BITS;
+
+static void sTakeIds(ARCHIVE_WRITER *pWriter, unsigned int messageId, const unsigned char *pValue, size_t len, unsigned int seq);
+static int sPeekTempId(unsigned int messageId, const unsigned char *pValue, size_t len, unsigned int *pKey);
+static int sPeekIntersection(unsigned int messageId, const unsigned char *pValue, size_t len, unsigned int *pKey);
+static int sDecodeIntersections(ARCHIVE_WRITER *pWriter, unsigned int messageId, const unsigned char *pValue, size_t len,
+	unsigned int seq);
+static int sBits(ARCHIVE_BITS *pBits, unsigned int n, unsigned int *pVal);
+static int sSkipName(ARCHIVE_BITS *pBits);
+static int sPeekReferenceId(ARCHIVE_BITS *pBits, unsigned int *pKey);
+static int sAddKey(ARCHIVE_WRITER *pWriter, int kind, unsigned int key, unsigned int seq);
+static int sGrow(void **ppArray, unsigned int *pSize, unsigned int need, size_t elemSize);
+static int sCompareEntry(const void *pA, const void *pB);
+static int sComparePosting(const void *pA, const void *pB);
+static int sWriteAll(int fd, const unsigned char *pData, size_t len);
+static int sQueryBlock(ARCHIVE_READER *pReader, const unsigned char *pBlock, const ARCHIVE_BLOCK_HDR *pHdr,
+	const ARCHIVE_QUERY *pQuery, ARCHIVE_MATCH_FUNC pfMatch, void *pArg);
+static int sQueryPostings(ARCHIVE_READER *pReader, const unsigned char *pBlock, const ARCHIVE_BLOCK_HDR *pHdr,
+	const ARCHIVE_QUERY *pQuery, ARCHIVE_MATCH_FUNC pfMatch, void *pArg);
+static int sQueryMessage(ARCHIVE_READER *pReader, const unsigned char *pBlock, const ARCHIVE_BLOCK_HDR *pHdr,
+	unsigned int messageId, const ARCHIVE_QUERY *pQuery, ARCHIVE_MATCH_FUNC pfMatch, void *pArg);
+static int sRecordAt(const unsigned char *pBlock, const ARCHIVE_BLOCK_HDR *pHdr, unsigned int offset, ARCHIVE_RECORD *pRecord);
+
+/*************************************************************
+ *
+ * Function 		: MsgArchive_OpenWriter
+ *
+ * Description	: Open an archive for ingest, new blocks go after the
+ *				  ones already in the file.
+ *
+ * Parameter	: blockSec - time span of a block, 0 for
+ *				  ARCHIVE_BLOCK_SEC
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int MsgArchive_OpenWriter(ARCHIVE_WRITER *pWriter, const char *pPath, unsigned int blockSec)
+{
+	memset(pWriter, 0x00, sizeof(ARCHIVE_WRITER));
+	pWriter->blockNs = (unsigned long long)((0 != blockSec) ? blockSec : ARCHIVE_BLOCK_SEC) * 1000000000ULL;
+
+	pWriter->fd = open(pPath, O_WRONLY | O_CREAT | O_APPEND, 0644);
+	if (pWriter->fd < 0)
+	{
+		printf("[ARCHIVE] ERROR : cannot open %s (%s)\n", pPath, strerror(errno));
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: MsgArchive_Append
+ *
+ * Description	: Add one UPER MessageFrame. The open block is sealed
+ *				  first when timeNs is in the next time span or the
+ *				  block is full. TemporaryID and IntersectionReferenceID
+ *				  are taken here.
+ *
+ * Parameter	: timeNs - CLOCK_REALTIME of the receive
+ *
+ * Returns		: HAE_OK, HAE_ERROR if it is no MessageFrame
+ *
+ *************************************************************/
+int MsgArchive_Append(ARCHIVE_WRITER *pWriter, unsigned long long timeNs, const unsigned char *pFrame, unsigned int len)
+{
+	ARCHIVE_REC_HDR *pHdr;
+	ARCHIVE_ENTRY *pEntry;
+	unsigned int messageId;
+	size_t offset, length, recSize;
+
+	if ((pWriter->fd < 0) || (len > ARCHIVE_FRAME_MAX) ||
+		(HAE_OK != AsnType_PerFrameHeader(pFrame, len, &messageId, &offset, &length)))
+	{
+		return HAE_ERROR;
+	}
+	recSize = (sizeof(ARCHIVE_REC_HDR) + len + ARCHIVE_ALIGN - 1) & ~(size_t)(ARCHIVE_ALIGN - 1);
+
+	if ((0 != pWriter->entryCnt) && ((timeNs / pWriter->blockNs != pWriter->blockStartNs / pWriter->blockNs) ||
+		(pWriter->dataLen + recSize > ARCHIVE_BLOCK_BYTES)))
+	{
+		if (HAE_OK != MsgArchive_Seal(pWriter))
+		{
+			return HAE_ERROR;
+		}
+	}
+	if (0 == pWriter->entryCnt)
+	{
+		pWriter->blockStartNs = timeNs;
+	}
+
+	if (pWriter->dataLen + recSize > pWriter->dataSize)
+	{
+		/* one block at most, it does not grow past ARCHIVE_BLOCK_BYTES */
+		pWriter->pData = realloc(pWriter->pData, ARCHIVE_BLOCK_BYTES);
+		if (HAE_NULL == pWriter->pData)
+		{
+			printf("[ARCHIVE] ERROR : no memory for a block\n");
+			return HAE_ERROR;
+		}
+		pWriter->dataSize = ARCHIVE_BLOCK_BYTES;
+	}
+	if (HAE_OK != sGrow((void **)&pWriter->pEntry, &pWriter->entrySize, pWriter->entryCnt + 1, sizeof(ARCHIVE_ENTRY)))
+	{
+		return HAE_ERROR;
+	}
+
+	pHdr = (ARCHIVE_REC_HDR *)(pWriter->pData + pWriter->dataLen);
+	pHdr->timeNs = timeNs;
+	pHdr->messageId = messageId;
+	pHdr->len = len;
+	memcpy(pHdr + 1, pFrame, len);
+	memset((unsigned char *)(pHdr + 1) + len, 0x00, recSize - sizeof(ARCHIVE_REC_HDR) - len);
+
+	pEntry = &pWriter->pEntry[pWriter->entryCnt];
+	pEntry->timeNs = timeNs;
+	pEntry->messageId = messageId;
+	pEntry->seq = pWriter->entryCnt;
+	pEntry->pos = pWriter->dataLen;
+	sTakeIds(pWriter, messageId, pFrame + offset, length, pEntry->seq);
+
+	pWriter->dataLen += recSize;
+	pWriter->entryCnt++;
+	pWriter->recordCnt++;
+	pWriter->byteCnt += len;
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: MsgArchive_Seal
+ *
+ * Description	: Sort the open block by (messageId, time), build its
+ *				  indexes and write it with one write().
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int MsgArchive_Seal(ARCHIVE_WRITER *pWriter)
+{
+	ARCHIVE_BLOCK_HDR *pHdr;
+	ARCHIVE_SPARSE *pSparse;
+	ARCHIVE_POSTING *pPosting;
+	ARCHIVE_ENTRY *pEntry;
+	ARCHIVE_REC_HDR *pRec;
+	unsigned int *pOffset;
+	unsigned char *pOut;
+	unsigned int i, k, sparseCnt, run;
+	size_t recSize, total, pos;
+	int ret;
+
+	if (0 == pWriter->entryCnt)
+	{
+		return HAE_OK;
+	}
+	qsort(pWriter->pEntry, pWriter->entryCnt, sizeof(ARCHIVE_ENTRY), sCompareEntry);
+
+	for (i = 0, sparseCnt = 0, run = 0; i < pWriter->entryCnt; i++, run++)
+	{
+		if ((0 == i) || (pWriter->pEntry[i].messageId != pWriter->pEntry[i - 1].messageId))
+		{
+			run = 0;
+		}
+		if (0 == run % ARCHIVE_SPARSE_STEP)
+		{
+			sparseCnt++;
+		}
+	}
+
+	total = sizeof(ARCHIVE_BLOCK_HDR) + pWriter->dataLen + sparseCnt * sizeof(ARCHIVE_SPARSE) +
+		(pWriter->keyCnt[ARCHIVE_KEY_TEMP_ID] + pWriter->keyCnt[ARCHIVE_KEY_INTERSECTION]) * sizeof(ARCHIVE_POSTING);
+	pOut = calloc(1, total);
+	pOffset = malloc(pWriter->entryCnt * sizeof(unsigned int));
+	if ((HAE_NULL == pOut) || (HAE_NULL == pOffset))
+	{
+		printf("[ARCHIVE] ERROR : no memory to seal a block\n");
+		free(pOut);
+		free(pOffset);
+		return HAE_ERROR;
+	}
+
+	pHdr = (ARCHIVE_BLOCK_HDR *)pOut;
+	pHdr->magic = ARCHIVE_FILE_MAGIC;
+	pHdr->version = ARCHIVE_FILE_VERSION;
+	pHdr->hdrSize = sizeof(ARCHIVE_BLOCK_HDR);
+	pHdr->blockLen = total;
+	pHdr->firstNs = pWriter->pEntry[0].timeNs;
+	pHdr->recordCnt = pWriter->entryCnt;
+	pHdr->recordOff = sizeof(ARCHIVE_BLOCK_HDR);
+	pHdr->sparseCnt = sparseCnt;
+	pHdr->sparseOff = pHdr->recordOff + pWriter->dataLen;
+	pHdr->tempIdCnt = pWriter->keyCnt[ARCHIVE_KEY_TEMP_ID];
+	pHdr->tempIdOff = pHdr->sparseOff + sparseCnt * sizeof(ARCHIVE_SPARSE);
+	pHdr->intersectionCnt = pWriter->keyCnt[ARCHIVE_KEY_INTERSECTION];
+	pHdr->intersectionOff = pHdr->tempIdOff + pHdr->tempIdCnt * sizeof(ARCHIVE_POSTING);
+
+	/* records in index order, the sparse index on the way */
+	pSparse = (ARCHIVE_SPARSE *)(pOut + pHdr->sparseOff);
+	pos = pHdr->recordOff;
+	for (i = 0, run = 0; i < pWriter->entryCnt; i++, run++)
+	{
+		pEntry = &pWriter->pEntry[i];
+		pRec = (ARCHIVE_REC_HDR *)(pWriter->pData + pEntry->pos);
+		recSize = (sizeof(ARCHIVE_REC_HDR) + pRec->len + ARCHIVE_ALIGN - 1) & ~(size_t)(ARCHIVE_ALIGN - 1);
+		memcpy(pOut + pos, pRec, recSize);
+		pOffset[pEntry->seq] = pos;
+
+		if ((0 == i) || (pEntry->messageId != pWriter->pEntry[i - 1].messageId))
+		{
+			run = 0;
+		}
+		if (0 == run % ARCHIVE_SPARSE_STEP)
+		{
+			pSparse->timeNs = pEntry->timeNs;
+			pSparse->messageId = pEntry->messageId;
+			pSparse->offset = pos;
+			pSparse++;
+		}
+		if (pEntry->timeNs < pHdr->firstNs)
+		{
+			pHdr->firstNs = pEntry->timeNs;
+		}
+		if (pEntry->timeNs > pHdr->lastNs)
+		{
+			pHdr->lastNs = pEntry->timeNs;
+		}
+		pos += recSize;
+	}
+
+	/* postings: seq -> offset, by key then offset */
+	for (k = 0; k < 2; k++)
+	{
+		pPosting = (ARCHIVE_POSTING *)(pOut + ((ARCHIVE_KEY_TEMP_ID == k) ? pHdr->tempIdOff : pHdr->intersectionOff));
+		for (i = 0; i < pWriter->keyCnt[k]; i++)
+		{
+			pPosting[i].key = pWriter->pKey[k][i].key;
+			pPosting[i].offset = pOffset[pWriter->pKey[k][i].seq];
+		}
+		qsort(pPosting, pWriter->keyCnt[k], sizeof(ARCHIVE_POSTING), sComparePosting);
+	}
+
+	ret = sWriteAll(pWriter->fd, pOut, total);
+	if (HAE_OK != ret)
+	{
+		printf("[ARCHIVE] ERROR : write block (%s)\n", strerror(errno));
+	}
+	else
+	{
+		pWriter->blockCnt++;
+	}
+	free(pOut);
+	free(pOffset);
+
+	pWriter->dataLen = 0;
+	pWriter->entryCnt = 0;
+	pWriter->keyCnt[ARCHIVE_KEY_TEMP_ID] = 0;
+	pWriter->keyCnt[ARCHIVE_KEY_INTERSECTION] = 0;
+
+	return ret;
+}
+
+void MsgArchive_CloseWriter(ARCHIVE_WRITER *pWriter)
+{
+	MsgArchive_Seal(pWriter);
+	if (pWriter->fd >= 0)
+	{
+		close(pWriter->fd);
+		pWriter->fd = -1;
+	}
+	free(pWriter->pData);
+	free(pWriter->pEntry);
+	free(pWriter->pKey[ARCHIVE_KEY_TEMP_ID]);
+	free(pWriter->pKey[ARCHIVE_KEY_INTERSECTION]);
+	pWriter->pData = HAE_NULL;
+	pWriter->pEntry = HAE_NULL;
+	pWriter->pKey[ARCHIVE_KEY_TEMP_ID] = HAE_NULL;
+	pWriter->pKey[ARCHIVE_KEY_INTERSECTION] = HAE_NULL;
+}
+
+/*************************************************************
+ *
+ * Function 		: MsgArchive_OpenReader
+ *
+ * Description	: Map an archive for queries.
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int MsgArchive_OpenReader(ARCHIVE_READER *pReader, const char *pPath)
+{
+	struct stat st;
+	void *pMap;
+
+	memset(pReader, 0x00, sizeof(ARCHIVE_READER));
+	if ((pReader->fd = open(pPath, O_RDONLY)) < 0)
+	{
+		printf("[ARCHIVE] ERROR : cannot open %s (%s)\n", pPath, strerror(errno));
+		return HAE_ERROR;
+	}
+	if ((0 != fstat(pReader->fd, &st)) || ((size_t)st.st_size < sizeof(ARCHIVE_BLOCK_HDR)))
+	{
+		printf("[ARCHIVE] ERROR : %s is empty\n", pPath);
+		MsgArchive_CloseReader(pReader);
+		return HAE_ERROR;
+	}
+	pMap = mmap(HAE_NULL, st.st_size, PROT_READ, MAP_PRIVATE, pReader->fd, 0);
+	if (MAP_FAILED == pMap)
+	{
+		printf("[ARCHIVE] ERROR : mmap %s (%s)\n", pPath, strerror(errno));
+		MsgArchive_CloseReader(pReader);
+		return HAE_ERROR;
+	}
+	/* queries jump between the indexes and a few records */
+	madvise(pMap, st.st_size, MADV_RANDOM);
+	pReader->pMap = (const unsigned char *)pMap;
+	pReader->mapLen = st.st_size;
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: MsgArchive_Query
+ *
+ * Description	: Hand the records matching pQuery to pfMatch, block
+ *				  after block, in (messageId, time) order within a
+ *				  block. With a TemporaryID or IntersectionReferenceID
+ *				  the postings lead to the records, otherwise the
+ *				  sparse index to the first record of the time range.
+ *
+ * Returns		: matches, HAE_ERROR on a damaged archive
+ *
+ *************************************************************/
+int MsgArchive_Query(ARCHIVE_READER *pReader, const ARCHIVE_QUERY *pQuery, ARCHIVE_MATCH_FUNC pfMatch, void *pArg)
+{
+	ARCHIVE_BLOCK_HDR hdr;
+	size_t pos = 0;
+	int ret = HAE_OK;
+
+	pReader->blockCnt = 0;
+	pReader->skipCnt = 0;
+	pReader->scanCnt = 0;
+	pReader->matchCnt = 0;
+
+	while ((HAE_OK == ret) && (pos + sizeof(ARCHIVE_BLOCK_HDR) <= pReader->mapLen))
+	{
+		memcpy(&hdr, pReader->pMap + pos, sizeof(hdr));
+		if ((ARCHIVE_FILE_MAGIC != hdr.magic) || (ARCHIVE_FILE_VERSION != hdr.version) ||
+			(hdr.hdrSize < sizeof(ARCHIVE_BLOCK_HDR)) || (pos + hdr.blockLen > pReader->mapLen) ||
+			(hdr.recordOff < hdr.hdrSize) || (hdr.sparseOff < hdr.recordOff) || (hdr.tempIdOff < hdr.sparseOff + hdr.sparseCnt * sizeof(ARCHIVE_SPARSE)) ||
+			(hdr.intersectionOff < hdr.tempIdOff + hdr.tempIdCnt * sizeof(ARCHIVE_POSTING)) ||
+			(hdr.blockLen < hdr.intersectionOff + hdr.intersectionCnt * sizeof(ARCHIVE_POSTING)))
+		{
+			printf("[ARCHIVE] ERROR : damaged block at %zu\n", pos);
+			return HAE_ERROR;
+		}
+		pReader->blockCnt++;
+		if ((hdr.lastNs < pQuery->startNs) || (hdr.firstNs > pQuery->endNs))
+		{
+			pReader->skipCnt++;
+		}
+		else
+		{
+			ret = sQueryBlock(pReader, pReader->pMap + pos, &hdr, pQuery, pfMatch, pArg);
+		}
+		pos += hdr.blockLen;
+	}
+
+	return (int)pReader->matchCnt;
+}
+
+void MsgArchive_CloseReader(ARCHIVE_READER *pReader)
+{
+	if (HAE_NULL != pReader->pMap)
+	{
+		munmap((void *)pReader->pMap, pReader->mapLen);
+		pReader->pMap = HAE_NULL;
+	}
+	if (pReader->fd >= 0)
+	{
+		close(pReader->fd);
+		pReader->fd = -1;
+	}
+}
+
+static void sTakeIds(ARCHIVE_WRITER *pWriter, unsigned int messageId, const unsigned char *pValue, size_t len, unsigned int seq)
+{
+	unsigned int key;
+	int ret;
+
+	switch (messageId)
+	{
+		case ASN1V_basicSafetyMessage:
+		case ASN1V_personalSafetyMessage:
+			ret = sPeekTempId(messageId, pValue, len, &key);
+			if (HAE_OK == ret)
+			{
+				pWriter->peekCnt++;
+				sAddKey(pWriter, ARCHIVE_KEY_TEMP_ID, key, seq);
+			}
+			break;
+		case ASN1V_signalPhaseAndTimingMessage:
+		case ASN1V_mapData:
+			ret = sPeekIntersection(messageId, pValue, len, &key);
+			if (HAE_OK == ret)
+			{
+				pWriter->peekCnt++;
+				sAddKey(pWriter, ARCHIVE_KEY_INTERSECTION, key, seq);
+			}
+			else
+			{
+				/* several intersections, or bits the peek does not follow */
+				pWriter->decodeCnt++;
+				ret = sDecodeIntersections(pWriter, messageId, pValue, len, seq);
+			}
+			break;
+		default:
+			return;
+	}
+	if (HAE_OK != ret)
+	{
+		pWriter->noIdCnt++;
+	}
+}
+
+/* the bits in front of the TemporaryID, nothing there is extensible */
+static int sPeekTempId(unsigned int messageId, const unsigned char *pValue, size_t len, unsigned int *pKey)
+{
+	ARCHIVE_BITS bits = { pValue, len * 8, 0 };
+	unsigned int ext;
+
+	if (ASN1V_basicSafetyMessage == messageId)
+	{
+		/* extension, partII / regional present, coreData.msgCnt */
+		bits.pos = 1 + 2 + 7;
+	}
+	else
+	{
+		/* extension, 18 optional fields, basicType (extensible enum) */
+		bits.pos = 1 + 18;
+		if ((HAE_OK != sBits(&bits, 1, &ext)) || (0 != ext))
+		{
+			return HAE_ERROR;
+		}
+		/* basicType root, secMark, msgCnt */
+		bits.pos += 3 + 16 + 7;
+	}
+
+	return sBits(&bits, 32, pKey);
+}
+
+/* IntersectionReferenceID of a SPaT / MAP with one intersection */
+static int sPeekIntersection(unsigned int messageId, const unsigned char *pValue, size_t len, unsigned int *pKey)
+{
+	ARCHIVE_BITS bits = { pValue, len * 8, 0 };
+	unsigned int opt, val, cnt;
+
+	if (ASN1V_signalPhaseAndTimingMessage == messageId)
+	{
+		/* extension, timeStamp / name / regional present */
+		bits.pos = 1;
+		if (HAE_OK != sBits(&bits, 3, &opt))
+		{
+			return HAE_ERROR;
+		}
+		bits.pos += (opt & 0x4) ? 20 : 0;
+		if ((opt & 0x2) && (HAE_OK != sSkipName(&bits)))
+		{
+			return HAE_ERROR;
+		}
+		/* IntersectionState: extension, 6 optional fields */
+		if ((HAE_OK != sBits(&bits, 5, &cnt)) || (0 != cnt) || (HAE_OK != sBits(&bits, 7, &opt)))
+		{
+			return HAE_ERROR;
+		}
+		if ((opt & 0x20) && (HAE_OK != sSkipName(&bits)))
+		{
+			return HAE_ERROR;
+		}
+	}
+	else
+	{
+		/* extension, 8 optional fields, timeStamp, msgIssueRevision */
+		bits.pos = 1;
+		if ((HAE_OK != sBits(&bits, 8, &opt)) || (0 == (opt & 0x10)))
+		{
+			return HAE_ERROR;
+		}
+		bits.pos += ((opt & 0x80) ? 20 : 0) + 7;
+		/* layerType (extensible enum), layerID */
+		if (opt & 0x40)
+		{
+			if ((HAE_OK != sBits(&bits, 1, &val)) || (0 != val))
+			{
+				return HAE_ERROR;
+			}
+			bits.pos += 3;
+		}
+		bits.pos += (opt & 0x20) ? 7 : 0;
+		/* IntersectionGeometry: extension, 5 optional fields */
+		if ((HAE_OK != sBits(&bits, 5, &cnt)) || (0 != cnt) || (HAE_OK != sBits(&bits, 6, &opt)))
+		{
+			return HAE_ERROR;
+		}
+		if ((opt & 0x10) && (HAE_OK != sSkipName(&bits)))
+		{
+			return HAE_ERROR;
+		}
+	}
+
+	return sPeekReferenceId(&bits, pKey);
+}
+
+static int sDecodeIntersections(ARCHIVE_WRITER *pWriter, unsigned int messageId, const unsigned char *pValue, size_t len,
+	unsigned int seq)
+{
+	IntersectionReferenceID *pId;
+	OSRTDListNode *pNode;
+	OSRTDList *pList = HAE_NULL;
+	SPAT spat;
+	MapData map;
+	OSCTXT ctxt;
+	int ret = HAE_ERROR;
+
+	if (0 != rtInitContext(&ctxt))
+	{
+		return HAE_ERROR;
+	}
+	pu_setBuffer(&ctxt, (OSOCTET *)pValue, len, FALSE);
+	if (ASN1V_signalPhaseAndTimingMessage == messageId)
+	{
+		asn1Init_SPAT(&spat);
+		if (0 == asn1PD_SPAT(&ctxt, &spat))
+		{
+			pList = &spat.intersections;
+		}
+	}
+	else
+	{
+		asn1Init_MapData(&map);
+		if ((0 == asn1PD_MapData(&ctxt, &map)) && (map.m.intersectionsPresent))
+		{
+			pList = &map.intersections;
+		}
+	}
+
+	for (pNode = (HAE_NULL != pList) ? pList->head : HAE_NULL; HAE_NULL != pNode; pNode = pNode->next)
+	{
+		if (ASN1V_signalPhaseAndTimingMessage == messageId)
+		{
+			pId = &((IntersectionState *)pNode->data)->id;
+		}
+		else
+		{
+			pId = &((IntersectionGeometry *)pNode->data)->id;
+		}
+		ret = sAddKey(pWriter, ARCHIVE_KEY_INTERSECTION, ARCHIVE_INTERSECTION_KEY(pId->id, pId->m.regionPresent, pId->region),
+			seq);
+	}
+	rtFreeContext(&ctxt);
+
+	return ret;
+}
+
+static int sBits(ARCHIVE_BITS *pBits, unsigned int n, unsigned int *pVal)
+{
+	unsigned int i;
+	size_t pos;
+
+	if (pBits->pos + n > pBits->bitLen)
+	{
+		return HAE_ERROR;
+	}
+	*pVal = 0;
+	for (i = 0, pos = pBits->pos; i < n; i++, pos++)
+	{
+		*pVal = (*pVal << 1) | ((pBits->pData[pos >> 3] >> (7 - (pos & 7))) & 1);
+	}
+	pBits->pos = pos;
+
+	return HAE_OK;
+}
+
+/* DescriptiveName, IA5String (SIZE (1..63)): 6 bit length, 7 bit chars */
+static int sSkipName(ARCHIVE_BITS *pBits)
+{
+	unsigned int len;
+
+	if (HAE_OK != sBits(pBits, 6, &len))
+	{
+		return HAE_ERROR;
+	}
+	pBits->pos += (len + 1) * 7;
+
+	return (pBits->pos <= pBits->bitLen) ? HAE_OK : HAE_ERROR;
+}
+
+/* IntersectionReferenceID: region present, region, id */
+static int sPeekReferenceId(ARCHIVE_BITS *pBits, unsigned int *pKey)
+{
+	unsigned int present, region = 0, id;
+
+	if ((HAE_OK != sBits(pBits, 1, &present)) || (present && (HAE_OK != sBits(pBits, 16, &region))) ||
+		(HAE_OK != sBits(pBits, 16, &id)))
+	{
+		return HAE_ERROR;
+	}
+	*pKey = ARCHIVE_INTERSECTION_KEY(id, present, region);
+
+	return HAE_OK;
+}
+
+static int sAddKey(ARCHIVE_WRITER *pWriter, int kind, unsigned int key, unsigned int seq)
+{
+	if (HAE_OK != sGrow((void **)&pWriter->pKey[kind], &pWriter->keySize[kind], pWriter->keyCnt[kind] + 1,
+		sizeof(ARCHIVE_KEY)))
+	{
+		return HAE_ERROR;
+	}
+	pWriter->pKey[kind][pWriter->keyCnt[kind]].key = key;
+	pWriter->pKey[kind][pWriter->keyCnt[kind]].seq = seq;
+	pWriter->keyCnt[kind]++;
+
+	return HAE_OK;
+}
+
+static int sGrow(void **ppArray, unsigned int *pSize, unsigned int need, size_t elemSize)
+{
+	unsigned int size;
+	void *pArray;
+
+	if (need <= *pSize)
+	{
+		return HAE_OK;
+	}
+	size = (0 != *pSize) ? *pSize * 2 : 1024;
+	if (HAE_NULL == (pArray = realloc(*ppArray, (size_t)size * elemSize)))
+	{
+		printf("[ARCHIVE] ERROR : no memory for the index\n");
+		return HAE_ERROR;
+	}
+	*ppArray = pArray;
+	*pSize = size;
+
+	return HAE_OK;
+}
+
+static int sCompareEntry(const void *pA, const void *pB)
+{
+	const ARCHIVE_ENTRY *pEa = (const ARCHIVE_ENTRY *)pA;
+	const ARCHIVE_ENTRY *pEb = (const ARCHIVE_ENTRY *)pB;
+
+	if (pEa->messageId != pEb->messageId)
+	{
+		return (pEa->messageId < pEb->messageId) ? -1 : 1;
+	}
+	if (pEa->timeNs != pEb->timeNs)
+	{
+		return (pEa->timeNs < pEb->timeNs) ? -1 : 1;
+	}
+
+	return (pEa->seq < pEb->seq) ? -1 : (pEa->seq > pEb->seq);
+}
+
+static int sComparePosting(const void *pA, const void *pB)
+{
+	const ARCHIVE_POSTING *pPa = (const ARCHIVE_POSTING *)pA;
+	const ARCHIVE_POSTING *pPb = (const ARCHIVE_POSTING *)pB;
+
+	if (pPa->key != pPb->key)
+	{
+		return (pPa->key < pPb->key) ? -1 : 1;
+	}
+
+	return (pPa->offset < pPb->offset) ? -1 : (pPa->offset > pPb->offset);
+}
+
+static int sWriteAll(int fd, const unsigned char *pData, size_t len)
+{
+	ssize_t n;
+
+	while (len > 0)
+	{
+		n = write(fd, pData, len);
+		if (n < 0)
+		{
+			if (EINTR == errno)
+			{
+				continue;
+			}
+			return HAE_ERROR;
+		}
+		pData += n;
+		len -= n;
+	}
+
+	return HAE_OK;
+}
+
+static int sQueryBlock(ARCHIVE_READER *pReader, const unsigned char *pBlock, const ARCHIVE_BLOCK_HDR *pHdr,
+	const ARCHIVE_QUERY *pQuery, ARCHIVE_MATCH_FUNC pfMatch, void *pArg)
+{
+	const ARCHIVE_SPARSE *pSparse = (const ARCHIVE_SPARSE *)(pBlock + pHdr->sparseOff);
+	unsigned int i;
+	int ret = HAE_OK;
+
+	if (pQuery->flags & (ARCHIVE_QUERY_TEMP_ID | ARCHIVE_QUERY_INTERSECTION))
+	{
+		return sQueryPostings(pReader, pBlock, pHdr, pQuery, pfMatch, pArg);
+	}
+	if (ARCHIVE_ANY != pQuery->messageId)
+	{
+		return sQueryMessage(pReader, pBlock, pHdr, pQuery->messageId, pQuery, pfMatch, pArg);
+	}
+
+	/* every messageId of the block, the sparse index lists them in order */
+	for (i = 0; (HAE_OK == ret) && (i < pHdr->sparseCnt); i++)
+	{
+		if ((0 == i) || (pSparse[i].messageId != pSparse[i - 1].messageId))
+		{
+			ret = sQueryMessage(pReader, pBlock, pHdr, pSparse[i].messageId, pQuery, pfMatch, pArg);
+		}
+	}
+
+	return ret;
+}
+
+static int sQueryPostings(ARCHIVE_READER *pReader, const unsigned char *pBlock, const ARCHIVE_BLOCK_HDR *pHdr,
+	const ARCHIVE_QUERY *pQuery, ARCHIVE_MATCH_FUNC pfMatch, void *pArg)
+{
+	const ARCHIVE_POSTING *pPosting;
+	ARCHIVE_RECORD record;
+	unsigned int cnt, low, high, lo, hi, mid;
+
+	if (pQuery->flags & ARCHIVE_QUERY_TEMP_ID)
+	{
+		pPosting = (const ARCHIVE_POSTING *)(pBlock + pHdr->tempIdOff);
+		cnt = pHdr->tempIdCnt;
+		low = ((unsigned int)pQuery->tempId[0] << 24) | (pQuery->tempId[1] << 16) | (pQuery->tempId[2] << 8) |
+			pQuery->tempId[3];
+		high = low;
+	}
+	else
+	{
+		pPosting = (const ARCHIVE_POSTING *)(pBlock + pHdr->intersectionOff);
+		cnt = pHdr->intersectionCnt;
+		low = ARCHIVE_INTERSECTION_KEY(pQuery->intersectionId, pQuery->flags & ARCHIVE_QUERY_REGION, pQuery->region);
+		/* without a region: every region of the id */
+		high = (pQuery->flags & ARCHIVE_QUERY_REGION) ? low : (low | 0x1ffff);
+	}
+
+	for (lo = 0, hi = cnt; lo < hi; )
+	{
+		mid = lo + (hi - lo) / 2;
+		if (pPosting[mid].key < low)
+		{
+			lo = mid + 1;
+		}
+		else
+		{
+			hi = mid;
+		}
+	}
+
+	for (; (lo < cnt) && (pPosting[lo].key <= high); lo++)
+	{
+		if (HAE_OK != sRecordAt(pBlock, pHdr, pPosting[lo].offset, &record))
+		{
+			printf("[ARCHIVE] ERROR : posting past the records\n");
+			return HAE_ERROR;
+		}
+		pReader->scanCnt++;
+		if (((ARCHIVE_ANY != pQuery->messageId) && (record.messageId != pQuery->messageId)) ||
+			(record.timeNs < pQuery->startNs) || (record.timeNs > pQuery->endNs))
+		{
+			continue;
+		}
+		pReader->matchCnt++;
+		if (HAE_OK != pfMatch(pArg, &record))
+		{
+			return HAE_ERROR;
+		}
+	}
+
+	return HAE_OK;
+}
+
+/* the records of messageId from startNs on, they follow each other */
+static int sQueryMessage(ARCHIVE_READER *pReader, const unsigned char *pBlock, const ARCHIVE_BLOCK_HDR *pHdr,
+	unsigned int messageId, const ARCHIVE_QUERY *pQuery, ARCHIVE_MATCH_FUNC pfMatch, void *pArg)
+{
+	const ARCHIVE_SPARSE *pSparse = (const ARCHIVE_SPARSE *)(pBlock + pHdr->sparseOff);
+	ARCHIVE_RECORD record;
+	unsigned int lo, hi, mid, offset;
+
+	/* first entry at or after (messageId, startNs) */
+	for (lo = 0, hi = pHdr->sparseCnt; lo < hi; )
+	{
+		mid = lo + (hi - lo) / 2;
+		if ((pSparse[mid].messageId < messageId) ||
+			((pSparse[mid].messageId == messageId) && (pSparse[mid].timeNs < pQuery->startNs)))
+		{
+			lo = mid + 1;
+		}
+		else
+		{
+			hi = mid;
+		}
+	}
+	/* the records between the entry before and this one may be in range */
+	if ((lo > 0) && (pSparse[lo - 1].messageId == messageId))
+	{
+		lo--;
+	}
+	else if ((lo == pHdr->sparseCnt) || (pSparse[lo].messageId != messageId))
+	{
+		return HAE_OK;
+	}
+
+	for (offset = pSparse[lo].offset; offset < pHdr->sparseOff; offset += (sizeof(ARCHIVE_REC_HDR) + record.len +
+		ARCHIVE_ALIGN - 1) & ~(ARCHIVE_ALIGN - 1))
+	{
+		if (HAE_OK != sRecordAt(pBlock, pHdr, offset, &record))
+		{
+			printf("[ARCHIVE] ERROR : record past the block\n");
+			return HAE_ERROR;
+		}
+		if ((record.messageId != messageId) || (record.timeNs > pQuery->endNs))
+		{
+			break;
+		}
+		pReader->scanCnt++;
+		if (record.timeNs < pQuery->startNs)
+		{
+			continue;
+		}
+		pReader->matchCnt++;
+		if (HAE_OK != pfMatch(pArg, &record))
+		{
+			return HAE_ERROR;
+		}
+	}
+
+	return HAE_OK;
+}
+
+static int sRecordAt(const unsigned char *pBlock, const ARCHIVE_BLOCK_HDR *pHdr, unsigned int offset, ARCHIVE_RECORD *pRecord)
+{
+	ARCHIVE_REC_HDR hdr;
+
+	if ((offset < pHdr->recordOff) || (offset + sizeof(ARCHIVE_REC_HDR) > pHdr->sparseOff))
+	{
+		return HAE_ERROR;
+	}
+	memcpy(&hdr, pBlock + offset, sizeof(hdr));
+	if (offset + sizeof(ARCHIVE_REC_HDR) + hdr.len > pHdr->sparseOff)
+	{
+		return HAE_ERROR;
+	}
+	pRecord->timeNs = hdr.timeNs;
+	pRecord->messageId = hdr.messageId;
+	pRecord->len = hdr.len;
+	pRecord->pFrame = pBlock + offset + sizeof(ARCHIVE_REC_HDR);
+
+	return HAE_OK;
+}
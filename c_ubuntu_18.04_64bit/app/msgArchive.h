@@ -0,0 +1,157 @@
+#ifndef MSG_ARCHIVE_H
+#define MSG_ARCHIVE_H
+
+#include <stddef.h>
+
+/* Archive of UPER MessageFrames for lookups by time and ID without
+   decoding everything. The file is a sequence of blocks, one per
+   blockSec of CLOCK_REALTIME (or ARCHIVE_BLOCK_BYTES of records), each
+   self contained:
+
+     ARCHIVE_BLOCK_HDR
+     records        ARCHIVE_REC_HDR + MessageFrame, padded to ARCHIVE_ALIGN,
+                    sorted by (messageId, time)
+     sparse index   ARCHIVE_SPARSE, the first record of every messageId and
+                    every ARCHIVE_SPARSE_STEP-th one after it
+     tempId         ARCHIVE_POSTING, TemporaryID of BSM / PSM, by key
+     intersection   ARCHIVE_POSTING, IntersectionReferenceID of SPaT / MAP,
+                    by key
+
+   The IDs are taken at ingest with a peek at the few bits in front of
+   them; only a SPaT / MAP with more than one intersection is decoded to
+   list them all. A query reads the block headers, skips blocks out of
+   its time range and walks the index to the matching records, so only
+   those reach the decoder. */
+
+#define ARCHIVE_FILE_MAGIC		0x48415243	/* "HARC" */
+#define ARCHIVE_FILE_VERSION	1
+#define ARCHIVE_ALIGN			8
+#define ARCHIVE_BLOCK_SEC		60
+#define ARCHIVE_BLOCK_BYTES		(32 * 1024 * 1024)
+#define ARCHIVE_SPARSE_STEP		64
+#define ARCHIVE_FRAME_MAX		65535
+
+#define ARCHIVE_ANY				0xffffffff	/* messageId of a query: every message */
+
+/* key of an IntersectionReferenceID posting: id, region present, region;
+   the postings of one id are together whatever the region */
+#define ARCHIVE_INTERSECTION_KEY(id, regionPresent, region) \
+	(((unsigned int)(id) << 17) | ((regionPresent) ? (0x10000 | (unsigned int)(region)) : 0))
+
+typedef struct{
+	unsigned int magic;
+	unsigned int version;
+	unsigned int hdrSize;
+	unsigned int blockLen;				/* header included, next block follows */
+	unsigned long long firstNs;			/* CLOCK_REALTIME of the records */
+	unsigned long long lastNs;
+	unsigned int recordCnt;
+	unsigned int recordOff;				/* offsets from the block start */
+	unsigned int sparseCnt;
+	unsigned int sparseOff;
+	unsigned int tempIdCnt;
+	unsigned int tempIdOff;
+	unsigned int intersectionCnt;
+	unsigned int intersectionOff;
+} ARCHIVE_BLOCK_HDR;
+
+typedef struct{
+	unsigned long long timeNs;
+	unsigned int messageId;
+	unsigned int len;					/* octets of the MessageFrame */
+} ARCHIVE_REC_HDR;
+
+typedef struct{
+	unsigned long long timeNs;
+	unsigned int messageId;
+	unsigned int offset;				/* of the ARCHIVE_REC_HDR in the block */
+} ARCHIVE_SPARSE;
+
+typedef struct{
+	unsigned int key;					/* TemporaryID big endian, ARCHIVE_INTERSECTION_KEY */
+	unsigned int offset;
+} ARCHIVE_POSTING;
+
+/* record of the writer before the block is sealed */
+typedef struct{
+	unsigned long long timeNs;
+	unsigned int messageId;
+	unsigned int seq;					/* order of arrival */
+	size_t pos;							/* in pData */
+} ARCHIVE_ENTRY;
+
+/* posting of the writer, seq of the record instead of its offset */
+typedef struct{
+	unsigned int key;
+	unsigned int seq;
+} ARCHIVE_KEY;
+
+typedef struct{
+	int fd;
+	unsigned long long blockNs;
+	unsigned long long blockStartNs;	/* of the open block */
+
+	unsigned char *pData;				/* ARCHIVE_REC_HDR + frame, arrival order */
+	size_t dataLen;
+	size_t dataSize;
+	ARCHIVE_ENTRY *pEntry;
+	unsigned int entryCnt;
+	unsigned int entrySize;
+	ARCHIVE_KEY *pKey[2];				/* tempId, intersection */
+	unsigned int keyCnt[2];
+	unsigned int keySize[2];
+
+	unsigned long long recordCnt;
+	unsigned long long blockCnt;
+	unsigned long long byteCnt;
+	unsigned long long peekCnt;			/* IDs taken by the peek */
+	unsigned long long decodeCnt;		/* IDs that needed a decode */
+	unsigned long long noIdCnt;			/* BSM / PSM / SPaT / MAP without readable ID */
+} ARCHIVE_WRITER;
+
+typedef struct{
+	int fd;
+	const unsigned char *pMap;
+	size_t mapLen;
+
+	unsigned long long blockCnt;		/* of the last query */
+	unsigned long long skipCnt;			/* blocks out of its time range */
+	unsigned long long scanCnt;			/* records looked at */
+	unsigned long long matchCnt;
+} ARCHIVE_READER;
+
+#define ARCHIVE_QUERY_TEMP_ID		0x01
+#define ARCHIVE_QUERY_INTERSECTION	0x02
+#define ARCHIVE_QUERY_REGION		0x04	/* with ARCHIVE_QUERY_INTERSECTION */
+
+typedef struct{
+	unsigned int messageId;				/* ARCHIVE_ANY */
+	unsigned long long startNs;			/* CLOCK_REALTIME, inclusive */
+	unsigned long long endNs;
+	unsigned int flags;					/* ARCHIVE_QUERY_* */
+	unsigned char tempId[4];
+	unsigned short region;
+	unsigned short intersectionId;
+} ARCHIVE_QUERY;
+
+/* a match, pFrame points into the mapping */
+typedef struct{
+	unsigned long long timeNs;
+	unsigned int messageId;
+	unsigned int len;
+	const unsigned char *pFrame;
+} ARCHIVE_RECORD;
+
+/* return HAE_ERROR to stop the query */
+typedef int (*ARCHIVE_MATCH_FUNC)(void *pArg, const ARCHIVE_RECORD *pRecord);
+
+int MsgArchive_OpenWriter(ARCHIVE_WRITER *pWriter, const char *pPath, unsigned int blockSec);
+int MsgArchive_Append(ARCHIVE_WRITER *pWriter, unsigned long long timeNs, const unsigned char *pFrame, unsigned int len);
+int MsgArchive_Seal(ARCHIVE_WRITER *pWriter);
+void MsgArchive_CloseWriter(ARCHIVE_WRITER *pWriter);
+
+int MsgArchive_OpenReader(ARCHIVE_READER *pReader, const char *pPath);
+int MsgArchive_Query(ARCHIVE_READER *pReader, const ARCHIVE_QUERY *pQuery, ARCHIVE_MATCH_FUNC pfMatch, void *pArg);
+void MsgArchive_CloseReader(ARCHIVE_READER *pReader);
+
+#endif
@@ -0,0 +1,72 @@
+#define _GNU_SOURCE
+
+#include <rtoersrc/asn1oer.h>
+#include <rtxsrc/rtxBitString.h>
+#include <rtxsrc/rtxErrCodes.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <dlfcn.h>
+
+#include "haeCommon.h"
+
+/* oerBitString.o replaces two runtime functions the OEREnc_* functions
+   of BIT STRINGs get wrong:
+
+   rtxZeroUnusedBits of libasn1rt shifts the mask by 8 - numbits instead
+   of 8 - numbits % 8. From 9 bits on (LaneSharing, 10 bits) it clears the
+   whole last octet of the value, the OER encoding loses those bits and
+   the caller's value is changed.
+
+   oerEncBitStrExt of libasn1oer, used for every extensible BIT STRING
+   (VehicleEventFlags, ExteriorLights, ...), writes all dataSize root
+   octets and then the last octet of extdata, also when numbits fits the
+   root data and extdata is NULL: the encoding is wrong and extdata[-1] is
+   read. A value that fits the root data is an ordinary variable size BIT
+   STRING (X.696 16), the library function stays in use for longer
+   values. */
+
+typedef int (*OER_ENC_BIT_STR_EXT)(OSCTXT *, const OSOCTET *, size_t, const OSOCTET *, size_t);
+
+static volatile OER_ENC_BIT_STR_EXT oer_enc_bit_str_ext = 0;
+
+int rtxZeroUnusedBits(OSOCTET *pBits, OSSIZE numbits)
+{
+	if (0 == (numbits & 7))
+	{
+		return 0;
+	}
+	if (0 == pBits)
+	{
+		return RTERR_NULLPTR;
+	}
+
+	pBits[numbits >> 3] &= (OSOCTET)(0xff << (8 - (numbits & 7)));
+
+	return 0;
+}
+
+int oerEncBitStrExt(OSCTXT *pctxt, const OSOCTET *pvalue, size_t numbits, const OSOCTET *extdata, size_t dataSize)
+{
+	OER_ENC_BIT_STR_EXT pfLib;
+
+	if (numbits <= dataSize * 8)
+	{
+		return oerEncBitStr(pctxt, pvalue, numbits);
+	}
+
+	pfLib = oer_enc_bit_str_ext;
+	if (0 == pfLib)
+	{
+		*(void **)&pfLib = dlsym(RTLD_NEXT, "oerEncBitStrExt");
+		if (0 == pfLib)
+		{
+			printf("[OER] ERROR : cannot resolve oerEncBitStrExt: %s\n", dlerror());
+			abort();
+		}
+		/* the same value on every call, a race between threads is harmless */
+		oer_enc_bit_str_ext = pfLib;
+	}
+
+	return pfLib(pctxt, pvalue, numbits, extdata, dataSize);
+}
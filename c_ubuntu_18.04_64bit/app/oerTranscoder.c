@@ -0,0 +1,291 @@
+#include <rtxsrc/rtxMemory.h>
+#include <rtxsrc/rtxError.h>
+#include <rtpersrc/asn1per.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "oerTranscoder.h"
+
+#define OER_XC_PER_HDR_MAX		4			/* ext + messageId, 2 octet length */
+#define OER_XC_OER_HDR_MAX		7			/* preamble, messageId, 0x83 + 3 octet length */
+#define OER_XC_OER_VALUE_MAX	0xffffff
+
+static int sOerHeader(const unsigned char *pIn, size_t inLen, unsigned int *pMessageId, size_t *pOffset, size_t *pLength);
+static const ASN_TYPE *sValueType(OER_TRANSCODER *pXc, unsigned int messageId);
+static int sFail(OER_TRANSCODER *pXc, const char *pWhat, const ASN_TYPE *pType);
+
+/*************************************************************
+ *
+ * Function 		: OerTranscoder_Init
+ *
+ * Description	: Context of a transcoder. One transcoder per thread.
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int OerTranscoder_Init(OER_TRANSCODER *pXc)
+{
+	memset(pXc, 0x00, sizeof(OER_TRANSCODER));
+
+	if (0 != rtInitContext(&pXc->ctxt))
+	{
+		printf("[OER] ERROR : rtInitContext() for transcoder\n");
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+void OerTranscoder_Free(OER_TRANSCODER *pXc)
+{
+	rtFreeContext(&pXc->ctxt);
+}
+
+/*************************************************************
+ *
+ * Function 		: OerTranscoder_PerToOer
+ *
+ * Description	: UPER MessageFrame -> OER MessageFrame.
+ *
+ * Parameter	: pIn, inLen - UPER MessageFrame
+ *				  pOut, outSize - buffer for the OER MessageFrame
+ *				  pOutLen - octets written to pOut
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int OerTranscoder_PerToOer(OER_TRANSCODER *pXc, const unsigned char *pIn, size_t inLen,
+	unsigned char *pOut, size_t outSize, size_t *pOutLen)
+{
+	unsigned int messageId;
+	size_t offset, length, valueLen, hdrLen;
+	const ASN_TYPE *pType;
+	void *pValue;
+
+	/* extension bit set: additions after the value, not transcoded */
+	if ((inLen < 1) || (pIn[0] & 0x80) || (HAE_OK != AsnType_PerFrameHeader(pIn, inLen, &messageId, &offset, &length)))
+	{
+		return sFail(pXc, "UPER MessageFrame header", HAE_NULL);
+	}
+	if (HAE_NULL == (pType = sValueType(pXc, messageId)))
+	{
+		return HAE_ERROR;
+	}
+	if (outSize <= OER_XC_OER_HDR_MAX)
+	{
+		return sFail(pXc, "output buffer", pType);
+	}
+
+	rtxMemReset(&pXc->ctxt);
+	pValue = rtxMemAllocZ(&pXc->ctxt, pType->size);
+	pu_setBuffer(&pXc->ctxt, (OSOCTET *)pIn + offset, length, FALSE);
+	if ((HAE_NULL == pValue) || (0 != pType->pfPerDec(&pXc->ctxt, pValue)))
+	{
+		return sFail(pXc, "UPER decode", pType);
+	}
+
+	/* value first, the length of its length is known afterwards */
+	rtxInitContextBuffer(&pXc->ctxt, pOut + OER_XC_OER_HDR_MAX, outSize - OER_XC_OER_HDR_MAX);
+	if (0 != pType->pfOerEnc(&pXc->ctxt, pValue))
+	{
+		return sFail(pXc, "OER encode", pType);
+	}
+	valueLen = rtxCtxtGetMsgLen(&pXc->ctxt);
+	if (valueLen > OER_XC_OER_VALUE_MAX)
+	{
+		return sFail(pXc, "OER value length", pType);
+	}
+
+	/* X.696 8.6: short form below 128, else 0x80 | octets of the length */
+	pOut[0] = 0x00;
+	pOut[1] = (unsigned char)(messageId >> 8);
+	pOut[2] = (unsigned char)messageId;
+	if (valueLen < 0x80)
+	{
+		pOut[3] = (unsigned char)valueLen;
+		hdrLen = 4;
+	}
+	else if (valueLen <= 0xff)
+	{
+		pOut[3] = 0x81;
+		pOut[4] = (unsigned char)valueLen;
+		hdrLen = 5;
+	}
+	else if (valueLen <= 0xffff)
+	{
+		pOut[3] = 0x82;
+		pOut[4] = (unsigned char)(valueLen >> 8);
+		pOut[5] = (unsigned char)valueLen;
+		hdrLen = 6;
+	}
+	else
+	{
+		pOut[3] = 0x83;
+		pOut[4] = (unsigned char)(valueLen >> 16);
+		pOut[5] = (unsigned char)(valueLen >> 8);
+		pOut[6] = (unsigned char)valueLen;
+		hdrLen = 7;
+	}
+	if (hdrLen != OER_XC_OER_HDR_MAX)
+	{
+		memmove(pOut + hdrLen, pOut + OER_XC_OER_HDR_MAX, valueLen);
+	}
+
+	*pOutLen = hdrLen + valueLen;
+	pXc->frameCnt++;
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: OerTranscoder_OerToPer
+ *
+ * Description	: OER MessageFrame -> UPER MessageFrame.
+ *
+ * Parameter	: pIn, inLen - OER MessageFrame
+ *				  pOut, outSize - buffer for the UPER MessageFrame
+ *				  pOutLen - octets written to pOut
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int OerTranscoder_OerToPer(OER_TRANSCODER *pXc, const unsigned char *pIn, size_t inLen,
+	unsigned char *pOut, size_t outSize, size_t *pOutLen)
+{
+	unsigned int messageId;
+	size_t offset, length, valueLen, hdrLen;
+	const ASN_TYPE *pType;
+	void *pValue;
+
+	if (HAE_OK != sOerHeader(pIn, inLen, &messageId, &offset, &length))
+	{
+		return sFail(pXc, "OER MessageFrame header", HAE_NULL);
+	}
+	if (HAE_NULL == (pType = sValueType(pXc, messageId)))
+	{
+		return HAE_ERROR;
+	}
+	if (outSize <= OER_XC_PER_HDR_MAX)
+	{
+		return sFail(pXc, "output buffer", pType);
+	}
+
+	rtxMemReset(&pXc->ctxt);
+	pValue = rtxMemAllocZ(&pXc->ctxt, pType->size);
+	rtxInitContextBuffer(&pXc->ctxt, (OSOCTET *)pIn + offset, length);
+	if ((HAE_NULL == pValue) || (0 != pType->pfOerDec(&pXc->ctxt, pValue)))
+	{
+		return sFail(pXc, "OER decode", pType);
+	}
+
+	pu_setBuffer(&pXc->ctxt, pOut + OER_XC_PER_HDR_MAX, outSize - OER_XC_PER_HDR_MAX, FALSE);
+	if (0 != pType->pfPerEnc(&pXc->ctxt, pValue))
+	{
+		return sFail(pXc, "UPER encode", pType);
+	}
+	valueLen = pe_GetMsgLen(&pXc->ctxt);
+	if (0 == valueLen)
+	{
+		/* X.691 11.2.1: an empty encoding is one zero octet */
+		pOut[OER_XC_PER_HDR_MAX] = 0x00;
+		valueLen = 1;
+	}
+	if (valueLen > OER_XC_VALUE_MAX)
+	{
+		return sFail(pXc, "UPER value length", pType);
+	}
+
+	/* no extension additions, 15 bit messageId, X.691 11.9.3.6 / 11.9.3.7 length */
+	pOut[0] = (unsigned char)((messageId >> 8) & 0x7f);
+	pOut[1] = (unsigned char)messageId;
+	if (valueLen < 0x80)
+	{
+		pOut[2] = (unsigned char)valueLen;
+		hdrLen = 3;
+		memmove(pOut + hdrLen, pOut + OER_XC_PER_HDR_MAX, valueLen);
+	}
+	else
+	{
+		pOut[2] = (unsigned char)(0x80 | (valueLen >> 8));
+		pOut[3] = (unsigned char)valueLen;
+		hdrLen = 4;
+	}
+
+	*pOutLen = hdrLen + valueLen;
+	pXc->frameCnt++;
+
+	return HAE_OK;
+}
+
+static int sOerHeader(const unsigned char *pIn, size_t inLen, unsigned int *pMessageId, size_t *pOffset, size_t *pLength)
+{
+	unsigned int i, cnt;
+
+	/* preamble: extension bit only, set means additions after the value */
+	if ((inLen < 4) || (0 != pIn[0]))
+	{
+		return HAE_ERROR;
+	}
+	*pMessageId = (pIn[1] << 8) | pIn[2];
+	if (*pMessageId > 32767)
+	{
+		return HAE_ERROR;
+	}
+
+	if (0 == (pIn[3] & 0x80))
+	{
+		*pLength = pIn[3];
+		*pOffset = 4;
+	}
+	else
+	{
+		cnt = pIn[3] & 0x7f;
+		if ((0 == cnt) || (cnt > 3) || (inLen < 4 + cnt))
+		{
+			return HAE_ERROR;
+		}
+		*pLength = 0;
+		for (i = 0; i < cnt; i++)
+		{
+			*pLength = (*pLength << 8) | pIn[4 + i];
+		}
+		*pOffset = 4 + cnt;
+	}
+
+	return (*pOffset + *pLength <= inLen) ? HAE_OK : HAE_ERROR;
+}
+
+static const ASN_TYPE *sValueType(OER_TRANSCODER *pXc, unsigned int messageId)
+{
+	const ASN_TYPE *pType = AsnType_FindMessage(messageId);
+
+	pXc->lastMessageId = messageId;
+	if (HAE_NULL == pType)
+	{
+		pXc->unknownCnt++;
+		pXc->errorCnt++;
+		printf("[OER] ERROR : no type for messageId %u\n", messageId);
+	}
+
+	return pType;
+}
+
+static int sFail(OER_TRANSCODER *pXc, const char *pWhat, const ASN_TYPE *pType)
+{
+	pXc->errorCnt++;
+	if (HAE_NULL == pType)
+	{
+		printf("[OER] ERROR : %s failed\n", pWhat);
+	}
+	else
+	{
+		printf("[OER] ERROR : %s failed, messageId %u (%s)\n", pWhat, pXc->lastMessageId, pType->pName);
+	}
+	rtxErrReset(&pXc->ctxt);
+
+	return HAE_ERROR;
+}
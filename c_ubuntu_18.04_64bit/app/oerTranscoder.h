@@ -0,0 +1,38 @@
+#ifndef OER_TRANSCODER_H
+#define OER_TRANSCODER_H
+
+#include <DSRC.h>
+
+#include <stddef.h>
+
+/* UPER <-> OER transcoding of MessageFrame for the backhaul.
+   The MessageFrame envelope (extension bit / preamble, messageId, open
+   type length) is rewritten byte by byte, both encodings keep it octet
+   aligned. Only the value inside is decoded, straight from the input
+   buffer into the transcoder's context memory, and encoded straight into
+   the output buffer; the context memory is reset, not freed, between
+   frames. Frames with extension additions or a messageId without a type
+   (asn_type_table) are refused.
+
+   UPER: ext(1) messageId(15) | length 1..2 octets | value
+   OER : preamble 0x00 | messageId 2 octets | length 1..3 octets | value */
+
+#define OER_XC_VALUE_MAX		16383		/* value octets, UPER length without fragments */
+
+typedef struct{
+	OSCTXT ctxt;						/* value decode, memory reset per frame */
+	unsigned long frameCnt;
+	unsigned long errorCnt;
+	unsigned long unknownCnt;			/* messageId without a type */
+	unsigned int lastMessageId;
+} OER_TRANSCODER;
+
+int OerTranscoder_Init(OER_TRANSCODER *pXc);
+void OerTranscoder_Free(OER_TRANSCODER *pXc);
+
+int OerTranscoder_PerToOer(OER_TRANSCODER *pXc, const unsigned char *pIn, size_t inLen,
+	unsigned char *pOut, size_t outSize, size_t *pOutLen);
+int OerTranscoder_OerToPer(OER_TRANSCODER *pXc, const unsigned char *pIn, size_t inLen,
+	unsigned char *pOut, size_t outSize, size_t *pOutLen);
+
+#endif
@@ -0,0 +1,337 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+#include <rtxsrc/rtxPrintStream.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "decodeStats.h"
+#include "pcapFile.h"
+
+#define PCAP_DECODE_HDR_LEN		16			/* skipped by decodeSample */
+
+typedef struct{
+	const char *pFile;
+	unsigned short port;
+	unsigned int offset;
+	unsigned int loops;
+	int extractOnly;
+	const char *pTarget;				/* a.b.c.d:port, NULL: decode here */
+	const char *pOutPath;				/* annotated pcapng */
+	int verbose;						/* value text in the comments */
+	const char *pStatsPath;
+} PCAP_DECODE_CONFIG;
+
+/* comment of the datagram being written */
+typedef struct{
+	char text[PCAP_COMMENT_MAX + 1];
+	size_t len;
+} PCAP_COMMENT;
+
+static PCAP_DECODE_CONFIG decode_config = { HAE_NULL, DSRC_PORT, PCAP_DECODE_HDR_LEN, 1, HAE_FALSE, HAE_NULL, HAE_NULL,
+	HAE_FALSE, HAE_NULL };
+static DECODE_STATS decode_stats;
+static PCAP_COMMENT decode_comment;
+
+static int sParseArgs(int argc, char **argv, PCAP_DECODE_CONFIG *pConfig);
+static int sOpenTarget(const char *pTarget, struct sockaddr_in *pAddr);
+static int sDecode(const PCAP_RECORD *pRecord, const PCAP_DECODE_CONFIG *pConfig, PCAP_COMMENT *pComment);
+static void sAppend(PCAP_COMMENT *pComment, const char *pFormat, ...);
+static void sPrint(void *pPrntStrmInfo, const char *fmtspec, va_list arglist);
+static void sReport(const PCAP_DECODE_CONFIG *pConfig, const PCAP_READER *pReader, unsigned long long cnt,
+	unsigned long long bytes, unsigned long long errorCnt, double elapsed);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: Decode the DSRC datagrams of a tcpdump / Wireshark
+ *				  capture (pcap or pcapng) as fast as the file can be
+ *				  read, the way decodeSample decodes them off the
+ *				  socket. With -w every datagram goes into a pcapng
+ *				  with what it decoded to as the packet comment.
+ *
+ * Parameter	: file        pcap / pcapng capture
+ *				  -P port     UDP port of the datagrams, 0 any (60000)
+ *				  -k octets   header before the MessageFrame (16)
+ *				  -l loops    passes over the capture (1)
+ *				  -n          extract only, no decoding
+ *				  -u a.b.c.d:port  send over UDP instead of decoding
+ *				  -w file     annotated pcapng
+ *				  -v          value text in the annotations
+ *				  -o file     decode stats snapshot (JSON)
+ *
+ * Returns		: 0, 1 on error
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	PCAP_READER reader;
+	PCAP_WRITER writer;
+	PCAP_RECORD record;
+	struct sockaddr_in addr;
+	unsigned long long start, cnt = 0, bytes = 0, errorCnt = 0;
+	unsigned int loop;
+	int fd = -1, ret = 0;
+
+	if (HAE_OK != sParseArgs(argc, argv, &decode_config))
+	{
+		return 1;
+	}
+	/* before the first context, it installs the heap count */
+	DecodeStats_Init(&decode_stats);
+
+	if ((HAE_NULL != decode_config.pTarget) && ((fd = sOpenTarget(decode_config.pTarget, &addr)) < 0))
+	{
+		return 1;
+	}
+	if (HAE_OK != PcapFile_OpenReader(&reader, decode_config.pFile, decode_config.port))
+	{
+		return 1;
+	}
+	if ((HAE_NULL != decode_config.pOutPath) &&
+		(HAE_OK != PcapFile_OpenWriter(&writer, decode_config.pOutPath, argv[0])))
+	{
+		PcapFile_CloseReader(&reader);
+		return 1;
+	}
+
+	start = DecodeStats_Now();
+	for (loop = 0; loop < decode_config.loops; loop++)
+	{
+		if ((loop > 0) && (HAE_OK != PcapFile_Rewind(&reader)))
+		{
+			break;
+		}
+		while (HAE_OK == PcapFile_Next(&reader, &record))
+		{
+			if (fd >= 0)
+			{
+				if (sendto(fd, record.pData, record.len, 0, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+				{
+					errorCnt++;
+				}
+			}
+			else if ((!decode_config.extractOnly) && (HAE_OK != sDecode(&record, &decode_config, &decode_comment)))
+			{
+				errorCnt++;
+			}
+			cnt++;
+			bytes += record.len;
+
+			/* the first pass only, the others are the same */
+			if ((HAE_NULL != decode_config.pOutPath) && (0 == loop) &&
+				(HAE_OK != PcapFile_Write(&writer, &record, (0 != decode_comment.len) ? decode_comment.text : HAE_NULL)))
+			{
+				printf("[PCAP] ERROR : write %s\n", decode_config.pOutPath);
+				ret = 1;
+				break;
+			}
+		}
+	}
+	sReport(&decode_config, &reader, cnt, bytes, errorCnt, (DecodeStats_Now() - start) * 1e-9);
+
+	if (HAE_NULL != decode_config.pOutPath)
+	{
+		printf("wrote %llu packets, %llu bytes to %s\n", writer.frameCnt, writer.byteCnt, decode_config.pOutPath);
+		PcapFile_CloseWriter(&writer);
+	}
+	PcapFile_CloseReader(&reader);
+	DecodeStats_Free(&decode_stats);
+	if (fd >= 0)
+	{
+		close(fd);
+	}
+
+	return ret;
+}
+
+static int sParseArgs(int argc, char **argv, PCAP_DECODE_CONFIG *pConfig)
+{
+	int opt;
+
+	while (-1 != (opt = getopt(argc, argv, "P:k:l:nu:w:vo:")))
+	{
+		switch (opt)
+		{
+			case 'P': pConfig->port = atoi(optarg); break;
+			case 'k': pConfig->offset = atoi(optarg); break;
+			case 'l': pConfig->loops = atoi(optarg); break;
+			case 'n': pConfig->extractOnly = HAE_TRUE; break;
+			case 'u': pConfig->pTarget = optarg; break;
+			case 'w': pConfig->pOutPath = optarg; break;
+			case 'v': pConfig->verbose = HAE_TRUE; break;
+			case 'o': pConfig->pStatsPath = optarg; break;
+			default:
+				optind = argc + 1;
+				break;
+		}
+	}
+	if (optind != argc - 1)
+	{
+		printf("usage: %s [-P port] [-k offset] [-l loops] [-n] [-u a.b.c.d:port] [-w out.pcapng [-v]] "
+			"[-o stats.json] file\n", argv[0]);
+		return HAE_ERROR;
+	}
+	pConfig->pFile = argv[optind];
+
+	return HAE_OK;
+}
+
+static int sOpenTarget(const char *pTarget, struct sockaddr_in *pAddr)
+{
+	char host[64];
+	unsigned int port;
+	int fd;
+
+	memset(pAddr, 0x00, sizeof(struct sockaddr_in));
+	pAddr->sin_family = AF_INET;
+	if ((2 != sscanf(pTarget, "%63[^:]:%u", host, &port)) || (port > 65535) || (1 != inet_pton(AF_INET, host, &pAddr->sin_addr)))
+	{
+		printf("[PCAP] ERROR : bad target %s\n", pTarget);
+		return -1;
+	}
+	pAddr->sin_port = htons(port);
+	if ((fd = socket(AF_INET, SOCK_DGRAM, 0)) < 0)
+	{
+		printf("[PCAP] ERROR : socket() (%s)\n", strerror(errno));
+	}
+
+	return fd;
+}
+
+/* the decode path of decodeSample; the comment says what came of it */
+static int sDecode(const PCAP_RECORD *pRecord, const PCAP_DECODE_CONFIG *pConfig, PCAP_COMMENT *pComment)
+{
+	unsigned long long rxNs, decodedNs;
+	size_t heap;
+	const ASN_TYPE *pType;
+	MessageFrame frame;
+	void *pValue;
+	OSCTXT ctxt;
+	int status;
+
+	pComment->len = 0;
+	pComment->text[0] = '\0';
+	if (pRecord->len <= pConfig->offset)
+	{
+		sAppend(pComment, "%u octets, shorter than the %u octet header", pRecord->len, pConfig->offset);
+		return HAE_ERROR;
+	}
+
+	rxNs = DecodeStats_Now();
+	heap = DecodeStats_HeapBytes();
+	rtInitContext(&ctxt);
+	status = AsnType_DecodeFrame(&ctxt, pRecord->pData + pConfig->offset, pRecord->len - pConfig->offset, &frame,
+		&pType, &pValue);
+	decodedNs = DecodeStats_Now();
+	heap = DecodeStats_HeapBytes() - heap;
+
+	if (HAE_NULL != pConfig->pOutPath)
+	{
+		sAppend(pComment, "%s (%u) %u octets, decode %s", (HAE_NULL != pType) ? pType->pName : "MessageFrame",
+			(unsigned int)frame.messageId, pRecord->len - pConfig->offset, (0 == status) ? "ok" : "error");
+		if (0 != status)
+		{
+			sAppend(pComment, " %d", status);
+		}
+		else if ((pConfig->verbose) && (0 != pType->pfPrint))
+		{
+			sAppend(pComment, "\n");
+			rtxSetPrintStream(&ctxt, sPrint, pComment);
+			pType->pfPrint(&ctxt, pType->pName, pValue);
+		}
+	}
+	rtFreeContext(&ctxt);
+
+	DecodeStats_Record(&decode_stats, frame.messageId, pRecord->len - pConfig->offset, status, rxNs, decodedNs, 0, heap);
+
+	return (0 == status) ? HAE_OK : HAE_ERROR;
+}
+
+static void sAppend(PCAP_COMMENT *pComment, const char *pFormat, ...)
+{
+	va_list args;
+
+	va_start(args, pFormat);
+	sPrint(pComment, pFormat, args);
+	va_end(args);
+}
+
+/* print stream into the comment, cut at its end */
+static void sPrint(void *pPrntStrmInfo, const char *fmtspec, va_list arglist)
+{
+	PCAP_COMMENT *pComment = (PCAP_COMMENT *)pPrntStrmInfo;
+	int len;
+
+	if (pComment->len >= PCAP_COMMENT_MAX)
+	{
+		return;
+	}
+	len = vsnprintf(&pComment->text[pComment->len], PCAP_COMMENT_MAX + 1 - pComment->len, fmtspec, arglist);
+	if (len > 0)
+	{
+		pComment->len += len;
+		pComment->len = (pComment->len > PCAP_COMMENT_MAX) ? PCAP_COMMENT_MAX : pComment->len;
+	}
+}
+
+static void sReport(const PCAP_DECODE_CONFIG *pConfig, const PCAP_READER *pReader, unsigned long long cnt,
+	unsigned long long bytes, unsigned long long errorCnt, double elapsed)
+{
+	const STATS_MSG *pMsg;
+	const ASN_TYPE *pType;
+	const char *pText;
+	unsigned int i;
+	size_t len;
+	FILE *pFile;
+
+	printf("%s: %llu frames, %llu UDP datagrams of port %u, %llu other, %llu fragments, %llu truncated\n",
+		pReader->pcapng ? "pcapng" : "pcap", pReader->frameCnt, pReader->udpCnt, pConfig->port, pReader->otherCnt,
+		pReader->fragCnt, pReader->truncCnt);
+	printf("%s %llu datagrams, %llu bytes in %.3f s = %.0f msg/s, %.2f MB/s (file %.2f MB/s), %llu %s errors\n",
+		(HAE_NULL != pConfig->pTarget) ? "sent" : (pConfig->extractOnly ? "extracted" : "decoded"), cnt, bytes, elapsed,
+		(elapsed > 0) ? cnt / elapsed : 0.0, (elapsed > 0) ? bytes / elapsed * 1e-6 : 0.0,
+		(elapsed > 0) ? pReader->mapLen * (double)pConfig->loops / elapsed * 1e-6 : 0.0, errorCnt,
+		(HAE_NULL != pConfig->pTarget) ? "send" : "decode");
+	if ((HAE_NULL != pConfig->pTarget) || (pConfig->extractOnly))
+	{
+		return;
+	}
+
+	printf("%-24s %10s %8s %12s %12s\n", "message", "decoded", "errors", "decode p50", "decode p99");
+	for (i = 0; i < STATS_MSG_CNT; i++)
+	{
+		pMsg = &decode_stats.msg[i];
+		if (0 == pMsg->msgCnt)
+		{
+			continue;
+		}
+		pType = AsnType_FindMessage(pMsg->messageId);
+		printf("%-24s %10llu %8llu %9.1f us %9.1f us\n", (HAE_NULL != pType) ? pType->pName : "unknown",
+			pMsg->msgCnt, pMsg->errorCnt, DecodeStats_HistPercentile(&pMsg->lat[STATS_LAT_DECODE], 0.5) * 1e-3,
+			DecodeStats_HistPercentile(&pMsg->lat[STATS_LAT_DECODE], 0.99) * 1e-3);
+	}
+
+	if (HAE_NULL != pConfig->pStatsPath)
+	{
+		pText = DecodeStats_Snapshot(&decode_stats, &len);
+		if ((HAE_NULL == (pFile = fopen(pConfig->pStatsPath, "w"))) || (len != fwrite(pText, 1, len, pFile)))
+		{
+			printf("[PCAP] ERROR : cannot write %s\n", pConfig->pStatsPath);
+		}
+		if (HAE_NULL != pFile)
+		{
+			fclose(pFile);
+		}
+	}
+}
@@ -0,0 +1,691 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <byteswap.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <arpa/inet.h>
+
+#include "haeCommon.h"
+#include "pcapFile.h"
+
+#define PCAP_FILE_HDR_LEN		24
+#define PCAP_REC_HDR_LEN		16
+#define PCAP_WRITE_BUF_SIZE		(1024 * 1024)
+#define PCAP_IPV4_HDR_LEN		20
+#define PCAP_UDP_HDR_LEN		8
+
+static unsigned int sU32(const PCAP_READER *pReader, const unsigned char *p);
+static unsigned int sU16(const PCAP_READER *pReader, const unsigned char *p);
+static unsigned int sBe16(const unsigned char *p);
+static int sNextFrame(PCAP_READER *pReader, unsigned int *pIntf, unsigned long long *pTs, const unsigned char **ppFrame,
+	unsigned int *pCapLen);
+static void sAddInterface(PCAP_READER *pReader, const unsigned char *pBlock, unsigned int blockLen);
+static int sParseFrame(PCAP_READER *pReader, unsigned int linkType, const unsigned char *p, unsigned int capLen,
+	PCAP_RECORD *pRecord);
+static int sParseUdp(PCAP_READER *pReader, const unsigned char *p, unsigned int len, PCAP_RECORD *pRecord);
+static void sWriteOption(FILE *pFile, unsigned short code, const void *pValue, unsigned short len);
+static unsigned short sIpChecksum(const unsigned char *pHdr, unsigned int len);
+
+/*************************************************************
+ *
+ * Function 		: PcapFile_OpenReader
+ *
+ * Description	: Map a pcap or pcapng file.
+ *
+ * Parameter	: port - UDP port of the datagrams, source or
+ *				  destination; 0 for every UDP datagram
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int PcapFile_OpenReader(PCAP_READER *pReader, const char *pPath, unsigned short port)
+{
+	struct stat st;
+	void *pMap;
+
+	memset(pReader, 0x00, sizeof(PCAP_READER));
+	pReader->port = port;
+	if ((pReader->fd = open(pPath, O_RDONLY)) < 0)
+	{
+		printf("[PCAP] ERROR : cannot open %s (%s)\n", pPath, strerror(errno));
+		return HAE_ERROR;
+	}
+	if ((0 != fstat(pReader->fd, &st)) || ((size_t)st.st_size < PCAP_FILE_HDR_LEN))
+	{
+		printf("[PCAP] ERROR : %s is too short\n", pPath);
+		PcapFile_CloseReader(pReader);
+		return HAE_ERROR;
+	}
+	pMap = mmap(HAE_NULL, st.st_size, PROT_READ, MAP_PRIVATE, pReader->fd, 0);
+	if (MAP_FAILED == pMap)
+	{
+		printf("[PCAP] ERROR : mmap %s (%s)\n", pPath, strerror(errno));
+		PcapFile_CloseReader(pReader);
+		return HAE_ERROR;
+	}
+	madvise(pMap, st.st_size, MADV_SEQUENTIAL);
+	pReader->pMap = (const unsigned char *)pMap;
+	pReader->mapLen = st.st_size;
+
+	if (HAE_OK != PcapFile_Rewind(pReader))
+	{
+		printf("[PCAP] ERROR : %s is neither pcap nor pcapng\n", pPath);
+		PcapFile_CloseReader(pReader);
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+int PcapFile_Rewind(PCAP_READER *pReader)
+{
+	unsigned int magic;
+
+	memcpy(&magic, pReader->pMap, sizeof(magic));
+	pReader->intfCnt = 0;
+	pReader->pos = 0;
+
+	if (PCAPNG_SHB == magic)
+	{
+		/* the section header block sets the byte order */
+		pReader->pcapng = HAE_TRUE;
+		return HAE_OK;
+	}
+
+	pReader->pcapng = HAE_FALSE;
+	if ((PCAP_MAGIC_US == magic) || (PCAP_MAGIC_NS == magic))
+	{
+		pReader->swap = HAE_FALSE;
+	}
+	else if ((bswap_32(PCAP_MAGIC_US) == magic) || (bswap_32(PCAP_MAGIC_NS) == magic))
+	{
+		pReader->swap = HAE_TRUE;
+		magic = bswap_32(magic);
+	}
+	else
+	{
+		return HAE_ERROR;
+	}
+	pReader->intf[0].linkType = sU32(pReader, pReader->pMap + 20) & 0xffff;
+	pReader->intf[0].tsUnits = (PCAP_MAGIC_NS == magic) ? 1000000000ULL : 1000000ULL;
+	pReader->intfCnt = 1;
+	pReader->pos = PCAP_FILE_HDR_LEN;
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: PcapFile_Next
+ *
+ * Description	: The next UDP datagram of the port. Frames of other
+ *				  traffic are counted and passed over.
+ *
+ * Returns		: HAE_OK, HAE_ERROR at the end of the file
+ *
+ *************************************************************/
+int PcapFile_Next(PCAP_READER *pReader, PCAP_RECORD *pRecord)
+{
+	const unsigned char *pFrame;
+	unsigned long long ts, units;
+	unsigned int intf, capLen;
+
+	while (HAE_OK == sNextFrame(pReader, &intf, &ts, &pFrame, &capLen))
+	{
+		pReader->frameCnt++;
+		if ((intf >= pReader->intfCnt) ||
+			(HAE_OK != sParseFrame(pReader, pReader->intf[intf].linkType, pFrame, capLen, pRecord)))
+		{
+			continue;
+		}
+		units = pReader->intf[intf].tsUnits;
+		pRecord->timeNs = ts / units * 1000000000ULL + ts % units * 1000000000ULL / units;
+		pReader->udpCnt++;
+		return HAE_OK;
+	}
+
+	return HAE_ERROR;
+}
+
+void PcapFile_CloseReader(PCAP_READER *pReader)
+{
+	if (HAE_NULL != pReader->pMap)
+	{
+		munmap((void *)pReader->pMap, pReader->mapLen);
+		pReader->pMap = HAE_NULL;
+	}
+	if (pReader->fd >= 0)
+	{
+		close(pReader->fd);
+		pReader->fd = -1;
+	}
+}
+
+/*************************************************************
+ *
+ * Function 		: PcapFile_OpenWriter
+ *
+ * Description	: Create a pcapng file: section header and the one
+ *				  raw IPv4 interface, nanosecond time stamps.
+ *
+ * Parameter	: pApplication - shb_userappl, NULL for none
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int PcapFile_OpenWriter(PCAP_WRITER *pWriter, const char *pPath, const char *pApplication)
+{
+	unsigned int hdr[4], len, appLen = 0;
+	unsigned short version[2] = { 1, 0 };
+	unsigned char tsResol = 9;
+	long long sectionLen = -1;
+
+	memset(pWriter, 0x00, sizeof(PCAP_WRITER));
+	if (HAE_NULL == (pWriter->pFile = fopen(pPath, "wb")))
+	{
+		printf("[PCAP] ERROR : cannot create %s (%s)\n", pPath, strerror(errno));
+		return HAE_ERROR;
+	}
+	setvbuf(pWriter->pFile, HAE_NULL, _IOFBF, PCAP_WRITE_BUF_SIZE);
+
+	/* section header: type, length, byte order, version, section length, options */
+	if (HAE_NULL != pApplication)
+	{
+		appLen = strlen(pApplication);
+	}
+	len = 28 + ((0 != appLen) ? 4 + ((appLen + 3) & ~3U) : 0) + 4;
+	hdr[0] = PCAPNG_SHB;
+	hdr[1] = len;
+	hdr[2] = PCAPNG_BOM;
+	fwrite(hdr, sizeof(unsigned int), 3, pWriter->pFile);
+	fwrite(version, sizeof(version), 1, pWriter->pFile);
+	fwrite(&sectionLen, sizeof(sectionLen), 1, pWriter->pFile);
+	if (0 != appLen)
+	{
+		sWriteOption(pWriter->pFile, 4, pApplication, appLen);
+	}
+	sWriteOption(pWriter->pFile, 0, HAE_NULL, 0);
+	fwrite(&len, sizeof(len), 1, pWriter->pFile);
+
+	/* interface: type, length, link type, snap length, if_tsresol */
+	len = 20 + 8 + 4;
+	hdr[0] = PCAPNG_IDB;
+	hdr[1] = len;
+	hdr[2] = PCAP_LINK_IPV4;
+	hdr[3] = 0;
+	fwrite(hdr, sizeof(unsigned int), 4, pWriter->pFile);
+	sWriteOption(pWriter->pFile, 9, &tsResol, 1);
+	sWriteOption(pWriter->pFile, 0, HAE_NULL, 0);
+	fwrite(&len, sizeof(len), 1, pWriter->pFile);
+
+	if (0 != ferror(pWriter->pFile))
+	{
+		printf("[PCAP] ERROR : write %s\n", pPath);
+		PcapFile_CloseWriter(pWriter);
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: PcapFile_Write
+ *
+ * Description	: One datagram as an enhanced packet block, with an
+ *				  IPv4 / UDP header from the source and destination
+ *				  port of pRecord.
+ *
+ * Parameter	: pComment - opt_comment, NULL for none; cut at
+ *				  PCAP_COMMENT_MAX octets
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+int PcapFile_Write(PCAP_WRITER *pWriter, const PCAP_RECORD *pRecord, const char *pComment)
+{
+	static const unsigned char pad[4] = { 0, };
+	unsigned char ip[PCAP_IPV4_HDR_LEN + PCAP_UDP_HDR_LEN];
+	unsigned int hdr[7], frameLen, commentLen = 0, len;
+	unsigned short sum;
+
+	if ((HAE_NULL == pWriter->pFile) || (pRecord->len > 65535 - sizeof(ip)))
+	{
+		return HAE_ERROR;
+	}
+	if (HAE_NULL != pComment)
+	{
+		commentLen = strlen(pComment);
+		commentLen = (commentLen > PCAP_COMMENT_MAX) ? PCAP_COMMENT_MAX : commentLen;
+	}
+	frameLen = sizeof(ip) + pRecord->len;
+
+	/* IPv4, DF, TTL 64, UDP, to the broadcast address; UDP without checksum */
+	memset(ip, 0x00, sizeof(ip));
+	ip[0] = 0x45;
+	ip[2] = frameLen >> 8;
+	ip[3] = frameLen;
+	ip[6] = 0x40;
+	ip[8] = 64;
+	ip[9] = 17;
+	memcpy(&ip[12], &pRecord->source.sin_addr.s_addr, 4);
+	memset(&ip[16], 0xff, 4);
+	sum = sIpChecksum(ip, PCAP_IPV4_HDR_LEN);
+	ip[10] = sum >> 8;
+	ip[11] = sum;
+	memcpy(&ip[20], &pRecord->source.sin_port, 2);
+	ip[22] = pRecord->dstPort >> 8;
+	ip[23] = pRecord->dstPort;
+	ip[24] = (PCAP_UDP_HDR_LEN + pRecord->len) >> 8;
+	ip[25] = PCAP_UDP_HDR_LEN + pRecord->len;
+
+	len = 28 + ((frameLen + 3) & ~3U) + ((0 != commentLen) ? 4 + ((commentLen + 3) & ~3U) + 4 : 0) + 4;
+	hdr[0] = PCAPNG_EPB;
+	hdr[1] = len;
+	hdr[2] = 0;
+	hdr[3] = pRecord->timeNs >> 32;
+	hdr[4] = (unsigned int)pRecord->timeNs;
+	hdr[5] = frameLen;
+	hdr[6] = frameLen;
+	fwrite(hdr, sizeof(unsigned int), 7, pWriter->pFile);
+	fwrite(ip, sizeof(ip), 1, pWriter->pFile);
+	fwrite(pRecord->pData, 1, pRecord->len, pWriter->pFile);
+	fwrite(pad, 1, (4 - (frameLen & 3)) & 3, pWriter->pFile);
+	if (0 != commentLen)
+	{
+		sWriteOption(pWriter->pFile, 1, pComment, commentLen);
+		sWriteOption(pWriter->pFile, 0, HAE_NULL, 0);
+	}
+	fwrite(&len, sizeof(len), 1, pWriter->pFile);
+
+	pWriter->frameCnt++;
+	pWriter->byteCnt += len;
+
+	return (0 == ferror(pWriter->pFile)) ? HAE_OK : HAE_ERROR;
+}
+
+void PcapFile_CloseWriter(PCAP_WRITER *pWriter)
+{
+	if (HAE_NULL != pWriter->pFile)
+	{
+		if (0 != fclose(pWriter->pFile))
+		{
+			printf("[PCAP] ERROR : close (%s)\n", strerror(errno));
+		}
+		pWriter->pFile = HAE_NULL;
+	}
+}
+
+static unsigned int sU32(const PCAP_READER *pReader, const unsigned char *p)
+{
+	unsigned int val;
+
+	memcpy(&val, p, sizeof(val));
+
+	return pReader->swap ? bswap_32(val) : val;
+}
+
+static unsigned int sU16(const PCAP_READER *pReader, const unsigned char *p)
+{
+	unsigned short val;
+
+	memcpy(&val, p, sizeof(val));
+
+	return pReader->swap ? bswap_16(val) : val;
+}
+
+static unsigned int sBe16(const unsigned char *p)
+{
+	return (p[0] << 8) | p[1];
+}
+
+/* the next frame of either format; pcapng blocks other than packets are
+   taken in (section header, interfaces) or passed over */
+static int sNextFrame(PCAP_READER *pReader, unsigned int *pIntf, unsigned long long *pTs, const unsigned char **ppFrame,
+	unsigned int *pCapLen)
+{
+	const unsigned char *pBlock;
+	unsigned int type, len, bom, capLen;
+
+	if (!pReader->pcapng)
+	{
+		if (pReader->pos + PCAP_REC_HDR_LEN > pReader->mapLen)
+		{
+			return HAE_ERROR;
+		}
+		pBlock = pReader->pMap + pReader->pos;
+		capLen = sU32(pReader, pBlock + 8);
+		if (pReader->pos + PCAP_REC_HDR_LEN + capLen > pReader->mapLen)
+		{
+			/* the capture stopped in the middle of a frame */
+			return HAE_ERROR;
+		}
+		*pIntf = 0;
+		*pTs = (unsigned long long)sU32(pReader, pBlock) * pReader->intf[0].tsUnits + sU32(pReader, pBlock + 4);
+		*ppFrame = pBlock + PCAP_REC_HDR_LEN;
+		*pCapLen = capLen;
+		pReader->pos += PCAP_REC_HDR_LEN + capLen;
+		return HAE_OK;
+	}
+
+	while (pReader->pos + 12 <= pReader->mapLen)
+	{
+		pBlock = pReader->pMap + pReader->pos;
+		memcpy(&type, pBlock, sizeof(type));
+		if (PCAPNG_SHB == type)
+		{
+			memcpy(&bom, pBlock + 8, sizeof(bom));
+			if ((PCAPNG_BOM != bom) && (bswap_32(PCAPNG_BOM) != bom))
+			{
+				printf("[PCAP] ERROR : section header without byte order\n");
+				return HAE_ERROR;
+			}
+			pReader->swap = (PCAPNG_BOM != bom);
+			pReader->intfCnt = 0;
+		}
+		type = sU32(pReader, pBlock);
+		len = sU32(pReader, pBlock + 4);
+		if ((len < 12) || (0 != (len & 3)) || (pReader->pos + len > pReader->mapLen))
+		{
+			return HAE_ERROR;
+		}
+		pReader->pos += len;
+
+		switch (type)
+		{
+			case PCAPNG_IDB:
+				sAddInterface(pReader, pBlock, len);
+				break;
+			case PCAPNG_EPB:
+				if (len < 32)
+				{
+					break;
+				}
+				capLen = sU32(pReader, pBlock + 20);
+				if (capLen > len - 32)
+				{
+					break;
+				}
+				*pIntf = sU32(pReader, pBlock + 8);
+				*pTs = ((unsigned long long)sU32(pReader, pBlock + 12) << 32) | sU32(pReader, pBlock + 16);
+				*ppFrame = pBlock + 28;
+				*pCapLen = capLen;
+				return HAE_OK;
+			case PCAPNG_SPB:
+				/* no time stamp, snapped to the block */
+				if (len < 16)
+				{
+					break;
+				}
+				capLen = sU32(pReader, pBlock + 8);
+				*pIntf = 0;
+				*pTs = 0;
+				*ppFrame = pBlock + 12;
+				*pCapLen = (capLen < len - 16) ? capLen : len - 16;
+				return HAE_OK;
+			default:
+				break;
+		}
+	}
+
+	return HAE_ERROR;
+}
+
+static void sAddInterface(PCAP_READER *pReader, const unsigned char *pBlock, unsigned int blockLen)
+{
+	PCAP_IF *pIf;
+	unsigned int pos, code, len, i;
+	unsigned char resol;
+
+	if (pReader->intfCnt >= PCAP_IF_MAX)
+	{
+		/* frames of it are passed over */
+		return;
+	}
+	pIf = &pReader->intf[pReader->intfCnt++];
+	pIf->linkType = (blockLen >= 20) ? sU16(pReader, pBlock + 8) : 0xffff;
+	pIf->tsUnits = 1000000ULL;
+
+	/* options up to the trailing length */
+	for (pos = 16; pos + 4 <= blockLen - 4; pos += 4 + ((len + 3) & ~3U))
+	{
+		code = sU16(pReader, pBlock + pos);
+		len = sU16(pReader, pBlock + pos + 2);
+		if ((0 == code) || (pos + 4 + len > blockLen - 4))
+		{
+			break;
+		}
+		if ((9 == code) && (1 == len))
+		{
+			/* if_tsresol: 10^-n, or 2^-n with the top bit */
+			resol = pBlock[pos + 4];
+			if (resol & 0x80)
+			{
+				pIf->tsUnits = ((resol & 0x7f) < 64) ? 1ULL << (resol & 0x7f) : 0;
+			}
+			else
+			{
+				for (i = 0, pIf->tsUnits = 1; (i < resol) && (i < 19); i++)
+				{
+					pIf->tsUnits *= 10;
+				}
+			}
+			if (0 == pIf->tsUnits)
+			{
+				pIf->tsUnits = 1000000ULL;
+			}
+		}
+	}
+}
+
+static int sParseFrame(PCAP_READER *pReader, unsigned int linkType, const unsigned char *p, unsigned int capLen,
+	PCAP_RECORD *pRecord)
+{
+	unsigned int off, etherType, family, ihl, totalLen, next, extLen;
+
+	/* link layer -> ethertype */
+	switch (linkType)
+	{
+		case PCAP_LINK_ETHERNET:
+			if (capLen < 14)
+			{
+				goto trunc;
+			}
+			etherType = sBe16(p + 12);
+			off = 14;
+			/* 802.1Q / 802.1ad tags */
+			while ((0x8100 == etherType) || (0x88a8 == etherType) || (0x9100 == etherType))
+			{
+				if (capLen < off + 4)
+				{
+					goto trunc;
+				}
+				etherType = sBe16(p + off + 2);
+				off += 4;
+			}
+			break;
+		case PCAP_LINK_SLL:
+			if (capLen < 16)
+			{
+				goto trunc;
+			}
+			etherType = sBe16(p + 14);
+			off = 16;
+			break;
+		case PCAP_LINK_SLL2:
+			if (capLen < 20)
+			{
+				goto trunc;
+			}
+			etherType = sBe16(p);
+			off = 20;
+			break;
+		case PCAP_LINK_NULL:
+		case PCAP_LINK_LOOP:
+			/* address family in the byte order of the capturing host */
+			if (capLen < 4)
+			{
+				goto trunc;
+			}
+			memcpy(&family, p, sizeof(family));
+			family = ((family & 0xffff) == 0) ? bswap_32(family) : family;
+			etherType = (2 == family) ? 0x0800 : (((24 == family) || (28 == family) || (30 == family)) ? 0x86dd : 0);
+			off = 4;
+			break;
+		case PCAP_LINK_RAW:
+		case PCAP_LINK_IPV4:
+		case PCAP_LINK_IPV6:
+			if (capLen < 1)
+			{
+				goto trunc;
+			}
+			etherType = (4 == (p[0] >> 4)) ? 0x0800 : ((6 == (p[0] >> 4)) ? 0x86dd : 0);
+			off = 0;
+			break;
+		default:
+			pReader->otherCnt++;
+			return HAE_ERROR;
+	}
+
+	memset(&pRecord->source, 0x00, sizeof(pRecord->source));
+	pRecord->source.sin_family = AF_INET;
+	if (0x0800 == etherType)
+	{
+		if (capLen < off + 20)
+		{
+			goto trunc;
+		}
+		ihl = (p[off] & 0x0f) * 4;
+		totalLen = sBe16(p + off + 2);
+		if ((4 != (p[off] >> 4)) || (ihl < 20) || (17 != p[off + 9]) || (totalLen < ihl))
+		{
+			pReader->otherCnt++;
+			return HAE_ERROR;
+		}
+		if (sBe16(p + off + 6) & 0x3fff)
+		{
+			/* more fragments or not the first */
+			pReader->fragCnt++;
+			return HAE_ERROR;
+		}
+		memcpy(&pRecord->source.sin_addr.s_addr, p + off + 12, 4);
+		if (capLen < off + totalLen)
+		{
+			goto trunc;
+		}
+		return sParseUdp(pReader, p + off + ihl, totalLen - ihl, pRecord);
+	}
+	if (0x86dd == etherType)
+	{
+		if (capLen < off + 40)
+		{
+			goto trunc;
+		}
+		totalLen = 40 + sBe16(p + off + 4);
+		if (capLen < off + totalLen)
+		{
+			goto trunc;
+		}
+		next = p[off + 6];
+		p += off;
+		off = 40;
+		/* hop-by-hop, routing, destination options */
+		while ((0 == next) || (43 == next) || (60 == next))
+		{
+			if (off + 8 > totalLen)
+			{
+				goto trunc;
+			}
+			next = p[off];
+			extLen = (p[off + 1] + 1) * 8;
+			off += extLen;
+		}
+		if (44 == next)
+		{
+			pReader->fragCnt++;
+			return HAE_ERROR;
+		}
+		if ((17 != next) || (off > totalLen))
+		{
+			pReader->otherCnt++;
+			return HAE_ERROR;
+		}
+		return sParseUdp(pReader, p + off, totalLen - off, pRecord);
+	}
+	pReader->otherCnt++;
+
+	return HAE_ERROR;
+
+trunc:
+	pReader->truncCnt++;
+
+	return HAE_ERROR;
+}
+
+static int sParseUdp(PCAP_READER *pReader, const unsigned char *p, unsigned int len, PCAP_RECORD *pRecord)
+{
+	unsigned int srcPort, dstPort, udpLen;
+
+	if (len < PCAP_UDP_HDR_LEN)
+	{
+		pReader->truncCnt++;
+		return HAE_ERROR;
+	}
+	srcPort = sBe16(p);
+	dstPort = sBe16(p + 2);
+	udpLen = sBe16(p + 4);
+	if ((0 != pReader->port) && (srcPort != pReader->port) && (dstPort != pReader->port))
+	{
+		pReader->otherCnt++;
+		return HAE_ERROR;
+	}
+	if ((udpLen < PCAP_UDP_HDR_LEN) || (udpLen > len))
+	{
+		pReader->truncCnt++;
+		return HAE_ERROR;
+	}
+
+	pRecord->source.sin_port = htons(srcPort);
+	pRecord->dstPort = dstPort;
+	pRecord->len = udpLen - PCAP_UDP_HDR_LEN;
+	pRecord->pData = p + PCAP_UDP_HDR_LEN;
+
+	return HAE_OK;
+}
+
+/* code, length, value padded to 4 octets */
+static void sWriteOption(FILE *pFile, unsigned short code, const void *pValue, unsigned short len)
+{
+	static const unsigned char pad[4] = { 0, };
+	unsigned short hdr[2];
+
+	hdr[0] = code;
+	hdr[1] = len;
+	fwrite(hdr, sizeof(hdr), 1, pFile);
+	if (0 != len)
+	{
+		fwrite(pValue, 1, len, pFile);
+		fwrite(pad, 1, (4 - (len & 3)) & 3, pFile);
+	}
+}
+
+static unsigned short sIpChecksum(const unsigned char *pHdr, unsigned int len)
+{
+	unsigned int i, sum = 0;
+
+	for (i = 0; i + 1 < len; i += 2)
+	{
+		sum += (pHdr[i] << 8) | pHdr[i + 1];
+	}
+	while (sum >> 16)
+	{
+		sum = (sum & 0xffff) + (sum >> 16);
+	}
+
+	return (unsigned short)~sum;
+}
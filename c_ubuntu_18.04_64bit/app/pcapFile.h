@@ -0,0 +1,88 @@
+#ifndef PCAP_FILE_H
+#define PCAP_FILE_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <netinet/in.h>
+
+/* Captures of tcpdump / Wireshark as a source of datagrams. The reader
+   maps a pcap (microsecond or nanosecond) or pcapng file and hands out
+   the UDP payloads to or from one port in place, link layer (Ethernet
+   with VLAN tags, Linux cooked v1 / v2, raw IP, BSD loopback), IPv4 and
+   IPv6 headers skipped. IP fragments are counted and left out, the
+   decoder never sees more than one datagram of a frame anyway.
+
+   The writer makes pcapng: one raw IPv4 interface with nanosecond time
+   stamps, every datagram with an IPv4 / UDP header in front and an
+   optional comment (opt_comment) Wireshark shows with the packet. */
+
+#define PCAP_MAGIC_US			0xa1b2c3d4
+#define PCAP_MAGIC_NS			0xa1b23c4d
+#define PCAPNG_SHB				0x0a0d0d0a
+#define PCAPNG_BOM				0x1a2b3c4d
+#define PCAPNG_IDB				0x00000001
+#define PCAPNG_SPB				0x00000003
+#define PCAPNG_EPB				0x00000006
+
+#define PCAP_LINK_NULL			0
+#define PCAP_LINK_ETHERNET		1
+#define PCAP_LINK_RAW			101
+#define PCAP_LINK_LOOP			108
+#define PCAP_LINK_SLL			113
+#define PCAP_LINK_IPV4			228
+#define PCAP_LINK_IPV6			229
+#define PCAP_LINK_SLL2			276
+
+#define PCAP_IF_MAX				16			/* pcapng interfaces per section */
+#define PCAP_COMMENT_MAX		65000
+
+typedef struct{
+	unsigned short linkType;
+	unsigned long long tsUnits;			/* time stamp units per second */
+} PCAP_IF;
+
+typedef struct{
+	int fd;
+	const unsigned char *pMap;
+	size_t mapLen;
+	size_t pos;
+	unsigned short port;				/* host order */
+
+	int pcapng;
+	int swap;							/* other byte order than the host */
+	PCAP_IF intf[PCAP_IF_MAX];
+	unsigned int intfCnt;
+
+	unsigned long long frameCnt;
+	unsigned long long udpCnt;			/* handed out */
+	unsigned long long otherCnt;		/* not UDP of the port */
+	unsigned long long fragCnt;
+	unsigned long long truncCnt;		/* snapped shorter than the datagram */
+} PCAP_READER;
+
+/* one datagram, pData points into the mapping; the source address is
+   zero for IPv6 */
+typedef struct{
+	unsigned long long timeNs;			/* CLOCK_REALTIME of the capture */
+	struct sockaddr_in source;
+	unsigned short dstPort;
+	unsigned int len;
+	const unsigned char *pData;
+} PCAP_RECORD;
+
+typedef struct{
+	FILE *pFile;
+	unsigned long long frameCnt;
+	unsigned long long byteCnt;
+} PCAP_WRITER;
+
+int PcapFile_OpenReader(PCAP_READER *pReader, const char *pPath, unsigned short port);
+int PcapFile_Next(PCAP_READER *pReader, PCAP_RECORD *pRecord);
+int PcapFile_Rewind(PCAP_READER *pReader);
+void PcapFile_CloseReader(PCAP_READER *pReader);
+
+int PcapFile_OpenWriter(PCAP_WRITER *pWriter, const char *pPath, const char *pApplication);
+int PcapFile_Write(PCAP_WRITER *pWriter, const PCAP_RECORD *pRecord, const char *pComment);
+void PcapFile_CloseWriter(PCAP_WRITER *pWriter);
+
+#endif
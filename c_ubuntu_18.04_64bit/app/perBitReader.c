@@ -0,0 +1,385 @@
+#define _GNU_SOURCE
+
+#include <rtxsrc/rtxBitDecode.h>
+#include <rtpersrc/asn1per.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dlfcn.h>
+
+#include "haeCommon.h"
+#include "perBitReader.h"
+
+/* library implementations, used for everything off the fast path */
+typedef struct{
+	int (*rtxDecBit)(OSCTXT *, OSBOOL *);
+	int (*rtxDecBits)(OSCTXT *, OSUINT32 *, OSSIZE);
+	int (*rtxDecBitsToByte)(OSCTXT *, OSUINT8 *, OSUINT8);
+	int (*rtxDecBitsToUInt16)(OSCTXT *, OSUINT16 *, OSUINT8);
+	int (*rtxDecBitsToSize)(OSCTXT *, OSSIZE *, OSSIZE);
+	int (*pd_ConsUnsigned)(OSCTXT *, OSUINT32 *, OSUINT64, OSUINT64);
+	int (*pd_ConsInteger)(OSCTXT *, OSINT32 *, OSINT64, OSINT64);
+	int (*pd_ConsInt8)(OSCTXT *, OSINT8 *, OSINT64, OSINT64);
+	int (*pd_ConsInt16)(OSCTXT *, OSINT16 *, OSINT64, OSINT64);
+	int (*pd_Length)(OSCTXT *, OSUINT32 *);
+	int (*pd_Length64)(OSCTXT *, OSSIZE *);
+	int (*pd_SmallLength)(OSCTXT *, OSUINT32 *);
+} PER_LIB_FUNCS;
+
+static PER_LIB_FUNCS per_lib;
+static volatile int per_resolved = HAE_FALSE;
+static volatile int per_enable = HAE_TRUE;
+
+#define PER_LIB(name) \
+	(per_resolved ? per_lib.name : (sResolve(), per_lib.name))
+
+/* fast path allowed for this context (bit reads) */
+#define PER_FAST(pctxt) \
+	(per_enable && (0 == (pctxt)->pStream) && (0 == (pctxt)->pBitFldList))
+
+/* fast path allowed for this context (UNALIGNED PER integers and lengths) */
+#define PER_FAST_UPER(pctxt) \
+	(PER_FAST(pctxt) && !(pctxt)->buffer.aligned)
+
+/* no effective size constraint pending; a constrained length is a
+   constrained whole number and is left to the library (X.691 11.9.4.1) */
+#define PER_UNSIZED(pctxt) \
+	((0 == (pctxt)->pASN1Info) || \
+	 ((0 == ACINFO(pctxt)->sizeConstraint.root.lower) && (0 == ACINFO(pctxt)->sizeConstraint.root.upper) && \
+	  (0 == ACINFO(pctxt)->sizeConstraint.ext.lower) && (0 == ACINFO(pctxt)->sizeConstraint.ext.upper)))
+
+static void sResolve(void);
+
+/* Left aligned 64 bit window at the bit cursor; returns the number of
+   valid bits in it. Past the last 8 bytes the rest is zero filled. */
+static inline unsigned int sWindow(const OSRTBuffer *pBuf, OSUINT64 *pWin)
+{
+	OSUINT64 w;
+	OSSIZE left;
+	unsigned int used = 8 - pBuf->bitOffset;
+	OSOCTET tail[8];
+
+	if (pBuf->byteIndex >= pBuf->size)
+	{
+		*pWin = 0;
+		return 0;
+	}
+
+	left = pBuf->size - pBuf->byteIndex;
+	if (left >= 8)
+	{
+		memcpy(&w, pBuf->data + pBuf->byteIndex, 8);
+		left = 8;
+	}
+	else
+	{
+		memset(tail, 0, sizeof(tail));
+		memcpy(tail, pBuf->data + pBuf->byteIndex, left);
+		memcpy(&w, tail, 8);
+	}
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	w = __builtin_bswap64(w);
+#endif
+
+	*pWin = w << used;
+
+	return (unsigned int)left * 8 - used;
+}
+
+static inline void sSkip(OSRTBuffer *pBuf, unsigned int nbits)
+{
+	unsigned int pos = (8 - pBuf->bitOffset) + nbits;
+
+	pBuf->byteIndex += pos >> 3;
+	pBuf->bitOffset = 8 - (pos & 7);
+}
+
+/* top nbits (1..64) of the window */
+#define PER_TOP(win, nbits)		((win) >> (64 - (nbits)))
+
+/* bits needed for a constrained whole number with this range (upper - lower) */
+static inline unsigned int sRangeBits(OSUINT64 range)
+{
+	return (0 == range) ? 0 : 64 - __builtin_clzll(range);
+}
+
+/* constrained whole number, HAE_OK with the cursor moved or HAE_ERROR untouched */
+static inline int sConsWhole(OSCTXT *pctxt, OSINT64 lower, OSINT64 upper, OSINT64 *pValue)
+{
+	OSUINT64 range, win, raw = 0;
+	unsigned int nbits, avail;
+
+	if (lower > upper)
+	{
+		return HAE_ERROR;
+	}
+
+	range = (OSUINT64)upper - (OSUINT64)lower;
+	if (range > 0xFFFFFFFFu)
+	{
+		return HAE_ERROR;
+	}
+
+	nbits = sRangeBits(range);
+	if (nbits > 0)
+	{
+		avail = sWindow(&pctxt->buffer, &win);
+		if (nbits > avail)
+		{
+			return HAE_ERROR;
+		}
+		raw = PER_TOP(win, nbits);
+		if (raw > range)
+		{
+			return HAE_ERROR;
+		}
+		sSkip(&pctxt->buffer, nbits);
+	}
+
+	*pValue = (OSINT64)((OSUINT64)lower + raw);
+
+	return HAE_OK;
+}
+
+void PerBitReader_Enable(int enable)
+{
+	per_enable = enable ? HAE_TRUE : HAE_FALSE;
+}
+
+int PerBitReader_IsEnabled(void)
+{
+	return per_enable;
+}
+
+int rtxDecBit(OSCTXT *pctxt, OSBOOL *pvalue)
+{
+	OSRTBuffer *pBuf = &pctxt->buffer;
+
+	if (PER_FAST(pctxt) && (pBuf->byteIndex < pBuf->size))
+	{
+		OSOCTET b = pBuf->data[pBuf->byteIndex];
+
+		pBuf->bitOffset--;
+		if (0 != pvalue)
+		{
+			*pvalue = (b >> pBuf->bitOffset) & 1;
+		}
+		if (0 == pBuf->bitOffset)
+		{
+			pBuf->bitOffset = 8;
+			pBuf->byteIndex++;
+		}
+		return 0;
+	}
+
+	return PER_LIB(rtxDecBit)(pctxt, pvalue);
+}
+
+int rtxDecBits(OSCTXT *pctxt, OSUINT32 *pvalue, OSSIZE nbits)
+{
+	OSUINT64 win;
+
+	if (PER_FAST(pctxt) && (nbits - 1 < 32) && (nbits <= sWindow(&pctxt->buffer, &win)))
+	{
+		if (0 != pvalue)
+		{
+			*pvalue = (OSUINT32)PER_TOP(win, nbits);
+		}
+		sSkip(&pctxt->buffer, (unsigned int)nbits);
+		return 0;
+	}
+
+	return PER_LIB(rtxDecBits)(pctxt, pvalue, nbits);
+}
+
+int rtxDecBitsToByte(OSCTXT *pctxt, OSUINT8 *pvalue, OSUINT8 nbits)
+{
+	OSUINT64 win;
+
+	if (PER_FAST(pctxt) && (nbits - 1u < 8) && (nbits <= sWindow(&pctxt->buffer, &win)))
+	{
+		*pvalue = (OSUINT8)PER_TOP(win, nbits);
+		sSkip(&pctxt->buffer, nbits);
+		return 0;
+	}
+
+	return PER_LIB(rtxDecBitsToByte)(pctxt, pvalue, nbits);
+}
+
+int rtxDecBitsToUInt16(OSCTXT *pctxt, OSUINT16 *pvalue, OSUINT8 nbits)
+{
+	OSUINT64 win;
+
+	if (PER_FAST(pctxt) && (nbits - 1u < 16) && (nbits <= sWindow(&pctxt->buffer, &win)))
+	{
+		*pvalue = (OSUINT16)PER_TOP(win, nbits);
+		sSkip(&pctxt->buffer, nbits);
+		return 0;
+	}
+
+	return PER_LIB(rtxDecBitsToUInt16)(pctxt, pvalue, nbits);
+}
+
+int rtxDecBitsToSize(OSCTXT *pctxt, OSSIZE *pvalue, OSSIZE nbits)
+{
+	OSUINT64 win;
+
+	if (PER_FAST(pctxt) && (nbits - 1 < 32) && (nbits <= sWindow(&pctxt->buffer, &win)))
+	{
+		*pvalue = (OSSIZE)PER_TOP(win, nbits);
+		sSkip(&pctxt->buffer, (unsigned int)nbits);
+		return 0;
+	}
+
+	return PER_LIB(rtxDecBitsToSize)(pctxt, pvalue, nbits);
+}
+
+int pd_ConsUnsigned(OSCTXT *pctxt, OSUINT32 *pvalue, OSUINT64 lower, OSUINT64 upper)
+{
+	OSINT64 value;
+
+	if (PER_FAST_UPER(pctxt) && (upper <= 0xFFFFFFFFu) &&
+		(HAE_OK == sConsWhole(pctxt, (OSINT64)lower, (OSINT64)upper, &value)))
+	{
+		*pvalue = (OSUINT32)value;
+		return 0;
+	}
+
+	return PER_LIB(pd_ConsUnsigned)(pctxt, pvalue, lower, upper);
+}
+
+int pd_ConsInteger(OSCTXT *pctxt, OSINT32 *pvalue, OSINT64 lower, OSINT64 upper)
+{
+	OSINT64 value;
+
+	if (PER_FAST_UPER(pctxt) && (lower >= OSINT32_MIN) && (upper <= OSINT32_MAX) &&
+		(HAE_OK == sConsWhole(pctxt, lower, upper, &value)))
+	{
+		*pvalue = (OSINT32)value;
+		return 0;
+	}
+
+	return PER_LIB(pd_ConsInteger)(pctxt, pvalue, lower, upper);
+}
+
+int pd_ConsInt8(OSCTXT *pctxt, OSINT8 *pvalue, OSINT64 lower, OSINT64 upper)
+{
+	OSINT64 value;
+
+	if (PER_FAST_UPER(pctxt) && (lower >= OSINT8_MIN) && (upper <= OSINT8_MAX) &&
+		(HAE_OK == sConsWhole(pctxt, lower, upper, &value)))
+	{
+		*pvalue = (OSINT8)value;
+		return 0;
+	}
+
+	return PER_LIB(pd_ConsInt8)(pctxt, pvalue, lower, upper);
+}
+
+int pd_ConsInt16(OSCTXT *pctxt, OSINT16 *pvalue, OSINT64 lower, OSINT64 upper)
+{
+	OSINT64 value;
+
+	if (PER_FAST_UPER(pctxt) && (lower >= OSINT16_MIN) && (upper <= OSINT16_MAX) &&
+		(HAE_OK == sConsWhole(pctxt, lower, upper, &value)))
+	{
+		*pvalue = (OSINT16)value;
+		return 0;
+	}
+
+	return PER_LIB(pd_ConsInt16)(pctxt, pvalue, lower, upper);
+}
+
+/* X.691 11.9.3.6 / 11.9.3.7, fragmented lengths (11.9.3.8) go to the library */
+static inline int sLength(OSCTXT *pctxt, OSSIZE *pValue)
+{
+	OSUINT64 win;
+	unsigned int avail = sWindow(&pctxt->buffer, &win);
+
+	if ((avail >= 8) && (0 == (win >> 63)))
+	{
+		*pValue = (OSSIZE)(win >> 56);
+		sSkip(&pctxt->buffer, 8);
+		return HAE_OK;
+	}
+	if ((avail >= 16) && (2 == (win >> 62)))
+	{
+		*pValue = (OSSIZE)((win >> 48) & 0x3fff);
+		sSkip(&pctxt->buffer, 16);
+		return HAE_OK;
+	}
+
+	return HAE_ERROR;
+}
+
+int pd_Length(OSCTXT *pctxt, OSUINT32 *pvalue)
+{
+	OSSIZE value;
+
+	if (PER_FAST_UPER(pctxt) && PER_UNSIZED(pctxt) && (HAE_OK == sLength(pctxt, &value)))
+	{
+		*pvalue = (OSUINT32)value;
+		return 0;
+	}
+
+	return PER_LIB(pd_Length)(pctxt, pvalue);
+}
+
+int pd_Length64(OSCTXT *pctxt, OSSIZE *pvalue)
+{
+	if (PER_FAST_UPER(pctxt) && PER_UNSIZED(pctxt) && (HAE_OK == sLength(pctxt, pvalue)))
+	{
+		return 0;
+	}
+
+	return PER_LIB(pd_Length64)(pctxt, pvalue);
+}
+
+/* X.691 11.9.3.4: '0' + 6 bits (n - 1) for n <= 64 */
+int pd_SmallLength(OSCTXT *pctxt, OSUINT32 *pvalue)
+{
+	OSUINT64 win;
+
+	if (PER_FAST_UPER(pctxt) && (sWindow(&pctxt->buffer, &win) >= 7) && (0 == (win >> 63)))
+	{
+		*pvalue = (OSUINT32)((win >> 57) & 0x3f) + 1;
+		sSkip(&pctxt->buffer, 7);
+		return 0;
+	}
+
+	return PER_LIB(pd_SmallLength)(pctxt, pvalue);
+}
+
+static void sResolve(void)
+{
+	PER_LIB_FUNCS funcs;
+
+	*(void **)&funcs.rtxDecBit = dlsym(RTLD_NEXT, "rtxDecBit");
+	*(void **)&funcs.rtxDecBits = dlsym(RTLD_NEXT, "rtxDecBits");
+	*(void **)&funcs.rtxDecBitsToByte = dlsym(RTLD_NEXT, "rtxDecBitsToByte");
+	*(void **)&funcs.rtxDecBitsToUInt16 = dlsym(RTLD_NEXT, "rtxDecBitsToUInt16");
+	*(void **)&funcs.rtxDecBitsToSize = dlsym(RTLD_NEXT, "rtxDecBitsToSize");
+	*(void **)&funcs.pd_ConsUnsigned = dlsym(RTLD_NEXT, "pd_ConsUnsigned");
+	*(void **)&funcs.pd_ConsInteger = dlsym(RTLD_NEXT, "pd_ConsInteger");
+	*(void **)&funcs.pd_ConsInt8 = dlsym(RTLD_NEXT, "pd_ConsInt8");
+	*(void **)&funcs.pd_ConsInt16 = dlsym(RTLD_NEXT, "pd_ConsInt16");
+	*(void **)&funcs.pd_Length = dlsym(RTLD_NEXT, "pd_Length");
+	*(void **)&funcs.pd_Length64 = dlsym(RTLD_NEXT, "pd_Length64");
+	*(void **)&funcs.pd_SmallLength = dlsym(RTLD_NEXT, "pd_SmallLength");
+
+	if ((0 == funcs.rtxDecBit) || (0 == funcs.rtxDecBits) || (0 == funcs.rtxDecBitsToByte) ||
+		(0 == funcs.rtxDecBitsToUInt16) || (0 == funcs.rtxDecBitsToSize) || (0 == funcs.pd_ConsUnsigned) ||
+		(0 == funcs.pd_ConsInteger) || (0 == funcs.pd_ConsInt8) || (0 == funcs.pd_ConsInt16) ||
+		(0 == funcs.pd_Length) || (0 == funcs.pd_Length64) || (0 == funcs.pd_SmallLength))
+	{
+		/* cannot continue without the library, every decode would crash */
+		printf("[PER] ERROR : bit reader cannot resolve the ASN.1 runtime: %s\n", dlerror());
+		abort();
+	}
+
+	/* the same values on every call, a race between threads is harmless */
+	per_lib = funcs;
+	__sync_synchronize();
+	per_resolved = HAE_TRUE;
+}
@@ -0,0 +1,16 @@
+#ifndef PER_BIT_READER_H
+#define PER_BIT_READER_H
+
+/* perBitReader.o replaces the UPER bit primitives of libasn1rt/libasn1per
+   (rtxDecBit, rtxDecBits*, pd_ConsUnsigned, pd_ConsInteger, pd_ConsInt8/16,
+   pd_Length, pd_Length64, pd_SmallLength) for everything linked into the
+   program, including the asn1PD_* functions of libtrafficinfo1. Each call
+   reads one big endian 64 bit window at the bit cursor and extracts the
+   field with shifts. Streams, ALIGNED PER, bit field tracing, fragmented
+   lengths, constraint violations and the end of the buffer are passed to
+   the library functions unchanged. */
+
+void PerBitReader_Enable(int enable);
+int PerBitReader_IsEnabled(void);
+
+#endif
@@ -0,0 +1,241 @@
+#define _GNU_SOURCE
+
+#include <rtxsrc/rtxBitEncode.h>
+#include <rtxsrc/rtxBuffer.h>
+#include <rtpersrc/asn1per.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dlfcn.h>
+
+#include "haeCommon.h"
+#include "perBitWriter.h"
+
+/* library implementations, used for everything off the fast path */
+typedef struct{
+	int (*rtxEncBit)(OSCTXT *, OSBOOL);
+	int (*rtxEncBits)(OSCTXT *, OSUINT32, size_t);
+	int (*pe_ConsUInt64)(OSCTXT *, OSUINT64, OSUINT64, OSUINT64);
+	int (*pe_ConsInt64)(OSCTXT *, OSINT64, OSINT64, OSINT64);
+	int (*pe_ConsWholeNumber)(OSCTXT *, OSUINT32, OSUINT32);
+	int (*pe_ConsWholeNumber64)(OSCTXT *, OSUINT64, OSUINT64);
+	int (*pe_Length)(OSCTXT *, OSSIZE);
+	int (*pe_SmallLength)(OSCTXT *, OSSIZE);
+} PER_ENC_LIB_FUNCS;
+
+static PER_ENC_LIB_FUNCS per_enc_lib;
+static volatile int per_enc_resolved = HAE_FALSE;
+static volatile int per_enc_enable = HAE_TRUE;
+
+#define PER_ENC_LIB(name) \
+	(per_enc_resolved ? per_enc_lib.name : (sResolve(), per_enc_lib.name))
+
+/* fast path allowed for this context, PER_WRITER_SLACK bytes of room */
+#define PER_ENC_FAST(pctxt) \
+	(per_enc_enable && (0 == (pctxt)->pStream) && (0 == (pctxt)->pBitFldList) && \
+	 ((pctxt)->buffer.byteIndex + PER_WRITER_SLACK <= (pctxt)->buffer.size))
+
+/* fast path allowed for this context (UNALIGNED PER integers and lengths) */
+#define PER_ENC_FAST_UPER(pctxt) \
+	(PER_ENC_FAST(pctxt) && !(pctxt)->buffer.aligned)
+
+/* no effective size constraint pending (see perBitReader.c) */
+#define PER_ENC_UNSIZED(pctxt) \
+	((0 == (pctxt)->pASN1Info) || \
+	 ((0 == ACINFO(pctxt)->sizeConstraint.root.lower) && (0 == ACINFO(pctxt)->sizeConstraint.root.upper) && \
+	  (0 == ACINFO(pctxt)->sizeConstraint.ext.lower) && (0 == ACINFO(pctxt)->sizeConstraint.ext.upper)))
+
+/* widest field sPut takes: 7 bits already in the byte + 56 fit one word */
+#define PER_ENC_MAXBITS			56
+
+static void sResolve(void);
+
+/* Append the low nbits (1..PER_ENC_MAXBITS) of value at the bit cursor.
+   The caller guarantees 8 bytes of room. Bits already in the current byte
+   are kept, the rest of the last byte written is zero like the library
+   leaves it, bytes after it are stored back unchanged. */
+static inline void sPut(OSRTBuffer *pBuf, OSUINT64 value, unsigned int nbits)
+{
+	OSUINT64 w, keep, rest;
+	unsigned int used = 8 - pBuf->bitOffset;
+	unsigned int end = used + nbits;
+	unsigned int touched = (end + 7) & ~7u;
+	OSOCTET *p = pBuf->data + pBuf->byteIndex;
+
+	memcpy(&w, p, 8);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	w = __builtin_bswap64(w);
+#endif
+
+	keep = (0 == used) ? 0 : (w & (~(OSUINT64)0 << (64 - used)));
+	rest = (64 == touched) ? 0 : (w & (~(OSUINT64)0 >> touched));
+	w = keep | ((value & (~(OSUINT64)0 >> (64 - nbits))) << (64 - end)) | rest;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	w = __builtin_bswap64(w);
+#endif
+	memcpy(p, &w, 8);
+
+	pBuf->byteIndex += end >> 3;
+	pBuf->bitOffset = 8 - (end & 7);
+}
+
+/* bits needed for a constrained whole number with this range (upper - lower) */
+static inline unsigned int sRangeBits(OSUINT64 range)
+{
+	return (0 == range) ? 0 : 64 - __builtin_clzll(range);
+}
+
+void PerBitWriter_Enable(int enable)
+{
+	per_enc_enable = enable ? HAE_TRUE : HAE_FALSE;
+}
+
+int PerBitWriter_IsEnabled(void)
+{
+	return per_enc_enable;
+}
+
+int rtxEncBit(OSCTXT *pctxt, OSBOOL value)
+{
+	if (PER_ENC_FAST(pctxt))
+	{
+		sPut(&pctxt->buffer, (0 != value), 1);
+		return 0;
+	}
+
+	return PER_ENC_LIB(rtxEncBit)(pctxt, value);
+}
+
+int rtxEncBits(OSCTXT *pctxt, OSUINT32 value, size_t nbits)
+{
+	if (PER_ENC_FAST(pctxt) && (nbits - 1 < 32))
+	{
+		sPut(&pctxt->buffer, value, (unsigned int)nbits);
+		return 0;
+	}
+
+	return PER_ENC_LIB(rtxEncBits)(pctxt, value, nbits);
+}
+
+/* X.691 11.5.6, UNALIGNED: minimum number of bits for the range */
+int pe_ConsUInt64(OSCTXT *pctxt, OSUINT64 value, OSUINT64 lower, OSUINT64 upper)
+{
+	unsigned int nbits;
+
+	if (PER_ENC_FAST_UPER(pctxt) && (lower < upper) && (value >= lower) && (value <= upper))
+	{
+		nbits = sRangeBits(upper - lower);
+		if (nbits <= PER_ENC_MAXBITS)
+		{
+			sPut(&pctxt->buffer, value - lower, nbits);
+			return 0;
+		}
+	}
+
+	return PER_ENC_LIB(pe_ConsUInt64)(pctxt, value, lower, upper);
+}
+
+int pe_ConsInt64(OSCTXT *pctxt, OSINT64 value, OSINT64 lower, OSINT64 upper)
+{
+	unsigned int nbits;
+
+	if (PER_ENC_FAST_UPER(pctxt) && (lower < upper) && (value >= lower) && (value <= upper))
+	{
+		nbits = sRangeBits((OSUINT64)upper - (OSUINT64)lower);
+		if (nbits <= PER_ENC_MAXBITS)
+		{
+			sPut(&pctxt->buffer, (OSUINT64)value - (OSUINT64)lower, nbits);
+			return 0;
+		}
+	}
+
+	return PER_ENC_LIB(pe_ConsInt64)(pctxt, value, lower, upper);
+}
+
+/* range_value is upper - lower + 1 */
+int pe_ConsWholeNumber(OSCTXT *pctxt, OSUINT32 adjusted_value, OSUINT32 range_value)
+{
+	if (PER_ENC_FAST_UPER(pctxt) && (range_value >= 2) && (range_value <= 0x80000000u) &&
+		(adjusted_value < range_value))
+	{
+		sPut(&pctxt->buffer, adjusted_value, sRangeBits(range_value - 1));
+		return 0;
+	}
+
+	return PER_ENC_LIB(pe_ConsWholeNumber)(pctxt, adjusted_value, range_value);
+}
+
+int pe_ConsWholeNumber64(OSCTXT *pctxt, OSUINT64 adjusted_value, OSUINT64 range_value)
+{
+	if (PER_ENC_FAST_UPER(pctxt) && (range_value >= 2) && (range_value <= ((OSUINT64)1 << PER_ENC_MAXBITS)) &&
+		(adjusted_value < range_value))
+	{
+		sPut(&pctxt->buffer, adjusted_value, sRangeBits(range_value - 1));
+		return 0;
+	}
+
+	return PER_ENC_LIB(pe_ConsWholeNumber64)(pctxt, adjusted_value, range_value);
+}
+
+/* X.691 11.9.3.6 / 11.9.3.7; returns the number of items as the library
+   does, fragmented lengths (11.9.3.8) go to the library */
+int pe_Length(OSCTXT *pctxt, OSSIZE value)
+{
+	if (PER_ENC_FAST_UPER(pctxt) && PER_ENC_UNSIZED(pctxt))
+	{
+		if (value < 128)
+		{
+			sPut(&pctxt->buffer, value, 8);
+			return (int)value;
+		}
+		if (value < 16384)
+		{
+			sPut(&pctxt->buffer, 0x8000 | value, 16);
+			return (int)value;
+		}
+	}
+
+	return PER_ENC_LIB(pe_Length)(pctxt, value);
+}
+
+/* X.691 11.9.3.4: '0' + 6 bits (n - 1) for 1 <= n <= 64 */
+int pe_SmallLength(OSCTXT *pctxt, OSSIZE value)
+{
+	if (PER_ENC_FAST_UPER(pctxt) && (value - 1 < 64))
+	{
+		sPut(&pctxt->buffer, value - 1, 7);
+		return 0;
+	}
+
+	return PER_ENC_LIB(pe_SmallLength)(pctxt, value);
+}
+
+static void sResolve(void)
+{
+	PER_ENC_LIB_FUNCS funcs;
+
+	*(void **)&funcs.rtxEncBit = dlsym(RTLD_NEXT, "rtxEncBit");
+	*(void **)&funcs.rtxEncBits = dlsym(RTLD_NEXT, "rtxEncBits");
+	*(void **)&funcs.pe_ConsUInt64 = dlsym(RTLD_NEXT, "pe_ConsUInt64");
+	*(void **)&funcs.pe_ConsInt64 = dlsym(RTLD_NEXT, "pe_ConsInt64");
+	*(void **)&funcs.pe_ConsWholeNumber = dlsym(RTLD_NEXT, "pe_ConsWholeNumber");
+	*(void **)&funcs.pe_ConsWholeNumber64 = dlsym(RTLD_NEXT, "pe_ConsWholeNumber64");
+	*(void **)&funcs.pe_Length = dlsym(RTLD_NEXT, "pe_Length");
+	*(void **)&funcs.pe_SmallLength = dlsym(RTLD_NEXT, "pe_SmallLength");
+
+	if ((0 == funcs.rtxEncBit) || (0 == funcs.rtxEncBits) || (0 == funcs.pe_ConsUInt64) ||
+		(0 == funcs.pe_ConsInt64) || (0 == funcs.pe_ConsWholeNumber) || (0 == funcs.pe_ConsWholeNumber64) ||
+		(0 == funcs.pe_Length) || (0 == funcs.pe_SmallLength))
+	{
+		/* cannot continue without the library, every encode would crash */
+		printf("[PER] ERROR : bit writer cannot resolve the ASN.1 runtime: %s\n", dlerror());
+		abort();
+	}
+
+	/* the same values on every call, a race between threads is harmless */
+	per_enc_lib = funcs;
+	__sync_synchronize();
+	per_enc_resolved = HAE_TRUE;
+}
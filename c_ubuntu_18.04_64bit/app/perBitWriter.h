@@ -0,0 +1,25 @@
+#ifndef PER_BIT_WRITER_H
+#define PER_BIT_WRITER_H
+
+#include <rtxsrc/rtxContext.h>
+
+/* perBitWriter.o replaces the UPER bit primitives used by the asn1PE_*
+   functions of libtrafficinfo1 (rtxEncBit, rtxEncBits, pe_ConsUInt64,
+   pe_ConsInt64, pe_ConsWholeNumber, pe_ConsWholeNumber64, pe_Length,
+   pe_SmallLength). Each call merges the field into one big endian 64 bit
+   word at the bit cursor and stores it back; the only bounds check is one
+   compare against the buffer size. Output is bit for bit the library's.
+   The encoders of this code base write into static buffers that hold a
+   whole message, so all but the last PER_WRITER_SLACK bytes take the
+   fast path without reserving anything up front.
+   Streams, ALIGNED PER, bit field tracing, fragmented lengths, constraint
+   violations and the last PER_WRITER_SLACK bytes of the buffer are passed
+   to the library functions unchanged. */
+
+/* bytes past the encoding that keep every field on the fast path */
+#define PER_WRITER_SLACK		8
+
+void PerBitWriter_Enable(int enable);
+int PerBitWriter_IsEnabled(void);
+
+#endif
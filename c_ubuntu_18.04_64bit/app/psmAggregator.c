@@ -0,0 +1,532 @@
+#include <DSRC.h>
+#include <rtxsrc/rtxBitDecode.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "haeCommon.h"
+#include "psmAggregator.h"
+
+#define PSM_OPT_BIT_CNT			18		/* OPTIONAL components in the PSM root */
+#define PSM_OPT_ACCELSET		(1u << 17)
+#define PSM_OPT_PATHHISTORY		(1u << 16)
+#define PSM_OPT_PATHPREDICTION	(1u << 15)
+#define PSM_OPT_PROPULSION		(1u << 14)
+#define PSM_OPT_USESTATE		(1u << 13)
+#define PSM_OPT_CROSSREQUEST	(1u << 12)
+#define PSM_OPT_CROSSSTATE		(1u << 11)
+#define PSM_OPT_CLUSTERSIZE		(1u << 10)
+#define PSM_OPT_CLUSTERRADIUS	(1u << 9)
+
+#define PSM_VELOCITY_UNAVAILABLE	8191
+#define PSM_HEADING_UNAVAILABLE		28800
+
+#define METERS_PER_DEGREE		111319.49f
+
+static int sInputCore(PSM_AGG *pAgg, const PSM_CORE *pCore);
+static unsigned short sClusterWeight(const PSM_CORE *pCore);
+static PSM_AGG_VRU *sFindVru(PSM_AGG *pAgg, const OSOCTET *pId);
+
+/*************************************************************
+ *
+ * Function 		: PsmCore_Decode
+ *
+ * Description	: Decode the position/velocity core and the cluster
+ *				  fields of a UPER PersonalSafetyMessage.
+ *
+ * Parameter	: pctxt - context with pu_setBuffer already applied
+ *				  pCore - output
+ *
+ * Returns		: 0 or ASN1 runtime error code
+ *
+ * Notes		: Decoding stops right after clusterRadius. Optional
+ *				  components in front of the cluster fields are only
+ *				  decoded when a cluster field follows them; anything
+ *				  they allocate stays in the context heap, so the
+ *				  caller resets it between messages.
+ *
+ *************************************************************/
+int PsmCore_Decode(OSCTXT *pctxt, PSM_CORE *pCore)
+{
+	int stat;
+	OSBOOL extbit;
+	OSUINT32 optbits;
+	TemporaryID id;
+	Position3D position;
+	PositionalAccuracy accuracy;
+
+	union {
+		AccelerationSet4Way accelSet;
+		PathHistory pathHistory;
+		PathPrediction pathPrediction;
+		PropelledInformation propulsion;
+		PersonalDeviceUsageState useState;
+		OSBOOL flag;
+	} skip;
+
+	/* the generated decoders free whatever a pointer member holds */
+	memset(pCore, 0, sizeof(PSM_CORE));
+	memset(&id, 0, sizeof(id));
+	memset(&position, 0, sizeof(position));
+	memset(&accuracy, 0, sizeof(accuracy));
+	memset(&skip, 0, sizeof(skip));
+
+	stat = rtxDecBit(pctxt, &extbit);
+	if (0 == stat) stat = rtxDecBits(pctxt, &optbits, PSM_OPT_BIT_CNT);
+	if (0 == stat) stat = asn1PD_PersonalDeviceUserType(pctxt, &pCore->basicType);
+	if (0 == stat) stat = asn1PD_DSecond(pctxt, &pCore->secMark);
+	if (0 == stat)
+	{
+		MsgCount msgCnt;
+		stat = asn1PD_MsgCount(pctxt, &msgCnt);
+	}
+	if (0 == stat) stat = asn1PD_TemporaryID(pctxt, &id);
+	if (0 == stat) stat = asn1PD_Position3D(pctxt, &position);
+	if (0 == stat) stat = asn1PD_PositionalAccuracy(pctxt, &accuracy);
+	if (0 == stat) stat = asn1PD_Velocity(pctxt, &pCore->speed);
+	if (0 == stat) stat = asn1PD_Heading(pctxt, &pCore->heading);
+	if (0 != stat)
+	{
+		return stat;
+	}
+
+	memcpy(pCore->id, id.data, sizeof(pCore->id));
+	pCore->lat = position.lat;
+	pCore->lon = position.long_;
+
+	if (0 == (optbits & (PSM_OPT_CLUSTERSIZE | PSM_OPT_CLUSTERRADIUS)))
+	{
+		return 0;
+	}
+
+	if (optbits & PSM_OPT_ACCELSET)
+		stat = asn1PD_AccelerationSet4Way(pctxt, &skip.accelSet);
+	if ((0 == stat) && (optbits & PSM_OPT_PATHHISTORY))
+		stat = asn1PD_PathHistory(pctxt, &skip.pathHistory);
+	if ((0 == stat) && (optbits & PSM_OPT_PATHPREDICTION))
+		stat = asn1PD_PathPrediction(pctxt, &skip.pathPrediction);
+	if ((0 == stat) && (optbits & PSM_OPT_PROPULSION))
+		stat = asn1PD_PropelledInformation(pctxt, &skip.propulsion);
+	if ((0 == stat) && (optbits & PSM_OPT_USESTATE))
+		stat = asn1PD_PersonalDeviceUsageState(pctxt, &skip.useState);
+	if ((0 == stat) && (optbits & PSM_OPT_CROSSREQUEST))
+		stat = asn1PD_PersonalCrossingRequest(pctxt, &skip.flag);
+	if ((0 == stat) && (optbits & PSM_OPT_CROSSSTATE))
+		stat = asn1PD_PersonalCrossingInProgress(pctxt, &skip.flag);
+	if ((0 == stat) && (optbits & PSM_OPT_CLUSTERSIZE))
+	{
+		stat = asn1PD_NumberOfParticipantsInCluster(pctxt, &pCore->clusterSize);
+		pCore->clusterSizePresent = HAE_TRUE;
+	}
+	if ((0 == stat) && (optbits & PSM_OPT_CLUSTERRADIUS))
+	{
+		stat = asn1PD_PersonalClusterRadius(pctxt, &pCore->clusterRadius);
+		pCore->clusterRadiusPresent = HAE_TRUE;
+	}
+
+	return stat;
+}
+
+/* the same fields out of an already decoded PersonalSafetyMessage */
+void PsmCore_FromPsm(const PersonalSafetyMessage *pPsm, PSM_CORE *pCore)
+{
+	memset(pCore, 0, sizeof(PSM_CORE));
+
+	memcpy(pCore->id, pPsm->id.data, sizeof(pCore->id));
+	pCore->basicType = pPsm->basicType;
+	pCore->secMark = pPsm->secMark;
+	pCore->lat = pPsm->position.lat;
+	pCore->lon = pPsm->position.long_;
+	pCore->speed = pPsm->speed;
+	pCore->heading = pPsm->heading;
+	if (pPsm->m.clusterSizePresent)
+	{
+		pCore->clusterSize = pPsm->clusterSize;
+		pCore->clusterSizePresent = HAE_TRUE;
+	}
+	if (pPsm->m.clusterRadiusPresent)
+	{
+		pCore->clusterRadius = pPsm->clusterRadius;
+		pCore->clusterRadiusPresent = HAE_TRUE;
+	}
+}
+
+/*************************************************************
+ *
+ * Function 		: PsmAgg_Init
+ *
+ * Description	: Initialize a PSM aggregator
+ *
+ * Parameter	: periodMs - publish period
+ *				  pfPublish, pArg - called once per intersection every period
+ *
+ * Returns		: HAE_OK / HAE_ERROR
+ *
+ * Notes		:
+ *
+ *************************************************************/
+int PsmAgg_Init(PSM_AGG *pAgg, unsigned int periodMs, PSM_AGG_PUBLISH pfPublish, void *pArg)
+{
+	memset(pAgg, 0, sizeof(PSM_AGG));
+
+	if (0 != rtInitContext(&pAgg->ctxt))
+	{
+		rtxErrPrint(&pAgg->ctxt);
+		printf("[PSM] ERROR : rtInitContext() for aggregator\n");
+		return HAE_ERROR;
+	}
+
+	pAgg->periodMs = periodMs;
+	pAgg->pfPublish = pfPublish;
+	pAgg->pPublishArg = pArg;
+
+	return HAE_OK;
+}
+
+void PsmAgg_Free(PSM_AGG *pAgg)
+{
+	rtFreeContext(&pAgg->ctxt);
+}
+
+int PsmAgg_AddIntersection(PSM_AGG *pAgg, IntersectionID intersectionId, Latitude refLat, Longitude refLon)
+{
+	PSM_AGG_INTERSECTION *pInter;
+
+	if (pAgg->intersectionCnt >= PSM_AGG_MAX_INTERSECTION)
+	{
+		return HAE_ERROR;
+	}
+
+	pInter = &pAgg->intersection[pAgg->intersectionCnt++];
+	memset(pInter, 0, sizeof(PSM_AGG_INTERSECTION));
+
+	pInter->intersectionId = intersectionId;
+	pInter->refLat = refLat;
+	pInter->refLon = refLon;
+	pInter->metersPerLat = METERS_PER_DEGREE * 1e-7f;
+	pInter->metersPerLon = METERS_PER_DEGREE * 1e-7f * cosf((float)(refLat * 1e-7 * M_PI / 180.0));
+
+	return HAE_OK;
+}
+
+int PsmAgg_AddCrosswalk(PSM_AGG *pAgg, IntersectionID intersectionId, const PSM_AGG_BOX *pBox)
+{
+	unsigned int i;
+	PSM_AGG_INTERSECTION *pInter;
+
+	for (i = 0; i < pAgg->intersectionCnt; i++)
+	{
+		pInter = &pAgg->intersection[i];
+		if (pInter->intersectionId == intersectionId)
+		{
+			if (pInter->crosswalkCnt >= PSM_AGG_MAX_CROSSWALK)
+			{
+				return HAE_ERROR;
+			}
+			pInter->crosswalk[pInter->crosswalkCnt++] = *pBox;
+			return HAE_OK;
+		}
+	}
+
+	return HAE_ERROR;
+}
+
+/*************************************************************
+ *
+ * Function 		: PsmAgg_AddSpec
+ *
+ * Description	: Add an intersection and its crosswalks from text
+ *
+ * Parameter	: pSpec - "<id>:<refLat>:<refLon>[:<xMin>,<yMin>,<xMax>,<yMax>]..."
+ *				          ref in 1/10 micro degree, boxes in meters
+ *				          east / north of the reference
+ *
+ * Returns		: HAE_OK / HAE_ERROR
+ *
+ * Notes		: Parsing stops at the end of the string or at ';', so
+ *				  a list of intersections is walked by the caller.
+ *
+ *************************************************************/
+int PsmAgg_AddSpec(PSM_AGG *pAgg, const char *pSpec)
+{
+	int n = 0;
+	long id, lat, lon;
+	const char *pNext;
+	PSM_AGG_BOX box;
+
+	if ((3 != sscanf(pSpec, "%ld:%ld:%ld%n", &id, &lat, &lon, &n)) ||
+		((':' != pSpec[n]) && (';' != pSpec[n]) && ('\0' != pSpec[n])) ||
+		(HAE_OK != PsmAgg_AddIntersection(pAgg, (IntersectionID)id, (Latitude)lat, (Longitude)lon)))
+	{
+		printf("[PSM] ERROR : intersection \"%s\" is not <id>:<lat>:<lon>[:box]...\n", pSpec);
+		return HAE_ERROR;
+	}
+
+	for (pNext = pSpec + n; ':' == *pNext; pNext += n)
+	{
+		n = 0;
+		if ((4 != sscanf(pNext, ":%f,%f,%f,%f%n", &box.xMin, &box.yMin, &box.xMax, &box.yMax, &n)) ||
+			((':' != pNext[n]) && (';' != pNext[n]) && ('\0' != pNext[n])) ||
+			(box.xMin > box.xMax) || (box.yMin > box.yMax) ||
+			(HAE_OK != PsmAgg_AddCrosswalk(pAgg, (IntersectionID)id, &box)))
+		{
+			printf("[PSM] ERROR : crosswalk of intersection %ld in \"%s\"\n", id, pSpec);
+			return HAE_ERROR;
+		}
+	}
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: PsmAgg_Input
+ *
+ * Description	: Feed one UPER PersonalSafetyMessage (MessageFrame value)
+ *
+ * Parameter	: pBuf, ulLength - encoded PSM
+ *
+ * Returns		: HAE_OK / HAE_ERROR
+ *
+ * Notes		: The latest report per TemporaryID wins within a period,
+ *				  so bursts from one phone are counted once.
+ *
+ *************************************************************/
+int PsmAgg_Input(PSM_AGG *pAgg, const unsigned char *pBuf, unsigned int ulLength)
+{
+	int stat;
+	PSM_CORE core;
+
+	pu_setBuffer(&pAgg->ctxt, (OSOCTET *)pBuf, ulLength, FALSE);
+	stat = PsmCore_Decode(&pAgg->ctxt, &core);
+	rtxMemReset(&pAgg->ctxt);
+
+	if (0 != stat)
+	{
+		return HAE_ERROR;
+	}
+
+	return sInputCore(pAgg, &core);
+}
+
+/* as PsmAgg_Input, for a receiver that decoded the whole PSM already */
+int PsmAgg_InputPsm(PSM_AGG *pAgg, const PersonalSafetyMessage *pPsm)
+{
+	PSM_CORE core;
+
+	PsmCore_FromPsm(pPsm, &core);
+
+	return sInputCore(pAgg, &core);
+}
+
+static int sInputCore(PSM_AGG *pAgg, const PSM_CORE *pCore)
+{
+	unsigned int i;
+	float dx, dy, half, v, h;
+	PSM_AGG_INTERSECTION *pInter;
+	PSM_AGG_VRU *pVru;
+
+	half = PSM_AGG_GRID_DIM * PSM_AGG_CELL_SIZE / 2.0f;
+
+	for (i = 0; i < pAgg->intersectionCnt; i++)
+	{
+		pInter = &pAgg->intersection[i];
+		dx = (float)(pCore->lon - pInter->refLon) * pInter->metersPerLon;
+		dy = (float)(pCore->lat - pInter->refLat) * pInter->metersPerLat;
+
+		if ((dx >= -half) && (dx < half) && (dy >= -half) && (dy < half))
+		{
+			break;
+		}
+	}
+
+	if (i == pAgg->intersectionCnt)
+	{
+		return HAE_OK;
+	}
+
+	pVru = sFindVru(pAgg, pCore->id);
+	if (HAE_NULL == pVru)
+	{
+		pAgg->droppedCnt++;
+		return HAE_ERROR;
+	}
+
+	pVru->intersection = (unsigned char)i;
+	pVru->weight = sClusterWeight(pCore);
+	pVru->x = dx;
+	pVru->y = dy;
+	pVru->vx = 0.0f;
+	pVru->vy = 0.0f;
+
+	if ((pCore->speed != PSM_VELOCITY_UNAVAILABLE) && (pCore->heading != PSM_HEADING_UNAVAILABLE))
+	{
+		v = pCore->speed * 0.02f;
+		h = (float)(pCore->heading * 0.0125 * M_PI / 180.0);
+		pVru->vx = v * sinf(h);
+		pVru->vy = v * cosf(h);
+	}
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: PsmAgg_Tick
+ *
+ * Description	: Publish per-intersection reports when the period elapsed
+ *
+ * Parameter	: nowMs - monotonic time in milliseconds
+ *
+ * Returns		: number of reports published
+ *
+ * Notes		:
+ *
+ *************************************************************/
+int PsmAgg_Tick(PSM_AGG *pAgg, unsigned long long nowMs)
+{
+	unsigned int i, j, k;
+	int row, col, cnt = 0;
+	float half, cx, cy, dot;
+	PSM_AGG_INTERSECTION *pInter;
+	PSM_AGG_VRU *pVru;
+	PSM_AGG_BOX *pBox;
+	PSM_AGG_CROSSWALK_STAT *pStat;
+	PSM_AGG_REPORT *pReport = &pAgg->report;
+
+	if ((nowMs - pAgg->lastPublishMs) < pAgg->periodMs)
+	{
+		return 0;
+	}
+	pAgg->lastPublishMs = nowMs;
+
+	half = PSM_AGG_GRID_DIM * PSM_AGG_CELL_SIZE / 2.0f;
+
+	for (i = 0; i < pAgg->intersectionCnt; i++)
+	{
+		pInter = &pAgg->intersection[i];
+
+		memset(pReport, 0, sizeof(PSM_AGG_REPORT));
+		pReport->intersectionId = pInter->intersectionId;
+		pReport->crosswalkCnt = pInter->crosswalkCnt;
+
+		for (j = 0; j < PSM_AGG_MAX_VRU; j++)
+		{
+			pVru = &pAgg->vru[j];
+			if ((HAE_FALSE == pVru->used) || (pVru->intersection != i))
+			{
+				continue;
+			}
+
+			col = (int)((pVru->x + half) / PSM_AGG_CELL_SIZE);
+			row = (int)((pVru->y + half) / PSM_AGG_CELL_SIZE);
+			if (col >= PSM_AGG_GRID_DIM) col = PSM_AGG_GRID_DIM - 1;
+			if (row >= PSM_AGG_GRID_DIM) row = PSM_AGG_GRID_DIM - 1;
+			pReport->grid[row][col] += pVru->weight;
+
+			for (k = 0; k < pInter->crosswalkCnt; k++)
+			{
+				pBox = &pInter->crosswalk[k];
+				pStat = &pReport->crosswalk[k];
+
+				if ((pVru->x >= pBox->xMin) && (pVru->x <= pBox->xMax) &&
+					(pVru->y >= pBox->yMin) && (pVru->y <= pBox->yMax))
+				{
+					pStat->occupancy += pVru->weight;
+				}
+				else if ((pVru->x >= pBox->xMin - PSM_AGG_APPROACH_MARGIN) &&
+						 (pVru->x <= pBox->xMax + PSM_AGG_APPROACH_MARGIN) &&
+						 (pVru->y >= pBox->yMin - PSM_AGG_APPROACH_MARGIN) &&
+						 (pVru->y <= pBox->yMax + PSM_AGG_APPROACH_MARGIN))
+				{
+					cx = (pBox->xMin + pBox->xMax) / 2.0f - pVru->x;
+					cy = (pBox->yMin + pBox->yMax) / 2.0f - pVru->y;
+					dot = cx * pVru->vx + cy * pVru->vy;
+					if (dot > 0.0f)
+					{
+						pStat->approaching += pVru->weight;
+						pStat->approachVx += pVru->vx * pVru->weight;
+						pStat->approachVy += pVru->vy * pVru->weight;
+					}
+				}
+			}
+		}
+
+		for (k = 0; k < pReport->crosswalkCnt; k++)
+		{
+			pStat = &pReport->crosswalk[k];
+			if (pStat->approaching > 0)
+			{
+				pStat->approachVx /= pStat->approaching;
+				pStat->approachVy /= pStat->approaching;
+			}
+		}
+
+		if (HAE_NULL != pAgg->pfPublish)
+		{
+			pAgg->pfPublish(pAgg->pPublishArg, pReport);
+		}
+		cnt++;
+	}
+
+	memset(pAgg->vru, 0, sizeof(pAgg->vru));
+	pAgg->vruCnt = 0;
+
+	return cnt;
+}
+
+/* J2735 cluster sizes: small 2..5, medium 6..10, large > 10 */
+static unsigned short sClusterWeight(const PSM_CORE *pCore)
+{
+	if (HAE_FALSE == pCore->clusterSizePresent)
+	{
+		return 1;
+	}
+
+	switch (pCore->clusterSize)
+	{
+		case small_:
+			return 4;
+		case medium:
+			return 8;
+		case large_:
+			return 12;
+		default:
+			return 1;
+	}
+}
+
+/* Open addressing on the TemporaryID, the table is cleared every period */
+static PSM_AGG_VRU *sFindVru(PSM_AGG *pAgg, const OSOCTET *pId)
+{
+	unsigned int i, slot;
+	PSM_AGG_VRU *pVru;
+
+	slot = ((unsigned int)pId[0] << 24 | (unsigned int)pId[1] << 16 |
+			(unsigned int)pId[2] << 8 | pId[3]) * 2654435761u;
+
+	for (i = 0; i < PSM_AGG_MAX_VRU; i++)
+	{
+		pVru = &pAgg->vru[(slot + i) % PSM_AGG_MAX_VRU];
+
+		if (HAE_FALSE == pVru->used)
+		{
+			if (pAgg->vruCnt >= PSM_AGG_MAX_VRU * 3 / 4)
+			{
+				return HAE_NULL;
+			}
+			pVru->used = HAE_TRUE;
+			memcpy(pVru->id, pId, sizeof(pVru->id));
+			pAgg->vruCnt++;
+			return pVru;
+		}
+		if (0 == memcmp(pVru->id, pId, sizeof(pVru->id)))
+		{
+			return pVru;
+		}
+	}
+
+	return HAE_NULL;
+}
@@ -0,0 +1,100 @@
+#ifndef PSM_AGGREGATOR_H
+#define PSM_AGGREGATOR_H
+
+#include <DSRC.h>
+
+#define PSM_AGG_MAX_INTERSECTION		8
+#define PSM_AGG_MAX_CROSSWALK			4		/* per intersection */
+#define PSM_AGG_MAX_VRU					256		/* distinct TemporaryIDs per period */
+
+#define PSM_AGG_GRID_DIM				32		/* cells per side */
+#define PSM_AGG_CELL_SIZE				2.0f	/* meters, grid spans 64m x 64m */
+
+#define PSM_AGG_APPROACH_MARGIN			5.0f	/* meters around a crosswalk box */
+
+/* Only the fields the aggregator needs out of a PersonalSafetyMessage */
+typedef struct{
+	OSOCTET id[4];
+	PersonalDeviceUserType basicType;
+	DSecond secMark;
+	Latitude lat;						/* 1/10 micro degree */
+	Longitude lon;						/* 1/10 micro degree */
+	Velocity speed;						/* 0.02 m/s */
+	Heading heading;					/* 0.0125 degree */
+	unsigned char clusterSizePresent;
+	unsigned char clusterRadiusPresent;
+	NumberOfParticipantsInCluster clusterSize;
+	PersonalClusterRadius clusterRadius;
+} PSM_CORE;
+
+typedef struct{
+	float xMin;							/* meters east of intersection reference */
+	float yMin;							/* meters north of intersection reference */
+	float xMax;
+	float yMax;
+} PSM_AGG_BOX;
+
+typedef struct{
+	unsigned short occupancy;			/* VRUs (cluster weighted) inside the box */
+	unsigned short approaching;			/* VRUs in the margin heading towards it */
+	float approachVx;					/* mean velocity of approaching VRUs, m/s */
+	float approachVy;
+} PSM_AGG_CROSSWALK_STAT;
+
+typedef struct{
+	IntersectionID intersectionId;
+	unsigned int crosswalkCnt;
+	PSM_AGG_CROSSWALK_STAT crosswalk[PSM_AGG_MAX_CROSSWALK];
+	unsigned short grid[PSM_AGG_GRID_DIM][PSM_AGG_GRID_DIM];	/* [row = north][col = east] */
+} PSM_AGG_REPORT;
+
+typedef void (*PSM_AGG_PUBLISH)(void *pArg, const PSM_AGG_REPORT *pReport);
+
+typedef struct{
+	IntersectionID intersectionId;
+	Latitude refLat;
+	Longitude refLon;
+	float metersPerLat;					/* meters per 1/10 micro degree */
+	float metersPerLon;
+	unsigned int crosswalkCnt;
+	PSM_AGG_BOX crosswalk[PSM_AGG_MAX_CROSSWALK];
+} PSM_AGG_INTERSECTION;
+
+typedef struct{
+	OSOCTET id[4];
+	unsigned char used;
+	unsigned char intersection;
+	unsigned short weight;
+	float x;
+	float y;
+	float vx;
+	float vy;
+} PSM_AGG_VRU;
+
+typedef struct{
+	OSCTXT ctxt;						/* reused for every PSM, heap reset per message */
+	unsigned int intersectionCnt;
+	PSM_AGG_INTERSECTION intersection[PSM_AGG_MAX_INTERSECTION];
+	unsigned int vruCnt;
+	PSM_AGG_VRU vru[PSM_AGG_MAX_VRU];
+	unsigned int periodMs;
+	unsigned long long lastPublishMs;
+	PSM_AGG_PUBLISH pfPublish;
+	void *pPublishArg;
+	PSM_AGG_REPORT report;
+	unsigned long droppedCnt;			/* PSMs dropped because the VRU table was full */
+} PSM_AGG;
+
+int PsmCore_Decode(OSCTXT *pctxt, PSM_CORE *pCore);
+void PsmCore_FromPsm(const PersonalSafetyMessage *pPsm, PSM_CORE *pCore);
+
+int PsmAgg_Init(PSM_AGG *pAgg, unsigned int periodMs, PSM_AGG_PUBLISH pfPublish, void *pArg);
+void PsmAgg_Free(PSM_AGG *pAgg);
+int PsmAgg_AddIntersection(PSM_AGG *pAgg, IntersectionID intersectionId, Latitude refLat, Longitude refLon);
+int PsmAgg_AddCrosswalk(PSM_AGG *pAgg, IntersectionID intersectionId, const PSM_AGG_BOX *pBox);
+int PsmAgg_AddSpec(PSM_AGG *pAgg, const char *pSpec);
+int PsmAgg_Input(PSM_AGG *pAgg, const unsigned char *pBuf, unsigned int ulLength);
+int PsmAgg_InputPsm(PSM_AGG *pAgg, const PersonalSafetyMessage *pPsm);
+int PsmAgg_Tick(PSM_AGG *pAgg, unsigned long long nowMs);
+
+#endif
@@ -0,0 +1,196 @@
+#include <DSRC.h>
+#include <AddGrpD.h>
+#include <rtxsrc/rtxBitDecode.h>
+#include <rtxsrc/rtxMemory.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "haeCommon.h"
+#include "citsAddGrpD.h"
+#include "pvdStream.h"
+
+static int sDecode_Snapshots(PVD_STREAM *pStream);
+static int sDecode_AddGrpD(PVD_STREAM *pStream, const ASN1OpenType *pExt);
+
+/*************************************************************
+ *
+ * Function 		: PvdStream_Init
+ *
+ * Description	: Initialize a streaming ProbeVehicleData decoder
+ *
+ * Parameter	: pfSnapshot - called for every Snapshot, may be NULL
+ *				  pfCits - called for every CITSPVD of PVD-addGrpD, may be NULL
+ *
+ * Returns		: HAE_OK / HAE_ERROR
+ *
+ * Notes		:
+ *
+ *************************************************************/
+int PvdStream_Init(PVD_STREAM *pStream, PVD_SNAPSHOT_HANDLER pfSnapshot, PVD_CITS_HANDLER pfCits, void *pArg)
+{
+	memset(pStream, 0, sizeof(PVD_STREAM));
+
+	if ((0 != rtInitContext(&pStream->ctxt)) || (0 != rtInitContext(&pStream->elemCtxt)))
+	{
+		printf("[PVD] ERROR : rtInitContext() for stream decoder\n");
+		return HAE_ERROR;
+	}
+
+	pStream->pfSnapshot = pfSnapshot;
+	pStream->pfCits = pfCits;
+	pStream->pArg = pArg;
+
+	return HAE_OK;
+}
+
+void PvdStream_Free(PVD_STREAM *pStream)
+{
+	rtFreeContext(&pStream->elemCtxt);
+	rtFreeContext(&pStream->ctxt);
+}
+
+/*************************************************************
+ *
+ * Function 		: PvdStream_Decode
+ *
+ * Description	: Decode one UPER ProbeVehicleData (MessageFrame value)
+ *				  and hand each Snapshot to the handler as it completes
+ *
+ * Parameter	: pBuf, ulLength - encoded PVD
+ *
+ * Returns		: HAE_OK, ASN1 runtime error code, or the non-zero
+ *				  value a handler returned to stop the decode
+ *
+ * Notes		: Snapshots are decoded in elemCtxt, which shares the
+ *				  message buffer and is reset after every handler call,
+ *				  so memory use is bounded by a single snapshot.
+ *
+ *************************************************************/
+int PvdStream_Decode(PVD_STREAM *pStream, const unsigned char *pBuf, unsigned int ulLength)
+{
+	int stat;
+	OSBOOL regionalPresent;
+	OSRTDListNode *pnode;
+	ProbeVehicleData_regional regional;
+	RegionalExtension *pExt;
+	OSCTXT *pctxt = &pStream->ctxt;
+	PVD_STREAM_HEADER *pHeader = &pStream->header;
+
+	memset(pHeader, 0, sizeof(PVD_STREAM_HEADER));
+
+	pu_setBuffer(pctxt, (OSOCTET *)pBuf, ulLength, FALSE);
+	pu_setBuffer(&pStream->elemCtxt, (OSOCTET *)pBuf, ulLength, FALSE);
+
+	stat = CitsPvd_DecodeHead(pctxt, &pHeader->pvd, &regionalPresent);
+	if (0 == stat) stat = sDecode_Snapshots(pStream);
+
+	if ((0 == stat) && regionalPresent)
+	{
+		memset(&regional, 0, sizeof(regional));
+		stat = asn1PD_ProbeVehicleData_regional(pctxt, &regional);
+
+		for (pnode = regional.head; (0 == stat) && (pnode != 0); pnode = pnode->next)
+		{
+			pExt = (RegionalExtension *)pnode->data;
+			if (ASN1V_addGrpD == pExt->regionId)
+			{
+				stat = sDecode_AddGrpD(pStream, &pExt->regExtValue);
+			}
+		}
+	}
+
+	if ((0 != rtxErrGetErrorCnt(pctxt)) || (0 != rtxErrGetErrorCnt(&pStream->elemCtxt)))
+	{
+		rtxErrPrint(pctxt);
+		rtxErrPrint(&pStream->elemCtxt);
+		printf("[PVD] ERROR : stream decode of ProbeVehicleData failed\n");
+		rtxErrReset(pctxt);
+		rtxErrReset(&pStream->elemCtxt);
+	}
+
+	rtxMemReset(&pStream->elemCtxt);
+	rtxMemReset(pctxt);
+
+	return stat;
+}
+
+/* snapshots SEQUENCE (SIZE (1..32)) OF Snapshot, one element at a time */
+static int sDecode_Snapshots(PVD_STREAM *pStream)
+{
+	int stat;
+	OSUINT32 count, i;
+	Snapshot snapshot;
+	OSCTXT *pctxt = &pStream->ctxt;
+	OSCTXT *pElem = &pStream->elemCtxt;
+
+	stat = pd_ConsUnsigned(pctxt, &count, 1, 32);
+	if (0 != stat)
+	{
+		return stat;
+	}
+	pStream->header.snapshotCnt = count;
+
+	for (i = 0; i < count; i++)
+	{
+		pElem->buffer.byteIndex = pctxt->buffer.byteIndex;
+		pElem->buffer.bitOffset = pctxt->buffer.bitOffset;
+
+		memset(&snapshot, 0, sizeof(snapshot));
+		stat = asn1PD_Snapshot(pElem, &snapshot);
+		if (0 != stat)
+		{
+			return stat;
+		}
+
+		pctxt->buffer.byteIndex = pElem->buffer.byteIndex;
+		pctxt->buffer.bitOffset = pElem->buffer.bitOffset;
+
+		if (HAE_NULL != pStream->pfSnapshot)
+		{
+			stat = pStream->pfSnapshot(pStream->pArg, &pStream->header, i, &snapshot);
+		}
+		rtxMemReset(pElem);
+
+		if (HAE_OK != stat)
+		{
+			return stat;
+		}
+	}
+
+	return 0;
+}
+
+/* PVD-addGrpD ::= SEQUENCE { cits SEQUENCE (SIZE (1..32)) OF CITSPVD OPTIONAL, ... } */
+static int sDecode_AddGrpD(PVD_STREAM *pStream, const ASN1OpenType *pExt)
+{
+	int stat;
+	OSBOOL extbit, citsPresent;
+	OSUINT32 count, i;
+	CITSPVD cits;
+	OSCTXT *pElem = &pStream->elemCtxt;
+
+	pu_setBuffer(pElem, (OSOCTET *)pExt->data, pExt->numocts, FALSE);
+
+	stat = rtxDecBit(pElem, &extbit);
+	if (0 == stat) stat = rtxDecBit(pElem, &citsPresent);
+	if ((0 != stat) || (FALSE == citsPresent))
+	{
+		return stat;
+	}
+
+	stat = pd_ConsUnsigned(pElem, &count, 1, 32);
+
+	for (i = 0; (0 == stat) && (i < count); i++)
+	{
+		memset(&cits, 0, sizeof(cits));
+		stat = asn1PD_CITSPVD(pElem, &cits);
+		if ((0 == stat) && (HAE_NULL != pStream->pfCits))
+		{
+			stat = pStream->pfCits(pStream->pArg, &pStream->header, i, &cits);
+		}
+		rtxMemReset(pElem);
+	}
+
+	return stat;
+}
@@ -0,0 +1,34 @@
+#ifndef PVD_STREAM_H
+#define PVD_STREAM_H
+
+#include <DSRC.h>
+#include <AddGrpD.h>
+
+/* ProbeVehicleData fields in front of the snapshots, as CitsPvd_DecodeHead
+   leaves them: pvd.snapshots and pvd.regional stay empty.
+   Pointers inside are valid until PvdStream_Decode returns. */
+typedef struct{
+	ProbeVehicleData pvd;
+	unsigned int snapshotCnt;
+} PVD_STREAM_HEADER;
+
+/* Handlers return HAE_OK to continue, anything else stops the decode.
+   The element is only valid during the call, its memory is reclaimed
+   as soon as the handler returns. */
+typedef int (*PVD_SNAPSHOT_HANDLER)(void *pArg, const PVD_STREAM_HEADER *pHeader, unsigned int idx, const Snapshot *pSnapshot);
+typedef int (*PVD_CITS_HANDLER)(void *pArg, const PVD_STREAM_HEADER *pHeader, unsigned int idx, const CITSPVD *pCits);
+
+typedef struct{
+	OSCTXT ctxt;						/* header and regional list, reset per message */
+	OSCTXT elemCtxt;					/* one snapshot / CITSPVD at a time */
+	PVD_SNAPSHOT_HANDLER pfSnapshot;
+	PVD_CITS_HANDLER pfCits;
+	void *pArg;
+	PVD_STREAM_HEADER header;
+} PVD_STREAM;
+
+int PvdStream_Init(PVD_STREAM *pStream, PVD_SNAPSHOT_HANDLER pfSnapshot, PVD_CITS_HANDLER pfCits, void *pArg);
+void PvdStream_Free(PVD_STREAM *pStream);
+int PvdStream_Decode(PVD_STREAM *pStream, const unsigned char *pBuf, unsigned int ulLength);
+
+#endif
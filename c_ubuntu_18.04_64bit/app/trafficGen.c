@@ -0,0 +1,822 @@
+#define _GNU_SOURCE
+#include <DSRC.h>
+#include <rtxsrc/rtxMemory.h>
+#include <rtxsrc/rtxDList.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "haeCommon.h"
+#include "asnType.h"
+#include "decodeStats.h"
+
+/* Synthetic roadside traffic over UDP, and a load test of the decode path.
+
+   The corpus is built once, UPER MessageFrames behind the 16 octet header
+   decodeSample skips:
+
+     BSM   every vehicle, 10 frames = one second of driving (10 Hz)
+     SPaT  every intersection, 10 frames (10 Hz), 8 signal groups cycling
+     MAP   every intersection, 1 frame (1 Hz)
+     PSM   every pedestrian, 10 frames; the pedestrians cross in a burst of
+           one second every TRAFFIC_CYCLE_SEC
+
+   and scheduled over one cycle of TRAFFIC_CYCLE_SEC seconds, the frames of
+   a source evenly spread over its period. The sender plays the schedule
+   in a loop, -s times the real rate (0: as fast as it can), and stamps
+   the header of every datagram:
+
+     0..3   TRAFFIC_MAGIC
+     4..7   sequence number, big endian
+     8..15  CLOCK_MONOTONIC ns at send, host order
+
+   Unless -x is given, a receiver thread decodes the datagrams the way
+   decodeSample does (context per datagram, MessageFrame, then the value)
+   and counts: datagrams lost (sent - received), latency send -> decoded,
+   decode stats per message type (decodeStats) and the CPU time of both
+   threads per message. With -x only the sender runs, to load another
+   decoder (decodeSample) on the same port. */
+
+#define TRAFFIC_MAGIC			0x48414547	/* "HAEG" */
+#define TRAFFIC_HDR_LEN			16
+#define TRAFFIC_FRAME_MAX		BUFF_SIZE	/* receive buffer of decodeSample */
+#define TRAFFIC_CYCLE_SEC		5
+#define TRAFFIC_HZ				10
+#define TRAFFIC_BATCH			64			/* datagrams per sendmmsg */
+
+#define TRAFFIC_LAT				374981230	/* 37.4981230 N, 1/10 micro degree */
+#define TRAFFIC_LONG			1270271230	/* 127.0271230 E */
+#define TRAFFIC_ELEV			380			/* 38 m, 10 cm */
+
+typedef struct{
+	unsigned int offset;				/* in corpus_data */
+	unsigned int len;					/* header + frame */
+	unsigned int messageId;
+} TRAFFIC_FRAME;
+
+typedef struct{
+	unsigned long long atNs;			/* in the cycle, at rate 1 */
+	unsigned int frame;
+} TRAFFIC_EVENT;
+
+typedef struct{
+	const char *pAddr;
+	unsigned short port;
+	double scale;						/* 0: no pacing */
+	unsigned int seconds;
+	unsigned int vehicles;
+	unsigned int intersections;
+	unsigned int pedestrians;
+	unsigned int seed;
+	int rcvBuf;
+	unsigned char sendOnly;
+	const char *pStatsPath;
+} TRAFFIC_CONFIG;
+
+typedef struct{
+	int fd;
+	volatile int running;
+	unsigned long long rxCnt;
+	unsigned long long rxBytes;
+	unsigned long long badCnt;			/* not a corpus datagram */
+	unsigned long long errorCnt;		/* decode failed */
+	unsigned long long cpuNs;
+	STATS_HIST latency;					/* send -> decoded */
+	DECODE_STATS stats;
+} TRAFFIC_RECEIVER;
+
+static TRAFFIC_CONFIG traffic_config =
+{
+	"127.0.0.1", DSRC_PORT, 1.0, 10, 300, 8, 40, 1, 4 * 1024 * 1024, HAE_FALSE, HAE_NULL
+};
+
+static unsigned char *corpus_data = HAE_NULL;
+static size_t corpus_len = 0;
+static size_t corpus_size = 0;
+static TRAFFIC_FRAME *corpus_frame = HAE_NULL;
+static unsigned int corpus_cnt = 0;
+static TRAFFIC_EVENT *traffic_event = HAE_NULL;
+static unsigned int traffic_event_cnt = 0;
+static TRAFFIC_RECEIVER traffic_rx;
+
+static unsigned char value_buf[TRAFFIC_FRAME_MAX];
+
+static int sParseArgs(int argc, char **argv, TRAFFIC_CONFIG *pConfig);
+static int sBuildCorpus(const TRAFFIC_CONFIG *pConfig);
+static int sAddFrame(OSCTXT *pctxt, unsigned int messageId, const ASN_TYPE *pType, void *pValue);
+static void sBuildBsm(BasicSafetyMessage *pBsm, unsigned int vehicle, unsigned int tick, unsigned int *pSeed);
+static SPAT *sBuildSpat(OSCTXT *pctxt, unsigned int intersection, unsigned int tick);
+static void sBuildPsm(PersonalSafetyMessage *pPsm, unsigned int pedestrian, unsigned int tick, unsigned int *pSeed);
+static int sBuildSchedule(const TRAFFIC_CONFIG *pConfig);
+static int sCompareEvent(const void *pA, const void *pB);
+static int sSend(const TRAFFIC_CONFIG *pConfig, unsigned long long *pSentCnt, unsigned long long *pCpuNs);
+static void *sReceiveThread(void *pArg);
+static int sOpenReceiver(const TRAFFIC_CONFIG *pConfig, TRAFFIC_RECEIVER *pRx);
+static void sReport(const TRAFFIC_CONFIG *pConfig, unsigned long long sentCnt, unsigned long long sendCpuNs, double elapsed);
+static unsigned long long sThreadCpuNs(void);
+
+/*************************************************************
+ *
+ * Function 		: main
+ *
+ * Description	: Traffic generator and decode load test.
+ *
+ * Parameter	: -a addr     destination (127.0.0.1)
+ *				  -p port     destination port (60000)
+ *				  -s scale    times the real rate, 0 = max (1)
+ *				  -t seconds  run time (10)
+ *				  -v count    vehicles (300)
+ *				  -i count    intersections (8)
+ *				  -w count    pedestrians of a PSM burst (40)
+ *				  -r seed     random seed (1)
+ *				  -b bytes    SO_RCVBUF of the receiver (4 MiB)
+ *				  -o file     decode stats snapshot (JSON)
+ *				  -x          send only, no receiver
+ *
+ * Returns		: 0, 1 on error
+ *
+ *************************************************************/
+int main(int argc, char **argv)
+{
+	pthread_t thread;
+	unsigned long long sentCnt = 0, sendCpuNs = 0, t0;
+	double elapsed;
+	int ret;
+
+	if (HAE_OK != sParseArgs(argc, argv, &traffic_config))
+	{
+		return 1;
+	}
+
+	/* before the first context, it installs the heap count */
+	DecodeStats_Init(&traffic_rx.stats);
+
+	if ((HAE_OK != sBuildCorpus(&traffic_config)) || (HAE_OK != sBuildSchedule(&traffic_config)))
+	{
+		return 1;
+	}
+	printf("corpus %u frames %zu bytes, %u datagrams per %u s cycle = %.0f msg/s at scale 1\n", corpus_cnt, corpus_len,
+		traffic_event_cnt, TRAFFIC_CYCLE_SEC, (double)traffic_event_cnt / TRAFFIC_CYCLE_SEC);
+
+	if (HAE_FALSE == traffic_config.sendOnly)
+	{
+		if (HAE_OK != sOpenReceiver(&traffic_config, &traffic_rx))
+		{
+			return 1;
+		}
+		traffic_rx.running = HAE_TRUE;
+		if (0 != pthread_create(&thread, HAE_NULL, sReceiveThread, &traffic_rx))
+		{
+			printf("[TRAFFIC] ERROR : pthread_create() for the receiver\n");
+			return 1;
+		}
+	}
+
+	t0 = DecodeStats_Now();
+	ret = sSend(&traffic_config, &sentCnt, &sendCpuNs);
+	elapsed = (DecodeStats_Now() - t0) * 1e-9;
+
+	if (HAE_FALSE == traffic_config.sendOnly)
+	{
+		/* what is still queued is decoded before the count */
+		usleep(300 * 1000);
+		traffic_rx.running = HAE_FALSE;
+		pthread_join(thread, HAE_NULL);
+		close(traffic_rx.fd);
+	}
+	sReport(&traffic_config, sentCnt, sendCpuNs, elapsed);
+
+	DecodeStats_Free(&traffic_rx.stats);
+	free(traffic_event);
+	free(corpus_frame);
+	free(corpus_data);
+
+	return (HAE_OK == ret) ? 0 : 1;
+}
+
+static int sParseArgs(int argc, char **argv, TRAFFIC_CONFIG *pConfig)
+{
+	int opt;
+
+	while (-1 != (opt = getopt(argc, argv, "a:p:s:t:v:i:w:r:b:o:x")))
+	{
+		switch (opt)
+		{
+			case 'a': pConfig->pAddr = optarg; break;
+			case 'p': pConfig->port = (unsigned short)atoi(optarg); break;
+			case 's': pConfig->scale = atof(optarg); break;
+			case 't': pConfig->seconds = atoi(optarg); break;
+			case 'v': pConfig->vehicles = atoi(optarg); break;
+			case 'i': pConfig->intersections = atoi(optarg); break;
+			case 'w': pConfig->pedestrians = atoi(optarg); break;
+			case 'r': pConfig->seed = atoi(optarg); break;
+			case 'b': pConfig->rcvBuf = atoi(optarg); break;
+			case 'o': pConfig->pStatsPath = optarg; break;
+			case 'x': pConfig->sendOnly = HAE_TRUE; break;
+			default:
+				printf("usage: %s [-a addr] [-p port] [-s scale] [-t seconds] [-v vehicles] [-i intersections]\n"
+					"          [-w pedestrians] [-r seed] [-b rcvbuf] [-o stats.json] [-x]\n", argv[0]);
+				return HAE_ERROR;
+		}
+	}
+	if ((pConfig->scale < 0) || (0 == pConfig->seconds) || (pConfig->intersections > 255))
+	{
+		printf("[TRAFFIC] ERROR : bad arguments\n");
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+/*************************************************************
+ *
+ * Function 		: sBuildCorpus
+ *
+ * Description	: Encode every frame of the cycle. Values are set up
+ *				  with asn1Init_* (MAP from asn1Test_MapData) and
+ *				  filled with random but valid contents.
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+static int sBuildCorpus(const TRAFFIC_CONFIG *pConfig)
+{
+	int ret = HAE_OK;
+	unsigned int i, tick, seed = pConfig->seed;
+	const ASN_TYPE *pBsmType, *pSpatType, *pMapType, *pPsmType;
+	BasicSafetyMessage bsm;
+	PersonalSafetyMessage psm;
+	MapData *pMap;
+	IntersectionGeometry *pGeo;
+	OSCTXT ctxt;
+
+	pBsmType = AsnType_FindMessage(ASN1V_basicSafetyMessage);
+	pSpatType = AsnType_FindMessage(ASN1V_signalPhaseAndTimingMessage);
+	pMapType = AsnType_FindMessage(ASN1V_mapData);
+	pPsmType = AsnType_FindMessage(ASN1V_personalSafetyMessage);
+	if ((HAE_NULL == pBsmType) || (HAE_NULL == pSpatType) || (HAE_NULL == pMapType) || (HAE_NULL == pPsmType))
+	{
+		return HAE_ERROR;
+	}
+
+	corpus_frame = calloc((pConfig->vehicles + pConfig->intersections + pConfig->pedestrians) * TRAFFIC_HZ +
+		pConfig->intersections, sizeof(TRAFFIC_FRAME));
+	if (HAE_NULL == corpus_frame)
+	{
+		return HAE_ERROR;
+	}
+
+	rtInitContext(&ctxt);
+
+	for (i = 0; (i < pConfig->vehicles) && (HAE_OK == ret); i++)
+	{
+		for (tick = 0; (tick < TRAFFIC_HZ) && (HAE_OK == ret); tick++)
+		{
+			sBuildBsm(&bsm, i, tick, &seed);
+			ret = sAddFrame(&ctxt, ASN1V_basicSafetyMessage, pBsmType, &bsm);
+		}
+	}
+	for (i = 0; (i < pConfig->intersections) && (HAE_OK == ret); i++)
+	{
+		for (tick = 0; (tick < TRAFFIC_HZ) && (HAE_OK == ret); tick++)
+		{
+			rtxMemReset(&ctxt);
+			ret = sAddFrame(&ctxt, ASN1V_signalPhaseAndTimingMessage, pSpatType, sBuildSpat(&ctxt, i, tick));
+		}
+	}
+	for (i = 0; (i < pConfig->intersections) && (HAE_OK == ret); i++)
+	{
+		/* the library's test geometry, moved to the intersection */
+		rtxMemReset(&ctxt);
+		pMap = (MapData *)pMapType->pfTest(&ctxt);
+		if (HAE_NULL == pMap)
+		{
+			ret = HAE_ERROR;
+			break;
+		}
+		pMap->msgIssueRevision = i % 128;
+		if (pMap->m.intersectionsPresent && (HAE_NULL != pMap->intersections.head))
+		{
+			pGeo = (IntersectionGeometry *)pMap->intersections.head->data;
+			pGeo->id.m.regionPresent = 0;
+			pGeo->id.id = 100 + i;
+			pGeo->refPoint.lat = TRAFFIC_LAT + (int)i * 50000;
+			pGeo->refPoint.long_ = TRAFFIC_LONG + (int)i * 50000;
+		}
+		ret = sAddFrame(&ctxt, ASN1V_mapData, pMapType, pMap);
+	}
+	for (i = 0; (i < pConfig->pedestrians) && (HAE_OK == ret); i++)
+	{
+		for (tick = 0; (tick < TRAFFIC_HZ) && (HAE_OK == ret); tick++)
+		{
+			sBuildPsm(&psm, i, tick, &seed);
+			ret = sAddFrame(&ctxt, ASN1V_personalSafetyMessage, pPsmType, &psm);
+		}
+	}
+
+	rtFreeContext(&ctxt);
+
+	return ret;
+}
+
+/* UPER value inside a UPER MessageFrame, behind the header */
+static int sAddFrame(OSCTXT *pctxt, unsigned int messageId, const ASN_TYPE *pType, void *pValue)
+{
+	MessageFrame frame;
+	unsigned char *pNew;
+	size_t len;
+
+	if (HAE_NULL == pValue)
+	{
+		return HAE_ERROR;
+	}
+	if (corpus_size - corpus_len < TRAFFIC_FRAME_MAX)
+	{
+		corpus_size = (corpus_size > 0) ? corpus_size * 2 : 1024 * 1024;
+		if (HAE_NULL == (pNew = realloc(corpus_data, corpus_size)))
+		{
+			return HAE_ERROR;
+		}
+		corpus_data = pNew;
+	}
+
+	pu_setBuffer(pctxt, value_buf, sizeof(value_buf), FALSE);
+	if (0 != pType->pfPerEnc(pctxt, pValue))
+	{
+		printf("[TRAFFIC] ERROR : %s encode\n", pType->pName);
+		rtxErrPrint(pctxt);
+		return HAE_ERROR;
+	}
+	memset(&frame, 0x00, sizeof(frame));
+	frame.messageId = (DSRCmsgID)messageId;
+	frame.value.data = value_buf;
+	frame.value.numocts = pe_GetMsgLen(pctxt);
+
+	pu_setBuffer(pctxt, corpus_data + corpus_len + TRAFFIC_HDR_LEN, TRAFFIC_FRAME_MAX - TRAFFIC_HDR_LEN, FALSE);
+	if (0 != asn1PE_MessageFrame(pctxt, &frame))
+	{
+		printf("[TRAFFIC] ERROR : %s MessageFrame does not fit %d octets\n", pType->pName, TRAFFIC_FRAME_MAX);
+		rtxErrPrint(pctxt);
+		return HAE_ERROR;
+	}
+	len = TRAFFIC_HDR_LEN + pe_GetMsgLen(pctxt);
+	memset(corpus_data + corpus_len, 0x00, TRAFFIC_HDR_LEN);
+
+	corpus_frame[corpus_cnt].offset = corpus_len;
+	corpus_frame[corpus_cnt].len = len;
+	corpus_frame[corpus_cnt].messageId = messageId;
+	corpus_cnt++;
+	corpus_len += len;
+
+	return HAE_OK;
+}
+
+/* a vehicle on a straight road through the area, one tick = 100 ms */
+static void sBuildBsm(BasicSafetyMessage *pBsm, unsigned int vehicle, unsigned int tick, unsigned int *pSeed)
+{
+	BSMcoreData *pCore = &pBsm->coreData;
+	unsigned int speed;
+
+	asn1Init_BasicSafetyMessage(pBsm);
+
+	speed = 300 + rand_r(pSeed) % 1000;					/* 0.02 m/s: 6 .. 26 m/s */
+	pCore->msgCnt = tick;
+	pCore->id.numocts = 4;
+	pCore->id.data[0] = 0xb5;
+	pCore->id.data[1] = (OSOCTET)(vehicle >> 16);
+	pCore->id.data[2] = (OSOCTET)(vehicle >> 8);
+	pCore->id.data[3] = (OSOCTET)vehicle;
+	pCore->secMark = (vehicle * 7 + tick * 100) % 60000;
+	pCore->lat = TRAFFIC_LAT + (int)(vehicle % 20) * 2000 + (int)(tick * speed / 50);
+	pCore->long_ = TRAFFIC_LONG + (int)(vehicle / 20) * 2000 + rand_r(pSeed) % 100;
+	pCore->elev = TRAFFIC_ELEV + rand_r(pSeed) % 20;
+	pCore->accuracy.semiMajor = 20 + rand_r(pSeed) % 40;
+	pCore->accuracy.semiMinor = 20 + rand_r(pSeed) % 40;
+	pCore->accuracy.orientation = rand_r(pSeed) % 65535;
+	pCore->transmission = 2;							/* forwardGears */
+	pCore->speed = speed;
+	pCore->heading = (vehicle % 4) * 7200;
+	pCore->angle = (int)(rand_r(pSeed) % 21) - 10;
+	pCore->accelSet.long_ = (int)(rand_r(pSeed) % 201) - 100;
+	pCore->accelSet.lat = (int)(rand_r(pSeed) % 41) - 20;
+	pCore->accelSet.vert = (int)(rand_r(pSeed) % 11) - 5;
+	pCore->accelSet.yaw = (int)(rand_r(pSeed) % 201) - 100;
+	pCore->brakes.wheelBrakes.numbits = 5;
+	pCore->brakes.wheelBrakes.data[0] = (0 == rand_r(pSeed) % 8) ? 0x78 : 0x00;
+	pCore->brakes.traction = 1;
+	pCore->brakes.albs = 1;
+	pCore->brakes.scs = 1;
+	pCore->brakes.brakeBoost = 1;
+	pCore->brakes.auxBrakes = 1;
+	pCore->size.width = 170 + rand_r(pSeed) % 80;
+	pCore->size.length = 400 + rand_r(pSeed) % 800;
+}
+
+/* one controller, 8 signal groups, 60 s cycle */
+static SPAT *sBuildSpat(OSCTXT *pctxt, unsigned int intersection, unsigned int tick)
+{
+	/* MovementPhaseState over the cycle of a signal group */
+	static const unsigned int phase[4] = { 6, 8, 3, 3 };	/* protected, clearance, red, red */
+	SPAT *pSpat;
+	IntersectionState *pState;
+	MovementState *pMove;
+	MovementEvent *pEvent;
+	unsigned int group, step;
+
+	pSpat = rtxMemAllocTypeZ(pctxt, SPAT);
+	pState = rtxMemAllocTypeZ(pctxt, IntersectionState);
+	if ((HAE_NULL == pSpat) || (HAE_NULL == pState))
+	{
+		return HAE_NULL;
+	}
+	asn1Init_SPAT(pSpat);
+	asn1Init_IntersectionState(pState);
+	pSpat->m.timeStampPresent = 1;
+	pSpat->timeStamp = 421234;
+
+	pState->id.id = 100 + intersection;
+	pState->revision = tick;
+	pState->status.numbits = 16;
+	pState->m.timeStampPresent = 1;
+	pState->timeStamp = tick * 100;
+	for (group = 1; group <= 8; group++)
+	{
+		pMove = rtxMemAllocTypeZ(pctxt, MovementState);
+		pEvent = rtxMemAllocTypeZ(pctxt, MovementEvent);
+		if ((HAE_NULL == pMove) || (HAE_NULL == pEvent))
+		{
+			return HAE_NULL;
+		}
+		asn1Init_MovementState(pMove);
+		asn1Init_MovementEvent(pEvent);
+		step = (group + intersection) % 4;
+		pMove->signalGroup = group;
+		pEvent->eventState = phase[step];
+		pEvent->m.timingPresent = 1;
+		pEvent->timing.minEndTime = (tick * 10 + step * 150) % 36000;
+		rtxDListAppend(pctxt, &pMove->state_time_speed, pEvent);
+		rtxDListAppend(pctxt, &pState->states, pMove);
+	}
+	rtxDListAppend(pctxt, &pSpat->intersections, pState);
+
+	return pSpat;
+}
+
+/* a pedestrian crossing at 1.4 m/s */
+static void sBuildPsm(PersonalSafetyMessage *pPsm, unsigned int pedestrian, unsigned int tick, unsigned int *pSeed)
+{
+	asn1Init_PersonalSafetyMessage(pPsm);
+
+	pPsm->basicType = 1;								/* aPEDESTRIAN */
+	pPsm->secMark = (pedestrian * 13 + tick * 100) % 60000;
+	pPsm->msgCnt = tick;
+	pPsm->id.numocts = 4;
+	pPsm->id.data[0] = 0xa7;
+	pPsm->id.data[1] = 0x00;
+	pPsm->id.data[2] = (OSOCTET)(pedestrian >> 8);
+	pPsm->id.data[3] = (OSOCTET)pedestrian;
+	pPsm->position.lat = TRAFFIC_LAT + (int)(pedestrian % 8) * 50000 + (int)tick * 13;
+	pPsm->position.long_ = TRAFFIC_LONG + (int)(pedestrian % 8) * 50000 + rand_r(pSeed) % 30;
+	pPsm->position.m.elevationPresent = 1;
+	pPsm->position.elevation = TRAFFIC_ELEV;
+	pPsm->accuracy.semiMajor = 40 + rand_r(pSeed) % 40;
+	pPsm->accuracy.semiMinor = 40 + rand_r(pSeed) % 40;
+	pPsm->accuracy.orientation = rand_r(pSeed) % 65535;
+	pPsm->speed = 60 + rand_r(pSeed) % 20;				/* 0.02 m/s */
+	pPsm->heading = (pedestrian % 2) ? 0 : 14400;
+}
+
+/* the datagrams of one cycle in send order */
+static int sBuildSchedule(const TRAFFIC_CONFIG *pConfig)
+{
+	const unsigned long long tickNs = 1000000000ULL / TRAFFIC_HZ;
+	unsigned int i, tick, frame = 0, spatBase, mapBase, psmBase, cnt = 0;
+
+	spatBase = pConfig->vehicles * TRAFFIC_HZ;
+	mapBase = spatBase + pConfig->intersections * TRAFFIC_HZ;
+	psmBase = mapBase + pConfig->intersections;
+
+	traffic_event_cnt = (pConfig->vehicles + pConfig->intersections) * TRAFFIC_HZ * TRAFFIC_CYCLE_SEC +
+		pConfig->intersections * TRAFFIC_CYCLE_SEC + pConfig->pedestrians * TRAFFIC_HZ;
+	if ((0 == traffic_event_cnt) || (HAE_NULL == (traffic_event = calloc(traffic_event_cnt, sizeof(TRAFFIC_EVENT)))))
+	{
+		printf("[TRAFFIC] ERROR : nothing to send\n");
+		return HAE_ERROR;
+	}
+
+	for (tick = 0; tick < TRAFFIC_HZ * TRAFFIC_CYCLE_SEC; tick++)
+	{
+		for (i = 0; i < pConfig->vehicles; i++)
+		{
+			frame = i * TRAFFIC_HZ + tick % TRAFFIC_HZ;
+			traffic_event[cnt].atNs = tick * tickNs + tickNs * i / pConfig->vehicles;
+			traffic_event[cnt++].frame = frame;
+		}
+		for (i = 0; i < pConfig->intersections; i++)
+		{
+			traffic_event[cnt].atNs = tick * tickNs + tickNs * i / pConfig->intersections;
+			traffic_event[cnt++].frame = spatBase + i * TRAFFIC_HZ + tick % TRAFFIC_HZ;
+		}
+		if (0 == tick % TRAFFIC_HZ)
+		{
+			for (i = 0; i < pConfig->intersections; i++)
+			{
+				traffic_event[cnt].atNs = tick * tickNs + TRAFFIC_HZ * tickNs * i / pConfig->intersections;
+				traffic_event[cnt++].frame = mapBase + i;
+			}
+		}
+		/* burst: every pedestrian within 10 ms of the tick */
+		if (tick < TRAFFIC_HZ)
+		{
+			for (i = 0; i < pConfig->pedestrians; i++)
+			{
+				traffic_event[cnt].atNs = tick * tickNs + 10000000ULL * i / pConfig->pedestrians;
+				traffic_event[cnt++].frame = psmBase + i * TRAFFIC_HZ + tick;
+			}
+		}
+	}
+	qsort(traffic_event, cnt, sizeof(TRAFFIC_EVENT), sCompareEvent);
+
+	return HAE_OK;
+}
+
+static int sCompareEvent(const void *pA, const void *pB)
+{
+	const TRAFFIC_EVENT *pEventA = (const TRAFFIC_EVENT *)pA;
+	const TRAFFIC_EVENT *pEventB = (const TRAFFIC_EVENT *)pB;
+
+	return (pEventA->atNs < pEventB->atNs) ? -1 : (pEventA->atNs > pEventB->atNs) ? 1 : 0;
+}
+
+/*************************************************************
+ *
+ * Function 		: sSend
+ *
+ * Description	: Play the schedule for the configured time. The
+ *				  datagrams that are due go out in one sendmmsg, the
+ *				  sender sleeps until the next one is due.
+ *
+ * Returns		: HAE_OK, HAE_ERROR
+ *
+ *************************************************************/
+static int sSend(const TRAFFIC_CONFIG *pConfig, unsigned long long *pSentCnt, unsigned long long *pCpuNs)
+{
+	struct mmsghdr msg[TRAFFIC_BATCH];
+	struct iovec iov[TRAFFIC_BATCH];
+	struct sockaddr_in addr;
+	struct timespec ts;
+	unsigned long long start, end, now, cycleNs, dueNs, seq = 0, cpu0;
+	unsigned long long cycle = 0;
+	unsigned int next = 0, cnt, i;
+	unsigned char *pHdr;
+	int fd, sent;
+
+	memset(&addr, 0x00, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(pConfig->port);
+	if (1 != inet_pton(AF_INET, pConfig->pAddr, &addr.sin_addr))
+	{
+		printf("[TRAFFIC] ERROR : bad address %s\n", pConfig->pAddr);
+		return HAE_ERROR;
+	}
+	if ((fd = socket(AF_INET, SOCK_DGRAM, 0)) < 0)
+	{
+		printf("[TRAFFIC] ERROR : socket() (%s)\n", strerror(errno));
+		return HAE_ERROR;
+	}
+
+	memset(msg, 0x00, sizeof(msg));
+	for (i = 0; i < TRAFFIC_BATCH; i++)
+	{
+		msg[i].msg_hdr.msg_name = &addr;
+		msg[i].msg_hdr.msg_namelen = sizeof(addr);
+		msg[i].msg_hdr.msg_iov = &iov[i];
+		msg[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	cycleNs = TRAFFIC_CYCLE_SEC * 1000000000ULL;
+	cpu0 = sThreadCpuNs();
+	start = DecodeStats_Now();
+	end = start + pConfig->seconds * 1000000000ULL;
+	for (now = start; now < end; )
+	{
+		cnt = 0;
+		while (cnt < TRAFFIC_BATCH)
+		{
+			dueNs = (pConfig->scale > 0) ? start + (unsigned long long)((cycle * cycleNs + traffic_event[next].atNs) / pConfig->scale) : 0;
+			if (dueNs > now)
+			{
+				break;
+			}
+			pHdr = corpus_data + corpus_frame[traffic_event[next].frame].offset;
+			pHdr[0] = (unsigned char)(TRAFFIC_MAGIC >> 24);
+			pHdr[1] = (unsigned char)(TRAFFIC_MAGIC >> 16);
+			pHdr[2] = (unsigned char)(TRAFFIC_MAGIC >> 8);
+			pHdr[3] = (unsigned char)TRAFFIC_MAGIC;
+			pHdr[4] = (unsigned char)(seq >> 24);
+			pHdr[5] = (unsigned char)(seq >> 16);
+			pHdr[6] = (unsigned char)(seq >> 8);
+			pHdr[7] = (unsigned char)seq;
+			seq++;
+			iov[cnt].iov_base = pHdr;
+			iov[cnt].iov_len = corpus_frame[traffic_event[next].frame].len;
+			cnt++;
+			if (++next == traffic_event_cnt)
+			{
+				next = 0;
+				cycle++;
+			}
+		}
+
+		if (cnt > 0)
+		{
+			/* the same corpus frame may be twice in a batch, it carries the stamp of the last */
+			now = DecodeStats_Now();
+			for (i = 0; i < cnt; i++)
+			{
+				memcpy((unsigned char *)iov[i].iov_base + 8, &now, sizeof(now));
+			}
+			for (i = 0; i < cnt; i += sent)
+			{
+				sent = sendmmsg(fd, &msg[i], cnt - i, 0);
+				if (sent <= 0)
+				{
+					if ((EAGAIN == errno) || (ENOBUFS == errno) || (EINTR == errno))
+					{
+						sent = 0;
+						continue;
+					}
+					printf("[TRAFFIC] ERROR : sendmmsg() (%s)\n", strerror(errno));
+					close(fd);
+					return HAE_ERROR;
+				}
+				*pSentCnt += sent;
+			}
+		}
+		else
+		{
+			ts.tv_sec = dueNs / 1000000000ULL;
+			ts.tv_nsec = dueNs % 1000000000ULL;
+			clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, HAE_NULL);
+		}
+		now = DecodeStats_Now();
+	}
+	*pCpuNs = sThreadCpuNs() - cpu0;
+	close(fd);
+
+	return HAE_OK;
+}
+
+static int sOpenReceiver(const TRAFFIC_CONFIG *pConfig, TRAFFIC_RECEIVER *pRx)
+{
+	struct sockaddr_in addr;
+	struct timeval tv;
+
+	memset(&addr, 0x00, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(pConfig->port);
+	inet_pton(AF_INET, pConfig->pAddr, &addr.sin_addr);
+
+	if ((pRx->fd = socket(AF_INET, SOCK_DGRAM, 0)) < 0)
+	{
+		printf("[TRAFFIC] ERROR : socket() (%s)\n", strerror(errno));
+		return HAE_ERROR;
+	}
+	tv.tv_sec = 0;
+	tv.tv_usec = 100 * 1000;
+	setsockopt(pRx->fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+	setsockopt(pRx->fd, SOL_SOCKET, SO_RCVBUF, &pConfig->rcvBuf, sizeof(pConfig->rcvBuf));
+	if (0 != bind(pRx->fd, (struct sockaddr *)&addr, sizeof(addr)))
+	{
+		printf("[TRAFFIC] ERROR : bind() %s:%u (%s)\n", pConfig->pAddr, pConfig->port, strerror(errno));
+		close(pRx->fd);
+		return HAE_ERROR;
+	}
+
+	return HAE_OK;
+}
+
+/* the decode path of decodeSample: context per datagram, frame, value */
+static void *sReceiveThread(void *pArg)
+{
+	TRAFFIC_RECEIVER *pRx = (TRAFFIC_RECEIVER *)pArg;
+	unsigned char data[TRAFFIC_FRAME_MAX];
+	unsigned long long rxNs, txNs, decodedNs, cpu0;
+	size_t heap;
+	MessageFrame frame;
+	OSCTXT ctxt;
+	ssize_t len;
+	int status;
+
+	cpu0 = sThreadCpuNs();
+	while (pRx->running)
+	{
+		len = recv(pRx->fd, data, sizeof(data), 0);
+		if (len <= 0)
+		{
+			continue;
+		}
+		rxNs = DecodeStats_Now();
+		if ((len <= TRAFFIC_HDR_LEN) || (TRAFFIC_MAGIC != (unsigned int)((data[0] << 24) | (data[1] << 16) | (data[2] << 8) | data[3])))
+		{
+			pRx->badCnt++;
+			continue;
+		}
+		memcpy(&txNs, data + 8, sizeof(txNs));
+		pRx->rxCnt++;
+		pRx->rxBytes += len;
+
+		heap = DecodeStats_HeapBytes();
+		rtInitContext(&ctxt);
+		status = AsnType_DecodeFrame(&ctxt, data + TRAFFIC_HDR_LEN, len - TRAFFIC_HDR_LEN, &frame, HAE_NULL, HAE_NULL);
+		decodedNs = DecodeStats_Now();
+		heap = DecodeStats_HeapBytes() - heap;
+		rtFreeContext(&ctxt);
+
+		if (0 != status)
+		{
+			pRx->errorCnt++;
+		}
+		else if (decodedNs >= txNs)
+		{
+			DecodeStats_HistAdd(&pRx->latency, decodedNs - txNs);
+		}
+		DecodeStats_Record(&pRx->stats, frame.messageId, len - TRAFFIC_HDR_LEN, status, rxNs, decodedNs, 0, heap);
+	}
+	pRx->cpuNs = sThreadCpuNs() - cpu0;
+
+	return HAE_NULL;
+}
+
+static void sReport(const TRAFFIC_CONFIG *pConfig, unsigned long long sentCnt, unsigned long long sendCpuNs, double elapsed)
+{
+	const STATS_MSG *pMsg;
+	const ASN_TYPE *pType;
+	const char *pText;
+	unsigned long long lost;
+	unsigned int i;
+	size_t len;
+	FILE *pFile;
+
+	printf("sent     %llu datagrams in %.2f s = %.0f msg/s, sender CPU %.2f us/msg\n", sentCnt, elapsed,
+		sentCnt / elapsed, (sentCnt > 0) ? sendCpuNs * 1e-3 / sentCnt : 0.0);
+	if (pConfig->sendOnly)
+	{
+		return;
+	}
+
+	lost = (sentCnt > traffic_rx.rxCnt) ? sentCnt - traffic_rx.rxCnt : 0;
+	printf("received %llu datagrams, lost %llu (%.3f%%), decode errors %llu, foreign %llu\n", traffic_rx.rxCnt, lost,
+		(sentCnt > 0) ? 100.0 * lost / sentCnt : 0.0, traffic_rx.errorCnt, traffic_rx.badCnt);
+	printf("receiver CPU %.2f us/msg, %.1f%% of a core\n",
+		(traffic_rx.rxCnt > 0) ? traffic_rx.cpuNs * 1e-3 / traffic_rx.rxCnt : 0.0, traffic_rx.cpuNs * 1e-7 / elapsed);
+	printf("latency send -> decoded: p50 %.1f us, p99 %.1f us, p99.9 %.1f us, max %.1f us\n",
+		DecodeStats_HistPercentile(&traffic_rx.latency, 0.5) * 1e-3, DecodeStats_HistPercentile(&traffic_rx.latency, 0.99) * 1e-3,
+		DecodeStats_HistPercentile(&traffic_rx.latency, 0.999) * 1e-3, traffic_rx.latency.maxNs * 1e-3);
+
+	printf("%-24s %10s %8s %12s %12s %10s\n", "message", "received", "errors", "decode p50", "decode p99", "heap max");
+	for (i = 0; i < STATS_MSG_CNT; i++)
+	{
+		pMsg = &traffic_rx.stats.msg[i];
+		if (0 == pMsg->msgCnt)
+		{
+			continue;
+		}
+		pType = AsnType_FindMessage(pMsg->messageId);
+		printf("%-24s %10llu %8llu %9.1f us %9.1f us %10llu\n", (HAE_NULL != pType) ? pType->pName : "unknown",
+			pMsg->msgCnt, pMsg->errorCnt, DecodeStats_HistPercentile(&pMsg->lat[STATS_LAT_DECODE], 0.5) * 1e-3,
+			DecodeStats_HistPercentile(&pMsg->lat[STATS_LAT_DECODE], 0.99) * 1e-3, pMsg->heapMax);
+	}
+
+	if (HAE_NULL != pConfig->pStatsPath)
+	{
+		pText = DecodeStats_Snapshot(&traffic_rx.stats, &len);
+		if ((HAE_NULL == (pFile = fopen(pConfig->pStatsPath, "w"))) || (len != fwrite(pText, 1, len, pFile)))
+		{
+			printf("[TRAFFIC] ERROR : cannot write %s\n", pConfig->pStatsPath);
+		}
+		if (HAE_NULL != pFile)
+		{
+			fclose(pFile);
+		}
+	}
+}
+
+static unsigned long long sThreadCpuNs(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}